@@ -0,0 +1,136 @@
+// ACPI processor discovery.
+// The MADT lists every processor and I/O APIC, including on
+// machines too big for the MP tables that mp.c falls back to.
+// See section 5.2 of the ACPI specification: the RSDP points
+// to the RSDT, which points to the MADT among other tables.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "acpi.h"
+#include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+static uchar
+sum(uchar *addr, int len)
+{
+  int i, sum;
+
+  sum = 0;
+  for(i=0; i<len; i++)
+    sum += addr[i];
+  return sum;
+}
+
+// Look for the RSDP in the len bytes at physical address a.
+static struct acpirsdp*
+rsdpsearch1(uint a, int len)
+{
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+  e = addr+len;
+  for(p = addr; p < e; p += 16)
+    if(memcmp(p, "RSD PTR ", 8) == 0 && sum(p, 20) == 0)
+      return (struct acpirsdp*)p;
+  return 0;
+}
+
+// The RSDP is on a 16-byte boundary, either in the
+// first KB of the EBDA or in the BIOS area between
+// 0xE0000 and 0xFFFFF.
+static struct acpirsdp*
+rsdpsearch(void)
+{
+  uchar *bda;
+  uint p;
+  struct acpirsdp *rsdp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4))
+    if((rsdp = rsdpsearch1(p, 1024)))
+      return rsdp;
+  return rsdpsearch1(0xE0000, 0x20000);
+}
+
+// Map the table at physical address pa, which firmware usually
+// puts at the top of memory, and check its signature and sum.
+static struct acpihdr*
+acpitable(uint pa, char *sig)
+{
+  struct acpihdr *h;
+
+  if((h = kmapphys(pa, sizeof(*h))) == 0)
+    return 0;
+  if(memcmp(h->signature, sig, 4) != 0 || h->length < sizeof(*h))
+    return 0;
+  if(kmapphys(pa, h->length) == 0 || sum((uchar*)h, h->length) != 0)
+    return 0;
+  return h;
+}
+
+// Record the CPUs, local APIC and I/O APIC from the MADT.
+// Return -1 if there is no usable MADT.
+int
+acpiinit(void)
+{
+  struct acpirsdp *rsdp;
+  struct acpihdr *rsdt;
+  struct madt *madt;
+  struct madtlapic *lp;
+  struct madtx2apic *xp;
+  uint *t, *te;
+  uchar *p, *e;
+  int n, skipped;
+
+  if((rsdp = rsdpsearch()) == 0)
+    return -1;
+  if((rsdt = acpitable(rsdp->rsdt, "RSDT")) == 0)
+    return -1;
+  madt = 0;
+  te = (uint*)((uchar*)rsdt + rsdt->length);
+  for(t = (uint*)(rsdt+1); t < te && madt == 0; t++)
+    madt = (struct madt*)acpitable(*t, "APIC");
+  if(madt == 0)
+    return -1;
+
+  n = skipped = 0;
+  e = (uchar*)madt + madt->hdr.length;
+  for(p = (uchar*)(madt+1); p + 2 <= e && p[1] >= 2; p += p[1]){
+    switch(p[0]){
+    case MADT_LAPIC:
+      lp = (struct madtlapic*)p;
+      if(!(lp->flags & MADT_ENABLED))
+        break;
+      if(n < NCPU)
+        cpus[n++].apicid = lp->apicid;  // apicid may differ from n
+      else
+        skipped++;
+      break;
+    case MADT_X2APIC:
+      xp = (struct madtx2apic*)p;
+      if(!(xp->flags & MADT_ENABLED))
+        break;
+      if(n < NCPU)
+        cpus[n++].apicid = xp->apicid;
+      else
+        skipped++;
+      break;
+    case MADT_IOAPIC:
+      if(((struct madtioapic*)p)->gsibase == 0)
+        ioapicid = ((struct madtioapic*)p)->apicno;
+      break;
+    }
+  }
+  if(n == 0)
+    return -1;
+  if(skipped)
+    cprintf("acpi: %d cpus beyond NCPU not used\n", skipped);
+  ncpu = n;
+  lapic = (uint*)madt->lapicaddr;
+  ismp = 1;
+  return 0;
+}
@@ -0,0 +1,67 @@
+// ACPI tables, as far as needed to find the processors.
+// See the Advanced Configuration and Power Interface
+// Specification, chapter 5.
+
+struct acpirsdp {       // root system description pointer
+  uchar signature[8];           // "RSD PTR "
+  uchar checksum;               // first 20 bytes add up to 0
+  uchar oemid[6];
+  uchar revision;               // 0 for ACPI 1.0, 2 for 2.0+
+  uint rsdt;                    // phys addr of RSDT
+  // ACPI 2.0 adds a length, the XSDT and an extended checksum;
+  // the RSDT holds the same tables at addresses we can reach.
+};
+
+struct acpihdr {        // header of every table but the RSDP
+  uchar signature[4];
+  uint length;                  // of the table, header included
+  uchar revision;
+  uchar checksum;               // whole table adds up to 0
+  uchar oemid[6];
+  uchar oemtableid[8];
+  uint oemrevision;
+  uchar creatorid[4];
+  uint creatorrevision;
+};
+
+// The RSDT is an acpihdr with signature "RSDT"
+// followed by the phys addrs of the other tables.
+
+struct madt {           // multiple APIC description table
+  struct acpihdr hdr;           // "APIC"
+  uint lapicaddr;               // phys addr of local APICs
+  uint flags;
+  // followed by entries, each starting with type and length
+};
+
+// MADT entry types
+#define MADT_LAPIC    0x00
+#define MADT_IOAPIC   0x01
+#define MADT_X2APIC   0x09
+
+struct madtlapic {      // processor with a local APIC
+  uchar type;                   // MADT_LAPIC
+  uchar length;                 // 8
+  uchar acpiid;                 // ACPI processor id
+  uchar apicid;                 // local APIC id
+  uint flags;
+    #define MADT_ENABLED  0x01    // usable now
+};
+
+struct madtioapic {     // I/O APIC
+  uchar type;                   // MADT_IOAPIC
+  uchar length;                 // 12
+  uchar apicno;                 // I/O APIC id
+  uchar reserved;
+  uint addr;                    // phys addr of I/O APIC
+  uint gsibase;                 // first interrupt it handles
+};
+
+struct madtx2apic {     // processor with an x2APIC id above 254
+  uchar type;                   // MADT_X2APIC
+  uchar length;                 // 16
+  ushort reserved;
+  uint apicid;                  // x2APIC id
+  uint flags;                   // MADT_ENABLED
+  uint acpiuid;
+};
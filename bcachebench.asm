@@ -0,0 +1,2403 @@
+
+_bcachebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(dfd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	bf 64 00 00 00       	mov    $0x64,%edi
+      13:	56                   	push   %esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+      1c:	8b 19                	mov    (%ecx),%ebx
+      1e:	8b 71 04             	mov    0x4(%ecx),%esi
+  int i, fd, nbuf, rounds, old, t;
+  uint hit, miss;
+  char name[8];
+
+  nbuf = argc > 1 ? atoi(argv[1]) : 100;
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+      21:	c7 85 3c ff ff ff 04 	movl   $0x4,-0xc4(%ebp)
+      28:	00 00 00 
+  nbuf = argc > 1 ? atoi(argv[1]) : 100;
+      2b:	83 fb 01             	cmp    $0x1,%ebx
+      2e:	0f 8f db 00 00 00    	jg     10f <main+0x10f>
+  if(nbuf < 1 || rounds < 1){
+    printf(2, "usage: bcachebench [buffers [rounds]]\n");
+    exit();
+  }
+
+  mkdir("bcb");
+      34:	83 ec 0c             	sub    $0xc,%esp
+  memset(buf, 'x', sizeof(buf));
+  for(i = 0; i < NSMALL; i++){
+      37:	31 db                	xor    %ebx,%ebx
+  name[5] = '0' + i/10;
+      39:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  mkdir("bcb");
+      3e:	68 26 11 00 00       	push   $0x1126
+      43:	e8 13 09 00 00       	call   95b <mkdir>
+  memset(buf, 'x', sizeof(buf));
+      48:	83 c4 0c             	add    $0xc,%esp
+      4b:	68 00 02 00 00       	push   $0x200
+      50:	6a 78                	push   $0x78
+      52:	68 a0 17 00 00       	push   $0x17a0
+      57:	e8 14 07 00 00       	call   770 <memset>
+  name[5] = '0' + i/10;
+      5c:	89 bd 44 ff ff ff    	mov    %edi,-0xbc(%ebp)
+  memset(buf, 'x', sizeof(buf));
+      62:	83 c4 10             	add    $0x10,%esp
+      65:	eb 39                	jmp    a0 <main+0xa0>
+      67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      6e:	66 90                	xchg   %ax,%ax
+    fname(name, i);
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0 ||
+       write(fd, buf, 100) != 100){
+      70:	83 ec 04             	sub    $0x4,%esp
+      73:	6a 64                	push   $0x64
+      75:	68 a0 17 00 00       	push   $0x17a0
+      7a:	50                   	push   %eax
+      7b:	e8 93 08 00 00       	call   913 <write>
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0 ||
+      80:	83 c4 10             	add    $0x10,%esp
+      83:	83 f8 64             	cmp    $0x64,%eax
+      86:	75 6e                	jne    f6 <main+0xf6>
+      printf(2, "bcachebench: cannot create %s\n", name);
+      exit();
+    }
+    close(fd);
+      88:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NSMALL; i++){
+      8b:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+      8e:	57                   	push   %edi
+      8f:	e8 87 08 00 00       	call   91b <close>
+  for(i = 0; i < NSMALL; i++){
+      94:	83 c4 10             	add    $0x10,%esp
+      97:	83 fb 20             	cmp    $0x20,%ebx
+      9a:	0f 84 bc 00 00 00    	je     15c <main+0x15c>
+  strcpy(name, "bcb/f00");
+      a0:	83 ec 08             	sub    $0x8,%esp
+      a3:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+      a9:	68 2a 11 00 00       	push   $0x112a
+      ae:	50                   	push   %eax
+      af:	e8 fc 05 00 00       	call   6b0 <strcpy>
+  name[5] = '0' + i/10;
+      b4:	89 d8                	mov    %ebx,%eax
+      b6:	5a                   	pop    %edx
+      b7:	59                   	pop    %ecx
+      b8:	f7 e6                	mul    %esi
+      ba:	c1 ea 03             	shr    $0x3,%edx
+      bd:	8d 42 30             	lea    0x30(%edx),%eax
+  name[6] = '0' + i%10;
+      c0:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  name[5] = '0' + i/10;
+      c3:	88 85 51 ff ff ff    	mov    %al,-0xaf(%ebp)
+  name[6] = '0' + i%10;
+      c9:	01 d2                	add    %edx,%edx
+      cb:	89 d8                	mov    %ebx,%eax
+      cd:	29 d0                	sub    %edx,%eax
+      cf:	83 c0 30             	add    $0x30,%eax
+      d2:	88 85 52 ff ff ff    	mov    %al,-0xae(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0 ||
+      d8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+      de:	68 02 02 00 00       	push   $0x202
+      e3:	50                   	push   %eax
+      e4:	e8 4a 08 00 00       	call   933 <open>
+      e9:	83 c4 10             	add    $0x10,%esp
+      ec:	89 c7                	mov    %eax,%edi
+      ee:	85 c0                	test   %eax,%eax
+      f0:	0f 89 7a ff ff ff    	jns    70 <main+0x70>
+      printf(2, "bcachebench: cannot create %s\n", name);
+      f6:	50                   	push   %eax
+      f7:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+      fd:	50                   	push   %eax
+      fe:	68 ec 11 00 00       	push   $0x11ec
+     103:	6a 02                	push   $0x2
+     105:	e8 f6 09 00 00       	call   b00 <printf>
+      exit();
+     10a:	e8 e4 07 00 00       	call   8f3 <exit>
+  nbuf = argc > 1 ? atoi(argv[1]) : 100;
+     10f:	83 ec 0c             	sub    $0xc,%esp
+     112:	ff 76 04             	push   0x4(%esi)
+     115:	e8 66 07 00 00       	call   880 <atoi>
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+     11a:	83 c4 10             	add    $0x10,%esp
+  nbuf = argc > 1 ? atoi(argv[1]) : 100;
+     11d:	89 c7                	mov    %eax,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+     11f:	83 fb 02             	cmp    $0x2,%ebx
+     122:	74 14                	je     138 <main+0x138>
+     124:	83 ec 0c             	sub    $0xc,%esp
+     127:	ff 76 08             	push   0x8(%esi)
+     12a:	e8 51 07 00 00       	call   880 <atoi>
+     12f:	83 c4 10             	add    $0x10,%esp
+     132:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%ebp)
+  if(nbuf < 1 || rounds < 1){
+     138:	85 ff                	test   %edi,%edi
+     13a:	7e 0d                	jle    149 <main+0x149>
+     13c:	83 bd 3c ff ff ff 00 	cmpl   $0x0,-0xc4(%ebp)
+     143:	0f 8f eb fe ff ff    	jg     34 <main+0x34>
+    printf(2, "usage: bcachebench [buffers [rounds]]\n");
+     149:	53                   	push   %ebx
+     14a:	53                   	push   %ebx
+     14b:	68 c4 11 00 00       	push   $0x11c4
+     150:	6a 02                	push   $0x2
+     152:	e8 a9 09 00 00       	call   b00 <printf>
+    exit();
+     157:	e8 97 07 00 00       	call   8f3 <exit>
+  }
+  old = bcachesize(nbuf);
+     15c:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+     162:	83 ec 0c             	sub    $0xc,%esp
+     165:	8d b5 64 ff ff ff    	lea    -0x9c(%ebp),%esi
+     16b:	57                   	push   %edi
+     16c:	e8 e2 08 00 00       	call   a53 <bcachesize>
+     171:	89 c7                	mov    %eax,%edi
+  printf(1, "%d buffers, %d small files\n", bcachesize(0), NSMALL);
+     173:	31 c0                	xor    %eax,%eax
+     175:	89 04 24             	mov    %eax,(%esp)
+     178:	e8 d6 08 00 00       	call   a53 <bcachesize>
+     17d:	6a 20                	push   $0x20
+     17f:	50                   	push   %eax
+     180:	68 32 11 00 00       	push   $0x1132
+     185:	6a 01                	push   $0x1
+     187:	e8 74 09 00 00       	call   b00 <printf>
+
+  col("ROUND", 7);
+     18c:	83 c4 20             	add    $0x20,%esp
+     18f:	ba 07 00 00 00       	mov    $0x7,%edx
+     194:	b8 4e 11 00 00       	mov    $0x114e,%eax
+     199:	e8 92 03 00 00       	call   530 <col>
+  col("META-HIT%", 11);
+     19e:	ba 0b 00 00 00       	mov    $0xb,%edx
+     1a3:	b8 54 11 00 00       	mov    $0x1154,%eax
+     1a8:	e8 83 03 00 00       	call   530 <col>
+  col("META-MISS", 11);
+     1ad:	ba 0b 00 00 00       	mov    $0xb,%edx
+     1b2:	b8 5e 11 00 00       	mov    $0x115e,%eax
+     1b7:	e8 74 03 00 00       	call   530 <col>
+  col("SCAN-MISS", 11);
+     1bc:	ba 0b 00 00 00       	mov    $0xb,%edx
+     1c1:	b8 68 11 00 00       	mov    $0x1168,%eax
+     1c6:	e8 65 03 00 00       	call   530 <col>
+  col("EVICT", 8);
+     1cb:	ba 08 00 00 00       	mov    $0x8,%edx
+     1d0:	b8 72 11 00 00       	mov    $0x1172,%eax
+     1d5:	e8 56 03 00 00       	call   530 <col>
+  col("PROMOTE", 9);
+     1da:	b8 78 11 00 00       	mov    $0x1178,%eax
+     1df:	ba 09 00 00 00       	mov    $0x9,%edx
+     1e4:	e8 47 03 00 00       	call   530 <col>
+  printf(1, "TICKS\n");
+     1e9:	50                   	push   %eax
+     1ea:	50                   	push   %eax
+     1eb:	68 80 11 00 00       	push   $0x1180
+     1f0:	6a 01                	push   $0x1
+     1f2:	e8 09 09 00 00       	call   b00 <printf>
+  for(i = 0; i < rounds; i++){
+     1f7:	31 c0                	xor    %eax,%eax
+    memmove(name+1, de.name, DIRSIZ);
+     1f9:	89 bd 34 ff ff ff    	mov    %edi,-0xcc(%ebp)
+  printf(1, "TICKS\n");
+     1ff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < rounds; i++){
+     202:	89 85 40 ff ff ff    	mov    %eax,-0xc0(%ebp)
+     208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+    t = uptime();
+     210:	e8 76 07 00 00       	call   98b <uptime>
+  for(i = 0; i < NSMALL; i++){
+     215:	31 db                	xor    %ebx,%ebx
+    t = uptime();
+     217:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%ebp)
+    counts(c0);
+     21d:	8d 45 88             	lea    -0x78(%ebp),%eax
+     220:	e8 6b 03 00 00       	call   590 <counts>
+  for(i = 0; i < NSMALL; i++){
+     225:	8d 76 00             	lea    0x0(%esi),%esi
+  strcpy(name, "bcb/f00");
+     228:	83 ec 08             	sub    $0x8,%esp
+     22b:	68 2a 11 00 00       	push   $0x112a
+     230:	56                   	push   %esi
+     231:	e8 7a 04 00 00       	call   6b0 <strcpy>
+  name[5] = '0' + i/10;
+     236:	5f                   	pop    %edi
+     237:	58                   	pop    %eax
+     238:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     23d:	f7 e3                	mul    %ebx
+     23f:	c1 ea 03             	shr    $0x3,%edx
+     242:	8d 42 30             	lea    0x30(%edx),%eax
+  name[6] = '0' + i%10;
+     245:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  name[5] = '0' + i/10;
+     248:	88 85 69 ff ff ff    	mov    %al,-0x97(%ebp)
+  name[6] = '0' + i%10;
+     24e:	01 d2                	add    %edx,%edx
+     250:	89 d8                	mov    %ebx,%eax
+     252:	29 d0                	sub    %edx,%eax
+     254:	83 c0 30             	add    $0x30,%eax
+     257:	88 85 6a ff ff ff    	mov    %al,-0x96(%ebp)
+    if(stat(name, &st) < 0 || (fd = open(name, O_RDONLY)) < 0){
+     25d:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+     263:	50                   	push   %eax
+     264:	56                   	push   %esi
+     265:	e8 c6 05 00 00       	call   830 <stat>
+     26a:	83 c4 10             	add    $0x10,%esp
+     26d:	85 c0                	test   %eax,%eax
+     26f:	0f 88 92 02 00 00    	js     507 <main+0x507>
+     275:	83 ec 08             	sub    $0x8,%esp
+     278:	6a 00                	push   $0x0
+     27a:	56                   	push   %esi
+     27b:	e8 b3 06 00 00       	call   933 <open>
+     280:	83 c4 10             	add    $0x10,%esp
+     283:	89 c7                	mov    %eax,%edi
+     285:	85 c0                	test   %eax,%eax
+     287:	0f 88 7a 02 00 00    	js     507 <main+0x507>
+    read(fd, buf, sizeof(buf));
+     28d:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NSMALL; i++){
+     290:	83 c3 01             	add    $0x1,%ebx
+    read(fd, buf, sizeof(buf));
+     293:	68 00 02 00 00       	push   $0x200
+     298:	68 a0 17 00 00       	push   $0x17a0
+     29d:	50                   	push   %eax
+     29e:	e8 68 06 00 00       	call   90b <read>
+    close(fd);
+     2a3:	89 3c 24             	mov    %edi,(%esp)
+     2a6:	e8 70 06 00 00       	call   91b <close>
+  for(i = 0; i < NSMALL; i++){
+     2ab:	83 c4 10             	add    $0x10,%esp
+     2ae:	83 fb 20             	cmp    $0x20,%ebx
+     2b1:	0f 85 71 ff ff ff    	jne    228 <main+0x228>
+    meta();
+    counts(c1);
+     2b7:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     2ba:	e8 d1 02 00 00       	call   590 <counts>
+  if((dfd = open("/", O_RDONLY)) < 0){
+     2bf:	83 ec 08             	sub    $0x8,%esp
+     2c2:	6a 00                	push   $0x0
+     2c4:	68 a4 11 00 00       	push   $0x11a4
+     2c9:	e8 65 06 00 00       	call   933 <open>
+     2ce:	83 c4 10             	add    $0x10,%esp
+     2d1:	89 c3                	mov    %eax,%ebx
+     2d3:	85 c0                	test   %eax,%eax
+     2d5:	0f 88 3f 02 00 00    	js     51a <main+0x51a>
+  name[0] = '/';
+     2db:	c6 85 64 ff ff ff 2f 	movb   $0x2f,-0x9c(%ebp)
+  name[DIRSIZ+1] = 0;
+     2e2:	8d bd 54 ff ff ff    	lea    -0xac(%ebp),%edi
+     2e8:	c6 85 73 ff ff ff 00 	movb   $0x0,-0x8d(%ebp)
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+     2ef:	90                   	nop
+     2f0:	83 ec 04             	sub    $0x4,%esp
+     2f3:	6a 10                	push   $0x10
+     2f5:	57                   	push   %edi
+     2f6:	53                   	push   %ebx
+     2f7:	e8 0f 06 00 00       	call   90b <read>
+     2fc:	83 c4 10             	add    $0x10,%esp
+     2ff:	83 f8 10             	cmp    $0x10,%eax
+     302:	75 7c                	jne    380 <main+0x380>
+    if(de.inum == 0)
+     304:	66 83 bd 54 ff ff ff 	cmpw   $0x0,-0xac(%ebp)
+     30b:	00 
+     30c:	74 e2                	je     2f0 <main+0x2f0>
+    memmove(name+1, de.name, DIRSIZ);
+     30e:	83 ec 04             	sub    $0x4,%esp
+     311:	8d 85 56 ff ff ff    	lea    -0xaa(%ebp),%eax
+     317:	6a 0e                	push   $0xe
+     319:	50                   	push   %eax
+     31a:	8d 85 65 ff ff ff    	lea    -0x9b(%ebp),%eax
+     320:	50                   	push   %eax
+     321:	e8 9a 05 00 00       	call   8c0 <memmove>
+    if((fd = open(name, O_RDONLY)) < 0)
+     326:	58                   	pop    %eax
+     327:	5a                   	pop    %edx
+     328:	6a 00                	push   $0x0
+     32a:	56                   	push   %esi
+     32b:	e8 03 06 00 00       	call   933 <open>
+     330:	83 c4 10             	add    $0x10,%esp
+     333:	89 c2                	mov    %eax,%edx
+     335:	85 c0                	test   %eax,%eax
+     337:	78 b7                	js     2f0 <main+0x2f0>
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+     339:	83 ec 08             	sub    $0x8,%esp
+     33c:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+     342:	50                   	push   %eax
+     343:	52                   	push   %edx
+     344:	89 95 44 ff ff ff    	mov    %edx,-0xbc(%ebp)
+     34a:	e8 fc 05 00 00       	call   94b <fstat>
+     34f:	83 c4 10             	add    $0x10,%esp
+     352:	8b 95 44 ff ff ff    	mov    -0xbc(%ebp),%edx
+     358:	85 c0                	test   %eax,%eax
+     35a:	75 0e                	jne    36a <main+0x36a>
+     35c:	66 83 bd 74 ff ff ff 	cmpw   $0x2,-0x8c(%ebp)
+     363:	02 
+     364:	0f 84 67 01 00 00    	je     4d1 <main+0x4d1>
+    close(fd);
+     36a:	83 ec 0c             	sub    $0xc,%esp
+     36d:	52                   	push   %edx
+     36e:	e8 a8 05 00 00       	call   91b <close>
+     373:	83 c4 10             	add    $0x10,%esp
+     376:	e9 75 ff ff ff       	jmp    2f0 <main+0x2f0>
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+  close(dfd);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	53                   	push   %ebx
+     384:	e8 92 05 00 00       	call   91b <close>
+    scan();
+    counts(c2);
+     389:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     38c:	e8 ff 01 00 00       	call   590 <counts>
+    hit = c1[CS_BHIT] - c0[CS_BHIT];
+    miss = c1[CS_BMISS] - c0[CS_BMISS];
+     391:	8b 7d bc             	mov    -0x44(%ebp),%edi
+    coln(i, 7);
+     394:	ba 07 00 00 00       	mov    $0x7,%edx
+    hit = c1[CS_BHIT] - c0[CS_BHIT];
+     399:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+     39c:	2b 5d 98             	sub    -0x68(%ebp),%ebx
+    miss = c1[CS_BMISS] - c0[CS_BMISS];
+     39f:	89 f8                	mov    %edi,%eax
+     3a1:	2b 45 9c             	sub    -0x64(%ebp),%eax
+     3a4:	89 85 44 ff ff ff    	mov    %eax,-0xbc(%ebp)
+    coln(i, 7);
+     3aa:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+     3b0:	e8 5b 02 00 00       	call   610 <coln>
+    coln(hit+miss ? hit*100 / (hit+miss) : 0, 11);
+     3b5:	8b 8d 44 ff ff ff    	mov    -0xbc(%ebp),%ecx
+     3bb:	83 c4 10             	add    $0x10,%esp
+     3be:	01 d9                	add    %ebx,%ecx
+     3c0:	74 09                	je     3cb <main+0x3cb>
+     3c2:	6b c3 64             	imul   $0x64,%ebx,%eax
+     3c5:	31 d2                	xor    %edx,%edx
+     3c7:	f7 f1                	div    %ecx
+     3c9:	89 c1                	mov    %eax,%ecx
+     3cb:	89 c8                	mov    %ecx,%eax
+     3cd:	ba 0b 00 00 00       	mov    $0xb,%edx
+     3d2:	e8 39 02 00 00       	call   610 <coln>
+    coln(miss, 11);
+     3d7:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+     3dd:	ba 0b 00 00 00       	mov    $0xb,%edx
+     3e2:	e8 29 02 00 00       	call   610 <coln>
+    coln(c2[CS_BMISS] - c1[CS_BMISS], 11);
+     3e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     3ea:	ba 0b 00 00 00       	mov    $0xb,%edx
+     3ef:	29 f8                	sub    %edi,%eax
+     3f1:	e8 1a 02 00 00       	call   610 <coln>
+    coln(c2[CS_BEVICT] - c0[CS_BEVICT], 8);
+     3f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     3f9:	ba 08 00 00 00       	mov    $0x8,%edx
+     3fe:	2b 45 a0             	sub    -0x60(%ebp),%eax
+     401:	e8 0a 02 00 00       	call   610 <coln>
+    coln(c2[CS_BPROMOTE] - c0[CS_BPROMOTE], 9);
+     406:	ba 09 00 00 00       	mov    $0x9,%edx
+     40b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     40e:	2b 45 a4             	sub    -0x5c(%ebp),%eax
+     411:	e8 fa 01 00 00       	call   610 <coln>
+    coln(uptime() - t, 0);
+     416:	e8 70 05 00 00       	call   98b <uptime>
+     41b:	8b 8d 38 ff ff ff    	mov    -0xc8(%ebp),%ecx
+     421:	31 d2                	xor    %edx,%edx
+     423:	29 c8                	sub    %ecx,%eax
+     425:	e8 e6 01 00 00       	call   610 <coln>
+    printf(1, "\n");
+     42a:	83 ec 08             	sub    $0x8,%esp
+     42d:	68 c0 11 00 00       	push   $0x11c0
+     432:	6a 01                	push   $0x1
+     434:	e8 c7 06 00 00       	call   b00 <printf>
+  for(i = 0; i < rounds; i++){
+     439:	83 85 40 ff ff ff 01 	addl   $0x1,-0xc0(%ebp)
+     440:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+     446:	83 c4 10             	add    $0x10,%esp
+     449:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+     44f:	39 c8                	cmp    %ecx,%eax
+     451:	0f 85 b9 fd ff ff    	jne    210 <main+0x210>
+  }
+
+  bcachesize(old);
+     457:	8b bd 34 ff ff ff    	mov    -0xcc(%ebp),%edi
+     45d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NSMALL; i++){
+     460:	31 f6                	xor    %esi,%esi
+  name[5] = '0' + i/10;
+     462:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  bcachesize(old);
+     467:	57                   	push   %edi
+     468:	e8 e6 05 00 00       	call   a53 <bcachesize>
+     46d:	83 c4 10             	add    $0x10,%esp
+  strcpy(name, "bcb/f00");
+     470:	83 ec 08             	sub    $0x8,%esp
+     473:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+     479:	68 2a 11 00 00       	push   $0x112a
+     47e:	50                   	push   %eax
+     47f:	e8 2c 02 00 00       	call   6b0 <strcpy>
+  name[5] = '0' + i/10;
+     484:	89 f0                	mov    %esi,%eax
+     486:	f7 e3                	mul    %ebx
+     488:	c1 ea 03             	shr    $0x3,%edx
+     48b:	8d 42 30             	lea    0x30(%edx),%eax
+  name[6] = '0' + i%10;
+     48e:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  name[5] = '0' + i/10;
+     491:	88 85 51 ff ff ff    	mov    %al,-0xaf(%ebp)
+  name[6] = '0' + i%10;
+     497:	01 d2                	add    %edx,%edx
+     499:	89 f0                	mov    %esi,%eax
+  for(i = 0; i < NSMALL; i++){
+     49b:	83 c6 01             	add    $0x1,%esi
+  name[6] = '0' + i%10;
+     49e:	29 d0                	sub    %edx,%eax
+     4a0:	83 c0 30             	add    $0x30,%eax
+     4a3:	88 85 52 ff ff ff    	mov    %al,-0xae(%ebp)
+    fname(name, i);
+    unlink(name);
+     4a9:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+     4af:	89 04 24             	mov    %eax,(%esp)
+     4b2:	e8 8c 04 00 00       	call   943 <unlink>
+  for(i = 0; i < NSMALL; i++){
+     4b7:	83 c4 10             	add    $0x10,%esp
+     4ba:	83 fe 20             	cmp    $0x20,%esi
+     4bd:	75 b1                	jne    470 <main+0x470>
+  }
+  unlink("bcb");
+     4bf:	83 ec 0c             	sub    $0xc,%esp
+     4c2:	68 26 11 00 00       	push   $0x1126
+     4c7:	e8 77 04 00 00       	call   943 <unlink>
+  exit();
+     4cc:	e8 22 04 00 00       	call   8f3 <exit>
+     4d1:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+     4d7:	89 d3                	mov    %edx,%ebx
+     4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      while(read(fd, buf, sizeof(buf)) > 0)
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	68 00 02 00 00       	push   $0x200
+     4e8:	68 a0 17 00 00       	push   $0x17a0
+     4ed:	53                   	push   %ebx
+     4ee:	e8 18 04 00 00       	call   90b <read>
+     4f3:	83 c4 10             	add    $0x10,%esp
+     4f6:	85 c0                	test   %eax,%eax
+     4f8:	7f e6                	jg     4e0 <main+0x4e0>
+     4fa:	89 da                	mov    %ebx,%edx
+     4fc:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+     502:	e9 63 fe ff ff       	jmp    36a <main+0x36a>
+      printf(2, "bcachebench: cannot open %s\n", name);
+     507:	53                   	push   %ebx
+     508:	56                   	push   %esi
+     509:	68 87 11 00 00       	push   $0x1187
+     50e:	6a 02                	push   $0x2
+     510:	e8 eb 05 00 00       	call   b00 <printf>
+      exit();
+     515:	e8 d9 03 00 00       	call   8f3 <exit>
+    printf(2, "bcachebench: cannot open /\n");
+     51a:	51                   	push   %ecx
+     51b:	51                   	push   %ecx
+     51c:	68 a6 11 00 00       	push   $0x11a6
+     521:	6a 02                	push   $0x2
+     523:	e8 d8 05 00 00       	call   b00 <printf>
+    exit();
+     528:	e8 c6 03 00 00       	call   8f3 <exit>
+     52d:	66 90                	xchg   %ax,%ax
+     52f:	90                   	nop
+
+00000530 <col>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	57                   	push   %edi
+     534:	89 c7                	mov    %eax,%edi
+     536:	56                   	push   %esi
+     537:	89 d6                	mov    %edx,%esi
+     539:	53                   	push   %ebx
+     53a:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+     53d:	50                   	push   %eax
+     53e:	e8 fd 01 00 00       	call   740 <strlen>
+  printf(1, "%s", s);
+     543:	83 c4 0c             	add    $0xc,%esp
+     546:	57                   	push   %edi
+  n = strlen(s);
+     547:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+     549:	68 04 11 00 00       	push   $0x1104
+     54e:	6a 01                	push   $0x1
+     550:	e8 ab 05 00 00       	call   b00 <printf>
+  for(; n < w; n++)
+     555:	83 c4 10             	add    $0x10,%esp
+     558:	39 f3                	cmp    %esi,%ebx
+     55a:	7d 1d                	jge    579 <col+0x49>
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     560:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     563:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     566:	68 07 11 00 00       	push   $0x1107
+     56b:	6a 01                	push   $0x1
+     56d:	e8 8e 05 00 00       	call   b00 <printf>
+  for(; n < w; n++)
+     572:	83 c4 10             	add    $0x10,%esp
+     575:	39 de                	cmp    %ebx,%esi
+     577:	75 e7                	jne    560 <col+0x30>
+}
+     579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     57c:	5b                   	pop    %ebx
+     57d:	5e                   	pop    %esi
+     57e:	5f                   	pop    %edi
+     57f:	5d                   	pop    %ebp
+     580:	c3                   	ret
+     581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <counts>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	89 c3                	mov    %eax,%ebx
+     598:	83 ec 14             	sub    $0x14,%esp
+  if((n = cpustat(cs, NCPU)) < 0){
+     59b:	6a 20                	push   $0x20
+     59d:	68 a0 19 00 00       	push   $0x19a0
+     5a2:	e8 a4 04 00 00       	call   a4b <cpustat>
+     5a7:	83 c4 10             	add    $0x10,%esp
+     5aa:	85 c0                	test   %eax,%eax
+     5ac:	78 46                	js     5f4 <counts+0x64>
+     5ae:	8d 4b 10             	lea    0x10(%ebx),%ecx
+     5b1:	89 c3                	mov    %eax,%ebx
+     5b3:	be b0 19 00 00       	mov    $0x19b0,%esi
+     5b8:	89 c7                	mov    %eax,%edi
+     5ba:	c1 e3 05             	shl    $0x5,%ebx
+     5bd:	01 f3                	add    %esi,%ebx
+    c[j] = 0;
+     5bf:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    for(i = 0; i < n; i++)
+     5c5:	89 f0                	mov    %esi,%eax
+     5c7:	31 d2                	xor    %edx,%edx
+     5c9:	85 ff                	test   %edi,%edi
+     5cb:	74 0e                	je     5db <counts+0x4b>
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+      c[j] += cs[i].stat[j];
+     5d0:	03 10                	add    (%eax),%edx
+    for(i = 0; i < n; i++)
+     5d2:	83 c0 20             	add    $0x20,%eax
+      c[j] += cs[i].stat[j];
+     5d5:	89 11                	mov    %edx,(%ecx)
+    for(i = 0; i < n; i++)
+     5d7:	39 d8                	cmp    %ebx,%eax
+     5d9:	75 f5                	jne    5d0 <counts+0x40>
+  for(j = CS_BHIT; j <= CS_BPROMOTE; j++){
+     5db:	83 c6 04             	add    $0x4,%esi
+     5de:	83 c1 04             	add    $0x4,%ecx
+     5e1:	83 c3 04             	add    $0x4,%ebx
+     5e4:	81 fe c0 19 00 00    	cmp    $0x19c0,%esi
+     5ea:	75 d3                	jne    5bf <counts+0x2f>
+}
+     5ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5ef:	5b                   	pop    %ebx
+     5f0:	5e                   	pop    %esi
+     5f1:	5f                   	pop    %edi
+     5f2:	5d                   	pop    %ebp
+     5f3:	c3                   	ret
+    printf(2, "bcachebench: cpustat failed\n");
+     5f4:	50                   	push   %eax
+     5f5:	50                   	push   %eax
+     5f6:	68 09 11 00 00       	push   $0x1109
+     5fb:	6a 02                	push   $0x2
+     5fd:	e8 fe 04 00 00       	call   b00 <printf>
+    exit();
+     602:	e8 ec 02 00 00       	call   8f3 <exit>
+     607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60e:	66 90                	xchg   %ax,%ax
+
+00000610 <coln>:
+{
+     610:	55                   	push   %ebp
+     611:	89 c1                	mov    %eax,%ecx
+     613:	89 e5                	mov    %esp,%ebp
+     615:	57                   	push   %edi
+     616:	56                   	push   %esi
+    nbuf[--i] = '0' + x % 10;
+     617:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+     61c:	53                   	push   %ebx
+  i = sizeof(nbuf) - 1;
+     61d:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+     622:	83 ec 2c             	sub    $0x2c,%esp
+  nbuf[i] = 0;
+     625:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    nbuf[--i] = '0' + x % 10;
+     629:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     630:	89 c8                	mov    %ecx,%eax
+     632:	83 eb 01             	sub    $0x1,%ebx
+     635:	f7 e6                	mul    %esi
+     637:	89 c8                	mov    %ecx,%eax
+     639:	c1 ea 03             	shr    $0x3,%edx
+     63c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     63f:	01 ff                	add    %edi,%edi
+     641:	29 f8                	sub    %edi,%eax
+     643:	83 c0 30             	add    $0x30,%eax
+     646:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+     64a:	89 c8                	mov    %ecx,%eax
+     64c:	89 d1                	mov    %edx,%ecx
+     64e:	83 f8 09             	cmp    $0x9,%eax
+     651:	77 dd                	ja     630 <coln+0x20>
+  col(nbuf+i, w);
+     653:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+     656:	83 ec 0c             	sub    $0xc,%esp
+  col(nbuf+i, w);
+     659:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     65c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+     65f:	56                   	push   %esi
+     660:	e8 db 00 00 00       	call   740 <strlen>
+  printf(1, "%s", s);
+     665:	83 c4 0c             	add    $0xc,%esp
+     668:	56                   	push   %esi
+  n = strlen(s);
+     669:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+     66b:	68 04 11 00 00       	push   $0x1104
+     670:	6a 01                	push   $0x1
+     672:	e8 89 04 00 00       	call   b00 <printf>
+  for(; n < w; n++)
+     677:	83 c4 10             	add    $0x10,%esp
+     67a:	39 df                	cmp    %ebx,%edi
+     67c:	7e 1b                	jle    699 <coln+0x89>
+     67e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     680:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     683:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     686:	68 07 11 00 00       	push   $0x1107
+     68b:	6a 01                	push   $0x1
+     68d:	e8 6e 04 00 00       	call   b00 <printf>
+  for(; n < w; n++)
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	39 df                	cmp    %ebx,%edi
+     697:	75 e7                	jne    680 <coln+0x70>
+}
+     699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     69c:	5b                   	pop    %ebx
+     69d:	5e                   	pop    %esi
+     69e:	5f                   	pop    %edi
+     69f:	5d                   	pop    %ebp
+     6a0:	c3                   	ret
+     6a1:	66 90                	xchg   %ax,%ax
+     6a3:	66 90                	xchg   %ax,%ax
+     6a5:	66 90                	xchg   %ax,%ax
+     6a7:	66 90                	xchg   %ax,%ax
+     6a9:	66 90                	xchg   %ax,%ax
+     6ab:	66 90                	xchg   %ax,%ax
+     6ad:	66 90                	xchg   %ax,%ax
+     6af:	90                   	nop
+
+000006b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     6b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     6b1:	31 c0                	xor    %eax,%eax
+{
+     6b3:	89 e5                	mov    %esp,%ebp
+     6b5:	53                   	push   %ebx
+     6b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     6c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     6c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     6c7:	83 c0 01             	add    $0x1,%eax
+     6ca:	84 d2                	test   %dl,%dl
+     6cc:	75 f2                	jne    6c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     6ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d1:	89 c8                	mov    %ecx,%eax
+     6d3:	c9                   	leave
+     6d4:	c3                   	ret
+     6d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	53                   	push   %ebx
+     6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6ea:	0f b6 02             	movzbl (%edx),%eax
+     6ed:	84 c0                	test   %al,%al
+     6ef:	75 17                	jne    708 <strcmp+0x28>
+     6f1:	eb 3a                	jmp    72d <strcmp+0x4d>
+     6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6f7:	90                   	nop
+     6f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     6fc:	83 c2 01             	add    $0x1,%edx
+     6ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     702:	84 c0                	test   %al,%al
+     704:	74 1a                	je     720 <strcmp+0x40>
+    p++, q++;
+     706:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     708:	0f b6 19             	movzbl (%ecx),%ebx
+     70b:	38 c3                	cmp    %al,%bl
+     70d:	74 e9                	je     6f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     70f:	29 d8                	sub    %ebx,%eax
+}
+     711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     714:	c9                   	leave
+     715:	c3                   	ret
+     716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     720:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     724:	31 c0                	xor    %eax,%eax
+     726:	29 d8                	sub    %ebx,%eax
+}
+     728:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     72b:	c9                   	leave
+     72c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     72d:	0f b6 19             	movzbl (%ecx),%ebx
+     730:	31 c0                	xor    %eax,%eax
+     732:	eb db                	jmp    70f <strcmp+0x2f>
+     734:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+
+00000740 <strlen>:
+
+uint
+strlen(char *s)
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     746:	80 3a 00             	cmpb   $0x0,(%edx)
+     749:	74 15                	je     760 <strlen+0x20>
+     74b:	31 c0                	xor    %eax,%eax
+     74d:	8d 76 00             	lea    0x0(%esi),%esi
+     750:	83 c0 01             	add    $0x1,%eax
+     753:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     757:	89 c1                	mov    %eax,%ecx
+     759:	75 f5                	jne    750 <strlen+0x10>
+    ;
+  return n;
+}
+     75b:	89 c8                	mov    %ecx,%eax
+     75d:	5d                   	pop    %ebp
+     75e:	c3                   	ret
+     75f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     760:	31 c9                	xor    %ecx,%ecx
+}
+     762:	5d                   	pop    %ebp
+     763:	89 c8                	mov    %ecx,%eax
+     765:	c3                   	ret
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     777:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     77a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77d:	89 d7                	mov    %edx,%edi
+     77f:	fc                   	cld
+     780:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     782:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     785:	89 d0                	mov    %edx,%eax
+     787:	c9                   	leave
+     788:	c3                   	ret
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	8b 45 08             	mov    0x8(%ebp),%eax
+     796:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     79a:	0f b6 10             	movzbl (%eax),%edx
+     79d:	84 d2                	test   %dl,%dl
+     79f:	75 12                	jne    7b3 <strchr+0x23>
+     7a1:	eb 1d                	jmp    7c0 <strchr+0x30>
+     7a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7a7:	90                   	nop
+     7a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7ac:	83 c0 01             	add    $0x1,%eax
+     7af:	84 d2                	test   %dl,%dl
+     7b1:	74 0d                	je     7c0 <strchr+0x30>
+    if(*s == c)
+     7b3:	38 d1                	cmp    %dl,%cl
+     7b5:	75 f1                	jne    7a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     7b7:	5d                   	pop    %ebp
+     7b8:	c3                   	ret
+     7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     7c0:	31 c0                	xor    %eax,%eax
+}
+     7c2:	5d                   	pop    %ebp
+     7c3:	c3                   	ret
+     7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+
+000007d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     7d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     7d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     7d9:	31 db                	xor    %ebx,%ebx
+{
+     7db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     7de:	eb 27                	jmp    807 <gets+0x37>
+    cc = read(0, &c, 1);
+     7e0:	83 ec 04             	sub    $0x4,%esp
+     7e3:	6a 01                	push   $0x1
+     7e5:	56                   	push   %esi
+     7e6:	6a 00                	push   $0x0
+     7e8:	e8 1e 01 00 00       	call   90b <read>
+    if(cc < 1)
+     7ed:	83 c4 10             	add    $0x10,%esp
+     7f0:	85 c0                	test   %eax,%eax
+     7f2:	7e 1d                	jle    811 <gets+0x41>
+      break;
+    buf[i++] = c;
+     7f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7ff:	3c 0a                	cmp    $0xa,%al
+     801:	74 10                	je     813 <gets+0x43>
+     803:	3c 0d                	cmp    $0xd,%al
+     805:	74 0c                	je     813 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     807:	89 df                	mov    %ebx,%edi
+     809:	83 c3 01             	add    $0x1,%ebx
+     80c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     80f:	7c cf                	jl     7e0 <gets+0x10>
+     811:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     813:	8b 45 08             	mov    0x8(%ebp),%eax
+     816:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     81a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     81d:	5b                   	pop    %ebx
+     81e:	5e                   	pop    %esi
+     81f:	5f                   	pop    %edi
+     820:	5d                   	pop    %ebp
+     821:	c3                   	ret
+     822:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	56                   	push   %esi
+     834:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     835:	83 ec 08             	sub    $0x8,%esp
+     838:	6a 00                	push   $0x0
+     83a:	ff 75 08             	push   0x8(%ebp)
+     83d:	e8 f1 00 00 00       	call   933 <open>
+  if(fd < 0)
+     842:	83 c4 10             	add    $0x10,%esp
+     845:	85 c0                	test   %eax,%eax
+     847:	78 27                	js     870 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     849:	83 ec 08             	sub    $0x8,%esp
+     84c:	ff 75 0c             	push   0xc(%ebp)
+     84f:	89 c3                	mov    %eax,%ebx
+     851:	50                   	push   %eax
+     852:	e8 f4 00 00 00       	call   94b <fstat>
+  close(fd);
+     857:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     85a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     85c:	e8 ba 00 00 00       	call   91b <close>
+  return r;
+     861:	83 c4 10             	add    $0x10,%esp
+}
+     864:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     867:	89 f0                	mov    %esi,%eax
+     869:	5b                   	pop    %ebx
+     86a:	5e                   	pop    %esi
+     86b:	5d                   	pop    %ebp
+     86c:	c3                   	ret
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     870:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     875:	eb ed                	jmp    864 <stat+0x34>
+     877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87e:	66 90                	xchg   %ax,%ax
+
+00000880 <atoi>:
+
+int
+atoi(const char *s)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	53                   	push   %ebx
+     884:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     887:	0f be 02             	movsbl (%edx),%eax
+     88a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     88d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     890:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     895:	77 1e                	ja     8b5 <atoi+0x35>
+     897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8a0:	83 c2 01             	add    $0x1,%edx
+     8a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8aa:	0f be 02             	movsbl (%edx),%eax
+     8ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8b0:	80 fb 09             	cmp    $0x9,%bl
+     8b3:	76 eb                	jbe    8a0 <atoi+0x20>
+  return n;
+}
+     8b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8b8:	89 c8                	mov    %ecx,%eax
+     8ba:	c9                   	leave
+     8bb:	c3                   	ret
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     8ce:	85 c0                	test   %eax,%eax
+     8d0:	7e 13                	jle    8e5 <memmove+0x25>
+     8d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     8d4:	89 d7                	mov    %edx,%edi
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     8e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     8e1:	39 f8                	cmp    %edi,%eax
+     8e3:	75 fb                	jne    8e0 <memmove+0x20>
+  return vdst;
+}
+     8e5:	5e                   	pop    %esi
+     8e6:	89 d0                	mov    %edx,%eax
+     8e8:	5f                   	pop    %edi
+     8e9:	5d                   	pop    %ebp
+     8ea:	c3                   	ret
+
+000008eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     8eb:	b8 01 00 00 00       	mov    $0x1,%eax
+     8f0:	cd 40                	int    $0x40
+     8f2:	c3                   	ret
+
+000008f3 <exit>:
+SYSCALL(exit)
+     8f3:	b8 02 00 00 00       	mov    $0x2,%eax
+     8f8:	cd 40                	int    $0x40
+     8fa:	c3                   	ret
+
+000008fb <wait>:
+SYSCALL(wait)
+     8fb:	b8 03 00 00 00       	mov    $0x3,%eax
+     900:	cd 40                	int    $0x40
+     902:	c3                   	ret
+
+00000903 <pipe>:
+SYSCALL(pipe)
+     903:	b8 04 00 00 00       	mov    $0x4,%eax
+     908:	cd 40                	int    $0x40
+     90a:	c3                   	ret
+
+0000090b <read>:
+SYSCALL(read)
+     90b:	b8 05 00 00 00       	mov    $0x5,%eax
+     910:	cd 40                	int    $0x40
+     912:	c3                   	ret
+
+00000913 <write>:
+SYSCALL(write)
+     913:	b8 10 00 00 00       	mov    $0x10,%eax
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+
+0000091b <close>:
+SYSCALL(close)
+     91b:	b8 15 00 00 00       	mov    $0x15,%eax
+     920:	cd 40                	int    $0x40
+     922:	c3                   	ret
+
+00000923 <kill>:
+SYSCALL(kill)
+     923:	b8 06 00 00 00       	mov    $0x6,%eax
+     928:	cd 40                	int    $0x40
+     92a:	c3                   	ret
+
+0000092b <exec>:
+SYSCALL(exec)
+     92b:	b8 07 00 00 00       	mov    $0x7,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <open>:
+SYSCALL(open)
+     933:	b8 0f 00 00 00       	mov    $0xf,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <mknod>:
+SYSCALL(mknod)
+     93b:	b8 11 00 00 00       	mov    $0x11,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <unlink>:
+SYSCALL(unlink)
+     943:	b8 12 00 00 00       	mov    $0x12,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <fstat>:
+SYSCALL(fstat)
+     94b:	b8 08 00 00 00       	mov    $0x8,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <link>:
+SYSCALL(link)
+     953:	b8 13 00 00 00       	mov    $0x13,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <mkdir>:
+SYSCALL(mkdir)
+     95b:	b8 14 00 00 00       	mov    $0x14,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <chdir>:
+SYSCALL(chdir)
+     963:	b8 09 00 00 00       	mov    $0x9,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <dup>:
+SYSCALL(dup)
+     96b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <getpid>:
+SYSCALL(getpid)
+     973:	b8 0b 00 00 00       	mov    $0xb,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <sbrk>:
+SYSCALL(sbrk)
+     97b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <sleep>:
+SYSCALL(sleep)
+     983:	b8 0d 00 00 00       	mov    $0xd,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <uptime>:
+SYSCALL(uptime)
+     98b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     990:	cd 40                	int    $0x40
+     992:	c3                   	ret
+
+00000993 <add_dir>:
+SYSCALL(add_dir)
+     993:	b8 16 00 00 00       	mov    $0x16,%eax
+     998:	cd 40                	int    $0x40
+     99a:	c3                   	ret
+
+0000099b <history>:
+SYSCALL(history)
+     99b:	b8 18 00 00 00       	mov    $0x18,%eax
+     9a0:	cd 40                	int    $0x40
+     9a2:	c3                   	ret
+
+000009a3 <clock_gettime>:
+SYSCALL(clock_gettime)
+     9a3:	b8 19 00 00 00       	mov    $0x19,%eax
+     9a8:	cd 40                	int    $0x40
+     9aa:	c3                   	ret
+
+000009ab <nanosleep>:
+SYSCALL(nanosleep)
+     9ab:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9b0:	cd 40                	int    $0x40
+     9b2:	c3                   	ret
+
+000009b3 <clone>:
+SYSCALL(clone)
+     9b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9b8:	cd 40                	int    $0x40
+     9ba:	c3                   	ret
+
+000009bb <join>:
+SYSCALL(join)
+     9bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9c0:	cd 40                	int    $0x40
+     9c2:	c3                   	ret
+
+000009c3 <futex_wait>:
+SYSCALL(futex_wait)
+     9c3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9c8:	cd 40                	int    $0x40
+     9ca:	c3                   	ret
+
+000009cb <futex_wake>:
+SYSCALL(futex_wake)
+     9cb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     9d3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     9db:	b8 20 00 00 00       	mov    $0x20,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <sched_isolate>:
+SYSCALL(sched_isolate)
+     9e3:	b8 21 00 00 00       	mov    $0x21,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <getprocinfo>:
+SYSCALL(getprocinfo)
+     9eb:	b8 22 00 00 00       	mov    $0x22,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <waitpid>:
+SYSCALL(waitpid)
+     9f3:	b8 23 00 00 00       	mov    $0x23,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <tracectl>:
+SYSCALL(tracectl)
+     9fb:	b8 24 00 00 00       	mov    $0x24,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <traceread>:
+SYSCALL(traceread)
+     a03:	b8 25 00 00 00       	mov    $0x25,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+     a0b:	b8 26 00 00 00       	mov    $0x26,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+     a13:	b8 27 00 00 00       	mov    $0x27,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+     a1b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <irqroute>:
+SYSCALL(irqroute)
+     a23:	b8 29 00 00 00       	mov    $0x29,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <irqstat>:
+SYSCALL(irqstat)
+     a2b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <boottimes>:
+SYSCALL(boottimes)
+     a33:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <lockbench>:
+SYSCALL(lockbench)
+     a3b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <lockstat>:
+SYSCALL(lockstat)
+     a43:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <cpustat>:
+SYSCALL(cpustat)
+     a4b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <bcachesize>:
+SYSCALL(bcachesize)
+     a53:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+     a5b:	66 90                	xchg   %ax,%ax
+     a5d:	66 90                	xchg   %ax,%ax
+     a5f:	90                   	nop
+
+00000a60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	57                   	push   %edi
+     a64:	56                   	push   %esi
+     a65:	53                   	push   %ebx
+     a66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     a68:	89 d1                	mov    %edx,%ecx
+{
+     a6a:	83 ec 3c             	sub    $0x3c,%esp
+     a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     a70:	85 d2                	test   %edx,%edx
+     a72:	0f 89 80 00 00 00    	jns    af8 <printint+0x98>
+     a78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     a7c:	74 7a                	je     af8 <printint+0x98>
+    x = -xx;
+     a7e:	f7 d9                	neg    %ecx
+    neg = 1;
+     a80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     a85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     a88:	31 f6                	xor    %esi,%esi
+     a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     a90:	89 c8                	mov    %ecx,%eax
+     a92:	31 d2                	xor    %edx,%edx
+     a94:	89 f7                	mov    %esi,%edi
+     a96:	f7 f3                	div    %ebx
+     a98:	8d 76 01             	lea    0x1(%esi),%esi
+     a9b:	0f b6 92 6c 12 00 00 	movzbl 0x126c(%edx),%edx
+     aa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     aa6:	89 ca                	mov    %ecx,%edx
+     aa8:	89 c1                	mov    %eax,%ecx
+     aaa:	39 da                	cmp    %ebx,%edx
+     aac:	73 e2                	jae    a90 <printint+0x30>
+  if(neg)
+     aae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ab1:	85 c0                	test   %eax,%eax
+     ab3:	74 07                	je     abc <printint+0x5c>
+    buf[i++] = '-';
+     ab5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     aba:	89 f7                	mov    %esi,%edi
+     abc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     abf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     ac2:	01 df                	add    %ebx,%edi
+     ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     ac8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     acb:	83 ec 04             	sub    $0x4,%esp
+     ace:	88 45 d7             	mov    %al,-0x29(%ebp)
+     ad1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     ad4:	6a 01                	push   $0x1
+     ad6:	50                   	push   %eax
+     ad7:	56                   	push   %esi
+     ad8:	e8 36 fe ff ff       	call   913 <write>
+  while(--i >= 0)
+     add:	89 f8                	mov    %edi,%eax
+     adf:	83 c4 10             	add    $0x10,%esp
+     ae2:	83 ef 01             	sub    $0x1,%edi
+     ae5:	39 d8                	cmp    %ebx,%eax
+     ae7:	75 df                	jne    ac8 <printint+0x68>
+}
+     ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aec:	5b                   	pop    %ebx
+     aed:	5e                   	pop    %esi
+     aee:	5f                   	pop    %edi
+     aef:	5d                   	pop    %ebp
+     af0:	c3                   	ret
+     af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     af8:	31 c0                	xor    %eax,%eax
+     afa:	eb 89                	jmp    a85 <printint+0x25>
+     afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	57                   	push   %edi
+     b04:	56                   	push   %esi
+     b05:	53                   	push   %ebx
+     b06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     b0f:	0f b6 1e             	movzbl (%esi),%ebx
+     b12:	83 c6 01             	add    $0x1,%esi
+     b15:	84 db                	test   %bl,%bl
+     b17:	74 67                	je     b80 <printf+0x80>
+     b19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b1c:	31 d2                	xor    %edx,%edx
+     b1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     b21:	eb 34                	jmp    b57 <printf+0x57>
+     b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b27:	90                   	nop
+     b28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     b2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     b30:	83 f8 25             	cmp    $0x25,%eax
+     b33:	74 18                	je     b4d <printf+0x4d>
+  write(fd, &c, 1);
+     b35:	83 ec 04             	sub    $0x4,%esp
+     b38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     b3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     b3e:	6a 01                	push   $0x1
+     b40:	50                   	push   %eax
+     b41:	57                   	push   %edi
+     b42:	e8 cc fd ff ff       	call   913 <write>
+     b47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     b4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     b4d:	0f b6 1e             	movzbl (%esi),%ebx
+     b50:	83 c6 01             	add    $0x1,%esi
+     b53:	84 db                	test   %bl,%bl
+     b55:	74 29                	je     b80 <printf+0x80>
+    c = fmt[i] & 0xff;
+     b57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     b5a:	85 d2                	test   %edx,%edx
+     b5c:	74 ca                	je     b28 <printf+0x28>
+      }
+    } else if(state == '%'){
+     b5e:	83 fa 25             	cmp    $0x25,%edx
+     b61:	75 ea                	jne    b4d <printf+0x4d>
+      if(c == 'd'){
+     b63:	83 f8 25             	cmp    $0x25,%eax
+     b66:	0f 84 24 01 00 00    	je     c90 <printf+0x190>
+     b6c:	83 e8 63             	sub    $0x63,%eax
+     b6f:	83 f8 15             	cmp    $0x15,%eax
+     b72:	77 1c                	ja     b90 <printf+0x90>
+     b74:	ff 24 85 14 12 00 00 	jmp    *0x1214(,%eax,4)
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b83:	5b                   	pop    %ebx
+     b84:	5e                   	pop    %esi
+     b85:	5f                   	pop    %edi
+     b86:	5d                   	pop    %ebp
+     b87:	c3                   	ret
+     b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+  write(fd, &c, 1);
+     b90:	83 ec 04             	sub    $0x4,%esp
+     b93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     b96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     b9a:	6a 01                	push   $0x1
+     b9c:	52                   	push   %edx
+     b9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     ba0:	57                   	push   %edi
+     ba1:	e8 6d fd ff ff       	call   913 <write>
+     ba6:	83 c4 0c             	add    $0xc,%esp
+     ba9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     bac:	6a 01                	push   $0x1
+     bae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     bb1:	52                   	push   %edx
+     bb2:	57                   	push   %edi
+     bb3:	e8 5b fd ff ff       	call   913 <write>
+        putc(fd, c);
+     bb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     bbb:	31 d2                	xor    %edx,%edx
+     bbd:	eb 8e                	jmp    b4d <printf+0x4d>
+     bbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     bc3:	83 ec 0c             	sub    $0xc,%esp
+     bc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     bcb:	8b 13                	mov    (%ebx),%edx
+     bcd:	6a 00                	push   $0x0
+     bcf:	89 f8                	mov    %edi,%eax
+        ap++;
+     bd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     bd4:	e8 87 fe ff ff       	call   a60 <printint>
+        ap++;
+     bd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     bdc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     bdf:	31 d2                	xor    %edx,%edx
+     be1:	e9 67 ff ff ff       	jmp    b4d <printf+0x4d>
+     be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     bf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     bf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     bf5:	83 c0 04             	add    $0x4,%eax
+     bf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     bfb:	85 db                	test   %ebx,%ebx
+     bfd:	0f 84 9d 00 00 00    	je     ca0 <printf+0x1a0>
+        while(*s != 0){
+     c03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     c06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     c08:	84 c0                	test   %al,%al
+     c0a:	0f 84 3d ff ff ff    	je     b4d <printf+0x4d>
+     c10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     c16:	89 de                	mov    %ebx,%esi
+     c18:	89 d3                	mov    %edx,%ebx
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     c26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     c29:	6a 01                	push   $0x1
+     c2b:	53                   	push   %ebx
+     c2c:	57                   	push   %edi
+     c2d:	e8 e1 fc ff ff       	call   913 <write>
+        while(*s != 0){
+     c32:	0f b6 06             	movzbl (%esi),%eax
+     c35:	83 c4 10             	add    $0x10,%esp
+     c38:	84 c0                	test   %al,%al
+     c3a:	75 e4                	jne    c20 <printf+0x120>
+      state = 0;
+     c3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     c3f:	31 d2                	xor    %edx,%edx
+     c41:	e9 07 ff ff ff       	jmp    b4d <printf+0x4d>
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     c50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c5b:	8b 13                	mov    (%ebx),%edx
+     c5d:	6a 01                	push   $0x1
+     c5f:	e9 6b ff ff ff       	jmp    bcf <printf+0xcf>
+     c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     c68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     c6b:	83 ec 04             	sub    $0x4,%esp
+     c6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     c71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     c73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     c76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     c79:	6a 01                	push   $0x1
+     c7b:	52                   	push   %edx
+     c7c:	57                   	push   %edi
+     c7d:	e8 91 fc ff ff       	call   913 <write>
+        ap++;
+     c82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     c85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c88:	31 d2                	xor    %edx,%edx
+     c8a:	e9 be fe ff ff       	jmp    b4d <printf+0x4d>
+     c8f:	90                   	nop
+  write(fd, &c, 1);
+     c90:	83 ec 04             	sub    $0x4,%esp
+     c93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     c96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c99:	6a 01                	push   $0x1
+     c9b:	e9 11 ff ff ff       	jmp    bb1 <printf+0xb1>
+     ca0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     ca5:	bb 0b 12 00 00       	mov    $0x120b,%ebx
+     caa:	e9 61 ff ff ff       	jmp    c10 <printf+0x110>
+     caf:	90                   	nop
+
+00000cb0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+     cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     cb1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     cb4:	89 e5                	mov    %esp,%ebp
+     cb6:	57                   	push   %edi
+     cb7:	56                   	push   %esi
+     cb8:	53                   	push   %ebx
+     cb9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cbb:	a1 a4 1d 00 00       	mov    0x1da4,%eax
+     cc0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cc2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cc4:	39 ca                	cmp    %ecx,%edx
+     cc6:	73 30                	jae    cf8 <ufree+0x48>
+     cc8:	39 c1                	cmp    %eax,%ecx
+     cca:	72 04                	jb     cd0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ccc:	39 c2                	cmp    %eax,%edx
+     cce:	72 f0                	jb     cc0 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     cd0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     cd3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     cd6:	39 f8                	cmp    %edi,%eax
+     cd8:	74 26                	je     d00 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     cda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     cdd:	8b 42 04             	mov    0x4(%edx),%eax
+     ce0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ce3:	39 f1                	cmp    %esi,%ecx
+     ce5:	74 30                	je     d17 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ce7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ce9:	5b                   	pop    %ebx
+  freep = p;
+     cea:	89 15 a4 1d 00 00    	mov    %edx,0x1da4
+}
+     cf0:	5e                   	pop    %esi
+     cf1:	5f                   	pop    %edi
+     cf2:	5d                   	pop    %ebp
+     cf3:	c3                   	ret
+     cf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cf8:	39 c1                	cmp    %eax,%ecx
+     cfa:	72 d0                	jb     ccc <ufree+0x1c>
+     cfc:	eb c2                	jmp    cc0 <ufree+0x10>
+     cfe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     d00:	03 70 04             	add    0x4(%eax),%esi
+     d03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d06:	8b 02                	mov    (%edx),%eax
+     d08:	8b 00                	mov    (%eax),%eax
+     d0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     d0d:	8b 42 04             	mov    0x4(%edx),%eax
+     d10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     d13:	39 f1                	cmp    %esi,%ecx
+     d15:	75 d0                	jne    ce7 <ufree+0x37>
+    p->s.size += bp->s.size;
+     d17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     d1a:	89 15 a4 1d 00 00    	mov    %edx,0x1da4
+    p->s.size += bp->s.size;
+     d20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     d23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     d26:	89 0a                	mov    %ecx,(%edx)
+}
+     d28:	5b                   	pop    %ebx
+     d29:	5e                   	pop    %esi
+     d2a:	5f                   	pop    %edi
+     d2b:	5d                   	pop    %ebp
+     d2c:	c3                   	ret
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d30 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	53                   	push   %ebx
+     d34:	83 ec 10             	sub    $0x10,%esp
+     d37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+     d3a:	68 a0 1d 00 00       	push   $0x1da0
+     d3f:	e8 ec 01 00 00       	call   f30 <lock_acquire>
+  ufree(ap);
+     d44:	89 d8                	mov    %ebx,%eax
+     d46:	e8 65 ff ff ff       	call   cb0 <ufree>
+  lock_release(&mlock);
+     d4b:	c7 45 08 a0 1d 00 00 	movl   $0x1da0,0x8(%ebp)
+}
+     d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+     d55:	83 c4 10             	add    $0x10,%esp
+}
+     d58:	c9                   	leave
+  lock_release(&mlock);
+     d59:	e9 f2 01 00 00       	jmp    f50 <lock_release>
+     d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+     d65:	53                   	push   %ebx
+     d66:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     d69:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+     d6c:	68 a0 1d 00 00       	push   $0x1da0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     d71:	8d 48 07             	lea    0x7(%eax),%ecx
+     d74:	c1 e9 03             	shr    $0x3,%ecx
+     d77:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+     d7a:	e8 b1 01 00 00       	call   f30 <lock_acquire>
+  if((prevp = freep) == 0){
+     d7f:	8b 15 a4 1d 00 00    	mov    0x1da4,%edx
+     d85:	83 c4 10             	add    $0x10,%esp
+     d88:	85 d2                	test   %edx,%edx
+     d8a:	0f 84 b0 00 00 00    	je     e40 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     d90:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     d92:	8b 47 04             	mov    0x4(%edi),%eax
+     d95:	39 f0                	cmp    %esi,%eax
+     d97:	73 6f                	jae    e08 <malloc+0xa8>
+  if(nu < 4096)
+     d99:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     d9e:	39 de                	cmp    %ebx,%esi
+     da0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     da3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     daa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     dad:	eb 0a                	jmp    db9 <malloc+0x59>
+     daf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     db0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     db2:	8b 47 04             	mov    0x4(%edi),%eax
+     db5:	39 f0                	cmp    %esi,%eax
+     db7:	73 4f                	jae    e08 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     db9:	89 fa                	mov    %edi,%edx
+     dbb:	39 3d a4 1d 00 00    	cmp    %edi,0x1da4
+     dc1:	75 ed                	jne    db0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     dc3:	83 ec 0c             	sub    $0xc,%esp
+     dc6:	ff 75 e4             	push   -0x1c(%ebp)
+     dc9:	e8 ad fb ff ff       	call   97b <sbrk>
+  if(p == (char*)-1)
+     dce:	83 c4 10             	add    $0x10,%esp
+     dd1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dd4:	74 15                	je     deb <malloc+0x8b>
+  hp->s.size = nu;
+     dd6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+     dd9:	83 c0 08             	add    $0x8,%eax
+     ddc:	e8 cf fe ff ff       	call   cb0 <ufree>
+  return freep;
+     de1:	8b 15 a4 1d 00 00    	mov    0x1da4,%edx
+      if((p = morecore(nunits)) == 0){
+     de7:	85 d2                	test   %edx,%edx
+     de9:	75 c5                	jne    db0 <malloc+0x50>
+        lock_release(&mlock);
+     deb:	83 ec 0c             	sub    $0xc,%esp
+     dee:	68 a0 1d 00 00       	push   $0x1da0
+     df3:	e8 58 01 00 00       	call   f50 <lock_release>
+        return 0;
+     df8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     dfe:	31 c0                	xor    %eax,%eax
+}
+     e00:	5b                   	pop    %ebx
+     e01:	5e                   	pop    %esi
+     e02:	5f                   	pop    %edi
+     e03:	5d                   	pop    %ebp
+     e04:	c3                   	ret
+     e05:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     e08:	39 c6                	cmp    %eax,%esi
+     e0a:	74 64                	je     e70 <malloc+0x110>
+        p->s.size -= nunits;
+     e0c:	29 f0                	sub    %esi,%eax
+     e0e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     e11:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     e14:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+     e17:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     e1a:	89 15 a4 1d 00 00    	mov    %edx,0x1da4
+      lock_release(&mlock);
+     e20:	68 a0 1d 00 00       	push   $0x1da0
+     e25:	e8 26 01 00 00       	call   f50 <lock_release>
+      return (void*)(p + 1);
+     e2a:	83 c4 10             	add    $0x10,%esp
+}
+     e2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     e30:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     e33:	5b                   	pop    %ebx
+     e34:	5e                   	pop    %esi
+     e35:	5f                   	pop    %edi
+     e36:	5d                   	pop    %ebp
+     e37:	c3                   	ret
+     e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     e40:	c7 05 a4 1d 00 00 a8 	movl   $0x1da8,0x1da4
+     e47:	1d 00 00 
+    base.s.size = 0;
+     e4a:	bf a8 1d 00 00       	mov    $0x1da8,%edi
+    base.s.ptr = freep = prevp = &base;
+     e4f:	c7 05 a8 1d 00 00 a8 	movl   $0x1da8,0x1da8
+     e56:	1d 00 00 
+    base.s.size = 0;
+     e59:	c7 05 ac 1d 00 00 00 	movl   $0x0,0x1dac
+     e60:	00 00 00 
+    if(p->s.size >= nunits){
+     e63:	e9 31 ff ff ff       	jmp    d99 <malloc+0x39>
+     e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     e70:	8b 07                	mov    (%edi),%eax
+     e72:	89 02                	mov    %eax,(%edx)
+     e74:	eb a1                	jmp    e17 <malloc+0xb7>
+     e76:	66 90                	xchg   %ax,%ax
+     e78:	66 90                	xchg   %ax,%ax
+     e7a:	66 90                	xchg   %ax,%ax
+     e7c:	66 90                	xchg   %ax,%ax
+     e7e:	66 90                	xchg   %ax,%ax
+
+00000e80 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	53                   	push   %ebx
+     e84:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+     e87:	68 00 10 00 00       	push   $0x1000
+     e8c:	e8 cf fe ff ff       	call   d60 <malloc>
+     e91:	83 c4 10             	add    $0x10,%esp
+     e94:	85 c0                	test   %eax,%eax
+     e96:	74 37                	je     ecf <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+     e98:	83 ec 04             	sub    $0x4,%esp
+     e9b:	89 c3                	mov    %eax,%ebx
+     e9d:	50                   	push   %eax
+     e9e:	ff 75 0c             	push   0xc(%ebp)
+     ea1:	ff 75 08             	push   0x8(%ebp)
+     ea4:	e8 0a fb ff ff       	call   9b3 <clone>
+     ea9:	83 c4 10             	add    $0x10,%esp
+     eac:	85 c0                	test   %eax,%eax
+     eae:	78 08                	js     eb8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+     eb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eb3:	c9                   	leave
+     eb4:	c3                   	ret
+     eb5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+     ebb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ebe:	53                   	push   %ebx
+     ebf:	e8 6c fe ff ff       	call   d30 <free>
+     ec4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     ec7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+     eca:	83 c4 10             	add    $0x10,%esp
+}
+     ecd:	c9                   	leave
+     ece:	c3                   	ret
+    return -1;
+     ecf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ed4:	eb da                	jmp    eb0 <thread_create+0x30>
+     ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ee0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+     ee6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     ee9:	50                   	push   %eax
+     eea:	e8 cc fa ff ff       	call   9bb <join>
+     eef:	83 c4 10             	add    $0x10,%esp
+     ef2:	85 c0                	test   %eax,%eax
+     ef4:	79 0a                	jns    f00 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+     ef6:	c9                   	leave
+     ef7:	c3                   	ret
+     ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+     f00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+     f03:	83 ec 0c             	sub    $0xc,%esp
+     f06:	ff 75 f4             	push   -0xc(%ebp)
+     f09:	e8 22 fe ff ff       	call   d30 <free>
+     f0e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f11:	83 c4 10             	add    $0x10,%esp
+}
+     f14:	c9                   	leave
+     f15:	c3                   	ret
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f20 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+     f23:	8b 45 08             	mov    0x8(%ebp),%eax
+     f26:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     f2c:	5d                   	pop    %ebp
+     f2d:	c3                   	ret
+     f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+     f30:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     f31:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f36:	89 e5                	mov    %esp,%ebp
+     f38:	8b 55 08             	mov    0x8(%ebp),%edx
+     f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+     f40:	89 c8                	mov    %ecx,%eax
+     f42:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+     f45:	85 c0                	test   %eax,%eax
+     f47:	75 f7                	jne    f40 <lock_acquire+0x10>
+    ;
+}
+     f49:	5d                   	pop    %ebp
+     f4a:	c3                   	ret
+     f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+
+00000f50 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+     f50:	55                   	push   %ebp
+     f51:	31 c0                	xor    %eax,%eax
+     f53:	89 e5                	mov    %esp,%ebp
+     f55:	8b 55 08             	mov    0x8(%ebp),%edx
+     f58:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f60 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     f63:	8b 45 08             	mov    0x8(%ebp),%eax
+     f66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     f6c:	5d                   	pop    %ebp
+     f6d:	c3                   	ret
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     f70:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     f71:	31 c0                	xor    %eax,%eax
+     f73:	ba 01 00 00 00       	mov    $0x1,%edx
+     f78:	89 e5                	mov    %esp,%ebp
+     f7a:	56                   	push   %esi
+     f7b:	53                   	push   %ebx
+     f7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f7f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+     f83:	85 c0                	test   %eax,%eax
+     f85:	74 30                	je     fb7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+     f87:	83 f8 02             	cmp    $0x2,%eax
+     f8a:	74 0c                	je     f98 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     f8c:	b8 02 00 00 00       	mov    $0x2,%eax
+     f91:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     f94:	85 c0                	test   %eax,%eax
+     f96:	74 1f                	je     fb7 <mutex_lock+0x47>
+     f98:	be 02 00 00 00       	mov    $0x2,%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+     fa0:	83 ec 08             	sub    $0x8,%esp
+     fa3:	6a 02                	push   $0x2
+     fa5:	53                   	push   %ebx
+     fa6:	e8 18 fa ff ff       	call   9c3 <futex_wait>
+     fab:	89 f0                	mov    %esi,%eax
+     fad:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     fb0:	83 c4 10             	add    $0x10,%esp
+     fb3:	85 c0                	test   %eax,%eax
+     fb5:	75 e9                	jne    fa0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     fb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fba:	5b                   	pop    %ebx
+     fbb:	5e                   	pop    %esi
+     fbc:	5d                   	pop    %ebp
+     fbd:	c3                   	ret
+     fbe:	66 90                	xchg   %ax,%ax
+
+00000fc0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	31 c0                	xor    %eax,%eax
+     fc3:	89 e5                	mov    %esp,%ebp
+     fc5:	83 ec 08             	sub    $0x8,%esp
+     fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+     fcb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+     fce:	83 f8 02             	cmp    $0x2,%eax
+     fd1:	74 05                	je     fd8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+     fd3:	c9                   	leave
+     fd4:	c3                   	ret
+     fd5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+     fd8:	83 ec 08             	sub    $0x8,%esp
+     fdb:	6a 01                	push   $0x1
+     fdd:	52                   	push   %edx
+     fde:	e8 e8 f9 ff ff       	call   9cb <futex_wake>
+     fe3:	83 c4 10             	add    $0x10,%esp
+}
+     fe6:	c9                   	leave
+     fe7:	c3                   	ret
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+
+00000ff0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+     ff6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+     ffc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    1003:	5d                   	pop    %ebp
+    1004:	c3                   	ret
+    1005:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+    1015:	53                   	push   %ebx
+    1016:	83 ec 0c             	sub    $0xc,%esp
+    1019:	8b 75 08             	mov    0x8(%ebp),%esi
+    101c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+    101f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+    1024:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+    1026:	8b 3e                	mov    (%esi),%edi
+    1028:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+    102b:	83 f8 02             	cmp    $0x2,%eax
+    102e:	74 60                	je     1090 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	e8 89 f9 ff ff       	call   9c3 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+    103a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+    103f:	31 c0                	xor    %eax,%eax
+    1041:	ba 01 00 00 00       	mov    $0x1,%edx
+    1046:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+    104a:	83 c4 10             	add    $0x10,%esp
+    104d:	85 c0                	test   %eax,%eax
+    104f:	74 36                	je     1087 <cond_wait+0x77>
+  if(c != 2)
+    1051:	83 f8 02             	cmp    $0x2,%eax
+    1054:	74 0c                	je     1062 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+    1056:	b8 02 00 00 00       	mov    $0x2,%eax
+    105b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    105e:	85 c0                	test   %eax,%eax
+    1060:	74 25                	je     1087 <cond_wait+0x77>
+    1062:	be 02 00 00 00       	mov    $0x2,%esi
+    1067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+    1070:	83 ec 08             	sub    $0x8,%esp
+    1073:	6a 02                	push   $0x2
+    1075:	53                   	push   %ebx
+    1076:	e8 48 f9 ff ff       	call   9c3 <futex_wait>
+    107b:	89 f0                	mov    %esi,%eax
+    107d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    1080:	83 c4 10             	add    $0x10,%esp
+    1083:	85 c0                	test   %eax,%eax
+    1085:	75 e9                	jne    1070 <cond_wait+0x60>
+  mutex_lock(m);
+}
+    1087:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    108a:	5b                   	pop    %ebx
+    108b:	5e                   	pop    %esi
+    108c:	5f                   	pop    %edi
+    108d:	5d                   	pop    %ebp
+    108e:	c3                   	ret
+    108f:	90                   	nop
+    futex_wake(&m->val, 1);
+    1090:	83 ec 08             	sub    $0x8,%esp
+    1093:	6a 01                	push   $0x1
+    1095:	53                   	push   %ebx
+    1096:	e8 30 f9 ff ff       	call   9cb <futex_wake>
+    109b:	83 c4 10             	add    $0x10,%esp
+    109e:	eb 90                	jmp    1030 <cond_wait+0x20>
+
+000010a0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	83 ec 08             	sub    $0x8,%esp
+    10a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    10a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    10ad:	8b 50 04             	mov    0x4(%eax),%edx
+    10b0:	85 d2                	test   %edx,%edx
+    10b2:	75 0c                	jne    10c0 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+    10b4:	c9                   	leave
+    10b5:	c3                   	ret
+    10b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+    10c0:	83 ec 08             	sub    $0x8,%esp
+    10c3:	6a 01                	push   $0x1
+    10c5:	50                   	push   %eax
+    10c6:	e8 00 f9 ff ff       	call   9cb <futex_wake>
+    10cb:	83 c4 10             	add    $0x10,%esp
+}
+    10ce:	c9                   	leave
+    10cf:	c3                   	ret
+
+000010d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	83 ec 08             	sub    $0x8,%esp
+    10d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    10d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    10dd:	8b 50 04             	mov    0x4(%eax),%edx
+    10e0:	85 d2                	test   %edx,%edx
+    10e2:	75 0c                	jne    10f0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+    10e4:	c9                   	leave
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+    10f0:	83 ec 08             	sub    $0x8,%esp
+    10f3:	68 ff ff ff 7f       	push   $0x7fffffff
+    10f8:	50                   	push   %eax
+    10f9:	e8 cd f8 ff ff       	call   9cb <futex_wake>
+    10fe:	83 c4 10             	add    $0x10,%esp
+}
+    1101:	c9                   	leave
+    1102:	c3                   	ret
@@ -0,0 +1,183 @@
+// Buffer cache benchmark: mix metadata-heavy work (looking up,
+// statting and reading many small files) with sequential reads
+// of every program in /, through a cache held small enough that
+// the reads don't fit.  A scan-resistant cache keeps the small
+// files' inode, directory and data blocks, so the metadata work
+// should still hit after each scan.
+// usage: bcachebench [buffers [rounds]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+#include "param.h"
+#include "pstat.h"
+
+#define NSMALL 32
+
+struct cpustat cs[NCPU];
+char buf[512];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char nbuf[16];
+  int i;
+
+  i = sizeof(nbuf) - 1;
+  nbuf[i] = 0;
+  do {
+    nbuf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(nbuf+i, w);
+}
+
+// Sum buffer cache counters over all CPUs into c.
+static void
+counts(uint *c)
+{
+  int i, j, n;
+
+  if((n = cpustat(cs, NCPU)) < 0){
+    printf(2, "bcachebench: cpustat failed\n");
+    exit();
+  }
+  for(j = CS_BHIT; j <= CS_BPROMOTE; j++){
+    c[j] = 0;
+    for(i = 0; i < n; i++)
+      c[j] += cs[i].stat[j];
+  }
+}
+
+static void
+fname(char *name, int i)
+{
+  strcpy(name, "bcb/f00");
+  name[5] = '0' + i/10;
+  name[6] = '0' + i%10;
+}
+
+// Look up, stat and read each small file.
+static void
+meta(void)
+{
+  char name[8];
+  struct stat st;
+  int i, fd;
+
+  for(i = 0; i < NSMALL; i++){
+    fname(name, i);
+    if(stat(name, &st) < 0 || (fd = open(name, O_RDONLY)) < 0){
+      printf(2, "bcachebench: cannot open %s\n", name);
+      exit();
+    }
+    read(fd, buf, sizeof(buf));
+    close(fd);
+  }
+}
+
+// Read every plain file in / from start to end.
+static void
+scan(void)
+{
+  char name[DIRSIZ+2];
+  struct dirent de;
+  struct stat st;
+  int dfd, fd;
+
+  if((dfd = open("/", O_RDONLY)) < 0){
+    printf(2, "bcachebench: cannot open /\n");
+    exit();
+  }
+  name[0] = '/';
+  name[DIRSIZ+1] = 0;
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0)
+      continue;
+    memmove(name+1, de.name, DIRSIZ);
+    if((fd = open(name, O_RDONLY)) < 0)
+      continue;
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+      while(read(fd, buf, sizeof(buf)) > 0)
+        ;
+    close(fd);
+  }
+  close(dfd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint c0[NCPUSTAT], c1[NCPUSTAT], c2[NCPUSTAT];
+  int i, fd, nbuf, rounds, old, t;
+  uint hit, miss;
+  char name[8];
+
+  nbuf = argc > 1 ? atoi(argv[1]) : 100;
+  rounds = argc > 2 ? atoi(argv[2]) : 4;
+  if(nbuf < 1 || rounds < 1){
+    printf(2, "usage: bcachebench [buffers [rounds]]\n");
+    exit();
+  }
+
+  mkdir("bcb");
+  memset(buf, 'x', sizeof(buf));
+  for(i = 0; i < NSMALL; i++){
+    fname(name, i);
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0 ||
+       write(fd, buf, 100) != 100){
+      printf(2, "bcachebench: cannot create %s\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  old = bcachesize(nbuf);
+  printf(1, "%d buffers, %d small files\n", bcachesize(0), NSMALL);
+
+  col("ROUND", 7);
+  col("META-HIT%", 11);
+  col("META-MISS", 11);
+  col("SCAN-MISS", 11);
+  col("EVICT", 8);
+  col("PROMOTE", 9);
+  printf(1, "TICKS\n");
+  for(i = 0; i < rounds; i++){
+    t = uptime();
+    counts(c0);
+    meta();
+    counts(c1);
+    scan();
+    counts(c2);
+    hit = c1[CS_BHIT] - c0[CS_BHIT];
+    miss = c1[CS_BMISS] - c0[CS_BMISS];
+    coln(i, 7);
+    coln(hit+miss ? hit*100 / (hit+miss) : 0, 11);
+    coln(miss, 11);
+    coln(c2[CS_BMISS] - c1[CS_BMISS], 11);
+    coln(c2[CS_BEVICT] - c0[CS_BEVICT], 8);
+    coln(c2[CS_BPROMOTE] - c0[CS_BPROMOTE], 9);
+    coln(uptime() - t, 0);
+    printf(1, "\n");
+  }
+
+  bcachesize(old);
+  for(i = 0; i < NSMALL; i++){
+    fname(name, i);
+    unlink(name);
+  }
+  unlink("bcb");
+  exit();
+}
@@ -1,12 +1,13 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
+// * To have a block read in soon, without waiting, call breadahead.
 // * After changing buffer data, call bwrite to write it to disk.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
@@ -17,79 +18,366 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are found through a hash table on (dev, blockno),
+// whose chains are locked in stripes, so lookups of different
+// blocks run in parallel and don't scan the whole cache.
+//
+// Buffers live in pages from kalloc.  binit sizes the cache
+// from free memory: it starts with NBUF buffers and grows a
+// page at a time while blocks miss, up to maxbuf, as long as
+// memory isn't short.  When kalloc runs out it calls bshrink
+// to give back a page whose buffers are all unused and clean.
+//
+// A miss recycles a buffer picked by the clock algorithm,
+// made scan-resistant in the manner of 2Q.  A block read in
+// starts on probation; only if it is looked up again before
+// the clock hand comes round does the hand move it to the hot
+// set.  Otherwise the hand evicts it, so a big sequential read
+// churns through the probation buffers and leaves the hot
+// inode, bitmap and directory blocks alone.  The hand passes
+// over hot buffers, clearing their used marks, and demotes
+// unused ones to probation only while the hot set holds more
+// than HOTPCT percent of the cache.  A block missed again
+// soon after being evicted from probation was evicted too
+// early; the ghost table remembers recent evictions so such
+// a block goes straight to the hot set.
+//
+// Hits never touch any shared list; they just mark the
+// buffer used.  Only a miss,
+// which may move a buffer between chains, or growing and
+// shrinking, takes bcache.lock, so blocks are only added to
+// chains by its holder.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "x86.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "proc.h"
+#include "pstat.h"
 #include "fs.h"
 #include "buf.h"
 
+#define NCHAIN  8191  // hash chains; prime, to spread consecutive blocks
+#define NCLOCK    64  // chain locks; chain i uses lock i % NCLOCK
+#define NGHOST   512  // recent evictions remembered
+#define HOTPCT    75  // hot set's share of the cache
+#define AHEADPCT  25  // most of the cache reads ahead may hold at once
+#define BPERPAGE ((PGSIZE - sizeof(void*)) / sizeof(struct buf))
+
+struct bufpage {
+  struct buf buf[BPERPAGE];
+  struct bufpage *next;
+};
+
+struct chainlock {
+  struct spinlock lock;  // protects its chains and their bufs' refcnt
+} CACHEALIGN;
+
 struct {
-  struct spinlock lock;
-  struct buf buf[NBUF];
+  struct spinlock lock;  // serializes misses, growing and shrinking
+  struct bufpage *pages; // every page of buffers
+  struct buf *free;      // buffers on no chain
+  struct bufpage *handpg;  // clock hand: handpg->buf[hand]
+  int hand;
+  int nbuf;              // buffers allocated
+  int maxbuf;            // grow up to this many
+  int reserve;           // but only while more pages than this are free
+  int nhot;              // buffers in the hot set
+  volatile int nahead;   // buffers held by reads ahead
+
+  // Blocks evicted from probation, by chain % NGHOST.
+  struct {
+    uint dev;
+    uint blockno;
+  } ghost[NGHOST];
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  struct chainlock clock[NCLOCK];
+  struct buf *chain[NCHAIN];
 } bcache;
 
+static uint
+bhash(uint dev, uint blockno)
+{
+  return (dev*31 + blockno) % NCHAIN;
+}
+
+static struct spinlock*
+chainlock(int chain)
+{
+  return &bcache.clock[chain % NCLOCK].lock;
+}
+
+// Add page pg's buffers to the cache, as free buffers.
+// Caller holds bcache.lock, or is binit.
+static void
+baddpage(struct bufpage *pg)
+{
+  struct buf *b;
+
+  for(b = pg->buf; b < pg->buf+BPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    b->flags = 0;
+    b->refcnt = 0;
+    b->chain = -1;
+    b->used = 0;
+    b->hot = 0;
+    b->ahead = 0;
+    b->next = bcache.free;
+    bcache.free = b;
+  }
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.nbuf += BPERPAGE;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  struct bufpage *pg;
+  struct chainlock *cl;
 
   initlock(&bcache.lock, "bcache");
+  for(cl = bcache.clock; cl < bcache.clock+NCLOCK; cl++)
+    initlock(&cl->lock, "bcache chain");
+
+  // Let the cache have a quarter of memory, if nothing
+  // else wants it, but leave an eighth free for others.
+  bcache.maxbuf = kfreepages() / 4 * BPERPAGE;
+  bcache.reserve = kfreepages() / 8;
+  while(bcache.nbuf < NBUF){
+    if((pg = (struct bufpage*)kalloc()) == 0)
+      panic("binit");
+    baddpage(pg);
+  }
+  bcache.handpg = bcache.pages;
+  cprintf("bcache: %d buffers, up to %d\n", bcache.nbuf, bcache.maxbuf);
+}
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+// Return the buffer on chain holding block blockno of dev,
+// or 0.  Caller holds the chain's lock.
+static struct buf*
+blookup(int chain, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.chain[chain]; b; b = b->next)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Like blookup, but count a use of the buffer found and
+// raise its refcnt.  Reading a block ahead doesn't count
+// as a use, so the read that wanted it is the first use.
+static struct buf*
+bfind(int chain, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = blookup(chain, dev, blockno)) != 0){
+    b->refcnt++;
+    if(b->ahead)
+      b->ahead = 0;
+    else
+      b->used = 1;
   }
+  return b;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Take unused, clean buffer b off its chain, if it is
+// still unused and clean.  Caller holds bcache.lock, so
+// b's chain can't change.
+static int
+bunchain(struct buf *b)
+{
+  struct buf **pp;
+  struct spinlock *lk;
+
+  lk = chainlock(b->chain);
+  acquire(lk);
+  // "clean" because B_DIRTY and not locked means log.c
+  // hasn't yet committed the changes to the buffer.
+  if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+    release(lk);
+    return 0;
+  }
+  for(pp = &bcache.chain[b->chain]; *pp != b; pp = &(*pp)->next)
+    ;
+  *pp = b->next;
+  b->chain = -1;
+  release(lk);
+  if(b->hot){
+    b->hot = 0;
+    bcache.nhot--;
+  }
+  return 1;
+}
+
+// Move the clock hand on one buffer; return the one it was on.
 static struct buf*
-bget(uint dev, uint blockno)
+bhand(void)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
+  b = &bcache.handpg->buf[bcache.hand];
+  if(++bcache.hand == BPERPAGE){
+    bcache.hand = 0;
+    bcache.handpg = bcache.handpg->next;
+    if(bcache.handpg == 0)
+      bcache.handpg = bcache.pages;
+  }
+  return b;
+}
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+// Find a buffer to recycle and take it off its chain.
+// For a read ahead, which can do without, look only once
+// round and return 0 if there is none.
+// Caller holds bcache.lock.
+static struct buf*
+bvictim(int ahead)
+{
+  struct buf *b;
+  int n, g;
+
+  if((b = bcache.free) != 0){
+    bcache.free = b->next;
+    return b;
+  }
+  // Twice round clears every used mark; after that, if
+  // probation is all in use or dirty, demote whatever we
+  // can from the hot set regardless of its size.
+  for(n = 0; n < (ahead ? 1 : 4)*bcache.nbuf; n++){
+    b = bhand();
+    if(b->refcnt != 0 || (b->flags & B_DIRTY))
+      continue;
+    if(b->hot){
+      if(b->used)
+        b->used = 0;
+      else if(bcache.nhot*100 > bcache.nbuf*HOTPCT || n >= 2*bcache.nbuf){
+        b->hot = 0;
+        bcache.nhot--;
+      }
+      continue;
+    }
+    if(b->used){
+      b->used = 0;
+      b->hot = 1;
+      bcache.nhot++;
+      cpustatinc(CS_BPROMOTE);
+      continue;
+    }
+    if(bunchain(b)){
+      g = bhash(b->dev, b->blockno) % NGHOST;
+      bcache.ghost[g].dev = b->dev;
+      bcache.ghost[g].blockno = b->blockno;
+      cpustatinc(CS_BEVICT);
       return b;
     }
   }
+  if(!ahead)
+    panic("bget: no buffers");
+  return 0;
+}
 
-  // Not cached; recycle some unused buffer and clean buffer
-  // "clean" because B_DIRTY and not locked means log.c
-  // hasn't yet committed the changes to the buffer.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+// Was block blockno of dev, on chain, evicted from probation
+// lately?  Forget it if so.  Caller holds bcache.lock.
+static int
+bghost(int chain, uint dev, uint blockno)
+{
+  int i;
+
+  i = chain % NGHOST;
+  if(bcache.ghost[i].dev != dev || bcache.ghost[i].blockno != blockno)
+    return 0;
+  bcache.ghost[i].dev = 0;
+  return 1;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer; but for a read
+// ahead, return 0 if the block is cached already, rather than
+// wait for whoever has it, or if no buffer is free.
+static struct buf*
+bget(uint dev, uint blockno, int ahead)
+{
+  struct buf *b;
+  struct bufpage *pg;
+  struct spinlock *lk;
+  int chain;
+
+  // Is the block already cached?
+  chain = bhash(dev, blockno);
+  lk = chainlock(chain);
+  acquire(lk);
+  b = ahead ? blookup(chain, dev, blockno) : bfind(chain, dev, blockno);
+  release(lk);
+  if(b && ahead)
+    return 0;
+  if(b){
+    cpustatinc(CS_BHIT);
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached.  Grow the cache if we may; kalloc first,
+  // since it may shrink the cache, which needs bcache.lock.
+  pg = 0;
+  if(bcache.free == 0 && bcache.nbuf < bcache.maxbuf &&
+     kfreepages() > bcache.reserve)
+    pg = (struct bufpage*)kalloc();
+
+  // Look again once we hold bcache.lock, in case another
+  // CPU cached the block meanwhile; after that no one else can.
+  acquire(&bcache.lock);
+  acquire(lk);
+  b = ahead ? blookup(chain, dev, blockno) : bfind(chain, dev, blockno);
+  release(lk);
+  if(b && ahead){
+    release(&bcache.lock);
+    if(pg)
+      kfree((char*)pg);
+    return 0;
+  }
+  if(b)
+    cpustatinc(CS_BHIT);
+  else {
+    if(pg){
+      baddpage(pg);
+      pg = 0;
+    }
+    if((b = bvictim(ahead)) == 0){
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      return 0;
+    }
+    cpustatinc(CS_BMISS);
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    // This lookup doesn't count as a second use.
+    b->used = 0;
+    b->ahead = 0;
+    if(bghost(chain, dev, blockno)){
+      b->hot = 1;
+      bcache.nhot++;
     }
+    acquire(lk);
+    b->chain = chain;
+    b->next = bcache.chain[chain];
+    bcache.chain[chain] = b;
+    release(lk);
   }
-  panic("bget: no buffers");
+  release(&bcache.lock);
+  if(pg)
+    kfree((char*)pg);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +386,49 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if(!(b->flags & B_VALID)) {
     iderw(b);
   }
   return b;
 }
 
+// Start reading block blockno of dev into the cache, if it
+// isn't there already, without waiting for the disk.  Only
+// a hint: skip it if reads ahead already hold their share
+// of the cache, or no buffer is free.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+  struct spinlock *lk;
+
+  if(bcache.nahead*100 >= bcache.nbuf*AHEADPCT)
+    return;
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  if(b->flags & B_VALID){
+    // A reader found the new buffer before we locked it.
+    brelse(b);
+    return;
+  }
+  lk = chainlock(b->chain);
+  acquire(lk);
+  if(!b->used)
+    b->ahead = 1;
+  release(lk);
+  xadd(&bcache.nahead, 1);
+  idereadasync(b);
+}
+
+// The disk has finished reading b ahead; let go of it.
+void
+brelseahead(struct buf *b)
+{
+  xadd(&bcache.nahead, -1);
+  brelse(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -116,29 +440,101 @@ bwrite(struct buf *b)
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
+  struct spinlock *lk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b can't move chains while we hold a reference.
+  lk = chainlock(b->chain);
+  acquire(lk);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
+  release(lk);
+}
+
+// Give a page of buffers back to kalloc, keeping at
+// least min.  Return whether we did.
+static int
+bfreepage(int min)
+{
+  struct bufpage *pg, **pp;
+  struct buf *b, **bp;
+
+  acquire(&bcache.lock);
+  if(bcache.nbuf - (int)BPERPAGE < min){
+    release(&bcache.lock);
+    return 0;
+  }
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+    // Peek first, to skip pages that are plainly busy.
+    for(b = pg->buf; b < pg->buf+BPERPAGE; b++)
+      if(b->refcnt != 0 || (b->flags & B_DIRTY))
+        break;
+    if(b < pg->buf+BPERPAGE)
+      continue;
+
+    // Take pg's buffers off the free list and their chains.
+    for(bp = &bcache.free; *bp; )
+      if(*bp >= pg->buf && *bp < pg->buf+BPERPAGE)
+        *bp = (*bp)->next;
+      else
+        bp = &(*bp)->next;
+    for(b = pg->buf; b < pg->buf+BPERPAGE; b++)
+      if(b->chain >= 0 && !bunchain(b))
+        break;
+    if(b == pg->buf+BPERPAGE)
+      break;
+
+    // Lost a race with bget; the ones now off their
+    // chains are free buffers.
+    for(b = pg->buf; b < pg->buf+BPERPAGE; b++)
+      if(b->chain < 0){
+        b->next = bcache.free;
+        bcache.free = b;
+      }
+  }
+  if(pg == 0){
+    release(&bcache.lock);
+    return 0;
+  }
+
+  *pp = pg->next;
+  if(bcache.handpg == pg){
+    bcache.handpg = bcache.pages;
+    bcache.hand = 0;
+  }
+  bcache.nbuf -= BPERPAGE;
   release(&bcache.lock);
+  kfree((char*)pg);
+  return 1;
 }
-//PAGEBREAK!
-// Blank page.
 
+// Memory is short: give a page of buffers back to kalloc.
+int
+bshrink(void)
+{
+  return bfreepage(NBUF);
+}
+
+// Limit the cache to n buffers, shrinking it if it can,
+// or just report the limit if n is 0.  Returns the old limit.
+int
+bcachesize(int n)
+{
+  int old;
+
+  acquire(&bcache.lock);
+  old = bcache.maxbuf;
+  if(n > 0)
+    bcache.maxbuf = n < NBUF ? NBUF : n;
+  n = bcache.maxbuf;
+  release(&bcache.lock);
+  while(bfreepage(n))
+    ;
+  return old;
+}
@@ -0,0 +1,2004 @@
+
+_boottime:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 30             	sub    $0x30,%esp
+  int i, n;
+  uint prev;
+
+  n = boottimes(bp, NPHASE);
+  14:	6a 20                	push   $0x20
+  16:	68 40 12 00 00       	push   $0x1240
+  1b:	e8 e3 05 00 00       	call   603 <boottimes>
+  if(n < 0){
+  20:	83 c4 10             	add    $0x10,%esp
+  n = boottimes(bp, NPHASE);
+  23:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  if(n < 0){
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 d1 01 00 00    	js     1ff <main+0x1ff>
+    printf(2, "boottime: boottimes failed\n");
+    exit();
+  }
+  col("PHASE", 16);
+  2e:	ba 10 00 00 00       	mov    $0x10,%edx
+  33:	b8 f5 0c 00 00       	mov    $0xcf5,%eax
+  38:	e8 e3 01 00 00       	call   220 <col>
+  col("END", 12);
+  3d:	ba 0c 00 00 00       	mov    $0xc,%edx
+  42:	b8 fb 0c 00 00       	mov    $0xcfb,%eax
+  47:	e8 d4 01 00 00       	call   220 <col>
+  printf(1, "TOOK\n");
+  4c:	52                   	push   %edx
+  4d:	52                   	push   %edx
+  4e:	68 ff 0c 00 00       	push   $0xcff
+  53:	6a 01                	push   $0x1
+  55:	e8 76 06 00 00       	call   6d0 <printf>
+  prev = 0;
+  for(i = 0; i < n; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+  61:	0f 84 93 01 00 00    	je     1fa <main+0x1fa>
+  67:	31 c0                	xor    %eax,%eax
+  69:	bf 40 12 00 00       	mov    $0x1240,%edi
+    buf[--i] = '0' + x % 10;
+  6e:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  for(i = 0; i < n; i++){
+  73:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  n = strlen(s);
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	57                   	push   %edi
+  84:	e8 87 02 00 00       	call   310 <strlen>
+  printf(1, "%s", s);
+  89:	83 c4 0c             	add    $0xc,%esp
+  8c:	57                   	push   %edi
+  n = strlen(s);
+  8d:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+  8f:	68 d4 0c 00 00       	push   $0xcd4
+  94:	6a 01                	push   $0x1
+  96:	e8 35 06 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	83 fe 0f             	cmp    $0xf,%esi
+  a1:	7f 1f                	jg     c2 <main+0xc2>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+    printf(1, " ");
+  a8:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+  ab:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+  ae:	68 d7 0c 00 00       	push   $0xcd7
+  b3:	6a 01                	push   $0x1
+  b5:	e8 16 06 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	83 fe 10             	cmp    $0x10,%esi
+  c0:	75 e6                	jne    a8 <main+0xa8>
+  buf[i] = 0;
+  c2:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    col(bp[i].name, 16);
+    coln(bp[i].usec, 12);
+  c6:	8b 4f 10             	mov    0x10(%edi),%ecx
+  i = sizeof(buf) - 1;
+  c9:	be 0f 00 00 00       	mov    $0xf,%esi
+  ce:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    buf[--i] = '0' + x % 10;
+  d8:	89 c8                	mov    %ecx,%eax
+  da:	83 ee 01             	sub    $0x1,%esi
+  dd:	f7 e3                	mul    %ebx
+  df:	89 c8                	mov    %ecx,%eax
+  e1:	c1 ea 03             	shr    $0x3,%edx
+  e4:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+  e7:	01 ff                	add    %edi,%edi
+  e9:	29 f8                	sub    %edi,%eax
+  eb:	83 c0 30             	add    $0x30,%eax
+  ee:	88 44 35 d8          	mov    %al,-0x28(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+  f2:	89 c8                	mov    %ecx,%eax
+  f4:	89 d1                	mov    %edx,%ecx
+  f6:	83 f8 09             	cmp    $0x9,%eax
+  f9:	77 dd                	ja     d8 <main+0xd8>
+  col(buf+i, w);
+  fb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+  fe:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 101:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 104:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  n = strlen(s);
+ 107:	52                   	push   %edx
+ 108:	89 55 cc             	mov    %edx,-0x34(%ebp)
+ 10b:	e8 00 02 00 00       	call   310 <strlen>
+  printf(1, "%s", s);
+ 110:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 113:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+ 116:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+ 118:	52                   	push   %edx
+ 119:	68 d4 0c 00 00       	push   $0xcd4
+ 11e:	6a 01                	push   $0x1
+ 120:	e8 ab 05 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 125:	83 c4 10             	add    $0x10,%esp
+ 128:	83 fe 0b             	cmp    $0xb,%esi
+ 12b:	7f 1d                	jg     14a <main+0x14a>
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+ 130:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 133:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+ 136:	68 d7 0c 00 00       	push   $0xcd7
+ 13b:	6a 01                	push   $0x1
+ 13d:	e8 8e 05 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	83 fe 0c             	cmp    $0xc,%esi
+ 148:	75 e6                	jne    130 <main+0x130>
+    coln(bp[i].usec - prev, 0);
+ 14a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 14d:	8b 4f 10             	mov    0x10(%edi),%ecx
+  buf[i] = 0;
+ 150:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  i = sizeof(buf) - 1;
+ 154:	be 0f 00 00 00       	mov    $0xf,%esi
+ 159:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    coln(bp[i].usec - prev, 0);
+ 15c:	29 c1                	sub    %eax,%ecx
+  buf[i] = 0;
+ 15e:	66 90                	xchg   %ax,%ax
+    buf[--i] = '0' + x % 10;
+ 160:	89 c8                	mov    %ecx,%eax
+ 162:	83 ee 01             	sub    $0x1,%esi
+ 165:	f7 e3                	mul    %ebx
+ 167:	89 c8                	mov    %ecx,%eax
+ 169:	c1 ea 03             	shr    $0x3,%edx
+ 16c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 16f:	01 ff                	add    %edi,%edi
+ 171:	29 f8                	sub    %edi,%eax
+ 173:	83 c0 30             	add    $0x30,%eax
+ 176:	88 44 35 d8          	mov    %al,-0x28(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ 17a:	89 c8                	mov    %ecx,%eax
+ 17c:	89 d1                	mov    %edx,%ecx
+ 17e:	83 f8 09             	cmp    $0x9,%eax
+ 181:	77 dd                	ja     160 <main+0x160>
+  col(buf+i, w);
+ 183:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 186:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 189:	8b 7d d0             	mov    -0x30(%ebp),%edi
+ 18c:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  n = strlen(s);
+ 18f:	52                   	push   %edx
+ 190:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 193:	e8 78 01 00 00       	call   310 <strlen>
+  printf(1, "%s", s);
+ 198:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 19b:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+ 19e:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+ 1a0:	52                   	push   %edx
+ 1a1:	68 d4 0c 00 00       	push   $0xcd4
+ 1a6:	6a 01                	push   $0x1
+ 1a8:	e8 23 05 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 f6                	test   %esi,%esi
+ 1b2:	79 1b                	jns    1cf <main+0x1cf>
+ 1b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 1b8:	83 ec 08             	sub    $0x8,%esp
+ 1bb:	68 d7 0c 00 00       	push   $0xcd7
+ 1c0:	6a 01                	push   $0x1
+ 1c2:	e8 09 05 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 1c7:	83 c4 10             	add    $0x10,%esp
+ 1ca:	83 c6 01             	add    $0x1,%esi
+ 1cd:	75 e9                	jne    1b8 <main+0x1b8>
+    printf(1, "\n");
+ 1cf:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < n; i++){
+ 1d2:	83 c7 14             	add    $0x14,%edi
+    printf(1, "\n");
+ 1d5:	68 03 0d 00 00       	push   $0xd03
+ 1da:	6a 01                	push   $0x1
+ 1dc:	e8 ef 04 00 00       	call   6d0 <printf>
+    prev = bp[i].usec;
+ 1e1:	8b 47 fc             	mov    -0x4(%edi),%eax
+  for(i = 0; i < n; i++){
+ 1e4:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+ 1e8:	83 c4 10             	add    $0x10,%esp
+    prev = bp[i].usec;
+ 1eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < n; i++){
+ 1ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1f1:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+ 1f4:	0f 85 86 fe ff ff    	jne    80 <main+0x80>
+  }
+  exit();
+ 1fa:	e8 c4 02 00 00       	call   4c3 <exit>
+    printf(2, "boottime: boottimes failed\n");
+ 1ff:	51                   	push   %ecx
+ 200:	51                   	push   %ecx
+ 201:	68 d9 0c 00 00       	push   $0xcd9
+ 206:	6a 02                	push   $0x2
+ 208:	e8 c3 04 00 00       	call   6d0 <printf>
+    exit();
+ 20d:	e8 b1 02 00 00       	call   4c3 <exit>
+ 212:	66 90                	xchg   %ax,%ax
+ 214:	66 90                	xchg   %ax,%ax
+ 216:	66 90                	xchg   %ax,%ax
+ 218:	66 90                	xchg   %ax,%ax
+ 21a:	66 90                	xchg   %ax,%ax
+ 21c:	66 90                	xchg   %ax,%ax
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <col>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	89 c7                	mov    %eax,%edi
+ 226:	56                   	push   %esi
+ 227:	89 d6                	mov    %edx,%esi
+ 229:	53                   	push   %ebx
+ 22a:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+ 22d:	50                   	push   %eax
+ 22e:	e8 dd 00 00 00       	call   310 <strlen>
+  printf(1, "%s", s);
+ 233:	83 c4 0c             	add    $0xc,%esp
+ 236:	57                   	push   %edi
+  n = strlen(s);
+ 237:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 239:	68 d4 0c 00 00       	push   $0xcd4
+ 23e:	6a 01                	push   $0x1
+ 240:	e8 8b 04 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 245:	83 c4 10             	add    $0x10,%esp
+ 248:	39 f3                	cmp    %esi,%ebx
+ 24a:	7d 1d                	jge    269 <col+0x49>
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 250:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 253:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 256:	68 d7 0c 00 00       	push   $0xcd7
+ 25b:	6a 01                	push   $0x1
+ 25d:	e8 6e 04 00 00       	call   6d0 <printf>
+  for(; n < w; n++)
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	39 de                	cmp    %ebx,%esi
+ 267:	75 e7                	jne    250 <col+0x30>
+}
+ 269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26c:	5b                   	pop    %ebx
+ 26d:	5e                   	pop    %esi
+ 26e:	5f                   	pop    %edi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+ 271:	66 90                	xchg   %ax,%ax
+ 273:	66 90                	xchg   %ax,%ax
+ 275:	66 90                	xchg   %ax,%ax
+ 277:	66 90                	xchg   %ax,%ax
+ 279:	66 90                	xchg   %ax,%ax
+ 27b:	66 90                	xchg   %ax,%ax
+ 27d:	66 90                	xchg   %ax,%ax
+ 27f:	90                   	nop
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 1e 01 00 00       	call   4db <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <add_dir>:
+SYSCALL(add_dir)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <history>:
+SYSCALL(history)
+ 56b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 573:	b8 19 00 00 00       	mov    $0x19,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <nanosleep>:
+SYSCALL(nanosleep)
+ 57b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <clone>:
+SYSCALL(clone)
+ 583:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <join>:
+SYSCALL(join)
+ 58b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <futex_wait>:
+SYSCALL(futex_wait)
+ 593:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <futex_wake>:
+SYSCALL(futex_wake)
+ 59b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5ab:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 5b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getprocinfo>:
+SYSCALL(getprocinfo)
+ 5bb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <waitpid>:
+SYSCALL(waitpid)
+ 5c3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <tracectl>:
+SYSCALL(tracectl)
+ 5cb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <traceread>:
+SYSCALL(traceread)
+ 5d3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 5db:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 5e3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 5eb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <irqroute>:
+SYSCALL(irqroute)
+ 5f3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <irqstat>:
+SYSCALL(irqstat)
+ 5fb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <boottimes>:
+SYSCALL(boottimes)
+ 603:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <lockbench>:
+SYSCALL(lockbench)
+ 60b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <lockstat>:
+SYSCALL(lockstat)
+ 613:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <cpustat>:
+SYSCALL(cpustat)
+ 61b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <bcachesize>:
+SYSCALL(bcachesize)
+ 623:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+ 62b:	66 90                	xchg   %ax,%ax
+ 62d:	66 90                	xchg   %ax,%ax
+ 62f:	90                   	nop
+
+00000630 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 638:	89 d1                	mov    %edx,%ecx
+{
+ 63a:	83 ec 3c             	sub    $0x3c,%esp
+ 63d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 640:	85 d2                	test   %edx,%edx
+ 642:	0f 89 80 00 00 00    	jns    6c8 <printint+0x98>
+ 648:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 64c:	74 7a                	je     6c8 <printint+0x98>
+    x = -xx;
+ 64e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 650:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 655:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 658:	31 f6                	xor    %esi,%esi
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 660:	89 c8                	mov    %ecx,%eax
+ 662:	31 d2                	xor    %edx,%edx
+ 664:	89 f7                	mov    %esi,%edi
+ 666:	f7 f3                	div    %ebx
+ 668:	8d 76 01             	lea    0x1(%esi),%esi
+ 66b:	0f b6 92 64 0d 00 00 	movzbl 0xd64(%edx),%edx
+ 672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 676:	89 ca                	mov    %ecx,%edx
+ 678:	89 c1                	mov    %eax,%ecx
+ 67a:	39 da                	cmp    %ebx,%edx
+ 67c:	73 e2                	jae    660 <printint+0x30>
+  if(neg)
+ 67e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 681:	85 c0                	test   %eax,%eax
+ 683:	74 07                	je     68c <printint+0x5c>
+    buf[i++] = '-';
+ 685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 68a:	89 f7                	mov    %esi,%edi
+ 68c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 68f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 692:	01 df                	add    %ebx,%edi
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 698:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6a4:	6a 01                	push   $0x1
+ 6a6:	50                   	push   %eax
+ 6a7:	56                   	push   %esi
+ 6a8:	e8 36 fe ff ff       	call   4e3 <write>
+  while(--i >= 0)
+ 6ad:	89 f8                	mov    %edi,%eax
+ 6af:	83 c4 10             	add    $0x10,%esp
+ 6b2:	83 ef 01             	sub    $0x1,%edi
+ 6b5:	39 d8                	cmp    %ebx,%eax
+ 6b7:	75 df                	jne    698 <printint+0x68>
+}
+ 6b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6bc:	5b                   	pop    %ebx
+ 6bd:	5e                   	pop    %esi
+ 6be:	5f                   	pop    %edi
+ 6bf:	5d                   	pop    %ebp
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6c8:	31 c0                	xor    %eax,%eax
+ 6ca:	eb 89                	jmp    655 <printint+0x25>
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6df:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e2:	83 c6 01             	add    $0x1,%esi
+ 6e5:	84 db                	test   %bl,%bl
+ 6e7:	74 67                	je     750 <printf+0x80>
+ 6e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ec:	31 d2                	xor    %edx,%edx
+ 6ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6f1:	eb 34                	jmp    727 <printf+0x57>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+ 6f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 700:	83 f8 25             	cmp    $0x25,%eax
+ 703:	74 18                	je     71d <printf+0x4d>
+  write(fd, &c, 1);
+ 705:	83 ec 04             	sub    $0x4,%esp
+ 708:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 70b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70e:	6a 01                	push   $0x1
+ 710:	50                   	push   %eax
+ 711:	57                   	push   %edi
+ 712:	e8 cc fd ff ff       	call   4e3 <write>
+ 717:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 71a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 71d:	0f b6 1e             	movzbl (%esi),%ebx
+ 720:	83 c6 01             	add    $0x1,%esi
+ 723:	84 db                	test   %bl,%bl
+ 725:	74 29                	je     750 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 727:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 72a:	85 d2                	test   %edx,%edx
+ 72c:	74 ca                	je     6f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 72e:	83 fa 25             	cmp    $0x25,%edx
+ 731:	75 ea                	jne    71d <printf+0x4d>
+      if(c == 'd'){
+ 733:	83 f8 25             	cmp    $0x25,%eax
+ 736:	0f 84 24 01 00 00    	je     860 <printf+0x190>
+ 73c:	83 e8 63             	sub    $0x63,%eax
+ 73f:	83 f8 15             	cmp    $0x15,%eax
+ 742:	77 1c                	ja     760 <printf+0x90>
+ 744:	ff 24 85 0c 0d 00 00 	jmp    *0xd0c(,%eax,4)
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 753:	5b                   	pop    %ebx
+ 754:	5e                   	pop    %esi
+ 755:	5f                   	pop    %edi
+ 756:	5d                   	pop    %ebp
+ 757:	c3                   	ret
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 766:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 76a:	6a 01                	push   $0x1
+ 76c:	52                   	push   %edx
+ 76d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 770:	57                   	push   %edi
+ 771:	e8 6d fd ff ff       	call   4e3 <write>
+ 776:	83 c4 0c             	add    $0xc,%esp
+ 779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77c:	6a 01                	push   $0x1
+ 77e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 781:	52                   	push   %edx
+ 782:	57                   	push   %edi
+ 783:	e8 5b fd ff ff       	call   4e3 <write>
+        putc(fd, c);
+ 788:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78b:	31 d2                	xor    %edx,%edx
+ 78d:	eb 8e                	jmp    71d <printf+0x4d>
+ 78f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 00                	push   $0x0
+ 79f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7a4:	e8 87 fe ff ff       	call   630 <printint>
+        ap++;
+ 7a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 67 ff ff ff       	jmp    71d <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7c5:	83 c0 04             	add    $0x4,%eax
+ 7c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7cb:	85 db                	test   %ebx,%ebx
+ 7cd:	0f 84 9d 00 00 00    	je     870 <printf+0x1a0>
+        while(*s != 0){
+ 7d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	0f 84 3d ff ff ff    	je     71d <printf+0x4d>
+ 7e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7e6:	89 de                	mov    %ebx,%esi
+ 7e8:	89 d3                	mov    %edx,%ebx
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	53                   	push   %ebx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 e1 fc ff ff       	call   4e3 <write>
+        while(*s != 0){
+ 802:	0f b6 06             	movzbl (%esi),%eax
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	84 c0                	test   %al,%al
+ 80a:	75 e4                	jne    7f0 <printf+0x120>
+      state = 0;
+ 80c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 07 ff ff ff       	jmp    71d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 01                	push   $0x1
+ 82f:	e9 6b ff ff ff       	jmp    79f <printf+0xcf>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 838:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 841:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 843:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 846:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	52                   	push   %edx
+ 84c:	57                   	push   %edi
+ 84d:	e8 91 fc ff ff       	call   4e3 <write>
+        ap++;
+ 852:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 855:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 858:	31 d2                	xor    %edx,%edx
+ 85a:	e9 be fe ff ff       	jmp    71d <printf+0x4d>
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 866:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 869:	6a 01                	push   $0x1
+ 86b:	e9 11 ff ff ff       	jmp    781 <printf+0xb1>
+ 870:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 875:	bb 05 0d 00 00       	mov    $0xd05,%ebx
+ 87a:	e9 61 ff ff ff       	jmp    7e0 <printf+0x110>
+ 87f:	90                   	nop
+
+00000880 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 880:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 881:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 884:	89 e5                	mov    %esp,%ebp
+ 886:	57                   	push   %edi
+ 887:	56                   	push   %esi
+ 888:	53                   	push   %ebx
+ 889:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88b:	a1 c4 14 00 00       	mov    0x14c4,%eax
+ 890:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 892:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 894:	39 ca                	cmp    %ecx,%edx
+ 896:	73 30                	jae    8c8 <ufree+0x48>
+ 898:	39 c1                	cmp    %eax,%ecx
+ 89a:	72 04                	jb     8a0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89c:	39 c2                	cmp    %eax,%edx
+ 89e:	72 f0                	jb     890 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8a3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8a6:	39 f8                	cmp    %edi,%eax
+ 8a8:	74 26                	je     8d0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8b3:	39 f1                	cmp    %esi,%ecx
+ 8b5:	74 30                	je     8e7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8b7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b9:	5b                   	pop    %ebx
+  freep = p;
+ 8ba:	89 15 c4 14 00 00    	mov    %edx,0x14c4
+}
+ 8c0:	5e                   	pop    %esi
+ 8c1:	5f                   	pop    %edi
+ 8c2:	5d                   	pop    %ebp
+ 8c3:	c3                   	ret
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c8:	39 c1                	cmp    %eax,%ecx
+ 8ca:	72 d0                	jb     89c <ufree+0x1c>
+ 8cc:	eb c2                	jmp    890 <ufree+0x10>
+ 8ce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 70 04             	add    0x4(%eax),%esi
+ 8d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8e3:	39 f1                	cmp    %esi,%ecx
+ 8e5:	75 d0                	jne    8b7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 8e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ea:	89 15 c4 14 00 00    	mov    %edx,0x14c4
+    p->s.size += bp->s.size;
+ 8f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f8:	5b                   	pop    %ebx
+ 8f9:	5e                   	pop    %esi
+ 8fa:	5f                   	pop    %edi
+ 8fb:	5d                   	pop    %ebp
+ 8fc:	c3                   	ret
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	53                   	push   %ebx
+ 904:	83 ec 10             	sub    $0x10,%esp
+ 907:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 90a:	68 c0 14 00 00       	push   $0x14c0
+ 90f:	e8 ec 01 00 00       	call   b00 <lock_acquire>
+  ufree(ap);
+ 914:	89 d8                	mov    %ebx,%eax
+ 916:	e8 65 ff ff ff       	call   880 <ufree>
+  lock_release(&mlock);
+ 91b:	c7 45 08 c0 14 00 00 	movl   $0x14c0,0x8(%ebp)
+}
+ 922:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 925:	83 c4 10             	add    $0x10,%esp
+}
+ 928:	c9                   	leave
+  lock_release(&mlock);
+ 929:	e9 f2 01 00 00       	jmp    b20 <lock_release>
+ 92e:	66 90                	xchg   %ax,%ax
+
+00000930 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 939:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 93c:	68 c0 14 00 00       	push   $0x14c0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 941:	8d 48 07             	lea    0x7(%eax),%ecx
+ 944:	c1 e9 03             	shr    $0x3,%ecx
+ 947:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 94a:	e8 b1 01 00 00       	call   b00 <lock_acquire>
+  if((prevp = freep) == 0){
+ 94f:	8b 15 c4 14 00 00    	mov    0x14c4,%edx
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	85 d2                	test   %edx,%edx
+ 95a:	0f 84 b0 00 00 00    	je     a10 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 960:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 962:	8b 47 04             	mov    0x4(%edi),%eax
+ 965:	39 f0                	cmp    %esi,%eax
+ 967:	73 6f                	jae    9d8 <malloc+0xa8>
+  if(nu < 4096)
+ 969:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 96e:	39 de                	cmp    %ebx,%esi
+ 970:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 973:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 97a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 97d:	eb 0a                	jmp    989 <malloc+0x59>
+ 97f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 980:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 982:	8b 47 04             	mov    0x4(%edi),%eax
+ 985:	39 f0                	cmp    %esi,%eax
+ 987:	73 4f                	jae    9d8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 989:	89 fa                	mov    %edi,%edx
+ 98b:	39 3d c4 14 00 00    	cmp    %edi,0x14c4
+ 991:	75 ed                	jne    980 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	ff 75 e4             	push   -0x1c(%ebp)
+ 999:	e8 ad fb ff ff       	call   54b <sbrk>
+  if(p == (char*)-1)
+ 99e:	83 c4 10             	add    $0x10,%esp
+ 9a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9a4:	74 15                	je     9bb <malloc+0x8b>
+  hp->s.size = nu;
+ 9a6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 9a9:	83 c0 08             	add    $0x8,%eax
+ 9ac:	e8 cf fe ff ff       	call   880 <ufree>
+  return freep;
+ 9b1:	8b 15 c4 14 00 00    	mov    0x14c4,%edx
+      if((p = morecore(nunits)) == 0){
+ 9b7:	85 d2                	test   %edx,%edx
+ 9b9:	75 c5                	jne    980 <malloc+0x50>
+        lock_release(&mlock);
+ 9bb:	83 ec 0c             	sub    $0xc,%esp
+ 9be:	68 c0 14 00 00       	push   $0x14c0
+ 9c3:	e8 58 01 00 00       	call   b20 <lock_release>
+        return 0;
+ 9c8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 9cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9ce:	31 c0                	xor    %eax,%eax
+}
+ 9d0:	5b                   	pop    %ebx
+ 9d1:	5e                   	pop    %esi
+ 9d2:	5f                   	pop    %edi
+ 9d3:	5d                   	pop    %ebp
+ 9d4:	c3                   	ret
+ 9d5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9d8:	39 c6                	cmp    %eax,%esi
+ 9da:	74 64                	je     a40 <malloc+0x110>
+        p->s.size -= nunits;
+ 9dc:	29 f0                	sub    %esi,%eax
+ 9de:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 9e1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 9e4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 9e7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 9ea:	89 15 c4 14 00 00    	mov    %edx,0x14c4
+      lock_release(&mlock);
+ 9f0:	68 c0 14 00 00       	push   $0x14c0
+ 9f5:	e8 26 01 00 00       	call   b20 <lock_release>
+      return (void*)(p + 1);
+ 9fa:	83 c4 10             	add    $0x10,%esp
+}
+ 9fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a00:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ a03:	5b                   	pop    %ebx
+ a04:	5e                   	pop    %esi
+ a05:	5f                   	pop    %edi
+ a06:	5d                   	pop    %ebp
+ a07:	c3                   	ret
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ a10:	c7 05 c4 14 00 00 c8 	movl   $0x14c8,0x14c4
+ a17:	14 00 00 
+    base.s.size = 0;
+ a1a:	bf c8 14 00 00       	mov    $0x14c8,%edi
+    base.s.ptr = freep = prevp = &base;
+ a1f:	c7 05 c8 14 00 00 c8 	movl   $0x14c8,0x14c8
+ a26:	14 00 00 
+    base.s.size = 0;
+ a29:	c7 05 cc 14 00 00 00 	movl   $0x0,0x14cc
+ a30:	00 00 00 
+    if(p->s.size >= nunits){
+ a33:	e9 31 ff ff ff       	jmp    969 <malloc+0x39>
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a40:	8b 07                	mov    (%edi),%eax
+ a42:	89 02                	mov    %eax,(%edx)
+ a44:	eb a1                	jmp    9e7 <malloc+0xb7>
+ a46:	66 90                	xchg   %ax,%ax
+ a48:	66 90                	xchg   %ax,%ax
+ a4a:	66 90                	xchg   %ax,%ax
+ a4c:	66 90                	xchg   %ax,%ax
+ a4e:	66 90                	xchg   %ax,%ax
+
+00000a50 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	53                   	push   %ebx
+ a54:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ a57:	68 00 10 00 00       	push   $0x1000
+ a5c:	e8 cf fe ff ff       	call   930 <malloc>
+ a61:	83 c4 10             	add    $0x10,%esp
+ a64:	85 c0                	test   %eax,%eax
+ a66:	74 37                	je     a9f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ a68:	83 ec 04             	sub    $0x4,%esp
+ a6b:	89 c3                	mov    %eax,%ebx
+ a6d:	50                   	push   %eax
+ a6e:	ff 75 0c             	push   0xc(%ebp)
+ a71:	ff 75 08             	push   0x8(%ebp)
+ a74:	e8 0a fb ff ff       	call   583 <clone>
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	85 c0                	test   %eax,%eax
+ a7e:	78 08                	js     a88 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a83:	c9                   	leave
+ a84:	c3                   	ret
+ a85:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ a88:	83 ec 0c             	sub    $0xc,%esp
+ a8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a8e:	53                   	push   %ebx
+ a8f:	e8 6c fe ff ff       	call   900 <free>
+ a94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ a9a:	83 c4 10             	add    $0x10,%esp
+}
+ a9d:	c9                   	leave
+ a9e:	c3                   	ret
+    return -1;
+ a9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ aa4:	eb da                	jmp    a80 <thread_create+0x30>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ab6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ab9:	50                   	push   %eax
+ aba:	e8 cc fa ff ff       	call   58b <join>
+ abf:	83 c4 10             	add    $0x10,%esp
+ ac2:	85 c0                	test   %eax,%eax
+ ac4:	79 0a                	jns    ad0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ ac6:	c9                   	leave
+ ac7:	c3                   	ret
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+ ad0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	ff 75 f4             	push   -0xc(%ebp)
+ ad9:	e8 22 fe ff ff       	call   900 <free>
+ ade:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ae1:	83 c4 10             	add    $0x10,%esp
+}
+ ae4:	c9                   	leave
+ ae5:	c3                   	ret
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ af3:	8b 45 08             	mov    0x8(%ebp),%eax
+ af6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ afc:	5d                   	pop    %ebp
+ afd:	c3                   	ret
+ afe:	66 90                	xchg   %ax,%ax
+
+00000b00 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ b00:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ b01:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b06:	89 e5                	mov    %esp,%ebp
+ b08:	8b 55 08             	mov    0x8(%ebp),%edx
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+ b10:	89 c8                	mov    %ecx,%eax
+ b12:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ b15:	85 c0                	test   %eax,%eax
+ b17:	75 f7                	jne    b10 <lock_acquire+0x10>
+    ;
+}
+ b19:	5d                   	pop    %ebp
+ b1a:	c3                   	ret
+ b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+
+00000b20 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ b20:	55                   	push   %ebp
+ b21:	31 c0                	xor    %eax,%eax
+ b23:	89 e5                	mov    %esp,%ebp
+ b25:	8b 55 08             	mov    0x8(%ebp),%edx
+ b28:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ b2b:	5d                   	pop    %ebp
+ b2c:	c3                   	ret
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ b33:	8b 45 08             	mov    0x8(%ebp),%eax
+ b36:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b3c:	5d                   	pop    %ebp
+ b3d:	c3                   	ret
+ b3e:	66 90                	xchg   %ax,%ax
+
+00000b40 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b40:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ b41:	31 c0                	xor    %eax,%eax
+ b43:	ba 01 00 00 00       	mov    $0x1,%edx
+ b48:	89 e5                	mov    %esp,%ebp
+ b4a:	56                   	push   %esi
+ b4b:	53                   	push   %ebx
+ b4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b4f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ b53:	85 c0                	test   %eax,%eax
+ b55:	74 30                	je     b87 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ b57:	83 f8 02             	cmp    $0x2,%eax
+ b5a:	74 0c                	je     b68 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ b5c:	b8 02 00 00 00       	mov    $0x2,%eax
+ b61:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ b64:	85 c0                	test   %eax,%eax
+ b66:	74 1f                	je     b87 <mutex_lock+0x47>
+ b68:	be 02 00 00 00       	mov    $0x2,%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ b70:	83 ec 08             	sub    $0x8,%esp
+ b73:	6a 02                	push   $0x2
+ b75:	53                   	push   %ebx
+ b76:	e8 18 fa ff ff       	call   593 <futex_wait>
+ b7b:	89 f0                	mov    %esi,%eax
+ b7d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b80:	83 c4 10             	add    $0x10,%esp
+ b83:	85 c0                	test   %eax,%eax
+ b85:	75 e9                	jne    b70 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ b87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b8a:	5b                   	pop    %ebx
+ b8b:	5e                   	pop    %esi
+ b8c:	5d                   	pop    %ebp
+ b8d:	c3                   	ret
+ b8e:	66 90                	xchg   %ax,%ax
+
+00000b90 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b90:	55                   	push   %ebp
+ b91:	31 c0                	xor    %eax,%eax
+ b93:	89 e5                	mov    %esp,%ebp
+ b95:	83 ec 08             	sub    $0x8,%esp
+ b98:	8b 55 08             	mov    0x8(%ebp),%edx
+ b9b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ b9e:	83 f8 02             	cmp    $0x2,%eax
+ ba1:	74 05                	je     ba8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ ba3:	c9                   	leave
+ ba4:	c3                   	ret
+ ba5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ ba8:	83 ec 08             	sub    $0x8,%esp
+ bab:	6a 01                	push   $0x1
+ bad:	52                   	push   %edx
+ bae:	e8 e8 f9 ff ff       	call   59b <futex_wake>
+ bb3:	83 c4 10             	add    $0x10,%esp
+}
+ bb6:	c9                   	leave
+ bb7:	c3                   	ret
+ bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+
+00000bc0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ bc6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ bcc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ bd3:	5d                   	pop    %ebp
+ bd4:	c3                   	ret
+ bd5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+ be9:	8b 75 08             	mov    0x8(%ebp),%esi
+ bec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ bef:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ bf4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ bf6:	8b 3e                	mov    (%esi),%edi
+ bf8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ bfb:	83 f8 02             	cmp    $0x2,%eax
+ bfe:	74 60                	je     c60 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ c00:	83 ec 08             	sub    $0x8,%esp
+ c03:	57                   	push   %edi
+ c04:	56                   	push   %esi
+ c05:	e8 89 f9 ff ff       	call   593 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ c0a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ c0f:	31 c0                	xor    %eax,%eax
+ c11:	ba 01 00 00 00       	mov    $0x1,%edx
+ c16:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ c1a:	83 c4 10             	add    $0x10,%esp
+ c1d:	85 c0                	test   %eax,%eax
+ c1f:	74 36                	je     c57 <cond_wait+0x77>
+  if(c != 2)
+ c21:	83 f8 02             	cmp    $0x2,%eax
+ c24:	74 0c                	je     c32 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ c26:	b8 02 00 00 00       	mov    $0x2,%eax
+ c2b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c2e:	85 c0                	test   %eax,%eax
+ c30:	74 25                	je     c57 <cond_wait+0x77>
+ c32:	be 02 00 00 00       	mov    $0x2,%esi
+ c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ c40:	83 ec 08             	sub    $0x8,%esp
+ c43:	6a 02                	push   $0x2
+ c45:	53                   	push   %ebx
+ c46:	e8 48 f9 ff ff       	call   593 <futex_wait>
+ c4b:	89 f0                	mov    %esi,%eax
+ c4d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c50:	83 c4 10             	add    $0x10,%esp
+ c53:	85 c0                	test   %eax,%eax
+ c55:	75 e9                	jne    c40 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ c57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c5a:	5b                   	pop    %ebx
+ c5b:	5e                   	pop    %esi
+ c5c:	5f                   	pop    %edi
+ c5d:	5d                   	pop    %ebp
+ c5e:	c3                   	ret
+ c5f:	90                   	nop
+    futex_wake(&m->val, 1);
+ c60:	83 ec 08             	sub    $0x8,%esp
+ c63:	6a 01                	push   $0x1
+ c65:	53                   	push   %ebx
+ c66:	e8 30 f9 ff ff       	call   59b <futex_wake>
+ c6b:	83 c4 10             	add    $0x10,%esp
+ c6e:	eb 90                	jmp    c00 <cond_wait+0x20>
+
+00000c70 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	83 ec 08             	sub    $0x8,%esp
+ c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c79:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c7d:	8b 50 04             	mov    0x4(%eax),%edx
+ c80:	85 d2                	test   %edx,%edx
+ c82:	75 0c                	jne    c90 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ c84:	c9                   	leave
+ c85:	c3                   	ret
+ c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ c90:	83 ec 08             	sub    $0x8,%esp
+ c93:	6a 01                	push   $0x1
+ c95:	50                   	push   %eax
+ c96:	e8 00 f9 ff ff       	call   59b <futex_wake>
+ c9b:	83 c4 10             	add    $0x10,%esp
+}
+ c9e:	c9                   	leave
+ c9f:	c3                   	ret
+
+00000ca0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	83 ec 08             	sub    $0x8,%esp
+ ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ ca9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ cad:	8b 50 04             	mov    0x4(%eax),%edx
+ cb0:	85 d2                	test   %edx,%edx
+ cb2:	75 0c                	jne    cc0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ cb4:	c9                   	leave
+ cb5:	c3                   	ret
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ cc0:	83 ec 08             	sub    $0x8,%esp
+ cc3:	68 ff ff ff 7f       	push   $0x7fffffff
+ cc8:	50                   	push   %eax
+ cc9:	e8 cd f8 ff ff       	call   59b <futex_wake>
+ cce:	83 c4 10             	add    $0x10,%esp
+}
+ cd1:	c9                   	leave
+ cd2:	c3                   	ret
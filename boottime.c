@@ -0,0 +1,63 @@
+// Print the kernel's boot timeline: when each phase of
+// booting ended and how long it took, in microseconds.
+// usage: boottime
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "time.h"
+
+#define NPHASE 32
+
+struct bootphase bp[NPHASE];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  uint prev;
+
+  n = boottimes(bp, NPHASE);
+  if(n < 0){
+    printf(2, "boottime: boottimes failed\n");
+    exit();
+  }
+  col("PHASE", 16);
+  col("END", 12);
+  printf(1, "TOOK\n");
+  prev = 0;
+  for(i = 0; i < n; i++){
+    col(bp[i].name, 16);
+    coln(bp[i].usec, 12);
+    coln(bp[i].usec - prev, 0);
+    printf(1, "\n");
+    prev = bp[i].usec;
+  }
+  exit();
+}
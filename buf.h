@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  int chain;        // hash chain it is on, or -1
+  int used;         // looked up since the clock hand last passed
+  int hot;          // in the hot set, not on probation
+  int ahead;        // read ahead, and not looked up since
+  struct buf *next; // hash chain, or free list
   struct buf *qnext; // disk queue
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // disk driver releases buffer when done
 
@@ -0,0 +1,1832 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 34 03 00 00       	call   37b <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 38 03 00 00       	call   393 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 87 0b 00 00       	push   $0xb87
+  6c:	6a 01                	push   $0x1
+  6e:	e8 ed 04 00 00       	call   560 <printf>
+      exit();
+  73:	e8 db 02 00 00       	call   353 <exit>
+  }
+  exit();
+  78:	e8 d6 02 00 00       	call   353 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 c7 02 00 00       	call   353 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 c0 10 00 00       	push   $0x10c0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 c3 02 00 00       	call   373 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 c0 10 00 00       	push   $0x10c0
+  c4:	56                   	push   %esi
+  c5:	e8 a1 02 00 00       	call   36b <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 64 0b 00 00       	push   $0xb64
+  e4:	6a 01                	push   $0x1
+  e6:	e8 75 04 00 00       	call   560 <printf>
+      exit();
+  eb:	e8 63 02 00 00       	call   353 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 76 0b 00 00       	push   $0xb76
+  f7:	6a 01                	push   $0x1
+  f9:	e8 62 04 00 00       	call   560 <printf>
+    exit();
+  fe:	e8 50 02 00 00       	call   353 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 1e 01 00 00       	call   36b <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 f1 00 00 00       	call   393 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 f4 00 00 00       	call   3ab <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 ba 00 00 00       	call   37b <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+
+0000034b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <exit>:
+SYSCALL(exit)
+ 353:	b8 02 00 00 00       	mov    $0x2,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <wait>:
+SYSCALL(wait)
+ 35b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <pipe>:
+SYSCALL(pipe)
+ 363:	b8 04 00 00 00       	mov    $0x4,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <read>:
+SYSCALL(read)
+ 36b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <write>:
+SYSCALL(write)
+ 373:	b8 10 00 00 00       	mov    $0x10,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <close>:
+SYSCALL(close)
+ 37b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <kill>:
+SYSCALL(kill)
+ 383:	b8 06 00 00 00       	mov    $0x6,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <exec>:
+SYSCALL(exec)
+ 38b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <open>:
+SYSCALL(open)
+ 393:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mknod>:
+SYSCALL(mknod)
+ 39b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <unlink>:
+SYSCALL(unlink)
+ 3a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <fstat>:
+SYSCALL(fstat)
+ 3ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <link>:
+SYSCALL(link)
+ 3b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mkdir>:
+SYSCALL(mkdir)
+ 3bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <chdir>:
+SYSCALL(chdir)
+ 3c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <dup>:
+SYSCALL(dup)
+ 3cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getpid>:
+SYSCALL(getpid)
+ 3d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <sbrk>:
+SYSCALL(sbrk)
+ 3db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <sleep>:
+SYSCALL(sleep)
+ 3e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <uptime>:
+SYSCALL(uptime)
+ 3eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <add_dir>:
+SYSCALL(add_dir)
+ 3f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <history>:
+SYSCALL(history)
+ 3fb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 403:	b8 19 00 00 00       	mov    $0x19,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <nanosleep>:
+SYSCALL(nanosleep)
+ 40b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <clone>:
+SYSCALL(clone)
+ 413:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <join>:
+SYSCALL(join)
+ 41b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <futex_wait>:
+SYSCALL(futex_wait)
+ 423:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <futex_wake>:
+SYSCALL(futex_wake)
+ 42b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 433:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 43b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 443:	b8 21 00 00 00       	mov    $0x21,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 44b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <waitpid>:
+SYSCALL(waitpid)
+ 453:	b8 23 00 00 00       	mov    $0x23,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <tracectl>:
+SYSCALL(tracectl)
+ 45b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <traceread>:
+SYSCALL(traceread)
+ 463:	b8 25 00 00 00       	mov    $0x25,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 46b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 473:	b8 27 00 00 00       	mov    $0x27,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 47b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <irqroute>:
+SYSCALL(irqroute)
+ 483:	b8 29 00 00 00       	mov    $0x29,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <irqstat>:
+SYSCALL(irqstat)
+ 48b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <boottimes>:
+SYSCALL(boottimes)
+ 493:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <lockbench>:
+SYSCALL(lockbench)
+ 49b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <lockstat>:
+SYSCALL(lockstat)
+ 4a3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <cpustat>:
+SYSCALL(cpustat)
+ 4ab:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <bcachesize>:
+SYSCALL(bcachesize)
+ 4b3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+ 4bb:	66 90                	xchg   %ax,%ax
+ 4bd:	66 90                	xchg   %ax,%ax
+ 4bf:	90                   	nop
+
+000004c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4c8:	89 d1                	mov    %edx,%ecx
+{
+ 4ca:	83 ec 3c             	sub    $0x3c,%esp
+ 4cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4d0:	85 d2                	test   %edx,%edx
+ 4d2:	0f 89 80 00 00 00    	jns    558 <printint+0x98>
+ 4d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4dc:	74 7a                	je     558 <printint+0x98>
+    x = -xx;
+ 4de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4e8:	31 f6                	xor    %esi,%esi
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4f0:	89 c8                	mov    %ecx,%eax
+ 4f2:	31 d2                	xor    %edx,%edx
+ 4f4:	89 f7                	mov    %esi,%edi
+ 4f6:	f7 f3                	div    %ebx
+ 4f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4fb:	0f b6 92 fc 0b 00 00 	movzbl 0xbfc(%edx),%edx
+ 502:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 506:	89 ca                	mov    %ecx,%edx
+ 508:	89 c1                	mov    %eax,%ecx
+ 50a:	39 da                	cmp    %ebx,%edx
+ 50c:	73 e2                	jae    4f0 <printint+0x30>
+  if(neg)
+ 50e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 511:	85 c0                	test   %eax,%eax
+ 513:	74 07                	je     51c <printint+0x5c>
+    buf[i++] = '-';
+ 515:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 51a:	89 f7                	mov    %esi,%edi
+ 51c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 51f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 522:	01 df                	add    %ebx,%edi
+ 524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 528:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 52b:	83 ec 04             	sub    $0x4,%esp
+ 52e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 531:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 534:	6a 01                	push   $0x1
+ 536:	50                   	push   %eax
+ 537:	56                   	push   %esi
+ 538:	e8 36 fe ff ff       	call   373 <write>
+  while(--i >= 0)
+ 53d:	89 f8                	mov    %edi,%eax
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	83 ef 01             	sub    $0x1,%edi
+ 545:	39 d8                	cmp    %ebx,%eax
+ 547:	75 df                	jne    528 <printint+0x68>
+}
+ 549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54c:	5b                   	pop    %ebx
+ 54d:	5e                   	pop    %esi
+ 54e:	5f                   	pop    %edi
+ 54f:	5d                   	pop    %ebp
+ 550:	c3                   	ret
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 558:	31 c0                	xor    %eax,%eax
+ 55a:	eb 89                	jmp    4e5 <printint+0x25>
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 569:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 56c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 56f:	0f b6 1e             	movzbl (%esi),%ebx
+ 572:	83 c6 01             	add    $0x1,%esi
+ 575:	84 db                	test   %bl,%bl
+ 577:	74 67                	je     5e0 <printf+0x80>
+ 579:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 57c:	31 d2                	xor    %edx,%edx
+ 57e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 581:	eb 34                	jmp    5b7 <printf+0x57>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 58b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 590:	83 f8 25             	cmp    $0x25,%eax
+ 593:	74 18                	je     5ad <printf+0x4d>
+  write(fd, &c, 1);
+ 595:	83 ec 04             	sub    $0x4,%esp
+ 598:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 59b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59e:	6a 01                	push   $0x1
+ 5a0:	50                   	push   %eax
+ 5a1:	57                   	push   %edi
+ 5a2:	e8 cc fd ff ff       	call   373 <write>
+ 5a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 5b0:	83 c6 01             	add    $0x1,%esi
+ 5b3:	84 db                	test   %bl,%bl
+ 5b5:	74 29                	je     5e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ba:	85 d2                	test   %edx,%edx
+ 5bc:	74 ca                	je     588 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5be:	83 fa 25             	cmp    $0x25,%edx
+ 5c1:	75 ea                	jne    5ad <printf+0x4d>
+      if(c == 'd'){
+ 5c3:	83 f8 25             	cmp    $0x25,%eax
+ 5c6:	0f 84 24 01 00 00    	je     6f0 <printf+0x190>
+ 5cc:	83 e8 63             	sub    $0x63,%eax
+ 5cf:	83 f8 15             	cmp    $0x15,%eax
+ 5d2:	77 1c                	ja     5f0 <printf+0x90>
+ 5d4:	ff 24 85 a4 0b 00 00 	jmp    *0xba4(,%eax,4)
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5e3:	5b                   	pop    %ebx
+ 5e4:	5e                   	pop    %esi
+ 5e5:	5f                   	pop    %edi
+ 5e6:	5d                   	pop    %ebp
+ 5e7:	c3                   	ret
+ 5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5fa:	6a 01                	push   $0x1
+ 5fc:	52                   	push   %edx
+ 5fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 600:	57                   	push   %edi
+ 601:	e8 6d fd ff ff       	call   373 <write>
+ 606:	83 c4 0c             	add    $0xc,%esp
+ 609:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60c:	6a 01                	push   $0x1
+ 60e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 611:	52                   	push   %edx
+ 612:	57                   	push   %edi
+ 613:	e8 5b fd ff ff       	call   373 <write>
+        putc(fd, c);
+ 618:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61b:	31 d2                	xor    %edx,%edx
+ 61d:	eb 8e                	jmp    5ad <printf+0x4d>
+ 61f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 00                	push   $0x0
+ 62f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 631:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 634:	e8 87 fe ff ff       	call   4c0 <printint>
+        ap++;
+ 639:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 63c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 67 ff ff ff       	jmp    5ad <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 650:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 653:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 655:	83 c0 04             	add    $0x4,%eax
+ 658:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 65b:	85 db                	test   %ebx,%ebx
+ 65d:	0f 84 9d 00 00 00    	je     700 <printf+0x1a0>
+        while(*s != 0){
+ 663:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 666:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 668:	84 c0                	test   %al,%al
+ 66a:	0f 84 3d ff ff ff    	je     5ad <printf+0x4d>
+ 670:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 673:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 676:	89 de                	mov    %ebx,%esi
+ 678:	89 d3                	mov    %edx,%ebx
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 686:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	53                   	push   %ebx
+ 68c:	57                   	push   %edi
+ 68d:	e8 e1 fc ff ff       	call   373 <write>
+        while(*s != 0){
+ 692:	0f b6 06             	movzbl (%esi),%eax
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	84 c0                	test   %al,%al
+ 69a:	75 e4                	jne    680 <printf+0x120>
+      state = 0;
+ 69c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 07 ff ff ff       	jmp    5ad <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	e9 6b ff ff ff       	jmp    62f <printf+0xcf>
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	52                   	push   %edx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 91 fc ff ff       	call   373 <write>
+        ap++;
+ 6e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e8:	31 d2                	xor    %edx,%edx
+ 6ea:	e9 be fe ff ff       	jmp    5ad <printf+0x4d>
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	e9 11 ff ff ff       	jmp    611 <printf+0xb1>
+ 700:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 705:	bb 9c 0b 00 00       	mov    $0xb9c,%ebx
+ 70a:	e9 61 ff ff ff       	jmp    670 <printf+0x110>
+ 70f:	90                   	nop
+
+00000710 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 710:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 711:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 714:	89 e5                	mov    %esp,%ebp
+ 716:	57                   	push   %edi
+ 717:	56                   	push   %esi
+ 718:	53                   	push   %ebx
+ 719:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 71b:	a1 c4 12 00 00       	mov    0x12c4,%eax
+ 720:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 722:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 724:	39 ca                	cmp    %ecx,%edx
+ 726:	73 30                	jae    758 <ufree+0x48>
+ 728:	39 c1                	cmp    %eax,%ecx
+ 72a:	72 04                	jb     730 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 72c:	39 c2                	cmp    %eax,%edx
+ 72e:	72 f0                	jb     720 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 730:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 733:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 736:	39 f8                	cmp    %edi,%eax
+ 738:	74 26                	je     760 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 73a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 73d:	8b 42 04             	mov    0x4(%edx),%eax
+ 740:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 743:	39 f1                	cmp    %esi,%ecx
+ 745:	74 30                	je     777 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 747:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 749:	5b                   	pop    %ebx
+  freep = p;
+ 74a:	89 15 c4 12 00 00    	mov    %edx,0x12c4
+}
+ 750:	5e                   	pop    %esi
+ 751:	5f                   	pop    %edi
+ 752:	5d                   	pop    %ebp
+ 753:	c3                   	ret
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 758:	39 c1                	cmp    %eax,%ecx
+ 75a:	72 d0                	jb     72c <ufree+0x1c>
+ 75c:	eb c2                	jmp    720 <ufree+0x10>
+ 75e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 760:	03 70 04             	add    0x4(%eax),%esi
+ 763:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 766:	8b 02                	mov    (%edx),%eax
+ 768:	8b 00                	mov    (%eax),%eax
+ 76a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 76d:	8b 42 04             	mov    0x4(%edx),%eax
+ 770:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 773:	39 f1                	cmp    %esi,%ecx
+ 775:	75 d0                	jne    747 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 777:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 77a:	89 15 c4 12 00 00    	mov    %edx,0x12c4
+    p->s.size += bp->s.size;
+ 780:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 783:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 786:	89 0a                	mov    %ecx,(%edx)
+}
+ 788:	5b                   	pop    %ebx
+ 789:	5e                   	pop    %esi
+ 78a:	5f                   	pop    %edi
+ 78b:	5d                   	pop    %ebp
+ 78c:	c3                   	ret
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000790 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	53                   	push   %ebx
+ 794:	83 ec 10             	sub    $0x10,%esp
+ 797:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 79a:	68 c0 12 00 00       	push   $0x12c0
+ 79f:	e8 ec 01 00 00       	call   990 <lock_acquire>
+  ufree(ap);
+ 7a4:	89 d8                	mov    %ebx,%eax
+ 7a6:	e8 65 ff ff ff       	call   710 <ufree>
+  lock_release(&mlock);
+ 7ab:	c7 45 08 c0 12 00 00 	movl   $0x12c0,0x8(%ebp)
+}
+ 7b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 7b5:	83 c4 10             	add    $0x10,%esp
+}
+ 7b8:	c9                   	leave
+  lock_release(&mlock);
+ 7b9:	e9 f2 01 00 00       	jmp    9b0 <lock_release>
+ 7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 7cc:	68 c0 12 00 00       	push   $0x12c0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d1:	8d 48 07             	lea    0x7(%eax),%ecx
+ 7d4:	c1 e9 03             	shr    $0x3,%ecx
+ 7d7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 7da:	e8 b1 01 00 00       	call   990 <lock_acquire>
+  if((prevp = freep) == 0){
+ 7df:	8b 15 c4 12 00 00    	mov    0x12c4,%edx
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	85 d2                	test   %edx,%edx
+ 7ea:	0f 84 b0 00 00 00    	je     8a0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 7f2:	8b 47 04             	mov    0x4(%edi),%eax
+ 7f5:	39 f0                	cmp    %esi,%eax
+ 7f7:	73 6f                	jae    868 <malloc+0xa8>
+  if(nu < 4096)
+ 7f9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7fe:	39 de                	cmp    %ebx,%esi
+ 800:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 803:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 80a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 80d:	eb 0a                	jmp    819 <malloc+0x59>
+ 80f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 812:	8b 47 04             	mov    0x4(%edi),%eax
+ 815:	39 f0                	cmp    %esi,%eax
+ 817:	73 4f                	jae    868 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 819:	89 fa                	mov    %edi,%edx
+ 81b:	39 3d c4 12 00 00    	cmp    %edi,0x12c4
+ 821:	75 ed                	jne    810 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	ff 75 e4             	push   -0x1c(%ebp)
+ 829:	e8 ad fb ff ff       	call   3db <sbrk>
+  if(p == (char*)-1)
+ 82e:	83 c4 10             	add    $0x10,%esp
+ 831:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 834:	74 15                	je     84b <malloc+0x8b>
+  hp->s.size = nu;
+ 836:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 839:	83 c0 08             	add    $0x8,%eax
+ 83c:	e8 cf fe ff ff       	call   710 <ufree>
+  return freep;
+ 841:	8b 15 c4 12 00 00    	mov    0x12c4,%edx
+      if((p = morecore(nunits)) == 0){
+ 847:	85 d2                	test   %edx,%edx
+ 849:	75 c5                	jne    810 <malloc+0x50>
+        lock_release(&mlock);
+ 84b:	83 ec 0c             	sub    $0xc,%esp
+ 84e:	68 c0 12 00 00       	push   $0x12c0
+ 853:	e8 58 01 00 00       	call   9b0 <lock_release>
+        return 0;
+ 858:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 85b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 85e:	31 c0                	xor    %eax,%eax
+}
+ 860:	5b                   	pop    %ebx
+ 861:	5e                   	pop    %esi
+ 862:	5f                   	pop    %edi
+ 863:	5d                   	pop    %ebp
+ 864:	c3                   	ret
+ 865:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 868:	39 c6                	cmp    %eax,%esi
+ 86a:	74 64                	je     8d0 <malloc+0x110>
+        p->s.size -= nunits;
+ 86c:	29 f0                	sub    %esi,%eax
+ 86e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 871:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 874:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 877:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 87a:	89 15 c4 12 00 00    	mov    %edx,0x12c4
+      lock_release(&mlock);
+ 880:	68 c0 12 00 00       	push   $0x12c0
+ 885:	e8 26 01 00 00       	call   9b0 <lock_release>
+      return (void*)(p + 1);
+ 88a:	83 c4 10             	add    $0x10,%esp
+}
+ 88d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 890:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 893:	5b                   	pop    %ebx
+ 894:	5e                   	pop    %esi
+ 895:	5f                   	pop    %edi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 8a0:	c7 05 c4 12 00 00 c8 	movl   $0x12c8,0x12c4
+ 8a7:	12 00 00 
+    base.s.size = 0;
+ 8aa:	bf c8 12 00 00       	mov    $0x12c8,%edi
+    base.s.ptr = freep = prevp = &base;
+ 8af:	c7 05 c8 12 00 00 c8 	movl   $0x12c8,0x12c8
+ 8b6:	12 00 00 
+    base.s.size = 0;
+ 8b9:	c7 05 cc 12 00 00 00 	movl   $0x0,0x12cc
+ 8c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8c3:	e9 31 ff ff ff       	jmp    7f9 <malloc+0x39>
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8d0:	8b 07                	mov    (%edi),%eax
+ 8d2:	89 02                	mov    %eax,(%edx)
+ 8d4:	eb a1                	jmp    877 <malloc+0xb7>
+ 8d6:	66 90                	xchg   %ax,%ax
+ 8d8:	66 90                	xchg   %ax,%ax
+ 8da:	66 90                	xchg   %ax,%ax
+ 8dc:	66 90                	xchg   %ax,%ax
+ 8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	53                   	push   %ebx
+ 8e4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 8e7:	68 00 10 00 00       	push   $0x1000
+ 8ec:	e8 cf fe ff ff       	call   7c0 <malloc>
+ 8f1:	83 c4 10             	add    $0x10,%esp
+ 8f4:	85 c0                	test   %eax,%eax
+ 8f6:	74 37                	je     92f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 8f8:	83 ec 04             	sub    $0x4,%esp
+ 8fb:	89 c3                	mov    %eax,%ebx
+ 8fd:	50                   	push   %eax
+ 8fe:	ff 75 0c             	push   0xc(%ebp)
+ 901:	ff 75 08             	push   0x8(%ebp)
+ 904:	e8 0a fb ff ff       	call   413 <clone>
+ 909:	83 c4 10             	add    $0x10,%esp
+ 90c:	85 c0                	test   %eax,%eax
+ 90e:	78 08                	js     918 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 910:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 913:	c9                   	leave
+ 914:	c3                   	ret
+ 915:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 918:	83 ec 0c             	sub    $0xc,%esp
+ 91b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 91e:	53                   	push   %ebx
+ 91f:	e8 6c fe ff ff       	call   790 <free>
+ 924:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 92a:	83 c4 10             	add    $0x10,%esp
+}
+ 92d:	c9                   	leave
+ 92e:	c3                   	ret
+    return -1;
+ 92f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 934:	eb da                	jmp    910 <thread_create+0x30>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 946:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 949:	50                   	push   %eax
+ 94a:	e8 cc fa ff ff       	call   41b <join>
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	85 c0                	test   %eax,%eax
+ 954:	79 0a                	jns    960 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 956:	c9                   	leave
+ 957:	c3                   	ret
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+ 960:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	ff 75 f4             	push   -0xc(%ebp)
+ 969:	e8 22 fe ff ff       	call   790 <free>
+ 96e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 971:	83 c4 10             	add    $0x10,%esp
+}
+ 974:	c9                   	leave
+ 975:	c3                   	ret
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 983:	8b 45 08             	mov    0x8(%ebp),%eax
+ 986:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 98c:	5d                   	pop    %ebp
+ 98d:	c3                   	ret
+ 98e:	66 90                	xchg   %ax,%ax
+
+00000990 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 990:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 991:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	8b 55 08             	mov    0x8(%ebp),%edx
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+ 9a0:	89 c8                	mov    %ecx,%eax
+ 9a2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 9a5:	85 c0                	test   %eax,%eax
+ 9a7:	75 f7                	jne    9a0 <lock_acquire+0x10>
+    ;
+}
+ 9a9:	5d                   	pop    %ebp
+ 9aa:	c3                   	ret
+ 9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+
+000009b0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	31 c0                	xor    %eax,%eax
+ 9b3:	89 e5                	mov    %esp,%ebp
+ 9b5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9b8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 9bb:	5d                   	pop    %ebp
+ 9bc:	c3                   	ret
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9cc:	5d                   	pop    %ebp
+ 9cd:	c3                   	ret
+ 9ce:	66 90                	xchg   %ax,%ax
+
+000009d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9d0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 9d1:	31 c0                	xor    %eax,%eax
+ 9d3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9d8:	89 e5                	mov    %esp,%ebp
+ 9da:	56                   	push   %esi
+ 9db:	53                   	push   %ebx
+ 9dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 9e3:	85 c0                	test   %eax,%eax
+ 9e5:	74 30                	je     a17 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 9e7:	83 f8 02             	cmp    $0x2,%eax
+ 9ea:	74 0c                	je     9f8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 9ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 9f4:	85 c0                	test   %eax,%eax
+ 9f6:	74 1f                	je     a17 <mutex_lock+0x47>
+ 9f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ a00:	83 ec 08             	sub    $0x8,%esp
+ a03:	6a 02                	push   $0x2
+ a05:	53                   	push   %ebx
+ a06:	e8 18 fa ff ff       	call   423 <futex_wait>
+ a0b:	89 f0                	mov    %esi,%eax
+ a0d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a10:	83 c4 10             	add    $0x10,%esp
+ a13:	85 c0                	test   %eax,%eax
+ a15:	75 e9                	jne    a00 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a1a:	5b                   	pop    %ebx
+ a1b:	5e                   	pop    %esi
+ a1c:	5d                   	pop    %ebp
+ a1d:	c3                   	ret
+ a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a20:	55                   	push   %ebp
+ a21:	31 c0                	xor    %eax,%eax
+ a23:	89 e5                	mov    %esp,%ebp
+ a25:	83 ec 08             	sub    $0x8,%esp
+ a28:	8b 55 08             	mov    0x8(%ebp),%edx
+ a2b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ a2e:	83 f8 02             	cmp    $0x2,%eax
+ a31:	74 05                	je     a38 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ a33:	c9                   	leave
+ a34:	c3                   	ret
+ a35:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ a38:	83 ec 08             	sub    $0x8,%esp
+ a3b:	6a 01                	push   $0x1
+ a3d:	52                   	push   %edx
+ a3e:	e8 e8 f9 ff ff       	call   42b <futex_wake>
+ a43:	83 c4 10             	add    $0x10,%esp
+}
+ a46:	c9                   	leave
+ a47:	c3                   	ret
+ a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+
+00000a50 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ a56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ a5c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a63:	5d                   	pop    %ebp
+ a64:	c3                   	ret
+ a65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 0c             	sub    $0xc,%esp
+ a79:	8b 75 08             	mov    0x8(%ebp),%esi
+ a7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ a7f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ a84:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ a86:	8b 3e                	mov    (%esi),%edi
+ a88:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ a8b:	83 f8 02             	cmp    $0x2,%eax
+ a8e:	74 60                	je     af0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ a90:	83 ec 08             	sub    $0x8,%esp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	e8 89 f9 ff ff       	call   423 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ a9a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ a9f:	31 c0                	xor    %eax,%eax
+ aa1:	ba 01 00 00 00       	mov    $0x1,%edx
+ aa6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ aaa:	83 c4 10             	add    $0x10,%esp
+ aad:	85 c0                	test   %eax,%eax
+ aaf:	74 36                	je     ae7 <cond_wait+0x77>
+  if(c != 2)
+ ab1:	83 f8 02             	cmp    $0x2,%eax
+ ab4:	74 0c                	je     ac2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ ab6:	b8 02 00 00 00       	mov    $0x2,%eax
+ abb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ abe:	85 c0                	test   %eax,%eax
+ ac0:	74 25                	je     ae7 <cond_wait+0x77>
+ ac2:	be 02 00 00 00       	mov    $0x2,%esi
+ ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ace:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ ad0:	83 ec 08             	sub    $0x8,%esp
+ ad3:	6a 02                	push   $0x2
+ ad5:	53                   	push   %ebx
+ ad6:	e8 48 f9 ff ff       	call   423 <futex_wait>
+ adb:	89 f0                	mov    %esi,%eax
+ add:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ ae0:	83 c4 10             	add    $0x10,%esp
+ ae3:	85 c0                	test   %eax,%eax
+ ae5:	75 e9                	jne    ad0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ ae7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aea:	5b                   	pop    %ebx
+ aeb:	5e                   	pop    %esi
+ aec:	5f                   	pop    %edi
+ aed:	5d                   	pop    %ebp
+ aee:	c3                   	ret
+ aef:	90                   	nop
+    futex_wake(&m->val, 1);
+ af0:	83 ec 08             	sub    $0x8,%esp
+ af3:	6a 01                	push   $0x1
+ af5:	53                   	push   %ebx
+ af6:	e8 30 f9 ff ff       	call   42b <futex_wake>
+ afb:	83 c4 10             	add    $0x10,%esp
+ afe:	eb 90                	jmp    a90 <cond_wait+0x20>
+
+00000b00 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	83 ec 08             	sub    $0x8,%esp
+ b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ b09:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ b0d:	8b 50 04             	mov    0x4(%eax),%edx
+ b10:	85 d2                	test   %edx,%edx
+ b12:	75 0c                	jne    b20 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ b14:	c9                   	leave
+ b15:	c3                   	ret
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ b20:	83 ec 08             	sub    $0x8,%esp
+ b23:	6a 01                	push   $0x1
+ b25:	50                   	push   %eax
+ b26:	e8 00 f9 ff ff       	call   42b <futex_wake>
+ b2b:	83 c4 10             	add    $0x10,%esp
+}
+ b2e:	c9                   	leave
+ b2f:	c3                   	ret
+
+00000b30 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	83 ec 08             	sub    $0x8,%esp
+ b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ b39:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ b3d:	8b 50 04             	mov    0x4(%eax),%edx
+ b40:	85 d2                	test   %edx,%edx
+ b42:	75 0c                	jne    b50 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ b44:	c9                   	leave
+ b45:	c3                   	ret
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ b50:	83 ec 08             	sub    $0x8,%esp
+ b53:	68 ff ff ff 7f       	push   $0x7fffffff
+ b58:	50                   	push   %eax
+ b59:	e8 cd f8 ff ff       	call   42b <futex_wake>
+ b5e:	83 c4 10             	add    $0x10,%esp
+}
+ b61:	c9                   	leave
+ b62:	c3                   	ret
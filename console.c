@@ -437,6 +437,6 @@ consoleinit(void)
   cons.locking = 1;
 
   picenable(IRQ_KBD);
-  ioapicenable(IRQ_KBD, 0);
+  ioapicenable(IRQ_KBD, IRQ_ANYCPU);
 }
 
@@ -1,22 +1,39 @@
+struct bootphase;
 struct buf;
 struct context;
+struct cpustat;
+struct dlstat;
+struct fdtable;
 struct file;
 struct inode;
+struct irqinfo;
+struct lockstat;
 struct pipe;
 struct proc;
+struct rwlock;
+struct procinfo;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceevent;
+struct work;
 
 int add_directory(char *);
 int history(char *, int );
 
+// acpi.c
+int             acpiinit(void);
+
 // bio.c
+int             bcachesize(int);
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
+void            brelseahead(struct buf*);
+int             bshrink(void);
 void            bwrite(struct buf*);
 
 // console.c
@@ -32,6 +49,10 @@ int             exec(char*, char**);
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
+struct fdtable* fdtablealloc(struct inode*);
+struct fdtable* fdtablecopy(struct fdtable*);
+struct fdtable* fdtabledup(struct fdtable*);
+void            fdtableput(struct fdtable*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
@@ -52,6 +73,7 @@ void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
+void            readahead(struct inode*, uint, uint);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
@@ -59,16 +81,21 @@ int             writei(struct inode*, char*, uint, uint);
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
+void            idereadasync(struct buf*);
 void            iderw(struct buf*);
 
 // ioapic.c
-void            ioapicenable(int irq, int cpu);
+void            ioapicenable(int irq, int c);
 extern uchar    ioapicid;
 void            ioapicinit(void);
+void            irqbalance(uint64);
+int             irqroute(int, int);
+int             irqstat(struct irqinfo*, int);
 
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+int             kfreepages(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -80,8 +107,10 @@ void            cmostime(struct rtcdate *r);
 int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicarm(uint64);
 void            lapicinit(void);
-void            lapicstartap(uchar, uint);
+void            lapicipi(uint, int);
+void            lapicstartaps(uint);
 void            microdelay(int);
 
 // log.c
@@ -90,6 +119,10 @@ void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
 
+// main.c
+void            bootphase(char*);
+int             boottimes(struct bootphase*, int);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
@@ -106,18 +139,39 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+void            acct(int);
+int             clone(void(*)(void*), void*, void*);
+int             edfthrottle(void);
+int             edfyield(void);
+int             execvm(pde_t*, uint);
 void            exit(void);
 int             fork(void);
+int             futexwait(uint*, int);
+int             futexwake(uint*, int);
+int             getaffinity(int, uint*);
+int             getdlstat(int, struct dlstat*);
+int             getprocinfo(struct procinfo*, int);
+int             cpustat(struct cpustat*, int);
 int             growproc(int);
+int             isolate(uint);
+uint            isolated(void);
+int             join(void**);
 int             kill(int);
+struct proc*    kthread(char*, void(*)(void*), void*, uint);
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             setdeadline(int, int, int, int);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
+int             waitpid(int, int);
 void            wakeup(void*);
+void            wakeupsync(void*);
+uint64          wakeuptimed(uint64);
+int             sleepuntil(uint64);
 void            yield(void);
 
 // swtch.S
@@ -128,10 +182,31 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            initlockkind(struct spinlock*, char*, int);
+int             lockbench(int, int);
+int             lockclass(char*, int);
+void            lockacquired(int, int, uint64);
+void            lockreleased(int, uint64);
+void            lockspun(int, int);
+int             lockstat(struct lockstat*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// rcu.c
+void            rcucall(struct work*);
+int             rcupending(void);
+void            rcuquiescent(void);
+void            rcureadlock(void);
+void            rcureadunlock(void);
+
+// rwlock.c
+void            acquireread(struct rwlock*);
+void            acquirewrite(struct rwlock*);
+void            initrwlock(struct rwlock*, char*);
+void            releaseread(struct rwlock*);
+void            releasewrite(struct rwlock*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -151,26 +226,40 @@ char*           strncpy(char*, const char*, int);
 #define DIRECTORY_BUFFER 128
 #define NUM_OF_DIRECTORIES_IN_PATH 10
 
-struct {
+// The directories exec searches.  Read under rcureadlock;
+// sys_add_dir replaces the whole table with an updated copy.
+struct pathtable {
   char directories[NUM_OF_DIRECTORIES_IN_PATH][DIRECTORY_BUFFER];
   int num_directories;
-} PATH;
+};
+extern struct pathtable *volatile PATH;
 
 int             argint(int, int*);
 int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
+void            pathinit(void);
 void            syscall(void);
 
 // timer.c
+void            clockarm(uint64);
+void            clockintr(void);
+uint64          nsecs(void);
 void            timerinit(void);
+uint64          tsc2ns(uint64);
+void            tscinit(void);
+extern uint     tsckhz;
+
+// trace.c
+void            trace(int, int, int);
+int             tracectl(int);
+void            traceinit(void);
+int             traceread(struct traceevent*, int);
 
 // trap.c
 void            idtinit(void);
-extern uint     ticks;
 void            tvinit(void);
-extern struct spinlock tickslock;
 
 // uart.c
 void            uartinit(void);
@@ -180,10 +269,12 @@ void            uartputc(int);
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
+void*           kmapphys(uint, uint);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+int             shrinkuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
@@ -192,6 +283,11 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+void            tlbshootdown(pde_t*);
+
+// workq.c
+void            queuework(struct work*);
+void            workinit(void);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1746 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 c4 0a 00 00       	push   $0xac4
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 c6 0a 00 00       	push   $0xac6
+  3e:	6a 01                	push   $0x1
+  40:	e8 7b 04 00 00       	call   4c0 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 cb 0a 00 00       	push   $0xacb
+  55:	50                   	push   %eax
+  56:	68 c6 0a 00 00       	push   $0xac6
+  5b:	6a 01                	push   $0x1
+  5d:	e8 5e 04 00 00       	call   4c0 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 49 02 00 00       	call   2b3 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 1e 01 00 00       	call   2cb <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 f1 00 00 00       	call   2f3 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 f4 00 00 00       	call   30b <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 ba 00 00 00       	call   2db <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+
+000002ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <exit>:
+SYSCALL(exit)
+ 2b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <wait>:
+SYSCALL(wait)
+ 2bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <pipe>:
+SYSCALL(pipe)
+ 2c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <read>:
+SYSCALL(read)
+ 2cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <write>:
+SYSCALL(write)
+ 2d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <close>:
+SYSCALL(close)
+ 2db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <kill>:
+SYSCALL(kill)
+ 2e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <exec>:
+SYSCALL(exec)
+ 2eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <open>:
+SYSCALL(open)
+ 2f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mknod>:
+SYSCALL(mknod)
+ 2fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <unlink>:
+SYSCALL(unlink)
+ 303:	b8 12 00 00 00       	mov    $0x12,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <fstat>:
+SYSCALL(fstat)
+ 30b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <link>:
+SYSCALL(link)
+ 313:	b8 13 00 00 00       	mov    $0x13,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mkdir>:
+SYSCALL(mkdir)
+ 31b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <chdir>:
+SYSCALL(chdir)
+ 323:	b8 09 00 00 00       	mov    $0x9,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <dup>:
+SYSCALL(dup)
+ 32b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getpid>:
+SYSCALL(getpid)
+ 333:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <sbrk>:
+SYSCALL(sbrk)
+ 33b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <sleep>:
+SYSCALL(sleep)
+ 343:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <uptime>:
+SYSCALL(uptime)
+ 34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <add_dir>:
+SYSCALL(add_dir)
+ 353:	b8 16 00 00 00       	mov    $0x16,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <history>:
+SYSCALL(history)
+ 35b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 363:	b8 19 00 00 00       	mov    $0x19,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <nanosleep>:
+SYSCALL(nanosleep)
+ 36b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <clone>:
+SYSCALL(clone)
+ 373:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <join>:
+SYSCALL(join)
+ 37b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <futex_wait>:
+SYSCALL(futex_wait)
+ 383:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <futex_wake>:
+SYSCALL(futex_wake)
+ 38b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 393:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 39b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 3a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getprocinfo>:
+SYSCALL(getprocinfo)
+ 3ab:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <waitpid>:
+SYSCALL(waitpid)
+ 3b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <tracectl>:
+SYSCALL(tracectl)
+ 3bb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <traceread>:
+SYSCALL(traceread)
+ 3c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 3cb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 3d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 3db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <irqroute>:
+SYSCALL(irqroute)
+ 3e3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <irqstat>:
+SYSCALL(irqstat)
+ 3eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <boottimes>:
+SYSCALL(boottimes)
+ 3f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <lockbench>:
+SYSCALL(lockbench)
+ 3fb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <lockstat>:
+SYSCALL(lockstat)
+ 403:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <cpustat>:
+SYSCALL(cpustat)
+ 40b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <bcachesize>:
+SYSCALL(bcachesize)
+ 413:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+ 41b:	66 90                	xchg   %ax,%ax
+ 41d:	66 90                	xchg   %ax,%ax
+ 41f:	90                   	nop
+
+00000420 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	53                   	push   %ebx
+ 426:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 428:	89 d1                	mov    %edx,%ecx
+{
+ 42a:	83 ec 3c             	sub    $0x3c,%esp
+ 42d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 430:	85 d2                	test   %edx,%edx
+ 432:	0f 89 80 00 00 00    	jns    4b8 <printint+0x98>
+ 438:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 43c:	74 7a                	je     4b8 <printint+0x98>
+    x = -xx;
+ 43e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 440:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 445:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 448:	31 f6                	xor    %esi,%esi
+ 44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 450:	89 c8                	mov    %ecx,%eax
+ 452:	31 d2                	xor    %edx,%edx
+ 454:	89 f7                	mov    %esi,%edi
+ 456:	f7 f3                	div    %ebx
+ 458:	8d 76 01             	lea    0x1(%esi),%esi
+ 45b:	0f b6 92 2c 0b 00 00 	movzbl 0xb2c(%edx),%edx
+ 462:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 466:	89 ca                	mov    %ecx,%edx
+ 468:	89 c1                	mov    %eax,%ecx
+ 46a:	39 da                	cmp    %ebx,%edx
+ 46c:	73 e2                	jae    450 <printint+0x30>
+  if(neg)
+ 46e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 471:	85 c0                	test   %eax,%eax
+ 473:	74 07                	je     47c <printint+0x5c>
+    buf[i++] = '-';
+ 475:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 47a:	89 f7                	mov    %esi,%edi
+ 47c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 47f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 482:	01 df                	add    %ebx,%edi
+ 484:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 488:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 48b:	83 ec 04             	sub    $0x4,%esp
+ 48e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 491:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 494:	6a 01                	push   $0x1
+ 496:	50                   	push   %eax
+ 497:	56                   	push   %esi
+ 498:	e8 36 fe ff ff       	call   2d3 <write>
+  while(--i >= 0)
+ 49d:	89 f8                	mov    %edi,%eax
+ 49f:	83 c4 10             	add    $0x10,%esp
+ 4a2:	83 ef 01             	sub    $0x1,%edi
+ 4a5:	39 d8                	cmp    %ebx,%eax
+ 4a7:	75 df                	jne    488 <printint+0x68>
+}
+ 4a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ac:	5b                   	pop    %ebx
+ 4ad:	5e                   	pop    %esi
+ 4ae:	5f                   	pop    %edi
+ 4af:	5d                   	pop    %ebp
+ 4b0:	c3                   	ret
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4b8:	31 c0                	xor    %eax,%eax
+ 4ba:	eb 89                	jmp    445 <printint+0x25>
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 4d2:	83 c6 01             	add    $0x1,%esi
+ 4d5:	84 db                	test   %bl,%bl
+ 4d7:	74 67                	je     540 <printf+0x80>
+ 4d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4dc:	31 d2                	xor    %edx,%edx
+ 4de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4e1:	eb 34                	jmp    517 <printf+0x57>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4f0:	83 f8 25             	cmp    $0x25,%eax
+ 4f3:	74 18                	je     50d <printf+0x4d>
+  write(fd, &c, 1);
+ 4f5:	83 ec 04             	sub    $0x4,%esp
+ 4f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4fe:	6a 01                	push   $0x1
+ 500:	50                   	push   %eax
+ 501:	57                   	push   %edi
+ 502:	e8 cc fd ff ff       	call   2d3 <write>
+ 507:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 50a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 50d:	0f b6 1e             	movzbl (%esi),%ebx
+ 510:	83 c6 01             	add    $0x1,%esi
+ 513:	84 db                	test   %bl,%bl
+ 515:	74 29                	je     540 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 517:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 51a:	85 d2                	test   %edx,%edx
+ 51c:	74 ca                	je     4e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 51e:	83 fa 25             	cmp    $0x25,%edx
+ 521:	75 ea                	jne    50d <printf+0x4d>
+      if(c == 'd'){
+ 523:	83 f8 25             	cmp    $0x25,%eax
+ 526:	0f 84 24 01 00 00    	je     650 <printf+0x190>
+ 52c:	83 e8 63             	sub    $0x63,%eax
+ 52f:	83 f8 15             	cmp    $0x15,%eax
+ 532:	77 1c                	ja     550 <printf+0x90>
+ 534:	ff 24 85 d4 0a 00 00 	jmp    *0xad4(,%eax,4)
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 543:	5b                   	pop    %ebx
+ 544:	5e                   	pop    %esi
+ 545:	5f                   	pop    %edi
+ 546:	5d                   	pop    %ebp
+ 547:	c3                   	ret
+ 548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+  write(fd, &c, 1);
+ 550:	83 ec 04             	sub    $0x4,%esp
+ 553:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 556:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 55a:	6a 01                	push   $0x1
+ 55c:	52                   	push   %edx
+ 55d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 560:	57                   	push   %edi
+ 561:	e8 6d fd ff ff       	call   2d3 <write>
+ 566:	83 c4 0c             	add    $0xc,%esp
+ 569:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 56c:	6a 01                	push   $0x1
+ 56e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 571:	52                   	push   %edx
+ 572:	57                   	push   %edi
+ 573:	e8 5b fd ff ff       	call   2d3 <write>
+        putc(fd, c);
+ 578:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57b:	31 d2                	xor    %edx,%edx
+ 57d:	eb 8e                	jmp    50d <printf+0x4d>
+ 57f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 580:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 583:	83 ec 0c             	sub    $0xc,%esp
+ 586:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 58b:	8b 13                	mov    (%ebx),%edx
+ 58d:	6a 00                	push   $0x0
+ 58f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 591:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 594:	e8 87 fe ff ff       	call   420 <printint>
+        ap++;
+ 599:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 59c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59f:	31 d2                	xor    %edx,%edx
+ 5a1:	e9 67 ff ff ff       	jmp    50d <printf+0x4d>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5b5:	83 c0 04             	add    $0x4,%eax
+ 5b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5bb:	85 db                	test   %ebx,%ebx
+ 5bd:	0f 84 9d 00 00 00    	je     660 <printf+0x1a0>
+        while(*s != 0){
+ 5c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5c8:	84 c0                	test   %al,%al
+ 5ca:	0f 84 3d ff ff ff    	je     50d <printf+0x4d>
+ 5d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5d6:	89 de                	mov    %ebx,%esi
+ 5d8:	89 d3                	mov    %edx,%ebx
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	53                   	push   %ebx
+ 5ec:	57                   	push   %edi
+ 5ed:	e8 e1 fc ff ff       	call   2d3 <write>
+        while(*s != 0){
+ 5f2:	0f b6 06             	movzbl (%esi),%eax
+ 5f5:	83 c4 10             	add    $0x10,%esp
+ 5f8:	84 c0                	test   %al,%al
+ 5fa:	75 e4                	jne    5e0 <printf+0x120>
+      state = 0;
+ 5fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ff:	31 d2                	xor    %edx,%edx
+ 601:	e9 07 ff ff ff       	jmp    50d <printf+0x4d>
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 610:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 613:	83 ec 0c             	sub    $0xc,%esp
+ 616:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 61b:	8b 13                	mov    (%ebx),%edx
+ 61d:	6a 01                	push   $0x1
+ 61f:	e9 6b ff ff ff       	jmp    58f <printf+0xcf>
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 628:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 631:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 633:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 636:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 639:	6a 01                	push   $0x1
+ 63b:	52                   	push   %edx
+ 63c:	57                   	push   %edi
+ 63d:	e8 91 fc ff ff       	call   2d3 <write>
+        ap++;
+ 642:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 645:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 648:	31 d2                	xor    %edx,%edx
+ 64a:	e9 be fe ff ff       	jmp    50d <printf+0x4d>
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 656:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 659:	6a 01                	push   $0x1
+ 65b:	e9 11 ff ff ff       	jmp    571 <printf+0xb1>
+ 660:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 665:	bb cd 0a 00 00       	mov    $0xacd,%ebx
+ 66a:	e9 61 ff ff ff       	jmp    5d0 <printf+0x110>
+ 66f:	90                   	nop
+
+00000670 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 670:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 671:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 674:	89 e5                	mov    %esp,%ebp
+ 676:	57                   	push   %edi
+ 677:	56                   	push   %esi
+ 678:	53                   	push   %ebx
+ 679:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 67b:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+ 680:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 682:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 684:	39 ca                	cmp    %ecx,%edx
+ 686:	73 30                	jae    6b8 <ufree+0x48>
+ 688:	39 c1                	cmp    %eax,%ecx
+ 68a:	72 04                	jb     690 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 68c:	39 c2                	cmp    %eax,%edx
+ 68e:	72 f0                	jb     680 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 690:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 693:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 696:	39 f8                	cmp    %edi,%eax
+ 698:	74 26                	je     6c0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 69a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 69d:	8b 42 04             	mov    0x4(%edx),%eax
+ 6a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6a3:	39 f1                	cmp    %esi,%ecx
+ 6a5:	74 30                	je     6d7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6a7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6a9:	5b                   	pop    %ebx
+  freep = p;
+ 6aa:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+}
+ 6b0:	5e                   	pop    %esi
+ 6b1:	5f                   	pop    %edi
+ 6b2:	5d                   	pop    %ebp
+ 6b3:	c3                   	ret
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b8:	39 c1                	cmp    %eax,%ecx
+ 6ba:	72 d0                	jb     68c <ufree+0x1c>
+ 6bc:	eb c2                	jmp    680 <ufree+0x10>
+ 6be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6c0:	03 70 04             	add    0x4(%eax),%esi
+ 6c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c6:	8b 02                	mov    (%edx),%eax
+ 6c8:	8b 00                	mov    (%eax),%eax
+ 6ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6d3:	39 f1                	cmp    %esi,%ecx
+ 6d5:	75 d0                	jne    6a7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 6d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6da:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+    p->s.size += bp->s.size;
+ 6e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6e8:	5b                   	pop    %ebx
+ 6e9:	5e                   	pop    %esi
+ 6ea:	5f                   	pop    %edi
+ 6eb:	5d                   	pop    %ebp
+ 6ec:	c3                   	ret
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006f0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	53                   	push   %ebx
+ 6f4:	83 ec 10             	sub    $0x10,%esp
+ 6f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 6fa:	68 c0 0f 00 00       	push   $0xfc0
+ 6ff:	e8 ec 01 00 00       	call   8f0 <lock_acquire>
+  ufree(ap);
+ 704:	89 d8                	mov    %ebx,%eax
+ 706:	e8 65 ff ff ff       	call   670 <ufree>
+  lock_release(&mlock);
+ 70b:	c7 45 08 c0 0f 00 00 	movl   $0xfc0,0x8(%ebp)
+}
+ 712:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 715:	83 c4 10             	add    $0x10,%esp
+}
+ 718:	c9                   	leave
+  lock_release(&mlock);
+ 719:	e9 f2 01 00 00       	jmp    910 <lock_release>
+ 71e:	66 90                	xchg   %ax,%ax
+
+00000720 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 72c:	68 c0 0f 00 00       	push   $0xfc0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 731:	8d 48 07             	lea    0x7(%eax),%ecx
+ 734:	c1 e9 03             	shr    $0x3,%ecx
+ 737:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 73a:	e8 b1 01 00 00       	call   8f0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 73f:	8b 15 c4 0f 00 00    	mov    0xfc4,%edx
+ 745:	83 c4 10             	add    $0x10,%esp
+ 748:	85 d2                	test   %edx,%edx
+ 74a:	0f 84 b0 00 00 00    	je     800 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 750:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 752:	8b 47 04             	mov    0x4(%edi),%eax
+ 755:	39 f0                	cmp    %esi,%eax
+ 757:	73 6f                	jae    7c8 <malloc+0xa8>
+  if(nu < 4096)
+ 759:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 75e:	39 de                	cmp    %ebx,%esi
+ 760:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 763:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 76a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 76d:	eb 0a                	jmp    779 <malloc+0x59>
+ 76f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 770:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 772:	8b 47 04             	mov    0x4(%edi),%eax
+ 775:	39 f0                	cmp    %esi,%eax
+ 777:	73 4f                	jae    7c8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 779:	89 fa                	mov    %edi,%edx
+ 77b:	39 3d c4 0f 00 00    	cmp    %edi,0xfc4
+ 781:	75 ed                	jne    770 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	ff 75 e4             	push   -0x1c(%ebp)
+ 789:	e8 ad fb ff ff       	call   33b <sbrk>
+  if(p == (char*)-1)
+ 78e:	83 c4 10             	add    $0x10,%esp
+ 791:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 794:	74 15                	je     7ab <malloc+0x8b>
+  hp->s.size = nu;
+ 796:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 799:	83 c0 08             	add    $0x8,%eax
+ 79c:	e8 cf fe ff ff       	call   670 <ufree>
+  return freep;
+ 7a1:	8b 15 c4 0f 00 00    	mov    0xfc4,%edx
+      if((p = morecore(nunits)) == 0){
+ 7a7:	85 d2                	test   %edx,%edx
+ 7a9:	75 c5                	jne    770 <malloc+0x50>
+        lock_release(&mlock);
+ 7ab:	83 ec 0c             	sub    $0xc,%esp
+ 7ae:	68 c0 0f 00 00       	push   $0xfc0
+ 7b3:	e8 58 01 00 00       	call   910 <lock_release>
+        return 0;
+ 7b8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 7bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7be:	31 c0                	xor    %eax,%eax
+}
+ 7c0:	5b                   	pop    %ebx
+ 7c1:	5e                   	pop    %esi
+ 7c2:	5f                   	pop    %edi
+ 7c3:	5d                   	pop    %ebp
+ 7c4:	c3                   	ret
+ 7c5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7c8:	39 c6                	cmp    %eax,%esi
+ 7ca:	74 64                	je     830 <malloc+0x110>
+        p->s.size -= nunits;
+ 7cc:	29 f0                	sub    %esi,%eax
+ 7ce:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 7d1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 7d4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 7d7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 7da:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+      lock_release(&mlock);
+ 7e0:	68 c0 0f 00 00       	push   $0xfc0
+ 7e5:	e8 26 01 00 00       	call   910 <lock_release>
+      return (void*)(p + 1);
+ 7ea:	83 c4 10             	add    $0x10,%esp
+}
+ 7ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7f0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 800:	c7 05 c4 0f 00 00 c8 	movl   $0xfc8,0xfc4
+ 807:	0f 00 00 
+    base.s.size = 0;
+ 80a:	bf c8 0f 00 00       	mov    $0xfc8,%edi
+    base.s.ptr = freep = prevp = &base;
+ 80f:	c7 05 c8 0f 00 00 c8 	movl   $0xfc8,0xfc8
+ 816:	0f 00 00 
+    base.s.size = 0;
+ 819:	c7 05 cc 0f 00 00 00 	movl   $0x0,0xfcc
+ 820:	00 00 00 
+    if(p->s.size >= nunits){
+ 823:	e9 31 ff ff ff       	jmp    759 <malloc+0x39>
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 830:	8b 07                	mov    (%edi),%eax
+ 832:	89 02                	mov    %eax,(%edx)
+ 834:	eb a1                	jmp    7d7 <malloc+0xb7>
+ 836:	66 90                	xchg   %ax,%ax
+ 838:	66 90                	xchg   %ax,%ax
+ 83a:	66 90                	xchg   %ax,%ax
+ 83c:	66 90                	xchg   %ax,%ax
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	53                   	push   %ebx
+ 844:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 847:	68 00 10 00 00       	push   $0x1000
+ 84c:	e8 cf fe ff ff       	call   720 <malloc>
+ 851:	83 c4 10             	add    $0x10,%esp
+ 854:	85 c0                	test   %eax,%eax
+ 856:	74 37                	je     88f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 858:	83 ec 04             	sub    $0x4,%esp
+ 85b:	89 c3                	mov    %eax,%ebx
+ 85d:	50                   	push   %eax
+ 85e:	ff 75 0c             	push   0xc(%ebp)
+ 861:	ff 75 08             	push   0x8(%ebp)
+ 864:	e8 0a fb ff ff       	call   373 <clone>
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	85 c0                	test   %eax,%eax
+ 86e:	78 08                	js     878 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 873:	c9                   	leave
+ 874:	c3                   	ret
+ 875:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 878:	83 ec 0c             	sub    $0xc,%esp
+ 87b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 87e:	53                   	push   %ebx
+ 87f:	e8 6c fe ff ff       	call   6f0 <free>
+ 884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 887:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 88a:	83 c4 10             	add    $0x10,%esp
+}
+ 88d:	c9                   	leave
+ 88e:	c3                   	ret
+    return -1;
+ 88f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 894:	eb da                	jmp    870 <thread_create+0x30>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 8a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8a9:	50                   	push   %eax
+ 8aa:	e8 cc fa ff ff       	call   37b <join>
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	85 c0                	test   %eax,%eax
+ 8b4:	79 0a                	jns    8c0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 8b6:	c9                   	leave
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+ 8c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	ff 75 f4             	push   -0xc(%ebp)
+ 8c9:	e8 22 fe ff ff       	call   6f0 <free>
+ 8ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8d1:	83 c4 10             	add    $0x10,%esp
+}
+ 8d4:	c9                   	leave
+ 8d5:	c3                   	ret
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 8e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8ec:	5d                   	pop    %ebp
+ 8ed:	c3                   	ret
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 8f0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8f6:	89 e5                	mov    %esp,%ebp
+ 8f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 905:	85 c0                	test   %eax,%eax
+ 907:	75 f7                	jne    900 <lock_acquire+0x10>
+    ;
+}
+ 909:	5d                   	pop    %ebp
+ 90a:	c3                   	ret
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+
+00000910 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 910:	55                   	push   %ebp
+ 911:	31 c0                	xor    %eax,%eax
+ 913:	89 e5                	mov    %esp,%ebp
+ 915:	8b 55 08             	mov    0x8(%ebp),%edx
+ 918:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000920 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 923:	8b 45 08             	mov    0x8(%ebp),%eax
+ 926:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 92c:	5d                   	pop    %ebp
+ 92d:	c3                   	ret
+ 92e:	66 90                	xchg   %ax,%ax
+
+00000930 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 930:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 931:	31 c0                	xor    %eax,%eax
+ 933:	ba 01 00 00 00       	mov    $0x1,%edx
+ 938:	89 e5                	mov    %esp,%ebp
+ 93a:	56                   	push   %esi
+ 93b:	53                   	push   %ebx
+ 93c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 93f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 943:	85 c0                	test   %eax,%eax
+ 945:	74 30                	je     977 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 947:	83 f8 02             	cmp    $0x2,%eax
+ 94a:	74 0c                	je     958 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 94c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 951:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 954:	85 c0                	test   %eax,%eax
+ 956:	74 1f                	je     977 <mutex_lock+0x47>
+ 958:	be 02 00 00 00       	mov    $0x2,%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ 960:	83 ec 08             	sub    $0x8,%esp
+ 963:	6a 02                	push   $0x2
+ 965:	53                   	push   %ebx
+ 966:	e8 18 fa ff ff       	call   383 <futex_wait>
+ 96b:	89 f0                	mov    %esi,%eax
+ 96d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 970:	83 c4 10             	add    $0x10,%esp
+ 973:	85 c0                	test   %eax,%eax
+ 975:	75 e9                	jne    960 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ 977:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 97a:	5b                   	pop    %ebx
+ 97b:	5e                   	pop    %esi
+ 97c:	5d                   	pop    %ebp
+ 97d:	c3                   	ret
+ 97e:	66 90                	xchg   %ax,%ax
+
+00000980 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 980:	55                   	push   %ebp
+ 981:	31 c0                	xor    %eax,%eax
+ 983:	89 e5                	mov    %esp,%ebp
+ 985:	83 ec 08             	sub    $0x8,%esp
+ 988:	8b 55 08             	mov    0x8(%ebp),%edx
+ 98b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ 98e:	83 f8 02             	cmp    $0x2,%eax
+ 991:	74 05                	je     998 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ 993:	c9                   	leave
+ 994:	c3                   	ret
+ 995:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ 998:	83 ec 08             	sub    $0x8,%esp
+ 99b:	6a 01                	push   $0x1
+ 99d:	52                   	push   %edx
+ 99e:	e8 e8 f9 ff ff       	call   38b <futex_wake>
+ 9a3:	83 c4 10             	add    $0x10,%esp
+}
+ 9a6:	c9                   	leave
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+
+000009b0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ 9b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ 9bc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 9c3:	5d                   	pop    %ebp
+ 9c4:	c3                   	ret
+ 9c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 0c             	sub    $0xc,%esp
+ 9d9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 9dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ 9df:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ 9e4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ 9e6:	8b 3e                	mov    (%esi),%edi
+ 9e8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ 9eb:	83 f8 02             	cmp    $0x2,%eax
+ 9ee:	74 60                	je     a50 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	e8 89 f9 ff ff       	call   383 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ 9fa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 9ff:	31 c0                	xor    %eax,%eax
+ a01:	ba 01 00 00 00       	mov    $0x1,%edx
+ a06:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ a0a:	83 c4 10             	add    $0x10,%esp
+ a0d:	85 c0                	test   %eax,%eax
+ a0f:	74 36                	je     a47 <cond_wait+0x77>
+  if(c != 2)
+ a11:	83 f8 02             	cmp    $0x2,%eax
+ a14:	74 0c                	je     a22 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ a16:	b8 02 00 00 00       	mov    $0x2,%eax
+ a1b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a1e:	85 c0                	test   %eax,%eax
+ a20:	74 25                	je     a47 <cond_wait+0x77>
+ a22:	be 02 00 00 00       	mov    $0x2,%esi
+ a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ a30:	83 ec 08             	sub    $0x8,%esp
+ a33:	6a 02                	push   $0x2
+ a35:	53                   	push   %ebx
+ a36:	e8 48 f9 ff ff       	call   383 <futex_wait>
+ a3b:	89 f0                	mov    %esi,%eax
+ a3d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a40:	83 c4 10             	add    $0x10,%esp
+ a43:	85 c0                	test   %eax,%eax
+ a45:	75 e9                	jne    a30 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4a:	5b                   	pop    %ebx
+ a4b:	5e                   	pop    %esi
+ a4c:	5f                   	pop    %edi
+ a4d:	5d                   	pop    %ebp
+ a4e:	c3                   	ret
+ a4f:	90                   	nop
+    futex_wake(&m->val, 1);
+ a50:	83 ec 08             	sub    $0x8,%esp
+ a53:	6a 01                	push   $0x1
+ a55:	53                   	push   %ebx
+ a56:	e8 30 f9 ff ff       	call   38b <futex_wake>
+ a5b:	83 c4 10             	add    $0x10,%esp
+ a5e:	eb 90                	jmp    9f0 <cond_wait+0x20>
+
+00000a60 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	83 ec 08             	sub    $0x8,%esp
+ a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a69:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a6d:	8b 50 04             	mov    0x4(%eax),%edx
+ a70:	85 d2                	test   %edx,%edx
+ a72:	75 0c                	jne    a80 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ a74:	c9                   	leave
+ a75:	c3                   	ret
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ a80:	83 ec 08             	sub    $0x8,%esp
+ a83:	6a 01                	push   $0x1
+ a85:	50                   	push   %eax
+ a86:	e8 00 f9 ff ff       	call   38b <futex_wake>
+ a8b:	83 c4 10             	add    $0x10,%esp
+}
+ a8e:	c9                   	leave
+ a8f:	c3                   	ret
+
+00000a90 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	83 ec 08             	sub    $0x8,%esp
+ a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a99:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a9d:	8b 50 04             	mov    0x4(%eax),%edx
+ aa0:	85 d2                	test   %edx,%edx
+ aa2:	75 0c                	jne    ab0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ aa4:	c9                   	leave
+ aa5:	c3                   	ret
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ ab0:	83 ec 08             	sub    $0x8,%esp
+ ab3:	68 ff ff ff 7f       	push   $0x7fffffff
+ ab8:	50                   	push   %eax
+ ab9:	e8 cd f8 ff ff       	call   38b <futex_wake>
+ abe:	83 c4 10             	add    $0x10,%esp
+}
+ ac1:	c9                   	leave
+ ac2:	c3                   	ret
@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -15,7 +16,7 @@ int exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  pde_t *pgdir;
 
   char path_plus_exec[DIRECTORY_BUFFER];//Make our path var as large as possible
   int length;
@@ -25,11 +26,21 @@ int exec(char *path, char **argv)
 
   if((ip = namei(path)) == 0){
     //Instead of returning nothing, we will loop through all our paths and check for executables there
-    int j;
-    for( j = 0; j < PATH.num_directories; j++ )
+    int j, more;
+    struct pathtable *dirs;
+    for( j = 0; ; j++ )
     {//We need to combine our path (executable) with strings from PATH
-      length = strlen(PATH.directories[j]);
-      safestrcpy(path_plus_exec, PATH.directories[j], DIRECTORY_BUFFER);
+      //PATH may be replaced meanwhile, and namei may sleep,
+      //so copy each directory out under rcureadlock
+      rcureadlock();
+      dirs = PATH;
+      more = j < dirs->num_directories;
+      if( more )
+        safestrcpy(path_plus_exec, dirs->directories[j], DIRECTORY_BUFFER);
+      rcureadunlock();
+      if( !more )
+        break;
+      length = strlen(path_plus_exec);
       safestrcpy(path_plus_exec + length, path, DIRECTORY_BUFFER - 1);//Stick executable after path dir
 
       ip = namei(path_plus_exec);
@@ -112,6 +123,10 @@ int exec(char *path, char **argv)
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
+  // Switch to the new image; past here exec can't fail.
+  if(execvm(pgdir, sz) < 0)
+    goto bad;
+
   // Save program name for debugging.
   for(last=s=path; *s; s++)
     if(*s == '/')
@@ -119,13 +134,8 @@ int exec(char *path, char **argv)
   safestrcpy(proc->name, last, sizeof(proc->name));
 
   // Commit to the user image.
-  oldpgdir = proc->pgdir;
-  proc->pgdir = pgdir;
-  proc->sz = sz;
   proc->tf->eip = elf.entry;  // main
   proc->tf->esp = sp;
-  switchuvm(proc);
-  freevm(oldpgdir);
   return 0;
 
  bad:
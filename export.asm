@@ -0,0 +1,1879 @@
+
+_export:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+For Dr. Rasit Eskicioglu
+*/
+#include "export.h"
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  //Arg1: name, Arg2: Path value
+  if (argc != 3) {
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if (argc != 3) {
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "usage: export PATH path1:path2:...\n");
+  17:	53                   	push   %ebx
+  18:	53                   	push   %ebx
+  19:	68 74 0b 00 00       	push   $0xb74
+  1e:	6a 02                	push   $0x2
+  20:	e8 4b 05 00 00       	call   570 <printf>
+    exit();
+  25:	e8 39 03 00 00       	call   363 <exit>
+  }
+
+  if( strcmp(argv[1], "PATH") != 0)
+  2a:	51                   	push   %ecx
+  2b:	51                   	push   %ecx
+  2c:	68 bf 0b 00 00       	push   $0xbbf
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 17 01 00 00       	call   150 <strcmp>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	74 15                	je     55 <main+0x55>
+  {
+    printf(1, "Environment variable %s not supported\n", argv[1]);
+  40:	52                   	push   %edx
+  41:	ff 73 04             	push   0x4(%ebx)
+  44:	68 98 0b 00 00       	push   $0xb98
+  49:	6a 01                	push   $0x1
+  4b:	e8 20 05 00 00       	call   570 <printf>
+    exit();
+  50:	e8 0e 03 00 00       	call   363 <exit>
+  }
+
+  char * pathValue = argv[2];
+  55:	8b 5b 08             	mov    0x8(%ebx),%ebx
+
+  printf(1, "Adding path variable...\n%s\n", pathValue);
+  58:	50                   	push   %eax
+  59:	53                   	push   %ebx
+  5a:	68 c4 0b 00 00       	push   $0xbc4
+  5f:	6a 01                	push   $0x1
+  61:	e8 0a 05 00 00       	call   570 <printf>
+  add_directory(pathValue);
+  66:	89 1c 24             	mov    %ebx,(%esp)
+  69:	e8 12 00 00 00       	call   80 <add_directory>
+
+  exit();
+  6e:	e8 f0 02 00 00       	call   363 <exit>
+  73:	66 90                	xchg   %ax,%ax
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <add_directory>:
+}
+
+int add_directory(char *pathstr)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	56                   	push   %esi
+  84:	53                   	push   %ebx
+  85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  char *pathStart = pathstr;
+  char *currentChar;
+
+  //Ignore all colons
+  while(*pathStart == DELIMETER)
+  88:	0f b6 01             	movzbl (%ecx),%eax
+  8b:	3c 3a                	cmp    $0x3a,%al
+  8d:	75 0c                	jne    9b <add_directory+0x1b>
+  8f:	90                   	nop
+  90:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+    pathStart++;
+  94:	83 c1 01             	add    $0x1,%ecx
+  while(*pathStart == DELIMETER)
+  97:	3c 3a                	cmp    $0x3a,%al
+  99:	74 f5                	je     90 <add_directory+0x10>
+
+  //If there's no characters other than colons, return
+  if(*pathStart == NULL_CHAR)
+  9b:	84 c0                	test   %al,%al
+  9d:	74 54                	je     f3 <add_directory+0x73>
+    return - 1;
+  currentChar = pathStart;
+
+  //Loop until we hit the end of the string
+  while(*currentChar != NULL_CHAR) {
+  9f:	0f b6 11             	movzbl (%ecx),%edx
+  a2:	84 d2                	test   %dl,%dl
+  a4:	74 59                	je     ff <add_directory+0x7f>
+  a6:	89 cb                	mov    %ecx,%ebx
+  a8:	eb 11                	jmp    bb <add_directory+0x3b>
+  aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b0:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+      if(*pathStart == NULL_CHAR)
+        exit();
+      currentChar = pathStart;
+    }
+
+    currentChar++;
+  b4:	8d 58 01             	lea    0x1(%eax),%ebx
+  while(*currentChar != NULL_CHAR) {
+  b7:	84 d2                	test   %dl,%dl
+  b9:	74 44                	je     ff <add_directory+0x7f>
+    if(*currentChar == DELIMETER) {
+  bb:	89 d8                	mov    %ebx,%eax
+  bd:	80 fa 3a             	cmp    $0x3a,%dl
+  c0:	75 ee                	jne    b0 <add_directory+0x30>
+      add_dir(pathStart);
+  c2:	83 ec 0c             	sub    $0xc,%esp
+      *currentChar = NULL_CHAR;
+  c5:	c6 03 00             	movb   $0x0,(%ebx)
+      pathStart = currentChar + 1;
+  c8:	8d 73 01             	lea    0x1(%ebx),%esi
+      add_dir(pathStart);
+  cb:	51                   	push   %ecx
+  cc:	e8 32 03 00 00       	call   403 <add_dir>
+      while(*pathStart == DELIMETER)
+  d1:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+  d5:	83 c4 10             	add    $0x10,%esp
+      pathStart = currentChar + 1;
+  d8:	89 f1                	mov    %esi,%ecx
+      while(*pathStart == DELIMETER)
+  da:	3c 3a                	cmp    $0x3a,%al
+  dc:	75 0d                	jne    eb <add_directory+0x6b>
+  de:	66 90                	xchg   %ax,%ax
+  e0:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+        pathStart++;
+  e4:	83 c1 01             	add    $0x1,%ecx
+      while(*pathStart == DELIMETER)
+  e7:	3c 3a                	cmp    $0x3a,%al
+  e9:	74 f5                	je     e0 <add_directory+0x60>
+      if(*pathStart == NULL_CHAR)
+  eb:	84 c0                	test   %al,%al
+  ed:	74 1e                	je     10d <add_directory+0x8d>
+  ef:	89 c8                	mov    %ecx,%eax
+  f1:	eb bd                	jmp    b0 <add_directory+0x30>
+  }
+  //Add the last directory path
+  add_dir(pathStart);
+  exit();
+}
+  f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  fb:	5b                   	pop    %ebx
+  fc:	5e                   	pop    %esi
+  fd:	5d                   	pop    %ebp
+  fe:	c3                   	ret
+  add_dir(pathStart);
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	51                   	push   %ecx
+ 103:	e8 fb 02 00 00       	call   403 <add_dir>
+  exit();
+ 108:	e8 56 02 00 00       	call   363 <exit>
+        exit();
+ 10d:	e8 51 02 00 00       	call   363 <exit>
+ 112:	66 90                	xchg   %ax,%ax
+ 114:	66 90                	xchg   %ax,%ax
+ 116:	66 90                	xchg   %ax,%ax
+ 118:	66 90                	xchg   %ax,%ax
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 1e 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 f1 00 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 f4 00 00 00       	call   3bb <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 ba 00 00 00       	call   38b <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <add_dir>:
+SYSCALL(add_dir)
+ 403:	b8 16 00 00 00       	mov    $0x16,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <history>:
+SYSCALL(history)
+ 40b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 413:	b8 19 00 00 00       	mov    $0x19,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <nanosleep>:
+SYSCALL(nanosleep)
+ 41b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <clone>:
+SYSCALL(clone)
+ 423:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <join>:
+SYSCALL(join)
+ 42b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <futex_wait>:
+SYSCALL(futex_wait)
+ 433:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <futex_wake>:
+SYSCALL(futex_wake)
+ 43b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 443:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 44b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 453:	b8 21 00 00 00       	mov    $0x21,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 45b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <waitpid>:
+SYSCALL(waitpid)
+ 463:	b8 23 00 00 00       	mov    $0x23,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <tracectl>:
+SYSCALL(tracectl)
+ 46b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <traceread>:
+SYSCALL(traceread)
+ 473:	b8 25 00 00 00       	mov    $0x25,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 47b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 483:	b8 27 00 00 00       	mov    $0x27,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 48b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <irqroute>:
+SYSCALL(irqroute)
+ 493:	b8 29 00 00 00       	mov    $0x29,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <irqstat>:
+SYSCALL(irqstat)
+ 49b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <boottimes>:
+SYSCALL(boottimes)
+ 4a3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <lockbench>:
+SYSCALL(lockbench)
+ 4ab:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <lockstat>:
+SYSCALL(lockstat)
+ 4b3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <cpustat>:
+SYSCALL(cpustat)
+ 4bb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <bcachesize>:
+SYSCALL(bcachesize)
+ 4c3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+ 4cb:	66 90                	xchg   %ax,%ax
+ 4cd:	66 90                	xchg   %ax,%ax
+ 4cf:	90                   	nop
+
+000004d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4d8:	89 d1                	mov    %edx,%ecx
+{
+ 4da:	83 ec 3c             	sub    $0x3c,%esp
+ 4dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4e0:	85 d2                	test   %edx,%edx
+ 4e2:	0f 89 80 00 00 00    	jns    568 <printint+0x98>
+ 4e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ec:	74 7a                	je     568 <printint+0x98>
+    x = -xx;
+ 4ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4f8:	31 f6                	xor    %esi,%esi
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 500:	89 c8                	mov    %ecx,%eax
+ 502:	31 d2                	xor    %edx,%edx
+ 504:	89 f7                	mov    %esi,%edi
+ 506:	f7 f3                	div    %ebx
+ 508:	8d 76 01             	lea    0x1(%esi),%esi
+ 50b:	0f b6 92 40 0c 00 00 	movzbl 0xc40(%edx),%edx
+ 512:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 516:	89 ca                	mov    %ecx,%edx
+ 518:	89 c1                	mov    %eax,%ecx
+ 51a:	39 da                	cmp    %ebx,%edx
+ 51c:	73 e2                	jae    500 <printint+0x30>
+  if(neg)
+ 51e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 521:	85 c0                	test   %eax,%eax
+ 523:	74 07                	je     52c <printint+0x5c>
+    buf[i++] = '-';
+ 525:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 52a:	89 f7                	mov    %esi,%edi
+ 52c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 52f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 532:	01 df                	add    %ebx,%edi
+ 534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 538:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 53b:	83 ec 04             	sub    $0x4,%esp
+ 53e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 541:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 544:	6a 01                	push   $0x1
+ 546:	50                   	push   %eax
+ 547:	56                   	push   %esi
+ 548:	e8 36 fe ff ff       	call   383 <write>
+  while(--i >= 0)
+ 54d:	89 f8                	mov    %edi,%eax
+ 54f:	83 c4 10             	add    $0x10,%esp
+ 552:	83 ef 01             	sub    $0x1,%edi
+ 555:	39 d8                	cmp    %ebx,%eax
+ 557:	75 df                	jne    538 <printint+0x68>
+}
+ 559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55c:	5b                   	pop    %ebx
+ 55d:	5e                   	pop    %esi
+ 55e:	5f                   	pop    %edi
+ 55f:	5d                   	pop    %ebp
+ 560:	c3                   	ret
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 568:	31 c0                	xor    %eax,%eax
+ 56a:	eb 89                	jmp    4f5 <printint+0x25>
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	53                   	push   %ebx
+ 576:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 579:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 57c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 57f:	0f b6 1e             	movzbl (%esi),%ebx
+ 582:	83 c6 01             	add    $0x1,%esi
+ 585:	84 db                	test   %bl,%bl
+ 587:	74 67                	je     5f0 <printf+0x80>
+ 589:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 58c:	31 d2                	xor    %edx,%edx
+ 58e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 591:	eb 34                	jmp    5c7 <printf+0x57>
+ 593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 597:	90                   	nop
+ 598:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 59b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5a0:	83 f8 25             	cmp    $0x25,%eax
+ 5a3:	74 18                	je     5bd <printf+0x4d>
+  write(fd, &c, 1);
+ 5a5:	83 ec 04             	sub    $0x4,%esp
+ 5a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ae:	6a 01                	push   $0x1
+ 5b0:	50                   	push   %eax
+ 5b1:	57                   	push   %edi
+ 5b2:	e8 cc fd ff ff       	call   383 <write>
+ 5b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c0:	83 c6 01             	add    $0x1,%esi
+ 5c3:	84 db                	test   %bl,%bl
+ 5c5:	74 29                	je     5f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ca:	85 d2                	test   %edx,%edx
+ 5cc:	74 ca                	je     598 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ce:	83 fa 25             	cmp    $0x25,%edx
+ 5d1:	75 ea                	jne    5bd <printf+0x4d>
+      if(c == 'd'){
+ 5d3:	83 f8 25             	cmp    $0x25,%eax
+ 5d6:	0f 84 24 01 00 00    	je     700 <printf+0x190>
+ 5dc:	83 e8 63             	sub    $0x63,%eax
+ 5df:	83 f8 15             	cmp    $0x15,%eax
+ 5e2:	77 1c                	ja     600 <printf+0x90>
+ 5e4:	ff 24 85 e8 0b 00 00 	jmp    *0xbe8(,%eax,4)
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5f3:	5b                   	pop    %ebx
+ 5f4:	5e                   	pop    %esi
+ 5f5:	5f                   	pop    %edi
+ 5f6:	5d                   	pop    %ebp
+ 5f7:	c3                   	ret
+ 5f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 606:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 60a:	6a 01                	push   $0x1
+ 60c:	52                   	push   %edx
+ 60d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 610:	57                   	push   %edi
+ 611:	e8 6d fd ff ff       	call   383 <write>
+ 616:	83 c4 0c             	add    $0xc,%esp
+ 619:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 61c:	6a 01                	push   $0x1
+ 61e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 621:	52                   	push   %edx
+ 622:	57                   	push   %edi
+ 623:	e8 5b fd ff ff       	call   383 <write>
+        putc(fd, c);
+ 628:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62b:	31 d2                	xor    %edx,%edx
+ 62d:	eb 8e                	jmp    5bd <printf+0x4d>
+ 62f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 630:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 63b:	8b 13                	mov    (%ebx),%edx
+ 63d:	6a 00                	push   $0x0
+ 63f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 641:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 644:	e8 87 fe ff ff       	call   4d0 <printint>
+        ap++;
+ 649:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 64c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 67 ff ff ff       	jmp    5bd <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 660:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 663:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 665:	83 c0 04             	add    $0x4,%eax
+ 668:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 66b:	85 db                	test   %ebx,%ebx
+ 66d:	0f 84 9d 00 00 00    	je     710 <printf+0x1a0>
+        while(*s != 0){
+ 673:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 676:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 678:	84 c0                	test   %al,%al
+ 67a:	0f 84 3d ff ff ff    	je     5bd <printf+0x4d>
+ 680:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 683:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 686:	89 de                	mov    %ebx,%esi
+ 688:	89 d3                	mov    %edx,%ebx
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 696:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 699:	6a 01                	push   $0x1
+ 69b:	53                   	push   %ebx
+ 69c:	57                   	push   %edi
+ 69d:	e8 e1 fc ff ff       	call   383 <write>
+        while(*s != 0){
+ 6a2:	0f b6 06             	movzbl (%esi),%eax
+ 6a5:	83 c4 10             	add    $0x10,%esp
+ 6a8:	84 c0                	test   %al,%al
+ 6aa:	75 e4                	jne    690 <printf+0x120>
+      state = 0;
+ 6ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 07 ff ff ff       	jmp    5bd <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 01                	push   $0x1
+ 6cf:	e9 6b ff ff ff       	jmp    63f <printf+0xcf>
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	52                   	push   %edx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 91 fc ff ff       	call   383 <write>
+        ap++;
+ 6f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6f8:	31 d2                	xor    %edx,%edx
+ 6fa:	e9 be fe ff ff       	jmp    5bd <printf+0x4d>
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 706:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 709:	6a 01                	push   $0x1
+ 70b:	e9 11 ff ff ff       	jmp    621 <printf+0xb1>
+ 710:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 715:	bb e0 0b 00 00       	mov    $0xbe0,%ebx
+ 71a:	e9 61 ff ff ff       	jmp    680 <printf+0x110>
+ 71f:	90                   	nop
+
+00000720 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 720:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 721:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 724:	89 e5                	mov    %esp,%ebp
+ 726:	57                   	push   %edi
+ 727:	56                   	push   %esi
+ 728:	53                   	push   %ebx
+ 729:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 72b:	a1 fc 10 00 00       	mov    0x10fc,%eax
+ 730:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 732:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 734:	39 ca                	cmp    %ecx,%edx
+ 736:	73 30                	jae    768 <ufree+0x48>
+ 738:	39 c1                	cmp    %eax,%ecx
+ 73a:	72 04                	jb     740 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 73c:	39 c2                	cmp    %eax,%edx
+ 73e:	72 f0                	jb     730 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 740:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 743:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 746:	39 f8                	cmp    %edi,%eax
+ 748:	74 26                	je     770 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 74a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 74d:	8b 42 04             	mov    0x4(%edx),%eax
+ 750:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 753:	39 f1                	cmp    %esi,%ecx
+ 755:	74 30                	je     787 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 757:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 759:	5b                   	pop    %ebx
+  freep = p;
+ 75a:	89 15 fc 10 00 00    	mov    %edx,0x10fc
+}
+ 760:	5e                   	pop    %esi
+ 761:	5f                   	pop    %edi
+ 762:	5d                   	pop    %ebp
+ 763:	c3                   	ret
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 768:	39 c1                	cmp    %eax,%ecx
+ 76a:	72 d0                	jb     73c <ufree+0x1c>
+ 76c:	eb c2                	jmp    730 <ufree+0x10>
+ 76e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 770:	03 70 04             	add    0x4(%eax),%esi
+ 773:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 776:	8b 02                	mov    (%edx),%eax
+ 778:	8b 00                	mov    (%eax),%eax
+ 77a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 77d:	8b 42 04             	mov    0x4(%edx),%eax
+ 780:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 783:	39 f1                	cmp    %esi,%ecx
+ 785:	75 d0                	jne    757 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 787:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 78a:	89 15 fc 10 00 00    	mov    %edx,0x10fc
+    p->s.size += bp->s.size;
+ 790:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 793:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 796:	89 0a                	mov    %ecx,(%edx)
+}
+ 798:	5b                   	pop    %ebx
+ 799:	5e                   	pop    %esi
+ 79a:	5f                   	pop    %edi
+ 79b:	5d                   	pop    %ebp
+ 79c:	c3                   	ret
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	53                   	push   %ebx
+ 7a4:	83 ec 10             	sub    $0x10,%esp
+ 7a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 7aa:	68 f8 10 00 00       	push   $0x10f8
+ 7af:	e8 ec 01 00 00       	call   9a0 <lock_acquire>
+  ufree(ap);
+ 7b4:	89 d8                	mov    %ebx,%eax
+ 7b6:	e8 65 ff ff ff       	call   720 <ufree>
+  lock_release(&mlock);
+ 7bb:	c7 45 08 f8 10 00 00 	movl   $0x10f8,0x8(%ebp)
+}
+ 7c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 7c5:	83 c4 10             	add    $0x10,%esp
+}
+ 7c8:	c9                   	leave
+  lock_release(&mlock);
+ 7c9:	e9 f2 01 00 00       	jmp    9c0 <lock_release>
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 7dc:	68 f8 10 00 00       	push   $0x10f8
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e1:	8d 48 07             	lea    0x7(%eax),%ecx
+ 7e4:	c1 e9 03             	shr    $0x3,%ecx
+ 7e7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 7ea:	e8 b1 01 00 00       	call   9a0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 7ef:	8b 15 fc 10 00 00    	mov    0x10fc,%edx
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	85 d2                	test   %edx,%edx
+ 7fa:	0f 84 b0 00 00 00    	je     8b0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 800:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 802:	8b 47 04             	mov    0x4(%edi),%eax
+ 805:	39 f0                	cmp    %esi,%eax
+ 807:	73 6f                	jae    878 <malloc+0xa8>
+  if(nu < 4096)
+ 809:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 80e:	39 de                	cmp    %ebx,%esi
+ 810:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 813:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 81a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 81d:	eb 0a                	jmp    829 <malloc+0x59>
+ 81f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 820:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 822:	8b 47 04             	mov    0x4(%edi),%eax
+ 825:	39 f0                	cmp    %esi,%eax
+ 827:	73 4f                	jae    878 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 829:	89 fa                	mov    %edi,%edx
+ 82b:	39 3d fc 10 00 00    	cmp    %edi,0x10fc
+ 831:	75 ed                	jne    820 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	ff 75 e4             	push   -0x1c(%ebp)
+ 839:	e8 ad fb ff ff       	call   3eb <sbrk>
+  if(p == (char*)-1)
+ 83e:	83 c4 10             	add    $0x10,%esp
+ 841:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 844:	74 15                	je     85b <malloc+0x8b>
+  hp->s.size = nu;
+ 846:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 849:	83 c0 08             	add    $0x8,%eax
+ 84c:	e8 cf fe ff ff       	call   720 <ufree>
+  return freep;
+ 851:	8b 15 fc 10 00 00    	mov    0x10fc,%edx
+      if((p = morecore(nunits)) == 0){
+ 857:	85 d2                	test   %edx,%edx
+ 859:	75 c5                	jne    820 <malloc+0x50>
+        lock_release(&mlock);
+ 85b:	83 ec 0c             	sub    $0xc,%esp
+ 85e:	68 f8 10 00 00       	push   $0x10f8
+ 863:	e8 58 01 00 00       	call   9c0 <lock_release>
+        return 0;
+ 868:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 86b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 86e:	31 c0                	xor    %eax,%eax
+}
+ 870:	5b                   	pop    %ebx
+ 871:	5e                   	pop    %esi
+ 872:	5f                   	pop    %edi
+ 873:	5d                   	pop    %ebp
+ 874:	c3                   	ret
+ 875:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 878:	39 c6                	cmp    %eax,%esi
+ 87a:	74 64                	je     8e0 <malloc+0x110>
+        p->s.size -= nunits;
+ 87c:	29 f0                	sub    %esi,%eax
+ 87e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 881:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 884:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 887:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 88a:	89 15 fc 10 00 00    	mov    %edx,0x10fc
+      lock_release(&mlock);
+ 890:	68 f8 10 00 00       	push   $0x10f8
+ 895:	e8 26 01 00 00       	call   9c0 <lock_release>
+      return (void*)(p + 1);
+ 89a:	83 c4 10             	add    $0x10,%esp
+}
+ 89d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8a0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 8b0:	c7 05 fc 10 00 00 00 	movl   $0x1100,0x10fc
+ 8b7:	11 00 00 
+    base.s.size = 0;
+ 8ba:	bf 00 11 00 00       	mov    $0x1100,%edi
+    base.s.ptr = freep = prevp = &base;
+ 8bf:	c7 05 00 11 00 00 00 	movl   $0x1100,0x1100
+ 8c6:	11 00 00 
+    base.s.size = 0;
+ 8c9:	c7 05 04 11 00 00 00 	movl   $0x0,0x1104
+ 8d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8d3:	e9 31 ff ff ff       	jmp    809 <malloc+0x39>
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8e0:	8b 07                	mov    (%edi),%eax
+ 8e2:	89 02                	mov    %eax,(%edx)
+ 8e4:	eb a1                	jmp    887 <malloc+0xb7>
+ 8e6:	66 90                	xchg   %ax,%ax
+ 8e8:	66 90                	xchg   %ax,%ax
+ 8ea:	66 90                	xchg   %ax,%ax
+ 8ec:	66 90                	xchg   %ax,%ax
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	53                   	push   %ebx
+ 8f4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 8f7:	68 00 10 00 00       	push   $0x1000
+ 8fc:	e8 cf fe ff ff       	call   7d0 <malloc>
+ 901:	83 c4 10             	add    $0x10,%esp
+ 904:	85 c0                	test   %eax,%eax
+ 906:	74 37                	je     93f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 908:	83 ec 04             	sub    $0x4,%esp
+ 90b:	89 c3                	mov    %eax,%ebx
+ 90d:	50                   	push   %eax
+ 90e:	ff 75 0c             	push   0xc(%ebp)
+ 911:	ff 75 08             	push   0x8(%ebp)
+ 914:	e8 0a fb ff ff       	call   423 <clone>
+ 919:	83 c4 10             	add    $0x10,%esp
+ 91c:	85 c0                	test   %eax,%eax
+ 91e:	78 08                	js     928 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 920:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 923:	c9                   	leave
+ 924:	c3                   	ret
+ 925:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 928:	83 ec 0c             	sub    $0xc,%esp
+ 92b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 92e:	53                   	push   %ebx
+ 92f:	e8 6c fe ff ff       	call   7a0 <free>
+ 934:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 93a:	83 c4 10             	add    $0x10,%esp
+}
+ 93d:	c9                   	leave
+ 93e:	c3                   	ret
+    return -1;
+ 93f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 944:	eb da                	jmp    920 <thread_create+0x30>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 959:	50                   	push   %eax
+ 95a:	e8 cc fa ff ff       	call   42b <join>
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	85 c0                	test   %eax,%eax
+ 964:	79 0a                	jns    970 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 966:	c9                   	leave
+ 967:	c3                   	ret
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+ 970:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	ff 75 f4             	push   -0xc(%ebp)
+ 979:	e8 22 fe ff ff       	call   7a0 <free>
+ 97e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 981:	83 c4 10             	add    $0x10,%esp
+}
+ 984:	c9                   	leave
+ 985:	c3                   	ret
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 993:	8b 45 08             	mov    0x8(%ebp),%eax
+ 996:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 99c:	5d                   	pop    %ebp
+ 99d:	c3                   	ret
+ 99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 9a0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 9a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9a6:	89 e5                	mov    %esp,%ebp
+ 9a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 9b5:	85 c0                	test   %eax,%eax
+ 9b7:	75 f7                	jne    9b0 <lock_acquire+0x10>
+    ;
+}
+ 9b9:	5d                   	pop    %ebp
+ 9ba:	c3                   	ret
+ 9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+
+000009c0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	31 c0                	xor    %eax,%eax
+ 9c3:	89 e5                	mov    %esp,%ebp
+ 9c5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9c8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 9cb:	5d                   	pop    %ebp
+ 9cc:	c3                   	ret
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 9d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9dc:	5d                   	pop    %ebp
+ 9dd:	c3                   	ret
+ 9de:	66 90                	xchg   %ax,%ax
+
+000009e0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9e0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 9e1:	31 c0                	xor    %eax,%eax
+ 9e3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9e8:	89 e5                	mov    %esp,%ebp
+ 9ea:	56                   	push   %esi
+ 9eb:	53                   	push   %ebx
+ 9ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9ef:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 9f3:	85 c0                	test   %eax,%eax
+ 9f5:	74 30                	je     a27 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 9f7:	83 f8 02             	cmp    $0x2,%eax
+ 9fa:	74 0c                	je     a08 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 9fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ a01:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ a04:	85 c0                	test   %eax,%eax
+ a06:	74 1f                	je     a27 <mutex_lock+0x47>
+ a08:	be 02 00 00 00       	mov    $0x2,%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ a10:	83 ec 08             	sub    $0x8,%esp
+ a13:	6a 02                	push   $0x2
+ a15:	53                   	push   %ebx
+ a16:	e8 18 fa ff ff       	call   433 <futex_wait>
+ a1b:	89 f0                	mov    %esi,%eax
+ a1d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a20:	83 c4 10             	add    $0x10,%esp
+ a23:	85 c0                	test   %eax,%eax
+ a25:	75 e9                	jne    a10 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ a27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a2a:	5b                   	pop    %ebx
+ a2b:	5e                   	pop    %esi
+ a2c:	5d                   	pop    %ebp
+ a2d:	c3                   	ret
+ a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a30:	55                   	push   %ebp
+ a31:	31 c0                	xor    %eax,%eax
+ a33:	89 e5                	mov    %esp,%ebp
+ a35:	83 ec 08             	sub    $0x8,%esp
+ a38:	8b 55 08             	mov    0x8(%ebp),%edx
+ a3b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ a3e:	83 f8 02             	cmp    $0x2,%eax
+ a41:	74 05                	je     a48 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ a43:	c9                   	leave
+ a44:	c3                   	ret
+ a45:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ a48:	83 ec 08             	sub    $0x8,%esp
+ a4b:	6a 01                	push   $0x1
+ a4d:	52                   	push   %edx
+ a4e:	e8 e8 f9 ff ff       	call   43b <futex_wake>
+ a53:	83 c4 10             	add    $0x10,%esp
+}
+ a56:	c9                   	leave
+ a57:	c3                   	ret
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+
+00000a60 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ a66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ a6c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a73:	5d                   	pop    %ebp
+ a74:	c3                   	ret
+ a75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 0c             	sub    $0xc,%esp
+ a89:	8b 75 08             	mov    0x8(%ebp),%esi
+ a8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ a8f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ a94:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ a96:	8b 3e                	mov    (%esi),%edi
+ a98:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ a9b:	83 f8 02             	cmp    $0x2,%eax
+ a9e:	74 60                	je     b00 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	e8 89 f9 ff ff       	call   433 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ aaa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ aaf:	31 c0                	xor    %eax,%eax
+ ab1:	ba 01 00 00 00       	mov    $0x1,%edx
+ ab6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ aba:	83 c4 10             	add    $0x10,%esp
+ abd:	85 c0                	test   %eax,%eax
+ abf:	74 36                	je     af7 <cond_wait+0x77>
+  if(c != 2)
+ ac1:	83 f8 02             	cmp    $0x2,%eax
+ ac4:	74 0c                	je     ad2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ ac6:	b8 02 00 00 00       	mov    $0x2,%eax
+ acb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ ace:	85 c0                	test   %eax,%eax
+ ad0:	74 25                	je     af7 <cond_wait+0x77>
+ ad2:	be 02 00 00 00       	mov    $0x2,%esi
+ ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ade:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ ae0:	83 ec 08             	sub    $0x8,%esp
+ ae3:	6a 02                	push   $0x2
+ ae5:	53                   	push   %ebx
+ ae6:	e8 48 f9 ff ff       	call   433 <futex_wait>
+ aeb:	89 f0                	mov    %esi,%eax
+ aed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ af0:	83 c4 10             	add    $0x10,%esp
+ af3:	85 c0                	test   %eax,%eax
+ af5:	75 e9                	jne    ae0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ af7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afa:	5b                   	pop    %ebx
+ afb:	5e                   	pop    %esi
+ afc:	5f                   	pop    %edi
+ afd:	5d                   	pop    %ebp
+ afe:	c3                   	ret
+ aff:	90                   	nop
+    futex_wake(&m->val, 1);
+ b00:	83 ec 08             	sub    $0x8,%esp
+ b03:	6a 01                	push   $0x1
+ b05:	53                   	push   %ebx
+ b06:	e8 30 f9 ff ff       	call   43b <futex_wake>
+ b0b:	83 c4 10             	add    $0x10,%esp
+ b0e:	eb 90                	jmp    aa0 <cond_wait+0x20>
+
+00000b10 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	83 ec 08             	sub    $0x8,%esp
+ b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ b19:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ b1d:	8b 50 04             	mov    0x4(%eax),%edx
+ b20:	85 d2                	test   %edx,%edx
+ b22:	75 0c                	jne    b30 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ b24:	c9                   	leave
+ b25:	c3                   	ret
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ b30:	83 ec 08             	sub    $0x8,%esp
+ b33:	6a 01                	push   $0x1
+ b35:	50                   	push   %eax
+ b36:	e8 00 f9 ff ff       	call   43b <futex_wake>
+ b3b:	83 c4 10             	add    $0x10,%esp
+}
+ b3e:	c9                   	leave
+ b3f:	c3                   	ret
+
+00000b40 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	83 ec 08             	sub    $0x8,%esp
+ b46:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ b49:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ b4d:	8b 50 04             	mov    0x4(%eax),%edx
+ b50:	85 d2                	test   %edx,%edx
+ b52:	75 0c                	jne    b60 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ b54:	c9                   	leave
+ b55:	c3                   	ret
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ b60:	83 ec 08             	sub    $0x8,%esp
+ b63:	68 ff ff ff 7f       	push   $0x7fffffff
+ b68:	50                   	push   %eax
+ b69:	e8 cd f8 ff ff       	call   43b <futex_wake>
+ b6e:	83 c4 10             	add    $0x10,%esp
+}
+ b71:	c9                   	leave
+ b72:	c3                   	ret
@@ -5,10 +5,15 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "x86.h"
+
+#define RAMIN  4  // first read-ahead window, in blocks
+#define RAMAX 32  // largest
 
 struct devsw devsw[NDEV];
 struct {
@@ -16,10 +21,18 @@ struct {
   struct file file[NFILE];
 } ftable;
 
+// Descriptor tables, carved out of kalloc'ed pages and never
+// freed, like procs.  There is at most one per proc.
+struct {
+  struct spinlock lock;
+  struct fdtable *free;
+} fdtables;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  initlock(&fdtables.lock, "fdtables");
 }
 
 // Allocate a file structure.
@@ -79,6 +92,94 @@ fileclose(struct file *f)
   }
 }
 
+// Make a descriptor table with no open files and cwd as the
+// current directory, taking over the caller's reference to
+// cwd.  Return 0 if out of memory.
+struct fdtable*
+fdtablealloc(struct inode *cwd)
+{
+  struct fdtable *t;
+  char *mem;
+  int i;
+
+  acquire(&fdtables.lock);
+  if(fdtables.free == 0){
+    if((mem = kalloc()) == 0){
+      release(&fdtables.lock);
+      return 0;
+    }
+    memset(mem, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*t); i++){
+      t = (struct fdtable*)mem + i;
+      initlock(&t->lock, "fdtable");
+      t->nextfree = fdtables.free;
+      fdtables.free = t;
+    }
+  }
+  t = fdtables.free;
+  fdtables.free = t->nextfree;
+  release(&fdtables.lock);
+
+  t->nextfree = 0;
+  t->ref = 1;
+  memset(t->ofile, 0, sizeof(t->ofile));
+  t->cwd = cwd;
+  return t;
+}
+
+// Make a table of its own with the same open files and
+// cwd as t, for fork.  Return 0 if out of memory.
+struct fdtable*
+fdtablecopy(struct fdtable *t)
+{
+  struct fdtable *nt;
+  int fd;
+
+  if((nt = fdtablealloc(0)) == 0)
+    return 0;
+  acquire(&t->lock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(t->ofile[fd])
+      nt->ofile[fd] = filedup(t->ofile[fd]);
+  nt->cwd = idup(t->cwd);
+  release(&t->lock);
+  return nt;
+}
+
+// Share t with one more proc, for clone.
+struct fdtable*
+fdtabledup(struct fdtable *t)
+{
+  xadd(&t->ref, 1);
+  return t;
+}
+
+// Drop a reference to t.  The last one closes its files
+// and cwd.
+void
+fdtableput(struct fdtable *t)
+{
+  int fd;
+
+  if(xadd(&t->ref, -1) != 1)
+    return;
+  for(fd = 0; fd < NOFILE; fd++){
+    if(t->ofile[fd]){
+      fileclose(t->ofile[fd]);
+      t->ofile[fd] = 0;
+    }
+  }
+  begin_op();
+  iput(t->cwd);
+  end_op();
+  t->cwd = 0;
+
+  acquire(&fdtables.lock);
+  t->nextfree = fdtables.free;
+  fdtables.free = t;
+  release(&fdtables.lock);
+}
+
 // Get metadata about file f.
 int
 filestat(struct file *f, struct stat *st)
@@ -92,6 +193,35 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// Before reading n bytes from f, read ahead if its reads
+// have been sequential: the rest of this read and a window
+// past it, which doubles with each sequential read up to
+// RAMAX blocks and closes when one isn't.  Never more than
+// RAMAX blocks at once, however big the read.  Caller holds
+// f->ip->lock.
+static void
+fileahead(struct file *f, int n)
+{
+  uint start, end;
+
+  if(f->off != f->ranext){
+    f->rawin = 0;
+    f->raend = 0;
+    return;
+  }
+  if(f->rawin == 0)
+    f->rawin = RAMIN;
+  else if(f->rawin < RAMAX)
+    f->rawin *= 2;
+  start = f->off > f->raend ? f->off : f->raend;
+  end = f->off + n + f->rawin*BSIZE;
+  if(end > start + RAMAX*BSIZE)
+    end = start + RAMAX*BSIZE;
+  if(start < end)
+    readahead(f->ip, start, end - start);
+  f->raend = end;
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
@@ -104,8 +234,10 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
+    fileahead(f, n);
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
+    f->ranext = f->off;
     iunlock(f->ip);
     return r;
   }
@@ -6,6 +6,19 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint ranext;  // off, if reads have been sequential
+  uint rawin;   // read-ahead window, in blocks; 0 if none
+  uint raend;   // read ahead up to here
+};
+
+// Open files and current directory of a process, shared with
+// the threads it clones.
+struct fdtable {
+  struct spinlock lock;        // Protects ofile and cwd
+  int ref;                     // Procs using it; changed by xadd
+  struct file *ofile[NOFILE];  // Open files
+  struct inode *cwd;           // Current directory
+  struct fdtable *nextfree;    // Next in fdtables free list
 };
 
 
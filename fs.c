@@ -14,9 +14,11 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
+#include "rwlock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -154,9 +156,14 @@ bfree(int dev, uint b)
 // Many internal file system functions expect the caller to
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
+//
+// icache.lock protects the cache entries' identities and refs.
+// Lookups that hit and idup() only read-lock it, bumping ref
+// atomically, since most lookups hit.  Filling an entry and
+// dropping a ref, which may free one, write-lock it.
 
 struct {
-  struct spinlock lock;
+  struct rwlock lock;
   struct inode inode[NINODE];
 } icache;
 
@@ -165,7 +172,7 @@ iinit(int dev)
 {
   int i = 0;
   
-  initlock(&icache.lock, "icache");
+  initrwlock(&icache.lock, "icache");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
@@ -231,14 +238,25 @@ iget(uint dev, uint inum)
 {
   struct inode *ip, *empty;
 
-  acquire(&icache.lock);
-
   // Is the inode already cached?
+  acquireread(&icache.lock);
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+      xadd(&ip->ref, 1);
+      releaseread(&icache.lock);
+      return ip;
+    }
+  }
+  releaseread(&icache.lock);
+
+  // Look again, since another CPU may have cached it
+  // meanwhile.
+  acquirewrite(&icache.lock);
   empty = 0;
   for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
       ip->ref++;
-      release(&icache.lock);
+      releasewrite(&icache.lock);
       return ip;
     }
     if(empty == 0 && ip->ref == 0)    // Remember empty slot.
@@ -254,7 +272,7 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->flags = 0;
-  release(&icache.lock);
+  releasewrite(&icache.lock);
 
   return ip;
 }
@@ -264,9 +282,9 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  acquireread(&icache.lock);
+  xadd(&ip->ref, 1);
+  releaseread(&icache.lock);
   return ip;
 }
 
@@ -319,18 +337,18 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
-  acquire(&icache.lock);
+  acquirewrite(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
-    release(&icache.lock);
+    releasewrite(&icache.lock);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
-    acquire(&icache.lock);
+    acquirewrite(&icache.lock);
     ip->flags = 0;
   }
   ip->ref--;
-  release(&icache.lock);
+  releasewrite(&icache.lock);
 }
 
 // Common idiom: unlock, then put.
@@ -428,6 +446,24 @@ stati(struct inode *ip, struct stat *st)
 }
 
 //PAGEBREAK!
+// Start reading the blocks holding bytes [off, off+n) of ip,
+// as far as its end, into the buffer cache, without waiting
+// for the disk.  Caller must hold ip->lock.
+void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  end = off + n;
+  if(end < off || end > ip->size)
+    end = ip->size;
+  // bmap won't allocate: these blocks are all below ip->size.
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+}
+
 // Read data from inode.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
@@ -614,8 +650,12 @@ namex(char *path, int nameiparent, char *name)
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
-  else
-    ip = idup(proc->cwd);
+  else {
+    // A thread sharing our cwd may chdir meanwhile.
+    acquire(&proc->fdt->lock);
+    ip = idup(proc->fdt->cwd);
+    release(&proc->fdt->lock);
+  }
 
   while((path = skipelem(path, name)) != 0){
     ilock(ip);
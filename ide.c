@@ -5,10 +5,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -54,7 +54,7 @@ ideinit(void)
 
   initlock(&idelock, "ide");
   picenable(IRQ_IDE);
-  ioapicenable(IRQ_IDE, ncpu - 1);
+  ioapicenable(IRQ_IDE, IRQ_ANYCPU);
   idewait(0);
 
   // Check if disk 1 is present
@@ -105,6 +105,7 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int async;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -120,8 +121,9 @@ ideintr(void)
     insl(0x1f0, b->data, BSIZE/4);
 
   // Wake process waiting for this buf.
+  async = b->flags & B_ASYNC;
   b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
+  b->flags &= ~(B_DIRTY|B_ASYNC);
   wakeup(b);
 
   // Start disk on next buf in queue.
@@ -129,17 +131,36 @@ ideintr(void)
     idestart(idequeue);
 
   release(&idelock);
+
+  // No one waits for a read-ahead; let go of it for them.
+  if(async)
+    brelseahead(b);
 }
 
 //PAGEBREAK!
+// Append b to idequeue, starting the disk if it is idle.
+// Caller must hold idelock.
+static void
+ideappend(struct buf *b)
+{
+  struct buf **pp;
+
+  b->qnext = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+    ;
+  *pp = b;
+
+  // Start disk if necessary.
+  if(idequeue == b)
+    idestart(b);
+}
+
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -148,16 +169,7 @@ iderw(struct buf *b)
     panic("iderw: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
-
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  ideappend(b);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
@@ -166,3 +178,21 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Start reading locked buf b from disk and return without
+// waiting.  ideintr sets B_VALID and releases b when done.
+void
+idereadasync(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("idereadasync: buf not locked");
+  if(b->flags & (B_VALID|B_DIRTY))
+    panic("idereadasync: not a read");
+  if(b->dev != 0 && !havedisk1)
+    panic("idereadasync: ide disk 1 not present");
+
+  acquire(&idelock);
+  b->flags |= B_ASYNC;
+  ideappend(b);
+  release(&idelock);
+}
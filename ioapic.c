@@ -1,10 +1,24 @@
 // The I/O APIC manages hardware interrupts for an SMP system.
 // http://www.intel.com/design/chipsets/datashts/29056601.pdf
 // See also picirq.c.
+//
+// Each device interrupt goes to one CPU.  Drivers normally
+// let the kernel choose: their IRQs are spread round-robin
+// when enabled, and once a second the busiest are moved to
+// the CPUs taking the fewest device interrupts.  irqroute()
+// pins an IRQ to a CPU instead.  Isolated CPUs (see isolate
+// in proc.c) only get interrupts pinned to them.
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
 #include "traps.h"
+#include "x86.h"
+#include "work.h"
+#include "irq.h"
 
 #define IOAPIC  0xFEC00000   // Default physical address of IO APIC
 
@@ -22,8 +36,23 @@
 #define INT_ACTIVELOW  0x00002000  // Active low (vs high)
 #define INT_LOGICAL    0x00000800  // Destination is CPU id (vs APIC ID)
 
+#define BALANCENS 1000000000ULL  // how often to rebalance
+
 volatile struct ioapic *ioapic;
 
+static struct {
+  struct spinlock lock;
+  int maxintr;           // highest IO APIC input
+  int cpu[NIRQ];         // where each input goes; -1 if disabled
+  char pinned[NIRQ];     // routed by irqroute, not balanced
+  uint last[NIRQ];       // interrupts counted when last balanced
+  int next;              // next CPU for round-robin placement
+} irqs;
+
+static uint64 nextbalance;
+static uint balancing;   // balancework is queued; changed by xchg
+static struct work balancework;
+
 // IO APIC MMIO structure: write reg, then read or write data.
 struct ioapic {
   uint reg;
@@ -50,11 +79,15 @@ ioapicinit(void)
 {
   int i, id, maxintr;
 
+  initlock(&irqs.lock, "irqs");
+  for(i = 0; i < NIRQ; i++)
+    irqs.cpu[i] = -1;
   if(!ismp)
     return;
 
   ioapic = (volatile struct ioapic*)IOAPIC;
   maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  irqs.maxintr = maxintr < NIRQ ? maxintr : NIRQ-1;
   id = ioapicread(REG_ID) >> 24;
   if(id != ioapicid)
     cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
@@ -67,15 +100,161 @@ ioapicinit(void)
   }
 }
 
+// Can irqs be sent to cpus[c]?  The redirection entry
+// has room for only an 8-bit APIC ID.
+static int
+routable(int c)
+{
+  return cpus[c].apicid <= 0xFF;
+}
+
+// Send irq to cpus[c], which must be routable.
+// irqs.lock must be held.
+static void
+route(int irq, int c)
+{
+  if(!routable(c))
+    panic("route");
+  ioapicwrite(REG_TABLE+2*irq+1, cpus[c].apicid << 24);
+  irqs.cpu[irq] = c;
+}
+
+// The next routable, non-isolated CPU, round-robin;
+// else the first routable one.
+// irqs.lock must be held.
+static int
+nextcpu(void)
+{
+  int i, c;
+
+  for(i = 0; i < ncpu; i++){
+    c = irqs.next++ % ncpu;
+    if(routable(c) && !((isolated() >> c) & 1))
+      return c;
+  }
+  for(c = 0; c < ncpu; c++)
+    if(routable(c))
+      return c;
+  panic("nextcpu");
+}
+
+// Enable irq, routed to the given cpu, or to one
+// the kernel chooses if cpu is IRQ_ANYCPU.
 void
-ioapicenable(int irq, int cpunum)
+ioapicenable(int irq, int c)
 {
   if(!ismp)
     return;
 
-  // Mark interrupt edge-triggered, active high,
-  // enabled, and routed to the given cpunum,
-  // which happens to be that cpu's APIC ID.
+  acquire(&irqs.lock);
+  if(c >= 0 && c < ncpu && routable(c))
+    irqs.pinned[irq] = 1;
+  else
+    c = nextcpu();
+  // Mark interrupt edge-triggered, active high, enabled.
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
-  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+  route(irq, c);
+  release(&irqs.lock);
+}
+
+// Send irq to cpus[c] and keep it there, or, if c is -1,
+// let balancing move it again.  Fails if irqs can't reach c.
+int
+irqroute(int irq, int c)
+{
+  if(irq < 0 || irq >= NIRQ || c < -1 || c >= ncpu || (c >= 0 && !routable(c)))
+    return -1;
+  acquire(&irqs.lock);
+  if(irqs.cpu[irq] < 0){
+    release(&irqs.lock);
+    return -1;
+  }
+  irqs.pinned[irq] = c >= 0;
+  if(c >= 0)
+    route(irq, c);
+  release(&irqs.lock);
+  return 0;
+}
+
+// Copy the routing and per-CPU counts of up to n IRQs,
+// from IRQ 0, to ii.  Return the number copied.
+int
+irqstat(struct irqinfo *ii, int n)
+{
+  int i, c;
+
+  if(n > NIRQ)
+    n = NIRQ;
+  acquire(&irqs.lock);
+  for(i = 0; i < n; i++, ii++){
+    ii->cpu = irqs.cpu[i];
+    ii->pinned = irqs.pinned[i];
+    for(c = 0; c < NCPU; c++)
+      ii->count[c] = c < ncpu ? cpus[c].nirq[i] : 0;
+  }
+  release(&irqs.lock);
+  return n;
+}
+
+// Move the unpinned IRQs so that each CPU takes about as
+// many device interrupts as the others did over the last
+// period: busiest IRQ first, each to the CPU with the least
+// load so far, preferring the one it is on.  Quiet IRQs stay
+// put unless their CPU has been isolated.  CPUs the I/O APIC
+// can't reach get none.  Run by a worker.
+static void
+balance(void *arg)
+{
+  uint rate[NIRQ], load[NCPU], total, iso;
+  char placed[NIRQ];
+  int i, c, best, irq;
+
+  iso = isolated();
+  acquire(&irqs.lock);
+  for(i = 0; i < NIRQ; i++){
+    total = 0;
+    for(c = 0; c < ncpu; c++)
+      total += cpus[c].nirq[i];
+    rate[i] = total - irqs.last[i];
+    irqs.last[i] = total;
+    placed[i] = irqs.cpu[i] < 0 || irqs.pinned[i] ||
+      (rate[i] == 0 && !((iso >> irqs.cpu[i]) & 1));
+  }
+  memset(load, 0, sizeof(load));
+  for(i = 0; i < NIRQ; i++)
+    if(irqs.cpu[i] >= 0 && irqs.pinned[i])
+      load[irqs.cpu[i]] += rate[i];
+
+  for(;;){
+    irq = -1;
+    for(i = 0; i < NIRQ; i++)
+      if(!placed[i] && (irq < 0 || rate[i] > rate[irq]))
+        irq = i;
+    if(irq < 0)
+      break;
+    placed[irq] = 1;
+    best = (iso >> irqs.cpu[irq]) & 1 ? -1 : irqs.cpu[irq];
+    for(c = 0; c < ncpu; c++)
+      if(routable(c) && !((iso >> c) & 1) && (best < 0 || load[c] < load[best]))
+        best = c;
+    if(best < 0)
+      best = irqs.cpu[irq];
+    load[best] += rate[irq];
+    if(best != irqs.cpu[irq])
+      route(irq, best);
+  }
+  release(&irqs.lock);
+  balancing = 0;
+}
+
+// Called on each timer interrupt with the time; once
+// in a while has a worker rebalance the IRQs.
+void
+irqbalance(uint64 now)
+{
+  if(!ismp || now < nextbalance || xchg(&balancing, 1))
+    return;
+  nextbalance = now + BALANCENS;
+  balancework.fn = balance;
+  queuework(&balancework);
 }
@@ -0,0 +1,10 @@
+// Interrupt routing and counts returned by irqstat(),
+// one per IRQ.  irqroute(irq, cpu) sends a device's
+// interrupts to cpu, or, if cpu is -1, lets the kernel
+// balance it again.
+
+struct irqinfo {
+  int cpu;            // CPU the IRQ is routed to; -1 if none
+  int pinned;         // Routed by irqroute, not balanced
+  uint count[NCPU];   // Interrupts taken on each CPU
+};
@@ -0,0 +1,2211 @@
+
+_irqctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int cpu;
+
+  if(argc == 1){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	74 59                	je     77 <main+0x77>
+    list();
+    exit();
+  }
+  if(argc != 3){
+  1e:	83 fb 03             	cmp    $0x3,%ebx
+  21:	74 13                	je     36 <main+0x36>
+    printf(2, "usage: irqctl [irq cpu|auto]\n");
+  23:	56                   	push   %esi
+  24:	56                   	push   %esi
+  25:	68 f9 0e 00 00       	push   $0xef9
+  2a:	6a 02                	push   $0x2
+  2c:	e8 8f 08 00 00       	call   8c0 <printf>
+    exit();
+  31:	e8 7d 06 00 00       	call   6b3 <exit>
+  }
+  cpu = strcmp(argv[2], "auto") == 0 ? -1 : atoi(argv[2]);
+  36:	53                   	push   %ebx
+  37:	53                   	push   %ebx
+  38:	83 cb ff             	or     $0xffffffff,%ebx
+  3b:	68 17 0f 00 00       	push   $0xf17
+  40:	ff 76 08             	push   0x8(%esi)
+  43:	e8 58 04 00 00       	call   4a0 <strcmp>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	85 c0                	test   %eax,%eax
+  4d:	0f 85 82 01 00 00    	jne    1d5 <main+0x1d5>
+  if(irqroute(atoi(argv[1]), cpu) < 0)
+  53:	83 ec 0c             	sub    $0xc,%esp
+  56:	ff 76 04             	push   0x4(%esi)
+  59:	e8 e2 05 00 00       	call   640 <atoi>
+  5e:	5a                   	pop    %edx
+  5f:	59                   	pop    %ecx
+  60:	53                   	push   %ebx
+  61:	50                   	push   %eax
+  62:	e8 7c 07 00 00       	call   7e3 <irqroute>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	85 c0                	test   %eax,%eax
+  6c:	0f 88 5b 03 00 00    	js     3cd <main+0x3cd>
+    exit();
+  72:	e8 3c 06 00 00       	call   6b3 <exit>
+  n = irqstat(ii, NIRQ);
+  77:	56                   	push   %esi
+  78:	56                   	push   %esi
+  79:	6a 20                	push   $0x20
+  7b:	68 80 14 00 00       	push   $0x1480
+  80:	e8 66 07 00 00       	call   7eb <irqstat>
+  if(n < 0){
+  85:	83 c4 10             	add    $0x10,%esp
+  n = irqstat(ii, NIRQ);
+  88:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  if(n < 0){
+  8b:	85 c0                	test   %eax,%eax
+  8d:	0f 88 5e 03 00 00    	js     3f1 <main+0x3f1>
+  for(i = 0; i < n; i++)
+  93:	74 3d                	je     d2 <main+0xd2>
+  95:	69 c8 88 00 00 00    	imul   $0x88,%eax,%ecx
+  9b:	31 f6                	xor    %esi,%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(c = 0; c < NCPU; c++)
+  a0:	31 c0                	xor    %eax,%eax
+  a2:	89 cf                	mov    %ecx,%edi
+  a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(ii[i].count[c] && c >= ncol)
+  a8:	8b 94 86 88 14 00 00 	mov    0x1488(%esi,%eax,4),%edx
+  af:	85 d2                	test   %edx,%edx
+  b1:	0f 95 c1             	setne  %cl
+  b4:	39 c3                	cmp    %eax,%ebx
+  b6:	0f 9e c2             	setle  %dl
+        ncol = c+1;
+  b9:	83 c0 01             	add    $0x1,%eax
+  bc:	84 d1                	test   %dl,%cl
+  be:	0f 45 d8             	cmovne %eax,%ebx
+    for(c = 0; c < NCPU; c++)
+  c1:	83 f8 20             	cmp    $0x20,%eax
+  c4:	75 e2                	jne    a8 <main+0xa8>
+  for(i = 0; i < n; i++)
+  c6:	81 c6 88 00 00 00    	add    $0x88,%esi
+  cc:	89 f9                	mov    %edi,%ecx
+  ce:	39 f7                	cmp    %esi,%edi
+  d0:	75 ce                	jne    a0 <main+0xa0>
+  printf(1, "IRQ  ROUTE   ");
+  d2:	50                   	push   %eax
+  for(c = 0; c < ncol; c++){
+  d3:	31 f6                	xor    %esi,%esi
+  printf(1, "IRQ  ROUTE   ");
+  d5:	50                   	push   %eax
+  d6:	68 e3 0e 00 00       	push   $0xee3
+  db:	6a 01                	push   $0x1
+  dd:	e8 de 07 00 00       	call   8c0 <printf>
+  for(c = 0; c < ncol; c++){
+  e2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  printf(1, "IRQ  ROUTE   ");
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+    printf(1, "CPU%d", c);
+  f0:	83 ec 04             	sub    $0x4,%esp
+    col("", c < 10 ? 6 : 5);
+  f3:	31 db                	xor    %ebx,%ebx
+    printf(1, "CPU%d", c);
+  f5:	56                   	push   %esi
+  f6:	68 f1 0e 00 00       	push   $0xef1
+  fb:	6a 01                	push   $0x1
+  fd:	e8 be 07 00 00       	call   8c0 <printf>
+    col("", c < 10 ? 6 : 5);
+ 102:	83 fe 0a             	cmp    $0xa,%esi
+  n = strlen(s);
+ 105:	c7 04 24 16 0f 00 00 	movl   $0xf16,(%esp)
+    col("", c < 10 ? 6 : 5);
+ 10c:	0f 9c c3             	setl   %bl
+  n = strlen(s);
+ 10f:	e8 ec 03 00 00       	call   500 <strlen>
+  printf(1, "%s", s);
+ 114:	83 c4 0c             	add    $0xc,%esp
+    col("", c < 10 ? 6 : 5);
+ 117:	83 c3 05             	add    $0x5,%ebx
+  printf(1, "%s", s);
+ 11a:	68 16 0f 00 00       	push   $0xf16
+  n = strlen(s);
+ 11f:	89 c7                	mov    %eax,%edi
+  printf(1, "%s", s);
+ 121:	68 c4 0e 00 00       	push   $0xec4
+ 126:	6a 01                	push   $0x1
+ 128:	e8 93 07 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 12d:	83 c4 10             	add    $0x10,%esp
+ 130:	39 fb                	cmp    %edi,%ebx
+ 132:	7e 1d                	jle    151 <main+0x151>
+ 134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 138:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 13b:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+ 13e:	68 ef 0e 00 00       	push   $0xeef
+ 143:	6a 01                	push   $0x1
+ 145:	e8 76 07 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 14a:	83 c4 10             	add    $0x10,%esp
+ 14d:	39 fb                	cmp    %edi,%ebx
+ 14f:	75 e7                	jne    138 <main+0x138>
+  for(c = 0; c < ncol; c++){
+ 151:	83 c6 01             	add    $0x1,%esi
+ 154:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+ 157:	75 97                	jne    f0 <main+0xf0>
+ 159:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  printf(1, "\n");
+ 15c:	50                   	push   %eax
+ 15d:	50                   	push   %eax
+ 15e:	68 15 0f 00 00       	push   $0xf15
+ 163:	6a 01                	push   $0x1
+ 165:	e8 56 07 00 00       	call   8c0 <printf>
+  for(i = 0; i < n; i++){
+ 16a:	83 c4 10             	add    $0x10,%esp
+ 16d:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+ 171:	0f 84 fb fe ff ff    	je     72 <main+0x72>
+ 177:	8d 04 9d 80 14 00 00 	lea    0x1480(,%ebx,4),%eax
+ 17e:	be 80 14 00 00       	mov    $0x1480,%esi
+ 183:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 186:	31 c0                	xor    %eax,%eax
+ 188:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+    used = ii[i].cpu >= 0;
+ 190:	8b 16                	mov    (%esi),%edx
+ 192:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 195:	89 f0                	mov    %esi,%eax
+ 197:	f7 d2                	not    %edx
+ 199:	c1 ea 1f             	shr    $0x1f,%edx
+    for(c = 0; c < ncol; c++)
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      used |= ii[i].count[c] != 0;
+ 1a0:	8b 78 08             	mov    0x8(%eax),%edi
+ 1a3:	31 c9                	xor    %ecx,%ecx
+ 1a5:	85 ff                	test   %edi,%edi
+ 1a7:	0f 95 c1             	setne  %cl
+    for(c = 0; c < ncol; c++)
+ 1aa:	83 c0 04             	add    $0x4,%eax
+      used |= ii[i].count[c] != 0;
+ 1ad:	09 ca                	or     %ecx,%edx
+    for(c = 0; c < ncol; c++)
+ 1af:	39 c3                	cmp    %eax,%ebx
+ 1b1:	75 ed                	jne    1a0 <main+0x1a0>
+    if(!used)
+ 1b3:	85 d2                	test   %edx,%edx
+ 1b5:	75 33                	jne    1ea <main+0x1ea>
+  for(i = 0; i < n; i++){
+ 1b7:	83 45 cc 01          	addl   $0x1,-0x34(%ebp)
+ 1bb:	81 c6 88 00 00 00    	add    $0x88,%esi
+ 1c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 1c4:	81 45 d0 88 00 00 00 	addl   $0x88,-0x30(%ebp)
+ 1cb:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+ 1ce:	75 c0                	jne    190 <main+0x190>
+ 1d0:	e9 9d fe ff ff       	jmp    72 <main+0x72>
+  cpu = strcmp(argv[2], "auto") == 0 ? -1 : atoi(argv[2]);
+ 1d5:	83 ec 0c             	sub    $0xc,%esp
+ 1d8:	ff 76 08             	push   0x8(%esi)
+ 1db:	e8 60 04 00 00       	call   640 <atoi>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	89 c3                	mov    %eax,%ebx
+ 1e5:	e9 69 fe ff ff       	jmp    53 <main+0x53>
+    buf[--i] = '0' + x % 10;
+ 1ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 1ed:	31 d2                	xor    %edx,%edx
+ 1ef:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  buf[i] = 0;
+ 1f4:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+ 1f8:	f7 f3                	div    %ebx
+ 1fa:	83 c2 30             	add    $0x30,%edx
+  } while((x /= 10) != 0);
+ 1fd:	83 7d cc 09          	cmpl   $0x9,-0x34(%ebp)
+    buf[--i] = '0' + x % 10;
+ 201:	88 55 e6             	mov    %dl,-0x1a(%ebp)
+  } while((x /= 10) != 0);
+ 204:	0f 8e dd 01 00 00    	jle    3e7 <main+0x3e7>
+    buf[--i] = '0' + x % 10;
+ 20a:	83 c0 30             	add    $0x30,%eax
+ 20d:	bb 0d 00 00 00       	mov    $0xd,%ebx
+ 212:	88 45 e5             	mov    %al,-0x1b(%ebp)
+  col(buf+i, w);
+ 215:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 218:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 21b:	01 c3                	add    %eax,%ebx
+  n = strlen(s);
+ 21d:	53                   	push   %ebx
+ 21e:	e8 dd 02 00 00       	call   500 <strlen>
+  printf(1, "%s", s);
+ 223:	83 c4 0c             	add    $0xc,%esp
+ 226:	53                   	push   %ebx
+  n = strlen(s);
+ 227:	89 c7                	mov    %eax,%edi
+  printf(1, "%s", s);
+ 229:	68 c4 0e 00 00       	push   $0xec4
+ 22e:	6a 01                	push   $0x1
+ 230:	e8 8b 06 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	83 ff 04             	cmp    $0x4,%edi
+ 23b:	7f 1d                	jg     25a <main+0x25a>
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+ 240:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 243:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+ 246:	68 ef 0e 00 00       	push   $0xeef
+ 24b:	6a 01                	push   $0x1
+ 24d:	e8 6e 06 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	83 ff 05             	cmp    $0x5,%edi
+ 258:	75 e6                	jne    240 <main+0x240>
+    if(ii[i].cpu < 0)
+ 25a:	8b 0e                	mov    (%esi),%ecx
+ 25c:	85 c9                	test   %ecx,%ecx
+ 25e:	0f 88 55 01 00 00    	js     3b9 <main+0x3b9>
+  buf[i] = 0;
+ 264:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  i = sizeof(buf) - 1;
+ 268:	bb 0f 00 00 00       	mov    $0xf,%ebx
+    buf[--i] = '0' + x % 10;
+ 26d:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+ 272:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 275:	8d 76 00             	lea    0x0(%esi),%esi
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	83 eb 01             	sub    $0x1,%ebx
+ 27d:	f7 e7                	mul    %edi
+ 27f:	89 c8                	mov    %ecx,%eax
+ 281:	c1 ea 03             	shr    $0x3,%edx
+ 284:	8d 34 92             	lea    (%edx,%edx,4),%esi
+ 287:	01 f6                	add    %esi,%esi
+ 289:	29 f0                	sub    %esi,%eax
+ 28b:	83 c0 30             	add    $0x30,%eax
+ 28e:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+ 292:	89 c8                	mov    %ecx,%eax
+ 294:	89 d1                	mov    %edx,%ecx
+ 296:	83 f8 09             	cmp    $0x9,%eax
+ 299:	77 dd                	ja     278 <main+0x278>
+  col(buf+i, w);
+ 29b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 29e:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 2a1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 2a4:	01 c3                	add    %eax,%ebx
+  n = strlen(s);
+ 2a6:	53                   	push   %ebx
+ 2a7:	e8 54 02 00 00       	call   500 <strlen>
+  printf(1, "%s", s);
+ 2ac:	83 c4 0c             	add    $0xc,%esp
+ 2af:	53                   	push   %ebx
+  n = strlen(s);
+ 2b0:	89 c7                	mov    %eax,%edi
+  printf(1, "%s", s);
+ 2b2:	68 c4 0e 00 00       	push   $0xec4
+ 2b7:	6a 01                	push   $0x1
+ 2b9:	e8 02 06 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 2be:	83 c4 10             	add    $0x10,%esp
+ 2c1:	83 ff 02             	cmp    $0x2,%edi
+ 2c4:	7f 24                	jg     2ea <main+0x2ea>
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 2d3:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+ 2d6:	68 ef 0e 00 00       	push   $0xeef
+ 2db:	6a 01                	push   $0x1
+ 2dd:	e8 de 05 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	83 ff 03             	cmp    $0x3,%edi
+ 2e8:	75 e6                	jne    2d0 <main+0x2d0>
+      col(ii[i].pinned ? "pin" : "", 5);
+ 2ea:	ba c7 0e 00 00       	mov    $0xec7,%edx
+ 2ef:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+ 2f3:	b8 16 0f 00 00       	mov    $0xf16,%eax
+ 2f8:	0f 45 c2             	cmovne %edx,%eax
+ 2fb:	ba 05 00 00 00       	mov    $0x5,%edx
+ 300:	e8 0b 01 00 00       	call   410 <col>
+    buf[--i] = '0' + x % 10;
+ 305:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+      col(ii[i].pinned ? "pin" : "", 5);
+ 308:	89 f7                	mov    %esi,%edi
+    buf[--i] = '0' + x % 10;
+ 30a:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+ 30f:	90                   	nop
+  buf[i] = 0;
+ 310:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+      coln(ii[i].count[c], 10);
+ 314:	8b 4f 08             	mov    0x8(%edi),%ecx
+  i = sizeof(buf) - 1;
+ 317:	be 0f 00 00 00       	mov    $0xf,%esi
+ 31c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 31f:	90                   	nop
+    buf[--i] = '0' + x % 10;
+ 320:	89 c8                	mov    %ecx,%eax
+ 322:	83 ee 01             	sub    $0x1,%esi
+ 325:	f7 e3                	mul    %ebx
+ 327:	89 c8                	mov    %ecx,%eax
+ 329:	c1 ea 03             	shr    $0x3,%edx
+ 32c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 32f:	01 ff                	add    %edi,%edi
+ 331:	29 f8                	sub    %edi,%eax
+ 333:	83 c0 30             	add    $0x30,%eax
+ 336:	88 44 35 d8          	mov    %al,-0x28(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ 33a:	89 c8                	mov    %ecx,%eax
+ 33c:	89 d1                	mov    %edx,%ecx
+ 33e:	83 f8 09             	cmp    $0x9,%eax
+ 341:	77 dd                	ja     320 <main+0x320>
+  col(buf+i, w);
+ 343:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 346:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 349:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 34c:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  n = strlen(s);
+ 34f:	52                   	push   %edx
+ 350:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 353:	e8 a8 01 00 00       	call   500 <strlen>
+  printf(1, "%s", s);
+ 358:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 35b:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+ 35e:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+ 360:	52                   	push   %edx
+ 361:	68 c4 0e 00 00       	push   $0xec4
+ 366:	6a 01                	push   $0x1
+ 368:	e8 53 05 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	83 fe 09             	cmp    $0x9,%esi
+ 373:	7f 1d                	jg     392 <main+0x392>
+ 375:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+ 378:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 37b:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+ 37e:	68 ef 0e 00 00       	push   $0xeef
+ 383:	6a 01                	push   $0x1
+ 385:	e8 36 05 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 38a:	83 c4 10             	add    $0x10,%esp
+ 38d:	83 fe 0a             	cmp    $0xa,%esi
+ 390:	75 e6                	jne    378 <main+0x378>
+    for(c = 0; c < ncol; c++)
+ 392:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 395:	83 c7 04             	add    $0x4,%edi
+ 398:	39 c7                	cmp    %eax,%edi
+ 39a:	0f 85 70 ff ff ff    	jne    310 <main+0x310>
+ 3a0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    printf(1, "\n");
+ 3a3:	57                   	push   %edi
+ 3a4:	57                   	push   %edi
+ 3a5:	68 15 0f 00 00       	push   $0xf15
+ 3aa:	6a 01                	push   $0x1
+ 3ac:	e8 0f 05 00 00       	call   8c0 <printf>
+ 3b1:	83 c4 10             	add    $0x10,%esp
+ 3b4:	e9 fe fd ff ff       	jmp    1b7 <main+0x1b7>
+      col("-", 8);
+ 3b9:	ba 08 00 00 00       	mov    $0x8,%edx
+ 3be:	b8 f7 0e 00 00       	mov    $0xef7,%eax
+ 3c3:	e8 48 00 00 00       	call   410 <col>
+    for(c = 0; c < ncol; c++)
+ 3c8:	e9 38 ff ff ff       	jmp    305 <main+0x305>
+    printf(2, "irqctl: cannot route irq %s to %s\n", argv[1], argv[2]);
+ 3cd:	ff 76 08             	push   0x8(%esi)
+ 3d0:	ff 76 04             	push   0x4(%esi)
+ 3d3:	68 1c 0f 00 00       	push   $0xf1c
+ 3d8:	6a 02                	push   $0x2
+ 3da:	e8 e1 04 00 00       	call   8c0 <printf>
+ 3df:	83 c4 10             	add    $0x10,%esp
+ 3e2:	e9 8b fc ff ff       	jmp    72 <main+0x72>
+ 3e7:	bb 0e 00 00 00       	mov    $0xe,%ebx
+ 3ec:	e9 24 fe ff ff       	jmp    215 <main+0x215>
+    printf(2, "irqctl: irqstat failed\n");
+ 3f1:	51                   	push   %ecx
+ 3f2:	51                   	push   %ecx
+ 3f3:	68 cb 0e 00 00       	push   $0xecb
+ 3f8:	6a 02                	push   $0x2
+ 3fa:	e8 c1 04 00 00       	call   8c0 <printf>
+    exit();
+ 3ff:	e8 af 02 00 00       	call   6b3 <exit>
+ 404:	66 90                	xchg   %ax,%ax
+ 406:	66 90                	xchg   %ax,%ax
+ 408:	66 90                	xchg   %ax,%ax
+ 40a:	66 90                	xchg   %ax,%ax
+ 40c:	66 90                	xchg   %ax,%ax
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <col>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	89 c7                	mov    %eax,%edi
+ 416:	56                   	push   %esi
+ 417:	89 d6                	mov    %edx,%esi
+ 419:	53                   	push   %ebx
+ 41a:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+ 41d:	50                   	push   %eax
+ 41e:	e8 dd 00 00 00       	call   500 <strlen>
+  printf(1, "%s", s);
+ 423:	83 c4 0c             	add    $0xc,%esp
+ 426:	57                   	push   %edi
+  n = strlen(s);
+ 427:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 429:	68 c4 0e 00 00       	push   $0xec4
+ 42e:	6a 01                	push   $0x1
+ 430:	e8 8b 04 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 435:	83 c4 10             	add    $0x10,%esp
+ 438:	39 f3                	cmp    %esi,%ebx
+ 43a:	7d 1d                	jge    459 <col+0x49>
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 440:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 443:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 446:	68 ef 0e 00 00       	push   $0xeef
+ 44b:	6a 01                	push   $0x1
+ 44d:	e8 6e 04 00 00       	call   8c0 <printf>
+  for(; n < w; n++)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	39 de                	cmp    %ebx,%esi
+ 457:	75 e7                	jne    440 <col+0x30>
+}
+ 459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+ 461:	66 90                	xchg   %ax,%ax
+ 463:	66 90                	xchg   %ax,%ax
+ 465:	66 90                	xchg   %ax,%ax
+ 467:	66 90                	xchg   %ax,%ax
+ 469:	66 90                	xchg   %ax,%ax
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 470:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 471:	31 c0                	xor    %eax,%eax
+{
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	53                   	push   %ebx
+ 476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 480:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 484:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 487:	83 c0 01             	add    $0x1,%eax
+ 48a:	84 d2                	test   %dl,%dl
+ 48c:	75 f2                	jne    480 <strcpy+0x10>
+    ;
+  return os;
+}
+ 48e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 491:	89 c8                	mov    %ecx,%eax
+ 493:	c9                   	leave
+ 494:	c3                   	ret
+ 495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4aa:	0f b6 02             	movzbl (%edx),%eax
+ 4ad:	84 c0                	test   %al,%al
+ 4af:	75 17                	jne    4c8 <strcmp+0x28>
+ 4b1:	eb 3a                	jmp    4ed <strcmp+0x4d>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4bc:	83 c2 01             	add    $0x1,%edx
+ 4bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4c2:	84 c0                	test   %al,%al
+ 4c4:	74 1a                	je     4e0 <strcmp+0x40>
+    p++, q++;
+ 4c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4cb:	38 c3                	cmp    %al,%bl
+ 4cd:	74 e9                	je     4b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4cf:	29 d8                	sub    %ebx,%eax
+}
+ 4d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d4:	c9                   	leave
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4e4:	31 c0                	xor    %eax,%eax
+ 4e6:	29 d8                	sub    %ebx,%eax
+}
+ 4e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4eb:	c9                   	leave
+ 4ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 4f0:	31 c0                	xor    %eax,%eax
+ 4f2:	eb db                	jmp    4cf <strcmp+0x2f>
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 506:	80 3a 00             	cmpb   $0x0,(%edx)
+ 509:	74 15                	je     520 <strlen+0x20>
+ 50b:	31 c0                	xor    %eax,%eax
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+ 510:	83 c0 01             	add    $0x1,%eax
+ 513:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 517:	89 c1                	mov    %eax,%ecx
+ 519:	75 f5                	jne    510 <strlen+0x10>
+    ;
+  return n;
+}
+ 51b:	89 c8                	mov    %ecx,%eax
+ 51d:	5d                   	pop    %ebp
+ 51e:	c3                   	ret
+ 51f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 520:	31 c9                	xor    %ecx,%ecx
+}
+ 522:	5d                   	pop    %ebp
+ 523:	89 c8                	mov    %ecx,%eax
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 537:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 53a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 53d:	89 d7                	mov    %edx,%edi
+ 53f:	fc                   	cld
+ 540:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 542:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 545:	89 d0                	mov    %edx,%eax
+ 547:	c9                   	leave
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 55a:	0f b6 10             	movzbl (%eax),%edx
+ 55d:	84 d2                	test   %dl,%dl
+ 55f:	75 12                	jne    573 <strchr+0x23>
+ 561:	eb 1d                	jmp    580 <strchr+0x30>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 56c:	83 c0 01             	add    $0x1,%eax
+ 56f:	84 d2                	test   %dl,%dl
+ 571:	74 0d                	je     580 <strchr+0x30>
+    if(*s == c)
+ 573:	38 d1                	cmp    %dl,%cl
+ 575:	75 f1                	jne    568 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 577:	5d                   	pop    %ebp
+ 578:	c3                   	ret
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 580:	31 c0                	xor    %eax,%eax
+}
+ 582:	5d                   	pop    %ebp
+ 583:	c3                   	ret
+ 584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 595:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 598:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 599:	31 db                	xor    %ebx,%ebx
+{
+ 59b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 59e:	eb 27                	jmp    5c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	6a 01                	push   $0x1
+ 5a5:	56                   	push   %esi
+ 5a6:	6a 00                	push   $0x0
+ 5a8:	e8 1e 01 00 00       	call   6cb <read>
+    if(cc < 1)
+ 5ad:	83 c4 10             	add    $0x10,%esp
+ 5b0:	85 c0                	test   %eax,%eax
+ 5b2:	7e 1d                	jle    5d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5bf:	3c 0a                	cmp    $0xa,%al
+ 5c1:	74 10                	je     5d3 <gets+0x43>
+ 5c3:	3c 0d                	cmp    $0xd,%al
+ 5c5:	74 0c                	je     5d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5c7:	89 df                	mov    %ebx,%edi
+ 5c9:	83 c3 01             	add    $0x1,%ebx
+ 5cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5cf:	7c cf                	jl     5a0 <gets+0x10>
+ 5d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dd:	5b                   	pop    %ebx
+ 5de:	5e                   	pop    %esi
+ 5df:	5f                   	pop    %edi
+ 5e0:	5d                   	pop    %ebp
+ 5e1:	c3                   	ret
+ 5e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	56                   	push   %esi
+ 5f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5f5:	83 ec 08             	sub    $0x8,%esp
+ 5f8:	6a 00                	push   $0x0
+ 5fa:	ff 75 08             	push   0x8(%ebp)
+ 5fd:	e8 f1 00 00 00       	call   6f3 <open>
+  if(fd < 0)
+ 602:	83 c4 10             	add    $0x10,%esp
+ 605:	85 c0                	test   %eax,%eax
+ 607:	78 27                	js     630 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 609:	83 ec 08             	sub    $0x8,%esp
+ 60c:	ff 75 0c             	push   0xc(%ebp)
+ 60f:	89 c3                	mov    %eax,%ebx
+ 611:	50                   	push   %eax
+ 612:	e8 f4 00 00 00       	call   70b <fstat>
+  close(fd);
+ 617:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 61a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 61c:	e8 ba 00 00 00       	call   6db <close>
+  return r;
+ 621:	83 c4 10             	add    $0x10,%esp
+}
+ 624:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 627:	89 f0                	mov    %esi,%eax
+ 629:	5b                   	pop    %ebx
+ 62a:	5e                   	pop    %esi
+ 62b:	5d                   	pop    %ebp
+ 62c:	c3                   	ret
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 635:	eb ed                	jmp    624 <stat+0x34>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	53                   	push   %ebx
+ 644:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 647:	0f be 02             	movsbl (%edx),%eax
+ 64a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 64d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 655:	77 1e                	ja     675 <atoi+0x35>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 660:	83 c2 01             	add    $0x1,%edx
+ 663:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 666:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 66a:	0f be 02             	movsbl (%edx),%eax
+ 66d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 670:	80 fb 09             	cmp    $0x9,%bl
+ 673:	76 eb                	jbe    660 <atoi+0x20>
+  return n;
+}
+ 675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 678:	89 c8                	mov    %ecx,%eax
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	8b 45 10             	mov    0x10(%ebp),%eax
+ 688:	8b 55 08             	mov    0x8(%ebp),%edx
+ 68b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 68e:	85 c0                	test   %eax,%eax
+ 690:	7e 13                	jle    6a5 <memmove+0x25>
+ 692:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 694:	89 d7                	mov    %edx,%edi
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6a1:	39 f8                	cmp    %edi,%eax
+ 6a3:	75 fb                	jne    6a0 <memmove+0x20>
+  return vdst;
+}
+ 6a5:	5e                   	pop    %esi
+ 6a6:	89 d0                	mov    %edx,%eax
+ 6a8:	5f                   	pop    %edi
+ 6a9:	5d                   	pop    %ebp
+ 6aa:	c3                   	ret
+
+000006ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <exit>:
+SYSCALL(exit)
+ 6b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <wait>:
+SYSCALL(wait)
+ 6bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <pipe>:
+SYSCALL(pipe)
+ 6c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <read>:
+SYSCALL(read)
+ 6cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <write>:
+SYSCALL(write)
+ 6d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <close>:
+SYSCALL(close)
+ 6db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <kill>:
+SYSCALL(kill)
+ 6e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <exec>:
+SYSCALL(exec)
+ 6eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <open>:
+SYSCALL(open)
+ 6f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <mknod>:
+SYSCALL(mknod)
+ 6fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <unlink>:
+SYSCALL(unlink)
+ 703:	b8 12 00 00 00       	mov    $0x12,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <fstat>:
+SYSCALL(fstat)
+ 70b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <link>:
+SYSCALL(link)
+ 713:	b8 13 00 00 00       	mov    $0x13,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <mkdir>:
+SYSCALL(mkdir)
+ 71b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <chdir>:
+SYSCALL(chdir)
+ 723:	b8 09 00 00 00       	mov    $0x9,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <dup>:
+SYSCALL(dup)
+ 72b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <getpid>:
+SYSCALL(getpid)
+ 733:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <sbrk>:
+SYSCALL(sbrk)
+ 73b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <sleep>:
+SYSCALL(sleep)
+ 743:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <uptime>:
+SYSCALL(uptime)
+ 74b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <add_dir>:
+SYSCALL(add_dir)
+ 753:	b8 16 00 00 00       	mov    $0x16,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <history>:
+SYSCALL(history)
+ 75b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 763:	b8 19 00 00 00       	mov    $0x19,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <nanosleep>:
+SYSCALL(nanosleep)
+ 76b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <clone>:
+SYSCALL(clone)
+ 773:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <join>:
+SYSCALL(join)
+ 77b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <futex_wait>:
+SYSCALL(futex_wait)
+ 783:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <futex_wake>:
+SYSCALL(futex_wake)
+ 78b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 793:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 79b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 7a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <getprocinfo>:
+SYSCALL(getprocinfo)
+ 7ab:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <waitpid>:
+SYSCALL(waitpid)
+ 7b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <tracectl>:
+SYSCALL(tracectl)
+ 7bb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <traceread>:
+SYSCALL(traceread)
+ 7c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 7cb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 7d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 7db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <irqroute>:
+SYSCALL(irqroute)
+ 7e3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <irqstat>:
+SYSCALL(irqstat)
+ 7eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <boottimes>:
+SYSCALL(boottimes)
+ 7f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <lockbench>:
+SYSCALL(lockbench)
+ 7fb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <lockstat>:
+SYSCALL(lockstat)
+ 803:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <cpustat>:
+SYSCALL(cpustat)
+ 80b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <bcachesize>:
+SYSCALL(bcachesize)
+ 813:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+ 81b:	66 90                	xchg   %ax,%ax
+ 81d:	66 90                	xchg   %ax,%ax
+ 81f:	90                   	nop
+
+00000820 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 828:	89 d1                	mov    %edx,%ecx
+{
+ 82a:	83 ec 3c             	sub    $0x3c,%esp
+ 82d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 830:	85 d2                	test   %edx,%edx
+ 832:	0f 89 80 00 00 00    	jns    8b8 <printint+0x98>
+ 838:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 83c:	74 7a                	je     8b8 <printint+0x98>
+    x = -xx;
+ 83e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 840:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 845:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 848:	31 f6                	xor    %esi,%esi
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 850:	89 c8                	mov    %ecx,%eax
+ 852:	31 d2                	xor    %edx,%edx
+ 854:	89 f7                	mov    %esi,%edi
+ 856:	f7 f3                	div    %ebx
+ 858:	8d 76 01             	lea    0x1(%esi),%esi
+ 85b:	0f b6 92 a0 0f 00 00 	movzbl 0xfa0(%edx),%edx
+ 862:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 866:	89 ca                	mov    %ecx,%edx
+ 868:	89 c1                	mov    %eax,%ecx
+ 86a:	39 da                	cmp    %ebx,%edx
+ 86c:	73 e2                	jae    850 <printint+0x30>
+  if(neg)
+ 86e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 871:	85 c0                	test   %eax,%eax
+ 873:	74 07                	je     87c <printint+0x5c>
+    buf[i++] = '-';
+ 875:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 87a:	89 f7                	mov    %esi,%edi
+ 87c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 87f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 882:	01 df                	add    %ebx,%edi
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 888:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 891:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 894:	6a 01                	push   $0x1
+ 896:	50                   	push   %eax
+ 897:	56                   	push   %esi
+ 898:	e8 36 fe ff ff       	call   6d3 <write>
+  while(--i >= 0)
+ 89d:	89 f8                	mov    %edi,%eax
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	83 ef 01             	sub    $0x1,%edi
+ 8a5:	39 d8                	cmp    %ebx,%eax
+ 8a7:	75 df                	jne    888 <printint+0x68>
+}
+ 8a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ac:	5b                   	pop    %ebx
+ 8ad:	5e                   	pop    %esi
+ 8ae:	5f                   	pop    %edi
+ 8af:	5d                   	pop    %ebp
+ 8b0:	c3                   	ret
+ 8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8b8:	31 c0                	xor    %eax,%eax
+ 8ba:	eb 89                	jmp    845 <printint+0x25>
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d2:	83 c6 01             	add    $0x1,%esi
+ 8d5:	84 db                	test   %bl,%bl
+ 8d7:	74 67                	je     940 <printf+0x80>
+ 8d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8dc:	31 d2                	xor    %edx,%edx
+ 8de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8e1:	eb 34                	jmp    917 <printf+0x57>
+ 8e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e7:	90                   	nop
+ 8e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8f0:	83 f8 25             	cmp    $0x25,%eax
+ 8f3:	74 18                	je     90d <printf+0x4d>
+  write(fd, &c, 1);
+ 8f5:	83 ec 04             	sub    $0x4,%esp
+ 8f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fe:	6a 01                	push   $0x1
+ 900:	50                   	push   %eax
+ 901:	57                   	push   %edi
+ 902:	e8 cc fd ff ff       	call   6d3 <write>
+ 907:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 90a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 90d:	0f b6 1e             	movzbl (%esi),%ebx
+ 910:	83 c6 01             	add    $0x1,%esi
+ 913:	84 db                	test   %bl,%bl
+ 915:	74 29                	je     940 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 917:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 91a:	85 d2                	test   %edx,%edx
+ 91c:	74 ca                	je     8e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 91e:	83 fa 25             	cmp    $0x25,%edx
+ 921:	75 ea                	jne    90d <printf+0x4d>
+      if(c == 'd'){
+ 923:	83 f8 25             	cmp    $0x25,%eax
+ 926:	0f 84 24 01 00 00    	je     a50 <printf+0x190>
+ 92c:	83 e8 63             	sub    $0x63,%eax
+ 92f:	83 f8 15             	cmp    $0x15,%eax
+ 932:	77 1c                	ja     950 <printf+0x90>
+ 934:	ff 24 85 48 0f 00 00 	jmp    *0xf48(,%eax,4)
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 943:	5b                   	pop    %ebx
+ 944:	5e                   	pop    %esi
+ 945:	5f                   	pop    %edi
+ 946:	5d                   	pop    %ebp
+ 947:	c3                   	ret
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 956:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 95a:	6a 01                	push   $0x1
+ 95c:	52                   	push   %edx
+ 95d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 960:	57                   	push   %edi
+ 961:	e8 6d fd ff ff       	call   6d3 <write>
+ 966:	83 c4 0c             	add    $0xc,%esp
+ 969:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 96c:	6a 01                	push   $0x1
+ 96e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 971:	52                   	push   %edx
+ 972:	57                   	push   %edi
+ 973:	e8 5b fd ff ff       	call   6d3 <write>
+        putc(fd, c);
+ 978:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 97b:	31 d2                	xor    %edx,%edx
+ 97d:	eb 8e                	jmp    90d <printf+0x4d>
+ 97f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 00                	push   $0x0
+ 98f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 991:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 994:	e8 87 fe ff ff       	call   820 <printint>
+        ap++;
+ 999:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 99c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99f:	31 d2                	xor    %edx,%edx
+ 9a1:	e9 67 ff ff ff       	jmp    90d <printf+0x4d>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9b5:	83 c0 04             	add    $0x4,%eax
+ 9b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9bb:	85 db                	test   %ebx,%ebx
+ 9bd:	0f 84 9d 00 00 00    	je     a60 <printf+0x1a0>
+        while(*s != 0){
+ 9c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	0f 84 3d ff ff ff    	je     90d <printf+0x4d>
+ 9d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9d6:	89 de                	mov    %ebx,%esi
+ 9d8:	89 d3                	mov    %edx,%ebx
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	53                   	push   %ebx
+ 9ec:	57                   	push   %edi
+ 9ed:	e8 e1 fc ff ff       	call   6d3 <write>
+        while(*s != 0){
+ 9f2:	0f b6 06             	movzbl (%esi),%eax
+ 9f5:	83 c4 10             	add    $0x10,%esp
+ 9f8:	84 c0                	test   %al,%al
+ 9fa:	75 e4                	jne    9e0 <printf+0x120>
+      state = 0;
+ 9fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 07 ff ff ff       	jmp    90d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a1b:	8b 13                	mov    (%ebx),%edx
+ a1d:	6a 01                	push   $0x1
+ a1f:	e9 6b ff ff ff       	jmp    98f <printf+0xcf>
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a39:	6a 01                	push   $0x1
+ a3b:	52                   	push   %edx
+ a3c:	57                   	push   %edi
+ a3d:	e8 91 fc ff ff       	call   6d3 <write>
+        ap++;
+ a42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a48:	31 d2                	xor    %edx,%edx
+ a4a:	e9 be fe ff ff       	jmp    90d <printf+0x4d>
+ a4f:	90                   	nop
+  write(fd, &c, 1);
+ a50:	83 ec 04             	sub    $0x4,%esp
+ a53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a59:	6a 01                	push   $0x1
+ a5b:	e9 11 ff ff ff       	jmp    971 <printf+0xb1>
+ a60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a65:	bb 3f 0f 00 00       	mov    $0xf3f,%ebx
+ a6a:	e9 61 ff ff ff       	jmp    9d0 <printf+0x110>
+ a6f:	90                   	nop
+
+00000a70 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ a70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a71:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ a74:	89 e5                	mov    %esp,%ebp
+ a76:	57                   	push   %edi
+ a77:	56                   	push   %esi
+ a78:	53                   	push   %ebx
+ a79:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7b:	a1 84 25 00 00       	mov    0x2584,%eax
+ a80:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a82:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a84:	39 ca                	cmp    %ecx,%edx
+ a86:	73 30                	jae    ab8 <ufree+0x48>
+ a88:	39 c1                	cmp    %eax,%ecx
+ a8a:	72 04                	jb     a90 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a8c:	39 c2                	cmp    %eax,%edx
+ a8e:	72 f0                	jb     a80 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a90:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a93:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a96:	39 f8                	cmp    %edi,%eax
+ a98:	74 26                	je     ac0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a9d:	8b 42 04             	mov    0x4(%edx),%eax
+ aa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aa3:	39 f1                	cmp    %esi,%ecx
+ aa5:	74 30                	je     ad7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aa7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ aa9:	5b                   	pop    %ebx
+  freep = p;
+ aaa:	89 15 84 25 00 00    	mov    %edx,0x2584
+}
+ ab0:	5e                   	pop    %esi
+ ab1:	5f                   	pop    %edi
+ ab2:	5d                   	pop    %ebp
+ ab3:	c3                   	ret
+ ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab8:	39 c1                	cmp    %eax,%ecx
+ aba:	72 d0                	jb     a8c <ufree+0x1c>
+ abc:	eb c2                	jmp    a80 <ufree+0x10>
+ abe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ ac0:	03 70 04             	add    0x4(%eax),%esi
+ ac3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ac6:	8b 02                	mov    (%edx),%eax
+ ac8:	8b 00                	mov    (%eax),%eax
+ aca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ acd:	8b 42 04             	mov    0x4(%edx),%eax
+ ad0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ad3:	39 f1                	cmp    %esi,%ecx
+ ad5:	75 d0                	jne    aa7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ ad7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ ada:	89 15 84 25 00 00    	mov    %edx,0x2584
+    p->s.size += bp->s.size;
+ ae0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ae3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ae6:	89 0a                	mov    %ecx,(%edx)
+}
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	53                   	push   %ebx
+ af4:	83 ec 10             	sub    $0x10,%esp
+ af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ afa:	68 80 25 00 00       	push   $0x2580
+ aff:	e8 ec 01 00 00       	call   cf0 <lock_acquire>
+  ufree(ap);
+ b04:	89 d8                	mov    %ebx,%eax
+ b06:	e8 65 ff ff ff       	call   a70 <ufree>
+  lock_release(&mlock);
+ b0b:	c7 45 08 80 25 00 00 	movl   $0x2580,0x8(%ebp)
+}
+ b12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ b15:	83 c4 10             	add    $0x10,%esp
+}
+ b18:	c9                   	leave
+  lock_release(&mlock);
+ b19:	e9 f2 01 00 00       	jmp    d10 <lock_release>
+ b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	57                   	push   %edi
+ b24:	56                   	push   %esi
+ b25:	53                   	push   %ebx
+ b26:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ b2c:	68 80 25 00 00       	push   $0x2580
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b31:	8d 48 07             	lea    0x7(%eax),%ecx
+ b34:	c1 e9 03             	shr    $0x3,%ecx
+ b37:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ b3a:	e8 b1 01 00 00       	call   cf0 <lock_acquire>
+  if((prevp = freep) == 0){
+ b3f:	8b 15 84 25 00 00    	mov    0x2584,%edx
+ b45:	83 c4 10             	add    $0x10,%esp
+ b48:	85 d2                	test   %edx,%edx
+ b4a:	0f 84 b0 00 00 00    	je     c00 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b50:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ b52:	8b 47 04             	mov    0x4(%edi),%eax
+ b55:	39 f0                	cmp    %esi,%eax
+ b57:	73 6f                	jae    bc8 <malloc+0xa8>
+  if(nu < 4096)
+ b59:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b5e:	39 de                	cmp    %ebx,%esi
+ b60:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b63:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ b6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b6d:	eb 0a                	jmp    b79 <malloc+0x59>
+ b6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b70:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ b72:	8b 47 04             	mov    0x4(%edi),%eax
+ b75:	39 f0                	cmp    %esi,%eax
+ b77:	73 4f                	jae    bc8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b79:	89 fa                	mov    %edi,%edx
+ b7b:	39 3d 84 25 00 00    	cmp    %edi,0x2584
+ b81:	75 ed                	jne    b70 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	ff 75 e4             	push   -0x1c(%ebp)
+ b89:	e8 ad fb ff ff       	call   73b <sbrk>
+  if(p == (char*)-1)
+ b8e:	83 c4 10             	add    $0x10,%esp
+ b91:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b94:	74 15                	je     bab <malloc+0x8b>
+  hp->s.size = nu;
+ b96:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ b99:	83 c0 08             	add    $0x8,%eax
+ b9c:	e8 cf fe ff ff       	call   a70 <ufree>
+  return freep;
+ ba1:	8b 15 84 25 00 00    	mov    0x2584,%edx
+      if((p = morecore(nunits)) == 0){
+ ba7:	85 d2                	test   %edx,%edx
+ ba9:	75 c5                	jne    b70 <malloc+0x50>
+        lock_release(&mlock);
+ bab:	83 ec 0c             	sub    $0xc,%esp
+ bae:	68 80 25 00 00       	push   $0x2580
+ bb3:	e8 58 01 00 00       	call   d10 <lock_release>
+        return 0;
+ bb8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bbe:	31 c0                	xor    %eax,%eax
+}
+ bc0:	5b                   	pop    %ebx
+ bc1:	5e                   	pop    %esi
+ bc2:	5f                   	pop    %edi
+ bc3:	5d                   	pop    %ebp
+ bc4:	c3                   	ret
+ bc5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bc8:	39 c6                	cmp    %eax,%esi
+ bca:	74 64                	je     c30 <malloc+0x110>
+        p->s.size -= nunits;
+ bcc:	29 f0                	sub    %esi,%eax
+ bce:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ bd1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ bd4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ bd7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ bda:	89 15 84 25 00 00    	mov    %edx,0x2584
+      lock_release(&mlock);
+ be0:	68 80 25 00 00       	push   $0x2580
+ be5:	e8 26 01 00 00       	call   d10 <lock_release>
+      return (void*)(p + 1);
+ bea:	83 c4 10             	add    $0x10,%esp
+}
+ bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bf0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ bf3:	5b                   	pop    %ebx
+ bf4:	5e                   	pop    %esi
+ bf5:	5f                   	pop    %edi
+ bf6:	5d                   	pop    %ebp
+ bf7:	c3                   	ret
+ bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ c00:	c7 05 84 25 00 00 88 	movl   $0x2588,0x2584
+ c07:	25 00 00 
+    base.s.size = 0;
+ c0a:	bf 88 25 00 00       	mov    $0x2588,%edi
+    base.s.ptr = freep = prevp = &base;
+ c0f:	c7 05 88 25 00 00 88 	movl   $0x2588,0x2588
+ c16:	25 00 00 
+    base.s.size = 0;
+ c19:	c7 05 8c 25 00 00 00 	movl   $0x0,0x258c
+ c20:	00 00 00 
+    if(p->s.size >= nunits){
+ c23:	e9 31 ff ff ff       	jmp    b59 <malloc+0x39>
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c30:	8b 07                	mov    (%edi),%eax
+ c32:	89 02                	mov    %eax,(%edx)
+ c34:	eb a1                	jmp    bd7 <malloc+0xb7>
+ c36:	66 90                	xchg   %ax,%ax
+ c38:	66 90                	xchg   %ax,%ax
+ c3a:	66 90                	xchg   %ax,%ax
+ c3c:	66 90                	xchg   %ax,%ax
+ c3e:	66 90                	xchg   %ax,%ax
+
+00000c40 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	53                   	push   %ebx
+ c44:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ c47:	68 00 10 00 00       	push   $0x1000
+ c4c:	e8 cf fe ff ff       	call   b20 <malloc>
+ c51:	83 c4 10             	add    $0x10,%esp
+ c54:	85 c0                	test   %eax,%eax
+ c56:	74 37                	je     c8f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ c58:	83 ec 04             	sub    $0x4,%esp
+ c5b:	89 c3                	mov    %eax,%ebx
+ c5d:	50                   	push   %eax
+ c5e:	ff 75 0c             	push   0xc(%ebp)
+ c61:	ff 75 08             	push   0x8(%ebp)
+ c64:	e8 0a fb ff ff       	call   773 <clone>
+ c69:	83 c4 10             	add    $0x10,%esp
+ c6c:	85 c0                	test   %eax,%eax
+ c6e:	78 08                	js     c78 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c73:	c9                   	leave
+ c74:	c3                   	ret
+ c75:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ c78:	83 ec 0c             	sub    $0xc,%esp
+ c7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c7e:	53                   	push   %ebx
+ c7f:	e8 6c fe ff ff       	call   af0 <free>
+ c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ c87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ c8a:	83 c4 10             	add    $0x10,%esp
+}
+ c8d:	c9                   	leave
+ c8e:	c3                   	ret
+    return -1;
+ c8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c94:	eb da                	jmp    c70 <thread_create+0x30>
+ c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ca0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ca6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ca9:	50                   	push   %eax
+ caa:	e8 cc fa ff ff       	call   77b <join>
+ caf:	83 c4 10             	add    $0x10,%esp
+ cb2:	85 c0                	test   %eax,%eax
+ cb4:	79 0a                	jns    cc0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ cb6:	c9                   	leave
+ cb7:	c3                   	ret
+ cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+ cc0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ cc3:	83 ec 0c             	sub    $0xc,%esp
+ cc6:	ff 75 f4             	push   -0xc(%ebp)
+ cc9:	e8 22 fe ff ff       	call   af0 <free>
+ cce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ cd1:	83 c4 10             	add    $0x10,%esp
+}
+ cd4:	c9                   	leave
+ cd5:	c3                   	ret
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ce0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cec:	5d                   	pop    %ebp
+ ced:	c3                   	ret
+ cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ cf0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ cf1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cf6:	89 e5                	mov    %esp,%ebp
+ cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+ cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+ d00:	89 c8                	mov    %ecx,%eax
+ d02:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ d05:	85 c0                	test   %eax,%eax
+ d07:	75 f7                	jne    d00 <lock_acquire+0x10>
+    ;
+}
+ d09:	5d                   	pop    %ebp
+ d0a:	c3                   	ret
+ d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d0f:	90                   	nop
+
+00000d10 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ d10:	55                   	push   %ebp
+ d11:	31 c0                	xor    %eax,%eax
+ d13:	89 e5                	mov    %esp,%ebp
+ d15:	8b 55 08             	mov    0x8(%ebp),%edx
+ d18:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ d1b:	5d                   	pop    %ebp
+ d1c:	c3                   	ret
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d20 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ d23:	8b 45 08             	mov    0x8(%ebp),%eax
+ d26:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ d2c:	5d                   	pop    %ebp
+ d2d:	c3                   	ret
+ d2e:	66 90                	xchg   %ax,%ax
+
+00000d30 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ d30:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ d31:	31 c0                	xor    %eax,%eax
+ d33:	ba 01 00 00 00       	mov    $0x1,%edx
+ d38:	89 e5                	mov    %esp,%ebp
+ d3a:	56                   	push   %esi
+ d3b:	53                   	push   %ebx
+ d3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d3f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ d43:	85 c0                	test   %eax,%eax
+ d45:	74 30                	je     d77 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ d47:	83 f8 02             	cmp    $0x2,%eax
+ d4a:	74 0c                	je     d58 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ d4c:	b8 02 00 00 00       	mov    $0x2,%eax
+ d51:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ d54:	85 c0                	test   %eax,%eax
+ d56:	74 1f                	je     d77 <mutex_lock+0x47>
+ d58:	be 02 00 00 00       	mov    $0x2,%esi
+ d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ d60:	83 ec 08             	sub    $0x8,%esp
+ d63:	6a 02                	push   $0x2
+ d65:	53                   	push   %ebx
+ d66:	e8 18 fa ff ff       	call   783 <futex_wait>
+ d6b:	89 f0                	mov    %esi,%eax
+ d6d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ d70:	83 c4 10             	add    $0x10,%esp
+ d73:	85 c0                	test   %eax,%eax
+ d75:	75 e9                	jne    d60 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ d77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d7a:	5b                   	pop    %ebx
+ d7b:	5e                   	pop    %esi
+ d7c:	5d                   	pop    %ebp
+ d7d:	c3                   	ret
+ d7e:	66 90                	xchg   %ax,%ax
+
+00000d80 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ d80:	55                   	push   %ebp
+ d81:	31 c0                	xor    %eax,%eax
+ d83:	89 e5                	mov    %esp,%ebp
+ d85:	83 ec 08             	sub    $0x8,%esp
+ d88:	8b 55 08             	mov    0x8(%ebp),%edx
+ d8b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ d8e:	83 f8 02             	cmp    $0x2,%eax
+ d91:	74 05                	je     d98 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ d93:	c9                   	leave
+ d94:	c3                   	ret
+ d95:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ d98:	83 ec 08             	sub    $0x8,%esp
+ d9b:	6a 01                	push   $0x1
+ d9d:	52                   	push   %edx
+ d9e:	e8 e8 f9 ff ff       	call   78b <futex_wake>
+ da3:	83 c4 10             	add    $0x10,%esp
+}
+ da6:	c9                   	leave
+ da7:	c3                   	ret
+ da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ daf:	90                   	nop
+
+00000db0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ db0:	55                   	push   %ebp
+ db1:	89 e5                	mov    %esp,%ebp
+ db3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ db6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ dbc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ dc3:	5d                   	pop    %ebp
+ dc4:	c3                   	ret
+ dc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	57                   	push   %edi
+ dd4:	56                   	push   %esi
+ dd5:	53                   	push   %ebx
+ dd6:	83 ec 0c             	sub    $0xc,%esp
+ dd9:	8b 75 08             	mov    0x8(%ebp),%esi
+ ddc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ ddf:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ de4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ de6:	8b 3e                	mov    (%esi),%edi
+ de8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ deb:	83 f8 02             	cmp    $0x2,%eax
+ dee:	74 60                	je     e50 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ df0:	83 ec 08             	sub    $0x8,%esp
+ df3:	57                   	push   %edi
+ df4:	56                   	push   %esi
+ df5:	e8 89 f9 ff ff       	call   783 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ dfa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ dff:	31 c0                	xor    %eax,%eax
+ e01:	ba 01 00 00 00       	mov    $0x1,%edx
+ e06:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ e0a:	83 c4 10             	add    $0x10,%esp
+ e0d:	85 c0                	test   %eax,%eax
+ e0f:	74 36                	je     e47 <cond_wait+0x77>
+  if(c != 2)
+ e11:	83 f8 02             	cmp    $0x2,%eax
+ e14:	74 0c                	je     e22 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ e16:	b8 02 00 00 00       	mov    $0x2,%eax
+ e1b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ e1e:	85 c0                	test   %eax,%eax
+ e20:	74 25                	je     e47 <cond_wait+0x77>
+ e22:	be 02 00 00 00       	mov    $0x2,%esi
+ e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ e30:	83 ec 08             	sub    $0x8,%esp
+ e33:	6a 02                	push   $0x2
+ e35:	53                   	push   %ebx
+ e36:	e8 48 f9 ff ff       	call   783 <futex_wait>
+ e3b:	89 f0                	mov    %esi,%eax
+ e3d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ e40:	83 c4 10             	add    $0x10,%esp
+ e43:	85 c0                	test   %eax,%eax
+ e45:	75 e9                	jne    e30 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e4a:	5b                   	pop    %ebx
+ e4b:	5e                   	pop    %esi
+ e4c:	5f                   	pop    %edi
+ e4d:	5d                   	pop    %ebp
+ e4e:	c3                   	ret
+ e4f:	90                   	nop
+    futex_wake(&m->val, 1);
+ e50:	83 ec 08             	sub    $0x8,%esp
+ e53:	6a 01                	push   $0x1
+ e55:	53                   	push   %ebx
+ e56:	e8 30 f9 ff ff       	call   78b <futex_wake>
+ e5b:	83 c4 10             	add    $0x10,%esp
+ e5e:	eb 90                	jmp    df0 <cond_wait+0x20>
+
+00000e60 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	83 ec 08             	sub    $0x8,%esp
+ e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ e69:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ e6d:	8b 50 04             	mov    0x4(%eax),%edx
+ e70:	85 d2                	test   %edx,%edx
+ e72:	75 0c                	jne    e80 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ e74:	c9                   	leave
+ e75:	c3                   	ret
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ e80:	83 ec 08             	sub    $0x8,%esp
+ e83:	6a 01                	push   $0x1
+ e85:	50                   	push   %eax
+ e86:	e8 00 f9 ff ff       	call   78b <futex_wake>
+ e8b:	83 c4 10             	add    $0x10,%esp
+}
+ e8e:	c9                   	leave
+ e8f:	c3                   	ret
+
+00000e90 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	83 ec 08             	sub    $0x8,%esp
+ e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ e99:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ e9d:	8b 50 04             	mov    0x4(%eax),%edx
+ ea0:	85 d2                	test   %edx,%edx
+ ea2:	75 0c                	jne    eb0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ ea4:	c9                   	leave
+ ea5:	c3                   	ret
+ ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ead:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ eb0:	83 ec 08             	sub    $0x8,%esp
+ eb3:	68 ff ff ff 7f       	push   $0x7fffffff
+ eb8:	50                   	push   %eax
+ eb9:	e8 cd f8 ff ff       	call   78b <futex_wake>
+ ebe:	83 c4 10             	add    $0x10,%esp
+}
+ ec1:	c9                   	leave
+ ec2:	c3                   	ret
@@ -0,0 +1,100 @@
+// Show where interrupts go and how many each CPU has taken,
+// or route a device's IRQ to a CPU.
+// usage: irqctl              list IRQs that are routed or counted
+//        irqctl irq cpu      send irq to cpu and keep it there
+//        irqctl irq auto     let the kernel balance irq again
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "irq.h"
+
+struct irqinfo ii[NIRQ];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+static void
+list(void)
+{
+  int i, c, n, ncol, used;
+
+  n = irqstat(ii, NIRQ);
+  if(n < 0){
+    printf(2, "irqctl: irqstat failed\n");
+    exit();
+  }
+  // Show as many CPUs as have taken any interrupt.
+  ncol = 1;
+  for(i = 0; i < n; i++)
+    for(c = 0; c < NCPU; c++)
+      if(ii[i].count[c] && c >= ncol)
+        ncol = c+1;
+
+  printf(1, "IRQ  ROUTE   ");
+  for(c = 0; c < ncol; c++){
+    printf(1, "CPU%d", c);
+    col("", c < 10 ? 6 : 5);
+  }
+  printf(1, "\n");
+  for(i = 0; i < n; i++){
+    used = ii[i].cpu >= 0;
+    for(c = 0; c < ncol; c++)
+      used |= ii[i].count[c] != 0;
+    if(!used)
+      continue;
+    coln(i, 5);
+    if(ii[i].cpu < 0)
+      col("-", 8);
+    else {
+      coln(ii[i].cpu, 3);
+      col(ii[i].pinned ? "pin" : "", 5);
+    }
+    for(c = 0; c < ncol; c++)
+      coln(ii[i].count[c], 10);
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int cpu;
+
+  if(argc == 1){
+    list();
+    exit();
+  }
+  if(argc != 3){
+    printf(2, "usage: irqctl [irq cpu|auto]\n");
+    exit();
+  }
+  cpu = strcmp(argv[2], "auto") == 0 ? -1 : atoi(argv[2]);
+  if(irqroute(atoi(argv[1]), cpu) < 0)
+    printf(2, "irqctl: cannot route irq %s to %s\n", argv[1], argv[2]);
+  exit();
+}
@@ -19,7 +19,10 @@ struct run {
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  // Away from the lock, so CPUs queueing for it don't
+  // steal the line from the holder.
+  struct run *freelist CACHEALIGN;
+  int nfree;            // pages on freelist
 } kmem;
 
 // Initialization happens in two phases.
@@ -30,7 +33,7 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  initlockkind(&kmem.lock, "kmem", LOCK_MCS);
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -72,6 +75,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -79,18 +83,32 @@ kfree(char *v)
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When memory runs out, takes pages back from the buffer
+// cache, so must not be called holding bcache.lock.
 char*
 kalloc(void)
 {
   struct run *r;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+  for(;;){
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+    }
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    if(r || !kmem.use_lock || !bshrink())
+      return (char*)r;
+  }
+}
+
+// How many pages are free, give or take.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
 }
 
@@ -1,5 +1,7 @@
 // The local APIC manages internal (non-I/O) interrupts.
 // See Chapter 8 & Appendix C of Intel processor manual volume 3.
+// On CPUs that have it, the APIC runs in x2APIC mode, with
+// its registers in MSRs and 32-bit APIC IDs (chapter 10.12).
 
 #include "param.h"
 #include "types.h"
@@ -9,6 +11,7 @@
 #include "traps.h"
 #include "mmu.h"
 #include "x86.h"
+#include "spinlock.h"
 #include "proc.h"  // ncpu
 
 // Local APIC registers, divided by 4 for use as uint[] indices.
@@ -42,32 +45,86 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define MSR_APICBASE  0x1B       // IA32_APIC_BASE
+  #define APIC_X2     0x400        // x2APIC mode
+  #define APIC_EN     0x800        // APIC enabled
+#define MSR_X2APIC    0x800      // x2APIC registers, one MSR per 16 bytes
+#define CPUID_X2APIC  (1<<21)    // cpuid(1) %ecx: x2APIC supported
+
 volatile uint *lapic;  // Initialized in mp.c
+static uint lapickhz;  // Timer counts per millisecond
+static int x2apic;     // Registers are MSRs; set by the first lapicinit
+
+static uint
+lapicr(int index)
+{
+  if(x2apic)
+    return rdmsr(MSR_X2APIC + index/4);
+  return lapic[index];
+}
 
 static void
 lapicw(int index, int value)
 {
+  if(x2apic){
+    wrmsr(MSR_X2APIC + index/4, (uint)value);
+    return;
+  }
   lapic[index] = value;
   lapic[ID];  // wait for write to finish, by reading
 }
+
+// Send an interprocessor interrupt, as described by the
+// ICRLO bits in cmd, to the CPU with the given APIC ID,
+// and wait for it to be delivered.
+static void
+lapicicr(uint apicid, uint cmd)
+{
+  if(x2apic){
+    // One 64-bit register, and no delivery status.
+    wrmsr(MSR_X2APIC + ICRLO/4, (uint64)apicid << 32 | cmd);
+    return;
+  }
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, cmd);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
 //PAGEBREAK!
 
 void
 lapicinit(void)
 {
+  uint ecx;
+
   if(!lapic)
     return;
 
+  // Switch to x2APIC mode if the boot CPU can; the
+  // others follow it.
+  if(lapickhz == 0){
+    cpuid(1, 0, 0, &ecx, 0);
+    x2apic = (ecx & CPUID_X2APIC) != 0;
+  }
+  if(x2apic)
+    wrmsr(MSR_APICBASE, rdmsr(MSR_APICBASE) | APIC_EN | APIC_X2);
+
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down once at bus frequency from
+  // lapic[TICR] and then issues an interrupt; clockintr()
+  // re-arms it.  The bus frequency is calibrated against
+  // the TSC on the first CPU to get here.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  if(lapickhz == 0){
+    lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, 0xFFFFFFFF);
+    microdelay(10000);
+    lapickhz = (0xFFFFFFFF - lapicr(TCCR)) / 10;
+  }
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicarm(TICKNS);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -75,7 +132,7 @@ lapicinit(void)
 
   // Disable performance counter overflow interrupts
   // on machines that provide that interrupt entry.
-  if(((lapic[VER]>>16) & 0xFF) >= 4)
+  if(((lapicr(VER)>>16) & 0xFF) >= 4)
     lapicw(PCINT, MASKED);
 
   // Map error interrupt to IRQ_ERROR.
@@ -89,10 +146,9 @@ lapicinit(void)
   lapicw(EOI, 0);
 
   // Send an Init Level De-Assert to synchronise arbitration ID's.
-  lapicw(ICRHI, 0);
-  lapicw(ICRLO, BCAST | INIT | LEVEL);
-  while(lapic[ICRLO] & DELIVS)
-    ;
+  // x2APICs have no arbitration IDs, and don't allow it.
+  if(!x2apic)
+    lapicicr(0, BCAST | INIT | LEVEL);
 
   // Enable interrupts on the APIC (but not on the processor).
   lapicw(TPR, 0);
@@ -118,7 +174,7 @@ cpunum(void)
   if (!lapic)
     return 0;
 
-  apicid = lapic[ID] >> 24;
+  apicid = x2apic ? lapicr(ID) : lapicr(ID) >> 24;
   for (i = 0; i < ncpu; ++i) {
     if (cpus[i].apicid == apicid)
       return i;
@@ -134,23 +190,55 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(uint apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicicr(apicid, FIXED | ASSERT | vector);
+}
+
+// Arm the timer to interrupt once, ns nanoseconds from now.
+void
+lapicarm(uint64 ns)
+{
+  uint64 count;
+
+  if(!lapic)
+    return;
+  if(ns > 1000000000)
+    ns = 1000000000;
+  count = divu64(ns * lapickhz, 1000000);
+  if(count == 0)
+    count = 1;
+  lapicw(TICR, count);
+}
+
 // Spin for a given number of microseconds.
-// On real hardware would want to tune this dynamically.
 void
 microdelay(int us)
 {
+  uint64 end;
+
+  end = rdtsc() + divu64((uint64)us * tsckhz, 1000);
+  while(rdtsc() < end)
+    ;
 }
 
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
-// Start additional processor running entry code at addr.
+// Start every other processor running entry code at addr,
+// all at once: each step of the startup sequence goes to all
+// of them before the delay that follows it.
 // See Appendix B of MultiProcessor Specification.
 void
-lapicstartap(uchar apicid, uint addr)
+lapicstartaps(uint addr)
 {
   int i;
   ushort *wrv;
+  struct cpu *c, *self;
 
   // "The BSP must initialize CMOS shutdown code to 0AH
   // and the warm reset vector (DWORD based at 40:67) to point at
@@ -162,11 +250,16 @@ lapicstartap(uchar apicid, uint addr)
   wrv[1] = addr >> 4;
 
   // "Universal startup algorithm."
-  // Send INIT (level-triggered) interrupt to reset other CPU.
-  lapicw(ICRHI, apicid<<24);
-  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+  // Send INIT (level-triggered) interrupt to reset other CPUs.
+  self = &cpus[cpunum()];
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != self)
+      lapicicr(c->apicid, INIT | LEVEL | ASSERT);
   microdelay(200);
-  lapicw(ICRLO, INIT | LEVEL);
+  if(!x2apic)   // de-assert; x2APICs don't
+    for(c = cpus; c < cpus+ncpu; c++)
+      if(c != self)
+        lapicicr(c->apicid, INIT | LEVEL);
   microdelay(100);    // should be 10ms, but too slow in Bochs!
 
   // Send startup IPI (twice!) to enter code.
@@ -175,8 +268,9 @@ lapicstartap(uchar apicid, uint addr)
   // should be ignored, but it is part of the official Intel algorithm.
   // Bochs complains about the second one.  Too bad for Bochs.
   for(i = 0; i < 2; i++){
-    lapicw(ICRHI, apicid<<24);
-    lapicw(ICRLO, STARTUP | (addr>>12));
+    for(c = cpus; c < cpus+ncpu; c++)
+      if(c != self)
+        lapicicr(c->apicid, STARTUP | (addr>>12));
     microdelay(200);
   }
 }
@@ -0,0 +1,1746 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 b4 0a 00 00       	push   $0xab4
+  1e:	6a 02                	push   $0x2
+  20:	e8 8b 04 00 00       	call   4b0 <printf>
+    exit();
+  25:	e8 79 02 00 00       	call   2a3 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 cc 02 00 00       	call   303 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 60 02 00 00       	call   2a3 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 c7 0a 00 00       	push   $0xac7
+  4e:	6a 02                	push   $0x2
+  50:	e8 5b 04 00 00       	call   4b0 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 1e 01 00 00       	call   2bb <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 f1 00 00 00       	call   2e3 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 f4 00 00 00       	call   2fb <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 ba 00 00 00       	call   2cb <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+
+0000029b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 29b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <exit>:
+SYSCALL(exit)
+ 2a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <wait>:
+SYSCALL(wait)
+ 2ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <pipe>:
+SYSCALL(pipe)
+ 2b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <read>:
+SYSCALL(read)
+ 2bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <write>:
+SYSCALL(write)
+ 2c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <close>:
+SYSCALL(close)
+ 2cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <kill>:
+SYSCALL(kill)
+ 2d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <exec>:
+SYSCALL(exec)
+ 2db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <open>:
+SYSCALL(open)
+ 2e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <mknod>:
+SYSCALL(mknod)
+ 2eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <unlink>:
+SYSCALL(unlink)
+ 2f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <fstat>:
+SYSCALL(fstat)
+ 2fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <link>:
+SYSCALL(link)
+ 303:	b8 13 00 00 00       	mov    $0x13,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mkdir>:
+SYSCALL(mkdir)
+ 30b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <chdir>:
+SYSCALL(chdir)
+ 313:	b8 09 00 00 00       	mov    $0x9,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <dup>:
+SYSCALL(dup)
+ 31b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <getpid>:
+SYSCALL(getpid)
+ 323:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <sbrk>:
+SYSCALL(sbrk)
+ 32b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <sleep>:
+SYSCALL(sleep)
+ 333:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <uptime>:
+SYSCALL(uptime)
+ 33b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <add_dir>:
+SYSCALL(add_dir)
+ 343:	b8 16 00 00 00       	mov    $0x16,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <history>:
+SYSCALL(history)
+ 34b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 353:	b8 19 00 00 00       	mov    $0x19,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <nanosleep>:
+SYSCALL(nanosleep)
+ 35b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <clone>:
+SYSCALL(clone)
+ 363:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <join>:
+SYSCALL(join)
+ 36b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <futex_wait>:
+SYSCALL(futex_wait)
+ 373:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <futex_wake>:
+SYSCALL(futex_wake)
+ 37b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 383:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 38b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 393:	b8 21 00 00 00       	mov    $0x21,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 39b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <waitpid>:
+SYSCALL(waitpid)
+ 3a3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <tracectl>:
+SYSCALL(tracectl)
+ 3ab:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <traceread>:
+SYSCALL(traceread)
+ 3b3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 3bb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 3c3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 3cb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <irqroute>:
+SYSCALL(irqroute)
+ 3d3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <irqstat>:
+SYSCALL(irqstat)
+ 3db:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <boottimes>:
+SYSCALL(boottimes)
+ 3e3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <lockbench>:
+SYSCALL(lockbench)
+ 3eb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <lockstat>:
+SYSCALL(lockstat)
+ 3f3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <cpustat>:
+SYSCALL(cpustat)
+ 3fb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <bcachesize>:
+SYSCALL(bcachesize)
+ 403:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+ 40b:	66 90                	xchg   %ax,%ax
+ 40d:	66 90                	xchg   %ax,%ax
+ 40f:	90                   	nop
+
+00000410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 418:	89 d1                	mov    %edx,%ecx
+{
+ 41a:	83 ec 3c             	sub    $0x3c,%esp
+ 41d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 420:	85 d2                	test   %edx,%edx
+ 422:	0f 89 80 00 00 00    	jns    4a8 <printint+0x98>
+ 428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 42c:	74 7a                	je     4a8 <printint+0x98>
+    x = -xx;
+ 42e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 438:	31 f6                	xor    %esi,%esi
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 440:	89 c8                	mov    %ecx,%eax
+ 442:	31 d2                	xor    %edx,%edx
+ 444:	89 f7                	mov    %esi,%edi
+ 446:	f7 f3                	div    %ebx
+ 448:	8d 76 01             	lea    0x1(%esi),%esi
+ 44b:	0f b6 92 3c 0b 00 00 	movzbl 0xb3c(%edx),%edx
+ 452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 456:	89 ca                	mov    %ecx,%edx
+ 458:	89 c1                	mov    %eax,%ecx
+ 45a:	39 da                	cmp    %ebx,%edx
+ 45c:	73 e2                	jae    440 <printint+0x30>
+  if(neg)
+ 45e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 461:	85 c0                	test   %eax,%eax
+ 463:	74 07                	je     46c <printint+0x5c>
+    buf[i++] = '-';
+ 465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 46a:	89 f7                	mov    %esi,%edi
+ 46c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 46f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 472:	01 df                	add    %ebx,%edi
+ 474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 47b:	83 ec 04             	sub    $0x4,%esp
+ 47e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 484:	6a 01                	push   $0x1
+ 486:	50                   	push   %eax
+ 487:	56                   	push   %esi
+ 488:	e8 36 fe ff ff       	call   2c3 <write>
+  while(--i >= 0)
+ 48d:	89 f8                	mov    %edi,%eax
+ 48f:	83 c4 10             	add    $0x10,%esp
+ 492:	83 ef 01             	sub    $0x1,%edi
+ 495:	39 d8                	cmp    %ebx,%eax
+ 497:	75 df                	jne    478 <printint+0x68>
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4a8:	31 c0                	xor    %eax,%eax
+ 4aa:	eb 89                	jmp    435 <printint+0x25>
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c2:	83 c6 01             	add    $0x1,%esi
+ 4c5:	84 db                	test   %bl,%bl
+ 4c7:	74 67                	je     530 <printf+0x80>
+ 4c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4cc:	31 d2                	xor    %edx,%edx
+ 4ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4d1:	eb 34                	jmp    507 <printf+0x57>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4e0:	83 f8 25             	cmp    $0x25,%eax
+ 4e3:	74 18                	je     4fd <printf+0x4d>
+  write(fd, &c, 1);
+ 4e5:	83 ec 04             	sub    $0x4,%esp
+ 4e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	50                   	push   %eax
+ 4f1:	57                   	push   %edi
+ 4f2:	e8 cc fd ff ff       	call   2c3 <write>
+ 4f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 500:	83 c6 01             	add    $0x1,%esi
+ 503:	84 db                	test   %bl,%bl
+ 505:	74 29                	je     530 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 50a:	85 d2                	test   %edx,%edx
+ 50c:	74 ca                	je     4d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 50e:	83 fa 25             	cmp    $0x25,%edx
+ 511:	75 ea                	jne    4fd <printf+0x4d>
+      if(c == 'd'){
+ 513:	83 f8 25             	cmp    $0x25,%eax
+ 516:	0f 84 24 01 00 00    	je     640 <printf+0x190>
+ 51c:	83 e8 63             	sub    $0x63,%eax
+ 51f:	83 f8 15             	cmp    $0x15,%eax
+ 522:	77 1c                	ja     540 <printf+0x90>
+ 524:	ff 24 85 e4 0a 00 00 	jmp    *0xae4(,%eax,4)
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 533:	5b                   	pop    %ebx
+ 534:	5e                   	pop    %esi
+ 535:	5f                   	pop    %edi
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+  write(fd, &c, 1);
+ 540:	83 ec 04             	sub    $0x4,%esp
+ 543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 54a:	6a 01                	push   $0x1
+ 54c:	52                   	push   %edx
+ 54d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 550:	57                   	push   %edi
+ 551:	e8 6d fd ff ff       	call   2c3 <write>
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 55c:	6a 01                	push   $0x1
+ 55e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 561:	52                   	push   %edx
+ 562:	57                   	push   %edi
+ 563:	e8 5b fd ff ff       	call   2c3 <write>
+        putc(fd, c);
+ 568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56b:	31 d2                	xor    %edx,%edx
+ 56d:	eb 8e                	jmp    4fd <printf+0x4d>
+ 56f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 573:	83 ec 0c             	sub    $0xc,%esp
+ 576:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 57b:	8b 13                	mov    (%ebx),%edx
+ 57d:	6a 00                	push   $0x0
+ 57f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 584:	e8 87 fe ff ff       	call   410 <printint>
+        ap++;
+ 589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 58c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 67 ff ff ff       	jmp    4fd <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5ab:	85 db                	test   %ebx,%ebx
+ 5ad:	0f 84 9d 00 00 00    	je     650 <printf+0x1a0>
+        while(*s != 0){
+ 5b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	0f 84 3d ff ff ff    	je     4fd <printf+0x4d>
+ 5c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5c6:	89 de                	mov    %ebx,%esi
+ 5c8:	89 d3                	mov    %edx,%ebx
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	53                   	push   %ebx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 e1 fc ff ff       	call   2c3 <write>
+        while(*s != 0){
+ 5e2:	0f b6 06             	movzbl (%esi),%eax
+ 5e5:	83 c4 10             	add    $0x10,%esp
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	75 e4                	jne    5d0 <printf+0x120>
+      state = 0;
+ 5ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 07 ff ff ff       	jmp    4fd <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 01                	push   $0x1
+ 60f:	e9 6b ff ff ff       	jmp    57f <printf+0xcf>
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	52                   	push   %edx
+ 62c:	57                   	push   %edi
+ 62d:	e8 91 fc ff ff       	call   2c3 <write>
+        ap++;
+ 632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 638:	31 d2                	xor    %edx,%edx
+ 63a:	e9 be fe ff ff       	jmp    4fd <printf+0x4d>
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 649:	6a 01                	push   $0x1
+ 64b:	e9 11 ff ff ff       	jmp    561 <printf+0xb1>
+ 650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 655:	bb db 0a 00 00       	mov    $0xadb,%ebx
+ 65a:	e9 61 ff ff ff       	jmp    5c0 <printf+0x110>
+ 65f:	90                   	nop
+
+00000660 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 660:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 661:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 664:	89 e5                	mov    %esp,%ebp
+ 666:	57                   	push   %edi
+ 667:	56                   	push   %esi
+ 668:	53                   	push   %ebx
+ 669:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66b:	a1 cc 0f 00 00       	mov    0xfcc,%eax
+ 670:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 672:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 674:	39 ca                	cmp    %ecx,%edx
+ 676:	73 30                	jae    6a8 <ufree+0x48>
+ 678:	39 c1                	cmp    %eax,%ecx
+ 67a:	72 04                	jb     680 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67c:	39 c2                	cmp    %eax,%edx
+ 67e:	72 f0                	jb     670 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 680:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 683:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 686:	39 f8                	cmp    %edi,%eax
+ 688:	74 26                	je     6b0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 68a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 68d:	8b 42 04             	mov    0x4(%edx),%eax
+ 690:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 693:	39 f1                	cmp    %esi,%ecx
+ 695:	74 30                	je     6c7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 697:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 699:	5b                   	pop    %ebx
+  freep = p;
+ 69a:	89 15 cc 0f 00 00    	mov    %edx,0xfcc
+}
+ 6a0:	5e                   	pop    %esi
+ 6a1:	5f                   	pop    %edi
+ 6a2:	5d                   	pop    %ebp
+ 6a3:	c3                   	ret
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a8:	39 c1                	cmp    %eax,%ecx
+ 6aa:	72 d0                	jb     67c <ufree+0x1c>
+ 6ac:	eb c2                	jmp    670 <ufree+0x10>
+ 6ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6b0:	03 70 04             	add    0x4(%eax),%esi
+ 6b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b6:	8b 02                	mov    (%edx),%eax
+ 6b8:	8b 00                	mov    (%eax),%eax
+ 6ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6c3:	39 f1                	cmp    %esi,%ecx
+ 6c5:	75 d0                	jne    697 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 6c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ca:	89 15 cc 0f 00 00    	mov    %edx,0xfcc
+    p->s.size += bp->s.size;
+ 6d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6d8:	5b                   	pop    %ebx
+ 6d9:	5e                   	pop    %esi
+ 6da:	5f                   	pop    %edi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	53                   	push   %ebx
+ 6e4:	83 ec 10             	sub    $0x10,%esp
+ 6e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 6ea:	68 c8 0f 00 00       	push   $0xfc8
+ 6ef:	e8 ec 01 00 00       	call   8e0 <lock_acquire>
+  ufree(ap);
+ 6f4:	89 d8                	mov    %ebx,%eax
+ 6f6:	e8 65 ff ff ff       	call   660 <ufree>
+  lock_release(&mlock);
+ 6fb:	c7 45 08 c8 0f 00 00 	movl   $0xfc8,0x8(%ebp)
+}
+ 702:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 705:	83 c4 10             	add    $0x10,%esp
+}
+ 708:	c9                   	leave
+  lock_release(&mlock);
+ 709:	e9 f2 01 00 00       	jmp    900 <lock_release>
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 719:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 71c:	68 c8 0f 00 00       	push   $0xfc8
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 721:	8d 48 07             	lea    0x7(%eax),%ecx
+ 724:	c1 e9 03             	shr    $0x3,%ecx
+ 727:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 72a:	e8 b1 01 00 00       	call   8e0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 72f:	8b 15 cc 0f 00 00    	mov    0xfcc,%edx
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	85 d2                	test   %edx,%edx
+ 73a:	0f 84 b0 00 00 00    	je     7f0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 740:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 742:	8b 47 04             	mov    0x4(%edi),%eax
+ 745:	39 f0                	cmp    %esi,%eax
+ 747:	73 6f                	jae    7b8 <malloc+0xa8>
+  if(nu < 4096)
+ 749:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 74e:	39 de                	cmp    %ebx,%esi
+ 750:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 753:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 75a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 75d:	eb 0a                	jmp    769 <malloc+0x59>
+ 75f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 760:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 762:	8b 47 04             	mov    0x4(%edi),%eax
+ 765:	39 f0                	cmp    %esi,%eax
+ 767:	73 4f                	jae    7b8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 769:	89 fa                	mov    %edi,%edx
+ 76b:	39 3d cc 0f 00 00    	cmp    %edi,0xfcc
+ 771:	75 ed                	jne    760 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	ff 75 e4             	push   -0x1c(%ebp)
+ 779:	e8 ad fb ff ff       	call   32b <sbrk>
+  if(p == (char*)-1)
+ 77e:	83 c4 10             	add    $0x10,%esp
+ 781:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 784:	74 15                	je     79b <malloc+0x8b>
+  hp->s.size = nu;
+ 786:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 789:	83 c0 08             	add    $0x8,%eax
+ 78c:	e8 cf fe ff ff       	call   660 <ufree>
+  return freep;
+ 791:	8b 15 cc 0f 00 00    	mov    0xfcc,%edx
+      if((p = morecore(nunits)) == 0){
+ 797:	85 d2                	test   %edx,%edx
+ 799:	75 c5                	jne    760 <malloc+0x50>
+        lock_release(&mlock);
+ 79b:	83 ec 0c             	sub    $0xc,%esp
+ 79e:	68 c8 0f 00 00       	push   $0xfc8
+ 7a3:	e8 58 01 00 00       	call   900 <lock_release>
+        return 0;
+ 7a8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 7ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7ae:	31 c0                	xor    %eax,%eax
+}
+ 7b0:	5b                   	pop    %ebx
+ 7b1:	5e                   	pop    %esi
+ 7b2:	5f                   	pop    %edi
+ 7b3:	5d                   	pop    %ebp
+ 7b4:	c3                   	ret
+ 7b5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7b8:	39 c6                	cmp    %eax,%esi
+ 7ba:	74 64                	je     820 <malloc+0x110>
+        p->s.size -= nunits;
+ 7bc:	29 f0                	sub    %esi,%eax
+ 7be:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 7c1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 7c4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 7c7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 7ca:	89 15 cc 0f 00 00    	mov    %edx,0xfcc
+      lock_release(&mlock);
+ 7d0:	68 c8 0f 00 00       	push   $0xfc8
+ 7d5:	e8 26 01 00 00       	call   900 <lock_release>
+      return (void*)(p + 1);
+ 7da:	83 c4 10             	add    $0x10,%esp
+}
+ 7dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7e0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 7e3:	5b                   	pop    %ebx
+ 7e4:	5e                   	pop    %esi
+ 7e5:	5f                   	pop    %edi
+ 7e6:	5d                   	pop    %ebp
+ 7e7:	c3                   	ret
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 7f0:	c7 05 cc 0f 00 00 d0 	movl   $0xfd0,0xfcc
+ 7f7:	0f 00 00 
+    base.s.size = 0;
+ 7fa:	bf d0 0f 00 00       	mov    $0xfd0,%edi
+    base.s.ptr = freep = prevp = &base;
+ 7ff:	c7 05 d0 0f 00 00 d0 	movl   $0xfd0,0xfd0
+ 806:	0f 00 00 
+    base.s.size = 0;
+ 809:	c7 05 d4 0f 00 00 00 	movl   $0x0,0xfd4
+ 810:	00 00 00 
+    if(p->s.size >= nunits){
+ 813:	e9 31 ff ff ff       	jmp    749 <malloc+0x39>
+ 818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 820:	8b 07                	mov    (%edi),%eax
+ 822:	89 02                	mov    %eax,(%edx)
+ 824:	eb a1                	jmp    7c7 <malloc+0xb7>
+ 826:	66 90                	xchg   %ax,%ax
+ 828:	66 90                	xchg   %ax,%ax
+ 82a:	66 90                	xchg   %ax,%ax
+ 82c:	66 90                	xchg   %ax,%ax
+ 82e:	66 90                	xchg   %ax,%ax
+
+00000830 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	53                   	push   %ebx
+ 834:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 837:	68 00 10 00 00       	push   $0x1000
+ 83c:	e8 cf fe ff ff       	call   710 <malloc>
+ 841:	83 c4 10             	add    $0x10,%esp
+ 844:	85 c0                	test   %eax,%eax
+ 846:	74 37                	je     87f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 848:	83 ec 04             	sub    $0x4,%esp
+ 84b:	89 c3                	mov    %eax,%ebx
+ 84d:	50                   	push   %eax
+ 84e:	ff 75 0c             	push   0xc(%ebp)
+ 851:	ff 75 08             	push   0x8(%ebp)
+ 854:	e8 0a fb ff ff       	call   363 <clone>
+ 859:	83 c4 10             	add    $0x10,%esp
+ 85c:	85 c0                	test   %eax,%eax
+ 85e:	78 08                	js     868 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 863:	c9                   	leave
+ 864:	c3                   	ret
+ 865:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 868:	83 ec 0c             	sub    $0xc,%esp
+ 86b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 86e:	53                   	push   %ebx
+ 86f:	e8 6c fe ff ff       	call   6e0 <free>
+ 874:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 87a:	83 c4 10             	add    $0x10,%esp
+}
+ 87d:	c9                   	leave
+ 87e:	c3                   	ret
+    return -1;
+ 87f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 884:	eb da                	jmp    860 <thread_create+0x30>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 896:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 899:	50                   	push   %eax
+ 89a:	e8 cc fa ff ff       	call   36b <join>
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	85 c0                	test   %eax,%eax
+ 8a4:	79 0a                	jns    8b0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 8a6:	c9                   	leave
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+ 8b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	ff 75 f4             	push   -0xc(%ebp)
+ 8b9:	e8 22 fe ff ff       	call   6e0 <free>
+ 8be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c1:	83 c4 10             	add    $0x10,%esp
+}
+ 8c4:	c9                   	leave
+ 8c5:	c3                   	ret
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 8d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8dc:	5d                   	pop    %ebp
+ 8dd:	c3                   	ret
+ 8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 8e0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8e6:	89 e5                	mov    %esp,%ebp
+ 8e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+ 8f0:	89 c8                	mov    %ecx,%eax
+ 8f2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 8f5:	85 c0                	test   %eax,%eax
+ 8f7:	75 f7                	jne    8f0 <lock_acquire+0x10>
+    ;
+}
+ 8f9:	5d                   	pop    %ebp
+ 8fa:	c3                   	ret
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+
+00000900 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 900:	55                   	push   %ebp
+ 901:	31 c0                	xor    %eax,%eax
+ 903:	89 e5                	mov    %esp,%ebp
+ 905:	8b 55 08             	mov    0x8(%ebp),%edx
+ 908:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 90b:	5d                   	pop    %ebp
+ 90c:	c3                   	ret
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 913:	8b 45 08             	mov    0x8(%ebp),%eax
+ 916:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 91c:	5d                   	pop    %ebp
+ 91d:	c3                   	ret
+ 91e:	66 90                	xchg   %ax,%ax
+
+00000920 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 920:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 921:	31 c0                	xor    %eax,%eax
+ 923:	ba 01 00 00 00       	mov    $0x1,%edx
+ 928:	89 e5                	mov    %esp,%ebp
+ 92a:	56                   	push   %esi
+ 92b:	53                   	push   %ebx
+ 92c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 92f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 933:	85 c0                	test   %eax,%eax
+ 935:	74 30                	je     967 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 937:	83 f8 02             	cmp    $0x2,%eax
+ 93a:	74 0c                	je     948 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 93c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 941:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 944:	85 c0                	test   %eax,%eax
+ 946:	74 1f                	je     967 <mutex_lock+0x47>
+ 948:	be 02 00 00 00       	mov    $0x2,%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ 950:	83 ec 08             	sub    $0x8,%esp
+ 953:	6a 02                	push   $0x2
+ 955:	53                   	push   %ebx
+ 956:	e8 18 fa ff ff       	call   373 <futex_wait>
+ 95b:	89 f0                	mov    %esi,%eax
+ 95d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 960:	83 c4 10             	add    $0x10,%esp
+ 963:	85 c0                	test   %eax,%eax
+ 965:	75 e9                	jne    950 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ 967:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 96a:	5b                   	pop    %ebx
+ 96b:	5e                   	pop    %esi
+ 96c:	5d                   	pop    %ebp
+ 96d:	c3                   	ret
+ 96e:	66 90                	xchg   %ax,%ax
+
+00000970 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 970:	55                   	push   %ebp
+ 971:	31 c0                	xor    %eax,%eax
+ 973:	89 e5                	mov    %esp,%ebp
+ 975:	83 ec 08             	sub    $0x8,%esp
+ 978:	8b 55 08             	mov    0x8(%ebp),%edx
+ 97b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ 97e:	83 f8 02             	cmp    $0x2,%eax
+ 981:	74 05                	je     988 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ 983:	c9                   	leave
+ 984:	c3                   	ret
+ 985:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ 988:	83 ec 08             	sub    $0x8,%esp
+ 98b:	6a 01                	push   $0x1
+ 98d:	52                   	push   %edx
+ 98e:	e8 e8 f9 ff ff       	call   37b <futex_wake>
+ 993:	83 c4 10             	add    $0x10,%esp
+}
+ 996:	c9                   	leave
+ 997:	c3                   	ret
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+
+000009a0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ 9a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ 9ac:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 9b3:	5d                   	pop    %ebp
+ 9b4:	c3                   	ret
+ 9b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 0c             	sub    $0xc,%esp
+ 9c9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 9cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ 9cf:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ 9d4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ 9d6:	8b 3e                	mov    (%esi),%edi
+ 9d8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ 9db:	83 f8 02             	cmp    $0x2,%eax
+ 9de:	74 60                	je     a40 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 9e0:	83 ec 08             	sub    $0x8,%esp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	e8 89 f9 ff ff       	call   373 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ 9ea:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 9ef:	31 c0                	xor    %eax,%eax
+ 9f1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9f6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 9fa:	83 c4 10             	add    $0x10,%esp
+ 9fd:	85 c0                	test   %eax,%eax
+ 9ff:	74 36                	je     a37 <cond_wait+0x77>
+  if(c != 2)
+ a01:	83 f8 02             	cmp    $0x2,%eax
+ a04:	74 0c                	je     a12 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ a06:	b8 02 00 00 00       	mov    $0x2,%eax
+ a0b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a0e:	85 c0                	test   %eax,%eax
+ a10:	74 25                	je     a37 <cond_wait+0x77>
+ a12:	be 02 00 00 00       	mov    $0x2,%esi
+ a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ a20:	83 ec 08             	sub    $0x8,%esp
+ a23:	6a 02                	push   $0x2
+ a25:	53                   	push   %ebx
+ a26:	e8 48 f9 ff ff       	call   373 <futex_wait>
+ a2b:	89 f0                	mov    %esi,%eax
+ a2d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a30:	83 c4 10             	add    $0x10,%esp
+ a33:	85 c0                	test   %eax,%eax
+ a35:	75 e9                	jne    a20 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3a:	5b                   	pop    %ebx
+ a3b:	5e                   	pop    %esi
+ a3c:	5f                   	pop    %edi
+ a3d:	5d                   	pop    %ebp
+ a3e:	c3                   	ret
+ a3f:	90                   	nop
+    futex_wake(&m->val, 1);
+ a40:	83 ec 08             	sub    $0x8,%esp
+ a43:	6a 01                	push   $0x1
+ a45:	53                   	push   %ebx
+ a46:	e8 30 f9 ff ff       	call   37b <futex_wake>
+ a4b:	83 c4 10             	add    $0x10,%esp
+ a4e:	eb 90                	jmp    9e0 <cond_wait+0x20>
+
+00000a50 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	83 ec 08             	sub    $0x8,%esp
+ a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a59:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a5d:	8b 50 04             	mov    0x4(%eax),%edx
+ a60:	85 d2                	test   %edx,%edx
+ a62:	75 0c                	jne    a70 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ a64:	c9                   	leave
+ a65:	c3                   	ret
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ a70:	83 ec 08             	sub    $0x8,%esp
+ a73:	6a 01                	push   $0x1
+ a75:	50                   	push   %eax
+ a76:	e8 00 f9 ff ff       	call   37b <futex_wake>
+ a7b:	83 c4 10             	add    $0x10,%esp
+}
+ a7e:	c9                   	leave
+ a7f:	c3                   	ret
+
+00000a80 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	83 ec 08             	sub    $0x8,%esp
+ a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a89:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a8d:	8b 50 04             	mov    0x4(%eax),%edx
+ a90:	85 d2                	test   %edx,%edx
+ a92:	75 0c                	jne    aa0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ a94:	c9                   	leave
+ a95:	c3                   	ret
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	68 ff ff ff 7f       	push   $0x7fffffff
+ aa8:	50                   	push   %eax
+ aa9:	e8 cd f8 ff ff       	call   37b <futex_wake>
+ aae:	83 c4 10             	add    $0x10,%esp
+}
+ ab1:	c9                   	leave
+ ab2:	c3                   	ret
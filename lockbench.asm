@@ -0,0 +1,2279 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 50             	sub    $0x50,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  sched_setaffinity(0, ~0);
+  1c:	6a ff                	push   $0xffffffff
+  1e:	6a 00                	push   $0x0
+  20:	e8 1e 08 00 00       	call   843 <sched_setaffinity>
+  if(sched_getaffinity(0, &m) < 0)
+  25:	5f                   	pop    %edi
+  26:	58                   	pop    %eax
+  27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  2a:	50                   	push   %eax
+  2b:	6a 00                	push   $0x0
+  2d:	e8 19 08 00 00       	call   84b <sched_getaffinity>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	85 c0                	test   %eax,%eax
+  37:	0f 88 f2 01 00 00    	js     22f <main+0x22f>
+  for(n = 0; m; m >>= 1)
+  3d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  40:	31 c9                	xor    %ecx,%ecx
+  42:	85 c0                	test   %eax,%eax
+  44:	0f 84 6f 03 00 00    	je     3b9 <main+0x3b9>
+  4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n += m & 1;
+  50:	89 c2                	mov    %eax,%edx
+  52:	83 e2 01             	and    $0x1,%edx
+  55:	01 d1                	add    %edx,%ecx
+  for(n = 0; m; m >>= 1)
+  57:	d1 e8                	shr    %eax
+  59:	75 f5                	jne    50 <main+0x50>
+  int i, nproc, ncpu, ms;
+
+  ncpu = ncpus();
+  nproc = ncpu;
+  ms = 1000;
+  for(i = 1; i+1 < argc; i += 2){
+  5b:	83 7d c4 02          	cmpl   $0x2,-0x3c(%ebp)
+  5f:	0f 8e 93 03 00 00    	jle    3f8 <main+0x3f8>
+  ms = 1000;
+  65:	c7 45 c0 e8 03 00 00 	movl   $0x3e8,-0x40(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  6c:	89 cf                	mov    %ecx,%edi
+  6e:	be 01 00 00 00       	mov    $0x1,%esi
+  73:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+  76:	eb 26                	jmp    9e <main+0x9e>
+  78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7f:	90                   	nop
+    if(strcmp(argv[i], "-n") == 0)
+      nproc = atoi(argv[i+1]);
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  87:	e8 64 06 00 00       	call   6f0 <atoi>
+  8c:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i+1 < argc; i += 2){
+  8f:	8d 56 03             	lea    0x3(%esi),%edx
+      nproc = atoi(argv[i+1]);
+  92:	89 c7                	mov    %eax,%edi
+  for(i = 1; i+1 < argc; i += 2){
+  94:	8d 46 02             	lea    0x2(%esi),%eax
+  97:	39 55 c4             	cmp    %edx,-0x3c(%ebp)
+  9a:	7e 51                	jle    ed <main+0xed>
+  9c:	89 c6                	mov    %eax,%esi
+    if(strcmp(argv[i], "-n") == 0)
+  9e:	83 ec 08             	sub    $0x8,%esp
+  a1:	68 79 0f 00 00       	push   $0xf79
+  a6:	ff 34 b3             	push   (%ebx,%esi,4)
+  a9:	e8 a2 04 00 00       	call   550 <strcmp>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	85 c0                	test   %eax,%eax
+  b3:	74 cb                	je     80 <main+0x80>
+    else if(strcmp(argv[i], "-t") == 0)
+  b5:	83 ec 08             	sub    $0x8,%esp
+  b8:	68 7c 0f 00 00       	push   $0xf7c
+  bd:	ff 34 b3             	push   (%ebx,%esi,4)
+  c0:	e8 8b 04 00 00       	call   550 <strcmp>
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	85 c0                	test   %eax,%eax
+  ca:	0f 85 57 01 00 00    	jne    227 <main+0x227>
+      ms = atoi(argv[i+1]);
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  d7:	e8 14 06 00 00       	call   6f0 <atoi>
+  dc:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i+1 < argc; i += 2){
+  df:	8d 56 03             	lea    0x3(%esi),%edx
+      ms = atoi(argv[i+1]);
+  e2:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  e5:	8d 46 02             	lea    0x2(%esi),%eax
+  e8:	39 55 c4             	cmp    %edx,-0x3c(%ebp)
+  eb:	7f af                	jg     9c <main+0x9c>
+  ed:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+  f0:	89 c6                	mov    %eax,%esi
+    else
+      break;
+  }
+  if(i < argc || nproc < 1 || ms < 1){
+  f2:	39 75 c4             	cmp    %esi,-0x3c(%ebp)
+  f5:	0f 9f c0             	setg   %al
+  f8:	85 ff                	test   %edi,%edi
+  fa:	0f 9e c2             	setle  %dl
+  fd:	08 d0                	or     %dl,%al
+  ff:	75 06                	jne    107 <main+0x107>
+ 101:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 105:	7f 14                	jg     11b <main+0x11b>
+    printf(2, "usage: lockbench [-n nproc] [-t ms]\n");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 e0 0f 00 00       	push   $0xfe0
+ 10f:	6a 02                	push   $0x2
+ 111:	e8 5a 08 00 00       	call   970 <printf>
+    exit();
+ 116:	e8 48 06 00 00       	call   763 <exit>
+  }
+
+  printf(1, "%d procs on %d cpus, %d ms per lock\n", nproc, ncpu, ms);
+ 11b:	83 ec 0c             	sub    $0xc,%esp
+ 11e:	ff 75 c0             	push   -0x40(%ebp)
+  col("LOCK", 8);
+  col("OPS", 12);
+  col("OPS/MS", 10);
+  col("MIN", 10);
+  printf(1, "MAX\n");
+  for(i = 0; i < sizeof(kinds)/sizeof(kinds[0]); i++)
+ 121:	31 f6                	xor    %esi,%esi
+  printf(1, "%d procs on %d cpus, %d ms per lock\n", nproc, ncpu, ms);
+ 123:	51                   	push   %ecx
+ 124:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 127:	57                   	push   %edi
+ 128:	68 08 10 00 00       	push   $0x1008
+ 12d:	6a 01                	push   $0x1
+ 12f:	e8 3c 08 00 00       	call   970 <printf>
+  col("LOCK", 8);
+ 134:	83 c4 20             	add    $0x20,%esp
+ 137:	ba 08 00 00 00       	mov    $0x8,%edx
+ 13c:	b8 7f 0f 00 00       	mov    $0xf7f,%eax
+ 141:	e8 da 02 00 00       	call   420 <col>
+  col("OPS", 12);
+ 146:	ba 0c 00 00 00       	mov    $0xc,%edx
+ 14b:	b8 84 0f 00 00       	mov    $0xf84,%eax
+ 150:	e8 cb 02 00 00       	call   420 <col>
+  col("OPS/MS", 10);
+ 155:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 15a:	b8 88 0f 00 00       	mov    $0xf88,%eax
+ 15f:	e8 bc 02 00 00       	call   420 <col>
+  col("MIN", 10);
+ 164:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 169:	b8 8f 0f 00 00       	mov    $0xf8f,%eax
+ 16e:	e8 ad 02 00 00       	call   420 <col>
+  printf(1, "MAX\n");
+ 173:	53                   	push   %ebx
+ 174:	53                   	push   %ebx
+ 175:	68 93 0f 00 00       	push   $0xf93
+ 17a:	6a 01                	push   $0x1
+ 17c:	e8 ef 07 00 00       	call   970 <printf>
+  for(i = 0; i < sizeof(kinds)/sizeof(kinds[0]); i++)
+ 181:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+ 184:	89 75 b8             	mov    %esi,-0x48(%ebp)
+  printf(1, "MAX\n");
+ 187:	83 c4 10             	add    $0x10,%esp
+ 18a:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+  if(pipe(go) < 0 || pipe(res) < 0){
+ 18d:	83 ec 0c             	sub    $0xc,%esp
+ 190:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 193:	50                   	push   %eax
+ 194:	e8 da 05 00 00       	call   773 <pipe>
+ 199:	83 c4 10             	add    $0x10,%esp
+ 19c:	85 c0                	test   %eax,%eax
+ 19e:	0f 88 67 02 00 00    	js     40b <main+0x40b>
+ 1a4:	83 ec 0c             	sub    $0xc,%esp
+ 1a7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 1aa:	50                   	push   %eax
+ 1ab:	e8 c3 05 00 00       	call   773 <pipe>
+ 1b0:	83 c4 10             	add    $0x10,%esp
+ 1b3:	85 c0                	test   %eax,%eax
+ 1b5:	0f 88 50 02 00 00    	js     40b <main+0x40b>
+  for(i = 0; i < nproc; i++){
+ 1bb:	31 db                	xor    %ebx,%ebx
+ 1bd:	eb 08                	jmp    1c7 <main+0x1c7>
+ 1bf:	90                   	nop
+ 1c0:	83 c3 01             	add    $0x1,%ebx
+ 1c3:	39 fb                	cmp    %edi,%ebx
+ 1c5:	7d 72                	jge    239 <main+0x239>
+    if(fork() == 0){
+ 1c7:	e8 8f 05 00 00       	call   75b <fork>
+ 1cc:	85 c0                	test   %eax,%eax
+ 1ce:	75 f0                	jne    1c0 <main+0x1c0>
+      close(go[1]);
+ 1d0:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+ 1d3:	83 ec 0c             	sub    $0xc,%esp
+ 1d6:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 1d9:	ff 75 dc             	push   -0x24(%ebp)
+ 1dc:	e8 aa 05 00 00       	call   78b <close>
+      close(res[0]);
+ 1e1:	5f                   	pop    %edi
+ 1e2:	ff 75 e0             	push   -0x20(%ebp)
+ 1e5:	e8 a1 05 00 00       	call   78b <close>
+      sched_setaffinity(0, 1 << (i % ncpu));
+ 1ea:	58                   	pop    %eax
+ 1eb:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+ 1ee:	89 d8                	mov    %ebx,%eax
+ 1f0:	5a                   	pop    %edx
+ 1f1:	99                   	cltd
+ 1f2:	f7 f9                	idiv   %ecx
+ 1f4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1f9:	89 d1                	mov    %edx,%ecx
+ 1fb:	d3 e0                	shl    %cl,%eax
+ 1fd:	50                   	push   %eax
+ 1fe:	6a 00                	push   $0x0
+ 200:	e8 3e 06 00 00       	call   843 <sched_setaffinity>
+      if(read(go[0], &c, 1) != 1)
+ 205:	83 c4 0c             	add    $0xc,%esp
+ 208:	8d 45 d3             	lea    -0x2d(%ebp),%eax
+ 20b:	6a 01                	push   $0x1
+ 20d:	50                   	push   %eax
+ 20e:	ff 75 d8             	push   -0x28(%ebp)
+ 211:	e8 65 05 00 00       	call   77b <read>
+ 216:	83 c4 10             	add    $0x10,%esp
+ 219:	83 e8 01             	sub    $0x1,%eax
+ 21c:	0f 84 a6 01 00 00    	je     3c8 <main+0x3c8>
+        exit();
+ 222:	e8 3c 05 00 00       	call   763 <exit>
+ 227:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+ 22a:	e9 c3 fe ff ff       	jmp    f2 <main+0xf2>
+    return 1;
+ 22f:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 234:	e9 22 fe ff ff       	jmp    5b <main+0x5b>
+  close(go[0]);
+ 239:	83 ec 0c             	sub    $0xc,%esp
+ 23c:	ff 75 d8             	push   -0x28(%ebp)
+ 23f:	e8 47 05 00 00       	call   78b <close>
+  close(res[1]);
+ 244:	5b                   	pop    %ebx
+ 245:	ff 75 e4             	push   -0x1c(%ebp)
+  for(i = 0; i < nproc; i++)
+ 248:	31 db                	xor    %ebx,%ebx
+  close(res[1]);
+ 24a:	e8 3c 05 00 00       	call   78b <close>
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(go[1], "x", 1);
+ 258:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < nproc; i++)
+ 25b:	83 c3 01             	add    $0x1,%ebx
+    write(go[1], "x", 1);
+ 25e:	6a 01                	push   $0x1
+ 260:	68 b0 0f 00 00       	push   $0xfb0
+ 265:	ff 75 dc             	push   -0x24(%ebp)
+ 268:	e8 16 05 00 00       	call   783 <write>
+  for(i = 0; i < nproc; i++)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	39 fb                	cmp    %edi,%ebx
+ 272:	7c e4                	jl     258 <main+0x258>
+  close(go[1]);
+ 274:	83 ec 0c             	sub    $0xc,%esp
+ 277:	ff 75 dc             	push   -0x24(%ebp)
+  for(i = 0; i < nproc; i++){
+ 27a:	31 f6                	xor    %esi,%esi
+  min = ~0;
+ 27c:	83 cb ff             	or     $0xffffffff,%ebx
+  close(go[1]);
+ 27f:	e8 07 05 00 00       	call   78b <close>
+  total = max = 0;
+ 284:	31 c0                	xor    %eax,%eax
+ 286:	31 c9                	xor    %ecx,%ecx
+ 288:	89 7d bc             	mov    %edi,-0x44(%ebp)
+ 28b:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  close(go[1]);
+ 28e:	83 c4 10             	add    $0x10,%esp
+ 291:	89 c7                	mov    %eax,%edi
+ 293:	eb 25                	jmp    2ba <main+0x2ba>
+ 295:	8d 76 00             	lea    0x0(%esi),%esi
+    if(read(res[0], &n, sizeof(n)) != sizeof(n) || n < 0){
+ 298:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 29b:	85 c0                	test   %eax,%eax
+ 29d:	78 34                	js     2d3 <main+0x2d3>
+    total += n;
+ 29f:	01 45 c4             	add    %eax,-0x3c(%ebp)
+ 2a2:	39 c3                	cmp    %eax,%ebx
+ 2a4:	0f 47 d8             	cmova  %eax,%ebx
+    if(n > max)
+ 2a7:	39 c7                	cmp    %eax,%edi
+ 2a9:	0f 42 f8             	cmovb  %eax,%edi
+  for(i = 0; i < nproc; i++){
+ 2ac:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 2af:	83 c6 01             	add    $0x1,%esi
+ 2b2:	39 c6                	cmp    %eax,%esi
+ 2b4:	0f 8d 34 01 00 00    	jge    3ee <main+0x3ee>
+    if(read(res[0], &n, sizeof(n)) != sizeof(n) || n < 0){
+ 2ba:	83 ec 04             	sub    $0x4,%esp
+ 2bd:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 2c0:	6a 04                	push   $0x4
+ 2c2:	50                   	push   %eax
+ 2c3:	ff 75 e0             	push   -0x20(%ebp)
+ 2c6:	e8 b0 04 00 00       	call   77b <read>
+ 2cb:	83 c4 10             	add    $0x10,%esp
+ 2ce:	83 f8 04             	cmp    $0x4,%eax
+ 2d1:	74 c5                	je     298 <main+0x298>
+      printf(2, "lockbench: lockbench failed\n");
+ 2d3:	89 7d b0             	mov    %edi,-0x50(%ebp)
+ 2d6:	8b 7d bc             	mov    -0x44(%ebp),%edi
+ 2d9:	52                   	push   %edx
+ 2da:	52                   	push   %edx
+ 2db:	68 b2 0f 00 00       	push   $0xfb2
+ 2e0:	6a 02                	push   $0x2
+ 2e2:	e8 89 06 00 00       	call   970 <printf>
+      break;
+ 2e7:	83 c4 10             	add    $0x10,%esp
+  close(res[0]);
+ 2ea:	83 ec 0c             	sub    $0xc,%esp
+ 2ed:	ff 75 e0             	push   -0x20(%ebp)
+  for(i = 0; i < nproc; i++)
+ 2f0:	31 f6                	xor    %esi,%esi
+  close(res[0]);
+ 2f2:	e8 94 04 00 00       	call   78b <close>
+ 2f7:	83 c4 10             	add    $0x10,%esp
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 300:	e8 66 04 00 00       	call   76b <wait>
+  for(i = 0; i < nproc; i++)
+ 305:	83 c6 01             	add    $0x1,%esi
+ 308:	39 fe                	cmp    %edi,%esi
+ 30a:	7c f4                	jl     300 <main+0x300>
+  col(kinds[kind], 8);
+ 30c:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  n = strlen(s);
+ 30f:	83 ec 0c             	sub    $0xc,%esp
+  col(kinds[kind], 8);
+ 312:	8b 14 85 80 15 00 00 	mov    0x1580(,%eax,4),%edx
+  n = strlen(s);
+ 319:	52                   	push   %edx
+ 31a:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ 31d:	e8 8e 02 00 00       	call   5b0 <strlen>
+  printf(1, "%s", s);
+ 322:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ 325:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+ 328:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+ 32a:	52                   	push   %edx
+ 32b:	68 74 0f 00 00       	push   $0xf74
+ 330:	6a 01                	push   $0x1
+ 332:	e8 39 06 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 337:	83 c4 10             	add    $0x10,%esp
+ 33a:	83 fe 07             	cmp    $0x7,%esi
+ 33d:	7f 1b                	jg     35a <main+0x35a>
+ 33f:	90                   	nop
+    printf(1, " ");
+ 340:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 343:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+ 346:	68 77 0f 00 00       	push   $0xf77
+ 34b:	6a 01                	push   $0x1
+ 34d:	e8 1e 06 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	83 fe 08             	cmp    $0x8,%esi
+ 358:	75 e6                	jne    340 <main+0x340>
+  coln(total, 12);
+ 35a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ 35d:	ba 0c 00 00 00       	mov    $0xc,%edx
+ 362:	89 f0                	mov    %esi,%eax
+ 364:	e8 17 01 00 00       	call   480 <coln>
+  coln(total / ms, 10);
+ 369:	89 f0                	mov    %esi,%eax
+ 36b:	31 d2                	xor    %edx,%edx
+ 36d:	f7 75 c0             	divl   -0x40(%ebp)
+ 370:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 375:	e8 06 01 00 00       	call   480 <coln>
+  coln(min, 10);
+ 37a:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 37f:	89 d8                	mov    %ebx,%eax
+ 381:	e8 fa 00 00 00       	call   480 <coln>
+  coln(max, 10);
+ 386:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 389:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 38e:	e8 ed 00 00 00       	call   480 <coln>
+  printf(1, "\n");
+ 393:	50                   	push   %eax
+ 394:	50                   	push   %eax
+ 395:	68 96 0f 00 00       	push   $0xf96
+ 39a:	6a 01                	push   $0x1
+ 39c:	e8 cf 05 00 00       	call   970 <printf>
+  for(i = 0; i < sizeof(kinds)/sizeof(kinds[0]); i++)
+ 3a1:	83 45 b8 01          	addl   $0x1,-0x48(%ebp)
+ 3a5:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 3a8:	83 c4 10             	add    $0x10,%esp
+ 3ab:	83 f8 03             	cmp    $0x3,%eax
+ 3ae:	0f 85 d9 fd ff ff    	jne    18d <main+0x18d>
+ 3b4:	e9 69 fe ff ff       	jmp    222 <main+0x222>
+  for(i = 1; i+1 < argc; i += 2){
+ 3b9:	83 7d c4 02          	cmpl   $0x2,-0x3c(%ebp)
+ 3bd:	0f 8f a2 fc ff ff    	jg     65 <main+0x65>
+ 3c3:	e9 3f fd ff ff       	jmp    107 <main+0x107>
+      n = lockbench(kind, ms);
+ 3c8:	56                   	push   %esi
+ 3c9:	56                   	push   %esi
+ 3ca:	ff 75 c0             	push   -0x40(%ebp)
+ 3cd:	ff 75 b8             	push   -0x48(%ebp)
+ 3d0:	e8 d6 04 00 00       	call   8ab <lockbench>
+      write(res[1], &n, sizeof(n));
+ 3d5:	83 c4 0c             	add    $0xc,%esp
+      n = lockbench(kind, ms);
+ 3d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      write(res[1], &n, sizeof(n));
+ 3db:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 3de:	6a 04                	push   $0x4
+ 3e0:	50                   	push   %eax
+ 3e1:	ff 75 e4             	push   -0x1c(%ebp)
+ 3e4:	e8 9a 03 00 00       	call   783 <write>
+      exit();
+ 3e9:	e8 75 03 00 00       	call   763 <exit>
+ 3ee:	89 7d b0             	mov    %edi,-0x50(%ebp)
+ 3f1:	89 c7                	mov    %eax,%edi
+ 3f3:	e9 f2 fe ff ff       	jmp    2ea <main+0x2ea>
+  ms = 1000;
+ 3f8:	c7 45 c0 e8 03 00 00 	movl   $0x3e8,-0x40(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+ 3ff:	89 cf                	mov    %ecx,%edi
+ 401:	be 01 00 00 00       	mov    $0x1,%esi
+ 406:	e9 e7 fc ff ff       	jmp    f2 <main+0xf2>
+    printf(2, "lockbench: pipe failed\n");
+ 40b:	51                   	push   %ecx
+ 40c:	51                   	push   %ecx
+ 40d:	68 98 0f 00 00       	push   $0xf98
+ 412:	6a 02                	push   $0x2
+ 414:	e8 57 05 00 00       	call   970 <printf>
+    exit();
+ 419:	e8 45 03 00 00       	call   763 <exit>
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <col>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	89 c7                	mov    %eax,%edi
+ 426:	56                   	push   %esi
+ 427:	89 d6                	mov    %edx,%esi
+ 429:	53                   	push   %ebx
+ 42a:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+ 42d:	50                   	push   %eax
+ 42e:	e8 7d 01 00 00       	call   5b0 <strlen>
+  printf(1, "%s", s);
+ 433:	83 c4 0c             	add    $0xc,%esp
+ 436:	57                   	push   %edi
+  n = strlen(s);
+ 437:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 439:	68 74 0f 00 00       	push   $0xf74
+ 43e:	6a 01                	push   $0x1
+ 440:	e8 2b 05 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 445:	83 c4 10             	add    $0x10,%esp
+ 448:	39 f3                	cmp    %esi,%ebx
+ 44a:	7d 1d                	jge    469 <col+0x49>
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 450:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 453:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 456:	68 77 0f 00 00       	push   $0xf77
+ 45b:	6a 01                	push   $0x1
+ 45d:	e8 0e 05 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	39 de                	cmp    %ebx,%esi
+ 467:	75 e7                	jne    450 <col+0x30>
+}
+ 469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46c:	5b                   	pop    %ebx
+ 46d:	5e                   	pop    %esi
+ 46e:	5f                   	pop    %edi
+ 46f:	5d                   	pop    %ebp
+ 470:	c3                   	ret
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <coln>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 c1                	mov    %eax,%ecx
+ 483:	89 e5                	mov    %esp,%ebp
+ 485:	57                   	push   %edi
+ 486:	56                   	push   %esi
+    buf[--i] = '0' + x % 10;
+ 487:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 48c:	53                   	push   %ebx
+  i = sizeof(buf) - 1;
+ 48d:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+ 492:	83 ec 2c             	sub    $0x2c,%esp
+  buf[i] = 0;
+ 495:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+ 499:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a0:	89 c8                	mov    %ecx,%eax
+ 4a2:	83 eb 01             	sub    $0x1,%ebx
+ 4a5:	f7 e6                	mul    %esi
+ 4a7:	89 c8                	mov    %ecx,%eax
+ 4a9:	c1 ea 03             	shr    $0x3,%edx
+ 4ac:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 4af:	01 ff                	add    %edi,%edi
+ 4b1:	29 f8                	sub    %edi,%eax
+ 4b3:	83 c0 30             	add    $0x30,%eax
+ 4b6:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+ 4ba:	89 c8                	mov    %ecx,%eax
+ 4bc:	89 d1                	mov    %edx,%ecx
+ 4be:	83 f8 09             	cmp    $0x9,%eax
+ 4c1:	77 dd                	ja     4a0 <coln+0x20>
+  col(buf+i, w);
+ 4c3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 4c9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4cc:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+ 4cf:	56                   	push   %esi
+ 4d0:	e8 db 00 00 00       	call   5b0 <strlen>
+  printf(1, "%s", s);
+ 4d5:	83 c4 0c             	add    $0xc,%esp
+ 4d8:	56                   	push   %esi
+  n = strlen(s);
+ 4d9:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 4db:	68 74 0f 00 00       	push   $0xf74
+ 4e0:	6a 01                	push   $0x1
+ 4e2:	e8 89 04 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 4e7:	83 c4 10             	add    $0x10,%esp
+ 4ea:	39 df                	cmp    %ebx,%edi
+ 4ec:	7e 1b                	jle    509 <coln+0x89>
+ 4ee:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 4f3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 4f6:	68 77 0f 00 00       	push   $0xf77
+ 4fb:	6a 01                	push   $0x1
+ 4fd:	e8 6e 04 00 00       	call   970 <printf>
+  for(; n < w; n++)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	39 df                	cmp    %ebx,%edi
+ 507:	75 e7                	jne    4f0 <coln+0x70>
+}
+ 509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50c:	5b                   	pop    %ebx
+ 50d:	5e                   	pop    %esi
+ 50e:	5f                   	pop    %edi
+ 50f:	5d                   	pop    %ebp
+ 510:	c3                   	ret
+ 511:	66 90                	xchg   %ax,%ax
+ 513:	66 90                	xchg   %ax,%ax
+ 515:	66 90                	xchg   %ax,%ax
+ 517:	66 90                	xchg   %ax,%ax
+ 519:	66 90                	xchg   %ax,%ax
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 520:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 521:	31 c0                	xor    %eax,%eax
+{
+ 523:	89 e5                	mov    %esp,%ebp
+ 525:	53                   	push   %ebx
+ 526:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 529:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 530:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 534:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 537:	83 c0 01             	add    $0x1,%eax
+ 53a:	84 d2                	test   %dl,%dl
+ 53c:	75 f2                	jne    530 <strcpy+0x10>
+    ;
+  return os;
+}
+ 53e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 541:	89 c8                	mov    %ecx,%eax
+ 543:	c9                   	leave
+ 544:	c3                   	ret
+ 545:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	53                   	push   %ebx
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+ 557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 55a:	0f b6 02             	movzbl (%edx),%eax
+ 55d:	84 c0                	test   %al,%al
+ 55f:	75 17                	jne    578 <strcmp+0x28>
+ 561:	eb 3a                	jmp    59d <strcmp+0x4d>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 56c:	83 c2 01             	add    $0x1,%edx
+ 56f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 572:	84 c0                	test   %al,%al
+ 574:	74 1a                	je     590 <strcmp+0x40>
+    p++, q++;
+ 576:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 578:	0f b6 19             	movzbl (%ecx),%ebx
+ 57b:	38 c3                	cmp    %al,%bl
+ 57d:	74 e9                	je     568 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 57f:	29 d8                	sub    %ebx,%eax
+}
+ 581:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 584:	c9                   	leave
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 590:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 594:	31 c0                	xor    %eax,%eax
+ 596:	29 d8                	sub    %ebx,%eax
+}
+ 598:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 59b:	c9                   	leave
+ 59c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 59d:	0f b6 19             	movzbl (%ecx),%ebx
+ 5a0:	31 c0                	xor    %eax,%eax
+ 5a2:	eb db                	jmp    57f <strcmp+0x2f>
+ 5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5b9:	74 15                	je     5d0 <strlen+0x20>
+ 5bb:	31 c0                	xor    %eax,%eax
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5c0:	83 c0 01             	add    $0x1,%eax
+ 5c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5c7:	89 c1                	mov    %eax,%ecx
+ 5c9:	75 f5                	jne    5c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5cb:	89 c8                	mov    %ecx,%eax
+ 5cd:	5d                   	pop    %ebp
+ 5ce:	c3                   	ret
+ 5cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5d0:	31 c9                	xor    %ecx,%ecx
+}
+ 5d2:	5d                   	pop    %ebp
+ 5d3:	89 c8                	mov    %ecx,%eax
+ 5d5:	c3                   	ret
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 5e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ed:	89 d7                	mov    %edx,%edi
+ 5ef:	fc                   	cld
+ 5f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5f5:	89 d0                	mov    %edx,%eax
+ 5f7:	c9                   	leave
+ 5f8:	c3                   	ret
+ 5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	8b 45 08             	mov    0x8(%ebp),%eax
+ 606:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 60a:	0f b6 10             	movzbl (%eax),%edx
+ 60d:	84 d2                	test   %dl,%dl
+ 60f:	75 12                	jne    623 <strchr+0x23>
+ 611:	eb 1d                	jmp    630 <strchr+0x30>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 61c:	83 c0 01             	add    $0x1,%eax
+ 61f:	84 d2                	test   %dl,%dl
+ 621:	74 0d                	je     630 <strchr+0x30>
+    if(*s == c)
+ 623:	38 d1                	cmp    %dl,%cl
+ 625:	75 f1                	jne    618 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 627:	5d                   	pop    %ebp
+ 628:	c3                   	ret
+ 629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 630:	31 c0                	xor    %eax,%eax
+}
+ 632:	5d                   	pop    %ebp
+ 633:	c3                   	ret
+ 634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+
+00000640 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 645:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 648:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 649:	31 db                	xor    %ebx,%ebx
+{
+ 64b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 64e:	eb 27                	jmp    677 <gets+0x37>
+    cc = read(0, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	6a 01                	push   $0x1
+ 655:	56                   	push   %esi
+ 656:	6a 00                	push   $0x0
+ 658:	e8 1e 01 00 00       	call   77b <read>
+    if(cc < 1)
+ 65d:	83 c4 10             	add    $0x10,%esp
+ 660:	85 c0                	test   %eax,%eax
+ 662:	7e 1d                	jle    681 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 664:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 668:	8b 55 08             	mov    0x8(%ebp),%edx
+ 66b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 66f:	3c 0a                	cmp    $0xa,%al
+ 671:	74 10                	je     683 <gets+0x43>
+ 673:	3c 0d                	cmp    $0xd,%al
+ 675:	74 0c                	je     683 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 677:	89 df                	mov    %ebx,%edi
+ 679:	83 c3 01             	add    $0x1,%ebx
+ 67c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 67f:	7c cf                	jl     650 <gets+0x10>
+ 681:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 68a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68d:	5b                   	pop    %ebx
+ 68e:	5e                   	pop    %esi
+ 68f:	5f                   	pop    %edi
+ 690:	5d                   	pop    %ebp
+ 691:	c3                   	ret
+ 692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	56                   	push   %esi
+ 6a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6a5:	83 ec 08             	sub    $0x8,%esp
+ 6a8:	6a 00                	push   $0x0
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 f1 00 00 00       	call   7a3 <open>
+  if(fd < 0)
+ 6b2:	83 c4 10             	add    $0x10,%esp
+ 6b5:	85 c0                	test   %eax,%eax
+ 6b7:	78 27                	js     6e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6b9:	83 ec 08             	sub    $0x8,%esp
+ 6bc:	ff 75 0c             	push   0xc(%ebp)
+ 6bf:	89 c3                	mov    %eax,%ebx
+ 6c1:	50                   	push   %eax
+ 6c2:	e8 f4 00 00 00       	call   7bb <fstat>
+  close(fd);
+ 6c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6cc:	e8 ba 00 00 00       	call   78b <close>
+  return r;
+ 6d1:	83 c4 10             	add    $0x10,%esp
+}
+ 6d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6d7:	89 f0                	mov    %esi,%eax
+ 6d9:	5b                   	pop    %ebx
+ 6da:	5e                   	pop    %esi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 6e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6e5:	eb ed                	jmp    6d4 <stat+0x34>
+ 6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	53                   	push   %ebx
+ 6f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6f7:	0f be 02             	movsbl (%edx),%eax
+ 6fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 705:	77 1e                	ja     725 <atoi+0x35>
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 710:	83 c2 01             	add    $0x1,%edx
+ 713:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 716:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 71a:	0f be 02             	movsbl (%edx),%eax
+ 71d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 720:	80 fb 09             	cmp    $0x9,%bl
+ 723:	76 eb                	jbe    710 <atoi+0x20>
+  return n;
+}
+ 725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 728:	89 c8                	mov    %ecx,%eax
+ 72a:	c9                   	leave
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	8b 45 10             	mov    0x10(%ebp),%eax
+ 738:	8b 55 08             	mov    0x8(%ebp),%edx
+ 73b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 73e:	85 c0                	test   %eax,%eax
+ 740:	7e 13                	jle    755 <memmove+0x25>
+ 742:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 744:	89 d7                	mov    %edx,%edi
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 750:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 751:	39 f8                	cmp    %edi,%eax
+ 753:	75 fb                	jne    750 <memmove+0x20>
+  return vdst;
+}
+ 755:	5e                   	pop    %esi
+ 756:	89 d0                	mov    %edx,%eax
+ 758:	5f                   	pop    %edi
+ 759:	5d                   	pop    %ebp
+ 75a:	c3                   	ret
+
+0000075b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 75b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <exit>:
+SYSCALL(exit)
+ 763:	b8 02 00 00 00       	mov    $0x2,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <wait>:
+SYSCALL(wait)
+ 76b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <pipe>:
+SYSCALL(pipe)
+ 773:	b8 04 00 00 00       	mov    $0x4,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <read>:
+SYSCALL(read)
+ 77b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <write>:
+SYSCALL(write)
+ 783:	b8 10 00 00 00       	mov    $0x10,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <close>:
+SYSCALL(close)
+ 78b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <kill>:
+SYSCALL(kill)
+ 793:	b8 06 00 00 00       	mov    $0x6,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <exec>:
+SYSCALL(exec)
+ 79b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <open>:
+SYSCALL(open)
+ 7a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <mknod>:
+SYSCALL(mknod)
+ 7ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <unlink>:
+SYSCALL(unlink)
+ 7b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <fstat>:
+SYSCALL(fstat)
+ 7bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <link>:
+SYSCALL(link)
+ 7c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mkdir>:
+SYSCALL(mkdir)
+ 7cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <chdir>:
+SYSCALL(chdir)
+ 7d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <dup>:
+SYSCALL(dup)
+ 7db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <getpid>:
+SYSCALL(getpid)
+ 7e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <sbrk>:
+SYSCALL(sbrk)
+ 7eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <sleep>:
+SYSCALL(sleep)
+ 7f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <uptime>:
+SYSCALL(uptime)
+ 7fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <add_dir>:
+SYSCALL(add_dir)
+ 803:	b8 16 00 00 00       	mov    $0x16,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <history>:
+SYSCALL(history)
+ 80b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 813:	b8 19 00 00 00       	mov    $0x19,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <nanosleep>:
+SYSCALL(nanosleep)
+ 81b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <clone>:
+SYSCALL(clone)
+ 823:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <join>:
+SYSCALL(join)
+ 82b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <futex_wait>:
+SYSCALL(futex_wait)
+ 833:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <futex_wake>:
+SYSCALL(futex_wake)
+ 83b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 843:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 84b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 853:	b8 21 00 00 00       	mov    $0x21,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 85b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <waitpid>:
+SYSCALL(waitpid)
+ 863:	b8 23 00 00 00       	mov    $0x23,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <tracectl>:
+SYSCALL(tracectl)
+ 86b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <traceread>:
+SYSCALL(traceread)
+ 873:	b8 25 00 00 00       	mov    $0x25,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 87b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 883:	b8 27 00 00 00       	mov    $0x27,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 88b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <irqroute>:
+SYSCALL(irqroute)
+ 893:	b8 29 00 00 00       	mov    $0x29,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <irqstat>:
+SYSCALL(irqstat)
+ 89b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <boottimes>:
+SYSCALL(boottimes)
+ 8a3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <lockbench>:
+SYSCALL(lockbench)
+ 8ab:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <lockstat>:
+SYSCALL(lockstat)
+ 8b3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <cpustat>:
+SYSCALL(cpustat)
+ 8bb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <bcachesize>:
+SYSCALL(bcachesize)
+ 8c3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 8c 10 00 00 	movzbl 0x108c(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 36 fe ff ff       	call   783 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 cc fd ff ff       	call   783 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 34 10 00 00 	jmp    *0x1034(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 6d fd ff ff       	call   783 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 5b fd ff ff       	call   783 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 e1 fc ff ff       	call   783 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 91 fc ff ff       	call   783 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 2d 10 00 00       	mov    $0x102d,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ b20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b21:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ b24:	89 e5                	mov    %esp,%ebp
+ b26:	57                   	push   %edi
+ b27:	56                   	push   %esi
+ b28:	53                   	push   %ebx
+ b29:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b2b:	a1 90 15 00 00       	mov    0x1590,%eax
+ b30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b34:	39 ca                	cmp    %ecx,%edx
+ b36:	73 30                	jae    b68 <ufree+0x48>
+ b38:	39 c1                	cmp    %eax,%ecx
+ b3a:	72 04                	jb     b40 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b3c:	39 c2                	cmp    %eax,%edx
+ b3e:	72 f0                	jb     b30 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b40:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b43:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b46:	39 f8                	cmp    %edi,%eax
+ b48:	74 26                	je     b70 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b4d:	8b 42 04             	mov    0x4(%edx),%eax
+ b50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b53:	39 f1                	cmp    %esi,%ecx
+ b55:	74 30                	je     b87 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b57:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b59:	5b                   	pop    %ebx
+  freep = p;
+ b5a:	89 15 90 15 00 00    	mov    %edx,0x1590
+}
+ b60:	5e                   	pop    %esi
+ b61:	5f                   	pop    %edi
+ b62:	5d                   	pop    %ebp
+ b63:	c3                   	ret
+ b64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b68:	39 c1                	cmp    %eax,%ecx
+ b6a:	72 d0                	jb     b3c <ufree+0x1c>
+ b6c:	eb c2                	jmp    b30 <ufree+0x10>
+ b6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ b70:	03 70 04             	add    0x4(%eax),%esi
+ b73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b76:	8b 02                	mov    (%edx),%eax
+ b78:	8b 00                	mov    (%eax),%eax
+ b7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b7d:	8b 42 04             	mov    0x4(%edx),%eax
+ b80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b83:	39 f1                	cmp    %esi,%ecx
+ b85:	75 d0                	jne    b57 <ufree+0x37>
+    p->s.size += bp->s.size;
+ b87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b8a:	89 15 90 15 00 00    	mov    %edx,0x1590
+    p->s.size += bp->s.size;
+ b90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b96:	89 0a                	mov    %ecx,(%edx)
+}
+ b98:	5b                   	pop    %ebx
+ b99:	5e                   	pop    %esi
+ b9a:	5f                   	pop    %edi
+ b9b:	5d                   	pop    %ebp
+ b9c:	c3                   	ret
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	53                   	push   %ebx
+ ba4:	83 ec 10             	sub    $0x10,%esp
+ ba7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ baa:	68 8c 15 00 00       	push   $0x158c
+ baf:	e8 ec 01 00 00       	call   da0 <lock_acquire>
+  ufree(ap);
+ bb4:	89 d8                	mov    %ebx,%eax
+ bb6:	e8 65 ff ff ff       	call   b20 <ufree>
+  lock_release(&mlock);
+ bbb:	c7 45 08 8c 15 00 00 	movl   $0x158c,0x8(%ebp)
+}
+ bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ bc5:	83 c4 10             	add    $0x10,%esp
+}
+ bc8:	c9                   	leave
+  lock_release(&mlock);
+ bc9:	e9 f2 01 00 00       	jmp    dc0 <lock_release>
+ bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	53                   	push   %ebx
+ bd6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ bdc:	68 8c 15 00 00       	push   $0x158c
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ be1:	8d 48 07             	lea    0x7(%eax),%ecx
+ be4:	c1 e9 03             	shr    $0x3,%ecx
+ be7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ bea:	e8 b1 01 00 00       	call   da0 <lock_acquire>
+  if((prevp = freep) == 0){
+ bef:	8b 15 90 15 00 00    	mov    0x1590,%edx
+ bf5:	83 c4 10             	add    $0x10,%esp
+ bf8:	85 d2                	test   %edx,%edx
+ bfa:	0f 84 b0 00 00 00    	je     cb0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c00:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ c02:	8b 47 04             	mov    0x4(%edi),%eax
+ c05:	39 f0                	cmp    %esi,%eax
+ c07:	73 6f                	jae    c78 <malloc+0xa8>
+  if(nu < 4096)
+ c09:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c0e:	39 de                	cmp    %ebx,%esi
+ c10:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c13:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ c1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c1d:	eb 0a                	jmp    c29 <malloc+0x59>
+ c1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c20:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ c22:	8b 47 04             	mov    0x4(%edi),%eax
+ c25:	39 f0                	cmp    %esi,%eax
+ c27:	73 4f                	jae    c78 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c29:	89 fa                	mov    %edi,%edx
+ c2b:	39 3d 90 15 00 00    	cmp    %edi,0x1590
+ c31:	75 ed                	jne    c20 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ c33:	83 ec 0c             	sub    $0xc,%esp
+ c36:	ff 75 e4             	push   -0x1c(%ebp)
+ c39:	e8 ad fb ff ff       	call   7eb <sbrk>
+  if(p == (char*)-1)
+ c3e:	83 c4 10             	add    $0x10,%esp
+ c41:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c44:	74 15                	je     c5b <malloc+0x8b>
+  hp->s.size = nu;
+ c46:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ c49:	83 c0 08             	add    $0x8,%eax
+ c4c:	e8 cf fe ff ff       	call   b20 <ufree>
+  return freep;
+ c51:	8b 15 90 15 00 00    	mov    0x1590,%edx
+      if((p = morecore(nunits)) == 0){
+ c57:	85 d2                	test   %edx,%edx
+ c59:	75 c5                	jne    c20 <malloc+0x50>
+        lock_release(&mlock);
+ c5b:	83 ec 0c             	sub    $0xc,%esp
+ c5e:	68 8c 15 00 00       	push   $0x158c
+ c63:	e8 58 01 00 00       	call   dc0 <lock_release>
+        return 0;
+ c68:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ c6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c6e:	31 c0                	xor    %eax,%eax
+}
+ c70:	5b                   	pop    %ebx
+ c71:	5e                   	pop    %esi
+ c72:	5f                   	pop    %edi
+ c73:	5d                   	pop    %ebp
+ c74:	c3                   	ret
+ c75:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c78:	39 c6                	cmp    %eax,%esi
+ c7a:	74 64                	je     ce0 <malloc+0x110>
+        p->s.size -= nunits;
+ c7c:	29 f0                	sub    %esi,%eax
+ c7e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ c81:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ c84:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ c87:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ c8a:	89 15 90 15 00 00    	mov    %edx,0x1590
+      lock_release(&mlock);
+ c90:	68 8c 15 00 00       	push   $0x158c
+ c95:	e8 26 01 00 00       	call   dc0 <lock_release>
+      return (void*)(p + 1);
+ c9a:	83 c4 10             	add    $0x10,%esp
+}
+ c9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ca0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ ca3:	5b                   	pop    %ebx
+ ca4:	5e                   	pop    %esi
+ ca5:	5f                   	pop    %edi
+ ca6:	5d                   	pop    %ebp
+ ca7:	c3                   	ret
+ ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ caf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ cb0:	c7 05 90 15 00 00 94 	movl   $0x1594,0x1590
+ cb7:	15 00 00 
+    base.s.size = 0;
+ cba:	bf 94 15 00 00       	mov    $0x1594,%edi
+    base.s.ptr = freep = prevp = &base;
+ cbf:	c7 05 94 15 00 00 94 	movl   $0x1594,0x1594
+ cc6:	15 00 00 
+    base.s.size = 0;
+ cc9:	c7 05 98 15 00 00 00 	movl   $0x0,0x1598
+ cd0:	00 00 00 
+    if(p->s.size >= nunits){
+ cd3:	e9 31 ff ff ff       	jmp    c09 <malloc+0x39>
+ cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ce0:	8b 07                	mov    (%edi),%eax
+ ce2:	89 02                	mov    %eax,(%edx)
+ ce4:	eb a1                	jmp    c87 <malloc+0xb7>
+ ce6:	66 90                	xchg   %ax,%ax
+ ce8:	66 90                	xchg   %ax,%ax
+ cea:	66 90                	xchg   %ax,%ax
+ cec:	66 90                	xchg   %ax,%ax
+ cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	53                   	push   %ebx
+ cf4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ cf7:	68 00 10 00 00       	push   $0x1000
+ cfc:	e8 cf fe ff ff       	call   bd0 <malloc>
+ d01:	83 c4 10             	add    $0x10,%esp
+ d04:	85 c0                	test   %eax,%eax
+ d06:	74 37                	je     d3f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ d08:	83 ec 04             	sub    $0x4,%esp
+ d0b:	89 c3                	mov    %eax,%ebx
+ d0d:	50                   	push   %eax
+ d0e:	ff 75 0c             	push   0xc(%ebp)
+ d11:	ff 75 08             	push   0x8(%ebp)
+ d14:	e8 0a fb ff ff       	call   823 <clone>
+ d19:	83 c4 10             	add    $0x10,%esp
+ d1c:	85 c0                	test   %eax,%eax
+ d1e:	78 08                	js     d28 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ d20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d23:	c9                   	leave
+ d24:	c3                   	ret
+ d25:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ d28:	83 ec 0c             	sub    $0xc,%esp
+ d2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d2e:	53                   	push   %ebx
+ d2f:	e8 6c fe ff ff       	call   ba0 <free>
+ d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ d3a:	83 c4 10             	add    $0x10,%esp
+}
+ d3d:	c9                   	leave
+ d3e:	c3                   	ret
+    return -1;
+ d3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d44:	eb da                	jmp    d20 <thread_create+0x30>
+ d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d50 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ d59:	50                   	push   %eax
+ d5a:	e8 cc fa ff ff       	call   82b <join>
+ d5f:	83 c4 10             	add    $0x10,%esp
+ d62:	85 c0                	test   %eax,%eax
+ d64:	79 0a                	jns    d70 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ d66:	c9                   	leave
+ d67:	c3                   	ret
+ d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+ d70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ d73:	83 ec 0c             	sub    $0xc,%esp
+ d76:	ff 75 f4             	push   -0xc(%ebp)
+ d79:	e8 22 fe ff ff       	call   ba0 <free>
+ d7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d81:	83 c4 10             	add    $0x10,%esp
+}
+ d84:	c9                   	leave
+ d85:	c3                   	ret
+ d86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d90 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ d93:	8b 45 08             	mov    0x8(%ebp),%eax
+ d96:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ d9c:	5d                   	pop    %ebp
+ d9d:	c3                   	ret
+ d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ da0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ da1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ da6:	89 e5                	mov    %esp,%ebp
+ da8:	8b 55 08             	mov    0x8(%ebp),%edx
+ dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ daf:	90                   	nop
+ db0:	89 c8                	mov    %ecx,%eax
+ db2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ db5:	85 c0                	test   %eax,%eax
+ db7:	75 f7                	jne    db0 <lock_acquire+0x10>
+    ;
+}
+ db9:	5d                   	pop    %ebp
+ dba:	c3                   	ret
+ dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dbf:	90                   	nop
+
+00000dc0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	31 c0                	xor    %eax,%eax
+ dc3:	89 e5                	mov    %esp,%ebp
+ dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+ dc8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ dcb:	5d                   	pop    %ebp
+ dcc:	c3                   	ret
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dd0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ dd3:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ddc:	5d                   	pop    %ebp
+ ddd:	c3                   	ret
+ dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ de0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ de1:	31 c0                	xor    %eax,%eax
+ de3:	ba 01 00 00 00       	mov    $0x1,%edx
+ de8:	89 e5                	mov    %esp,%ebp
+ dea:	56                   	push   %esi
+ deb:	53                   	push   %ebx
+ dec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ def:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ df3:	85 c0                	test   %eax,%eax
+ df5:	74 30                	je     e27 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ df7:	83 f8 02             	cmp    $0x2,%eax
+ dfa:	74 0c                	je     e08 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ dfc:	b8 02 00 00 00       	mov    $0x2,%eax
+ e01:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ e04:	85 c0                	test   %eax,%eax
+ e06:	74 1f                	je     e27 <mutex_lock+0x47>
+ e08:	be 02 00 00 00       	mov    $0x2,%esi
+ e0d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ e10:	83 ec 08             	sub    $0x8,%esp
+ e13:	6a 02                	push   $0x2
+ e15:	53                   	push   %ebx
+ e16:	e8 18 fa ff ff       	call   833 <futex_wait>
+ e1b:	89 f0                	mov    %esi,%eax
+ e1d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ e20:	83 c4 10             	add    $0x10,%esp
+ e23:	85 c0                	test   %eax,%eax
+ e25:	75 e9                	jne    e10 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ e27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e2a:	5b                   	pop    %ebx
+ e2b:	5e                   	pop    %esi
+ e2c:	5d                   	pop    %ebp
+ e2d:	c3                   	ret
+ e2e:	66 90                	xchg   %ax,%ax
+
+00000e30 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ e30:	55                   	push   %ebp
+ e31:	31 c0                	xor    %eax,%eax
+ e33:	89 e5                	mov    %esp,%ebp
+ e35:	83 ec 08             	sub    $0x8,%esp
+ e38:	8b 55 08             	mov    0x8(%ebp),%edx
+ e3b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ e3e:	83 f8 02             	cmp    $0x2,%eax
+ e41:	74 05                	je     e48 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ e43:	c9                   	leave
+ e44:	c3                   	ret
+ e45:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ e48:	83 ec 08             	sub    $0x8,%esp
+ e4b:	6a 01                	push   $0x1
+ e4d:	52                   	push   %edx
+ e4e:	e8 e8 f9 ff ff       	call   83b <futex_wake>
+ e53:	83 c4 10             	add    $0x10,%esp
+}
+ e56:	c9                   	leave
+ e57:	c3                   	ret
+ e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5f:	90                   	nop
+
+00000e60 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ e66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ e6c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ e73:	5d                   	pop    %ebp
+ e74:	c3                   	ret
+ e75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ e80:	55                   	push   %ebp
+ e81:	89 e5                	mov    %esp,%ebp
+ e83:	57                   	push   %edi
+ e84:	56                   	push   %esi
+ e85:	53                   	push   %ebx
+ e86:	83 ec 0c             	sub    $0xc,%esp
+ e89:	8b 75 08             	mov    0x8(%ebp),%esi
+ e8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ e8f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ e94:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ e96:	8b 3e                	mov    (%esi),%edi
+ e98:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ e9b:	83 f8 02             	cmp    $0x2,%eax
+ e9e:	74 60                	je     f00 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ ea0:	83 ec 08             	sub    $0x8,%esp
+ ea3:	57                   	push   %edi
+ ea4:	56                   	push   %esi
+ ea5:	e8 89 f9 ff ff       	call   833 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ eaa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ eaf:	31 c0                	xor    %eax,%eax
+ eb1:	ba 01 00 00 00       	mov    $0x1,%edx
+ eb6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ eba:	83 c4 10             	add    $0x10,%esp
+ ebd:	85 c0                	test   %eax,%eax
+ ebf:	74 36                	je     ef7 <cond_wait+0x77>
+  if(c != 2)
+ ec1:	83 f8 02             	cmp    $0x2,%eax
+ ec4:	74 0c                	je     ed2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ ec6:	b8 02 00 00 00       	mov    $0x2,%eax
+ ecb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ ece:	85 c0                	test   %eax,%eax
+ ed0:	74 25                	je     ef7 <cond_wait+0x77>
+ ed2:	be 02 00 00 00       	mov    $0x2,%esi
+ ed7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ede:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ ee0:	83 ec 08             	sub    $0x8,%esp
+ ee3:	6a 02                	push   $0x2
+ ee5:	53                   	push   %ebx
+ ee6:	e8 48 f9 ff ff       	call   833 <futex_wait>
+ eeb:	89 f0                	mov    %esi,%eax
+ eed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ ef0:	83 c4 10             	add    $0x10,%esp
+ ef3:	85 c0                	test   %eax,%eax
+ ef5:	75 e9                	jne    ee0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ ef7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ efa:	5b                   	pop    %ebx
+ efb:	5e                   	pop    %esi
+ efc:	5f                   	pop    %edi
+ efd:	5d                   	pop    %ebp
+ efe:	c3                   	ret
+ eff:	90                   	nop
+    futex_wake(&m->val, 1);
+ f00:	83 ec 08             	sub    $0x8,%esp
+ f03:	6a 01                	push   $0x1
+ f05:	53                   	push   %ebx
+ f06:	e8 30 f9 ff ff       	call   83b <futex_wake>
+ f0b:	83 c4 10             	add    $0x10,%esp
+ f0e:	eb 90                	jmp    ea0 <cond_wait+0x20>
+
+00000f10 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ f10:	55                   	push   %ebp
+ f11:	89 e5                	mov    %esp,%ebp
+ f13:	83 ec 08             	sub    $0x8,%esp
+ f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ f19:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ f1d:	8b 50 04             	mov    0x4(%eax),%edx
+ f20:	85 d2                	test   %edx,%edx
+ f22:	75 0c                	jne    f30 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ f24:	c9                   	leave
+ f25:	c3                   	ret
+ f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f2d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ f30:	83 ec 08             	sub    $0x8,%esp
+ f33:	6a 01                	push   $0x1
+ f35:	50                   	push   %eax
+ f36:	e8 00 f9 ff ff       	call   83b <futex_wake>
+ f3b:	83 c4 10             	add    $0x10,%esp
+}
+ f3e:	c9                   	leave
+ f3f:	c3                   	ret
+
+00000f40 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ f40:	55                   	push   %ebp
+ f41:	89 e5                	mov    %esp,%ebp
+ f43:	83 ec 08             	sub    $0x8,%esp
+ f46:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ f49:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ f4d:	8b 50 04             	mov    0x4(%eax),%edx
+ f50:	85 d2                	test   %edx,%edx
+ f52:	75 0c                	jne    f60 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ f54:	c9                   	leave
+ f55:	c3                   	ret
+ f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ f60:	83 ec 08             	sub    $0x8,%esp
+ f63:	68 ff ff ff 7f       	push   $0x7fffffff
+ f68:	50                   	push   %eax
+ f69:	e8 cd f8 ff ff       	call   83b <futex_wake>
+ f6e:	83 c4 10             	add    $0x10,%esp
+}
+ f71:	c9                   	leave
+ f72:	c3                   	ret
@@ -0,0 +1,141 @@
+// Kernel spin lock stress test: one process per CPU takes a
+// shared kernel lock of each kind in turn, as fast as it can,
+// and we report the total rate and how evenly it was shared.
+// usage: lockbench [-n nproc] [-t ms]
+// Run with make CPUS=8 to see the test-and-set lock collapse.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Must match the LOCK_ kinds in spinlock.h.
+char *kinds[] = { "tas", "ticket", "mcs" };
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+static int
+ncpus(void)
+{
+  uint m;
+  int n;
+
+  sched_setaffinity(0, ~0);
+  if(sched_getaffinity(0, &m) < 0)
+    return 1;
+  for(n = 0; m; m >>= 1)
+    n += m & 1;
+  return n;
+}
+
+// Run nproc processes, one pinned to each CPU in turn, on
+// the lock of the given kind for ms milliseconds each.
+static void
+bench(int kind, int nproc, int ncpu, int ms)
+{
+  int go[2], res[2], i, n;
+  uint total, min, max;
+  char c;
+
+  if(pipe(go) < 0 || pipe(res) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      close(go[1]);
+      close(res[0]);
+      sched_setaffinity(0, 1 << (i % ncpu));
+      // Start together.
+      if(read(go[0], &c, 1) != 1)
+        exit();
+      n = lockbench(kind, ms);
+      write(res[1], &n, sizeof(n));
+      exit();
+    }
+  }
+  close(go[0]);
+  close(res[1]);
+  for(i = 0; i < nproc; i++)
+    write(go[1], "x", 1);
+  close(go[1]);
+
+  total = max = 0;
+  min = ~0;
+  for(i = 0; i < nproc; i++){
+    if(read(res[0], &n, sizeof(n)) != sizeof(n) || n < 0){
+      printf(2, "lockbench: lockbench failed\n");
+      break;
+    }
+    total += n;
+    if(n < min)
+      min = n;
+    if(n > max)
+      max = n;
+  }
+  close(res[0]);
+  for(i = 0; i < nproc; i++)
+    wait();
+
+  col(kinds[kind], 8);
+  coln(total, 12);
+  coln(total / ms, 10);
+  coln(min, 10);
+  coln(max, 10);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, nproc, ncpu, ms;
+
+  ncpu = ncpus();
+  nproc = ncpu;
+  ms = 1000;
+  for(i = 1; i+1 < argc; i += 2){
+    if(strcmp(argv[i], "-n") == 0)
+      nproc = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-t") == 0)
+      ms = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || nproc < 1 || ms < 1){
+    printf(2, "usage: lockbench [-n nproc] [-t ms]\n");
+    exit();
+  }
+
+  printf(1, "%d procs on %d cpus, %d ms per lock\n", nproc, ncpu, ms);
+  col("LOCK", 8);
+  col("OPS", 12);
+  col("OPS/MS", 10);
+  col("MIN", 10);
+  printf(1, "MAX\n");
+  for(i = 0; i < sizeof(kinds)/sizeof(kinds[0]); i++)
+    bench(i, nproc, ncpu, ms);
+  exit();
+}
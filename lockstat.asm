@@ -0,0 +1,2310 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 68             	sub    $0x68,%esp
+  int i, j, n, nb, pid;
+  struct lockstat t;
+
+  nb = 0;
+  if(argc > 1){
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1){
+      1a:	7e 4b                	jle    67 <main+0x67>
+    nb = lockstat(before, NLOCKCLASS);
+      1c:	50                   	push   %eax
+      1d:	50                   	push   %eax
+      1e:	6a 30                	push   $0x30
+      20:	68 60 1e 00 00       	push   $0x1e60
+      25:	e8 39 09 00 00       	call   963 <lockstat>
+      2a:	89 c3                	mov    %eax,%ebx
+    pid = fork();
+      2c:	e8 da 07 00 00       	call   80b <fork>
+    if(pid < 0){
+      31:	83 c4 10             	add    $0x10,%esp
+      34:	85 c0                	test   %eax,%eax
+      36:	0f 88 ea 03 00 00    	js     426 <main+0x426>
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      3c:	0f 85 44 03 00 00    	jne    386 <main+0x386>
+      exec(argv[1], argv+1);
+      42:	50                   	push   %eax
+      43:	50                   	push   %eax
+      44:	8d 46 04             	lea    0x4(%esi),%eax
+      47:	50                   	push   %eax
+      48:	ff 76 04             	push   0x4(%esi)
+      4b:	e8 fb 07 00 00       	call   84b <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      50:	83 c4 0c             	add    $0xc,%esp
+      53:	ff 76 04             	push   0x4(%esi)
+      56:	68 4b 10 00 00       	push   $0x104b
+      5b:	6a 02                	push   $0x2
+      5d:	e8 be 09 00 00       	call   a20 <printf>
+      exit();
+      62:	e8 ac 07 00 00       	call   813 <exit>
+    }
+    wait();
+  }
+  n = lockstat(after, NLOCKCLASS);
+      67:	52                   	push   %edx
+      68:	52                   	push   %edx
+      69:	6a 30                	push   $0x30
+      6b:	68 20 16 00 00       	push   $0x1620
+      70:	e8 ee 08 00 00       	call   963 <lockstat>
+  if(n < 0){
+      75:	83 c4 10             	add    $0x10,%esp
+  n = lockstat(after, NLOCKCLASS);
+      78:	89 45 90             	mov    %eax,-0x70(%ebp)
+  if(n < 0){
+      7b:	85 c0                	test   %eax,%eax
+      7d:	0f 88 b6 03 00 00    	js     439 <main+0x439>
+    after[i].ncontend -= before[i].ncontend;
+    after[i].waitus -= before[i].waitus;
+    after[i].nspin -= before[i].nspin;
+    after[i].nspinwon -= before[i].nspinwon;
+  }
+  for(i = 0; i < n; i++)
+      83:	8b 45 90             	mov    -0x70(%ebp),%eax
+      86:	85 c0                	test   %eax,%eax
+      88:	0f 84 be 03 00 00    	je     44c <main+0x44c>
+      8e:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      91:	bb 20 16 00 00       	mov    $0x1620,%ebx
+      96:	bf 4c 16 00 00       	mov    $0x164c,%edi
+      9b:	31 c9                	xor    %ecx,%ecx
+      9d:	89 fe                	mov    %edi,%esi
+    for(j = i+1; j < n; j++)
+      9f:	83 c1 01             	add    $0x1,%ecx
+  for(i = 0; i < n; i++)
+      a2:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+    for(j = i+1; j < n; j++)
+      a5:	89 f7                	mov    %esi,%edi
+      a7:	01 d8                	add    %ebx,%eax
+      a9:	89 45 94             	mov    %eax,-0x6c(%ebp)
+      ac:	8b 45 90             	mov    -0x70(%ebp),%eax
+      af:	39 c1                	cmp    %eax,%ecx
+      b1:	0f 8d 09 01 00 00    	jge    1c0 <main+0x1c0>
+      b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      be:	66 90                	xchg   %ax,%ax
+      c0:	89 4d 8c             	mov    %ecx,-0x74(%ebp)
+      c3:	eb 19                	jmp    de <main+0xde>
+      c5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(after[j].waitus > after[i].waitus ||
+      c8:	39 c2                	cmp    %eax,%edx
+      ca:	0f 84 a0 02 00 00    	je     370 <main+0x370>
+    for(j = i+1; j < n; j++)
+      d0:	8b 45 94             	mov    -0x6c(%ebp),%eax
+      d3:	83 c7 2c             	add    $0x2c,%edi
+      d6:	39 c7                	cmp    %eax,%edi
+      d8:	0f 84 cc 00 00 00    	je     1aa <main+0x1aa>
+      if(after[j].waitus > after[i].waitus ||
+      de:	8b 57 1c             	mov    0x1c(%edi),%edx
+      e1:	8b 46 f0             	mov    -0x10(%esi),%eax
+      e4:	39 d0                	cmp    %edx,%eax
+      e6:	73 e0                	jae    c8 <main+0xc8>
+         (after[j].waitus == after[i].waitus &&
+          after[j].ncontend > after[i].ncontend)){
+        t = after[i];
+      e8:	8b 46 e0             	mov    -0x20(%esi),%eax
+      eb:	8b 5e d4             	mov    -0x2c(%esi),%ebx
+    for(j = i+1; j < n; j++)
+      ee:	83 c7 2c             	add    $0x2c,%edi
+        t = after[i];
+      f1:	8b 4e d8             	mov    -0x28(%esi),%ecx
+      f4:	8b 56 dc             	mov    -0x24(%esi),%edx
+      f7:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+      fa:	8b 46 e4             	mov    -0x1c(%esi),%eax
+      fd:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     100:	8b 46 e8             	mov    -0x18(%esi),%eax
+     103:	89 45 ac             	mov    %eax,-0x54(%ebp)
+     106:	8b 46 ec             	mov    -0x14(%esi),%eax
+     109:	89 45 a8             	mov    %eax,-0x58(%ebp)
+     10c:	8b 46 f0             	mov    -0x10(%esi),%eax
+     10f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+     112:	8b 46 f4             	mov    -0xc(%esi),%eax
+     115:	89 45 a0             	mov    %eax,-0x60(%ebp)
+     118:	8b 46 f8             	mov    -0x8(%esi),%eax
+     11b:	89 45 9c             	mov    %eax,-0x64(%ebp)
+     11e:	8b 46 fc             	mov    -0x4(%esi),%eax
+     121:	89 45 98             	mov    %eax,-0x68(%ebp)
+        after[i] = after[j];
+     124:	8b 47 d4             	mov    -0x2c(%edi),%eax
+     127:	89 46 d4             	mov    %eax,-0x2c(%esi)
+     12a:	8b 47 d8             	mov    -0x28(%edi),%eax
+     12d:	89 46 d8             	mov    %eax,-0x28(%esi)
+     130:	8b 47 dc             	mov    -0x24(%edi),%eax
+     133:	89 46 dc             	mov    %eax,-0x24(%esi)
+     136:	8b 47 e0             	mov    -0x20(%edi),%eax
+     139:	89 46 e0             	mov    %eax,-0x20(%esi)
+     13c:	8b 47 e4             	mov    -0x1c(%edi),%eax
+     13f:	89 46 e4             	mov    %eax,-0x1c(%esi)
+     142:	8b 47 e8             	mov    -0x18(%edi),%eax
+     145:	89 46 e8             	mov    %eax,-0x18(%esi)
+     148:	8b 47 ec             	mov    -0x14(%edi),%eax
+     14b:	89 46 ec             	mov    %eax,-0x14(%esi)
+     14e:	8b 47 f0             	mov    -0x10(%edi),%eax
+     151:	89 46 f0             	mov    %eax,-0x10(%esi)
+     154:	8b 47 f4             	mov    -0xc(%edi),%eax
+     157:	89 46 f4             	mov    %eax,-0xc(%esi)
+     15a:	8b 47 f8             	mov    -0x8(%edi),%eax
+     15d:	89 46 f8             	mov    %eax,-0x8(%esi)
+     160:	8b 47 fc             	mov    -0x4(%edi),%eax
+     163:	89 46 fc             	mov    %eax,-0x4(%esi)
+        after[j] = t;
+     166:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     169:	89 5f d4             	mov    %ebx,-0x2c(%edi)
+     16c:	89 47 e0             	mov    %eax,-0x20(%edi)
+     16f:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     172:	89 4f d8             	mov    %ecx,-0x28(%edi)
+     175:	89 47 e4             	mov    %eax,-0x1c(%edi)
+     178:	8b 45 ac             	mov    -0x54(%ebp),%eax
+     17b:	89 57 dc             	mov    %edx,-0x24(%edi)
+     17e:	89 47 e8             	mov    %eax,-0x18(%edi)
+     181:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     184:	89 47 ec             	mov    %eax,-0x14(%edi)
+     187:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     18a:	89 47 f0             	mov    %eax,-0x10(%edi)
+     18d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+     190:	89 47 f4             	mov    %eax,-0xc(%edi)
+     193:	8b 45 9c             	mov    -0x64(%ebp),%eax
+     196:	89 47 f8             	mov    %eax,-0x8(%edi)
+     199:	8b 45 98             	mov    -0x68(%ebp),%eax
+     19c:	89 47 fc             	mov    %eax,-0x4(%edi)
+    for(j = i+1; j < n; j++)
+     19f:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     1a2:	39 c7                	cmp    %eax,%edi
+     1a4:	0f 85 34 ff ff ff    	jne    de <main+0xde>
+     1aa:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+     1ad:	8b 45 90             	mov    -0x70(%ebp),%eax
+  for(i = 0; i < n; i++)
+     1b0:	83 c6 2c             	add    $0x2c,%esi
+    for(j = i+1; j < n; j++)
+     1b3:	83 c1 01             	add    $0x1,%ecx
+     1b6:	89 f7                	mov    %esi,%edi
+     1b8:	39 c1                	cmp    %eax,%ecx
+     1ba:	0f 8c 00 ff ff ff    	jl     c0 <main+0xc0>
+  for(i = 0; i < n; i++)
+     1c0:	75 eb                	jne    1ad <main+0x1ad>
+      }
+
+  col("NAME", 14);
+     1c2:	ba 0e 00 00 00       	mov    $0xe,%edx
+     1c7:	b8 80 10 00 00       	mov    $0x1080,%eax
+     1cc:	8b 5d 88             	mov    -0x78(%ebp),%ebx
+     1cf:	e8 fc 02 00 00       	call   4d0 <col>
+  col("KIND", 7);
+     1d4:	ba 07 00 00 00       	mov    $0x7,%edx
+     1d9:	b8 85 10 00 00       	mov    $0x1085,%eax
+     1de:	e8 ed 02 00 00       	call   4d0 <col>
+  col("ACQUIRED", 11);
+     1e3:	ba 0b 00 00 00       	mov    $0xb,%edx
+     1e8:	b8 8a 10 00 00       	mov    $0x108a,%eax
+     1ed:	e8 de 02 00 00       	call   4d0 <col>
+  col("CONTENDED", 11);
+     1f2:	ba 0b 00 00 00       	mov    $0xb,%edx
+     1f7:	b8 93 10 00 00       	mov    $0x1093,%eax
+     1fc:	e8 cf 02 00 00       	call   4d0 <col>
+  col("WAIT-US", 11);
+     201:	ba 0b 00 00 00       	mov    $0xb,%edx
+     206:	b8 9d 10 00 00       	mov    $0x109d,%eax
+     20b:	e8 c0 02 00 00       	call   4d0 <col>
+  col("MAXHOLD-NS", 12);
+     210:	ba 0c 00 00 00       	mov    $0xc,%edx
+     215:	b8 a5 10 00 00       	mov    $0x10a5,%eax
+     21a:	e8 b1 02 00 00       	call   4d0 <col>
+  col("SPUN", 9);
+     21f:	ba 09 00 00 00       	mov    $0x9,%edx
+     224:	b8 b0 10 00 00       	mov    $0x10b0,%eax
+     229:	e8 a2 02 00 00       	call   4d0 <col>
+  printf(1, "SPIN-WON\n");
+     22e:	57                   	push   %edi
+     22f:	57                   	push   %edi
+  for(i = 0; i < n; i++){
+     230:	31 ff                	xor    %edi,%edi
+  printf(1, "SPIN-WON\n");
+     232:	68 b5 10 00 00       	push   $0x10b5
+     237:	6a 01                	push   $0x1
+     239:	e8 e2 07 00 00       	call   a20 <printf>
+     23e:	83 c4 10             	add    $0x10,%esp
+     241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(after[i].nacquire == 0)
+     248:	8b 73 14             	mov    0x14(%ebx),%esi
+     24b:	85 f6                	test   %esi,%esi
+     24d:	0f 84 03 01 00 00    	je     356 <main+0x356>
+  n = strlen(s);
+     253:	83 ec 0c             	sub    $0xc,%esp
+     256:	53                   	push   %ebx
+     257:	e8 04 04 00 00       	call   660 <strlen>
+  printf(1, "%s", s);
+     25c:	83 c4 0c             	add    $0xc,%esp
+     25f:	53                   	push   %ebx
+  n = strlen(s);
+     260:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+     262:	68 24 10 00 00       	push   $0x1024
+     267:	6a 01                	push   $0x1
+     269:	e8 b2 07 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     26e:	83 c4 10             	add    $0x10,%esp
+     271:	83 fe 0d             	cmp    $0xd,%esi
+     274:	7f 24                	jg     29a <main+0x29a>
+     276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     280:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     283:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     286:	68 27 10 00 00       	push   $0x1027
+     28b:	6a 01                	push   $0x1
+     28d:	e8 8e 07 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     292:	83 c4 10             	add    $0x10,%esp
+     295:	83 fe 0e             	cmp    $0xe,%esi
+     298:	75 e6                	jne    280 <main+0x280>
+      continue;
+    col(after[i].name, 14);
+    col(after[i].sleep ? "sleep" : "spin", 7);
+     29a:	8b 4b 10             	mov    0x10(%ebx),%ecx
+     29d:	b8 2f 10 00 00       	mov    $0x102f,%eax
+     2a2:	ba 29 10 00 00       	mov    $0x1029,%edx
+     2a7:	85 c9                	test   %ecx,%ecx
+     2a9:	0f 44 d0             	cmove  %eax,%edx
+  n = strlen(s);
+     2ac:	83 ec 0c             	sub    $0xc,%esp
+     2af:	52                   	push   %edx
+     2b0:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     2b3:	e8 a8 03 00 00       	call   660 <strlen>
+  printf(1, "%s", s);
+     2b8:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     2bb:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+     2be:	89 c6                	mov    %eax,%esi
+  printf(1, "%s", s);
+     2c0:	52                   	push   %edx
+     2c1:	68 24 10 00 00       	push   $0x1024
+     2c6:	6a 01                	push   $0x1
+     2c8:	e8 53 07 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     2cd:	83 c4 10             	add    $0x10,%esp
+     2d0:	83 fe 06             	cmp    $0x6,%esi
+     2d3:	7f 1d                	jg     2f2 <main+0x2f2>
+     2d5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     2d8:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     2db:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     2de:	68 27 10 00 00       	push   $0x1027
+     2e3:	6a 01                	push   $0x1
+     2e5:	e8 36 07 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     2ea:	83 c4 10             	add    $0x10,%esp
+     2ed:	83 fe 07             	cmp    $0x7,%esi
+     2f0:	75 e6                	jne    2d8 <main+0x2d8>
+    coln(after[i].nacquire, 11);
+     2f2:	8b 43 14             	mov    0x14(%ebx),%eax
+     2f5:	ba 0b 00 00 00       	mov    $0xb,%edx
+     2fa:	e8 31 02 00 00       	call   530 <coln>
+    coln(after[i].ncontend, 11);
+     2ff:	8b 43 18             	mov    0x18(%ebx),%eax
+     302:	ba 0b 00 00 00       	mov    $0xb,%edx
+     307:	e8 24 02 00 00       	call   530 <coln>
+    coln(after[i].waitus, 11);
+     30c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+     30f:	ba 0b 00 00 00       	mov    $0xb,%edx
+     314:	e8 17 02 00 00       	call   530 <coln>
+    if(!after[i].sleep){
+     319:	8b 53 10             	mov    0x10(%ebx),%edx
+     31c:	85 d2                	test   %edx,%edx
+     31e:	74 61                	je     381 <main+0x381>
+      coln(after[i].maxholdns, 0);
+      printf(1, "\n");
+      continue;
+    }
+    coln(after[i].maxholdns, 12);
+     320:	8b 43 20             	mov    0x20(%ebx),%eax
+     323:	ba 0c 00 00 00       	mov    $0xc,%edx
+     328:	e8 03 02 00 00       	call   530 <coln>
+    coln(after[i].nspin, 9);
+     32d:	8b 43 24             	mov    0x24(%ebx),%eax
+     330:	ba 09 00 00 00       	mov    $0x9,%edx
+     335:	e8 f6 01 00 00       	call   530 <coln>
+    coln(after[i].nspinwon, 0);
+     33a:	8b 43 28             	mov    0x28(%ebx),%eax
+     33d:	31 d2                	xor    %edx,%edx
+     33f:	e8 ec 01 00 00       	call   530 <coln>
+    printf(1, "\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 bd 10 00 00       	push   $0x10bd
+     34c:	6a 01                	push   $0x1
+     34e:	e8 cd 06 00 00       	call   a20 <printf>
+     353:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+     356:	8b 45 90             	mov    -0x70(%ebp),%eax
+     359:	83 c7 01             	add    $0x1,%edi
+     35c:	83 c3 2c             	add    $0x2c,%ebx
+     35f:	39 c7                	cmp    %eax,%edi
+     361:	0f 85 e1 fe ff ff    	jne    248 <main+0x248>
+  }
+  exit();
+     367:	e8 a7 04 00 00       	call   813 <exit>
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+         (after[j].waitus == after[i].waitus &&
+     370:	8b 47 18             	mov    0x18(%edi),%eax
+     373:	39 46 ec             	cmp    %eax,-0x14(%esi)
+     376:	0f 83 54 fd ff ff    	jae    d0 <main+0xd0>
+     37c:	e9 67 fd ff ff       	jmp    e8 <main+0xe8>
+      coln(after[i].maxholdns, 0);
+     381:	8b 43 20             	mov    0x20(%ebx),%eax
+     384:	eb b7                	jmp    33d <main+0x33d>
+    wait();
+     386:	e8 90 04 00 00       	call   81b <wait>
+  n = lockstat(after, NLOCKCLASS);
+     38b:	50                   	push   %eax
+     38c:	50                   	push   %eax
+     38d:	6a 30                	push   $0x30
+     38f:	68 20 16 00 00       	push   $0x1620
+     394:	e8 ca 05 00 00       	call   963 <lockstat>
+  if(n < 0){
+     399:	83 c4 10             	add    $0x10,%esp
+  n = lockstat(after, NLOCKCLASS);
+     39c:	89 45 90             	mov    %eax,-0x70(%ebp)
+  if(n < 0){
+     39f:	85 c0                	test   %eax,%eax
+     3a1:	0f 88 92 00 00 00    	js     439 <main+0x439>
+  for(i = 0; i < nb; i++){
+     3a7:	85 db                	test   %ebx,%ebx
+     3a9:	0f 8e d4 fc ff ff    	jle    83 <main+0x83>
+     3af:	6b cb 2c             	imul   $0x2c,%ebx,%ecx
+     3b2:	b8 14 00 00 00       	mov    $0x14,%eax
+     3b7:	83 c1 14             	add    $0x14,%ecx
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    after[i].nacquire -= before[i].nacquire;
+     3c0:	8b 90 20 16 00 00    	mov    0x1620(%eax),%edx
+     3c6:	2b 90 60 1e 00 00    	sub    0x1e60(%eax),%edx
+  for(i = 0; i < nb; i++){
+     3cc:	83 c0 2c             	add    $0x2c,%eax
+    after[i].nacquire -= before[i].nacquire;
+     3cf:	89 90 f4 15 00 00    	mov    %edx,0x15f4(%eax)
+    after[i].ncontend -= before[i].ncontend;
+     3d5:	8b 90 f8 15 00 00    	mov    0x15f8(%eax),%edx
+     3db:	2b 90 38 1e 00 00    	sub    0x1e38(%eax),%edx
+     3e1:	89 90 f8 15 00 00    	mov    %edx,0x15f8(%eax)
+    after[i].waitus -= before[i].waitus;
+     3e7:	8b 90 fc 15 00 00    	mov    0x15fc(%eax),%edx
+     3ed:	2b 90 3c 1e 00 00    	sub    0x1e3c(%eax),%edx
+     3f3:	89 90 fc 15 00 00    	mov    %edx,0x15fc(%eax)
+    after[i].nspin -= before[i].nspin;
+     3f9:	8b 90 04 16 00 00    	mov    0x1604(%eax),%edx
+     3ff:	2b 90 44 1e 00 00    	sub    0x1e44(%eax),%edx
+     405:	89 90 04 16 00 00    	mov    %edx,0x1604(%eax)
+    after[i].nspinwon -= before[i].nspinwon;
+     40b:	8b 90 08 16 00 00    	mov    0x1608(%eax),%edx
+     411:	2b 90 48 1e 00 00    	sub    0x1e48(%eax),%edx
+     417:	89 90 08 16 00 00    	mov    %edx,0x1608(%eax)
+  for(i = 0; i < nb; i++){
+     41d:	39 c8                	cmp    %ecx,%eax
+     41f:	75 9f                	jne    3c0 <main+0x3c0>
+     421:	e9 5d fc ff ff       	jmp    83 <main+0x83>
+      printf(2, "lockstat: fork failed\n");
+     426:	50                   	push   %eax
+     427:	50                   	push   %eax
+     428:	68 34 10 00 00       	push   $0x1034
+     42d:	6a 02                	push   $0x2
+     42f:	e8 ec 05 00 00       	call   a20 <printf>
+      exit();
+     434:	e8 da 03 00 00       	call   813 <exit>
+    printf(2, "lockstat: lockstat failed\n");
+     439:	50                   	push   %eax
+     43a:	50                   	push   %eax
+     43b:	68 65 10 00 00       	push   $0x1065
+     440:	6a 02                	push   $0x2
+     442:	e8 d9 05 00 00       	call   a20 <printf>
+    exit();
+     447:	e8 c7 03 00 00       	call   813 <exit>
+  col("NAME", 14);
+     44c:	ba 0e 00 00 00       	mov    $0xe,%edx
+     451:	b8 80 10 00 00       	mov    $0x1080,%eax
+     456:	e8 75 00 00 00       	call   4d0 <col>
+  col("KIND", 7);
+     45b:	ba 07 00 00 00       	mov    $0x7,%edx
+     460:	b8 85 10 00 00       	mov    $0x1085,%eax
+     465:	e8 66 00 00 00       	call   4d0 <col>
+  col("ACQUIRED", 11);
+     46a:	ba 0b 00 00 00       	mov    $0xb,%edx
+     46f:	b8 8a 10 00 00       	mov    $0x108a,%eax
+     474:	e8 57 00 00 00       	call   4d0 <col>
+  col("CONTENDED", 11);
+     479:	ba 0b 00 00 00       	mov    $0xb,%edx
+     47e:	b8 93 10 00 00       	mov    $0x1093,%eax
+     483:	e8 48 00 00 00       	call   4d0 <col>
+  col("WAIT-US", 11);
+     488:	ba 0b 00 00 00       	mov    $0xb,%edx
+     48d:	b8 9d 10 00 00       	mov    $0x109d,%eax
+     492:	e8 39 00 00 00       	call   4d0 <col>
+  col("MAXHOLD-NS", 12);
+     497:	ba 0c 00 00 00       	mov    $0xc,%edx
+     49c:	b8 a5 10 00 00       	mov    $0x10a5,%eax
+     4a1:	e8 2a 00 00 00       	call   4d0 <col>
+  col("SPUN", 9);
+     4a6:	b8 b0 10 00 00       	mov    $0x10b0,%eax
+     4ab:	ba 09 00 00 00       	mov    $0x9,%edx
+     4b0:	e8 1b 00 00 00       	call   4d0 <col>
+  printf(1, "SPIN-WON\n");
+     4b5:	50                   	push   %eax
+     4b6:	50                   	push   %eax
+     4b7:	68 b5 10 00 00       	push   $0x10b5
+     4bc:	6a 01                	push   $0x1
+     4be:	e8 5d 05 00 00       	call   a20 <printf>
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	e9 9c fe ff ff       	jmp    367 <main+0x367>
+     4cb:	66 90                	xchg   %ax,%ax
+     4cd:	66 90                	xchg   %ax,%ax
+     4cf:	90                   	nop
+
+000004d0 <col>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	57                   	push   %edi
+     4d4:	89 c7                	mov    %eax,%edi
+     4d6:	56                   	push   %esi
+     4d7:	89 d6                	mov    %edx,%esi
+     4d9:	53                   	push   %ebx
+     4da:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+     4dd:	50                   	push   %eax
+     4de:	e8 7d 01 00 00       	call   660 <strlen>
+  printf(1, "%s", s);
+     4e3:	83 c4 0c             	add    $0xc,%esp
+     4e6:	57                   	push   %edi
+  n = strlen(s);
+     4e7:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+     4e9:	68 24 10 00 00       	push   $0x1024
+     4ee:	6a 01                	push   $0x1
+     4f0:	e8 2b 05 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     4f5:	83 c4 10             	add    $0x10,%esp
+     4f8:	39 f3                	cmp    %esi,%ebx
+     4fa:	7d 1d                	jge    519 <col+0x49>
+     4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     500:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     503:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     506:	68 27 10 00 00       	push   $0x1027
+     50b:	6a 01                	push   $0x1
+     50d:	e8 0e 05 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     512:	83 c4 10             	add    $0x10,%esp
+     515:	39 de                	cmp    %ebx,%esi
+     517:	75 e7                	jne    500 <col+0x30>
+}
+     519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     51c:	5b                   	pop    %ebx
+     51d:	5e                   	pop    %esi
+     51e:	5f                   	pop    %edi
+     51f:	5d                   	pop    %ebp
+     520:	c3                   	ret
+     521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+
+00000530 <coln>:
+{
+     530:	55                   	push   %ebp
+     531:	89 c1                	mov    %eax,%ecx
+     533:	89 e5                	mov    %esp,%ebp
+     535:	57                   	push   %edi
+     536:	56                   	push   %esi
+    buf[--i] = '0' + x % 10;
+     537:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+     53c:	53                   	push   %ebx
+  i = sizeof(buf) - 1;
+     53d:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+     542:	83 ec 2c             	sub    $0x2c,%esp
+  buf[i] = 0;
+     545:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+     549:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     550:	89 c8                	mov    %ecx,%eax
+     552:	83 eb 01             	sub    $0x1,%ebx
+     555:	f7 e6                	mul    %esi
+     557:	89 c8                	mov    %ecx,%eax
+     559:	c1 ea 03             	shr    $0x3,%edx
+     55c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     55f:	01 ff                	add    %edi,%edi
+     561:	29 f8                	sub    %edi,%eax
+     563:	83 c0 30             	add    $0x30,%eax
+     566:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+     56a:	89 c8                	mov    %ecx,%eax
+     56c:	89 d1                	mov    %edx,%ecx
+     56e:	83 f8 09             	cmp    $0x9,%eax
+     571:	77 dd                	ja     550 <coln+0x20>
+  col(buf+i, w);
+     573:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+     576:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+     579:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     57c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+     57f:	56                   	push   %esi
+     580:	e8 db 00 00 00       	call   660 <strlen>
+  printf(1, "%s", s);
+     585:	83 c4 0c             	add    $0xc,%esp
+     588:	56                   	push   %esi
+  n = strlen(s);
+     589:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+     58b:	68 24 10 00 00       	push   $0x1024
+     590:	6a 01                	push   $0x1
+     592:	e8 89 04 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     597:	83 c4 10             	add    $0x10,%esp
+     59a:	39 df                	cmp    %ebx,%edi
+     59c:	7e 1b                	jle    5b9 <coln+0x89>
+     59e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     5a0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+     5a3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+     5a6:	68 27 10 00 00       	push   $0x1027
+     5ab:	6a 01                	push   $0x1
+     5ad:	e8 6e 04 00 00       	call   a20 <printf>
+  for(; n < w; n++)
+     5b2:	83 c4 10             	add    $0x10,%esp
+     5b5:	39 df                	cmp    %ebx,%edi
+     5b7:	75 e7                	jne    5a0 <coln+0x70>
+}
+     5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5bc:	5b                   	pop    %ebx
+     5bd:	5e                   	pop    %esi
+     5be:	5f                   	pop    %edi
+     5bf:	5d                   	pop    %ebp
+     5c0:	c3                   	ret
+     5c1:	66 90                	xchg   %ax,%ax
+     5c3:	66 90                	xchg   %ax,%ax
+     5c5:	66 90                	xchg   %ax,%ax
+     5c7:	66 90                	xchg   %ax,%ax
+     5c9:	66 90                	xchg   %ax,%ax
+     5cb:	66 90                	xchg   %ax,%ax
+     5cd:	66 90                	xchg   %ax,%ax
+     5cf:	90                   	nop
+
+000005d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     5d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     5d1:	31 c0                	xor    %eax,%eax
+{
+     5d3:	89 e5                	mov    %esp,%ebp
+     5d5:	53                   	push   %ebx
+     5d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5e7:	83 c0 01             	add    $0x1,%eax
+     5ea:	84 d2                	test   %dl,%dl
+     5ec:	75 f2                	jne    5e0 <strcpy+0x10>
+    ;
+  return os;
+}
+     5ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5f1:	89 c8                	mov    %ecx,%eax
+     5f3:	c9                   	leave
+     5f4:	c3                   	ret
+     5f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	53                   	push   %ebx
+     604:	8b 55 08             	mov    0x8(%ebp),%edx
+     607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     60a:	0f b6 02             	movzbl (%edx),%eax
+     60d:	84 c0                	test   %al,%al
+     60f:	75 17                	jne    628 <strcmp+0x28>
+     611:	eb 3a                	jmp    64d <strcmp+0x4d>
+     613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     617:	90                   	nop
+     618:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     61c:	83 c2 01             	add    $0x1,%edx
+     61f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     622:	84 c0                	test   %al,%al
+     624:	74 1a                	je     640 <strcmp+0x40>
+    p++, q++;
+     626:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     628:	0f b6 19             	movzbl (%ecx),%ebx
+     62b:	38 c3                	cmp    %al,%bl
+     62d:	74 e9                	je     618 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     62f:	29 d8                	sub    %ebx,%eax
+}
+     631:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     634:	c9                   	leave
+     635:	c3                   	ret
+     636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     640:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     644:	31 c0                	xor    %eax,%eax
+     646:	29 d8                	sub    %ebx,%eax
+}
+     648:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     64b:	c9                   	leave
+     64c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     64d:	0f b6 19             	movzbl (%ecx),%ebx
+     650:	31 c0                	xor    %eax,%eax
+     652:	eb db                	jmp    62f <strcmp+0x2f>
+     654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <strlen>:
+
+uint
+strlen(char *s)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     666:	80 3a 00             	cmpb   $0x0,(%edx)
+     669:	74 15                	je     680 <strlen+0x20>
+     66b:	31 c0                	xor    %eax,%eax
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+     670:	83 c0 01             	add    $0x1,%eax
+     673:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     677:	89 c1                	mov    %eax,%ecx
+     679:	75 f5                	jne    670 <strlen+0x10>
+    ;
+  return n;
+}
+     67b:	89 c8                	mov    %ecx,%eax
+     67d:	5d                   	pop    %ebp
+     67e:	c3                   	ret
+     67f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     680:	31 c9                	xor    %ecx,%ecx
+}
+     682:	5d                   	pop    %ebp
+     683:	89 c8                	mov    %ecx,%eax
+     685:	c3                   	ret
+     686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     697:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     69a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     69d:	89 d7                	mov    %edx,%edi
+     69f:	fc                   	cld
+     6a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     6a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     6a5:	89 d0                	mov    %edx,%eax
+     6a7:	c9                   	leave
+     6a8:	c3                   	ret
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6ba:	0f b6 10             	movzbl (%eax),%edx
+     6bd:	84 d2                	test   %dl,%dl
+     6bf:	75 12                	jne    6d3 <strchr+0x23>
+     6c1:	eb 1d                	jmp    6e0 <strchr+0x30>
+     6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6c7:	90                   	nop
+     6c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6cc:	83 c0 01             	add    $0x1,%eax
+     6cf:	84 d2                	test   %dl,%dl
+     6d1:	74 0d                	je     6e0 <strchr+0x30>
+    if(*s == c)
+     6d3:	38 d1                	cmp    %dl,%cl
+     6d5:	75 f1                	jne    6c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     6d7:	5d                   	pop    %ebp
+     6d8:	c3                   	ret
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6e0:	31 c0                	xor    %eax,%eax
+}
+     6e2:	5d                   	pop    %ebp
+     6e3:	c3                   	ret
+     6e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     6f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     6f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     6f9:	31 db                	xor    %ebx,%ebx
+{
+     6fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     6fe:	eb 27                	jmp    727 <gets+0x37>
+    cc = read(0, &c, 1);
+     700:	83 ec 04             	sub    $0x4,%esp
+     703:	6a 01                	push   $0x1
+     705:	56                   	push   %esi
+     706:	6a 00                	push   $0x0
+     708:	e8 1e 01 00 00       	call   82b <read>
+    if(cc < 1)
+     70d:	83 c4 10             	add    $0x10,%esp
+     710:	85 c0                	test   %eax,%eax
+     712:	7e 1d                	jle    731 <gets+0x41>
+      break;
+    buf[i++] = c;
+     714:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     718:	8b 55 08             	mov    0x8(%ebp),%edx
+     71b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     71f:	3c 0a                	cmp    $0xa,%al
+     721:	74 10                	je     733 <gets+0x43>
+     723:	3c 0d                	cmp    $0xd,%al
+     725:	74 0c                	je     733 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     727:	89 df                	mov    %ebx,%edi
+     729:	83 c3 01             	add    $0x1,%ebx
+     72c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     72f:	7c cf                	jl     700 <gets+0x10>
+     731:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     73a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     73d:	5b                   	pop    %ebx
+     73e:	5e                   	pop    %esi
+     73f:	5f                   	pop    %edi
+     740:	5d                   	pop    %ebp
+     741:	c3                   	ret
+     742:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	56                   	push   %esi
+     754:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     755:	83 ec 08             	sub    $0x8,%esp
+     758:	6a 00                	push   $0x0
+     75a:	ff 75 08             	push   0x8(%ebp)
+     75d:	e8 f1 00 00 00       	call   853 <open>
+  if(fd < 0)
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	78 27                	js     790 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     769:	83 ec 08             	sub    $0x8,%esp
+     76c:	ff 75 0c             	push   0xc(%ebp)
+     76f:	89 c3                	mov    %eax,%ebx
+     771:	50                   	push   %eax
+     772:	e8 f4 00 00 00       	call   86b <fstat>
+  close(fd);
+     777:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     77a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     77c:	e8 ba 00 00 00       	call   83b <close>
+  return r;
+     781:	83 c4 10             	add    $0x10,%esp
+}
+     784:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     787:	89 f0                	mov    %esi,%eax
+     789:	5b                   	pop    %ebx
+     78a:	5e                   	pop    %esi
+     78b:	5d                   	pop    %ebp
+     78c:	c3                   	ret
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     790:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     795:	eb ed                	jmp    784 <stat+0x34>
+     797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	53                   	push   %ebx
+     7a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     7a7:	0f be 02             	movsbl (%edx),%eax
+     7aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     7ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     7b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     7b5:	77 1e                	ja     7d5 <atoi+0x35>
+     7b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     7c0:	83 c2 01             	add    $0x1,%edx
+     7c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     7c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     7ca:	0f be 02             	movsbl (%edx),%eax
+     7cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     7d0:	80 fb 09             	cmp    $0x9,%bl
+     7d3:	76 eb                	jbe    7c0 <atoi+0x20>
+  return n;
+}
+     7d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7d8:	89 c8                	mov    %ecx,%eax
+     7da:	c9                   	leave
+     7db:	c3                   	ret
+     7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	57                   	push   %edi
+     7e4:	56                   	push   %esi
+     7e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     7e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     7ee:	85 c0                	test   %eax,%eax
+     7f0:	7e 13                	jle    805 <memmove+0x25>
+     7f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     7f4:	89 d7                	mov    %edx,%edi
+     7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     800:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     801:	39 f8                	cmp    %edi,%eax
+     803:	75 fb                	jne    800 <memmove+0x20>
+  return vdst;
+}
+     805:	5e                   	pop    %esi
+     806:	89 d0                	mov    %edx,%eax
+     808:	5f                   	pop    %edi
+     809:	5d                   	pop    %ebp
+     80a:	c3                   	ret
+
+0000080b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     80b:	b8 01 00 00 00       	mov    $0x1,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <exit>:
+SYSCALL(exit)
+     813:	b8 02 00 00 00       	mov    $0x2,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <wait>:
+SYSCALL(wait)
+     81b:	b8 03 00 00 00       	mov    $0x3,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <pipe>:
+SYSCALL(pipe)
+     823:	b8 04 00 00 00       	mov    $0x4,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <read>:
+SYSCALL(read)
+     82b:	b8 05 00 00 00       	mov    $0x5,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <write>:
+SYSCALL(write)
+     833:	b8 10 00 00 00       	mov    $0x10,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <close>:
+SYSCALL(close)
+     83b:	b8 15 00 00 00       	mov    $0x15,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <kill>:
+SYSCALL(kill)
+     843:	b8 06 00 00 00       	mov    $0x6,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <exec>:
+SYSCALL(exec)
+     84b:	b8 07 00 00 00       	mov    $0x7,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <open>:
+SYSCALL(open)
+     853:	b8 0f 00 00 00       	mov    $0xf,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <mknod>:
+SYSCALL(mknod)
+     85b:	b8 11 00 00 00       	mov    $0x11,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <unlink>:
+SYSCALL(unlink)
+     863:	b8 12 00 00 00       	mov    $0x12,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <fstat>:
+SYSCALL(fstat)
+     86b:	b8 08 00 00 00       	mov    $0x8,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <link>:
+SYSCALL(link)
+     873:	b8 13 00 00 00       	mov    $0x13,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+
+0000087b <mkdir>:
+SYSCALL(mkdir)
+     87b:	b8 14 00 00 00       	mov    $0x14,%eax
+     880:	cd 40                	int    $0x40
+     882:	c3                   	ret
+
+00000883 <chdir>:
+SYSCALL(chdir)
+     883:	b8 09 00 00 00       	mov    $0x9,%eax
+     888:	cd 40                	int    $0x40
+     88a:	c3                   	ret
+
+0000088b <dup>:
+SYSCALL(dup)
+     88b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <getpid>:
+SYSCALL(getpid)
+     893:	b8 0b 00 00 00       	mov    $0xb,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <sbrk>:
+SYSCALL(sbrk)
+     89b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <sleep>:
+SYSCALL(sleep)
+     8a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+
+000008ab <uptime>:
+SYSCALL(uptime)
+     8ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <add_dir>:
+SYSCALL(add_dir)
+     8b3:	b8 16 00 00 00       	mov    $0x16,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <history>:
+SYSCALL(history)
+     8bb:	b8 18 00 00 00       	mov    $0x18,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <clock_gettime>:
+SYSCALL(clock_gettime)
+     8c3:	b8 19 00 00 00       	mov    $0x19,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <nanosleep>:
+SYSCALL(nanosleep)
+     8cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <clone>:
+SYSCALL(clone)
+     8d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+
+000008db <join>:
+SYSCALL(join)
+     8db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8e0:	cd 40                	int    $0x40
+     8e2:	c3                   	ret
+
+000008e3 <futex_wait>:
+SYSCALL(futex_wait)
+     8e3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8e8:	cd 40                	int    $0x40
+     8ea:	c3                   	ret
+
+000008eb <futex_wake>:
+SYSCALL(futex_wake)
+     8eb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8f0:	cd 40                	int    $0x40
+     8f2:	c3                   	ret
+
+000008f3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     8f3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8f8:	cd 40                	int    $0x40
+     8fa:	c3                   	ret
+
+000008fb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     8fb:	b8 20 00 00 00       	mov    $0x20,%eax
+     900:	cd 40                	int    $0x40
+     902:	c3                   	ret
+
+00000903 <sched_isolate>:
+SYSCALL(sched_isolate)
+     903:	b8 21 00 00 00       	mov    $0x21,%eax
+     908:	cd 40                	int    $0x40
+     90a:	c3                   	ret
+
+0000090b <getprocinfo>:
+SYSCALL(getprocinfo)
+     90b:	b8 22 00 00 00       	mov    $0x22,%eax
+     910:	cd 40                	int    $0x40
+     912:	c3                   	ret
+
+00000913 <waitpid>:
+SYSCALL(waitpid)
+     913:	b8 23 00 00 00       	mov    $0x23,%eax
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+
+0000091b <tracectl>:
+SYSCALL(tracectl)
+     91b:	b8 24 00 00 00       	mov    $0x24,%eax
+     920:	cd 40                	int    $0x40
+     922:	c3                   	ret
+
+00000923 <traceread>:
+SYSCALL(traceread)
+     923:	b8 25 00 00 00       	mov    $0x25,%eax
+     928:	cd 40                	int    $0x40
+     92a:	c3                   	ret
+
+0000092b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+     92b:	b8 26 00 00 00       	mov    $0x26,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+     933:	b8 27 00 00 00       	mov    $0x27,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+     93b:	b8 28 00 00 00       	mov    $0x28,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <irqroute>:
+SYSCALL(irqroute)
+     943:	b8 29 00 00 00       	mov    $0x29,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <irqstat>:
+SYSCALL(irqstat)
+     94b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <boottimes>:
+SYSCALL(boottimes)
+     953:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <lockbench>:
+SYSCALL(lockbench)
+     95b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <lockstat>:
+SYSCALL(lockstat)
+     963:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <cpustat>:
+SYSCALL(cpustat)
+     96b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <bcachesize>:
+SYSCALL(bcachesize)
+     973:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+     97b:	66 90                	xchg   %ax,%ax
+     97d:	66 90                	xchg   %ax,%ax
+     97f:	90                   	nop
+
+00000980 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	56                   	push   %esi
+     985:	53                   	push   %ebx
+     986:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     988:	89 d1                	mov    %edx,%ecx
+{
+     98a:	83 ec 3c             	sub    $0x3c,%esp
+     98d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     990:	85 d2                	test   %edx,%edx
+     992:	0f 89 80 00 00 00    	jns    a18 <printint+0x98>
+     998:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     99c:	74 7a                	je     a18 <printint+0x98>
+    x = -xx;
+     99e:	f7 d9                	neg    %ecx
+    neg = 1;
+     9a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     9a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     9a8:	31 f6                	xor    %esi,%esi
+     9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     9b0:	89 c8                	mov    %ecx,%eax
+     9b2:	31 d2                	xor    %edx,%edx
+     9b4:	89 f7                	mov    %esi,%edi
+     9b6:	f7 f3                	div    %ebx
+     9b8:	8d 76 01             	lea    0x1(%esi),%esi
+     9bb:	0f b6 92 20 11 00 00 	movzbl 0x1120(%edx),%edx
+     9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9c6:	89 ca                	mov    %ecx,%edx
+     9c8:	89 c1                	mov    %eax,%ecx
+     9ca:	39 da                	cmp    %ebx,%edx
+     9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+     9ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     9d1:	85 c0                	test   %eax,%eax
+     9d3:	74 07                	je     9dc <printint+0x5c>
+    buf[i++] = '-';
+     9d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9da:	89 f7                	mov    %esi,%edi
+     9dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     9df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9e2:	01 df                	add    %ebx,%edi
+     9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     9e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     9eb:	83 ec 04             	sub    $0x4,%esp
+     9ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+     9f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     9f4:	6a 01                	push   $0x1
+     9f6:	50                   	push   %eax
+     9f7:	56                   	push   %esi
+     9f8:	e8 36 fe ff ff       	call   833 <write>
+  while(--i >= 0)
+     9fd:	89 f8                	mov    %edi,%eax
+     9ff:	83 c4 10             	add    $0x10,%esp
+     a02:	83 ef 01             	sub    $0x1,%edi
+     a05:	39 d8                	cmp    %ebx,%eax
+     a07:	75 df                	jne    9e8 <printint+0x68>
+}
+     a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a0c:	5b                   	pop    %ebx
+     a0d:	5e                   	pop    %esi
+     a0e:	5f                   	pop    %edi
+     a0f:	5d                   	pop    %ebp
+     a10:	c3                   	ret
+     a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     a18:	31 c0                	xor    %eax,%eax
+     a1a:	eb 89                	jmp    9a5 <printint+0x25>
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+     a25:	53                   	push   %ebx
+     a26:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     a29:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     a2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     a2f:	0f b6 1e             	movzbl (%esi),%ebx
+     a32:	83 c6 01             	add    $0x1,%esi
+     a35:	84 db                	test   %bl,%bl
+     a37:	74 67                	je     aa0 <printf+0x80>
+     a39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a3c:	31 d2                	xor    %edx,%edx
+     a3e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     a41:	eb 34                	jmp    a77 <printf+0x57>
+     a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a47:	90                   	nop
+     a48:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     a4b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     a50:	83 f8 25             	cmp    $0x25,%eax
+     a53:	74 18                	je     a6d <printf+0x4d>
+  write(fd, &c, 1);
+     a55:	83 ec 04             	sub    $0x4,%esp
+     a58:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     a5b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     a5e:	6a 01                	push   $0x1
+     a60:	50                   	push   %eax
+     a61:	57                   	push   %edi
+     a62:	e8 cc fd ff ff       	call   833 <write>
+     a67:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     a6a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     a6d:	0f b6 1e             	movzbl (%esi),%ebx
+     a70:	83 c6 01             	add    $0x1,%esi
+     a73:	84 db                	test   %bl,%bl
+     a75:	74 29                	je     aa0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     a77:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     a7a:	85 d2                	test   %edx,%edx
+     a7c:	74 ca                	je     a48 <printf+0x28>
+      }
+    } else if(state == '%'){
+     a7e:	83 fa 25             	cmp    $0x25,%edx
+     a81:	75 ea                	jne    a6d <printf+0x4d>
+      if(c == 'd'){
+     a83:	83 f8 25             	cmp    $0x25,%eax
+     a86:	0f 84 24 01 00 00    	je     bb0 <printf+0x190>
+     a8c:	83 e8 63             	sub    $0x63,%eax
+     a8f:	83 f8 15             	cmp    $0x15,%eax
+     a92:	77 1c                	ja     ab0 <printf+0x90>
+     a94:	ff 24 85 c8 10 00 00 	jmp    *0x10c8(,%eax,4)
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa3:	5b                   	pop    %ebx
+     aa4:	5e                   	pop    %esi
+     aa5:	5f                   	pop    %edi
+     aa6:	5d                   	pop    %ebp
+     aa7:	c3                   	ret
+     aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+  write(fd, &c, 1);
+     ab0:	83 ec 04             	sub    $0x4,%esp
+     ab3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ab6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     aba:	6a 01                	push   $0x1
+     abc:	52                   	push   %edx
+     abd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     ac0:	57                   	push   %edi
+     ac1:	e8 6d fd ff ff       	call   833 <write>
+     ac6:	83 c4 0c             	add    $0xc,%esp
+     ac9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     acc:	6a 01                	push   $0x1
+     ace:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     ad1:	52                   	push   %edx
+     ad2:	57                   	push   %edi
+     ad3:	e8 5b fd ff ff       	call   833 <write>
+        putc(fd, c);
+     ad8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     adb:	31 d2                	xor    %edx,%edx
+     add:	eb 8e                	jmp    a6d <printf+0x4d>
+     adf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     ae0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ae3:	83 ec 0c             	sub    $0xc,%esp
+     ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     aeb:	8b 13                	mov    (%ebx),%edx
+     aed:	6a 00                	push   $0x0
+     aef:	89 f8                	mov    %edi,%eax
+        ap++;
+     af1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     af4:	e8 87 fe ff ff       	call   980 <printint>
+        ap++;
+     af9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     afc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aff:	31 d2                	xor    %edx,%edx
+     b01:	e9 67 ff ff ff       	jmp    a6d <printf+0x4d>
+     b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     b13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     b15:	83 c0 04             	add    $0x4,%eax
+     b18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     b1b:	85 db                	test   %ebx,%ebx
+     b1d:	0f 84 9d 00 00 00    	je     bc0 <printf+0x1a0>
+        while(*s != 0){
+     b23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     b26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     b28:	84 c0                	test   %al,%al
+     b2a:	0f 84 3d ff ff ff    	je     a6d <printf+0x4d>
+     b30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     b33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     b36:	89 de                	mov    %ebx,%esi
+     b38:	89 d3                	mov    %edx,%ebx
+     b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     b40:	83 ec 04             	sub    $0x4,%esp
+     b43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     b46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     b49:	6a 01                	push   $0x1
+     b4b:	53                   	push   %ebx
+     b4c:	57                   	push   %edi
+     b4d:	e8 e1 fc ff ff       	call   833 <write>
+        while(*s != 0){
+     b52:	0f b6 06             	movzbl (%esi),%eax
+     b55:	83 c4 10             	add    $0x10,%esp
+     b58:	84 c0                	test   %al,%al
+     b5a:	75 e4                	jne    b40 <printf+0x120>
+      state = 0;
+     b5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     b5f:	31 d2                	xor    %edx,%edx
+     b61:	e9 07 ff ff ff       	jmp    a6d <printf+0x4d>
+     b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     b70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b73:	83 ec 0c             	sub    $0xc,%esp
+     b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b7b:	8b 13                	mov    (%ebx),%edx
+     b7d:	6a 01                	push   $0x1
+     b7f:	e9 6b ff ff ff       	jmp    aef <printf+0xcf>
+     b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     b88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     b8b:	83 ec 04             	sub    $0x4,%esp
+     b8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     b91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     b93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     b96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     b99:	6a 01                	push   $0x1
+     b9b:	52                   	push   %edx
+     b9c:	57                   	push   %edi
+     b9d:	e8 91 fc ff ff       	call   833 <write>
+        ap++;
+     ba2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     ba5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ba8:	31 d2                	xor    %edx,%edx
+     baa:	e9 be fe ff ff       	jmp    a6d <printf+0x4d>
+     baf:	90                   	nop
+  write(fd, &c, 1);
+     bb0:	83 ec 04             	sub    $0x4,%esp
+     bb3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     bb6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     bb9:	6a 01                	push   $0x1
+     bbb:	e9 11 ff ff ff       	jmp    ad1 <printf+0xb1>
+     bc0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     bc5:	bb bf 10 00 00       	mov    $0x10bf,%ebx
+     bca:	e9 61 ff ff ff       	jmp    b30 <printf+0x110>
+     bcf:	90                   	nop
+
+00000bd0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+     bd0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     bd1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     bd4:	89 e5                	mov    %esp,%ebp
+     bd6:	57                   	push   %edi
+     bd7:	56                   	push   %esi
+     bd8:	53                   	push   %ebx
+     bd9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     bdb:	a1 a4 26 00 00       	mov    0x26a4,%eax
+     be0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     be2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     be4:	39 ca                	cmp    %ecx,%edx
+     be6:	73 30                	jae    c18 <ufree+0x48>
+     be8:	39 c1                	cmp    %eax,%ecx
+     bea:	72 04                	jb     bf0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     bec:	39 c2                	cmp    %eax,%edx
+     bee:	72 f0                	jb     be0 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     bf0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     bf3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     bf6:	39 f8                	cmp    %edi,%eax
+     bf8:	74 26                	je     c20 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     bfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     bfd:	8b 42 04             	mov    0x4(%edx),%eax
+     c00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     c03:	39 f1                	cmp    %esi,%ecx
+     c05:	74 30                	je     c37 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     c07:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     c09:	5b                   	pop    %ebx
+  freep = p;
+     c0a:	89 15 a4 26 00 00    	mov    %edx,0x26a4
+}
+     c10:	5e                   	pop    %esi
+     c11:	5f                   	pop    %edi
+     c12:	5d                   	pop    %ebp
+     c13:	c3                   	ret
+     c14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c18:	39 c1                	cmp    %eax,%ecx
+     c1a:	72 d0                	jb     bec <ufree+0x1c>
+     c1c:	eb c2                	jmp    be0 <ufree+0x10>
+     c1e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     c20:	03 70 04             	add    0x4(%eax),%esi
+     c23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     c26:	8b 02                	mov    (%edx),%eax
+     c28:	8b 00                	mov    (%eax),%eax
+     c2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     c2d:	8b 42 04             	mov    0x4(%edx),%eax
+     c30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     c33:	39 f1                	cmp    %esi,%ecx
+     c35:	75 d0                	jne    c07 <ufree+0x37>
+    p->s.size += bp->s.size;
+     c37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     c3a:	89 15 a4 26 00 00    	mov    %edx,0x26a4
+    p->s.size += bp->s.size;
+     c40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     c43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     c46:	89 0a                	mov    %ecx,(%edx)
+}
+     c48:	5b                   	pop    %ebx
+     c49:	5e                   	pop    %esi
+     c4a:	5f                   	pop    %edi
+     c4b:	5d                   	pop    %ebp
+     c4c:	c3                   	ret
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	53                   	push   %ebx
+     c54:	83 ec 10             	sub    $0x10,%esp
+     c57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+     c5a:	68 a0 26 00 00       	push   $0x26a0
+     c5f:	e8 ec 01 00 00       	call   e50 <lock_acquire>
+  ufree(ap);
+     c64:	89 d8                	mov    %ebx,%eax
+     c66:	e8 65 ff ff ff       	call   bd0 <ufree>
+  lock_release(&mlock);
+     c6b:	c7 45 08 a0 26 00 00 	movl   $0x26a0,0x8(%ebp)
+}
+     c72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+     c75:	83 c4 10             	add    $0x10,%esp
+}
+     c78:	c9                   	leave
+  lock_release(&mlock);
+     c79:	e9 f2 01 00 00       	jmp    e70 <lock_release>
+     c7e:	66 90                	xchg   %ax,%ax
+
+00000c80 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	53                   	push   %ebx
+     c86:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+     c8c:	68 a0 26 00 00       	push   $0x26a0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c91:	8d 48 07             	lea    0x7(%eax),%ecx
+     c94:	c1 e9 03             	shr    $0x3,%ecx
+     c97:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+     c9a:	e8 b1 01 00 00       	call   e50 <lock_acquire>
+  if((prevp = freep) == 0){
+     c9f:	8b 15 a4 26 00 00    	mov    0x26a4,%edx
+     ca5:	83 c4 10             	add    $0x10,%esp
+     ca8:	85 d2                	test   %edx,%edx
+     caa:	0f 84 b0 00 00 00    	je     d60 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     cb0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     cb2:	8b 47 04             	mov    0x4(%edi),%eax
+     cb5:	39 f0                	cmp    %esi,%eax
+     cb7:	73 6f                	jae    d28 <malloc+0xa8>
+  if(nu < 4096)
+     cb9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     cbe:	39 de                	cmp    %ebx,%esi
+     cc0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     cc3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     cca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ccd:	eb 0a                	jmp    cd9 <malloc+0x59>
+     ccf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     cd0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     cd2:	8b 47 04             	mov    0x4(%edi),%eax
+     cd5:	39 f0                	cmp    %esi,%eax
+     cd7:	73 4f                	jae    d28 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     cd9:	89 fa                	mov    %edi,%edx
+     cdb:	39 3d a4 26 00 00    	cmp    %edi,0x26a4
+     ce1:	75 ed                	jne    cd0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     ce3:	83 ec 0c             	sub    $0xc,%esp
+     ce6:	ff 75 e4             	push   -0x1c(%ebp)
+     ce9:	e8 ad fb ff ff       	call   89b <sbrk>
+  if(p == (char*)-1)
+     cee:	83 c4 10             	add    $0x10,%esp
+     cf1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cf4:	74 15                	je     d0b <malloc+0x8b>
+  hp->s.size = nu;
+     cf6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+     cf9:	83 c0 08             	add    $0x8,%eax
+     cfc:	e8 cf fe ff ff       	call   bd0 <ufree>
+  return freep;
+     d01:	8b 15 a4 26 00 00    	mov    0x26a4,%edx
+      if((p = morecore(nunits)) == 0){
+     d07:	85 d2                	test   %edx,%edx
+     d09:	75 c5                	jne    cd0 <malloc+0x50>
+        lock_release(&mlock);
+     d0b:	83 ec 0c             	sub    $0xc,%esp
+     d0e:	68 a0 26 00 00       	push   $0x26a0
+     d13:	e8 58 01 00 00       	call   e70 <lock_release>
+        return 0;
+     d18:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     d1e:	31 c0                	xor    %eax,%eax
+}
+     d20:	5b                   	pop    %ebx
+     d21:	5e                   	pop    %esi
+     d22:	5f                   	pop    %edi
+     d23:	5d                   	pop    %ebp
+     d24:	c3                   	ret
+     d25:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     d28:	39 c6                	cmp    %eax,%esi
+     d2a:	74 64                	je     d90 <malloc+0x110>
+        p->s.size -= nunits;
+     d2c:	29 f0                	sub    %esi,%eax
+     d2e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     d31:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     d34:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+     d37:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     d3a:	89 15 a4 26 00 00    	mov    %edx,0x26a4
+      lock_release(&mlock);
+     d40:	68 a0 26 00 00       	push   $0x26a0
+     d45:	e8 26 01 00 00       	call   e70 <lock_release>
+      return (void*)(p + 1);
+     d4a:	83 c4 10             	add    $0x10,%esp
+}
+     d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     d50:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     d53:	5b                   	pop    %ebx
+     d54:	5e                   	pop    %esi
+     d55:	5f                   	pop    %edi
+     d56:	5d                   	pop    %ebp
+     d57:	c3                   	ret
+     d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     d60:	c7 05 a4 26 00 00 a8 	movl   $0x26a8,0x26a4
+     d67:	26 00 00 
+    base.s.size = 0;
+     d6a:	bf a8 26 00 00       	mov    $0x26a8,%edi
+    base.s.ptr = freep = prevp = &base;
+     d6f:	c7 05 a8 26 00 00 a8 	movl   $0x26a8,0x26a8
+     d76:	26 00 00 
+    base.s.size = 0;
+     d79:	c7 05 ac 26 00 00 00 	movl   $0x0,0x26ac
+     d80:	00 00 00 
+    if(p->s.size >= nunits){
+     d83:	e9 31 ff ff ff       	jmp    cb9 <malloc+0x39>
+     d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     d90:	8b 07                	mov    (%edi),%eax
+     d92:	89 02                	mov    %eax,(%edx)
+     d94:	eb a1                	jmp    d37 <malloc+0xb7>
+     d96:	66 90                	xchg   %ax,%ax
+     d98:	66 90                	xchg   %ax,%ax
+     d9a:	66 90                	xchg   %ax,%ax
+     d9c:	66 90                	xchg   %ax,%ax
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+     da4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+     da7:	68 00 10 00 00       	push   $0x1000
+     dac:	e8 cf fe ff ff       	call   c80 <malloc>
+     db1:	83 c4 10             	add    $0x10,%esp
+     db4:	85 c0                	test   %eax,%eax
+     db6:	74 37                	je     def <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+     db8:	83 ec 04             	sub    $0x4,%esp
+     dbb:	89 c3                	mov    %eax,%ebx
+     dbd:	50                   	push   %eax
+     dbe:	ff 75 0c             	push   0xc(%ebp)
+     dc1:	ff 75 08             	push   0x8(%ebp)
+     dc4:	e8 0a fb ff ff       	call   8d3 <clone>
+     dc9:	83 c4 10             	add    $0x10,%esp
+     dcc:	85 c0                	test   %eax,%eax
+     dce:	78 08                	js     dd8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+     dd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dd3:	c9                   	leave
+     dd4:	c3                   	ret
+     dd5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dde:	53                   	push   %ebx
+     ddf:	e8 6c fe ff ff       	call   c50 <free>
+     de4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     de7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+     dea:	83 c4 10             	add    $0x10,%esp
+}
+     ded:	c9                   	leave
+     dee:	c3                   	ret
+    return -1;
+     def:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     df4:	eb da                	jmp    dd0 <thread_create+0x30>
+     df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e00 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+     e06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     e09:	50                   	push   %eax
+     e0a:	e8 cc fa ff ff       	call   8db <join>
+     e0f:	83 c4 10             	add    $0x10,%esp
+     e12:	85 c0                	test   %eax,%eax
+     e14:	79 0a                	jns    e20 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+     e16:	c9                   	leave
+     e17:	c3                   	ret
+     e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1f:	90                   	nop
+     e20:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+     e23:	83 ec 0c             	sub    $0xc,%esp
+     e26:	ff 75 f4             	push   -0xc(%ebp)
+     e29:	e8 22 fe ff ff       	call   c50 <free>
+     e2e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e31:	83 c4 10             	add    $0x10,%esp
+}
+     e34:	c9                   	leave
+     e35:	c3                   	ret
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+     e43:	8b 45 08             	mov    0x8(%ebp),%eax
+     e46:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     e4c:	5d                   	pop    %ebp
+     e4d:	c3                   	ret
+     e4e:	66 90                	xchg   %ax,%ax
+
+00000e50 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+     e50:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     e51:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e56:	89 e5                	mov    %esp,%ebp
+     e58:	8b 55 08             	mov    0x8(%ebp),%edx
+     e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+     e60:	89 c8                	mov    %ecx,%eax
+     e62:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+     e65:	85 c0                	test   %eax,%eax
+     e67:	75 f7                	jne    e60 <lock_acquire+0x10>
+    ;
+}
+     e69:	5d                   	pop    %ebp
+     e6a:	c3                   	ret
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+     e70:	55                   	push   %ebp
+     e71:	31 c0                	xor    %eax,%eax
+     e73:	89 e5                	mov    %esp,%ebp
+     e75:	8b 55 08             	mov    0x8(%ebp),%edx
+     e78:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+     e7b:	5d                   	pop    %ebp
+     e7c:	c3                   	ret
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e80 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+     e83:	8b 45 08             	mov    0x8(%ebp),%eax
+     e86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     e8c:	5d                   	pop    %ebp
+     e8d:	c3                   	ret
+     e8e:	66 90                	xchg   %ax,%ax
+
+00000e90 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     e90:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     e91:	31 c0                	xor    %eax,%eax
+     e93:	ba 01 00 00 00       	mov    $0x1,%edx
+     e98:	89 e5                	mov    %esp,%ebp
+     e9a:	56                   	push   %esi
+     e9b:	53                   	push   %ebx
+     e9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e9f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+     ea3:	85 c0                	test   %eax,%eax
+     ea5:	74 30                	je     ed7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+     ea7:	83 f8 02             	cmp    $0x2,%eax
+     eaa:	74 0c                	je     eb8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     eac:	b8 02 00 00 00       	mov    $0x2,%eax
+     eb1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+     eb4:	85 c0                	test   %eax,%eax
+     eb6:	74 1f                	je     ed7 <mutex_lock+0x47>
+     eb8:	be 02 00 00 00       	mov    $0x2,%esi
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+     ec0:	83 ec 08             	sub    $0x8,%esp
+     ec3:	6a 02                	push   $0x2
+     ec5:	53                   	push   %ebx
+     ec6:	e8 18 fa ff ff       	call   8e3 <futex_wait>
+     ecb:	89 f0                	mov    %esi,%eax
+     ecd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     ed0:	83 c4 10             	add    $0x10,%esp
+     ed3:	85 c0                	test   %eax,%eax
+     ed5:	75 e9                	jne    ec0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+     ed7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eda:	5b                   	pop    %ebx
+     edb:	5e                   	pop    %esi
+     edc:	5d                   	pop    %ebp
+     edd:	c3                   	ret
+     ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	31 c0                	xor    %eax,%eax
+     ee3:	89 e5                	mov    %esp,%ebp
+     ee5:	83 ec 08             	sub    $0x8,%esp
+     ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+     eeb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+     eee:	83 f8 02             	cmp    $0x2,%eax
+     ef1:	74 05                	je     ef8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+     ef3:	c9                   	leave
+     ef4:	c3                   	ret
+     ef5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+     ef8:	83 ec 08             	sub    $0x8,%esp
+     efb:	6a 01                	push   $0x1
+     efd:	52                   	push   %edx
+     efe:	e8 e8 f9 ff ff       	call   8eb <futex_wake>
+     f03:	83 c4 10             	add    $0x10,%esp
+}
+     f06:	c9                   	leave
+     f07:	c3                   	ret
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+
+00000f10 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+     f16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+     f1c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+     f23:	5d                   	pop    %ebp
+     f24:	c3                   	ret
+     f25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f30 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 0c             	sub    $0xc,%esp
+     f39:	8b 75 08             	mov    0x8(%ebp),%esi
+     f3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+     f3f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+     f44:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+     f46:	8b 3e                	mov    (%esi),%edi
+     f48:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+     f4b:	83 f8 02             	cmp    $0x2,%eax
+     f4e:	74 60                	je     fb0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+     f50:	83 ec 08             	sub    $0x8,%esp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	e8 89 f9 ff ff       	call   8e3 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+     f5a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+     f5f:	31 c0                	xor    %eax,%eax
+     f61:	ba 01 00 00 00       	mov    $0x1,%edx
+     f66:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+     f6a:	83 c4 10             	add    $0x10,%esp
+     f6d:	85 c0                	test   %eax,%eax
+     f6f:	74 36                	je     fa7 <cond_wait+0x77>
+  if(c != 2)
+     f71:	83 f8 02             	cmp    $0x2,%eax
+     f74:	74 0c                	je     f82 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+     f76:	b8 02 00 00 00       	mov    $0x2,%eax
+     f7b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     f7e:	85 c0                	test   %eax,%eax
+     f80:	74 25                	je     fa7 <cond_wait+0x77>
+     f82:	be 02 00 00 00       	mov    $0x2,%esi
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+     f90:	83 ec 08             	sub    $0x8,%esp
+     f93:	6a 02                	push   $0x2
+     f95:	53                   	push   %ebx
+     f96:	e8 48 f9 ff ff       	call   8e3 <futex_wait>
+     f9b:	89 f0                	mov    %esi,%eax
+     f9d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     fa0:	83 c4 10             	add    $0x10,%esp
+     fa3:	85 c0                	test   %eax,%eax
+     fa5:	75 e9                	jne    f90 <cond_wait+0x60>
+  mutex_lock(m);
+}
+     fa7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     faa:	5b                   	pop    %ebx
+     fab:	5e                   	pop    %esi
+     fac:	5f                   	pop    %edi
+     fad:	5d                   	pop    %ebp
+     fae:	c3                   	ret
+     faf:	90                   	nop
+    futex_wake(&m->val, 1);
+     fb0:	83 ec 08             	sub    $0x8,%esp
+     fb3:	6a 01                	push   $0x1
+     fb5:	53                   	push   %ebx
+     fb6:	e8 30 f9 ff ff       	call   8eb <futex_wake>
+     fbb:	83 c4 10             	add    $0x10,%esp
+     fbe:	eb 90                	jmp    f50 <cond_wait+0x20>
+
+00000fc0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	83 ec 08             	sub    $0x8,%esp
+     fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     fc9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+     fcd:	8b 50 04             	mov    0x4(%eax),%edx
+     fd0:	85 d2                	test   %edx,%edx
+     fd2:	75 0c                	jne    fe0 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+     fd4:	c9                   	leave
+     fd5:	c3                   	ret
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+     fe0:	83 ec 08             	sub    $0x8,%esp
+     fe3:	6a 01                	push   $0x1
+     fe5:	50                   	push   %eax
+     fe6:	e8 00 f9 ff ff       	call   8eb <futex_wake>
+     feb:	83 c4 10             	add    $0x10,%esp
+}
+     fee:	c9                   	leave
+     fef:	c3                   	ret
+
+00000ff0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	83 ec 08             	sub    $0x8,%esp
+     ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     ff9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+     ffd:	8b 50 04             	mov    0x4(%eax),%edx
+    1000:	85 d2                	test   %edx,%edx
+    1002:	75 0c                	jne    1010 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+    1004:	c9                   	leave
+    1005:	c3                   	ret
+    1006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+    1010:	83 ec 08             	sub    $0x8,%esp
+    1013:	68 ff ff ff 7f       	push   $0x7fffffff
+    1018:	50                   	push   %eax
+    1019:	e8 cd f8 ff ff       	call   8eb <futex_wake>
+    101e:	83 c4 10             	add    $0x10,%esp
+}
+    1021:	c9                   	leave
+    1022:	c3                   	ret
@@ -0,0 +1,115 @@
+// Show lock contention: for each lock name, how often its
+// locks were taken, how often the taker had to wait, for how
+// long in all, and the longest any was held.  Busiest first.
+// For sleep locks, also how often the taker spun waiting for
+// a running holder, and how often that spared it a sleep.
+// usage: lockstat              counts since boot
+//        lockstat prog [arg...] counts while prog runs
+// The longest hold is always since boot.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "lockstat.h"
+
+struct lockstat before[NLOCKCLASS], after[NLOCKCLASS];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, nb, pid;
+  struct lockstat t;
+
+  nb = 0;
+  if(argc > 1){
+    nb = lockstat(before, NLOCKCLASS);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  n = lockstat(after, NLOCKCLASS);
+  if(n < 0){
+    printf(2, "lockstat: lockstat failed\n");
+    exit();
+  }
+  // Names keep their slots, so before[i] and after[i] match.
+  for(i = 0; i < nb; i++){
+    after[i].nacquire -= before[i].nacquire;
+    after[i].ncontend -= before[i].ncontend;
+    after[i].waitus -= before[i].waitus;
+    after[i].nspin -= before[i].nspin;
+    after[i].nspinwon -= before[i].nspinwon;
+  }
+  for(i = 0; i < n; i++)
+    for(j = i+1; j < n; j++)
+      if(after[j].waitus > after[i].waitus ||
+         (after[j].waitus == after[i].waitus &&
+          after[j].ncontend > after[i].ncontend)){
+        t = after[i];
+        after[i] = after[j];
+        after[j] = t;
+      }
+
+  col("NAME", 14);
+  col("KIND", 7);
+  col("ACQUIRED", 11);
+  col("CONTENDED", 11);
+  col("WAIT-US", 11);
+  col("MAXHOLD-NS", 12);
+  col("SPUN", 9);
+  printf(1, "SPIN-WON\n");
+  for(i = 0; i < n; i++){
+    if(after[i].nacquire == 0)
+      continue;
+    col(after[i].name, 14);
+    col(after[i].sleep ? "sleep" : "spin", 7);
+    coln(after[i].nacquire, 11);
+    coln(after[i].ncontend, 11);
+    coln(after[i].waitus, 11);
+    if(!after[i].sleep){
+      coln(after[i].maxholdns, 0);
+      printf(1, "\n");
+      continue;
+    }
+    coln(after[i].maxholdns, 12);
+    coln(after[i].nspin, 9);
+    coln(after[i].nspinwon, 0);
+    printf(1, "\n");
+  }
+  exit();
+}
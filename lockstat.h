@@ -0,0 +1,14 @@
+// Lock contention statistics returned by lockstat(), one
+// per lock name: all the locks initialized with the same
+// name, such as every "proc" lock, count together.
+
+struct lockstat {
+  char name[16];
+  int sleep;          // Sleep lock, rather than spin lock?
+  uint nacquire;      // Times acquired
+  uint ncontend;      // Times the acquirer had to wait
+  uint waitus;        // Total time spent waiting (spinning or asleep), us
+  uint maxholdns;     // Longest time held, ns
+  uint nspin;         // Sleep lock: times the acquirer spun first
+  uint nspinwon;      // Sleep lock: times it then didn't have to sleep
+};
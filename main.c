@@ -3,10 +3,13 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
+#include "time.h"
 
 static void startothers(void);
+static void bootprint(void);
 static void mpmain(void)  __attribute__((noreturn));
 extern pde_t *kpgdir;
 extern char end[]; // first address after kernel loaded from ELF file
@@ -17,36 +20,101 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  bootphase("entry");
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  bootphase("kinit1");
   kvmalloc();      // kernel page table
+  bootphase("kvmalloc");
   mpinit();        // detect other processors
+  bootphase("mpinit");
+  tscinit();       // calibrate cycle counter
+  bootphase("tscinit");
   lapicinit();     // interrupt controller
+  bootphase("lapicinit");
   seginit();       // segment descriptors
   cprintf("\ncpu%d: starting xv6\n\n", cpunum());
   picinit();       // another interrupt controller
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  bootphase("console");
   pinit();         // process table
+  traceinit();     // scheduler event tracing
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
+  pathinit();      // exec search path
+  bootphase("tables");
   ideinit();       // disk
+  bootphase("ideinit");
   if(!ismp)
     timerinit();   // uniprocessor timer
   startothers();   // start other processors
+  bootphase("startothers");
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  bootphase("kinit2");
+  binit();         // buffer cache, sized from free memory
+  bootphase("binit");
   userinit();      // first user process
+  workinit();      // per-CPU kernel worker threads
+  bootphase("userinit");
+  bootprint();
   mpmain();        // finish this processor's setup
 }
 
+// Boot timeline: the TSC at the end of each phase of
+// booting, counted from reset.
+static struct {
+  char *name;
+  uint64 tsc;
+} bootphases[NBOOTPHASE];
+static int nbootphase;
+
+// Record that the boot phase name has just ended.
+// Only one CPU at a time boots.
+void
+bootphase(char *name)
+{
+  if(nbootphase < NBOOTPHASE){
+    bootphases[nbootphase].name = name;
+    bootphases[nbootphase].tsc = rdtsc();
+    nbootphase++;
+  }
+}
+
+// Copy up to n boot phases, with their times in
+// microseconds since reset, to bp.  Return the number copied.
+int
+boottimes(struct bootphase *bp, int n)
+{
+  int i;
+
+  for(i = 0; i < n && i < nbootphase; i++){
+    safestrcpy(bp[i].name, bootphases[i].name, sizeof(bp[i].name));
+    bp[i].usec = divu64(bootphases[i].tsc * 1000, tsckhz);
+  }
+  return i;
+}
+
+static void
+bootprint(void)
+{
+  struct bootphase bp[NBOOTPHASE];
+  int i, n;
+
+  n = boottimes(bp, NBOOTPHASE);
+  cprintf("boot timeline, us since reset:");
+  for(i = 0; i < n; i++)
+    cprintf("%s %s %d", i % 4 ? "," : "\n ", bp[i].name, bp[i].usec);
+  cprintf("\n");
+}
+
 // Other CPUs jump here from entryother.S.
 static void
 mpenter(void)
 {
   switchkvm();
+  lapicinit();     // first, for seginit's cpunum() in x2APIC mode
   seginit();
-  lapicinit();
   mpmain();
 }
 
@@ -67,9 +135,13 @@ static void
 startothers(void)
 {
   extern uchar _binary_entryother_start[], _binary_entryother_size[];
+  static char *stacks[NCPU];
   uchar *code;
   struct cpu *c;
-  char *stack;
+  int n;
+
+  if(ncpu == 1)
+    return;
 
   // Write entry code to unused memory at 0x7000.
   // The linker has placed the image of entryother.S in
@@ -77,24 +149,23 @@ startothers(void)
   code = P2V(0x7000);
   memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
 
-  for(c = cpus; c < cpus+ncpu; c++){
-    if(c == cpus+cpunum())  // We've started already.
-      continue;
+  // Tell entryother.S what stacks to use, where to enter, and what
+  // pgdir to use. We cannot use kpgdir yet, because the AP processors
+  // are running in low  memory, so we use entrypgdir for the APs too.
+  // The APs start together, each taking the next stack.
+  for(n = 0; n < ncpu-1; n++)
+    stacks[n] = kalloc() + KSTACKSIZE;
+  *(void**)(code-4) = stacks;
+  *(void**)(code-8) = mpenter;
+  *(int**)(code-12) = (void *) V2P(entrypgdir);
+  *(int*)(code-16) = 0;
 
-    // Tell entryother.S what stack to use, where to enter, and what
-    // pgdir to use. We cannot use kpgdir yet, because the AP processor
-    // is running in low  memory, so we use entrypgdir for the APs too.
-    stack = kalloc();
-    *(void**)(code-4) = stack + KSTACKSIZE;
-    *(void**)(code-8) = mpenter;
-    *(int**)(code-12) = (void *) V2P(entrypgdir);
+  lapicstartaps(V2P(code));
 
-    lapicstartap(c->apicid, V2P(code));
-
-    // wait for cpu to finish mpmain()
-    while(c->started == 0)
+  // Wait for every cpu to finish mpmain().
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c != cpus+cpunum() && c->started == 0)
       ;
-  }
 }
 
 // The boot page table used in entry.S and entryother.S.
@@ -1,5 +1,6 @@
 // Multiprocessor support
-// Search memory for MP description structures.
+// Search memory for MP description structures, unless
+// ACPI (see acpi.c) has already described the machine.
 // http://developer.intel.com/design/pentium/datashts/24201606.pdf
 
 #include "types.h"
@@ -9,6 +10,7 @@
 #include "mp.h"
 #include "x86.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 
 struct cpu cpus[NCPU];
@@ -98,8 +100,12 @@ mpinit(void)
   struct mpproc *proc;
   struct mpioapic *ioapic;
 
-  if((conf = mpconfig(&mp)) == 0)
+  if(acpiinit() == 0)
     return;
+  if((conf = mpconfig(&mp)) == 0){
+    ncpu = 1;
+    return;
+  }
   ismp = 1;
   lapic = (uint*)conf->lapicaddr;
   for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
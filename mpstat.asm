@@ -0,0 +1,1999 @@
+
+_mpstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  int c, n, secs;
+
+  secs = argc > 1 ? atoi(argv[1]) : 1;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  secs = argc > 1 ? atoi(argv[1]) : 1;
+  1a:	7e 60                	jle    7c <main+0x7c>
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	ff 70 04             	push   0x4(%eax)
+  22:	e8 39 04 00 00       	call   460 <atoi>
+  if(secs < 1){
+  27:	83 c4 10             	add    $0x10,%esp
+  secs = argc > 1 ? atoi(argv[1]) : 1;
+  2a:	89 c3                	mov    %eax,%ebx
+  if(secs < 1){
+  2c:	85 c0                	test   %eax,%eax
+  2e:	7e 53                	jle    83 <main+0x83>
+    printf(2, "usage: mpstat [seconds]\n");
+    exit();
+  }
+  n = cpustat(before, NCPU);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	6a 20                	push   $0x20
+  35:	68 a0 16 00 00       	push   $0x16a0
+  3a:	e8 ec 05 00 00       	call   62b <cpustat>
+  3f:	89 c7                	mov    %eax,%edi
+  sleep(secs*100);
+  41:	6b c3 64             	imul   $0x64,%ebx,%eax
+  44:	89 04 24             	mov    %eax,(%esp)
+  47:	e8 17 05 00 00       	call   563 <sleep>
+  if(n < 0 || cpustat(after, NCPU) != n){
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	85 ff                	test   %edi,%edi
+  51:	78 15                	js     68 <main+0x68>
+  53:	52                   	push   %edx
+  54:	52                   	push   %edx
+  55:	6a 20                	push   $0x20
+  57:	68 a0 12 00 00       	push   $0x12a0
+  5c:	e8 ca 05 00 00       	call   62b <cpustat>
+  61:	83 c4 10             	add    $0x10,%esp
+  64:	39 f8                	cmp    %edi,%eax
+  66:	74 2e                	je     96 <main+0x96>
+    printf(2, "mpstat: cpustat failed\n");
+  68:	83 ec 08             	sub    $0x8,%esp
+  6b:	68 02 0d 00 00       	push   $0xd02
+  70:	6a 02                	push   $0x2
+  72:	e8 69 06 00 00       	call   6e0 <printf>
+    exit();
+  77:	e8 57 04 00 00       	call   4d3 <exit>
+  secs = argc > 1 ? atoi(argv[1]) : 1;
+  7c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  81:	eb ad                	jmp    30 <main+0x30>
+    printf(2, "usage: mpstat [seconds]\n");
+  83:	51                   	push   %ecx
+  84:	51                   	push   %ecx
+  85:	68 e9 0c 00 00       	push   $0xce9
+  8a:	6a 02                	push   $0x2
+  8c:	e8 4f 06 00 00       	call   6e0 <printf>
+    exit();
+  91:	e8 3d 04 00 00       	call   4d3 <exit>
+  }
+
+  col("CPU", 5);
+  96:	ba 05 00 00 00       	mov    $0x5,%edx
+  9b:	b8 1a 0d 00 00       	mov    $0xd1a,%eax
+  col("INTR/S", 9);
+  col("CSW/S", 9);
+  printf(1, "TLBFLUSH/S\n");
+  for(c = 0; c < n; c++){
+    coln(c, 5);
+    coln((after[c].stat[CS_SYSCALL] - before[c].stat[CS_SYSCALL]) / secs, 11);
+  a0:	31 f6                	xor    %esi,%esi
+  col("CPU", 5);
+  a2:	e8 e9 00 00 00       	call   190 <col>
+  col("SYSCALL/S", 11);
+  a7:	ba 0b 00 00 00       	mov    $0xb,%edx
+  ac:	b8 1e 0d 00 00       	mov    $0xd1e,%eax
+  b1:	e8 da 00 00 00       	call   190 <col>
+  col("INTR/S", 9);
+  b6:	ba 09 00 00 00       	mov    $0x9,%edx
+  bb:	b8 28 0d 00 00       	mov    $0xd28,%eax
+  c0:	e8 cb 00 00 00       	call   190 <col>
+  col("CSW/S", 9);
+  c5:	b8 2f 0d 00 00       	mov    $0xd2f,%eax
+  ca:	ba 09 00 00 00       	mov    $0x9,%edx
+  cf:	e8 bc 00 00 00       	call   190 <col>
+  printf(1, "TLBFLUSH/S\n");
+  d4:	50                   	push   %eax
+  d5:	50                   	push   %eax
+  d6:	68 35 0d 00 00       	push   $0xd35
+  db:	6a 01                	push   $0x1
+  dd:	e8 fe 05 00 00       	call   6e0 <printf>
+  for(c = 0; c < n; c++){
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	31 c9                	xor    %ecx,%ecx
+  e7:	85 ff                	test   %edi,%edi
+  e9:	0f 84 98 00 00 00    	je     187 <main+0x187>
+  ef:	90                   	nop
+    coln(c, 5);
+  f0:	89 c8                	mov    %ecx,%eax
+  f2:	ba 05 00 00 00       	mov    $0x5,%edx
+  f7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(c = 0; c < n; c++){
+  fa:	83 c6 20             	add    $0x20,%esi
+    coln(c, 5);
+  fd:	e8 ee 00 00 00       	call   1f0 <coln>
+    coln((after[c].stat[CS_SYSCALL] - before[c].stat[CS_SYSCALL]) / secs, 11);
+ 102:	8b 86 80 12 00 00    	mov    0x1280(%esi),%eax
+ 108:	31 d2                	xor    %edx,%edx
+ 10a:	2b 86 80 16 00 00    	sub    0x1680(%esi),%eax
+ 110:	f7 f3                	div    %ebx
+ 112:	ba 0b 00 00 00       	mov    $0xb,%edx
+ 117:	e8 d4 00 00 00       	call   1f0 <coln>
+    coln((after[c].stat[CS_INTR] - before[c].stat[CS_INTR]) / secs, 9);
+ 11c:	8b 86 84 12 00 00    	mov    0x1284(%esi),%eax
+ 122:	31 d2                	xor    %edx,%edx
+ 124:	2b 86 84 16 00 00    	sub    0x1684(%esi),%eax
+ 12a:	f7 f3                	div    %ebx
+ 12c:	ba 09 00 00 00       	mov    $0x9,%edx
+ 131:	e8 ba 00 00 00       	call   1f0 <coln>
+    coln((after[c].stat[CS_CSW] - before[c].stat[CS_CSW]) / secs, 9);
+ 136:	8b 86 88 12 00 00    	mov    0x1288(%esi),%eax
+ 13c:	31 d2                	xor    %edx,%edx
+ 13e:	2b 86 88 16 00 00    	sub    0x1688(%esi),%eax
+ 144:	f7 f3                	div    %ebx
+ 146:	ba 09 00 00 00       	mov    $0x9,%edx
+ 14b:	e8 a0 00 00 00       	call   1f0 <coln>
+    coln((after[c].stat[CS_TLBFLUSH] - before[c].stat[CS_TLBFLUSH]) / secs, 0);
+ 150:	8b 86 8c 12 00 00    	mov    0x128c(%esi),%eax
+ 156:	31 d2                	xor    %edx,%edx
+ 158:	2b 86 8c 16 00 00    	sub    0x168c(%esi),%eax
+ 15e:	f7 f3                	div    %ebx
+ 160:	31 d2                	xor    %edx,%edx
+ 162:	e8 89 00 00 00       	call   1f0 <coln>
+    printf(1, "\n");
+ 167:	83 ec 08             	sub    $0x8,%esp
+ 16a:	68 3f 0d 00 00       	push   $0xd3f
+ 16f:	6a 01                	push   $0x1
+ 171:	e8 6a 05 00 00       	call   6e0 <printf>
+  for(c = 0; c < n; c++){
+ 176:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	83 c1 01             	add    $0x1,%ecx
+ 17f:	39 cf                	cmp    %ecx,%edi
+ 181:	0f 85 69 ff ff ff    	jne    f0 <main+0xf0>
+  }
+  exit();
+ 187:	e8 47 03 00 00       	call   4d3 <exit>
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <col>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	89 c7                	mov    %eax,%edi
+ 196:	56                   	push   %esi
+ 197:	89 d6                	mov    %edx,%esi
+ 199:	53                   	push   %ebx
+ 19a:	83 ec 18             	sub    $0x18,%esp
+  n = strlen(s);
+ 19d:	50                   	push   %eax
+ 19e:	e8 7d 01 00 00       	call   320 <strlen>
+  printf(1, "%s", s);
+ 1a3:	83 c4 0c             	add    $0xc,%esp
+ 1a6:	57                   	push   %edi
+  n = strlen(s);
+ 1a7:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 1a9:	68 e4 0c 00 00       	push   $0xce4
+ 1ae:	6a 01                	push   $0x1
+ 1b0:	e8 2b 05 00 00       	call   6e0 <printf>
+  for(; n < w; n++)
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	39 f3                	cmp    %esi,%ebx
+ 1ba:	7d 1d                	jge    1d9 <col+0x49>
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+ 1c0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 1c3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 1c6:	68 e7 0c 00 00       	push   $0xce7
+ 1cb:	6a 01                	push   $0x1
+ 1cd:	e8 0e 05 00 00       	call   6e0 <printf>
+  for(; n < w; n++)
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	39 de                	cmp    %ebx,%esi
+ 1d7:	75 e7                	jne    1c0 <col+0x30>
+}
+ 1d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dc:	5b                   	pop    %ebx
+ 1dd:	5e                   	pop    %esi
+ 1de:	5f                   	pop    %edi
+ 1df:	5d                   	pop    %ebp
+ 1e0:	c3                   	ret
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <coln>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 c1                	mov    %eax,%ecx
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	57                   	push   %edi
+ 1f6:	56                   	push   %esi
+    buf[--i] = '0' + x % 10;
+ 1f7:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 1fc:	53                   	push   %ebx
+  i = sizeof(buf) - 1;
+ 1fd:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+ 202:	83 ec 2c             	sub    $0x2c,%esp
+  buf[i] = 0;
+ 205:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+ 209:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 210:	89 c8                	mov    %ecx,%eax
+ 212:	83 eb 01             	sub    $0x1,%ebx
+ 215:	f7 e6                	mul    %esi
+ 217:	89 c8                	mov    %ecx,%eax
+ 219:	c1 ea 03             	shr    $0x3,%edx
+ 21c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 21f:	01 ff                	add    %edi,%edi
+ 221:	29 f8                	sub    %edi,%eax
+ 223:	83 c0 30             	add    $0x30,%eax
+ 226:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+ 22a:	89 c8                	mov    %ecx,%eax
+ 22c:	89 d1                	mov    %edx,%ecx
+ 22e:	83 f8 09             	cmp    $0x9,%eax
+ 231:	77 dd                	ja     210 <coln+0x20>
+  col(buf+i, w);
+ 233:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 236:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 239:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 23c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+ 23f:	56                   	push   %esi
+ 240:	e8 db 00 00 00       	call   320 <strlen>
+  printf(1, "%s", s);
+ 245:	83 c4 0c             	add    $0xc,%esp
+ 248:	56                   	push   %esi
+  n = strlen(s);
+ 249:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 24b:	68 e4 0c 00 00       	push   $0xce4
+ 250:	6a 01                	push   $0x1
+ 252:	e8 89 04 00 00       	call   6e0 <printf>
+  for(; n < w; n++)
+ 257:	83 c4 10             	add    $0x10,%esp
+ 25a:	39 df                	cmp    %ebx,%edi
+ 25c:	7e 1b                	jle    279 <coln+0x89>
+ 25e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+ 260:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 263:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 266:	68 e7 0c 00 00       	push   $0xce7
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 6e 04 00 00       	call   6e0 <printf>
+  for(; n < w; n++)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	39 df                	cmp    %ebx,%edi
+ 277:	75 e7                	jne    260 <coln+0x70>
+}
+ 279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27c:	5b                   	pop    %ebx
+ 27d:	5e                   	pop    %esi
+ 27e:	5f                   	pop    %edi
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+ 281:	66 90                	xchg   %ax,%ax
+ 283:	66 90                	xchg   %ax,%ax
+ 285:	66 90                	xchg   %ax,%ax
+ 287:	66 90                	xchg   %ax,%ax
+ 289:	66 90                	xchg   %ax,%ax
+ 28b:	66 90                	xchg   %ax,%ax
+ 28d:	66 90                	xchg   %ax,%ax
+ 28f:	90                   	nop
+
+00000290 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 290:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 291:	31 c0                	xor    %eax,%eax
+{
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	53                   	push   %ebx
+ 296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2a7:	83 c0 01             	add    $0x1,%eax
+ 2aa:	84 d2                	test   %dl,%dl
+ 2ac:	75 f2                	jne    2a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b1:	89 c8                	mov    %ecx,%eax
+ 2b3:	c9                   	leave
+ 2b4:	c3                   	ret
+ 2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ca:	0f b6 02             	movzbl (%edx),%eax
+ 2cd:	84 c0                	test   %al,%al
+ 2cf:	75 17                	jne    2e8 <strcmp+0x28>
+ 2d1:	eb 3a                	jmp    30d <strcmp+0x4d>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2dc:	83 c2 01             	add    $0x1,%edx
+ 2df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2e2:	84 c0                	test   %al,%al
+ 2e4:	74 1a                	je     300 <strcmp+0x40>
+    p++, q++;
+ 2e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2eb:	38 c3                	cmp    %al,%bl
+ 2ed:	74 e9                	je     2d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ef:	29 d8                	sub    %ebx,%eax
+}
+ 2f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f4:	c9                   	leave
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 300:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 304:	31 c0                	xor    %eax,%eax
+ 306:	29 d8                	sub    %ebx,%eax
+}
+ 308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 30d:	0f b6 19             	movzbl (%ecx),%ebx
+ 310:	31 c0                	xor    %eax,%eax
+ 312:	eb db                	jmp    2ef <strcmp+0x2f>
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 326:	80 3a 00             	cmpb   $0x0,(%edx)
+ 329:	74 15                	je     340 <strlen+0x20>
+ 32b:	31 c0                	xor    %eax,%eax
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+ 330:	83 c0 01             	add    $0x1,%eax
+ 333:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 337:	89 c1                	mov    %eax,%ecx
+ 339:	75 f5                	jne    330 <strlen+0x10>
+    ;
+  return n;
+}
+ 33b:	89 c8                	mov    %ecx,%eax
+ 33d:	5d                   	pop    %ebp
+ 33e:	c3                   	ret
+ 33f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 340:	31 c9                	xor    %ecx,%ecx
+}
+ 342:	5d                   	pop    %ebp
+ 343:	89 c8                	mov    %ecx,%eax
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 357:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35d:	89 d7                	mov    %edx,%edi
+ 35f:	fc                   	cld
+ 360:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 362:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 365:	89 d0                	mov    %edx,%eax
+ 367:	c9                   	leave
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 37a:	0f b6 10             	movzbl (%eax),%edx
+ 37d:	84 d2                	test   %dl,%dl
+ 37f:	75 12                	jne    393 <strchr+0x23>
+ 381:	eb 1d                	jmp    3a0 <strchr+0x30>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 38c:	83 c0 01             	add    $0x1,%eax
+ 38f:	84 d2                	test   %dl,%dl
+ 391:	74 0d                	je     3a0 <strchr+0x30>
+    if(*s == c)
+ 393:	38 d1                	cmp    %dl,%cl
+ 395:	75 f1                	jne    388 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 397:	5d                   	pop    %ebp
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3a0:	31 c0                	xor    %eax,%eax
+}
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	c3                   	ret
+ 3a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3b9:	31 db                	xor    %ebx,%ebx
+{
+ 3bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3be:	eb 27                	jmp    3e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3c0:	83 ec 04             	sub    $0x4,%esp
+ 3c3:	6a 01                	push   $0x1
+ 3c5:	56                   	push   %esi
+ 3c6:	6a 00                	push   $0x0
+ 3c8:	e8 1e 01 00 00       	call   4eb <read>
+    if(cc < 1)
+ 3cd:	83 c4 10             	add    $0x10,%esp
+ 3d0:	85 c0                	test   %eax,%eax
+ 3d2:	7e 1d                	jle    3f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3df:	3c 0a                	cmp    $0xa,%al
+ 3e1:	74 10                	je     3f3 <gets+0x43>
+ 3e3:	3c 0d                	cmp    $0xd,%al
+ 3e5:	74 0c                	je     3f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3e7:	89 df                	mov    %ebx,%edi
+ 3e9:	83 c3 01             	add    $0x1,%ebx
+ 3ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3ef:	7c cf                	jl     3c0 <gets+0x10>
+ 3f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fd:	5b                   	pop    %ebx
+ 3fe:	5e                   	pop    %esi
+ 3ff:	5f                   	pop    %edi
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+ 402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	56                   	push   %esi
+ 414:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 415:	83 ec 08             	sub    $0x8,%esp
+ 418:	6a 00                	push   $0x0
+ 41a:	ff 75 08             	push   0x8(%ebp)
+ 41d:	e8 f1 00 00 00       	call   513 <open>
+  if(fd < 0)
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	85 c0                	test   %eax,%eax
+ 427:	78 27                	js     450 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 429:	83 ec 08             	sub    $0x8,%esp
+ 42c:	ff 75 0c             	push   0xc(%ebp)
+ 42f:	89 c3                	mov    %eax,%ebx
+ 431:	50                   	push   %eax
+ 432:	e8 f4 00 00 00       	call   52b <fstat>
+  close(fd);
+ 437:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 43a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 43c:	e8 ba 00 00 00       	call   4fb <close>
+  return r;
+ 441:	83 c4 10             	add    $0x10,%esp
+}
+ 444:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 447:	89 f0                	mov    %esi,%eax
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5d                   	pop    %ebp
+ 44c:	c3                   	ret
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 450:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 455:	eb ed                	jmp    444 <stat+0x34>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	53                   	push   %ebx
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 467:	0f be 02             	movsbl (%edx),%eax
+ 46a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 46d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 475:	77 1e                	ja     495 <atoi+0x35>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 480:	83 c2 01             	add    $0x1,%edx
+ 483:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 486:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 48a:	0f be 02             	movsbl (%edx),%eax
+ 48d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 490:	80 fb 09             	cmp    $0x9,%bl
+ 493:	76 eb                	jbe    480 <atoi+0x20>
+  return n;
+}
+ 495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 498:	89 c8                	mov    %ecx,%eax
+ 49a:	c9                   	leave
+ 49b:	c3                   	ret
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ae:	85 c0                	test   %eax,%eax
+ 4b0:	7e 13                	jle    4c5 <memmove+0x25>
+ 4b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4b4:	89 d7                	mov    %edx,%edi
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4c1:	39 f8                	cmp    %edi,%eax
+ 4c3:	75 fb                	jne    4c0 <memmove+0x20>
+  return vdst;
+}
+ 4c5:	5e                   	pop    %esi
+ 4c6:	89 d0                	mov    %edx,%eax
+ 4c8:	5f                   	pop    %edi
+ 4c9:	5d                   	pop    %ebp
+ 4ca:	c3                   	ret
+
+000004cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <exit>:
+SYSCALL(exit)
+ 4d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <wait>:
+SYSCALL(wait)
+ 4db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <pipe>:
+SYSCALL(pipe)
+ 4e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <read>:
+SYSCALL(read)
+ 4eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <write>:
+SYSCALL(write)
+ 4f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <close>:
+SYSCALL(close)
+ 4fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <kill>:
+SYSCALL(kill)
+ 503:	b8 06 00 00 00       	mov    $0x6,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <exec>:
+SYSCALL(exec)
+ 50b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <open>:
+SYSCALL(open)
+ 513:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mknod>:
+SYSCALL(mknod)
+ 51b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <unlink>:
+SYSCALL(unlink)
+ 523:	b8 12 00 00 00       	mov    $0x12,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <fstat>:
+SYSCALL(fstat)
+ 52b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <link>:
+SYSCALL(link)
+ 533:	b8 13 00 00 00       	mov    $0x13,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <mkdir>:
+SYSCALL(mkdir)
+ 53b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <chdir>:
+SYSCALL(chdir)
+ 543:	b8 09 00 00 00       	mov    $0x9,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <dup>:
+SYSCALL(dup)
+ 54b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getpid>:
+SYSCALL(getpid)
+ 553:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <sbrk>:
+SYSCALL(sbrk)
+ 55b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <sleep>:
+SYSCALL(sleep)
+ 563:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <uptime>:
+SYSCALL(uptime)
+ 56b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <add_dir>:
+SYSCALL(add_dir)
+ 573:	b8 16 00 00 00       	mov    $0x16,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <history>:
+SYSCALL(history)
+ 57b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 583:	b8 19 00 00 00       	mov    $0x19,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <nanosleep>:
+SYSCALL(nanosleep)
+ 58b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <clone>:
+SYSCALL(clone)
+ 593:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <join>:
+SYSCALL(join)
+ 59b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <futex_wait>:
+SYSCALL(futex_wait)
+ 5a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <futex_wake>:
+SYSCALL(futex_wake)
+ 5ab:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5b3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5bb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 5c3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <getprocinfo>:
+SYSCALL(getprocinfo)
+ 5cb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <waitpid>:
+SYSCALL(waitpid)
+ 5d3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <tracectl>:
+SYSCALL(tracectl)
+ 5db:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <traceread>:
+SYSCALL(traceread)
+ 5e3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 5eb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 5f3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 5fb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <irqroute>:
+SYSCALL(irqroute)
+ 603:	b8 29 00 00 00       	mov    $0x29,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <irqstat>:
+SYSCALL(irqstat)
+ 60b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <boottimes>:
+SYSCALL(boottimes)
+ 613:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <lockbench>:
+SYSCALL(lockbench)
+ 61b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <lockstat>:
+SYSCALL(lockstat)
+ 623:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <cpustat>:
+SYSCALL(cpustat)
+ 62b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <bcachesize>:
+SYSCALL(bcachesize)
+ 633:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 648:	89 d1                	mov    %edx,%ecx
+{
+ 64a:	83 ec 3c             	sub    $0x3c,%esp
+ 64d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 650:	85 d2                	test   %edx,%edx
+ 652:	0f 89 80 00 00 00    	jns    6d8 <printint+0x98>
+ 658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 65c:	74 7a                	je     6d8 <printint+0x98>
+    x = -xx;
+ 65e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 668:	31 f6                	xor    %esi,%esi
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 670:	89 c8                	mov    %ecx,%eax
+ 672:	31 d2                	xor    %edx,%edx
+ 674:	89 f7                	mov    %esi,%edi
+ 676:	f7 f3                	div    %ebx
+ 678:	8d 76 01             	lea    0x1(%esi),%esi
+ 67b:	0f b6 92 a0 0d 00 00 	movzbl 0xda0(%edx),%edx
+ 682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 686:	89 ca                	mov    %ecx,%edx
+ 688:	89 c1                	mov    %eax,%ecx
+ 68a:	39 da                	cmp    %ebx,%edx
+ 68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+ 68e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 691:	85 c0                	test   %eax,%eax
+ 693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+ 695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 69a:	89 f7                	mov    %esi,%edi
+ 69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 69f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6a2:	01 df                	add    %ebx,%edi
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6b4:	6a 01                	push   $0x1
+ 6b6:	50                   	push   %eax
+ 6b7:	56                   	push   %esi
+ 6b8:	e8 36 fe ff ff       	call   4f3 <write>
+  while(--i >= 0)
+ 6bd:	89 f8                	mov    %edi,%eax
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ef 01             	sub    $0x1,%edi
+ 6c5:	39 d8                	cmp    %ebx,%eax
+ 6c7:	75 df                	jne    6a8 <printint+0x68>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6d8:	31 c0                	xor    %eax,%eax
+ 6da:	eb 89                	jmp    665 <printint+0x25>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f2:	83 c6 01             	add    $0x1,%esi
+ 6f5:	84 db                	test   %bl,%bl
+ 6f7:	74 67                	je     760 <printf+0x80>
+ 6f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6fc:	31 d2                	xor    %edx,%edx
+ 6fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 701:	eb 34                	jmp    737 <printf+0x57>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+ 708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 70b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 710:	83 f8 25             	cmp    $0x25,%eax
+ 713:	74 18                	je     72d <printf+0x4d>
+  write(fd, &c, 1);
+ 715:	83 ec 04             	sub    $0x4,%esp
+ 718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 71b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71e:	6a 01                	push   $0x1
+ 720:	50                   	push   %eax
+ 721:	57                   	push   %edi
+ 722:	e8 cc fd ff ff       	call   4f3 <write>
+ 727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 72a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 72d:	0f b6 1e             	movzbl (%esi),%ebx
+ 730:	83 c6 01             	add    $0x1,%esi
+ 733:	84 db                	test   %bl,%bl
+ 735:	74 29                	je     760 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 73a:	85 d2                	test   %edx,%edx
+ 73c:	74 ca                	je     708 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 73e:	83 fa 25             	cmp    $0x25,%edx
+ 741:	75 ea                	jne    72d <printf+0x4d>
+      if(c == 'd'){
+ 743:	83 f8 25             	cmp    $0x25,%eax
+ 746:	0f 84 24 01 00 00    	je     870 <printf+0x190>
+ 74c:	83 e8 63             	sub    $0x63,%eax
+ 74f:	83 f8 15             	cmp    $0x15,%eax
+ 752:	77 1c                	ja     770 <printf+0x90>
+ 754:	ff 24 85 48 0d 00 00 	jmp    *0xd48(,%eax,4)
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 77a:	6a 01                	push   $0x1
+ 77c:	52                   	push   %edx
+ 77d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 780:	57                   	push   %edi
+ 781:	e8 6d fd ff ff       	call   4f3 <write>
+ 786:	83 c4 0c             	add    $0xc,%esp
+ 789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78c:	6a 01                	push   $0x1
+ 78e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 791:	52                   	push   %edx
+ 792:	57                   	push   %edi
+ 793:	e8 5b fd ff ff       	call   4f3 <write>
+        putc(fd, c);
+ 798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79b:	31 d2                	xor    %edx,%edx
+ 79d:	eb 8e                	jmp    72d <printf+0x4d>
+ 79f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 00                	push   $0x0
+ 7af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7b4:	e8 87 fe ff ff       	call   640 <printint>
+        ap++;
+ 7b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 67 ff ff ff       	jmp    72d <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	0f 84 9d 00 00 00    	je     880 <printf+0x1a0>
+        while(*s != 0){
+ 7e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 84 3d ff ff ff    	je     72d <printf+0x4d>
+ 7f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7f6:	89 de                	mov    %ebx,%esi
+ 7f8:	89 d3                	mov    %edx,%ebx
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	53                   	push   %ebx
+ 80c:	57                   	push   %edi
+ 80d:	e8 e1 fc ff ff       	call   4f3 <write>
+        while(*s != 0){
+ 812:	0f b6 06             	movzbl (%esi),%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	84 c0                	test   %al,%al
+ 81a:	75 e4                	jne    800 <printf+0x120>
+      state = 0;
+ 81c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 07 ff ff ff       	jmp    72d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 01                	push   $0x1
+ 83f:	e9 6b ff ff ff       	jmp    7af <printf+0xcf>
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	52                   	push   %edx
+ 85c:	57                   	push   %edi
+ 85d:	e8 91 fc ff ff       	call   4f3 <write>
+        ap++;
+ 862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 868:	31 d2                	xor    %edx,%edx
+ 86a:	e9 be fe ff ff       	jmp    72d <printf+0x4d>
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 879:	6a 01                	push   $0x1
+ 87b:	e9 11 ff ff ff       	jmp    791 <printf+0xb1>
+ 880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 885:	bb 41 0d 00 00       	mov    $0xd41,%ebx
+ 88a:	e9 61 ff ff ff       	jmp    7f0 <printf+0x110>
+ 88f:	90                   	nop
+
+00000890 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 891:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 894:	89 e5                	mov    %esp,%ebp
+ 896:	57                   	push   %edi
+ 897:	56                   	push   %esi
+ 898:	53                   	push   %ebx
+ 899:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89b:	a1 a4 1a 00 00       	mov    0x1aa4,%eax
+ 8a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a4:	39 ca                	cmp    %ecx,%edx
+ 8a6:	73 30                	jae    8d8 <ufree+0x48>
+ 8a8:	39 c1                	cmp    %eax,%ecx
+ 8aa:	72 04                	jb     8b0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ac:	39 c2                	cmp    %eax,%edx
+ 8ae:	72 f0                	jb     8a0 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8b3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8b6:	39 f8                	cmp    %edi,%eax
+ 8b8:	74 26                	je     8e0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8c3:	39 f1                	cmp    %esi,%ecx
+ 8c5:	74 30                	je     8f7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8c7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8c9:	5b                   	pop    %ebx
+  freep = p;
+ 8ca:	89 15 a4 1a 00 00    	mov    %edx,0x1aa4
+}
+ 8d0:	5e                   	pop    %esi
+ 8d1:	5f                   	pop    %edi
+ 8d2:	5d                   	pop    %ebp
+ 8d3:	c3                   	ret
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d8:	39 c1                	cmp    %eax,%ecx
+ 8da:	72 d0                	jb     8ac <ufree+0x1c>
+ 8dc:	eb c2                	jmp    8a0 <ufree+0x10>
+ 8de:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8e0:	03 70 04             	add    0x4(%eax),%esi
+ 8e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e6:	8b 02                	mov    (%edx),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8f3:	39 f1                	cmp    %esi,%ecx
+ 8f5:	75 d0                	jne    8c7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 8f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8fa:	89 15 a4 1a 00 00    	mov    %edx,0x1aa4
+    p->s.size += bp->s.size;
+ 900:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 903:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 906:	89 0a                	mov    %ecx,(%edx)
+}
+ 908:	5b                   	pop    %ebx
+ 909:	5e                   	pop    %esi
+ 90a:	5f                   	pop    %edi
+ 90b:	5d                   	pop    %ebp
+ 90c:	c3                   	ret
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	53                   	push   %ebx
+ 914:	83 ec 10             	sub    $0x10,%esp
+ 917:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 91a:	68 a0 1a 00 00       	push   $0x1aa0
+ 91f:	e8 ec 01 00 00       	call   b10 <lock_acquire>
+  ufree(ap);
+ 924:	89 d8                	mov    %ebx,%eax
+ 926:	e8 65 ff ff ff       	call   890 <ufree>
+  lock_release(&mlock);
+ 92b:	c7 45 08 a0 1a 00 00 	movl   $0x1aa0,0x8(%ebp)
+}
+ 932:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 935:	83 c4 10             	add    $0x10,%esp
+}
+ 938:	c9                   	leave
+  lock_release(&mlock);
+ 939:	e9 f2 01 00 00       	jmp    b30 <lock_release>
+ 93e:	66 90                	xchg   %ax,%ax
+
+00000940 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 94c:	68 a0 1a 00 00       	push   $0x1aa0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 951:	8d 48 07             	lea    0x7(%eax),%ecx
+ 954:	c1 e9 03             	shr    $0x3,%ecx
+ 957:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 95a:	e8 b1 01 00 00       	call   b10 <lock_acquire>
+  if((prevp = freep) == 0){
+ 95f:	8b 15 a4 1a 00 00    	mov    0x1aa4,%edx
+ 965:	83 c4 10             	add    $0x10,%esp
+ 968:	85 d2                	test   %edx,%edx
+ 96a:	0f 84 b0 00 00 00    	je     a20 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 970:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 972:	8b 47 04             	mov    0x4(%edi),%eax
+ 975:	39 f0                	cmp    %esi,%eax
+ 977:	73 6f                	jae    9e8 <malloc+0xa8>
+  if(nu < 4096)
+ 979:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 97e:	39 de                	cmp    %ebx,%esi
+ 980:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 983:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 98a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 98d:	eb 0a                	jmp    999 <malloc+0x59>
+ 98f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 992:	8b 47 04             	mov    0x4(%edi),%eax
+ 995:	39 f0                	cmp    %esi,%eax
+ 997:	73 4f                	jae    9e8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 999:	89 fa                	mov    %edi,%edx
+ 99b:	39 3d a4 1a 00 00    	cmp    %edi,0x1aa4
+ 9a1:	75 ed                	jne    990 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	ff 75 e4             	push   -0x1c(%ebp)
+ 9a9:	e8 ad fb ff ff       	call   55b <sbrk>
+  if(p == (char*)-1)
+ 9ae:	83 c4 10             	add    $0x10,%esp
+ 9b1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9b4:	74 15                	je     9cb <malloc+0x8b>
+  hp->s.size = nu;
+ 9b6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 9b9:	83 c0 08             	add    $0x8,%eax
+ 9bc:	e8 cf fe ff ff       	call   890 <ufree>
+  return freep;
+ 9c1:	8b 15 a4 1a 00 00    	mov    0x1aa4,%edx
+      if((p = morecore(nunits)) == 0){
+ 9c7:	85 d2                	test   %edx,%edx
+ 9c9:	75 c5                	jne    990 <malloc+0x50>
+        lock_release(&mlock);
+ 9cb:	83 ec 0c             	sub    $0xc,%esp
+ 9ce:	68 a0 1a 00 00       	push   $0x1aa0
+ 9d3:	e8 58 01 00 00       	call   b30 <lock_release>
+        return 0;
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 9db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9de:	31 c0                	xor    %eax,%eax
+}
+ 9e0:	5b                   	pop    %ebx
+ 9e1:	5e                   	pop    %esi
+ 9e2:	5f                   	pop    %edi
+ 9e3:	5d                   	pop    %ebp
+ 9e4:	c3                   	ret
+ 9e5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9e8:	39 c6                	cmp    %eax,%esi
+ 9ea:	74 64                	je     a50 <malloc+0x110>
+        p->s.size -= nunits;
+ 9ec:	29 f0                	sub    %esi,%eax
+ 9ee:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 9f1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 9f4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 9f7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 9fa:	89 15 a4 1a 00 00    	mov    %edx,0x1aa4
+      lock_release(&mlock);
+ a00:	68 a0 1a 00 00       	push   $0x1aa0
+ a05:	e8 26 01 00 00       	call   b30 <lock_release>
+      return (void*)(p + 1);
+ a0a:	83 c4 10             	add    $0x10,%esp
+}
+ a0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a10:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ a13:	5b                   	pop    %ebx
+ a14:	5e                   	pop    %esi
+ a15:	5f                   	pop    %edi
+ a16:	5d                   	pop    %ebp
+ a17:	c3                   	ret
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ a20:	c7 05 a4 1a 00 00 a8 	movl   $0x1aa8,0x1aa4
+ a27:	1a 00 00 
+    base.s.size = 0;
+ a2a:	bf a8 1a 00 00       	mov    $0x1aa8,%edi
+    base.s.ptr = freep = prevp = &base;
+ a2f:	c7 05 a8 1a 00 00 a8 	movl   $0x1aa8,0x1aa8
+ a36:	1a 00 00 
+    base.s.size = 0;
+ a39:	c7 05 ac 1a 00 00 00 	movl   $0x0,0x1aac
+ a40:	00 00 00 
+    if(p->s.size >= nunits){
+ a43:	e9 31 ff ff ff       	jmp    979 <malloc+0x39>
+ a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a50:	8b 07                	mov    (%edi),%eax
+ a52:	89 02                	mov    %eax,(%edx)
+ a54:	eb a1                	jmp    9f7 <malloc+0xb7>
+ a56:	66 90                	xchg   %ax,%ax
+ a58:	66 90                	xchg   %ax,%ax
+ a5a:	66 90                	xchg   %ax,%ax
+ a5c:	66 90                	xchg   %ax,%ax
+ a5e:	66 90                	xchg   %ax,%ax
+
+00000a60 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	53                   	push   %ebx
+ a64:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ a67:	68 00 10 00 00       	push   $0x1000
+ a6c:	e8 cf fe ff ff       	call   940 <malloc>
+ a71:	83 c4 10             	add    $0x10,%esp
+ a74:	85 c0                	test   %eax,%eax
+ a76:	74 37                	je     aaf <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ a78:	83 ec 04             	sub    $0x4,%esp
+ a7b:	89 c3                	mov    %eax,%ebx
+ a7d:	50                   	push   %eax
+ a7e:	ff 75 0c             	push   0xc(%ebp)
+ a81:	ff 75 08             	push   0x8(%ebp)
+ a84:	e8 0a fb ff ff       	call   593 <clone>
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	85 c0                	test   %eax,%eax
+ a8e:	78 08                	js     a98 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ a90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a93:	c9                   	leave
+ a94:	c3                   	ret
+ a95:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ a98:	83 ec 0c             	sub    $0xc,%esp
+ a9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a9e:	53                   	push   %ebx
+ a9f:	e8 6c fe ff ff       	call   910 <free>
+ aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ aa7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ aaa:	83 c4 10             	add    $0x10,%esp
+}
+ aad:	c9                   	leave
+ aae:	c3                   	ret
+    return -1;
+ aaf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ab4:	eb da                	jmp    a90 <thread_create+0x30>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ac6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ac9:	50                   	push   %eax
+ aca:	e8 cc fa ff ff       	call   59b <join>
+ acf:	83 c4 10             	add    $0x10,%esp
+ ad2:	85 c0                	test   %eax,%eax
+ ad4:	79 0a                	jns    ae0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ ad6:	c9                   	leave
+ ad7:	c3                   	ret
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+ ae0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	ff 75 f4             	push   -0xc(%ebp)
+ ae9:	e8 22 fe ff ff       	call   910 <free>
+ aee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ af1:	83 c4 10             	add    $0x10,%esp
+}
+ af4:	c9                   	leave
+ af5:	c3                   	ret
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b00 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ b03:	8b 45 08             	mov    0x8(%ebp),%eax
+ b06:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b0c:	5d                   	pop    %ebp
+ b0d:	c3                   	ret
+ b0e:	66 90                	xchg   %ax,%ax
+
+00000b10 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ b10:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ b11:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b16:	89 e5                	mov    %esp,%ebp
+ b18:	8b 55 08             	mov    0x8(%ebp),%edx
+ b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+ b20:	89 c8                	mov    %ecx,%eax
+ b22:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ b25:	85 c0                	test   %eax,%eax
+ b27:	75 f7                	jne    b20 <lock_acquire+0x10>
+    ;
+}
+ b29:	5d                   	pop    %ebp
+ b2a:	c3                   	ret
+ b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+
+00000b30 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ b30:	55                   	push   %ebp
+ b31:	31 c0                	xor    %eax,%eax
+ b33:	89 e5                	mov    %esp,%ebp
+ b35:	8b 55 08             	mov    0x8(%ebp),%edx
+ b38:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ b3b:	5d                   	pop    %ebp
+ b3c:	c3                   	ret
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b40 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ b43:	8b 45 08             	mov    0x8(%ebp),%eax
+ b46:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b4c:	5d                   	pop    %ebp
+ b4d:	c3                   	ret
+ b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b50:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ b51:	31 c0                	xor    %eax,%eax
+ b53:	ba 01 00 00 00       	mov    $0x1,%edx
+ b58:	89 e5                	mov    %esp,%ebp
+ b5a:	56                   	push   %esi
+ b5b:	53                   	push   %ebx
+ b5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b5f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ b63:	85 c0                	test   %eax,%eax
+ b65:	74 30                	je     b97 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ b67:	83 f8 02             	cmp    $0x2,%eax
+ b6a:	74 0c                	je     b78 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ b6c:	b8 02 00 00 00       	mov    $0x2,%eax
+ b71:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ b74:	85 c0                	test   %eax,%eax
+ b76:	74 1f                	je     b97 <mutex_lock+0x47>
+ b78:	be 02 00 00 00       	mov    $0x2,%esi
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ b80:	83 ec 08             	sub    $0x8,%esp
+ b83:	6a 02                	push   $0x2
+ b85:	53                   	push   %ebx
+ b86:	e8 18 fa ff ff       	call   5a3 <futex_wait>
+ b8b:	89 f0                	mov    %esi,%eax
+ b8d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b90:	83 c4 10             	add    $0x10,%esp
+ b93:	85 c0                	test   %eax,%eax
+ b95:	75 e9                	jne    b80 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ b97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b9a:	5b                   	pop    %ebx
+ b9b:	5e                   	pop    %esi
+ b9c:	5d                   	pop    %ebp
+ b9d:	c3                   	ret
+ b9e:	66 90                	xchg   %ax,%ax
+
+00000ba0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	31 c0                	xor    %eax,%eax
+ ba3:	89 e5                	mov    %esp,%ebp
+ ba5:	83 ec 08             	sub    $0x8,%esp
+ ba8:	8b 55 08             	mov    0x8(%ebp),%edx
+ bab:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ bae:	83 f8 02             	cmp    $0x2,%eax
+ bb1:	74 05                	je     bb8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ bb3:	c9                   	leave
+ bb4:	c3                   	ret
+ bb5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ bb8:	83 ec 08             	sub    $0x8,%esp
+ bbb:	6a 01                	push   $0x1
+ bbd:	52                   	push   %edx
+ bbe:	e8 e8 f9 ff ff       	call   5ab <futex_wake>
+ bc3:	83 c4 10             	add    $0x10,%esp
+}
+ bc6:	c9                   	leave
+ bc7:	c3                   	ret
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+
+00000bd0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ bd6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ bdc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ be3:	5d                   	pop    %ebp
+ be4:	c3                   	ret
+ be5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	53                   	push   %ebx
+ bf6:	83 ec 0c             	sub    $0xc,%esp
+ bf9:	8b 75 08             	mov    0x8(%ebp),%esi
+ bfc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ bff:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ c04:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ c06:	8b 3e                	mov    (%esi),%edi
+ c08:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ c0b:	83 f8 02             	cmp    $0x2,%eax
+ c0e:	74 60                	je     c70 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ c10:	83 ec 08             	sub    $0x8,%esp
+ c13:	57                   	push   %edi
+ c14:	56                   	push   %esi
+ c15:	e8 89 f9 ff ff       	call   5a3 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ c1a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ c1f:	31 c0                	xor    %eax,%eax
+ c21:	ba 01 00 00 00       	mov    $0x1,%edx
+ c26:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ c2a:	83 c4 10             	add    $0x10,%esp
+ c2d:	85 c0                	test   %eax,%eax
+ c2f:	74 36                	je     c67 <cond_wait+0x77>
+  if(c != 2)
+ c31:	83 f8 02             	cmp    $0x2,%eax
+ c34:	74 0c                	je     c42 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ c36:	b8 02 00 00 00       	mov    $0x2,%eax
+ c3b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c3e:	85 c0                	test   %eax,%eax
+ c40:	74 25                	je     c67 <cond_wait+0x77>
+ c42:	be 02 00 00 00       	mov    $0x2,%esi
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ c50:	83 ec 08             	sub    $0x8,%esp
+ c53:	6a 02                	push   $0x2
+ c55:	53                   	push   %ebx
+ c56:	e8 48 f9 ff ff       	call   5a3 <futex_wait>
+ c5b:	89 f0                	mov    %esi,%eax
+ c5d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c60:	83 c4 10             	add    $0x10,%esp
+ c63:	85 c0                	test   %eax,%eax
+ c65:	75 e9                	jne    c50 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c6a:	5b                   	pop    %ebx
+ c6b:	5e                   	pop    %esi
+ c6c:	5f                   	pop    %edi
+ c6d:	5d                   	pop    %ebp
+ c6e:	c3                   	ret
+ c6f:	90                   	nop
+    futex_wake(&m->val, 1);
+ c70:	83 ec 08             	sub    $0x8,%esp
+ c73:	6a 01                	push   $0x1
+ c75:	53                   	push   %ebx
+ c76:	e8 30 f9 ff ff       	call   5ab <futex_wake>
+ c7b:	83 c4 10             	add    $0x10,%esp
+ c7e:	eb 90                	jmp    c10 <cond_wait+0x20>
+
+00000c80 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	83 ec 08             	sub    $0x8,%esp
+ c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c89:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c8d:	8b 50 04             	mov    0x4(%eax),%edx
+ c90:	85 d2                	test   %edx,%edx
+ c92:	75 0c                	jne    ca0 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ c94:	c9                   	leave
+ c95:	c3                   	ret
+ c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ ca0:	83 ec 08             	sub    $0x8,%esp
+ ca3:	6a 01                	push   $0x1
+ ca5:	50                   	push   %eax
+ ca6:	e8 00 f9 ff ff       	call   5ab <futex_wake>
+ cab:	83 c4 10             	add    $0x10,%esp
+}
+ cae:	c9                   	leave
+ caf:	c3                   	ret
+
+00000cb0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	83 ec 08             	sub    $0x8,%esp
+ cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ cb9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ cbd:	8b 50 04             	mov    0x4(%eax),%edx
+ cc0:	85 d2                	test   %edx,%edx
+ cc2:	75 0c                	jne    cd0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ cc4:	c9                   	leave
+ cc5:	c3                   	ret
+ cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ cd0:	83 ec 08             	sub    $0x8,%esp
+ cd3:	68 ff ff ff 7f       	push   $0x7fffffff
+ cd8:	50                   	push   %eax
+ cd9:	e8 cd f8 ff ff       	call   5ab <futex_wake>
+ cde:	83 c4 10             	add    $0x10,%esp
+}
+ ce1:	c9                   	leave
+ ce2:	c3                   	ret
@@ -0,0 +1,71 @@
+// Show what each CPU has been doing: system calls,
+// interrupts, context switches and TLB shootdowns per
+// second, over an interval.
+// usage: mpstat [seconds]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+
+struct cpustat before[NCPU], after[NCPU];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int c, n, secs;
+
+  secs = argc > 1 ? atoi(argv[1]) : 1;
+  if(secs < 1){
+    printf(2, "usage: mpstat [seconds]\n");
+    exit();
+  }
+  n = cpustat(before, NCPU);
+  sleep(secs*100);
+  if(n < 0 || cpustat(after, NCPU) != n){
+    printf(2, "mpstat: cpustat failed\n");
+    exit();
+  }
+
+  col("CPU", 5);
+  col("SYSCALL/S", 11);
+  col("INTR/S", 9);
+  col("CSW/S", 9);
+  printf(1, "TLBFLUSH/S\n");
+  for(c = 0; c < n; c++){
+    coln(c, 5);
+    coln((after[c].stat[CS_SYSCALL] - before[c].stat[CS_SYSCALL]) / secs, 11);
+    coln((after[c].stat[CS_INTR] - before[c].stat[CS_INTR]) / secs, 9);
+    coln((after[c].stat[CS_CSW] - before[c].stat[CS_CSW]) / secs, 9);
+    coln((after[c].stat[CS_TLBFLUSH] - before[c].stat[CS_TLBFLUSH]) / secs, 0);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -1,6 +1,9 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      4096  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
-#define NCPU          8  // maximum number of CPUs
+#define NCPU         32  // maximum number of CPUs; at most 32, for cpumask
+#define NIRQ         32  // interrupt vectors counted per CPU, from T_IRQ0
+#define NCPUSTAT      8  // event counters per CPU
+#define NBOOTPHASE   24  // boot phases timed
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
@@ -9,5 +12,9 @@
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
 #define FSSIZE       1000  // size of file system in blocks
+#define TICKNS   10000000  // nanoseconds per scheduler tick
+#define LOCKPCS         1  // record the caller pcs of each spin lock acquire
+#define LOCKSTAT        1  // count lock acquisitions, waits and hold times
+#define NLOCKCLASS     48  // lock names that lockstat can tell apart
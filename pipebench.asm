@@ -0,0 +1,2145 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	89 c8                	mov    %ecx,%eax
+   c:	55                   	push   %ebp
+   d:	89 e5                	mov    %esp,%ebp
+   f:	57                   	push   %edi
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 28             	sub    $0x28,%esp
+  16:	8b 09                	mov    (%ecx),%ecx
+  18:	8b 58 04             	mov    0x4(%eax),%ebx
+  uint t0;
+
+  nstage = 3;
+  kbytes = 1024;
+  mask = 0;
+  for(i = 1; i+1 < argc; i += 2){
+  1b:	83 f9 02             	cmp    $0x2,%ecx
+  1e:	0f 8e 0c 01 00 00    	jle    130 <main+0x130>
+  24:	8d 51 fd             	lea    -0x3(%ecx),%edx
+  27:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  2a:	83 c3 04             	add    $0x4,%ebx
+  2d:	be 01 00 00 00       	mov    $0x1,%esi
+  32:	83 e2 fe             	and    $0xfffffffe,%edx
+  mask = 0;
+  35:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  kbytes = 1024;
+  3c:	c7 45 d0 00 04 00 00 	movl   $0x400,-0x30(%ebp)
+  43:	8d 7a 03             	lea    0x3(%edx),%edi
+  nstage = 3;
+  46:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+  4d:	eb 1c                	jmp    6b <main+0x6b>
+  4f:	90                   	nop
+    if(strcmp(argv[i], "-n") == 0)
+      nstage = atoi(argv[i+1]);
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	ff 73 04             	push   0x4(%ebx)
+  56:	e8 65 05 00 00       	call   5c0 <atoi>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  61:	83 c6 02             	add    $0x2,%esi
+  64:	83 c3 08             	add    $0x8,%ebx
+  67:	39 fe                	cmp    %edi,%esi
+  69:	74 47                	je     b2 <main+0xb2>
+    if(strcmp(argv[i], "-n") == 0)
+  6b:	83 ec 08             	sub    $0x8,%esp
+  6e:	68 44 0e 00 00       	push   $0xe44
+  73:	ff 33                	push   (%ebx)
+  75:	e8 a6 03 00 00       	call   420 <strcmp>
+  7a:	83 c4 10             	add    $0x10,%esp
+  7d:	85 c0                	test   %eax,%eax
+  7f:	74 cf                	je     50 <main+0x50>
+    else if(strcmp(argv[i], "-k") == 0)
+  81:	83 ec 08             	sub    $0x8,%esp
+  84:	68 47 0e 00 00       	push   $0xe47
+  89:	ff 33                	push   (%ebx)
+  8b:	e8 90 03 00 00       	call   420 <strcmp>
+  90:	83 c4 10             	add    $0x10,%esp
+  93:	85 c0                	test   %eax,%eax
+  95:	75 69                	jne    100 <main+0x100>
+      kbytes = atoi(argv[i+1]);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	ff 73 04             	push   0x4(%ebx)
+  for(i = 1; i+1 < argc; i += 2){
+  9d:	83 c6 02             	add    $0x2,%esi
+  a0:	83 c3 08             	add    $0x8,%ebx
+      kbytes = atoi(argv[i+1]);
+  a3:	e8 18 05 00 00       	call   5c0 <atoi>
+  a8:	83 c4 10             	add    $0x10,%esp
+  ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  ae:	39 fe                	cmp    %edi,%esi
+  b0:	75 b9                	jne    6b <main+0x6b>
+  b2:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+    else if(strcmp(argv[i], "-c") == 0)
+      mask = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || nstage < 2 || kbytes <= 0){
+  b5:	39 f9                	cmp    %edi,%ecx
+  b7:	0f 9f c0             	setg   %al
+  ba:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+  be:	0f 9e c2             	setle  %dl
+  c1:	08 d0                	or     %dl,%al
+  c3:	75 6d                	jne    132 <main+0x132>
+  c5:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  c9:	7e 67                	jle    132 <main+0x132>
+    printf(2, "usage: pipebench [-n stages] [-k kbytes] [-c cpumask]\n");
+    exit();
+  }
+  if(mask && sched_setaffinity(0, mask) < 0){
+  cb:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+  cf:	0f 84 7e 00 00 00    	je     153 <main+0x153>
+  d5:	52                   	push   %edx
+  d6:	52                   	push   %edx
+  d7:	ff 75 cc             	push   -0x34(%ebp)
+  da:	6a 00                	push   $0x0
+  dc:	e8 32 06 00 00       	call   713 <sched_setaffinity>
+  e1:	83 c4 10             	add    $0x10,%esp
+  e4:	85 c0                	test   %eax,%eax
+  e6:	79 6b                	jns    153 <main+0x153>
+    printf(2, "pipebench: bad cpumask %d\n", mask);
+  e8:	50                   	push   %eax
+  e9:	ff 75 cc             	push   -0x34(%ebp)
+  ec:	68 4d 0e 00 00       	push   $0xe4d
+  f1:	6a 02                	push   $0x2
+  f3:	e8 48 07 00 00       	call   840 <printf>
+    exit();
+  f8:	e8 36 05 00 00       	call   633 <exit>
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+    else if(strcmp(argv[i], "-c") == 0)
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 4a 0e 00 00       	push   $0xe4a
+ 108:	ff 33                	push   (%ebx)
+ 10a:	e8 11 03 00 00       	call   420 <strcmp>
+ 10f:	83 c4 10             	add    $0x10,%esp
+ 112:	85 c0                	test   %eax,%eax
+ 114:	0f 85 cb 00 00 00    	jne    1e5 <main+0x1e5>
+      mask = atoi(argv[i+1]);
+ 11a:	83 ec 0c             	sub    $0xc,%esp
+ 11d:	ff 73 04             	push   0x4(%ebx)
+ 120:	e8 9b 04 00 00       	call   5c0 <atoi>
+ 125:	83 c4 10             	add    $0x10,%esp
+ 128:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 12b:	e9 31 ff ff ff       	jmp    61 <main+0x61>
+  if(i < argc || nstage < 2 || kbytes <= 0){
+ 130:	75 13                	jne    145 <main+0x145>
+    printf(2, "usage: pipebench [-n stages] [-k kbytes] [-c cpumask]\n");
+ 132:	51                   	push   %ecx
+ 133:	51                   	push   %ecx
+ 134:	68 9c 0e 00 00       	push   $0xe9c
+ 139:	6a 02                	push   $0x2
+ 13b:	e8 00 07 00 00       	call   840 <printf>
+    exit();
+ 140:	e8 ee 04 00 00       	call   633 <exit>
+  nstage = 3;
+ 145:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+  kbytes = 1024;
+ 14c:	c7 45 d0 00 04 00 00 	movl   $0x400,-0x30(%ebp)
+  }
+
+  t0 = msecs();
+ 153:	e8 68 02 00 00       	call   3c0 <msecs>
+  in = -1;
+  for(i = 0; i < nstage; i++){
+    if(i < nstage-1 && pipe(fd) < 0){
+ 158:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  in = -1;
+ 15b:	83 ce ff             	or     $0xffffffff,%esi
+  for(i = 0; i < nstage; i++){
+ 15e:	31 db                	xor    %ebx,%ebx
+  t0 = msecs();
+ 160:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    if(i < nstage-1 && pipe(fd) < 0){
+ 163:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 166:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 169:	eb 4f                	jmp    1ba <main+0x1ba>
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+      printf(2, "pipebench: pipe failed\n");
+      exit();
+    }
+    if(i == nstage-1)
+ 170:	75 0e                	jne    180 <main+0x180>
+      fd[0] = fd[1] = -1;
+ 172:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+ 179:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    if(fork() == 0){
+ 180:	e8 a6 04 00 00       	call   62b <fork>
+ 185:	85 c0                	test   %eax,%eax
+ 187:	0f 84 29 01 00 00    	je     2b6 <main+0x2b6>
+      if(fd[0] >= 0)
+        close(fd[0]);
+      stage(in, fd[1], kbytes, nstage, t0);
+    }
+    if(in >= 0)
+ 18d:	85 f6                	test   %esi,%esi
+ 18f:	78 0c                	js     19d <main+0x19d>
+      close(in);
+ 191:	83 ec 0c             	sub    $0xc,%esp
+ 194:	56                   	push   %esi
+ 195:	e8 c1 04 00 00       	call   65b <close>
+ 19a:	83 c4 10             	add    $0x10,%esp
+    if(fd[1] >= 0)
+ 19d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	78 0c                	js     1b0 <main+0x1b0>
+      close(fd[1]);
+ 1a4:	83 ec 0c             	sub    $0xc,%esp
+ 1a7:	50                   	push   %eax
+ 1a8:	e8 ae 04 00 00       	call   65b <close>
+ 1ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nstage; i++){
+ 1b0:	83 c3 01             	add    $0x1,%ebx
+    in = fd[0];
+ 1b3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  for(i = 0; i < nstage; i++){
+ 1b6:	39 fb                	cmp    %edi,%ebx
+ 1b8:	7d 35                	jge    1ef <main+0x1ef>
+    if(i < nstage-1 && pipe(fd) < 0){
+ 1ba:	39 5d cc             	cmp    %ebx,-0x34(%ebp)
+ 1bd:	7e b1                	jle    170 <main+0x170>
+ 1bf:	83 ec 0c             	sub    $0xc,%esp
+ 1c2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 1c5:	50                   	push   %eax
+ 1c6:	e8 78 04 00 00       	call   643 <pipe>
+ 1cb:	83 c4 10             	add    $0x10,%esp
+ 1ce:	85 c0                	test   %eax,%eax
+ 1d0:	79 ae                	jns    180 <main+0x180>
+      printf(2, "pipebench: pipe failed\n");
+ 1d2:	50                   	push   %eax
+ 1d3:	50                   	push   %eax
+ 1d4:	68 68 0e 00 00       	push   $0xe68
+ 1d9:	6a 02                	push   $0x2
+ 1db:	e8 60 06 00 00       	call   840 <printf>
+      exit();
+ 1e0:	e8 4e 04 00 00       	call   633 <exit>
+ 1e5:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+ 1e8:	89 f7                	mov    %esi,%edi
+ 1ea:	e9 c6 fe ff ff       	jmp    b5 <main+0xb5>
+  pid = getpid();
+ 1ef:	e8 bf 04 00 00       	call   6b3 <getpid>
+ 1f4:	89 c3                	mov    %eax,%ebx
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(1);
+ 200:	83 ec 0c             	sub    $0xc,%esp
+ 203:	6a 01                	push   $0x1
+ 205:	e8 b9 04 00 00       	call   6c3 <sleep>
+    n = getprocinfo(pi, NPROC);
+ 20a:	5a                   	pop    %edx
+ 20b:	59                   	pop    %ecx
+ 20c:	68 00 10 00 00       	push   $0x1000
+ 211:	68 40 14 00 00       	push   $0x1440
+ 216:	e8 10 05 00 00       	call   72b <getprocinfo>
+    for(i = 0; i < n; i++)
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	7e de                	jle    200 <main+0x200>
+ 222:	6b c8 3c             	imul   $0x3c,%eax,%ecx
+ 225:	ba 40 14 00 00       	mov    $0x1440,%edx
+    nzombie = 0;
+ 22a:	31 f6                	xor    %esi,%esi
+ 22c:	01 d1                	add    %edx,%ecx
+ 22e:	eb 07                	jmp    237 <main+0x237>
+    for(i = 0; i < n; i++)
+ 230:	83 c2 3c             	add    $0x3c,%edx
+ 233:	39 d1                	cmp    %edx,%ecx
+ 235:	74 19                	je     250 <main+0x250>
+      if(pi[i].ppid == pid && pi[i].state == PS_ZOMBIE)
+ 237:	39 5a 04             	cmp    %ebx,0x4(%edx)
+ 23a:	75 f4                	jne    230 <main+0x230>
+ 23c:	83 7a 08 05          	cmpl   $0x5,0x8(%edx)
+ 240:	75 ee                	jne    230 <main+0x230>
+    for(i = 0; i < n; i++)
+ 242:	83 c2 3c             	add    $0x3c,%edx
+        nzombie++;
+ 245:	83 c6 01             	add    $0x1,%esi
+    for(i = 0; i < n; i++)
+ 248:	39 d1                	cmp    %edx,%ecx
+ 24a:	75 eb                	jne    237 <main+0x237>
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  } while(nzombie < nstage);
+ 250:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 253:	39 ce                	cmp    %ecx,%esi
+ 255:	7c a9                	jl     200 <main+0x200>
+ 257:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+ 259:	31 c0                	xor    %eax,%eax
+ 25b:	bf 40 14 00 00       	mov    $0x1440,%edi
+ 260:	89 f1                	mov    %esi,%ecx
+ 262:	89 de                	mov    %ebx,%esi
+ 264:	89 c3                	mov    %eax,%ebx
+ 266:	89 c8                	mov    %ecx,%eax
+ 268:	eb 10                	jmp    27a <main+0x27a>
+ 26a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 270:	83 c3 01             	add    $0x1,%ebx
+ 273:	83 c7 3c             	add    $0x3c,%edi
+ 276:	39 d8                	cmp    %ebx,%eax
+ 278:	74 2e                	je     2a8 <main+0x2a8>
+    if(pi[i].ppid == pid)
+ 27a:	3b 77 04             	cmp    0x4(%edi),%esi
+ 27d:	75 f1                	jne    270 <main+0x270>
+ 27f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      printf(1, "  pid %d: cpu %d vcsw %d ivcsw %d\n",
+ 282:	50                   	push   %eax
+ 283:	50                   	push   %eax
+ 284:	ff 77 20             	push   0x20(%edi)
+ 287:	ff 77 1c             	push   0x1c(%edi)
+ 28a:	ff 77 0c             	push   0xc(%edi)
+ 28d:	ff 37                	push   (%edi)
+ 28f:	68 f8 0e 00 00       	push   $0xef8
+ 294:	6a 01                	push   $0x1
+ 296:	e8 a5 05 00 00       	call   840 <printf>
+ 29b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 29e:	83 c4 20             	add    $0x20,%esp
+ 2a1:	eb cd                	jmp    270 <main+0x270>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+  }
+  stages(nstage);
+  while(wait() >= 0)
+ 2a8:	e8 8e 03 00 00       	call   63b <wait>
+ 2ad:	85 c0                	test   %eax,%eax
+ 2af:	79 f7                	jns    2a8 <main+0x2a8>
+    exit();
+ 2b1:	e8 7d 03 00 00       	call   633 <exit>
+      if(fd[0] >= 0)
+ 2b6:	89 c1                	mov    %eax,%ecx
+ 2b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2bb:	85 c0                	test   %eax,%eax
+ 2bd:	78 12                	js     2d1 <main+0x2d1>
+        close(fd[0]);
+ 2bf:	83 ec 0c             	sub    $0xc,%esp
+ 2c2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+ 2c5:	50                   	push   %eax
+ 2c6:	e8 90 03 00 00       	call   65b <close>
+ 2cb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+ 2ce:	83 c4 10             	add    $0x10,%esp
+      stage(in, fd[1], kbytes, nstage, t0);
+ 2d1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  if(in < 0){
+ 2d4:	85 f6                	test   %esi,%esi
+ 2d6:	0f 88 a6 00 00 00    	js     382 <main+0x382>
+ 2dc:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 2df:	89 ce                	mov    %ecx,%esi
+ 2e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(in, buf, sizeof(buf))) > 0){
+ 2e8:	83 ec 04             	sub    $0x4,%esp
+ 2eb:	68 00 02 00 00       	push   $0x200
+ 2f0:	68 40 d4 03 00       	push   $0x3d440
+ 2f5:	ff 75 d0             	push   -0x30(%ebp)
+ 2f8:	e8 4e 03 00 00       	call   64b <read>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	89 c7                	mov    %eax,%edi
+ 302:	85 c0                	test   %eax,%eax
+ 304:	7e 30                	jle    336 <main+0x336>
+    total += n;
+ 306:	01 fe                	add    %edi,%esi
+    if(out >= 0 && write(out, buf, n) != n){
+ 308:	85 db                	test   %ebx,%ebx
+ 30a:	78 dc                	js     2e8 <main+0x2e8>
+ 30c:	50                   	push   %eax
+ 30d:	57                   	push   %edi
+ 30e:	68 40 d4 03 00       	push   $0x3d440
+ 313:	53                   	push   %ebx
+ 314:	e8 3a 03 00 00       	call   653 <write>
+ 319:	83 c4 10             	add    $0x10,%esp
+ 31c:	39 c7                	cmp    %eax,%edi
+ 31e:	74 c8                	je     2e8 <main+0x2e8>
+        printf(2, "pipebench: write failed\n");
+ 320:	50                   	push   %eax
+ 321:	50                   	push   %eax
+ 322:	68 80 0e 00 00       	push   $0xe80
+ 327:	6a 02                	push   $0x2
+ 329:	e8 12 05 00 00       	call   840 <printf>
+        break;
+ 32e:	83 c4 10             	add    $0x10,%esp
+ 331:	e9 7b ff ff ff       	jmp    2b1 <main+0x2b1>
+  if(out < 0){
+ 336:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 339:	85 db                	test   %ebx,%ebx
+ 33b:	0f 89 70 ff ff ff    	jns    2b1 <main+0x2b1>
+    ms = msecs() - t0;
+ 341:	e8 7a 00 00 00       	call   3c0 <msecs>
+    printf(1, "%d stages, %d KB in %d ms: %d KB/s\n", nstage,
+ 346:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+    ms = msecs() - t0;
+ 349:	89 c3                	mov    %eax,%ebx
+    printf(1, "%d stages, %d KB in %d ms: %d KB/s\n", nstage,
+ 34b:	31 c0                	xor    %eax,%eax
+ 34d:	29 cb                	sub    %ecx,%ebx
+ 34f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 352:	74 0f                	je     363 <main+0x363>
+           total/1024, ms, ms ? total/ms*1000/1024 : 0);
+ 354:	89 c8                	mov    %ecx,%eax
+ 356:	31 d2                	xor    %edx,%edx
+ 358:	f7 f3                	div    %ebx
+ 35a:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+    printf(1, "%d stages, %d KB in %d ms: %d KB/s\n", nstage,
+ 360:	c1 e8 0a             	shr    $0xa,%eax
+ 363:	c1 f9 0a             	sar    $0xa,%ecx
+ 366:	56                   	push   %esi
+ 367:	56                   	push   %esi
+ 368:	50                   	push   %eax
+ 369:	53                   	push   %ebx
+ 36a:	51                   	push   %ecx
+ 36b:	ff 75 d4             	push   -0x2c(%ebp)
+ 36e:	68 d4 0e 00 00       	push   $0xed4
+ 373:	6a 01                	push   $0x1
+ 375:	e8 c6 04 00 00       	call   840 <printf>
+ 37a:	83 c4 20             	add    $0x20,%esp
+ 37d:	e9 2f ff ff ff       	jmp    2b1 <main+0x2b1>
+    for(total = 0; total < kbytes*1024; total += BUFSZ)
+ 382:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 385:	89 cf                	mov    %ecx,%edi
+ 387:	c1 e6 0a             	shl    $0xa,%esi
+ 38a:	eb 0e                	jmp    39a <main+0x39a>
+ 38c:	81 c7 00 02 00 00    	add    $0x200,%edi
+ 392:	39 f7                	cmp    %esi,%edi
+ 394:	0f 8d 17 ff ff ff    	jge    2b1 <main+0x2b1>
+      if(write(out, buf, BUFSZ) != BUFSZ){
+ 39a:	50                   	push   %eax
+ 39b:	68 00 02 00 00       	push   $0x200
+ 3a0:	68 40 d4 03 00       	push   $0x3d440
+ 3a5:	53                   	push   %ebx
+ 3a6:	e8 a8 02 00 00       	call   653 <write>
+ 3ab:	83 c4 10             	add    $0x10,%esp
+ 3ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 3b3:	74 d7                	je     38c <main+0x38c>
+ 3b5:	e9 66 ff ff ff       	jmp    320 <main+0x320>
+ 3ba:	66 90                	xchg   %ax,%ax
+ 3bc:	66 90                	xchg   %ax,%ax
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <msecs>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 20             	sub    $0x20,%esp
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 3c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3c9:	50                   	push   %eax
+ 3ca:	6a 01                	push   $0x1
+ 3cc:	e8 12 03 00 00       	call   6e3 <clock_gettime>
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 3d1:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+ 3d6:	f7 65 f4             	mull   -0xc(%ebp)
+ 3d9:	69 4d f0 e8 03 00 00 	imul   $0x3e8,-0x10(%ebp),%ecx
+}
+ 3e0:	c9                   	leave
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 3e1:	c1 ea 12             	shr    $0x12,%edx
+ 3e4:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+ 3e7:	c3                   	ret
+ 3e8:	66 90                	xchg   %ax,%ax
+ 3ea:	66 90                	xchg   %ax,%ax
+ 3ec:	66 90                	xchg   %ax,%ax
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 400:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 404:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 407:	83 c0 01             	add    $0x1,%eax
+ 40a:	84 d2                	test   %dl,%dl
+ 40c:	75 f2                	jne    400 <strcpy+0x10>
+    ;
+  return os;
+}
+ 40e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+ 427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 42a:	0f b6 02             	movzbl (%edx),%eax
+ 42d:	84 c0                	test   %al,%al
+ 42f:	75 17                	jne    448 <strcmp+0x28>
+ 431:	eb 3a                	jmp    46d <strcmp+0x4d>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 43c:	83 c2 01             	add    $0x1,%edx
+ 43f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 442:	84 c0                	test   %al,%al
+ 444:	74 1a                	je     460 <strcmp+0x40>
+    p++, q++;
+ 446:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 448:	0f b6 19             	movzbl (%ecx),%ebx
+ 44b:	38 c3                	cmp    %al,%bl
+ 44d:	74 e9                	je     438 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 44f:	29 d8                	sub    %ebx,%eax
+}
+ 451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 454:	c9                   	leave
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 460:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 464:	31 c0                	xor    %eax,%eax
+ 466:	29 d8                	sub    %ebx,%eax
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+ 46c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 46d:	0f b6 19             	movzbl (%ecx),%ebx
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	eb db                	jmp    44f <strcmp+0x2f>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 486:	80 3a 00             	cmpb   $0x0,(%edx)
+ 489:	74 15                	je     4a0 <strlen+0x20>
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+ 490:	83 c0 01             	add    $0x1,%eax
+ 493:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 497:	89 c1                	mov    %eax,%ecx
+ 499:	75 f5                	jne    490 <strlen+0x10>
+    ;
+  return n;
+}
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	5d                   	pop    %ebp
+ 49e:	c3                   	ret
+ 49f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4a0:	31 c9                	xor    %ecx,%ecx
+}
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	89 c8                	mov    %ecx,%eax
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 d7                	mov    %edx,%edi
+ 4bf:	fc                   	cld
+ 4c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	c9                   	leave
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4da:	0f b6 10             	movzbl (%eax),%edx
+ 4dd:	84 d2                	test   %dl,%dl
+ 4df:	75 12                	jne    4f3 <strchr+0x23>
+ 4e1:	eb 1d                	jmp    500 <strchr+0x30>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	84 d2                	test   %dl,%dl
+ 4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+ 4f3:	38 d1                	cmp    %dl,%cl
+ 4f5:	75 f1                	jne    4e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 500:	31 c0                	xor    %eax,%eax
+}
+ 502:	5d                   	pop    %ebp
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 515:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 518:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 519:	31 db                	xor    %ebx,%ebx
+{
+ 51b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 51e:	eb 27                	jmp    547 <gets+0x37>
+    cc = read(0, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	6a 01                	push   $0x1
+ 525:	56                   	push   %esi
+ 526:	6a 00                	push   $0x0
+ 528:	e8 1e 01 00 00       	call   64b <read>
+    if(cc < 1)
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	85 c0                	test   %eax,%eax
+ 532:	7e 1d                	jle    551 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 534:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 53f:	3c 0a                	cmp    $0xa,%al
+ 541:	74 10                	je     553 <gets+0x43>
+ 543:	3c 0d                	cmp    $0xd,%al
+ 545:	74 0c                	je     553 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 547:	89 df                	mov    %ebx,%edi
+ 549:	83 c3 01             	add    $0x1,%ebx
+ 54c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 54f:	7c cf                	jl     520 <gets+0x10>
+ 551:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 55a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55d:	5b                   	pop    %ebx
+ 55e:	5e                   	pop    %esi
+ 55f:	5f                   	pop    %edi
+ 560:	5d                   	pop    %ebp
+ 561:	c3                   	ret
+ 562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	56                   	push   %esi
+ 574:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	6a 00                	push   $0x0
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 f1 00 00 00       	call   673 <open>
+  if(fd < 0)
+ 582:	83 c4 10             	add    $0x10,%esp
+ 585:	85 c0                	test   %eax,%eax
+ 587:	78 27                	js     5b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 589:	83 ec 08             	sub    $0x8,%esp
+ 58c:	ff 75 0c             	push   0xc(%ebp)
+ 58f:	89 c3                	mov    %eax,%ebx
+ 591:	50                   	push   %eax
+ 592:	e8 f4 00 00 00       	call   68b <fstat>
+  close(fd);
+ 597:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 59a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 59c:	e8 ba 00 00 00       	call   65b <close>
+  return r;
+ 5a1:	83 c4 10             	add    $0x10,%esp
+}
+ 5a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5a7:	89 f0                	mov    %esi,%eax
+ 5a9:	5b                   	pop    %ebx
+ 5aa:	5e                   	pop    %esi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5b5:	eb ed                	jmp    5a4 <stat+0x34>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5c7:	0f be 02             	movsbl (%edx),%eax
+ 5ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5d5:	77 1e                	ja     5f5 <atoi+0x35>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ea:	0f be 02             	movsbl (%edx),%eax
+ 5ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5f0:	80 fb 09             	cmp    $0x9,%bl
+ 5f3:	76 eb                	jbe    5e0 <atoi+0x20>
+  return n;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5f8:	89 c8                	mov    %ecx,%eax
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	8b 45 10             	mov    0x10(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 60e:	85 c0                	test   %eax,%eax
+ 610:	7e 13                	jle    625 <memmove+0x25>
+ 612:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 614:	89 d7                	mov    %edx,%edi
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 620:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 621:	39 f8                	cmp    %edi,%eax
+ 623:	75 fb                	jne    620 <memmove+0x20>
+  return vdst;
+}
+ 625:	5e                   	pop    %esi
+ 626:	89 d0                	mov    %edx,%eax
+ 628:	5f                   	pop    %edi
+ 629:	5d                   	pop    %ebp
+ 62a:	c3                   	ret
+
+0000062b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 62b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <exit>:
+SYSCALL(exit)
+ 633:	b8 02 00 00 00       	mov    $0x2,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <wait>:
+SYSCALL(wait)
+ 63b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <pipe>:
+SYSCALL(pipe)
+ 643:	b8 04 00 00 00       	mov    $0x4,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <read>:
+SYSCALL(read)
+ 64b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <write>:
+SYSCALL(write)
+ 653:	b8 10 00 00 00       	mov    $0x10,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <close>:
+SYSCALL(close)
+ 65b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <kill>:
+SYSCALL(kill)
+ 663:	b8 06 00 00 00       	mov    $0x6,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <exec>:
+SYSCALL(exec)
+ 66b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <open>:
+SYSCALL(open)
+ 673:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <mknod>:
+SYSCALL(mknod)
+ 67b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <unlink>:
+SYSCALL(unlink)
+ 683:	b8 12 00 00 00       	mov    $0x12,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <fstat>:
+SYSCALL(fstat)
+ 68b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <link>:
+SYSCALL(link)
+ 693:	b8 13 00 00 00       	mov    $0x13,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <mkdir>:
+SYSCALL(mkdir)
+ 69b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <chdir>:
+SYSCALL(chdir)
+ 6a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <dup>:
+SYSCALL(dup)
+ 6ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getpid>:
+SYSCALL(getpid)
+ 6b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <sbrk>:
+SYSCALL(sbrk)
+ 6bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <sleep>:
+SYSCALL(sleep)
+ 6c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <uptime>:
+SYSCALL(uptime)
+ 6cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <add_dir>:
+SYSCALL(add_dir)
+ 6d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <history>:
+SYSCALL(history)
+ 6db:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 6e3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <nanosleep>:
+SYSCALL(nanosleep)
+ 6eb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <clone>:
+SYSCALL(clone)
+ 6f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <join>:
+SYSCALL(join)
+ 6fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <futex_wait>:
+SYSCALL(futex_wait)
+ 703:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <futex_wake>:
+SYSCALL(futex_wake)
+ 70b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 713:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 71b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 723:	b8 21 00 00 00       	mov    $0x21,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 72b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <waitpid>:
+SYSCALL(waitpid)
+ 733:	b8 23 00 00 00       	mov    $0x23,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <tracectl>:
+SYSCALL(tracectl)
+ 73b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <traceread>:
+SYSCALL(traceread)
+ 743:	b8 25 00 00 00       	mov    $0x25,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 74b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 753:	b8 27 00 00 00       	mov    $0x27,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 75b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <irqroute>:
+SYSCALL(irqroute)
+ 763:	b8 29 00 00 00       	mov    $0x29,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <irqstat>:
+SYSCALL(irqstat)
+ 76b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <boottimes>:
+SYSCALL(boottimes)
+ 773:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <lockbench>:
+SYSCALL(lockbench)
+ 77b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <lockstat>:
+SYSCALL(lockstat)
+ 783:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <cpustat>:
+SYSCALL(cpustat)
+ 78b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <bcachesize>:
+SYSCALL(bcachesize)
+ 793:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+ 79b:	66 90                	xchg   %ax,%ax
+ 79d:	66 90                	xchg   %ax,%ax
+ 79f:	90                   	nop
+
+000007a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7a8:	89 d1                	mov    %edx,%ecx
+{
+ 7aa:	83 ec 3c             	sub    $0x3c,%esp
+ 7ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	85 d2                	test   %edx,%edx
+ 7b2:	0f 89 80 00 00 00    	jns    838 <printint+0x98>
+ 7b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7bc:	74 7a                	je     838 <printint+0x98>
+    x = -xx;
+ 7be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7c8:	31 f6                	xor    %esi,%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7d0:	89 c8                	mov    %ecx,%eax
+ 7d2:	31 d2                	xor    %edx,%edx
+ 7d4:	89 f7                	mov    %esi,%edi
+ 7d6:	f7 f3                	div    %ebx
+ 7d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7db:	0f b6 92 7c 0f 00 00 	movzbl 0xf7c(%edx),%edx
+ 7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7e6:	89 ca                	mov    %ecx,%edx
+ 7e8:	89 c1                	mov    %eax,%ecx
+ 7ea:	39 da                	cmp    %ebx,%edx
+ 7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+ 7ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7f1:	85 c0                	test   %eax,%eax
+ 7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+ 7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7fa:	89 f7                	mov    %esi,%edi
+ 7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 802:	01 df                	add    %ebx,%edi
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 808:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 811:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	50                   	push   %eax
+ 817:	56                   	push   %esi
+ 818:	e8 36 fe ff ff       	call   653 <write>
+  while(--i >= 0)
+ 81d:	89 f8                	mov    %edi,%eax
+ 81f:	83 c4 10             	add    $0x10,%esp
+ 822:	83 ef 01             	sub    $0x1,%edi
+ 825:	39 d8                	cmp    %ebx,%eax
+ 827:	75 df                	jne    808 <printint+0x68>
+}
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 838:	31 c0                	xor    %eax,%eax
+ 83a:	eb 89                	jmp    7c5 <printint+0x25>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 849:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 84c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 84f:	0f b6 1e             	movzbl (%esi),%ebx
+ 852:	83 c6 01             	add    $0x1,%esi
+ 855:	84 db                	test   %bl,%bl
+ 857:	74 67                	je     8c0 <printf+0x80>
+ 859:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85c:	31 d2                	xor    %edx,%edx
+ 85e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 861:	eb 34                	jmp    897 <printf+0x57>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 86b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 18                	je     88d <printf+0x4d>
+  write(fd, &c, 1);
+ 875:	83 ec 04             	sub    $0x4,%esp
+ 878:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 87b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87e:	6a 01                	push   $0x1
+ 880:	50                   	push   %eax
+ 881:	57                   	push   %edi
+ 882:	e8 cc fd ff ff       	call   653 <write>
+ 887:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 88a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 88d:	0f b6 1e             	movzbl (%esi),%ebx
+ 890:	83 c6 01             	add    $0x1,%esi
+ 893:	84 db                	test   %bl,%bl
+ 895:	74 29                	je     8c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 897:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 89a:	85 d2                	test   %edx,%edx
+ 89c:	74 ca                	je     868 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 89e:	83 fa 25             	cmp    $0x25,%edx
+ 8a1:	75 ea                	jne    88d <printf+0x4d>
+      if(c == 'd'){
+ 8a3:	83 f8 25             	cmp    $0x25,%eax
+ 8a6:	0f 84 24 01 00 00    	je     9d0 <printf+0x190>
+ 8ac:	83 e8 63             	sub    $0x63,%eax
+ 8af:	83 f8 15             	cmp    $0x15,%eax
+ 8b2:	77 1c                	ja     8d0 <printf+0x90>
+ 8b4:	ff 24 85 24 0f 00 00 	jmp    *0xf24(,%eax,4)
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c3:	5b                   	pop    %ebx
+ 8c4:	5e                   	pop    %esi
+ 8c5:	5f                   	pop    %edi
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8da:	6a 01                	push   $0x1
+ 8dc:	52                   	push   %edx
+ 8dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8e0:	57                   	push   %edi
+ 8e1:	e8 6d fd ff ff       	call   653 <write>
+ 8e6:	83 c4 0c             	add    $0xc,%esp
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ec:	6a 01                	push   $0x1
+ 8ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8f1:	52                   	push   %edx
+ 8f2:	57                   	push   %edi
+ 8f3:	e8 5b fd ff ff       	call   653 <write>
+        putc(fd, c);
+ 8f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8fb:	31 d2                	xor    %edx,%edx
+ 8fd:	eb 8e                	jmp    88d <printf+0x4d>
+ 8ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 00                	push   $0x0
+ 90f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 911:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 914:	e8 87 fe ff ff       	call   7a0 <printint>
+        ap++;
+ 919:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 67 ff ff ff       	jmp    88d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 933:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 93b:	85 db                	test   %ebx,%ebx
+ 93d:	0f 84 9d 00 00 00    	je     9e0 <printf+0x1a0>
+        while(*s != 0){
+ 943:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 946:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 948:	84 c0                	test   %al,%al
+ 94a:	0f 84 3d ff ff ff    	je     88d <printf+0x4d>
+ 950:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 953:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 956:	89 de                	mov    %ebx,%esi
+ 958:	89 d3                	mov    %edx,%ebx
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 966:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	53                   	push   %ebx
+ 96c:	57                   	push   %edi
+ 96d:	e8 e1 fc ff ff       	call   653 <write>
+        while(*s != 0){
+ 972:	0f b6 06             	movzbl (%esi),%eax
+ 975:	83 c4 10             	add    $0x10,%esp
+ 978:	84 c0                	test   %al,%al
+ 97a:	75 e4                	jne    960 <printf+0x120>
+      state = 0;
+ 97c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 07 ff ff ff       	jmp    88d <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	e9 6b ff ff ff       	jmp    90f <printf+0xcf>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	52                   	push   %edx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 91 fc ff ff       	call   653 <write>
+        ap++;
+ 9c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	e9 be fe ff ff       	jmp    88d <printf+0x4d>
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d9:	6a 01                	push   $0x1
+ 9db:	e9 11 ff ff ff       	jmp    8f1 <printf+0xb1>
+ 9e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9e5:	bb 1b 0f 00 00       	mov    $0xf1b,%ebx
+ 9ea:	e9 61 ff ff ff       	jmp    950 <printf+0x110>
+ 9ef:	90                   	nop
+
+000009f0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 9f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9f1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 9f4:	89 e5                	mov    %esp,%ebp
+ 9f6:	57                   	push   %edi
+ 9f7:	56                   	push   %esi
+ 9f8:	53                   	push   %ebx
+ 9f9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9fb:	a1 44 d6 03 00       	mov    0x3d644,%eax
+ a00:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a02:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a04:	39 ca                	cmp    %ecx,%edx
+ a06:	73 30                	jae    a38 <ufree+0x48>
+ a08:	39 c1                	cmp    %eax,%ecx
+ a0a:	72 04                	jb     a10 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0c:	39 c2                	cmp    %eax,%edx
+ a0e:	72 f0                	jb     a00 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a10:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a13:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a16:	39 f8                	cmp    %edi,%eax
+ a18:	74 26                	je     a40 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a1d:	8b 42 04             	mov    0x4(%edx),%eax
+ a20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a23:	39 f1                	cmp    %esi,%ecx
+ a25:	74 30                	je     a57 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a27:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a29:	5b                   	pop    %ebx
+  freep = p;
+ a2a:	89 15 44 d6 03 00    	mov    %edx,0x3d644
+}
+ a30:	5e                   	pop    %esi
+ a31:	5f                   	pop    %edi
+ a32:	5d                   	pop    %ebp
+ a33:	c3                   	ret
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a38:	39 c1                	cmp    %eax,%ecx
+ a3a:	72 d0                	jb     a0c <ufree+0x1c>
+ a3c:	eb c2                	jmp    a00 <ufree+0x10>
+ a3e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 70 04             	add    0x4(%eax),%esi
+ a43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a4d:	8b 42 04             	mov    0x4(%edx),%eax
+ a50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a53:	39 f1                	cmp    %esi,%ecx
+ a55:	75 d0                	jne    a27 <ufree+0x37>
+    p->s.size += bp->s.size;
+ a57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a5a:	89 15 44 d6 03 00    	mov    %edx,0x3d644
+    p->s.size += bp->s.size;
+ a60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a66:	89 0a                	mov    %ecx,(%edx)
+}
+ a68:	5b                   	pop    %ebx
+ a69:	5e                   	pop    %esi
+ a6a:	5f                   	pop    %edi
+ a6b:	5d                   	pop    %ebp
+ a6c:	c3                   	ret
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	53                   	push   %ebx
+ a74:	83 ec 10             	sub    $0x10,%esp
+ a77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ a7a:	68 40 d6 03 00       	push   $0x3d640
+ a7f:	e8 ec 01 00 00       	call   c70 <lock_acquire>
+  ufree(ap);
+ a84:	89 d8                	mov    %ebx,%eax
+ a86:	e8 65 ff ff ff       	call   9f0 <ufree>
+  lock_release(&mlock);
+ a8b:	c7 45 08 40 d6 03 00 	movl   $0x3d640,0x8(%ebp)
+}
+ a92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ a95:	83 c4 10             	add    $0x10,%esp
+}
+ a98:	c9                   	leave
+  lock_release(&mlock);
+ a99:	e9 f2 01 00 00       	jmp    c90 <lock_release>
+ a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ aac:	68 40 d6 03 00       	push   $0x3d640
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ab1:	8d 48 07             	lea    0x7(%eax),%ecx
+ ab4:	c1 e9 03             	shr    $0x3,%ecx
+ ab7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ aba:	e8 b1 01 00 00       	call   c70 <lock_acquire>
+  if((prevp = freep) == 0){
+ abf:	8b 15 44 d6 03 00    	mov    0x3d644,%edx
+ ac5:	83 c4 10             	add    $0x10,%esp
+ ac8:	85 d2                	test   %edx,%edx
+ aca:	0f 84 b0 00 00 00    	je     b80 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ ad2:	8b 47 04             	mov    0x4(%edi),%eax
+ ad5:	39 f0                	cmp    %esi,%eax
+ ad7:	73 6f                	jae    b48 <malloc+0xa8>
+  if(nu < 4096)
+ ad9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ade:	39 de                	cmp    %ebx,%esi
+ ae0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ae3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ aea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ aed:	eb 0a                	jmp    af9 <malloc+0x59>
+ aef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ af2:	8b 47 04             	mov    0x4(%edi),%eax
+ af5:	39 f0                	cmp    %esi,%eax
+ af7:	73 4f                	jae    b48 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ af9:	89 fa                	mov    %edi,%edx
+ afb:	39 3d 44 d6 03 00    	cmp    %edi,0x3d644
+ b01:	75 ed                	jne    af0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	ff 75 e4             	push   -0x1c(%ebp)
+ b09:	e8 ad fb ff ff       	call   6bb <sbrk>
+  if(p == (char*)-1)
+ b0e:	83 c4 10             	add    $0x10,%esp
+ b11:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b14:	74 15                	je     b2b <malloc+0x8b>
+  hp->s.size = nu;
+ b16:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ b19:	83 c0 08             	add    $0x8,%eax
+ b1c:	e8 cf fe ff ff       	call   9f0 <ufree>
+  return freep;
+ b21:	8b 15 44 d6 03 00    	mov    0x3d644,%edx
+      if((p = morecore(nunits)) == 0){
+ b27:	85 d2                	test   %edx,%edx
+ b29:	75 c5                	jne    af0 <malloc+0x50>
+        lock_release(&mlock);
+ b2b:	83 ec 0c             	sub    $0xc,%esp
+ b2e:	68 40 d6 03 00       	push   $0x3d640
+ b33:	e8 58 01 00 00       	call   c90 <lock_release>
+        return 0;
+ b38:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b3e:	31 c0                	xor    %eax,%eax
+}
+ b40:	5b                   	pop    %ebx
+ b41:	5e                   	pop    %esi
+ b42:	5f                   	pop    %edi
+ b43:	5d                   	pop    %ebp
+ b44:	c3                   	ret
+ b45:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b48:	39 c6                	cmp    %eax,%esi
+ b4a:	74 64                	je     bb0 <malloc+0x110>
+        p->s.size -= nunits;
+ b4c:	29 f0                	sub    %esi,%eax
+ b4e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ b51:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ b54:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ b57:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ b5a:	89 15 44 d6 03 00    	mov    %edx,0x3d644
+      lock_release(&mlock);
+ b60:	68 40 d6 03 00       	push   $0x3d640
+ b65:	e8 26 01 00 00       	call   c90 <lock_release>
+      return (void*)(p + 1);
+ b6a:	83 c4 10             	add    $0x10,%esp
+}
+ b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b70:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ b73:	5b                   	pop    %ebx
+ b74:	5e                   	pop    %esi
+ b75:	5f                   	pop    %edi
+ b76:	5d                   	pop    %ebp
+ b77:	c3                   	ret
+ b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ b80:	c7 05 44 d6 03 00 48 	movl   $0x3d648,0x3d644
+ b87:	d6 03 00 
+    base.s.size = 0;
+ b8a:	bf 48 d6 03 00       	mov    $0x3d648,%edi
+    base.s.ptr = freep = prevp = &base;
+ b8f:	c7 05 48 d6 03 00 48 	movl   $0x3d648,0x3d648
+ b96:	d6 03 00 
+    base.s.size = 0;
+ b99:	c7 05 4c d6 03 00 00 	movl   $0x0,0x3d64c
+ ba0:	00 00 00 
+    if(p->s.size >= nunits){
+ ba3:	e9 31 ff ff ff       	jmp    ad9 <malloc+0x39>
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bb0:	8b 07                	mov    (%edi),%eax
+ bb2:	89 02                	mov    %eax,(%edx)
+ bb4:	eb a1                	jmp    b57 <malloc+0xb7>
+ bb6:	66 90                	xchg   %ax,%ax
+ bb8:	66 90                	xchg   %ax,%ax
+ bba:	66 90                	xchg   %ax,%ax
+ bbc:	66 90                	xchg   %ax,%ax
+ bbe:	66 90                	xchg   %ax,%ax
+
+00000bc0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	53                   	push   %ebx
+ bc4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ bc7:	68 00 10 00 00       	push   $0x1000
+ bcc:	e8 cf fe ff ff       	call   aa0 <malloc>
+ bd1:	83 c4 10             	add    $0x10,%esp
+ bd4:	85 c0                	test   %eax,%eax
+ bd6:	74 37                	je     c0f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ bd8:	83 ec 04             	sub    $0x4,%esp
+ bdb:	89 c3                	mov    %eax,%ebx
+ bdd:	50                   	push   %eax
+ bde:	ff 75 0c             	push   0xc(%ebp)
+ be1:	ff 75 08             	push   0x8(%ebp)
+ be4:	e8 0a fb ff ff       	call   6f3 <clone>
+ be9:	83 c4 10             	add    $0x10,%esp
+ bec:	85 c0                	test   %eax,%eax
+ bee:	78 08                	js     bf8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ bf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ bf3:	c9                   	leave
+ bf4:	c3                   	ret
+ bf5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ bf8:	83 ec 0c             	sub    $0xc,%esp
+ bfb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bfe:	53                   	push   %ebx
+ bff:	e8 6c fe ff ff       	call   a70 <free>
+ c04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ c07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ c0a:	83 c4 10             	add    $0x10,%esp
+}
+ c0d:	c9                   	leave
+ c0e:	c3                   	ret
+    return -1;
+ c0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c14:	eb da                	jmp    bf0 <thread_create+0x30>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c20 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ c26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ c29:	50                   	push   %eax
+ c2a:	e8 cc fa ff ff       	call   6fb <join>
+ c2f:	83 c4 10             	add    $0x10,%esp
+ c32:	85 c0                	test   %eax,%eax
+ c34:	79 0a                	jns    c40 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ c36:	c9                   	leave
+ c37:	c3                   	ret
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+ c40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ c43:	83 ec 0c             	sub    $0xc,%esp
+ c46:	ff 75 f4             	push   -0xc(%ebp)
+ c49:	e8 22 fe ff ff       	call   a70 <free>
+ c4e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c51:	83 c4 10             	add    $0x10,%esp
+}
+ c54:	c9                   	leave
+ c55:	c3                   	ret
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ c63:	8b 45 08             	mov    0x8(%ebp),%eax
+ c66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c6c:	5d                   	pop    %ebp
+ c6d:	c3                   	ret
+ c6e:	66 90                	xchg   %ax,%ax
+
+00000c70 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ c70:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c71:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c76:	89 e5                	mov    %esp,%ebp
+ c78:	8b 55 08             	mov    0x8(%ebp),%edx
+ c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+ c80:	89 c8                	mov    %ecx,%eax
+ c82:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ c85:	85 c0                	test   %eax,%eax
+ c87:	75 f7                	jne    c80 <lock_acquire+0x10>
+    ;
+}
+ c89:	5d                   	pop    %ebp
+ c8a:	c3                   	ret
+ c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+
+00000c90 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ c90:	55                   	push   %ebp
+ c91:	31 c0                	xor    %eax,%eax
+ c93:	89 e5                	mov    %esp,%ebp
+ c95:	8b 55 08             	mov    0x8(%ebp),%edx
+ c98:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ c9b:	5d                   	pop    %ebp
+ c9c:	c3                   	ret
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ca0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ ca3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cac:	5d                   	pop    %ebp
+ cad:	c3                   	ret
+ cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ cb0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ cb1:	31 c0                	xor    %eax,%eax
+ cb3:	ba 01 00 00 00       	mov    $0x1,%edx
+ cb8:	89 e5                	mov    %esp,%ebp
+ cba:	56                   	push   %esi
+ cbb:	53                   	push   %ebx
+ cbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cbf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ cc3:	85 c0                	test   %eax,%eax
+ cc5:	74 30                	je     cf7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ cc7:	83 f8 02             	cmp    $0x2,%eax
+ cca:	74 0c                	je     cd8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ ccc:	b8 02 00 00 00       	mov    $0x2,%eax
+ cd1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ cd4:	85 c0                	test   %eax,%eax
+ cd6:	74 1f                	je     cf7 <mutex_lock+0x47>
+ cd8:	be 02 00 00 00       	mov    $0x2,%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ ce0:	83 ec 08             	sub    $0x8,%esp
+ ce3:	6a 02                	push   $0x2
+ ce5:	53                   	push   %ebx
+ ce6:	e8 18 fa ff ff       	call   703 <futex_wait>
+ ceb:	89 f0                	mov    %esi,%eax
+ ced:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ cf0:	83 c4 10             	add    $0x10,%esp
+ cf3:	85 c0                	test   %eax,%eax
+ cf5:	75 e9                	jne    ce0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ cf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cfa:	5b                   	pop    %ebx
+ cfb:	5e                   	pop    %esi
+ cfc:	5d                   	pop    %ebp
+ cfd:	c3                   	ret
+ cfe:	66 90                	xchg   %ax,%ax
+
+00000d00 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ d00:	55                   	push   %ebp
+ d01:	31 c0                	xor    %eax,%eax
+ d03:	89 e5                	mov    %esp,%ebp
+ d05:	83 ec 08             	sub    $0x8,%esp
+ d08:	8b 55 08             	mov    0x8(%ebp),%edx
+ d0b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ d0e:	83 f8 02             	cmp    $0x2,%eax
+ d11:	74 05                	je     d18 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ d13:	c9                   	leave
+ d14:	c3                   	ret
+ d15:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ d18:	83 ec 08             	sub    $0x8,%esp
+ d1b:	6a 01                	push   $0x1
+ d1d:	52                   	push   %edx
+ d1e:	e8 e8 f9 ff ff       	call   70b <futex_wake>
+ d23:	83 c4 10             	add    $0x10,%esp
+}
+ d26:	c9                   	leave
+ d27:	c3                   	ret
+ d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+
+00000d30 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ d36:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ d3c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d43:	5d                   	pop    %ebp
+ d44:	c3                   	ret
+ d45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	57                   	push   %edi
+ d54:	56                   	push   %esi
+ d55:	53                   	push   %ebx
+ d56:	83 ec 0c             	sub    $0xc,%esp
+ d59:	8b 75 08             	mov    0x8(%ebp),%esi
+ d5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ d5f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ d64:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ d66:	8b 3e                	mov    (%esi),%edi
+ d68:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ d6b:	83 f8 02             	cmp    $0x2,%eax
+ d6e:	74 60                	je     dd0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ d70:	83 ec 08             	sub    $0x8,%esp
+ d73:	57                   	push   %edi
+ d74:	56                   	push   %esi
+ d75:	e8 89 f9 ff ff       	call   703 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ d7a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ d7f:	31 c0                	xor    %eax,%eax
+ d81:	ba 01 00 00 00       	mov    $0x1,%edx
+ d86:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ d8a:	83 c4 10             	add    $0x10,%esp
+ d8d:	85 c0                	test   %eax,%eax
+ d8f:	74 36                	je     dc7 <cond_wait+0x77>
+  if(c != 2)
+ d91:	83 f8 02             	cmp    $0x2,%eax
+ d94:	74 0c                	je     da2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ d96:	b8 02 00 00 00       	mov    $0x2,%eax
+ d9b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ d9e:	85 c0                	test   %eax,%eax
+ da0:	74 25                	je     dc7 <cond_wait+0x77>
+ da2:	be 02 00 00 00       	mov    $0x2,%esi
+ da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dae:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ db0:	83 ec 08             	sub    $0x8,%esp
+ db3:	6a 02                	push   $0x2
+ db5:	53                   	push   %ebx
+ db6:	e8 48 f9 ff ff       	call   703 <futex_wait>
+ dbb:	89 f0                	mov    %esi,%eax
+ dbd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ dc0:	83 c4 10             	add    $0x10,%esp
+ dc3:	85 c0                	test   %eax,%eax
+ dc5:	75 e9                	jne    db0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dca:	5b                   	pop    %ebx
+ dcb:	5e                   	pop    %esi
+ dcc:	5f                   	pop    %edi
+ dcd:	5d                   	pop    %ebp
+ dce:	c3                   	ret
+ dcf:	90                   	nop
+    futex_wake(&m->val, 1);
+ dd0:	83 ec 08             	sub    $0x8,%esp
+ dd3:	6a 01                	push   $0x1
+ dd5:	53                   	push   %ebx
+ dd6:	e8 30 f9 ff ff       	call   70b <futex_wake>
+ ddb:	83 c4 10             	add    $0x10,%esp
+ dde:	eb 90                	jmp    d70 <cond_wait+0x20>
+
+00000de0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	83 ec 08             	sub    $0x8,%esp
+ de6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ de9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ ded:	8b 50 04             	mov    0x4(%eax),%edx
+ df0:	85 d2                	test   %edx,%edx
+ df2:	75 0c                	jne    e00 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ df4:	c9                   	leave
+ df5:	c3                   	ret
+ df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ e00:	83 ec 08             	sub    $0x8,%esp
+ e03:	6a 01                	push   $0x1
+ e05:	50                   	push   %eax
+ e06:	e8 00 f9 ff ff       	call   70b <futex_wake>
+ e0b:	83 c4 10             	add    $0x10,%esp
+}
+ e0e:	c9                   	leave
+ e0f:	c3                   	ret
+
+00000e10 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e10:	55                   	push   %ebp
+ e11:	89 e5                	mov    %esp,%ebp
+ e13:	83 ec 08             	sub    $0x8,%esp
+ e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ e19:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ e1d:	8b 50 04             	mov    0x4(%eax),%edx
+ e20:	85 d2                	test   %edx,%edx
+ e22:	75 0c                	jne    e30 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ e24:	c9                   	leave
+ e25:	c3                   	ret
+ e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ e30:	83 ec 08             	sub    $0x8,%esp
+ e33:	68 ff ff ff 7f       	push   $0x7fffffff
+ e38:	50                   	push   %eax
+ e39:	e8 cd f8 ff ff       	call   70b <futex_wake>
+ e3e:	83 c4 10             	add    $0x10,%esp
+}
+ e41:	c9                   	leave
+ e42:	c3                   	ret
@@ -0,0 +1,137 @@
+// Pipe pipeline throughput, like cat | grep | wc:
+// the first stage writes kbytes of data, each middle stage
+// copies its input to its output, and the last one reads it.
+// usage: pipebench [-n stages] [-k kbytes] [-c cpumask]
+// With -c every stage is pinned to the CPUs in cpumask,
+// e.g. 1 to compare against running the whole pipeline on
+// one CPU.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+#include "time.h"
+
+#define BUFSZ 512
+
+char buf[BUFSZ];
+struct procinfo pi[NPROC];
+
+static uint
+msecs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+// Once every stage, each a child of ours, has exited,
+// print where it ran and how often it switched.
+static void
+stages(int nstage)
+{
+  int i, n, pid, nzombie;
+
+  pid = getpid();
+  do {
+    sleep(1);
+    n = getprocinfo(pi, NPROC);
+    nzombie = 0;
+    for(i = 0; i < n; i++)
+      if(pi[i].ppid == pid && pi[i].state == PS_ZOMBIE)
+        nzombie++;
+  } while(nzombie < nstage);
+  for(i = 0; i < n; i++)
+    if(pi[i].ppid == pid)
+      printf(1, "  pid %d: cpu %d vcsw %d ivcsw %d\n",
+             pi[i].pid, pi[i].cpu, pi[i].nvcsw, pi[i].nivcsw);
+}
+
+// Run one stage: generate data if in < 0, else copy in to
+// out, or just consume it if out < 0.  The last stage,
+// which sees the end of the data, reports the throughput.
+static void
+stage(int in, int out, int kbytes, int nstage, uint t0)
+{
+  int n, total;
+  uint ms;
+
+  if(in < 0){
+    for(total = 0; total < kbytes*1024; total += BUFSZ)
+      if(write(out, buf, BUFSZ) != BUFSZ){
+        printf(2, "pipebench: write failed\n");
+        break;
+      }
+    exit();
+  }
+  total = 0;
+  while((n = read(in, buf, sizeof(buf))) > 0){
+    total += n;
+    if(out >= 0 && write(out, buf, n) != n){
+      printf(2, "pipebench: write failed\n");
+      break;
+    }
+  }
+  if(out < 0){
+    ms = msecs() - t0;
+    printf(1, "%d stages, %d KB in %d ms: %d KB/s\n", nstage,
+           total/1024, ms, ms ? total/ms*1000/1024 : 0);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, nstage, kbytes, mask, in, fd[2];
+  uint t0;
+
+  nstage = 3;
+  kbytes = 1024;
+  mask = 0;
+  for(i = 1; i+1 < argc; i += 2){
+    if(strcmp(argv[i], "-n") == 0)
+      nstage = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-k") == 0)
+      kbytes = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-c") == 0)
+      mask = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || nstage < 2 || kbytes <= 0){
+    printf(2, "usage: pipebench [-n stages] [-k kbytes] [-c cpumask]\n");
+    exit();
+  }
+  if(mask && sched_setaffinity(0, mask) < 0){
+    printf(2, "pipebench: bad cpumask %d\n", mask);
+    exit();
+  }
+
+  t0 = msecs();
+  in = -1;
+  for(i = 0; i < nstage; i++){
+    if(i < nstage-1 && pipe(fd) < 0){
+      printf(2, "pipebench: pipe failed\n");
+      exit();
+    }
+    if(i == nstage-1)
+      fd[0] = fd[1] = -1;
+    if(fork() == 0){
+      if(fd[0] >= 0)
+        close(fd[0]);
+      stage(in, fd[1], kbytes, nstage, t0);
+    }
+    if(in >= 0)
+      close(in);
+    if(fd[1] >= 0)
+      close(fd[1]);
+    in = fd[0];
+  }
+  stages(nstage);
+  while(wait() >= 0)
+    ;
+  exit();
+}
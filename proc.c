@@ -4,57 +4,330 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
 #include "spinlock.h"
-
+#include "proc.h"
+#include "sleeplock.h"
+#include "vm.h"
+#include "traps.h"
+#include "pstat.h"
+#include "wait.h"
+#include "trace.h"
+#include "work.h"
+
+#define NPIDHASH 256
+#define PIDHASH(pid) ((pid) & (NPIDHASH-1))
+
+// Procs are carved out of kalloc'ed pages as needed, up to
+// NPROC of them, and are never freed: an unused proc goes on
+// the free list for allocproc to reuse.  That pins at most
+// NPROC/(PGSIZE/sizeof(struct proc)) pages, about 1.3MB at
+// NPROC 4096, and only after that many procs were in use at
+// once.  In return a struct proc pointer stays a struct proc,
+// even if its process is gone, so ptable.used, the procs in
+// use, can be walked without a lock: a proc taken off it
+// keeps its next pointer, and one put back on starts over
+// from the head.  Walkers never see the unused procs a burst
+// of forks leaves behind.
+//
+// Locking.  p->lock protects p's state, chan, killed, cpumask,
+// parent and vm, and is held across the swtch into and out of
+// p.  It also protects p's children list and their
+// sibling links, so a parent can't miss a child's exit: the
+// child goes ZOMBIE holding its parent's lock, and a parent
+// that exits hands its children to initproc holding both
+// their locks.  ptable.lock protects only the free and used
+// lists, the pid hash and the carving of new procs, and
+// vmtable.lock the vm free list.  A CPU's timerlock protects
+// its list of timed sleepers and their wakeat and timernext,
+// and is never held with another lock.  nextpid is an atomic
+// counter.  The lock order is
+//   vm->lock, initproc->lock, a parent's p->lock,
+//   its children's, ptable.lock, vmtable.lock
+// and the lock a caller passes to sleep() comes before
+// p->lock.  To lock a proc found through the pid hash, drop
+// ptable.lock first and check p->pid again (see lockproc).
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  // The rest starts a line of its own, away from the lock.
+  struct proc *used CACHEALIGN;     // Procs in use, newest first
+  struct proc *free;                // Unused procs, linked by nextfree
+  struct proc *pidhash[NPIDHASH];   // Procs in use by pid
+  int nproc;                        // Procs carved so far
 } ptable;
 
-static struct proc *initproc;
+// Address spaces, carved out of kalloc'ed pages like procs
+// and never freed.  There is at most one per proc, plus one
+// for each exec in progress.
+struct {
+  struct spinlock lock;
+  struct vm *free;
+} vmtable;
+
+// Protects the check-and-sleep in futexwait against futexwake.
+static struct spinlock futexlock;
 
-int nextpid = 1;
+static struct proc *initproc;
+extern pde_t *kpgdir;
+
+// How long a process woken by wakeupsync() waits for the
+// waker's CPU, whose cache holds the data it was woken for,
+// before other CPUs may take it.
+#define HOTNS 1000000
+
+// CPUs kept out of general scheduling: they only run processes
+// whose affinity mask lies entirely within isolcpus.
+static uint isolcpus;
+
+// Earliest-deadline-first real-time scheduling.  A process
+// that declares a runtime, deadline and period gets its
+// runtime in every period before the deadline, as long as
+// the real-time processes together reserve no more than
+// EDFMAX of each CPU.  A real-time process either may run on
+// all non-isolated CPUs, and reserves from them together, or
+// is pinned to one CPU and reserves from that one alone;
+// other masks would leave the reservations unchecked, so
+// setdeadline and setaffinity refuse them.  The scheduler
+// runs the runnable real-time process with the earliest
+// deadline ahead of everything else, and one that uses up
+// its runtime waits for its next period, so it can't starve
+// the rest.
+#define EDFUNIT 65536               // all of one CPU
+#define EDFMAX  (EDFUNIT*95/100)    // most that may be reserved per CPU
+
+static uint edfbw;          // reserved on all non-isolated CPUs; under ptable.lock
+static uint edfcpubw[NCPU]; // reserved on each CPU alone; under ptable.lock
+static int nedf;            // real-time processes; under ptable.lock, read without
+
+int nextpid = 1;  // only changed by xadd
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static void wakeparent(struct proc*);
+static void wakecpu(struct proc*);
+static int wakeupn(void*, int, int);
+static uint allcpus(void);
+static int canrun(struct proc*, int);
+static int hotelsewhere(struct proc*, int);
+static void edfpreempt(struct proc*);
+static int edfcpu(uint);
+static void edfcharge(int, int);
+static int edfmove(int, int, int, int);
+static void idle(void);
 
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct cpu *c;
+
+  initlockkind(&ptable.lock, "ptable", LOCK_MCS);
+  initlock(&vmtable.lock, "vmtable");
+  initlock(&futexlock, "futex");
+  for(c = cpus; c < cpus+NCPU; c++)
+    initlock(&c->timerlock, "timer");
 }
 
-//PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
-// Otherwise return 0.
+// Take an unused proc from the free list, carving a new
+// page of them if it is empty, and enter it in the pid hash
+// and on the used list as an EMBRYO.  Return 0 if there are
+// NPROC procs in use.
+// The ptable lock must be held.
 static struct proc*
-allocproc(void)
+getproc(int pid)
 {
   struct proc *p;
-  char *sp;
+  char *mem;
+  int i;
 
+  if(ptable.free == 0){
+    if(ptable.nproc + PGSIZE/sizeof(*p) > NPROC || (mem = kalloc()) == 0)
+      return 0;
+    memset(mem, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*p); i++){
+      p = (struct proc*)mem + i;
+      initlock(&p->lock, "proc");
+      p->nextfree = ptable.free;
+      ptable.free = p;
+    }
+    ptable.nproc += PGSIZE/sizeof(*p);
+  }
+  p = ptable.free;
+  ptable.free = p->nextfree;
+  p->nextfree = 0;
+
+  p->state = EMBRYO;
+  p->pid = pid;
+  p->hashnext = ptable.pidhash[PIDHASH(pid)];
+  ptable.pidhash[PIDHASH(pid)] = p;
+
+  p->prev = 0;
+  p->next = ptable.used;
+  if(ptable.used)
+    ptable.used->prev = p;
+  // Lock-free walkers must see p's next pointer before p.
+  __sync_synchronize();
+  ptable.used = p;
+  return p;
+}
+
+// Mark p UNUSED, take it out of the pid hash and off
+// the used list, give back any real-time reservation, and
+// return it to the free list.  A walker on p carries on
+// down the used list, since p keeps its next pointer until
+// getproc reuses it.
+// The ptable lock must be held.
+static void
+putproc(struct proc *p)
+{
+  struct proc **pp;
+
+  if(p->dlruntime){
+    edfcharge(p->dlcpu, -p->dlbw);
+    nedf--;
+    p->dlruntime = 0;
+    p->dlbw = 0;
+  }
+
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->hashnext){
+    if(*pp == p){
+      *pp = p->hashnext;
+      break;
+    }
+  }
+  p->hashnext = 0;
+  p->pid = 0;
+  p->state = UNUSED;
+
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    ptable.used = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  p->nextfree = ptable.free;
+  ptable.free = p;
+}
+
+// Look up a process in use by pid.
+// The ptable lock must be held.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->hashnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Give back a proc from getproc that never ran.
+static void
+dropproc(struct proc *p)
+{
+  acquire(&p->lock);
+  p->killed = 0;
   acquire(&ptable.lock);
+  putproc(p);
+  release(&ptable.lock);
+  release(&p->lock);
+}
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
+// Find process pid and return it locked, or return 0.
+static struct proc*
+lockproc(int pid)
+{
+  struct proc *p;
 
+  acquire(&ptable.lock);
+  p = findproc(pid);
   release(&ptable.lock);
-  return 0;
+  if(p == 0)
+    return 0;
+  acquire(&p->lock);
+  if(p->pid != pid){
+    // It exited and p was reused while we weren't looking.
+    release(&p->lock);
+    return 0;
+  }
+  return p;
+}
 
-found:
-  p->state = EMBRYO;
-  p->pid = nextpid++;
+// Make an address space of sz bytes mapped by pgdir, with
+// one reference.  Return 0 if out of memory.
+static struct vm*
+allocvm(pde_t *pgdir, uint sz)
+{
+  struct vm *vm;
+  char *mem;
+  int i;
+
+  acquire(&vmtable.lock);
+  if(vmtable.free == 0){
+    if((mem = kalloc()) == 0){
+      release(&vmtable.lock);
+      return 0;
+    }
+    memset(mem, 0, PGSIZE);
+    for(i = 0; i < PGSIZE/sizeof(*vm); i++){
+      vm = (struct vm*)mem + i;
+      initsleeplock(&vm->lock, "vm");
+      vm->nextfree = vmtable.free;
+      vmtable.free = vm;
+    }
+  }
+  vm = vmtable.free;
+  vmtable.free = vm->nextfree;
+  release(&vmtable.lock);
+
+  vm->nextfree = 0;
+  vm->ref = 1;
+  vm->pgdir = pgdir;
+  vm->sz = sz;
+  return vm;
+}
+
+// Drop a reference to vm.  If it was the last, return vm's
+// page table for the caller to free with freevm; else 0.
+static pde_t*
+putvm(struct vm *vm)
+{
+  pde_t *pgdir;
 
+  if(xadd(&vm->ref, -1) != 1)
+    return 0;
+  pgdir = vm->pgdir;
+  vm->pgdir = 0;
+  acquire(&vmtable.lock);
+  vm->nextfree = vmtable.free;
+  vmtable.free = vm;
+  release(&vmtable.lock);
+  return pgdir;
+}
+
+//PAGEBREAK: 32
+// Get an unused proc.  If there is one, change its
+// state to EMBRYO and initialize state required to
+// run in the kernel.  Otherwise return 0.
+static struct proc*
+allocproc(void)
+{
+  struct proc *p;
+  char *sp;
+  int pid;
+
+  pid = xadd(&nextpid, 1);
+  acquire(&ptable.lock);
+  p = getproc(pid);
   release(&ptable.lock);
+  if(p == 0)
+    return 0;
+
+  p->utime = p->stime = 0;
+  p->nvcsw = p->nivcsw = p->nsyscall = p->nfault = 0;
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    dropproc(p);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -76,6 +349,47 @@ found:
   return p;
 }
 
+// A kernel thread's first scheduling by scheduler() will swtch
+// here, as though kthreadstart(fn, arg) had been called.
+static void
+kthreadstart(void (*fn)(void*), void *arg)
+{
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
+  fn(arg);
+  panic("kthread return");
+}
+
+// Start a kernel thread, a process with no user half, running
+// fn(arg) on the CPUs in mask.  fn must never return.
+struct proc*
+kthread(char *name, void (*fn)(void*), void *arg, uint mask)
+{
+  struct proc *p;
+  uint *sp;
+
+  if((p = allocproc()) == 0)
+    return 0;
+  p->pgdir = kpgdir;
+  p->cpumask = mask & allcpus();
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // Where allocproc left forkret's return to trapret, put
+  // kthreadstart's frame: a return address it never uses,
+  // then its arguments.  The trap frame above goes unused.
+  p->context->eip = (uint)kthreadstart;
+  sp = (uint*)(p->context + 1);
+  sp[0] = 0;
+  sp[1] = (uint)fn;
+  sp[2] = (uint)arg;
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;
+  wakecpu(p);
+  release(&p->lock);
+  return p;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -90,7 +404,8 @@ userinit(void)
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
-  p->sz = PGSIZE;
+  if((p->vm = allocvm(p->pgdir, PGSIZE)) == 0)
+    panic("userinit: out of memory?");
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -100,18 +415,21 @@ userinit(void)
   p->tf->esp = PGSIZE;
   p->tf->eip = 0;  // beginning of initcode.S
 
+  p->cpumask = allcpus();
   safestrcpy(p->name, "initcode", sizeof(p->name));
-  p->cwd = namei("/");
+  if((p->fdt = fdtablealloc(namei("/"))) == 0)
+    panic("userinit: out of memory?");
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
   p->state = RUNNABLE;
+  wakecpu(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -119,18 +437,27 @@ userinit(void)
 int
 growproc(int n)
 {
+  struct vm *vm;
   uint sz;
 
-  sz = proc->sz;
+  vm = proc->vm;
+  acquiresleep(&vm->lock);
+  sz = vm->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(vm->pgdir, sz, sz + n)) == 0){
+      releasesleep(&vm->lock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if((sz = shrinkuvm(vm->pgdir, sz, sz + n)) == 0){
+      releasesleep(&vm->lock);
       return -1;
+    }
   }
-  proc->sz = sz;
+  // Threads share vm, so they all see the new size.
+  vm->sz = sz;
   switchuvm(proc);
+  releasesleep(&vm->lock);
   return 0;
 }
 
@@ -140,132 +467,374 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
+  struct vm *vm;
+  pde_t *pgdir;
+  uint sz;
 
   // Allocate process.
   if((np = allocproc()) == 0){
     return -1;
   }
 
-  // Copy process state from p.
-  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+  // Copy process state from p, holding off threads' sbrk.
+  vm = proc->vm;
+  acquiresleep(&vm->lock);
+  sz = vm->sz;
+  pgdir = copyuvm(vm->pgdir, sz);
+  releasesleep(&vm->lock);
+  if(pgdir == 0 || (np->vm = allocvm(pgdir, sz)) == 0 ||
+     (np->fdt = fdtablecopy(proc->fdt)) == 0){
+    if(np->vm){
+      putvm(np->vm);  // the last reference; pgdir is freed below
+      np->vm = 0;
+    }
+    if(pgdir)
+      freevm(pgdir);
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    dropproc(np);
     return -1;
   }
-  np->sz = proc->sz;
-  np->parent = proc;
+  np->pgdir = pgdir;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(proc->ofile[i])
-      np->ofile[i] = filedup(proc->ofile[i]);
-  np->cwd = idup(proc->cwd);
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+  np->cpumask = proc->cpumask;
+
+  pid = np->pid;
+
+  acquire(&proc->lock);
+  acquire(&np->lock);
+  np->parent = proc;
+  np->sibling = proc->children;
+  proc->children = np;
+  release(&proc->lock);
+  np->state = RUNNABLE;
+  wakecpu(np);
+  release(&np->lock);
+
+  return pid;
+}
+
+// Create a thread that shares the current process's address
+// space, open files and cwd, and runs fn(arg) on the one-page
+// user stack at stack.  fn must not return; the thread ends
+// with exit().
+int
+clone(void (*fn)(void*), void *arg, void *stack)
+{
+  int pid;
+  struct proc *np;
+  uint sp, ustack[2];
+
+  if((uint)stack + PGSIZE > proc->vm->sz || (uint)stack + PGSIZE < (uint)stack)
+    return -1;
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = (uint)arg;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(proc->pgdir, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  np->ustack = stack;
+  *np->tf = *proc->tf;
+  np->tf->eip = (uint)fn;
+  np->tf->esp = sp;
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
+  np->cpumask = proc->cpumask;
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  xadd(&proc->vm->ref, 1);
+  np->vm = proc->vm;
+  np->pgdir = proc->pgdir;
+  np->fdt = fdtabledup(proc->fdt);
 
+  acquire(&proc->lock);
+  acquire(&np->lock);
+  np->parent = proc;
+  np->sibling = proc->children;
+  proc->children = np;
+  release(&proc->lock);
   np->state = RUNNABLE;
-
-  release(&ptable.lock);
+  wakecpu(np);
+  release(&np->lock);
 
   return pid;
 }
 
+// Switch the current process, which has just exec'ed, to a
+// new address space of sz bytes mapped by pgdir, and free
+// the old one unless its threads are still using it.
+// Return -1, leaving the process as it was, if out of memory.
+int
+execvm(pde_t *pgdir, uint sz)
+{
+  struct vm *vm, *old;
+
+  if((vm = allocvm(pgdir, sz)) == 0)
+    return -1;
+  acquire(&proc->lock);
+  old = proc->vm;
+  proc->vm = vm;
+  proc->pgdir = pgdir;
+  release(&proc->lock);
+  switchuvm(proc);
+  if((pgdir = putvm(old)) != 0)
+    freevm(pgdir);
+  return 0;
+}
+
+// Memory of a reaped process, for a worker to free.
+// It lives at the bottom of the dead process's kernel
+// stack, the last thing freed.
+struct reapwork {
+  struct work work;
+  pde_t *pgdir;     // 0 if other threads still use it
+};
+
+static void
+freereaped(void *arg)
+{
+  struct reapwork *r;
+
+  r = arg;
+  if(r->pgdir)
+    freevm(r->pgdir);
+  kfree((char*)r);
+}
+
+// Mark a zombie UNUSED, and return work that frees its
+// kernel stack and address space, for the caller to queue
+// once it has dropped its locks.  The address space
+// survives while other threads use it.
+// The locks of p and its parent must be held.
+static struct work*
+freeproc(struct proc *p)
+{
+  struct reapwork *r;
+
+  r = (struct reapwork*)p->kstack;
+  r->work.fn = freereaped;
+  r->work.arg = r;
+  r->pgdir = putvm(p->vm);
+  p->kstack = 0;
+  p->vm = 0;
+  p->pgdir = 0;
+  p->parent = 0;
+  p->sibling = 0;
+  p->ustack = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  acquire(&ptable.lock);
+  putproc(p);
+  release(&ptable.lock);
+  return &r->work;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
 void
 exit(void)
 {
-  struct proc *p;
-  int fd;
+  struct proc *p, *parent;
 
   if(proc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd]){
-      fileclose(proc->ofile[fd]);
-      proc->ofile[fd] = 0;
-    }
-  }
-
-  begin_op();
-  iput(proc->cwd);
-  end_op();
-  proc->cwd = 0;
-
-  acquire(&ptable.lock);
-
-  // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
-
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == proc){
+  // Close all open files, unless other threads share them.
+  fdtableput(proc->fdt);
+  proc->fdt = 0;
+
+  // Pass abandoned children to init.  Only we change our
+  // children list, but a child going ZOMBIE reads its parent
+  // under our lock.
+  if(proc->children){
+    acquire(&initproc->lock);
+    acquire(&proc->lock);
+    for(p = proc->children; ; p = p->sibling){
+      acquire(&p->lock);
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeparent(initproc);
+      release(&p->lock);
+      if(p->sibling == 0)
+        break;
     }
+    p->sibling = initproc->children;
+    initproc->children = proc->children;
+    proc->children = 0;
+    release(&proc->lock);
+    release(&initproc->lock);
   }
 
-  // Jump into the scheduler, never to return.
+  // Go ZOMBIE holding our parent's lock, so that it either
+  // finds us in its next scan or is asleep in wait() and gets
+  // woken.  If it has handed us to init by the time we have
+  // its lock, try again with init.
+  for(;;){
+    parent = proc->parent;
+    acquire(&parent->lock);
+    if(proc->parent == parent)
+      break;
+    release(&parent->lock);
+  }
+  acquire(&proc->lock);
   proc->state = ZOMBIE;
+  wakeparent(parent);
+  release(&parent->lock);
+
+  // Jump into the scheduler, never to return.  The
+  // parent can't free us until the scheduler releases
+  // proc->lock after switching away.
   sched();
   panic("zombie exit");
 }
 
-// Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
-int
-wait(void)
+// Collect an exited child of the current process: a thread
+// made by clone if threads is set, else a forked process.
+// pid -1 matches any such child.  Return the child's pid,
+// storing a thread's user stack in *stack; or 0 if WNOHANG
+// is in options and no matching child has exited yet;
+// or -1 if there are no matching children.
+static int
+reap(int pid, int options, int threads, void **stack)
 {
-  struct proc *p;
-  int havekids, pid;
+  struct proc *p, **pp;
+  struct work *w;
+  int havekids;
 
-  acquire(&ptable.lock);
+  acquire(&proc->lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through our children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != proc)
+    for(pp = &proc->children; (p = *pp) != 0; pp = &p->sibling){
+      if((p->vm == proc->vm) != threads)
+        continue;
+      if(pid != -1 && p->pid != pid)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Its lock waits out its last swtch.
+        acquire(&p->lock);
+        *pp = p->sibling;
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        release(&ptable.lock);
+        if(stack)
+          *stack = p->ustack;
+        w = freeproc(p);
+        release(&p->lock);
+        release(&proc->lock);
+        queuework(w);
         return pid;
       }
     }
 
     // No point waiting if we don't have any children.
     if(!havekids || proc->killed){
-      release(&ptable.lock);
+      release(&proc->lock);
       return -1;
     }
+    if(options & WNOHANG){
+      release(&proc->lock);
+      return 0;
+    }
+
+    // Wait for children to exit.  (See wakeparent call in exit.)
+    sleep(proc, &proc->lock);  //DOC: wait-sleep
+  }
+}
+
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+// Threads are collected with join instead.
+int
+wait(void)
+{
+  return reap(-1, 0, 0, 0);
+}
+
+// Wait for child process pid (-1 for any) to exit.
+// With WNOHANG, return 0 rather than wait.
+int
+waitpid(int pid, int options)
+{
+  return reap(pid, options, 0, 0);
+}
+
+// Wait for a thread created by clone to exit and return its
+// pid, storing its user stack in *stack for the caller to free.
+// Return -1 if this process has no threads.
+int
+join(void **stack)
+{
+  return reap(-1, 0, 1, stack);
+}
+
+// How scheduler() reports the state a process switched
+// out to in TR_SWITCHOUT events.
+static int tracestate[] = {
+[SLEEPING]  TS_SLEEPING,
+[RUNNABLE]  TS_RUNNABLE,
+[ZOMBIE]    TS_ZOMBIE,
+};
+
+// Switch to p, which the scheduler has locked, and
+// come back when it gives up the CPU.
+static void
+runproc(struct proc *p)
+{
+  // It is the process's job to release p->lock and
+  // then reacquire it before jumping back to us.
+  proc = p;
+  switchuvm(p);
+  p->state = RUNNING;
+  if(p->lastcpu != cpu-cpus)
+    trace(TR_MIGRATE, p->pid, p->lastcpu);
+  trace(TR_SWITCHIN, p->pid, p->lastcpu);
+  p->lastcpu = cpu-cpus;
+  p->hotuntil = 0;
+  if(p->dlruntime){
+    // Interrupt it when its runtime is used up.
+    p->dlstamp = nsecs();
+    clockarm(p->dlstamp + (p->dlused < p->dlruntime ? p->dlruntime - p->dlused : 0));
+  }
+  p->stamp = rdtsc();
+  cpustatinc(CS_CSW);
+  swtch(&cpu->scheduler, p->context);
+  switchkvm();
+  p->stime += rdtsc() - p->stamp;
+  if(p->dlruntime)
+    p->dlused += nsecs() - p->dlstamp;
+  trace(TR_SWITCHOUT, p->pid, tracestate[p->state]);
+
+  // Process is done running for now.
+  // It should have changed its p->state before coming back.
+  proc = 0;
+}
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-    sleep(proc, &ptable.lock);  //DOC: wait-sleep
+// The runnable real-time process with the earliest deadline
+// that cpus[c] may run, or 0.  Looks without locks.
+static struct proc*
+edfpick(int c)
+{
+  struct proc *p, *best;
+
+  best = 0;
+  for(p = ptable.used; p; p = p->next){
+    if(p->dlruntime == 0 || p->state != RUNNABLE || !canrun(p, c))
+      continue;
+    if(best == 0 || p->dl < best->dl)
+      best = p;
   }
+  return best;
 }
 
 //PAGEBREAK: 42
@@ -280,36 +849,87 @@ void
 scheduler(void)
 {
   struct proc *p;
+  int found;
 
   for(;;){
     // Enable interrupts on this processor.
     sti();
+    rcuquiescent();
+
+    // Real-time processes first, earliest deadline first.
+    if(nedf && (p = edfpick(cpu-cpus)) != 0){
+      acquire(&p->lock);
+      if(p->state == RUNNABLE && p->dlruntime && canrun(p, cpu-cpus))
+        runproc(p);
+      release(&p->lock);
+      continue;
+    }
 
     // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    // Peek at each state without the lock, and look again
+    // with it before committing.
+    found = 0;
+    for(p = ptable.used; p; p = p->next){
+      if(p->state != RUNNABLE || p->dlruntime || !canrun(p, cpu-cpus) || hotelsewhere(p, cpu-cpus))
         continue;
+      acquire(&p->lock);
+      if(p->state == RUNNABLE && !p->dlruntime && canrun(p, cpu-cpus) && !hotelsewhere(p, cpu-cpus)){
+        found = 1;
+        runproc(p);
+      }
+      release(&p->lock);
+      // Let a real-time process that has woken meanwhile go first.
+      if(found && nedf && edfpick(cpu-cpus))
+        break;
+    }
+    if(found)
+      continue;
 
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-      swtch(&cpu->scheduler, p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      proc = 0;
+    // Nothing to run.  Announce that we are going idle, then
+    // look once more.  wakecpu() makes a process RUNNABLE
+    // before it reads the idle flags, and xchg orders our
+    // flag before our reads, so either it sees the flag or
+    // we see the process.
+    cli();
+    xchg(&cpu->idle, 1);
+    for(p = ptable.used; p; p = p->next)
+      if(p->state == RUNNABLE && canrun(p, cpu-cpus) && !hotelsewhere(p, cpu-cpus))
+        break;
+    if(p){
+      cpu->idle = 0;
+      continue;
     }
-    release(&ptable.lock);
+    // Idle is quiescent: hand on the RCU callbacks we can.
+    rcuquiescent();
+    idle();
+  }
+}
 
+// Nothing to run: halt until an interrupt.  clockintr() stops
+// the tick while cpu->idle is set, so only a timed wakeup, an
+// IPI from wakecpu(), or a tick kept for RCU gets us going
+// again.
+static void
+idle(void)
+{
+  // wakecpu() clears cpu->idle before sending its IPI.
+  // With interrupts off, either we see the cleared flag or
+  // the IPI stays pending until sti, which delays interrupts
+  // until after the hlt has started.
+  cli();
+  if(cpu->idle){
+    // RCU callbacks queued here wait for our quiescent
+    // states, so keep ticking until they are done.
+    if(rcupending())
+      clockarm(nsecs() + TICKNS);
+    asm volatile("sti; hlt");
   }
+  cli();
+  cpu->idle = 0;
+  clockarm(nsecs() + TICKNS);  // restart the tick
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only proc->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -321,8 +941,8 @@ sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&proc->lock))
+    panic("sched proc->lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -338,10 +958,11 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
+  acquire(&proc->lock);  //DOC: yieldlock
   proc->state = RUNNABLE;
+  proc->nivcsw++;
   sched();
-  release(&ptable.lock);
+  release(&proc->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -350,8 +971,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -360,6 +981,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    bootphase("fs");
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -376,52 +998,351 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire proc->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  // Once we hold proc->lock and are marked
+  // SLEEPING, we can be guaranteed that we
+  // won't miss any wakeup (wakeup checks our
+  // state after taking lk, and locks proc->lock
+  // to change it), so it's okay to release lk.
+  if(lk != &proc->lock)  //DOC: sleeplock0
+    acquire(&proc->lock);  //DOC: sleeplock1
 
   // Go to sleep.
   proc->chan = chan;
   proc->state = SLEEPING;
+  proc->nvcsw++;
+  trace(TR_SLEEP, proc->pid, (int)chan);
+  if(lk != &proc->lock)
+    release(lk);
   sched();
 
   // Tidy up.
   proc->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
+  if(lk != &proc->lock){  //DOC: sleeplock2
+    release(&proc->lock);
     acquire(lk);
   }
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Wake p if it is sleeping in wait or join for a child.
+// Only p sleeps on its own proc, so there is no need to
+// scan the table like wakeup.
+// p->lock must be held.
 static void
-wakeup1(void *chan)
+wakeparent(struct proc *p)
 {
-  struct proc *p;
+  if(p->state == SLEEPING && p->chan == p){
+    p->state = RUNNABLE;
+    wakecpu(p);
+  }
+}
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+// Affinity mask of every CPU in the machine.
+static uint
+allcpus(void)
+{
+  return ncpu < 32 ? (1 << ncpu) - 1 : ~0;
+}
+
+// May p run on cpus[c]?  A process whose mask includes
+// non-isolated CPUs is kept to those.
+static int
+canrun(struct proc *p, int c)
+{
+  uint mask;
+
+  mask = p->cpumask & ~isolcpus;
+  if(mask == 0)
+    mask = p->cpumask;
+  return (mask >> c) & 1;
+}
+
+// Was p woken by wakeupsync() on a CPU other than c,
+// recently enough that it should wait for that CPU?
+static int
+hotelsewhere(struct proc *p, int c)
+{
+  return p->hotcpu != c && p->hotuntil > rdtsc();
+}
+
+// p has just become RUNNABLE.  If a CPU that may run it is
+// halted in idle(), get it to run the scheduler again; if this
+// CPU is the idle one (in an interrupt), it will rescan anyway.
+// A process that last ran on an idle CPU goes back there, to
+// what is left of its cache.  A real-time process that finds
+// no idle CPU preempts one; see edfpreempt.
+// p->lock must be held.
+static void
+wakecpu(struct proc *p)
+{
+  struct cpu *c;
+
+  trace(TR_WAKEUP, p->pid, proc ? proc->pid : 0);
+
+  // Order the store to p->state before the loads of the
+  // idle flags; see the end of scheduler().
+  __sync_synchronize();
+  if(cpu->idle && canrun(p, cpu-cpus)){
+    cpu->idle = 0;
+    return;
+  }
+  if(p->hotcpu == cpu-cpus && p->hotuntil > rdtsc()){
+    // wakeupsync(): our caller is about to sleep, and we
+    // will run p then.  If it doesn't, preempt it when p
+    // stops waiting for us.
+    clockarm(nsecs() + HOTNS);
+    return;
+  }
+  c = &cpus[p->lastcpu];
+  if(p->lastcpu < ncpu && c->idle && canrun(p, p->lastcpu) && xchg(&c->idle, 0)){
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+    return;
+  }
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c->idle && canrun(p, c-cpus) && xchg(&c->idle, 0)){
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+      return;
+    }
+  }
+  if(p->dlruntime)
+    edfpreempt(p);
+}
+
+// Real-time process p is runnable but no CPU is idle.  Unless
+// some CPU that may run p is in the scheduler and will find it,
+// interrupt one running a normal process, or else the real-time
+// process with the latest deadline after p's; trap() makes it
+// yield.  Looks at the other CPUs without locks, so it may pick
+// a CPU that has just switched; its next tick sorts that out.
+static void
+edfpreempt(struct proc *p)
+{
+  struct cpu *c, *victim;
+  struct proc *q;
+  uint64 latest;
+
+  victim = 0;
+  latest = p->dl;
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(!canrun(p, c-cpus))
+      continue;
+    if((q = c->proc) == 0)
+      return;
+    if(q->dlruntime == 0){
+      victim = c;
+      break;
+    }
+    if(q->dl > latest){
+      victim = c;
+      latest = q->dl;
+    }
+  }
+  if(victim)
+    lapicipi(victim->apicid, T_IRQ0 + IRQ_RESCHED);
 }
 
 // Wake up all processes sleeping on chan.
+// The caller must hold the lock that the sleepers
+// passed to sleep().
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  wakeupn(chan, NPROC, 0);
+}
+
+// Like wakeup, for a caller that will soon sleep, as a
+// writer to a full pipe does: rather than start elsewhere, the
+// processes woken wait briefly to run on this CPU, where the
+// data the caller just passed them is still in the cache.
+void
+wakeupsync(void *chan)
+{
+  wakeupn(chan, NPROC, 1);
+}
+
+// Put the current process on this CPU's list of timed
+// sleepers, to be woken at deadline by this CPU's timer.
+static void
+timeradd(uint64 deadline)
+{
+  struct cpu *c;
+  struct proc **pp;
+
+  pushcli();  // stay on c
+  c = cpu;
+  acquire(&c->timerlock);
+  proc->wakeat = deadline;
+  for(pp = &c->timers; *pp && (*pp)->wakeat <= deadline; pp = &(*pp)->timernext)
+    ;
+  proc->timernext = *pp;
+  *pp = proc;
+  proc->timercpu = c;
+  if(c->timers == proc)
+    clockarm(deadline);
+  release(&c->timerlock);
+  popcli();
+}
+
+// Take the current process off the list timeradd put it
+// on, unless wakeuptimed already has.
+static void
+timerdel(void)
+{
+  struct cpu *c;
+  struct proc **pp;
+
+  if((c = proc->timercpu) != 0){
+    acquire(&c->timerlock);
+    for(pp = &c->timers; *pp; pp = &(*pp)->timernext){
+      if(*pp == proc){
+        *pp = proc->timernext;
+        break;
+      }
+    }
+    proc->timercpu = 0;
+    proc->timernext = 0;
+    release(&c->timerlock);
+  }
+  proc->wakeat = 0;
+}
+
+// Sleep until nsecs() reaches deadline.
+// Return -1 if killed first.
+int
+sleepuntil(uint64 deadline)
+{
+  int r;
+
+  r = 0;
+  timeradd(deadline);
+  acquire(&proc->lock);
+  while(nsecs() < deadline){
+    if(proc->killed){
+      r = -1;
+      break;
+    }
+    sleep(&proc->wakeat, &proc->lock);
+  }
+  release(&proc->lock);
+  timerdel();
+  return r;
+}
+
+// Wake the processes on this CPU's list of timed sleepers
+// whose deadline has passed.  Return the earliest deadline
+// still on the list, or ~0.  Only the timer interrupt calls
+// this, so only this CPU adds to the list meanwhile.
+uint64
+wakeuptimed(uint64 now)
+{
+  struct proc *p;
+  uint64 next;
+
+  if(cpu->timers == 0)
+    return ~0ULL;
+  acquire(&cpu->timerlock);
+  while((p = cpu->timers) != 0 && p->wakeat <= now){
+    cpu->timers = p->timernext;
+    p->timercpu = 0;
+    p->timernext = 0;
+    // p checked the time holding p->lock before it slept,
+    // so if it isn't asleep yet it won't go to sleep.
+    release(&cpu->timerlock);
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == &p->wakeat){
+      p->state = RUNNABLE;
+      wakecpu(p);
+    }
+    release(&p->lock);
+    acquire(&cpu->timerlock);
+  }
+  next = p ? p->wakeat : ~0ULL;
+  release(&cpu->timerlock);
+  return next;
+}
+
+// Wake at most n processes sleeping on chan; return how many.
+// If sync, hold them for this CPU; see wakeupsync.
+// As for wakeup, the caller holds the sleepers' lock, and
+// they marked themselves SLEEPING before releasing it, so
+// an unlocked peek at each proc can't miss one.
+static int
+wakeupn(void *chan, int n, int sync)
+{
+  struct proc *p;
+  int woken;
+
+  woken = 0;
+  for(p = ptable.used; p && woken < n; p = p->next){
+    if(p->state != SLEEPING || p->chan != chan)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan){
+      p->state = RUNNABLE;
+      if(sync && proc && canrun(p, cpu-cpus)){
+        p->hotcpu = cpu-cpus;
+        p->hotuntil = rdtsc() + divu64((uint64)tsckhz*HOTNS, 1000000);
+      }
+      wakecpu(p);
+      woken++;
+    }
+    release(&p->lock);
+  }
+  return woken;
+}
+
+// Futexes let user-level locks sleep in the kernel.  The sleep
+// channel is the kernel address of the word's physical memory,
+// so threads and processes that share the page meet on it.
+static int*
+futexaddr(uint *uaddr)
+{
+  char *page;
+
+  if((uint)uaddr % 4 || (uint)uaddr >= proc->vm->sz)
+    return 0;
+  if((page = uva2ka(proc->pgdir, (char*)uaddr)) == 0)
+    return 0;
+  return (int*)(page + ((uint)uaddr & (PGSIZE-1)));
+}
+
+// Sleep until futexwake, unless *uaddr no longer holds val.
+// Returns 0 if woken; -1 if the value differed or on error.
+// May return early, so callers must re-check their condition.
+int
+futexwait(uint *uaddr, int val)
+{
+  int *k;
+
+  if((k = futexaddr(uaddr)) == 0)
+    return -1;
+  acquire(&futexlock);
+  if(*k != val){
+    release(&futexlock);
+    return -1;
+  }
+  sleep(k, &futexlock);
+  release(&futexlock);
+  return proc->killed ? -1 : 0;
+}
+
+// Wake up to n processes in futexwait on uaddr.
+// Returns the number woken.
+int
+futexwake(uint *uaddr, int n)
+{
+  int *k, woken;
+
+  if((k = futexaddr(uaddr)) == 0)
+    return -1;
+  acquire(&futexlock);
+  woken = wakeupn(k, n, 0);
+  release(&futexlock);
+  return woken;
 }
 
 // Kill the process with the given pid.
@@ -432,19 +1353,360 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+  if((p = lockproc(pid)) == 0)
+    return -1;
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+    p->state = RUNNABLE;
+    wakecpu(p);
+  }
+  release(&p->lock);
+  return 0;
+}
+
+// Restrict process pid (0 for the caller) to the CPUs in mask.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  int move, c;
+
+  mask &= allcpus();
+  if(mask == 0)
+    return -1;
+  if(pid == 0){
+    p = proc;
+    acquire(&p->lock);
+  } else if((p = lockproc(pid)) == 0)
+    return -1;
+  if(p->dlruntime){
+    // Move the reservation to where the new mask allows.
+    acquire(&ptable.lock);
+    if((c = edfcpu(mask)) == -2 || !edfmove(p->dlcpu, p->dlbw, c, p->dlbw)){
       release(&ptable.lock);
-      return 0;
+      release(&p->lock);
+      return -1;
     }
+    p->dlcpu = c;
+    release(&ptable.lock);
+  }
+  p->cpumask = mask;
+  if(p->state == RUNNABLE)
+    wakecpu(p);
+  move = p == proc && !canrun(p, cpu-cpus);
+  release(&p->lock);
+  // Move off this CPU if we may no longer run here.
+  if(move)
+    yield();
+  return 0;
+}
+
+// Store the affinity mask of process pid (0 for the caller)
+// in *mask.  A mask of all 32 CPUs would look like -1, so it
+// can't be the return value.
+int
+getaffinity(int pid, uint *mask)
+{
+  struct proc *p;
+
+  if(pid == 0){
+    *mask = proc->cpumask;
+    return 0;
+  }
+  if((p = lockproc(pid)) == 0)
+    return -1;
+  *mask = p->cpumask;
+  release(&p->lock);
+  return 0;
+}
+
+// Keep the CPUs in mask out of general scheduling.
+// At least one CPU must remain for everybody else.  That
+// would move real-time reservations between CPUs, so it
+// fails while there are any.
+int
+isolate(uint mask)
+{
+  mask &= allcpus();
+  if(mask == allcpus())
+    return -1;
+  acquire(&ptable.lock);
+  if(nedf){
+    release(&ptable.lock);
+    return -1;
+  }
+  isolcpus = mask;
+  release(&ptable.lock);
+  return 0;
+}
+
+// Where a real-time process that may run on the CPUs in mask
+// reserves its share: the one CPU it would run on, -1 for
+// all the non-isolated CPUs, or -2 if neither, which
+// admission refuses.  See canrun.
+static int
+edfcpu(uint mask)
+{
+  int c;
+
+  if(mask & ~isolcpus)
+    mask &= ~isolcpus;
+  if(mask == (allcpus() & ~isolcpus))
+    return -1;
+  if(mask & (mask - 1))
+    return -2;
+  for(c = 0; (mask >> c) != 1; c++)
+    ;
+  return c;
+}
+
+// Add bw to the reservations at c, as from edfcpu.
+// ptable.lock must be held.
+static void
+edfcharge(int c, int bw)
+{
+  if(c >= 0)
+    edfcpubw[c] += bw;
+  else
+    edfbw += bw;
+}
+
+// Replace a reservation of oldbw at oldc with one of bw at c,
+// if no CPU ends up reserved beyond EDFMAX.  Only the
+// non-isolated CPUs count towards the shared reservations.
+// Return 1 if so, else 0 with nothing changed.
+// ptable.lock must be held.
+static int
+edfmove(int oldc, int oldbw, int c, int bw)
+{
+  uint total;
+  int i, n;
+
+  edfcharge(oldc, -oldbw);
+  edfcharge(c, bw);
+  total = edfbw;
+  n = 0;
+  for(i = 0; i < ncpu; i++){
+    if(edfcpubw[i] > EDFMAX)
+      break;
+    if(!((isolcpus >> i) & 1)){
+      total += edfcpubw[i];
+      n++;
+    }
+  }
+  if(i < ncpu || total > n*EDFMAX){
+    edfcharge(c, -bw);
+    edfcharge(oldc, oldbw);
+    return 0;
+  }
+  return 1;
+}
+
+// Make process pid (0 for the caller) real-time, with the given
+// runtime every period, by the deadline (all in microseconds),
+// starting now; or make it a normal process again if runtime
+// is 0.  Fails if that would reserve more than EDFMAX of a
+// CPU for real-time processes, or if pid's affinity mask
+// is neither one CPU nor all the non-isolated ones.
+int
+setdeadline(int pid, int runtime, int deadline, int period)
+{
+  struct proc *p;
+  uint bw;
+  int c;
+
+  if(runtime < 0 || (runtime > 0 && (deadline < runtime || period < deadline)))
+    return -1;
+  bw = runtime ? divu64((uint64)runtime*EDFUNIT, period) : 0;
+  if(pid == 0){
+    p = proc;
+    acquire(&p->lock);
+  } else if((p = lockproc(pid)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  c = runtime ? edfcpu(p->cpumask) : -1;
+  if(c == -2 || !edfmove(p->dlcpu, p->dlbw, c, bw)){
+    release(&ptable.lock);
+    release(&p->lock);
+    return -1;
   }
+  nedf += (runtime != 0) - (p->dlruntime != 0);
   release(&ptable.lock);
-  return -1;
+
+  p->dlcpu = c;
+  p->dlbw = bw;
+  p->dlruntime = runtime * 1000ULL;
+  p->dldeadline = deadline * 1000ULL;
+  p->dlperiod = period * 1000ULL;
+  p->dlrelease = p->dlstamp = nsecs();
+  p->dl = p->dlrelease + p->dldeadline;
+  p->dlused = 0;
+  p->dljobs = p->dlmisses = p->dloverruns = 0;
+  release(&p->lock);
+  return 0;
+}
+
+// Start p's next period, after the current one or now,
+// whichever is later, and return when that is.
+// p->lock must be held.
+static uint64
+edfnext(struct proc *p, uint64 now)
+{
+  uint64 next;
+
+  next = p->dlrelease + p->dlperiod;
+  if(next < now)
+    next = now;
+  p->dlrelease = next;
+  p->dl = next + p->dldeadline;
+  p->dlused = 0;
+  return next;
+}
+
+// The current real-time process has finished this period's
+// job: sleep until the next period begins.
+int
+edfyield(void)
+{
+  uint64 now, next;
+
+  acquire(&proc->lock);
+  if(proc->dlruntime == 0){
+    release(&proc->lock);
+    return -1;
+  }
+  now = nsecs();
+  proc->dljobs++;
+  if(now > proc->dl)
+    proc->dlmisses++;
+  next = edfnext(proc, now);
+  release(&proc->lock);
+  return sleepuntil(next);
+}
+
+// Called by trap() on a timer or reschedule interrupt in
+// a real-time process.  If it has used up its runtime for
+// this period, sleep until the next one and return 1;
+// otherwise return 0.
+int
+edfthrottle(void)
+{
+  uint64 now, next;
+
+  acquire(&proc->lock);
+  now = nsecs();
+  proc->dlused += now - proc->dlstamp;
+  proc->dlstamp = now;
+  if(proc->dlruntime == 0 || proc->dlused < proc->dlruntime){
+    release(&proc->lock);
+    return 0;
+  }
+  proc->dloverruns++;
+  next = edfnext(proc, now);
+  release(&proc->lock);
+  sleepuntil(next);
+  return 1;
+}
+
+// Copy the real-time parameters and statistics
+// of process pid (0 for the caller) to ds.
+int
+getdlstat(int pid, struct dlstat *ds)
+{
+  struct proc *p;
+
+  if(pid == 0){
+    p = proc;
+    acquire(&p->lock);
+  } else if((p = lockproc(pid)) == 0)
+    return -1;
+  ds->runtime = divu64(p->dlruntime, 1000);
+  ds->deadline = divu64(p->dldeadline, 1000);
+  ds->period = divu64(p->dlperiod, 1000);
+  ds->jobs = p->dljobs;
+  ds->misses = p->dlmisses;
+  ds->overruns = p->dloverruns;
+  release(&p->lock);
+  return 0;
+}
+
+// The CPUs kept out of general scheduling.
+uint
+isolated(void)
+{
+  return isolcpus;
+}
+
+// Charge the time since the last stamp to the current
+// process, as user time if user is set, else as system time.
+// Called on every trap from and return to user space.
+void
+acct(int user)
+{
+  uint64 now;
+
+  now = rdtsc();
+  if(user)
+    proc->utime += now - proc->stamp;
+  else
+    proc->stime += now - proc->stamp;
+  proc->stamp = now;
+}
+
+// Copy information about up to n processes to pi.
+// Return the number copied.
+int
+getprocinfo(struct procinfo *pi, int n)
+{
+  static int states[] = {
+  [EMBRYO]    PS_EMBRYO,
+  [SLEEPING]  PS_SLEEPING,
+  [RUNNABLE]  PS_RUNNABLE,
+  [RUNNING]   PS_RUNNING,
+  [ZOMBIE]    PS_ZOMBIE
+  };
+  struct proc *p;
+  int i;
+
+  i = 0;
+  for(p = ptable.used; p && i < n; p = p->next){
+    if(p->state == UNUSED)
+      continue;
+    acquire(&p->lock);
+    if(p->state == UNUSED){
+      release(&p->lock);
+      continue;
+    }
+    pi->pid = p->pid;
+    pi->ppid = p->parent ? p->parent->pid : 0;
+    pi->state = states[p->state];
+    pi->cpu = p->lastcpu;
+    pi->sz = p->vm ? p->vm->sz : 0;
+    pi->utime = divu64(p->utime, tsckhz);
+    pi->stime = divu64(p->stime, tsckhz);
+    pi->nvcsw = p->nvcsw;
+    pi->nivcsw = p->nivcsw;
+    pi->nsyscall = p->nsyscall;
+    pi->nfault = p->nfault;
+    safestrcpy(pi->name, p->name, sizeof(pi->name));
+    release(&p->lock);
+    pi++;
+    i++;
+  }
+  return i;
+}
+
+// Copy the event counts of up to n CPUs to cs.
+// Return the number copied.
+int
+cpustat(struct cpustat *cs, int n)
+{
+  int i;
+
+  for(i = 0; i < n && i < ncpu; i++)
+    memmove(cs[i].stat, cpus[i].stat, sizeof(cs[i].stat));
+  return i;
 }
 
 //PAGEBREAK: 36
@@ -467,7 +1729,7 @@ procdump(void)
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.used; p; p = p->next){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
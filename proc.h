@@ -1,17 +1,32 @@
-// Per-CPU state
+// Per-CPU state.  Each starts on a cache line of its own,
+// so CPUs writing their own state don't slow each other.
 struct cpu {
-  uchar apicid;                // Local APIC ID
+  // Cpu-local storage variables; see below.  Must be first.
+  struct cpu *cpu;
+  struct proc *proc;           // The currently-running process.
+
+  uint apicid;                 // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
   struct taskstate ts;         // Used by x86 to find stack for interrupt
   struct segdesc gdt[NSEGS];   // x86 global descriptor table
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
-
-  // Cpu-local storage variables; see below
-  struct cpu *cpu;
-  struct proc *proc;           // The currently-running process.
-};
+  uint64 nexttick;             // nsecs() of next scheduler tick
+  uint64 nextevent;            // nsecs() the timer is armed for
+  volatile uint idle;          // Halted in idle() with the tick stopped?
+  volatile int tlbflush;       // Set by tlbshootdown until we flush
+  struct spinlock timerlock;   // Protects timers
+  struct proc *timers;         // Procs in sleepuntil, earliest wakeat first
+  uint nirq[NIRQ];             // Interrupts taken, by IRQ
+  struct mcsnode mcs[NMCS];    // Queue nodes for the MCS locks we use
+  uint mcsbusy;                // Bit mask of mcs[] in use
+  uint rcuepoch;               // Latest RCU grace period seen when quiescent
+  struct work *rcunext;        // RCU callbacks waiting for a grace period
+  struct work *rcuwait;        // RCU callbacks waiting for grace period rcuwaitepoch
+  uint rcuwaitepoch;
+  uint stat[NCPUSTAT];         // Event counts, by CS_ in pstat.h
+} CACHEALIGN;
 
 extern struct cpu cpus[NCPU];
 extern int ncpu;
@@ -20,13 +35,20 @@ extern int ncpu;
 // current cpu and to the current process.
 // The asm suffix tells gcc to use "%gs:0" to refer to cpu
 // and "%gs:4" to refer to proc.  seginit sets up the
-// %gs segment register so that %gs refers to the memory
-// holding those two variables in the local cpu's struct cpu.
+// %gs segment register so that %gs refers to the local
+// cpu's struct cpu, which starts with those two variables.
 // This is similar to how thread-local variables are implemented
 // in thread libraries such as Linux pthreads.
 extern struct cpu *cpu asm("%gs:0");       // &cpus[cpunum()]
 extern struct proc *proc asm("%gs:4");     // cpus[cpunum()].proc
 
+// Count event n, a CS_ constant from pstat.h, on this CPU.
+// A single instruction on this CPU's own struct cpu, so it
+// needs no lock, no atomic and no pushcli; cpustat() sums
+// the counts of all CPUs.
+#define cpustatinc(n) \
+  asm volatile("incl %%gs:%c0" : : "i" (__builtin_offsetof(struct cpu, stat[n])))
+
 //PAGEBREAK: 17
 // Saved registers for kernel context switches.
 // Don't need to save all the segment registers (%cs, etc),
@@ -50,19 +72,52 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
-  uint sz;                     // Size of process memory (bytes)
-  pde_t* pgdir;                // Page table
+  struct spinlock lock;        // Protects state, chan, killed, cpumask, parent, vm
+  struct vm *vm;               // User address space; 0 for a kernel thread
+  pde_t* pgdir;                // Page table: vm->pgdir, or kpgdir
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // First child; the rest follow sibling; under lock
+  struct proc *sibling;        // Next child of the same parent; under parent's lock
+  void *ustack;                // User stack of a thread made by clone
+  uint cpumask;                // CPUs this process may run on
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  uint64 wakeat;               // If non-zero, nsecs() deadline of sleepuntil
+  struct cpu *timercpu;        // Whose timers list we are on, or 0
+  struct proc *timernext;      // Next in timercpu->timers
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct fdtable *fdt;         // Open files and cwd; 0 for a kernel thread
   char name[16];               // Process name (debugging)
+  struct proc *next;           // Next in ptable.used
+  struct proc *prev;           // Previous in ptable.used; under ptable.lock
+  struct proc *nextfree;       // Next in ptable free list
+  struct proc *hashnext;       // Next in ptable pid hash chain
+  int lastcpu;                 // CPU it last ran on
+  int hotcpu;                  // CPU that woke it with wakeupsync
+  uint64 hotuntil;             // rdtsc() until which it waits for hotcpu
+  uint64 stamp;                // rdtsc() when last charged to utime/stime
+  uint64 utime;                // TSC cycles spent in user mode
+  uint64 stime;                // TSC cycles spent in the kernel
+  uint nvcsw;                  // Voluntary context switches
+  uint nivcsw;                 // Involuntary context switches
+  uint nsyscall;               // System calls made
+  uint nfault;                 // Page faults taken
+  uint64 dlruntime;            // EDF runtime per period (ns); 0 if not real-time
+  uint64 dldeadline;           // EDF deadline, relative to the period (ns)
+  uint64 dlperiod;             // EDF period (ns)
+  uint dlbw;                   // Share of a CPU reserved, in EDFUNITs
+  int dlcpu;                   // CPU dlbw is reserved on; -1 for all non-isolated
+  uint64 dlrelease;            // nsecs() the current period began
+  uint64 dl;                   // nsecs() deadline of the current job
+  uint64 dlused;               // Runtime used in the current period (ns)
+  uint64 dlstamp;              // nsecs() when last charged to dlused
+  uint dljobs;                 // Jobs finished with sched_dlyield
+  uint dlmisses;               // Jobs finished after their deadline
+  uint dloverruns;             // Periods whose runtime ran out
 };
 
 // Process memory is laid out contiguously, low addresses first:
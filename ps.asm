@@ -0,0 +1,1939 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  col(buf+i, w);
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 20             	sub    $0x20,%esp
+  int i, n;
+
+  n = getprocinfo(pi, NPROC);
+  14:	68 00 10 00 00       	push   $0x1000
+  19:	68 40 12 00 00       	push   $0x1240
+  1e:	e8 28 05 00 00       	call   54b <getprocinfo>
+  if(n < 0){
+  23:	83 c4 10             	add    $0x10,%esp
+  n = getprocinfo(pi, NPROC);
+  26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(n < 0){
+  29:	85 c0                	test   %eax,%eax
+  2b:	0f 88 20 01 00 00    	js     151 <main+0x151>
+    printf(2, "ps: getprocinfo failed\n");
+    exit();
+  }
+  printf(1, "PID   PPID  STATE   CPU  SZ      USER    SYS     "
+  31:	50                   	push   %eax
+  32:	50                   	push   %eax
+  33:	68 a4 0c 00 00       	push   $0xca4
+  38:	6a 01                	push   $0x1
+  3a:	e8 21 06 00 00       	call   660 <printf>
+            "SYSCALLS  VCSW    IVCSW   FAULTS  NAME\n");
+  for(i = 0; i < n; i++){
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  46:	0f 84 00 01 00 00    	je     14c <main+0x14c>
+  4c:	bb 6c 12 00 00       	mov    $0x126c,%ebx
+  51:	31 f6                	xor    %esi,%esi
+  53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  57:	90                   	nop
+    coln(pi[i].pid, 6);
+  58:	8b 43 d4             	mov    -0x2c(%ebx),%eax
+  5b:	ba 06 00 00 00       	mov    $0x6,%edx
+  60:	e8 0b 01 00 00       	call   170 <coln>
+    coln(pi[i].ppid, 6);
+  65:	8b 43 d8             	mov    -0x28(%ebx),%eax
+  68:	ba 06 00 00 00       	mov    $0x6,%edx
+  6d:	e8 fe 00 00 00       	call   170 <coln>
+    col(states[pi[i].state], 8);
+  72:	8b 43 dc             	mov    -0x24(%ebx),%eax
+  n = strlen(s);
+  75:	83 ec 0c             	sub    $0xc,%esp
+    col(states[pi[i].state], 8);
+  78:	8b 14 85 00 0d 00 00 	mov    0xd00(,%eax,4),%edx
+  n = strlen(s);
+  7f:	52                   	push   %edx
+  80:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  83:	e8 18 02 00 00       	call   2a0 <strlen>
+  printf(1, "%s", s);
+  88:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8b:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+  8e:	89 c7                	mov    %eax,%edi
+  printf(1, "%s", s);
+  90:	52                   	push   %edx
+  91:	68 64 0c 00 00       	push   $0xc64
+  96:	6a 01                	push   $0x1
+  98:	e8 c3 05 00 00       	call   660 <printf>
+  for(; n < w; n++)
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	83 ff 07             	cmp    $0x7,%edi
+  a3:	7f 1d                	jg     c2 <main+0xc2>
+  a5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+  a8:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+  ab:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+  ae:	68 67 0c 00 00       	push   $0xc67
+  b3:	6a 01                	push   $0x1
+  b5:	e8 a6 05 00 00       	call   660 <printf>
+  for(; n < w; n++)
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	83 ff 08             	cmp    $0x8,%edi
+  c0:	75 e6                	jne    a8 <main+0xa8>
+    coln(pi[i].cpu, 5);
+  c2:	8b 43 e0             	mov    -0x20(%ebx),%eax
+  c5:	ba 05 00 00 00       	mov    $0x5,%edx
+  for(i = 0; i < n; i++){
+  ca:	83 c6 01             	add    $0x1,%esi
+    coln(pi[i].cpu, 5);
+  cd:	e8 9e 00 00 00       	call   170 <coln>
+    coln(pi[i].sz, 8);
+  d2:	8b 43 e4             	mov    -0x1c(%ebx),%eax
+  d5:	ba 08 00 00 00       	mov    $0x8,%edx
+  da:	e8 91 00 00 00       	call   170 <coln>
+    coln(pi[i].utime, 8);
+  df:	8b 43 e8             	mov    -0x18(%ebx),%eax
+  e2:	ba 08 00 00 00       	mov    $0x8,%edx
+  e7:	e8 84 00 00 00       	call   170 <coln>
+    coln(pi[i].stime, 8);
+  ec:	8b 43 ec             	mov    -0x14(%ebx),%eax
+  ef:	ba 08 00 00 00       	mov    $0x8,%edx
+  f4:	e8 77 00 00 00       	call   170 <coln>
+    coln(pi[i].nsyscall, 10);
+  f9:	8b 43 f8             	mov    -0x8(%ebx),%eax
+  fc:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 101:	e8 6a 00 00 00       	call   170 <coln>
+    coln(pi[i].nvcsw, 8);
+ 106:	8b 43 f0             	mov    -0x10(%ebx),%eax
+ 109:	ba 08 00 00 00       	mov    $0x8,%edx
+ 10e:	e8 5d 00 00 00       	call   170 <coln>
+    coln(pi[i].nivcsw, 8);
+ 113:	8b 43 f4             	mov    -0xc(%ebx),%eax
+ 116:	ba 08 00 00 00       	mov    $0x8,%edx
+ 11b:	e8 50 00 00 00       	call   170 <coln>
+    coln(pi[i].nfault, 8);
+ 120:	8b 43 fc             	mov    -0x4(%ebx),%eax
+ 123:	ba 08 00 00 00       	mov    $0x8,%edx
+ 128:	e8 43 00 00 00       	call   170 <coln>
+    printf(1, "%s\n", pi[i].name);
+ 12d:	83 ec 04             	sub    $0x4,%esp
+ 130:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 131:	83 c3 3c             	add    $0x3c,%ebx
+    printf(1, "%s\n", pi[i].name);
+ 134:	68 81 0c 00 00       	push   $0xc81
+ 139:	6a 01                	push   $0x1
+ 13b:	e8 20 05 00 00       	call   660 <printf>
+  for(i = 0; i < n; i++){
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+ 146:	0f 85 0c ff ff ff    	jne    58 <main+0x58>
+  }
+  exit();
+ 14c:	e8 02 03 00 00       	call   453 <exit>
+    printf(2, "ps: getprocinfo failed\n");
+ 151:	52                   	push   %edx
+ 152:	52                   	push   %edx
+ 153:	68 69 0c 00 00       	push   $0xc69
+ 158:	6a 02                	push   $0x2
+ 15a:	e8 01 05 00 00       	call   660 <printf>
+    exit();
+ 15f:	e8 ef 02 00 00       	call   453 <exit>
+ 164:	66 90                	xchg   %ax,%ax
+ 166:	66 90                	xchg   %ax,%ax
+ 168:	66 90                	xchg   %ax,%ax
+ 16a:	66 90                	xchg   %ax,%ax
+ 16c:	66 90                	xchg   %ax,%ax
+ 16e:	66 90                	xchg   %ax,%ax
+
+00000170 <coln>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 c1                	mov    %eax,%ecx
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	57                   	push   %edi
+ 176:	56                   	push   %esi
+    buf[--i] = '0' + x % 10;
+ 177:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 17c:	53                   	push   %ebx
+  i = sizeof(buf) - 1;
+ 17d:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+ 182:	83 ec 2c             	sub    $0x2c,%esp
+  buf[i] = 0;
+ 185:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+ 189:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 190:	89 c8                	mov    %ecx,%eax
+ 192:	83 eb 01             	sub    $0x1,%ebx
+ 195:	f7 e6                	mul    %esi
+ 197:	89 c8                	mov    %ecx,%eax
+ 199:	c1 ea 03             	shr    $0x3,%edx
+ 19c:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 19f:	01 ff                	add    %edi,%edi
+ 1a1:	29 f8                	sub    %edi,%eax
+ 1a3:	83 c0 30             	add    $0x30,%eax
+ 1a6:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+ 1aa:	89 c8                	mov    %ecx,%eax
+ 1ac:	89 d1                	mov    %edx,%ecx
+ 1ae:	83 f8 09             	cmp    $0x9,%eax
+ 1b1:	77 dd                	ja     190 <coln+0x20>
+  col(buf+i, w);
+ 1b3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 1b6:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 1b9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 1bc:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+ 1bf:	56                   	push   %esi
+ 1c0:	e8 db 00 00 00       	call   2a0 <strlen>
+  printf(1, "%s", s);
+ 1c5:	83 c4 0c             	add    $0xc,%esp
+ 1c8:	56                   	push   %esi
+  n = strlen(s);
+ 1c9:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 1cb:	68 64 0c 00 00       	push   $0xc64
+ 1d0:	6a 01                	push   $0x1
+ 1d2:	e8 89 04 00 00       	call   660 <printf>
+  for(; n < w; n++)
+ 1d7:	83 c4 10             	add    $0x10,%esp
+ 1da:	39 df                	cmp    %ebx,%edi
+ 1dc:	7e 1b                	jle    1f9 <coln+0x89>
+ 1de:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+ 1e0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 1e3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 1e6:	68 67 0c 00 00       	push   $0xc67
+ 1eb:	6a 01                	push   $0x1
+ 1ed:	e8 6e 04 00 00       	call   660 <printf>
+  for(; n < w; n++)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	39 df                	cmp    %ebx,%edi
+ 1f7:	75 e7                	jne    1e0 <coln+0x70>
+}
+ 1f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fc:	5b                   	pop    %ebx
+ 1fd:	5e                   	pop    %esi
+ 1fe:	5f                   	pop    %edi
+ 1ff:	5d                   	pop    %ebp
+ 200:	c3                   	ret
+ 201:	66 90                	xchg   %ax,%ax
+ 203:	66 90                	xchg   %ax,%ax
+ 205:	66 90                	xchg   %ax,%ax
+ 207:	66 90                	xchg   %ax,%ax
+ 209:	66 90                	xchg   %ax,%ax
+ 20b:	66 90                	xchg   %ax,%ax
+ 20d:	66 90                	xchg   %ax,%ax
+ 20f:	90                   	nop
+
+00000210 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 211:	31 c0                	xor    %eax,%eax
+{
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	53                   	push   %ebx
+ 216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 227:	83 c0 01             	add    $0x1,%eax
+ 22a:	84 d2                	test   %dl,%dl
+ 22c:	75 f2                	jne    220 <strcpy+0x10>
+    ;
+  return os;
+}
+ 22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 231:	89 c8                	mov    %ecx,%eax
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+ 235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+ 247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 24a:	0f b6 02             	movzbl (%edx),%eax
+ 24d:	84 c0                	test   %al,%al
+ 24f:	75 17                	jne    268 <strcmp+0x28>
+ 251:	eb 3a                	jmp    28d <strcmp+0x4d>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 25c:	83 c2 01             	add    $0x1,%edx
+ 25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 262:	84 c0                	test   %al,%al
+ 264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+ 266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 268:	0f b6 19             	movzbl (%ecx),%ebx
+ 26b:	38 c3                	cmp    %al,%bl
+ 26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 26f:	29 d8                	sub    %ebx,%eax
+}
+ 271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 274:	c9                   	leave
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 284:	31 c0                	xor    %eax,%eax
+ 286:	29 d8                	sub    %ebx,%eax
+}
+ 288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 28b:	c9                   	leave
+ 28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 28d:	0f b6 19             	movzbl (%ecx),%ebx
+ 290:	31 c0                	xor    %eax,%eax
+ 292:	eb db                	jmp    26f <strcmp+0x2f>
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2a9:	74 15                	je     2c0 <strlen+0x20>
+ 2ab:	31 c0                	xor    %eax,%eax
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 2b0:	83 c0 01             	add    $0x1,%eax
+ 2b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2b7:	89 c1                	mov    %eax,%ecx
+ 2b9:	75 f5                	jne    2b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2bb:	89 c8                	mov    %ecx,%eax
+ 2bd:	5d                   	pop    %ebp
+ 2be:	c3                   	ret
+ 2bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2c0:	31 c9                	xor    %ecx,%ecx
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	89 c8                	mov    %ecx,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2dd:	89 d7                	mov    %edx,%edi
+ 2df:	fc                   	cld
+ 2e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2e5:	89 d0                	mov    %edx,%eax
+ 2e7:	c9                   	leave
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2fa:	0f b6 10             	movzbl (%eax),%edx
+ 2fd:	84 d2                	test   %dl,%dl
+ 2ff:	75 12                	jne    313 <strchr+0x23>
+ 301:	eb 1d                	jmp    320 <strchr+0x30>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 30c:	83 c0 01             	add    $0x1,%eax
+ 30f:	84 d2                	test   %dl,%dl
+ 311:	74 0d                	je     320 <strchr+0x30>
+    if(*s == c)
+ 313:	38 d1                	cmp    %dl,%cl
+ 315:	75 f1                	jne    308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 317:	5d                   	pop    %ebp
+ 318:	c3                   	ret
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 320:	31 c0                	xor    %eax,%eax
+}
+ 322:	5d                   	pop    %ebp
+ 323:	c3                   	ret
+ 324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 339:	31 db                	xor    %ebx,%ebx
+{
+ 33b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 33e:	eb 27                	jmp    367 <gets+0x37>
+    cc = read(0, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	6a 01                	push   $0x1
+ 345:	56                   	push   %esi
+ 346:	6a 00                	push   $0x0
+ 348:	e8 1e 01 00 00       	call   46b <read>
+    if(cc < 1)
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	85 c0                	test   %eax,%eax
+ 352:	7e 1d                	jle    371 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 35f:	3c 0a                	cmp    $0xa,%al
+ 361:	74 10                	je     373 <gets+0x43>
+ 363:	3c 0d                	cmp    $0xd,%al
+ 365:	74 0c                	je     373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 367:	89 df                	mov    %ebx,%edi
+ 369:	83 c3 01             	add    $0x1,%ebx
+ 36c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 36f:	7c cf                	jl     340 <gets+0x10>
+ 371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 37a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37d:	5b                   	pop    %ebx
+ 37e:	5e                   	pop    %esi
+ 37f:	5f                   	pop    %edi
+ 380:	5d                   	pop    %ebp
+ 381:	c3                   	ret
+ 382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	56                   	push   %esi
+ 394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 395:	83 ec 08             	sub    $0x8,%esp
+ 398:	6a 00                	push   $0x0
+ 39a:	ff 75 08             	push   0x8(%ebp)
+ 39d:	e8 f1 00 00 00       	call   493 <open>
+  if(fd < 0)
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	78 27                	js     3d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3a9:	83 ec 08             	sub    $0x8,%esp
+ 3ac:	ff 75 0c             	push   0xc(%ebp)
+ 3af:	89 c3                	mov    %eax,%ebx
+ 3b1:	50                   	push   %eax
+ 3b2:	e8 f4 00 00 00       	call   4ab <fstat>
+  close(fd);
+ 3b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3bc:	e8 ba 00 00 00       	call   47b <close>
+  return r;
+ 3c1:	83 c4 10             	add    $0x10,%esp
+}
+ 3c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3c7:	89 f0                	mov    %esi,%eax
+ 3c9:	5b                   	pop    %ebx
+ 3ca:	5e                   	pop    %esi
+ 3cb:	5d                   	pop    %ebp
+ 3cc:	c3                   	ret
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3d5:	eb ed                	jmp    3c4 <stat+0x34>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3e7:	0f be 02             	movsbl (%edx),%eax
+ 3ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3f5:	77 1e                	ja     415 <atoi+0x35>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 400:	83 c2 01             	add    $0x1,%edx
+ 403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 40a:	0f be 02             	movsbl (%edx),%eax
+ 40d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 410:	80 fb 09             	cmp    $0x9,%bl
+ 413:	76 eb                	jbe    400 <atoi+0x20>
+  return n;
+}
+ 415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 418:	89 c8                	mov    %ecx,%eax
+ 41a:	c9                   	leave
+ 41b:	c3                   	ret
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	8b 45 10             	mov    0x10(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 42e:	85 c0                	test   %eax,%eax
+ 430:	7e 13                	jle    445 <memmove+0x25>
+ 432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 434:	89 d7                	mov    %edx,%edi
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 441:	39 f8                	cmp    %edi,%eax
+ 443:	75 fb                	jne    440 <memmove+0x20>
+  return vdst;
+}
+ 445:	5e                   	pop    %esi
+ 446:	89 d0                	mov    %edx,%eax
+ 448:	5f                   	pop    %edi
+ 449:	5d                   	pop    %ebp
+ 44a:	c3                   	ret
+
+0000044b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 44b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <exit>:
+SYSCALL(exit)
+ 453:	b8 02 00 00 00       	mov    $0x2,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <wait>:
+SYSCALL(wait)
+ 45b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <pipe>:
+SYSCALL(pipe)
+ 463:	b8 04 00 00 00       	mov    $0x4,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <read>:
+SYSCALL(read)
+ 46b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <write>:
+SYSCALL(write)
+ 473:	b8 10 00 00 00       	mov    $0x10,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <close>:
+SYSCALL(close)
+ 47b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <kill>:
+SYSCALL(kill)
+ 483:	b8 06 00 00 00       	mov    $0x6,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <exec>:
+SYSCALL(exec)
+ 48b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <open>:
+SYSCALL(open)
+ 493:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mknod>:
+SYSCALL(mknod)
+ 49b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <unlink>:
+SYSCALL(unlink)
+ 4a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <fstat>:
+SYSCALL(fstat)
+ 4ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <link>:
+SYSCALL(link)
+ 4b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mkdir>:
+SYSCALL(mkdir)
+ 4bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <chdir>:
+SYSCALL(chdir)
+ 4c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <dup>:
+SYSCALL(dup)
+ 4cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getpid>:
+SYSCALL(getpid)
+ 4d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <sbrk>:
+SYSCALL(sbrk)
+ 4db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <sleep>:
+SYSCALL(sleep)
+ 4e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <uptime>:
+SYSCALL(uptime)
+ 4eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <add_dir>:
+SYSCALL(add_dir)
+ 4f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <history>:
+SYSCALL(history)
+ 4fb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 503:	b8 19 00 00 00       	mov    $0x19,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <nanosleep>:
+SYSCALL(nanosleep)
+ 50b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <clone>:
+SYSCALL(clone)
+ 513:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <join>:
+SYSCALL(join)
+ 51b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <futex_wait>:
+SYSCALL(futex_wait)
+ 523:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <futex_wake>:
+SYSCALL(futex_wake)
+ 52b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 533:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 53b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 543:	b8 21 00 00 00       	mov    $0x21,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 54b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <waitpid>:
+SYSCALL(waitpid)
+ 553:	b8 23 00 00 00       	mov    $0x23,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <tracectl>:
+SYSCALL(tracectl)
+ 55b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <traceread>:
+SYSCALL(traceread)
+ 563:	b8 25 00 00 00       	mov    $0x25,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 56b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 573:	b8 27 00 00 00       	mov    $0x27,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 57b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <irqroute>:
+SYSCALL(irqroute)
+ 583:	b8 29 00 00 00       	mov    $0x29,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <irqstat>:
+SYSCALL(irqstat)
+ 58b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <boottimes>:
+SYSCALL(boottimes)
+ 593:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <lockbench>:
+SYSCALL(lockbench)
+ 59b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <lockstat>:
+SYSCALL(lockstat)
+ 5a3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <cpustat>:
+SYSCALL(cpustat)
+ 5ab:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <bcachesize>:
+SYSCALL(bcachesize)
+ 5b3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 78 0d 00 00 	movzbl 0xd78(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 36 fe ff ff       	call   473 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 cc fd ff ff       	call   473 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 20 0d 00 00 	jmp    *0xd20(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 6d fd ff ff       	call   473 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 5b fd ff ff       	call   473 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 e1 fc ff ff       	call   473 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 91 fc ff ff       	call   473 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb 18 0d 00 00       	mov    $0xd18,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 810:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 811:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 814:	89 e5                	mov    %esp,%ebp
+ 816:	57                   	push   %edi
+ 817:	56                   	push   %esi
+ 818:	53                   	push   %ebx
+ 819:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81b:	a1 44 d2 03 00       	mov    0x3d244,%eax
+ 820:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 822:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 824:	39 ca                	cmp    %ecx,%edx
+ 826:	73 30                	jae    858 <ufree+0x48>
+ 828:	39 c1                	cmp    %eax,%ecx
+ 82a:	72 04                	jb     830 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82c:	39 c2                	cmp    %eax,%edx
+ 82e:	72 f0                	jb     820 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 830:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 833:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 836:	39 f8                	cmp    %edi,%eax
+ 838:	74 26                	je     860 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	74 30                	je     877 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 847:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 849:	5b                   	pop    %ebx
+  freep = p;
+ 84a:	89 15 44 d2 03 00    	mov    %edx,0x3d244
+}
+ 850:	5e                   	pop    %esi
+ 851:	5f                   	pop    %edi
+ 852:	5d                   	pop    %ebp
+ 853:	c3                   	ret
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 858:	39 c1                	cmp    %eax,%ecx
+ 85a:	72 d0                	jb     82c <ufree+0x1c>
+ 85c:	eb c2                	jmp    820 <ufree+0x10>
+ 85e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 860:	03 70 04             	add    0x4(%eax),%esi
+ 863:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 866:	8b 02                	mov    (%edx),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 86d:	8b 42 04             	mov    0x4(%edx),%eax
+ 870:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 873:	39 f1                	cmp    %esi,%ecx
+ 875:	75 d0                	jne    847 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 877:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 87a:	89 15 44 d2 03 00    	mov    %edx,0x3d244
+    p->s.size += bp->s.size;
+ 880:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 883:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 886:	89 0a                	mov    %ecx,(%edx)
+}
+ 888:	5b                   	pop    %ebx
+ 889:	5e                   	pop    %esi
+ 88a:	5f                   	pop    %edi
+ 88b:	5d                   	pop    %ebp
+ 88c:	c3                   	ret
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	53                   	push   %ebx
+ 894:	83 ec 10             	sub    $0x10,%esp
+ 897:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 89a:	68 40 d2 03 00       	push   $0x3d240
+ 89f:	e8 ec 01 00 00       	call   a90 <lock_acquire>
+  ufree(ap);
+ 8a4:	89 d8                	mov    %ebx,%eax
+ 8a6:	e8 65 ff ff ff       	call   810 <ufree>
+  lock_release(&mlock);
+ 8ab:	c7 45 08 40 d2 03 00 	movl   $0x3d240,0x8(%ebp)
+}
+ 8b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 8b5:	83 c4 10             	add    $0x10,%esp
+}
+ 8b8:	c9                   	leave
+  lock_release(&mlock);
+ 8b9:	e9 f2 01 00 00       	jmp    ab0 <lock_release>
+ 8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 8cc:	68 40 d2 03 00       	push   $0x3d240
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d1:	8d 48 07             	lea    0x7(%eax),%ecx
+ 8d4:	c1 e9 03             	shr    $0x3,%ecx
+ 8d7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 8da:	e8 b1 01 00 00       	call   a90 <lock_acquire>
+  if((prevp = freep) == 0){
+ 8df:	8b 15 44 d2 03 00    	mov    0x3d244,%edx
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	85 d2                	test   %edx,%edx
+ 8ea:	0f 84 b0 00 00 00    	je     9a0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 8f2:	8b 47 04             	mov    0x4(%edi),%eax
+ 8f5:	39 f0                	cmp    %esi,%eax
+ 8f7:	73 6f                	jae    968 <malloc+0xa8>
+  if(nu < 4096)
+ 8f9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8fe:	39 de                	cmp    %ebx,%esi
+ 900:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 903:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 90a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 90d:	eb 0a                	jmp    919 <malloc+0x59>
+ 90f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 910:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 912:	8b 47 04             	mov    0x4(%edi),%eax
+ 915:	39 f0                	cmp    %esi,%eax
+ 917:	73 4f                	jae    968 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 919:	89 fa                	mov    %edi,%edx
+ 91b:	39 3d 44 d2 03 00    	cmp    %edi,0x3d244
+ 921:	75 ed                	jne    910 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	ff 75 e4             	push   -0x1c(%ebp)
+ 929:	e8 ad fb ff ff       	call   4db <sbrk>
+  if(p == (char*)-1)
+ 92e:	83 c4 10             	add    $0x10,%esp
+ 931:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 934:	74 15                	je     94b <malloc+0x8b>
+  hp->s.size = nu;
+ 936:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 939:	83 c0 08             	add    $0x8,%eax
+ 93c:	e8 cf fe ff ff       	call   810 <ufree>
+  return freep;
+ 941:	8b 15 44 d2 03 00    	mov    0x3d244,%edx
+      if((p = morecore(nunits)) == 0){
+ 947:	85 d2                	test   %edx,%edx
+ 949:	75 c5                	jne    910 <malloc+0x50>
+        lock_release(&mlock);
+ 94b:	83 ec 0c             	sub    $0xc,%esp
+ 94e:	68 40 d2 03 00       	push   $0x3d240
+ 953:	e8 58 01 00 00       	call   ab0 <lock_release>
+        return 0;
+ 958:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 95b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 95e:	31 c0                	xor    %eax,%eax
+}
+ 960:	5b                   	pop    %ebx
+ 961:	5e                   	pop    %esi
+ 962:	5f                   	pop    %edi
+ 963:	5d                   	pop    %ebp
+ 964:	c3                   	ret
+ 965:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 968:	39 c6                	cmp    %eax,%esi
+ 96a:	74 64                	je     9d0 <malloc+0x110>
+        p->s.size -= nunits;
+ 96c:	29 f0                	sub    %esi,%eax
+ 96e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 971:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 974:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 977:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 97a:	89 15 44 d2 03 00    	mov    %edx,0x3d244
+      lock_release(&mlock);
+ 980:	68 40 d2 03 00       	push   $0x3d240
+ 985:	e8 26 01 00 00       	call   ab0 <lock_release>
+      return (void*)(p + 1);
+ 98a:	83 c4 10             	add    $0x10,%esp
+}
+ 98d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 990:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 993:	5b                   	pop    %ebx
+ 994:	5e                   	pop    %esi
+ 995:	5f                   	pop    %edi
+ 996:	5d                   	pop    %ebp
+ 997:	c3                   	ret
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 9a0:	c7 05 44 d2 03 00 48 	movl   $0x3d248,0x3d244
+ 9a7:	d2 03 00 
+    base.s.size = 0;
+ 9aa:	bf 48 d2 03 00       	mov    $0x3d248,%edi
+    base.s.ptr = freep = prevp = &base;
+ 9af:	c7 05 48 d2 03 00 48 	movl   $0x3d248,0x3d248
+ 9b6:	d2 03 00 
+    base.s.size = 0;
+ 9b9:	c7 05 4c d2 03 00 00 	movl   $0x0,0x3d24c
+ 9c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9c3:	e9 31 ff ff ff       	jmp    8f9 <malloc+0x39>
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 07                	mov    (%edi),%eax
+ 9d2:	89 02                	mov    %eax,(%edx)
+ 9d4:	eb a1                	jmp    977 <malloc+0xb7>
+ 9d6:	66 90                	xchg   %ax,%ax
+ 9d8:	66 90                	xchg   %ax,%ax
+ 9da:	66 90                	xchg   %ax,%ax
+ 9dc:	66 90                	xchg   %ax,%ax
+ 9de:	66 90                	xchg   %ax,%ax
+
+000009e0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	53                   	push   %ebx
+ 9e4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 9e7:	68 00 10 00 00       	push   $0x1000
+ 9ec:	e8 cf fe ff ff       	call   8c0 <malloc>
+ 9f1:	83 c4 10             	add    $0x10,%esp
+ 9f4:	85 c0                	test   %eax,%eax
+ 9f6:	74 37                	je     a2f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 9f8:	83 ec 04             	sub    $0x4,%esp
+ 9fb:	89 c3                	mov    %eax,%ebx
+ 9fd:	50                   	push   %eax
+ 9fe:	ff 75 0c             	push   0xc(%ebp)
+ a01:	ff 75 08             	push   0x8(%ebp)
+ a04:	e8 0a fb ff ff       	call   513 <clone>
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	85 c0                	test   %eax,%eax
+ a0e:	78 08                	js     a18 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ a10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a13:	c9                   	leave
+ a14:	c3                   	ret
+ a15:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ a18:	83 ec 0c             	sub    $0xc,%esp
+ a1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a1e:	53                   	push   %ebx
+ a1f:	e8 6c fe ff ff       	call   890 <free>
+ a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ a2a:	83 c4 10             	add    $0x10,%esp
+}
+ a2d:	c9                   	leave
+ a2e:	c3                   	ret
+    return -1;
+ a2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a34:	eb da                	jmp    a10 <thread_create+0x30>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ a46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a49:	50                   	push   %eax
+ a4a:	e8 cc fa ff ff       	call   51b <join>
+ a4f:	83 c4 10             	add    $0x10,%esp
+ a52:	85 c0                	test   %eax,%eax
+ a54:	79 0a                	jns    a60 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ a56:	c9                   	leave
+ a57:	c3                   	ret
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+ a60:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	ff 75 f4             	push   -0xc(%ebp)
+ a69:	e8 22 fe ff ff       	call   890 <free>
+ a6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a71:	83 c4 10             	add    $0x10,%esp
+}
+ a74:	c9                   	leave
+ a75:	c3                   	ret
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ a83:	8b 45 08             	mov    0x8(%ebp),%eax
+ a86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+ a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ a90:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ a91:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a96:	89 e5                	mov    %esp,%ebp
+ a98:	8b 55 08             	mov    0x8(%ebp),%edx
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+ aa0:	89 c8                	mov    %ecx,%eax
+ aa2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ aa5:	85 c0                	test   %eax,%eax
+ aa7:	75 f7                	jne    aa0 <lock_acquire+0x10>
+    ;
+}
+ aa9:	5d                   	pop    %ebp
+ aaa:	c3                   	ret
+ aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+
+00000ab0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	31 c0                	xor    %eax,%eax
+ ab3:	89 e5                	mov    %esp,%ebp
+ ab5:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ acc:	5d                   	pop    %ebp
+ acd:	c3                   	ret
+ ace:	66 90                	xchg   %ax,%ax
+
+00000ad0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ad0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ ad1:	31 c0                	xor    %eax,%eax
+ ad3:	ba 01 00 00 00       	mov    $0x1,%edx
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	56                   	push   %esi
+ adb:	53                   	push   %ebx
+ adc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ adf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ ae3:	85 c0                	test   %eax,%eax
+ ae5:	74 30                	je     b17 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ ae7:	83 f8 02             	cmp    $0x2,%eax
+ aea:	74 0c                	je     af8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ aec:	b8 02 00 00 00       	mov    $0x2,%eax
+ af1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ af4:	85 c0                	test   %eax,%eax
+ af6:	74 1f                	je     b17 <mutex_lock+0x47>
+ af8:	be 02 00 00 00       	mov    $0x2,%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ b00:	83 ec 08             	sub    $0x8,%esp
+ b03:	6a 02                	push   $0x2
+ b05:	53                   	push   %ebx
+ b06:	e8 18 fa ff ff       	call   523 <futex_wait>
+ b0b:	89 f0                	mov    %esi,%eax
+ b0d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b10:	83 c4 10             	add    $0x10,%esp
+ b13:	85 c0                	test   %eax,%eax
+ b15:	75 e9                	jne    b00 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b1a:	5b                   	pop    %ebx
+ b1b:	5e                   	pop    %esi
+ b1c:	5d                   	pop    %ebp
+ b1d:	c3                   	ret
+ b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b20:	55                   	push   %ebp
+ b21:	31 c0                	xor    %eax,%eax
+ b23:	89 e5                	mov    %esp,%ebp
+ b25:	83 ec 08             	sub    $0x8,%esp
+ b28:	8b 55 08             	mov    0x8(%ebp),%edx
+ b2b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ b2e:	83 f8 02             	cmp    $0x2,%eax
+ b31:	74 05                	je     b38 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ b33:	c9                   	leave
+ b34:	c3                   	ret
+ b35:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ b38:	83 ec 08             	sub    $0x8,%esp
+ b3b:	6a 01                	push   $0x1
+ b3d:	52                   	push   %edx
+ b3e:	e8 e8 f9 ff ff       	call   52b <futex_wake>
+ b43:	83 c4 10             	add    $0x10,%esp
+}
+ b46:	c9                   	leave
+ b47:	c3                   	ret
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+
+00000b50 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ b56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ b5c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b63:	5d                   	pop    %ebp
+ b64:	c3                   	ret
+ b65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+ b76:	83 ec 0c             	sub    $0xc,%esp
+ b79:	8b 75 08             	mov    0x8(%ebp),%esi
+ b7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ b7f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ b84:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ b86:	8b 3e                	mov    (%esi),%edi
+ b88:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ b8b:	83 f8 02             	cmp    $0x2,%eax
+ b8e:	74 60                	je     bf0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ b90:	83 ec 08             	sub    $0x8,%esp
+ b93:	57                   	push   %edi
+ b94:	56                   	push   %esi
+ b95:	e8 89 f9 ff ff       	call   523 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ b9a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ b9f:	31 c0                	xor    %eax,%eax
+ ba1:	ba 01 00 00 00       	mov    $0x1,%edx
+ ba6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ baa:	83 c4 10             	add    $0x10,%esp
+ bad:	85 c0                	test   %eax,%eax
+ baf:	74 36                	je     be7 <cond_wait+0x77>
+  if(c != 2)
+ bb1:	83 f8 02             	cmp    $0x2,%eax
+ bb4:	74 0c                	je     bc2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ bb6:	b8 02 00 00 00       	mov    $0x2,%eax
+ bbb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ bbe:	85 c0                	test   %eax,%eax
+ bc0:	74 25                	je     be7 <cond_wait+0x77>
+ bc2:	be 02 00 00 00       	mov    $0x2,%esi
+ bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bce:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ bd0:	83 ec 08             	sub    $0x8,%esp
+ bd3:	6a 02                	push   $0x2
+ bd5:	53                   	push   %ebx
+ bd6:	e8 48 f9 ff ff       	call   523 <futex_wait>
+ bdb:	89 f0                	mov    %esi,%eax
+ bdd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ be0:	83 c4 10             	add    $0x10,%esp
+ be3:	85 c0                	test   %eax,%eax
+ be5:	75 e9                	jne    bd0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ be7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bea:	5b                   	pop    %ebx
+ beb:	5e                   	pop    %esi
+ bec:	5f                   	pop    %edi
+ bed:	5d                   	pop    %ebp
+ bee:	c3                   	ret
+ bef:	90                   	nop
+    futex_wake(&m->val, 1);
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	6a 01                	push   $0x1
+ bf5:	53                   	push   %ebx
+ bf6:	e8 30 f9 ff ff       	call   52b <futex_wake>
+ bfb:	83 c4 10             	add    $0x10,%esp
+ bfe:	eb 90                	jmp    b90 <cond_wait+0x20>
+
+00000c00 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	83 ec 08             	sub    $0x8,%esp
+ c06:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c09:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c0d:	8b 50 04             	mov    0x4(%eax),%edx
+ c10:	85 d2                	test   %edx,%edx
+ c12:	75 0c                	jne    c20 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ c14:	c9                   	leave
+ c15:	c3                   	ret
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ c20:	83 ec 08             	sub    $0x8,%esp
+ c23:	6a 01                	push   $0x1
+ c25:	50                   	push   %eax
+ c26:	e8 00 f9 ff ff       	call   52b <futex_wake>
+ c2b:	83 c4 10             	add    $0x10,%esp
+}
+ c2e:	c9                   	leave
+ c2f:	c3                   	ret
+
+00000c30 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	83 ec 08             	sub    $0x8,%esp
+ c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c39:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c3d:	8b 50 04             	mov    0x4(%eax),%edx
+ c40:	85 d2                	test   %edx,%edx
+ c42:	75 0c                	jne    c50 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ c44:	c9                   	leave
+ c45:	c3                   	ret
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ c50:	83 ec 08             	sub    $0x8,%esp
+ c53:	68 ff ff ff 7f       	push   $0x7fffffff
+ c58:	50                   	push   %eax
+ c59:	e8 cd f8 ff ff       	call   52b <futex_wake>
+ c5e:	83 c4 10             	add    $0x10,%esp
+}
+ c61:	c9                   	leave
+ c62:	c3                   	ret
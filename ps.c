@@ -0,0 +1,72 @@
+// List processes with their CPU time and counters.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+
+static char *states[] = {
+[PS_EMBRYO]    "embryo",
+[PS_SLEEPING]  "sleep",
+[PS_RUNNABLE]  "runble",
+[PS_RUNNING]   "run",
+[PS_ZOMBIE]    "zombie",
+};
+
+struct procinfo pi[NPROC];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+int
+main(void)
+{
+  int i, n;
+
+  n = getprocinfo(pi, NPROC);
+  if(n < 0){
+    printf(2, "ps: getprocinfo failed\n");
+    exit();
+  }
+  printf(1, "PID   PPID  STATE   CPU  SZ      USER    SYS     "
+            "SYSCALLS  VCSW    IVCSW   FAULTS  NAME\n");
+  for(i = 0; i < n; i++){
+    coln(pi[i].pid, 6);
+    coln(pi[i].ppid, 6);
+    col(states[pi[i].state], 8);
+    coln(pi[i].cpu, 5);
+    coln(pi[i].sz, 8);
+    coln(pi[i].utime, 8);
+    coln(pi[i].stime, 8);
+    coln(pi[i].nsyscall, 10);
+    coln(pi[i].nvcsw, 8);
+    coln(pi[i].nivcsw, 8);
+    coln(pi[i].nfault, 8);
+    printf(1, "%s\n", pi[i].name);
+  }
+  exit();
+}
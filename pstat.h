@@ -0,0 +1,49 @@
+// Process information returned by getprocinfo().
+// Times are in milliseconds.
+
+#define PS_EMBRYO   1
+#define PS_SLEEPING 2
+#define PS_RUNNABLE 3
+#define PS_RUNNING  4
+#define PS_ZOMBIE   5
+
+struct procinfo {
+  int pid;
+  int ppid;
+  int state;       // PS_*
+  int cpu;         // CPU it last ran on
+  uint sz;         // Size of process memory (bytes)
+  uint utime;      // Time spent in user mode
+  uint stime;      // Time spent in the kernel
+  uint nvcsw;      // Voluntary context switches (sleeps)
+  uint nivcsw;     // Involuntary context switches (preemptions)
+  uint nsyscall;   // System calls made
+  uint nfault;     // Page faults taken
+  char name[16];
+};
+
+// Per-CPU event counts returned by cpustat(), one
+// struct per CPU.
+#define CS_SYSCALL  0   // System calls
+#define CS_INTR     1   // Interrupts, device and inter-processor
+#define CS_CSW      2   // Context switches into a process
+#define CS_TLBFLUSH 3   // TLB shootdowns handled
+#define CS_BHIT     4   // Buffer cache lookups that hit
+#define CS_BMISS    5   // and that missed
+#define CS_BEVICT   6   // Cached blocks evicted to make room
+#define CS_BPROMOTE 7   // Blocks moved to the buffer cache's hot set
+
+struct cpustat {
+  uint stat[NCPUSTAT];  // By CS_ above
+};
+
+// Real-time statistics returned by sched_dlstat().
+// Times are in microseconds.
+struct dlstat {
+  uint runtime;    // Runtime per period; 0 if not real-time
+  uint deadline;   // Deadline, relative to the start of a period
+  uint period;
+  uint jobs;       // Jobs finished with sched_dlyield
+  uint misses;     // Jobs finished after their deadline
+  uint overruns;   // Periods whose runtime ran out
+};
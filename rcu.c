@@ -0,0 +1,100 @@
+// Read-copy-update, for read-mostly data that readers
+// should reach without writing any shared cache line.
+//
+// Readers bracket their use of RCU-protected data with
+// rcureadlock() and rcureadunlock(), which only turn
+// interrupts off, and must not sleep in between.  A writer,
+// serialized with other writers by a lock of its own,
+// publishes a new version with a single pointer store and
+// passes a work item that frees the old one to rcucall().
+// The work is queued once every CPU has passed through a
+// quiescent state, where it can't be reading: the top of
+// the scheduler loop, a timer interrupt from user space, or
+// being idle.  A CPU that goes idle with callbacks of its own
+// waiting keeps its tick, so that it comes back to the
+// scheduler loop to hand them on.
+//
+// Grace periods are numbered by rcuepoch.  Each CPU keeps
+// new callbacks on its rcunext list.  When its rcuwait list
+// is empty it moves them there and starts a grace period
+// for them.  At each quiescent state a CPU notes the latest
+// grace period started, and a grace period is over once no
+// busy CPU has noted an earlier one.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "work.h"
+
+static volatile uint rcuepoch;  // latest grace period started; changed by xadd
+
+void
+rcureadlock(void)
+{
+  pushcli();
+}
+
+void
+rcureadunlock(void)
+{
+  popcli();
+}
+
+// Queue w once every current reader has finished.
+void
+rcucall(struct work *w)
+{
+  pushcli();
+  w->next = cpu->rcunext;
+  cpu->rcunext = w;
+  popcli();
+}
+
+// Has every CPU passed a quiescent state since grace
+// period epoch began?
+static int
+rcudone(uint epoch)
+{
+  struct cpu *c;
+
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(!c->idle && (int)(c->rcuepoch - epoch) < 0)
+      return 0;
+  return 1;
+}
+
+// Does this CPU have callbacks waiting for a grace period?
+// Called with interrupts off.
+int
+rcupending(void)
+{
+  return cpu->rcunext != 0 || cpu->rcuwait != 0;
+}
+
+// This CPU holds no references to RCU-protected data.
+void
+rcuquiescent(void)
+{
+  struct work *w, *next;
+
+  pushcli();
+  cpu->rcuepoch = rcuepoch;
+  if(cpu->rcuwait && rcudone(cpu->rcuwaitepoch)){
+    for(w = cpu->rcuwait; w; w = next){
+      next = w->next;
+      queuework(w);
+    }
+    cpu->rcuwait = 0;
+  }
+  if(cpu->rcuwait == 0 && cpu->rcunext){
+    cpu->rcuwait = cpu->rcunext;
+    cpu->rcunext = 0;
+    cpu->rcuwaitepoch = xadd((int*)&rcuepoch, 1) + 1;
+    cpu->rcuepoch = cpu->rcuwaitepoch;
+  }
+  popcli();
+}
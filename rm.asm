@@ -0,0 +1,1766 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 cf 02 00 00       	call   313 <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 e8 0a 00 00       	push   $0xae8
+  53:	6a 02                	push   $0x2
+  55:	e8 76 04 00 00       	call   4d0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 61 02 00 00       	call   2c3 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 d4 0a 00 00       	push   $0xad4
+  69:	6a 02                	push   $0x2
+  6b:	e8 60 04 00 00       	call   4d0 <printf>
+    exit();
+  70:	e8 4e 02 00 00       	call   2c3 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 1e 01 00 00       	call   2db <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 f1 00 00 00       	call   303 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 f4 00 00 00       	call   31b <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 ba 00 00 00       	call   2eb <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+
+000002bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <wait>:
+SYSCALL(wait)
+ 2cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <pipe>:
+SYSCALL(pipe)
+ 2d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <read>:
+SYSCALL(read)
+ 2db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <write>:
+SYSCALL(write)
+ 2e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <close>:
+SYSCALL(close)
+ 2eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <kill>:
+SYSCALL(kill)
+ 2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <exec>:
+SYSCALL(exec)
+ 2fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <open>:
+SYSCALL(open)
+ 303:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mknod>:
+SYSCALL(mknod)
+ 30b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <unlink>:
+SYSCALL(unlink)
+ 313:	b8 12 00 00 00       	mov    $0x12,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fstat>:
+SYSCALL(fstat)
+ 31b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mkdir>:
+SYSCALL(mkdir)
+ 32b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <chdir>:
+SYSCALL(chdir)
+ 333:	b8 09 00 00 00       	mov    $0x9,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <dup>:
+SYSCALL(dup)
+ 33b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getpid>:
+SYSCALL(getpid)
+ 343:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <sbrk>:
+SYSCALL(sbrk)
+ 34b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sleep>:
+SYSCALL(sleep)
+ 353:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <uptime>:
+SYSCALL(uptime)
+ 35b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <add_dir>:
+SYSCALL(add_dir)
+ 363:	b8 16 00 00 00       	mov    $0x16,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <history>:
+SYSCALL(history)
+ 36b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 373:	b8 19 00 00 00       	mov    $0x19,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <nanosleep>:
+SYSCALL(nanosleep)
+ 37b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <clone>:
+SYSCALL(clone)
+ 383:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <join>:
+SYSCALL(join)
+ 38b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <futex_wait>:
+SYSCALL(futex_wait)
+ 393:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <futex_wake>:
+SYSCALL(futex_wake)
+ 39b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 3a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 3ab:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 3b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getprocinfo>:
+SYSCALL(getprocinfo)
+ 3bb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <waitpid>:
+SYSCALL(waitpid)
+ 3c3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <tracectl>:
+SYSCALL(tracectl)
+ 3cb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <traceread>:
+SYSCALL(traceread)
+ 3d3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 3db:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 3e3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 3eb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <irqroute>:
+SYSCALL(irqroute)
+ 3f3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <irqstat>:
+SYSCALL(irqstat)
+ 3fb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <boottimes>:
+SYSCALL(boottimes)
+ 403:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <lockbench>:
+SYSCALL(lockbench)
+ 40b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <lockstat>:
+SYSCALL(lockstat)
+ 413:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <cpustat>:
+SYSCALL(cpustat)
+ 41b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <bcachesize>:
+SYSCALL(bcachesize)
+ 423:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+ 42b:	66 90                	xchg   %ax,%ax
+ 42d:	66 90                	xchg   %ax,%ax
+ 42f:	90                   	nop
+
+00000430 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 438:	89 d1                	mov    %edx,%ecx
+{
+ 43a:	83 ec 3c             	sub    $0x3c,%esp
+ 43d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 440:	85 d2                	test   %edx,%edx
+ 442:	0f 89 80 00 00 00    	jns    4c8 <printint+0x98>
+ 448:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 44c:	74 7a                	je     4c8 <printint+0x98>
+    x = -xx;
+ 44e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 450:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 455:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 458:	31 f6                	xor    %esi,%esi
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 460:	89 c8                	mov    %ecx,%eax
+ 462:	31 d2                	xor    %edx,%edx
+ 464:	89 f7                	mov    %esi,%edi
+ 466:	f7 f3                	div    %ebx
+ 468:	8d 76 01             	lea    0x1(%esi),%esi
+ 46b:	0f b6 92 60 0b 00 00 	movzbl 0xb60(%edx),%edx
+ 472:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 476:	89 ca                	mov    %ecx,%edx
+ 478:	89 c1                	mov    %eax,%ecx
+ 47a:	39 da                	cmp    %ebx,%edx
+ 47c:	73 e2                	jae    460 <printint+0x30>
+  if(neg)
+ 47e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 481:	85 c0                	test   %eax,%eax
+ 483:	74 07                	je     48c <printint+0x5c>
+    buf[i++] = '-';
+ 485:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 48a:	89 f7                	mov    %esi,%edi
+ 48c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 48f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 492:	01 df                	add    %ebx,%edi
+ 494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 498:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 49b:	83 ec 04             	sub    $0x4,%esp
+ 49e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4a4:	6a 01                	push   $0x1
+ 4a6:	50                   	push   %eax
+ 4a7:	56                   	push   %esi
+ 4a8:	e8 36 fe ff ff       	call   2e3 <write>
+  while(--i >= 0)
+ 4ad:	89 f8                	mov    %edi,%eax
+ 4af:	83 c4 10             	add    $0x10,%esp
+ 4b2:	83 ef 01             	sub    $0x1,%edi
+ 4b5:	39 d8                	cmp    %ebx,%eax
+ 4b7:	75 df                	jne    498 <printint+0x68>
+}
+ 4b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bc:	5b                   	pop    %ebx
+ 4bd:	5e                   	pop    %esi
+ 4be:	5f                   	pop    %edi
+ 4bf:	5d                   	pop    %ebp
+ 4c0:	c3                   	ret
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4c8:	31 c0                	xor    %eax,%eax
+ 4ca:	eb 89                	jmp    455 <printint+0x25>
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4df:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e2:	83 c6 01             	add    $0x1,%esi
+ 4e5:	84 db                	test   %bl,%bl
+ 4e7:	74 67                	je     550 <printf+0x80>
+ 4e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ec:	31 d2                	xor    %edx,%edx
+ 4ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4f1:	eb 34                	jmp    527 <printf+0x57>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 500:	83 f8 25             	cmp    $0x25,%eax
+ 503:	74 18                	je     51d <printf+0x4d>
+  write(fd, &c, 1);
+ 505:	83 ec 04             	sub    $0x4,%esp
+ 508:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 50b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50e:	6a 01                	push   $0x1
+ 510:	50                   	push   %eax
+ 511:	57                   	push   %edi
+ 512:	e8 cc fd ff ff       	call   2e3 <write>
+ 517:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 51a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 51d:	0f b6 1e             	movzbl (%esi),%ebx
+ 520:	83 c6 01             	add    $0x1,%esi
+ 523:	84 db                	test   %bl,%bl
+ 525:	74 29                	je     550 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 527:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 52a:	85 d2                	test   %edx,%edx
+ 52c:	74 ca                	je     4f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 52e:	83 fa 25             	cmp    $0x25,%edx
+ 531:	75 ea                	jne    51d <printf+0x4d>
+      if(c == 'd'){
+ 533:	83 f8 25             	cmp    $0x25,%eax
+ 536:	0f 84 24 01 00 00    	je     660 <printf+0x190>
+ 53c:	83 e8 63             	sub    $0x63,%eax
+ 53f:	83 f8 15             	cmp    $0x15,%eax
+ 542:	77 1c                	ja     560 <printf+0x90>
+ 544:	ff 24 85 08 0b 00 00 	jmp    *0xb08(,%eax,4)
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 553:	5b                   	pop    %ebx
+ 554:	5e                   	pop    %esi
+ 555:	5f                   	pop    %edi
+ 556:	5d                   	pop    %ebp
+ 557:	c3                   	ret
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+  write(fd, &c, 1);
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 566:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 56a:	6a 01                	push   $0x1
+ 56c:	52                   	push   %edx
+ 56d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 570:	57                   	push   %edi
+ 571:	e8 6d fd ff ff       	call   2e3 <write>
+ 576:	83 c4 0c             	add    $0xc,%esp
+ 579:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57c:	6a 01                	push   $0x1
+ 57e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 581:	52                   	push   %edx
+ 582:	57                   	push   %edi
+ 583:	e8 5b fd ff ff       	call   2e3 <write>
+        putc(fd, c);
+ 588:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58b:	31 d2                	xor    %edx,%edx
+ 58d:	eb 8e                	jmp    51d <printf+0x4d>
+ 58f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 590:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 593:	83 ec 0c             	sub    $0xc,%esp
+ 596:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 59b:	8b 13                	mov    (%ebx),%edx
+ 59d:	6a 00                	push   $0x0
+ 59f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5a4:	e8 87 fe ff ff       	call   430 <printint>
+        ap++;
+ 5a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 67 ff ff ff       	jmp    51d <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5c5:	83 c0 04             	add    $0x4,%eax
+ 5c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5cb:	85 db                	test   %ebx,%ebx
+ 5cd:	0f 84 9d 00 00 00    	je     670 <printf+0x1a0>
+        while(*s != 0){
+ 5d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	0f 84 3d ff ff ff    	je     51d <printf+0x4d>
+ 5e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5e6:	89 de                	mov    %ebx,%esi
+ 5e8:	89 d3                	mov    %edx,%ebx
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	53                   	push   %ebx
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 e1 fc ff ff       	call   2e3 <write>
+        while(*s != 0){
+ 602:	0f b6 06             	movzbl (%esi),%eax
+ 605:	83 c4 10             	add    $0x10,%esp
+ 608:	84 c0                	test   %al,%al
+ 60a:	75 e4                	jne    5f0 <printf+0x120>
+      state = 0;
+ 60c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 07 ff ff ff       	jmp    51d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 01                	push   $0x1
+ 62f:	e9 6b ff ff ff       	jmp    59f <printf+0xcf>
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 638:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 641:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 643:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 646:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 649:	6a 01                	push   $0x1
+ 64b:	52                   	push   %edx
+ 64c:	57                   	push   %edi
+ 64d:	e8 91 fc ff ff       	call   2e3 <write>
+        ap++;
+ 652:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 655:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 658:	31 d2                	xor    %edx,%edx
+ 65a:	e9 be fe ff ff       	jmp    51d <printf+0x4d>
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 666:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 669:	6a 01                	push   $0x1
+ 66b:	e9 11 ff ff ff       	jmp    581 <printf+0xb1>
+ 670:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 675:	bb 01 0b 00 00       	mov    $0xb01,%ebx
+ 67a:	e9 61 ff ff ff       	jmp    5e0 <printf+0x110>
+ 67f:	90                   	nop
+
+00000680 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 680:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 681:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 684:	89 e5                	mov    %esp,%ebp
+ 686:	57                   	push   %edi
+ 687:	56                   	push   %esi
+ 688:	53                   	push   %ebx
+ 689:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 68b:	a1 fc 0f 00 00       	mov    0xffc,%eax
+ 690:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 692:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 694:	39 ca                	cmp    %ecx,%edx
+ 696:	73 30                	jae    6c8 <ufree+0x48>
+ 698:	39 c1                	cmp    %eax,%ecx
+ 69a:	72 04                	jb     6a0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69c:	39 c2                	cmp    %eax,%edx
+ 69e:	72 f0                	jb     690 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6a3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6a6:	39 f8                	cmp    %edi,%eax
+ 6a8:	74 26                	je     6d0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 6b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6b3:	39 f1                	cmp    %esi,%ecx
+ 6b5:	74 30                	je     6e7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6b7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6b9:	5b                   	pop    %ebx
+  freep = p;
+ 6ba:	89 15 fc 0f 00 00    	mov    %edx,0xffc
+}
+ 6c0:	5e                   	pop    %esi
+ 6c1:	5f                   	pop    %edi
+ 6c2:	5d                   	pop    %ebp
+ 6c3:	c3                   	ret
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6c8:	39 c1                	cmp    %eax,%ecx
+ 6ca:	72 d0                	jb     69c <ufree+0x1c>
+ 6cc:	eb c2                	jmp    690 <ufree+0x10>
+ 6ce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6d0:	03 70 04             	add    0x4(%eax),%esi
+ 6d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6d6:	8b 02                	mov    (%edx),%eax
+ 6d8:	8b 00                	mov    (%eax),%eax
+ 6da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6e3:	39 f1                	cmp    %esi,%ecx
+ 6e5:	75 d0                	jne    6b7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 6e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ea:	89 15 fc 0f 00 00    	mov    %edx,0xffc
+    p->s.size += bp->s.size;
+ 6f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6f8:	5b                   	pop    %ebx
+ 6f9:	5e                   	pop    %esi
+ 6fa:	5f                   	pop    %edi
+ 6fb:	5d                   	pop    %ebp
+ 6fc:	c3                   	ret
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000700 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	53                   	push   %ebx
+ 704:	83 ec 10             	sub    $0x10,%esp
+ 707:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 70a:	68 f8 0f 00 00       	push   $0xff8
+ 70f:	e8 ec 01 00 00       	call   900 <lock_acquire>
+  ufree(ap);
+ 714:	89 d8                	mov    %ebx,%eax
+ 716:	e8 65 ff ff ff       	call   680 <ufree>
+  lock_release(&mlock);
+ 71b:	c7 45 08 f8 0f 00 00 	movl   $0xff8,0x8(%ebp)
+}
+ 722:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 725:	83 c4 10             	add    $0x10,%esp
+}
+ 728:	c9                   	leave
+  lock_release(&mlock);
+ 729:	e9 f2 01 00 00       	jmp    920 <lock_release>
+ 72e:	66 90                	xchg   %ax,%ax
+
+00000730 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 739:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 73c:	68 f8 0f 00 00       	push   $0xff8
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 741:	8d 48 07             	lea    0x7(%eax),%ecx
+ 744:	c1 e9 03             	shr    $0x3,%ecx
+ 747:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 74a:	e8 b1 01 00 00       	call   900 <lock_acquire>
+  if((prevp = freep) == 0){
+ 74f:	8b 15 fc 0f 00 00    	mov    0xffc,%edx
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	85 d2                	test   %edx,%edx
+ 75a:	0f 84 b0 00 00 00    	je     810 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 760:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 762:	8b 47 04             	mov    0x4(%edi),%eax
+ 765:	39 f0                	cmp    %esi,%eax
+ 767:	73 6f                	jae    7d8 <malloc+0xa8>
+  if(nu < 4096)
+ 769:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 76e:	39 de                	cmp    %ebx,%esi
+ 770:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 773:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 77a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 77d:	eb 0a                	jmp    789 <malloc+0x59>
+ 77f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 780:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 782:	8b 47 04             	mov    0x4(%edi),%eax
+ 785:	39 f0                	cmp    %esi,%eax
+ 787:	73 4f                	jae    7d8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 789:	89 fa                	mov    %edi,%edx
+ 78b:	39 3d fc 0f 00 00    	cmp    %edi,0xffc
+ 791:	75 ed                	jne    780 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	ff 75 e4             	push   -0x1c(%ebp)
+ 799:	e8 ad fb ff ff       	call   34b <sbrk>
+  if(p == (char*)-1)
+ 79e:	83 c4 10             	add    $0x10,%esp
+ 7a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7a4:	74 15                	je     7bb <malloc+0x8b>
+  hp->s.size = nu;
+ 7a6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 7a9:	83 c0 08             	add    $0x8,%eax
+ 7ac:	e8 cf fe ff ff       	call   680 <ufree>
+  return freep;
+ 7b1:	8b 15 fc 0f 00 00    	mov    0xffc,%edx
+      if((p = morecore(nunits)) == 0){
+ 7b7:	85 d2                	test   %edx,%edx
+ 7b9:	75 c5                	jne    780 <malloc+0x50>
+        lock_release(&mlock);
+ 7bb:	83 ec 0c             	sub    $0xc,%esp
+ 7be:	68 f8 0f 00 00       	push   $0xff8
+ 7c3:	e8 58 01 00 00       	call   920 <lock_release>
+        return 0;
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 7cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7ce:	31 c0                	xor    %eax,%eax
+}
+ 7d0:	5b                   	pop    %ebx
+ 7d1:	5e                   	pop    %esi
+ 7d2:	5f                   	pop    %edi
+ 7d3:	5d                   	pop    %ebp
+ 7d4:	c3                   	ret
+ 7d5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7d8:	39 c6                	cmp    %eax,%esi
+ 7da:	74 64                	je     840 <malloc+0x110>
+        p->s.size -= nunits;
+ 7dc:	29 f0                	sub    %esi,%eax
+ 7de:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 7e1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 7e4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 7e7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 7ea:	89 15 fc 0f 00 00    	mov    %edx,0xffc
+      lock_release(&mlock);
+ 7f0:	68 f8 0f 00 00       	push   $0xff8
+ 7f5:	e8 26 01 00 00       	call   920 <lock_release>
+      return (void*)(p + 1);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+}
+ 7fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 800:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 803:	5b                   	pop    %ebx
+ 804:	5e                   	pop    %esi
+ 805:	5f                   	pop    %edi
+ 806:	5d                   	pop    %ebp
+ 807:	c3                   	ret
+ 808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 810:	c7 05 fc 0f 00 00 00 	movl   $0x1000,0xffc
+ 817:	10 00 00 
+    base.s.size = 0;
+ 81a:	bf 00 10 00 00       	mov    $0x1000,%edi
+    base.s.ptr = freep = prevp = &base;
+ 81f:	c7 05 00 10 00 00 00 	movl   $0x1000,0x1000
+ 826:	10 00 00 
+    base.s.size = 0;
+ 829:	c7 05 04 10 00 00 00 	movl   $0x0,0x1004
+ 830:	00 00 00 
+    if(p->s.size >= nunits){
+ 833:	e9 31 ff ff ff       	jmp    769 <malloc+0x39>
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 840:	8b 07                	mov    (%edi),%eax
+ 842:	89 02                	mov    %eax,(%edx)
+ 844:	eb a1                	jmp    7e7 <malloc+0xb7>
+ 846:	66 90                	xchg   %ax,%ax
+ 848:	66 90                	xchg   %ax,%ax
+ 84a:	66 90                	xchg   %ax,%ax
+ 84c:	66 90                	xchg   %ax,%ax
+ 84e:	66 90                	xchg   %ax,%ax
+
+00000850 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	53                   	push   %ebx
+ 854:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 857:	68 00 10 00 00       	push   $0x1000
+ 85c:	e8 cf fe ff ff       	call   730 <malloc>
+ 861:	83 c4 10             	add    $0x10,%esp
+ 864:	85 c0                	test   %eax,%eax
+ 866:	74 37                	je     89f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 868:	83 ec 04             	sub    $0x4,%esp
+ 86b:	89 c3                	mov    %eax,%ebx
+ 86d:	50                   	push   %eax
+ 86e:	ff 75 0c             	push   0xc(%ebp)
+ 871:	ff 75 08             	push   0x8(%ebp)
+ 874:	e8 0a fb ff ff       	call   383 <clone>
+ 879:	83 c4 10             	add    $0x10,%esp
+ 87c:	85 c0                	test   %eax,%eax
+ 87e:	78 08                	js     888 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 883:	c9                   	leave
+ 884:	c3                   	ret
+ 885:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 888:	83 ec 0c             	sub    $0xc,%esp
+ 88b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 88e:	53                   	push   %ebx
+ 88f:	e8 6c fe ff ff       	call   700 <free>
+ 894:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 89a:	83 c4 10             	add    $0x10,%esp
+}
+ 89d:	c9                   	leave
+ 89e:	c3                   	ret
+    return -1;
+ 89f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 8a4:	eb da                	jmp    880 <thread_create+0x30>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008b0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 8b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8b9:	50                   	push   %eax
+ 8ba:	e8 cc fa ff ff       	call   38b <join>
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	85 c0                	test   %eax,%eax
+ 8c4:	79 0a                	jns    8d0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 8c6:	c9                   	leave
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+ 8d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	ff 75 f4             	push   -0xc(%ebp)
+ 8d9:	e8 22 fe ff ff       	call   700 <free>
+ 8de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e1:	83 c4 10             	add    $0x10,%esp
+}
+ 8e4:	c9                   	leave
+ 8e5:	c3                   	ret
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 8f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8fc:	5d                   	pop    %ebp
+ 8fd:	c3                   	ret
+ 8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 900:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 901:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 906:	89 e5                	mov    %esp,%ebp
+ 908:	8b 55 08             	mov    0x8(%ebp),%edx
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+ 910:	89 c8                	mov    %ecx,%eax
+ 912:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 915:	85 c0                	test   %eax,%eax
+ 917:	75 f7                	jne    910 <lock_acquire+0x10>
+    ;
+}
+ 919:	5d                   	pop    %ebp
+ 91a:	c3                   	ret
+ 91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+
+00000920 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 920:	55                   	push   %ebp
+ 921:	31 c0                	xor    %eax,%eax
+ 923:	89 e5                	mov    %esp,%ebp
+ 925:	8b 55 08             	mov    0x8(%ebp),%edx
+ 928:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 92b:	5d                   	pop    %ebp
+ 92c:	c3                   	ret
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000930 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 933:	8b 45 08             	mov    0x8(%ebp),%eax
+ 936:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 93c:	5d                   	pop    %ebp
+ 93d:	c3                   	ret
+ 93e:	66 90                	xchg   %ax,%ax
+
+00000940 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 940:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 941:	31 c0                	xor    %eax,%eax
+ 943:	ba 01 00 00 00       	mov    $0x1,%edx
+ 948:	89 e5                	mov    %esp,%ebp
+ 94a:	56                   	push   %esi
+ 94b:	53                   	push   %ebx
+ 94c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 94f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 953:	85 c0                	test   %eax,%eax
+ 955:	74 30                	je     987 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 957:	83 f8 02             	cmp    $0x2,%eax
+ 95a:	74 0c                	je     968 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 95c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 961:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 964:	85 c0                	test   %eax,%eax
+ 966:	74 1f                	je     987 <mutex_lock+0x47>
+ 968:	be 02 00 00 00       	mov    $0x2,%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ 970:	83 ec 08             	sub    $0x8,%esp
+ 973:	6a 02                	push   $0x2
+ 975:	53                   	push   %ebx
+ 976:	e8 18 fa ff ff       	call   393 <futex_wait>
+ 97b:	89 f0                	mov    %esi,%eax
+ 97d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 980:	83 c4 10             	add    $0x10,%esp
+ 983:	85 c0                	test   %eax,%eax
+ 985:	75 e9                	jne    970 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ 987:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 98a:	5b                   	pop    %ebx
+ 98b:	5e                   	pop    %esi
+ 98c:	5d                   	pop    %ebp
+ 98d:	c3                   	ret
+ 98e:	66 90                	xchg   %ax,%ax
+
+00000990 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 990:	55                   	push   %ebp
+ 991:	31 c0                	xor    %eax,%eax
+ 993:	89 e5                	mov    %esp,%ebp
+ 995:	83 ec 08             	sub    $0x8,%esp
+ 998:	8b 55 08             	mov    0x8(%ebp),%edx
+ 99b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ 99e:	83 f8 02             	cmp    $0x2,%eax
+ 9a1:	74 05                	je     9a8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ 9a3:	c9                   	leave
+ 9a4:	c3                   	ret
+ 9a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ 9a8:	83 ec 08             	sub    $0x8,%esp
+ 9ab:	6a 01                	push   $0x1
+ 9ad:	52                   	push   %edx
+ 9ae:	e8 e8 f9 ff ff       	call   39b <futex_wake>
+ 9b3:	83 c4 10             	add    $0x10,%esp
+}
+ 9b6:	c9                   	leave
+ 9b7:	c3                   	ret
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+
+000009c0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ 9c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ 9cc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 9d3:	5d                   	pop    %ebp
+ 9d4:	c3                   	ret
+ 9d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 0c             	sub    $0xc,%esp
+ 9e9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 9ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ 9ef:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ 9f4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ 9f6:	8b 3e                	mov    (%esi),%edi
+ 9f8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ 9fb:	83 f8 02             	cmp    $0x2,%eax
+ 9fe:	74 60                	je     a60 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ a00:	83 ec 08             	sub    $0x8,%esp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	e8 89 f9 ff ff       	call   393 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ a0a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ a0f:	31 c0                	xor    %eax,%eax
+ a11:	ba 01 00 00 00       	mov    $0x1,%edx
+ a16:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ a1a:	83 c4 10             	add    $0x10,%esp
+ a1d:	85 c0                	test   %eax,%eax
+ a1f:	74 36                	je     a57 <cond_wait+0x77>
+  if(c != 2)
+ a21:	83 f8 02             	cmp    $0x2,%eax
+ a24:	74 0c                	je     a32 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ a26:	b8 02 00 00 00       	mov    $0x2,%eax
+ a2b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a2e:	85 c0                	test   %eax,%eax
+ a30:	74 25                	je     a57 <cond_wait+0x77>
+ a32:	be 02 00 00 00       	mov    $0x2,%esi
+ a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ a40:	83 ec 08             	sub    $0x8,%esp
+ a43:	6a 02                	push   $0x2
+ a45:	53                   	push   %ebx
+ a46:	e8 48 f9 ff ff       	call   393 <futex_wait>
+ a4b:	89 f0                	mov    %esi,%eax
+ a4d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a50:	83 c4 10             	add    $0x10,%esp
+ a53:	85 c0                	test   %eax,%eax
+ a55:	75 e9                	jne    a40 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a5a:	5b                   	pop    %ebx
+ a5b:	5e                   	pop    %esi
+ a5c:	5f                   	pop    %edi
+ a5d:	5d                   	pop    %ebp
+ a5e:	c3                   	ret
+ a5f:	90                   	nop
+    futex_wake(&m->val, 1);
+ a60:	83 ec 08             	sub    $0x8,%esp
+ a63:	6a 01                	push   $0x1
+ a65:	53                   	push   %ebx
+ a66:	e8 30 f9 ff ff       	call   39b <futex_wake>
+ a6b:	83 c4 10             	add    $0x10,%esp
+ a6e:	eb 90                	jmp    a00 <cond_wait+0x20>
+
+00000a70 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	83 ec 08             	sub    $0x8,%esp
+ a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a79:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a7d:	8b 50 04             	mov    0x4(%eax),%edx
+ a80:	85 d2                	test   %edx,%edx
+ a82:	75 0c                	jne    a90 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ a84:	c9                   	leave
+ a85:	c3                   	ret
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ a90:	83 ec 08             	sub    $0x8,%esp
+ a93:	6a 01                	push   $0x1
+ a95:	50                   	push   %eax
+ a96:	e8 00 f9 ff ff       	call   39b <futex_wake>
+ a9b:	83 c4 10             	add    $0x10,%esp
+}
+ a9e:	c9                   	leave
+ a9f:	c3                   	ret
+
+00000aa0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	83 ec 08             	sub    $0x8,%esp
+ aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ aa9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ aad:	8b 50 04             	mov    0x4(%eax),%edx
+ ab0:	85 d2                	test   %edx,%edx
+ ab2:	75 0c                	jne    ac0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ ab4:	c9                   	leave
+ ab5:	c3                   	ret
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ ac0:	83 ec 08             	sub    $0x8,%esp
+ ac3:	68 ff ff ff 7f       	push   $0x7fffffff
+ ac8:	50                   	push   %eax
+ ac9:	e8 cd f8 ff ff       	call   39b <futex_wake>
+ ace:	83 c4 10             	add    $0x10,%esp
+}
+ ad1:	c9                   	leave
+ ad2:	c3                   	ret
@@ -0,0 +1,2092 @@
+
+_rtbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 48             	sub    $0x48,%esp
+  14:	8b 11                	mov    (%ecx),%edx
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  deadline = 5000;
+  period = 10000;
+  work = 1000;
+  njob = 100;
+  nhog = 4;
+  for(i = 1; i+1 < argc; i += 2){
+  19:	83 fa 02             	cmp    $0x2,%edx
+  1c:	0f 8e ec 02 00 00    	jle    30e <main+0x30e>
+  22:	8d 7a fd             	lea    -0x3(%edx),%edi
+  nhog = 4;
+  25:	c7 45 b0 04 00 00 00 	movl   $0x4,-0x50(%ebp)
+  2c:	83 c3 04             	add    $0x4,%ebx
+  for(i = 1; i+1 < argc; i += 2){
+  2f:	be 01 00 00 00       	mov    $0x1,%esi
+  34:	83 e7 fe             	and    $0xfffffffe,%edi
+  njob = 100;
+  37:	c7 45 b4 64 00 00 00 	movl   $0x64,-0x4c(%ebp)
+  work = 1000;
+  3e:	c7 45 c4 e8 03 00 00 	movl   $0x3e8,-0x3c(%ebp)
+  45:	83 c7 03             	add    $0x3,%edi
+  period = 10000;
+  48:	c7 45 b8 10 27 00 00 	movl   $0x2710,-0x48(%ebp)
+  deadline = 5000;
+  4f:	c7 45 bc 88 13 00 00 	movl   $0x1388,-0x44(%ebp)
+  runtime = 2000;
+  56:	c7 45 c0 d0 07 00 00 	movl   $0x7d0,-0x40(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  5d:	89 55 ac             	mov    %edx,-0x54(%ebp)
+  60:	eb 21                	jmp    83 <main+0x83>
+  62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(strcmp(argv[i], "-r") == 0)
+      runtime = atoi(argv[i+1]);
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	ff 73 04             	push   0x4(%ebx)
+  6e:	e8 fd 04 00 00       	call   570 <atoi>
+  73:	83 c4 10             	add    $0x10,%esp
+  76:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  79:	83 c6 02             	add    $0x2,%esi
+  7c:	83 c3 08             	add    $0x8,%ebx
+  7f:	39 fe                	cmp    %edi,%esi
+  81:	74 47                	je     ca <main+0xca>
+    if(strcmp(argv[i], "-r") == 0)
+  83:	83 ec 08             	sub    $0x8,%esp
+  86:	68 f4 0d 00 00       	push   $0xdf4
+  8b:	ff 33                	push   (%ebx)
+  8d:	e8 3e 03 00 00       	call   3d0 <strcmp>
+  92:	83 c4 10             	add    $0x10,%esp
+  95:	85 c0                	test   %eax,%eax
+  97:	74 cf                	je     68 <main+0x68>
+    else if(strcmp(argv[i], "-d") == 0)
+  99:	83 ec 08             	sub    $0x8,%esp
+  9c:	68 f7 0d 00 00       	push   $0xdf7
+  a1:	ff 33                	push   (%ebx)
+  a3:	e8 28 03 00 00       	call   3d0 <strcmp>
+  a8:	83 c4 10             	add    $0x10,%esp
+  ab:	85 c0                	test   %eax,%eax
+  ad:	75 51                	jne    100 <main+0x100>
+      deadline = atoi(argv[i+1]);
+  af:	83 ec 0c             	sub    $0xc,%esp
+  b2:	ff 73 04             	push   0x4(%ebx)
+  for(i = 1; i+1 < argc; i += 2){
+  b5:	83 c6 02             	add    $0x2,%esi
+  b8:	83 c3 08             	add    $0x8,%ebx
+      deadline = atoi(argv[i+1]);
+  bb:	e8 b0 04 00 00       	call   570 <atoi>
+  c0:	83 c4 10             	add    $0x10,%esp
+  c3:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  c6:	39 fe                	cmp    %edi,%esi
+  c8:	75 b9                	jne    83 <main+0x83>
+  ca:	8b 55 ac             	mov    -0x54(%ebp),%edx
+    else if(strcmp(argv[i], "-l") == 0)
+      nhog = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || njob <= 0 || nhog < 0 || nhog > MAXHOG){
+  cd:	39 fa                	cmp    %edi,%edx
+  cf:	7f 13                	jg     e4 <main+0xe4>
+  d1:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  d4:	85 f6                	test   %esi,%esi
+  d6:	7e 0c                	jle    e4 <main+0xe4>
+  d8:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  db:	83 f8 40             	cmp    $0x40,%eax
+  de:	0f 86 d7 00 00 00    	jbe    1bb <main+0x1bb>
+    printf(2, "usage: rtbench [-r runtime] [-d deadline] [-p period] "
+  e4:	53                   	push   %ebx
+  e5:	53                   	push   %ebx
+  e6:	68 24 0e 00 00       	push   $0xe24
+  eb:	6a 02                	push   $0x2
+  ed:	e8 fe 06 00 00       	call   7f0 <printf>
+           "[-w work] [-n jobs] [-l hogs]\n");
+    exit();
+  f2:	e8 ec 04 00 00       	call   5e3 <exit>
+  f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fe:	66 90                	xchg   %ax,%ax
+    else if(strcmp(argv[i], "-p") == 0)
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 fa 0d 00 00       	push   $0xdfa
+ 108:	ff 33                	push   (%ebx)
+ 10a:	e8 c1 02 00 00       	call   3d0 <strcmp>
+ 10f:	83 c4 10             	add    $0x10,%esp
+ 112:	85 c0                	test   %eax,%eax
+ 114:	75 1a                	jne    130 <main+0x130>
+      period = atoi(argv[i+1]);
+ 116:	83 ec 0c             	sub    $0xc,%esp
+ 119:	ff 73 04             	push   0x4(%ebx)
+ 11c:	e8 4f 04 00 00       	call   570 <atoi>
+ 121:	83 c4 10             	add    $0x10,%esp
+ 124:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 127:	e9 4d ff ff ff       	jmp    79 <main+0x79>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    else if(strcmp(argv[i], "-w") == 0)
+ 130:	83 ec 08             	sub    $0x8,%esp
+ 133:	68 fd 0d 00 00       	push   $0xdfd
+ 138:	ff 33                	push   (%ebx)
+ 13a:	e8 91 02 00 00       	call   3d0 <strcmp>
+ 13f:	83 c4 10             	add    $0x10,%esp
+ 142:	85 c0                	test   %eax,%eax
+ 144:	75 1a                	jne    160 <main+0x160>
+      work = atoi(argv[i+1]);
+ 146:	83 ec 0c             	sub    $0xc,%esp
+ 149:	ff 73 04             	push   0x4(%ebx)
+ 14c:	e8 1f 04 00 00       	call   570 <atoi>
+ 151:	83 c4 10             	add    $0x10,%esp
+ 154:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 157:	e9 1d ff ff ff       	jmp    79 <main+0x79>
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    else if(strcmp(argv[i], "-n") == 0)
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	68 00 0e 00 00       	push   $0xe00
+ 168:	ff 33                	push   (%ebx)
+ 16a:	e8 61 02 00 00       	call   3d0 <strcmp>
+ 16f:	83 c4 10             	add    $0x10,%esp
+ 172:	85 c0                	test   %eax,%eax
+ 174:	75 16                	jne    18c <main+0x18c>
+      njob = atoi(argv[i+1]);
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	ff 73 04             	push   0x4(%ebx)
+ 17c:	e8 ef 03 00 00       	call   570 <atoi>
+ 181:	83 c4 10             	add    $0x10,%esp
+ 184:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 187:	e9 ed fe ff ff       	jmp    79 <main+0x79>
+    else if(strcmp(argv[i], "-l") == 0)
+ 18c:	50                   	push   %eax
+ 18d:	50                   	push   %eax
+ 18e:	68 03 0e 00 00       	push   $0xe03
+ 193:	ff 33                	push   (%ebx)
+ 195:	e8 36 02 00 00       	call   3d0 <strcmp>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	85 c0                	test   %eax,%eax
+ 19f:	0f 85 a1 01 00 00    	jne    346 <main+0x346>
+      nhog = atoi(argv[i+1]);
+ 1a5:	83 ec 0c             	sub    $0xc,%esp
+ 1a8:	ff 73 04             	push   0x4(%ebx)
+ 1ab:	e8 c0 03 00 00       	call   570 <atoi>
+ 1b0:	83 c4 10             	add    $0x10,%esp
+ 1b3:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 1b6:	e9 be fe ff ff       	jmp    79 <main+0x79>
+  }
+
+  for(i = 0; i < nhog; i++){
+ 1bb:	85 c0                	test   %eax,%eax
+ 1bd:	74 2a                	je     1e9 <main+0x1e9>
+  runtime = 2000;
+ 1bf:	8b 75 b0             	mov    -0x50(%ebp),%esi
+ 1c2:	31 db                	xor    %ebx,%ebx
+ 1c4:	eb 11                	jmp    1d7 <main+0x1d7>
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nhog; i++){
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	39 de                	cmp    %ebx,%esi
+ 1d5:	74 12                	je     1e9 <main+0x1e9>
+    if((hogs[i] = fork()) == 0)
+ 1d7:	e8 ff 03 00 00       	call   5db <fork>
+ 1dc:	89 04 9d e0 13 00 00 	mov    %eax,0x13e0(,%ebx,4)
+ 1e3:	85 c0                	test   %eax,%eax
+ 1e5:	75 e9                	jne    1d0 <main+0x1d0>
+      for(;;)
+ 1e7:	eb fe                	jmp    1e7 <main+0x1e7>
+        ;
+  }
+  if(sched_setdeadline(0, runtime, deadline, period) < 0){
+ 1e9:	ff 75 b8             	push   -0x48(%ebp)
+ 1ec:	ff 75 bc             	push   -0x44(%ebp)
+ 1ef:	ff 75 c0             	push   -0x40(%ebp)
+ 1f2:	6a 00                	push   $0x0
+ 1f4:	e8 02 05 00 00       	call   6fb <sched_setdeadline>
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	85 c0                	test   %eax,%eax
+ 1fe:	0f 88 4c 01 00 00    	js     350 <main+0x350>
+
+  // The first period starts now, and each one after the
+  // last, or when the job before finished if that was later.
+  // The response time runs from the start of the period.
+  worst = 0;
+  rel = usecs();
+ 204:	e8 67 01 00 00       	call   370 <usecs>
+  for(i = 0; i < njob; i++){
+ 209:	31 d2                	xor    %edx,%edx
+ 20b:	8d 75 d0             	lea    -0x30(%ebp),%esi
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 20e:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+  rel = usecs();
+ 213:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  for(i = 0; i < njob; i++){
+ 216:	89 55 bc             	mov    %edx,-0x44(%ebp)
+ 219:	89 55 c0             	mov    %edx,-0x40(%ebp)
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    t0 = usecs();
+ 220:	e8 4b 01 00 00       	call   370 <usecs>
+ 225:	89 c3                	mov    %eax,%ebx
+    while(usecs() - t0 < work)
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	56                   	push   %esi
+ 234:	6a 01                	push   $0x1
+ 236:	e8 58 04 00 00       	call   693 <clock_gettime>
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 23b:	89 f8                	mov    %edi,%eax
+ 23d:	f7 65 d4             	mull   -0x2c(%ebp)
+    while(usecs() - t0 < work)
+ 240:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 243:	69 4d d0 40 42 0f 00 	imul   $0xf4240,-0x30(%ebp),%ecx
+    while(usecs() - t0 < work)
+ 24a:	83 c4 10             	add    $0x10,%esp
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 24d:	c1 ea 06             	shr    $0x6,%edx
+ 250:	01 d1                	add    %edx,%ecx
+    while(usecs() - t0 < work)
+ 252:	29 d9                	sub    %ebx,%ecx
+ 254:	39 c1                	cmp    %eax,%ecx
+ 256:	72 d8                	jb     230 <main+0x230>
+      ;
+    t = usecs();
+ 258:	e8 13 01 00 00       	call   370 <usecs>
+    if(t - rel > worst)
+ 25d:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+ 260:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+ 263:	89 c2                	mov    %eax,%edx
+ 265:	29 da                	sub    %ebx,%edx
+ 267:	39 d1                	cmp    %edx,%ecx
+ 269:	0f 42 ca             	cmovb  %edx,%ecx
+ 26c:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+      worst = t - rel;
+    rel = t - rel > period ? t : rel + period;
+ 26f:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+ 272:	01 d9                	add    %ebx,%ecx
+ 274:	39 55 b8             	cmp    %edx,-0x48(%ebp)
+ 277:	0f 43 c1             	cmovae %ecx,%eax
+ 27a:	89 45 ac             	mov    %eax,-0x54(%ebp)
+    sched_dlyield();
+ 27d:	e8 81 04 00 00       	call   703 <sched_dlyield>
+  for(i = 0; i < njob; i++){
+ 282:	83 45 c0 01          	addl   $0x1,-0x40(%ebp)
+ 286:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 289:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 28c:	39 d0                	cmp    %edx,%eax
+ 28e:	7c 90                	jl     220 <main+0x220>
+  }
+  sched_dlstat(0, &ds);
+ 290:	50                   	push   %eax
+ 291:	50                   	push   %eax
+ 292:	56                   	push   %esi
+ 293:	6a 00                	push   $0x0
+ 295:	e8 71 04 00 00       	call   70b <sched_dlstat>
+  sched_setdeadline(0, 0, 0, 0);
+ 29a:	6a 00                	push   $0x0
+ 29c:	6a 00                	push   $0x0
+ 29e:	6a 00                	push   $0x0
+ 2a0:	6a 00                	push   $0x0
+ 2a2:	e8 54 04 00 00       	call   6fb <sched_setdeadline>
+  printf(1, "%d/%d/%d us, %d hogs: %d jobs, %d missed, %d overran, "
+ 2a7:	83 c4 18             	add    $0x18,%esp
+ 2aa:	ff 75 bc             	push   -0x44(%ebp)
+ 2ad:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b0:	ff 75 e0             	push   -0x20(%ebp)
+ 2b3:	ff 75 dc             	push   -0x24(%ebp)
+ 2b6:	ff 75 b0             	push   -0x50(%ebp)
+ 2b9:	ff 75 d8             	push   -0x28(%ebp)
+ 2bc:	ff 75 d4             	push   -0x2c(%ebp)
+ 2bf:	ff 75 d0             	push   -0x30(%ebp)
+ 2c2:	68 7c 0e 00 00       	push   $0xe7c
+ 2c7:	6a 01                	push   $0x1
+ 2c9:	e8 22 05 00 00       	call   7f0 <printf>
+ 2ce:	83 c4 30             	add    $0x30,%esp
+         "worst response %d us\n", ds.runtime, ds.deadline, ds.period,
+         nhog, ds.jobs, ds.misses, ds.overruns, worst);
+
+out:
+  for(i = 0; i < nhog; i++)
+ 2d1:	31 db                	xor    %ebx,%ebx
+ 2d3:	83 7d b0 00          	cmpl   $0x0,-0x50(%ebp)
+ 2d7:	8b 75 b0             	mov    -0x50(%ebp),%esi
+ 2da:	74 24                	je     300 <main+0x300>
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kill(hogs[i]);
+ 2e0:	83 ec 0c             	sub    $0xc,%esp
+ 2e3:	ff 34 9d e0 13 00 00 	push   0x13e0(,%ebx,4)
+  for(i = 0; i < nhog; i++)
+ 2ea:	83 c3 01             	add    $0x1,%ebx
+    kill(hogs[i]);
+ 2ed:	e8 21 03 00 00       	call   613 <kill>
+  for(i = 0; i < nhog; i++)
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	39 de                	cmp    %ebx,%esi
+ 2f7:	75 e7                	jne    2e0 <main+0x2e0>
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(wait() >= 0)
+ 300:	e8 e6 02 00 00       	call   5eb <wait>
+ 305:	85 c0                	test   %eax,%eax
+ 307:	79 f7                	jns    300 <main+0x300>
+    ;
+  exit();
+ 309:	e8 d5 02 00 00       	call   5e3 <exit>
+  if(i < argc || njob <= 0 || nhog < 0 || nhog > MAXHOG){
+ 30e:	83 ea 01             	sub    $0x1,%edx
+ 311:	0f 8f cd fd ff ff    	jg     e4 <main+0xe4>
+  nhog = 4;
+ 317:	c7 45 b0 04 00 00 00 	movl   $0x4,-0x50(%ebp)
+  njob = 100;
+ 31e:	c7 45 b4 64 00 00 00 	movl   $0x64,-0x4c(%ebp)
+  work = 1000;
+ 325:	c7 45 c4 e8 03 00 00 	movl   $0x3e8,-0x3c(%ebp)
+  period = 10000;
+ 32c:	c7 45 b8 10 27 00 00 	movl   $0x2710,-0x48(%ebp)
+  deadline = 5000;
+ 333:	c7 45 bc 88 13 00 00 	movl   $0x1388,-0x44(%ebp)
+  runtime = 2000;
+ 33a:	c7 45 c0 d0 07 00 00 	movl   $0x7d0,-0x40(%ebp)
+ 341:	e9 79 fe ff ff       	jmp    1bf <main+0x1bf>
+ 346:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 349:	89 f7                	mov    %esi,%edi
+ 34b:	e9 7d fd ff ff       	jmp    cd <main+0xcd>
+    printf(2, "rtbench: reservation refused\n");
+ 350:	51                   	push   %ecx
+ 351:	51                   	push   %ecx
+ 352:	68 06 0e 00 00       	push   $0xe06
+ 357:	6a 02                	push   $0x2
+ 359:	e8 92 04 00 00       	call   7f0 <printf>
+    goto out;
+ 35e:	83 c4 10             	add    $0x10,%esp
+ 361:	e9 6b ff ff ff       	jmp    2d1 <main+0x2d1>
+ 366:	66 90                	xchg   %ax,%ax
+ 368:	66 90                	xchg   %ax,%ax
+ 36a:	66 90                	xchg   %ax,%ax
+ 36c:	66 90                	xchg   %ax,%ax
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <usecs>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 20             	sub    $0x20,%esp
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 376:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 379:	50                   	push   %eax
+ 37a:	6a 01                	push   $0x1
+ 37c:	e8 12 03 00 00       	call   693 <clock_gettime>
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 381:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 386:	f7 65 f4             	mull   -0xc(%ebp)
+ 389:	69 4d f0 40 42 0f 00 	imul   $0xf4240,-0x10(%ebp),%ecx
+}
+ 390:	c9                   	leave
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+ 391:	c1 ea 06             	shr    $0x6,%edx
+ 394:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+ 397:	c3                   	ret
+ 398:	66 90                	xchg   %ax,%ax
+ 39a:	66 90                	xchg   %ax,%ax
+ 39c:	66 90                	xchg   %ax,%ax
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 1e 01 00 00       	call   5fb <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 f1 00 00 00       	call   623 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 f4 00 00 00       	call   63b <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 ba 00 00 00       	call   60b <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+ 5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+ 5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+ 5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+ 5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+ 603:	b8 10 00 00 00       	mov    $0x10,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+ 60b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+ 61b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+ 623:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+ 62b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+ 633:	b8 12 00 00 00       	mov    $0x12,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+ 63b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+ 643:	b8 13 00 00 00       	mov    $0x13,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+ 653:	b8 09 00 00 00       	mov    $0x9,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+ 65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+ 663:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+ 66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+ 673:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+ 67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <add_dir>:
+SYSCALL(add_dir)
+ 683:	b8 16 00 00 00       	mov    $0x16,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <history>:
+SYSCALL(history)
+ 68b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 693:	b8 19 00 00 00       	mov    $0x19,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <nanosleep>:
+SYSCALL(nanosleep)
+ 69b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <clone>:
+SYSCALL(clone)
+ 6a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <join>:
+SYSCALL(join)
+ 6ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <futex_wait>:
+SYSCALL(futex_wait)
+ 6b3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <futex_wake>:
+SYSCALL(futex_wake)
+ 6bb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6c3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6cb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 6d3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <getprocinfo>:
+SYSCALL(getprocinfo)
+ 6db:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <waitpid>:
+SYSCALL(waitpid)
+ 6e3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <tracectl>:
+SYSCALL(tracectl)
+ 6eb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <traceread>:
+SYSCALL(traceread)
+ 6f3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 6fb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 703:	b8 27 00 00 00       	mov    $0x27,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 70b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <irqroute>:
+SYSCALL(irqroute)
+ 713:	b8 29 00 00 00       	mov    $0x29,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <irqstat>:
+SYSCALL(irqstat)
+ 71b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <boottimes>:
+SYSCALL(boottimes)
+ 723:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <lockbench>:
+SYSCALL(lockbench)
+ 72b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <lockstat>:
+SYSCALL(lockstat)
+ 733:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <cpustat>:
+SYSCALL(cpustat)
+ 73b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <bcachesize>:
+SYSCALL(bcachesize)
+ 743:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+ 74b:	66 90                	xchg   %ax,%ax
+ 74d:	66 90                	xchg   %ax,%ax
+ 74f:	90                   	nop
+
+00000750 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 758:	89 d1                	mov    %edx,%ecx
+{
+ 75a:	83 ec 3c             	sub    $0x3c,%esp
+ 75d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 760:	85 d2                	test   %edx,%edx
+ 762:	0f 89 80 00 00 00    	jns    7e8 <printint+0x98>
+ 768:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 76c:	74 7a                	je     7e8 <printint+0x98>
+    x = -xx;
+ 76e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 770:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 775:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 778:	31 f6                	xor    %esi,%esi
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 780:	89 c8                	mov    %ecx,%eax
+ 782:	31 d2                	xor    %edx,%edx
+ 784:	89 f7                	mov    %esi,%edi
+ 786:	f7 f3                	div    %ebx
+ 788:	8d 76 01             	lea    0x1(%esi),%esi
+ 78b:	0f b6 92 28 0f 00 00 	movzbl 0xf28(%edx),%edx
+ 792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 796:	89 ca                	mov    %ecx,%edx
+ 798:	89 c1                	mov    %eax,%ecx
+ 79a:	39 da                	cmp    %ebx,%edx
+ 79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+ 79e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+ 7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7aa:	89 f7                	mov    %esi,%edi
+ 7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7b2:	01 df                	add    %ebx,%edi
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7c4:	6a 01                	push   $0x1
+ 7c6:	50                   	push   %eax
+ 7c7:	56                   	push   %esi
+ 7c8:	e8 36 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+ 7cd:	89 f8                	mov    %edi,%eax
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	83 ef 01             	sub    $0x1,%edi
+ 7d5:	39 d8                	cmp    %ebx,%eax
+ 7d7:	75 df                	jne    7b8 <printint+0x68>
+}
+ 7d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7e8:	31 c0                	xor    %eax,%eax
+ 7ea:	eb 89                	jmp    775 <printint+0x25>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 802:	83 c6 01             	add    $0x1,%esi
+ 805:	84 db                	test   %bl,%bl
+ 807:	74 67                	je     870 <printf+0x80>
+ 809:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 80c:	31 d2                	xor    %edx,%edx
+ 80e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 811:	eb 34                	jmp    847 <printf+0x57>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+ 818:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 81b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 820:	83 f8 25             	cmp    $0x25,%eax
+ 823:	74 18                	je     83d <printf+0x4d>
+  write(fd, &c, 1);
+ 825:	83 ec 04             	sub    $0x4,%esp
+ 828:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82e:	6a 01                	push   $0x1
+ 830:	50                   	push   %eax
+ 831:	57                   	push   %edi
+ 832:	e8 cc fd ff ff       	call   603 <write>
+ 837:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 83a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 83d:	0f b6 1e             	movzbl (%esi),%ebx
+ 840:	83 c6 01             	add    $0x1,%esi
+ 843:	84 db                	test   %bl,%bl
+ 845:	74 29                	je     870 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 847:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84a:	85 d2                	test   %edx,%edx
+ 84c:	74 ca                	je     818 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 84e:	83 fa 25             	cmp    $0x25,%edx
+ 851:	75 ea                	jne    83d <printf+0x4d>
+      if(c == 'd'){
+ 853:	83 f8 25             	cmp    $0x25,%eax
+ 856:	0f 84 24 01 00 00    	je     980 <printf+0x190>
+ 85c:	83 e8 63             	sub    $0x63,%eax
+ 85f:	83 f8 15             	cmp    $0x15,%eax
+ 862:	77 1c                	ja     880 <printf+0x90>
+ 864:	ff 24 85 d0 0e 00 00 	jmp    *0xed0(,%eax,4)
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 873:	5b                   	pop    %ebx
+ 874:	5e                   	pop    %esi
+ 875:	5f                   	pop    %edi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 886:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 88a:	6a 01                	push   $0x1
+ 88c:	52                   	push   %edx
+ 88d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 890:	57                   	push   %edi
+ 891:	e8 6d fd ff ff       	call   603 <write>
+ 896:	83 c4 0c             	add    $0xc,%esp
+ 899:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 89c:	6a 01                	push   $0x1
+ 89e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8a1:	52                   	push   %edx
+ 8a2:	57                   	push   %edi
+ 8a3:	e8 5b fd ff ff       	call   603 <write>
+        putc(fd, c);
+ 8a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ab:	31 d2                	xor    %edx,%edx
+ 8ad:	eb 8e                	jmp    83d <printf+0x4d>
+ 8af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 00                	push   $0x0
+ 8bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8c4:	e8 87 fe ff ff       	call   750 <printint>
+        ap++;
+ 8c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 67 ff ff ff       	jmp    83d <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8e5:	83 c0 04             	add    $0x4,%eax
+ 8e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	0f 84 9d 00 00 00    	je     990 <printf+0x1a0>
+        while(*s != 0){
+ 8f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	0f 84 3d ff ff ff    	je     83d <printf+0x4d>
+ 900:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 903:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 906:	89 de                	mov    %ebx,%esi
+ 908:	89 d3                	mov    %edx,%ebx
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 916:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	53                   	push   %ebx
+ 91c:	57                   	push   %edi
+ 91d:	e8 e1 fc ff ff       	call   603 <write>
+        while(*s != 0){
+ 922:	0f b6 06             	movzbl (%esi),%eax
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	84 c0                	test   %al,%al
+ 92a:	75 e4                	jne    910 <printf+0x120>
+      state = 0;
+ 92c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 07 ff ff ff       	jmp    83d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 01                	push   $0x1
+ 94f:	e9 6b ff ff ff       	jmp    8bf <printf+0xcf>
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 958:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 961:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 963:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 966:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	52                   	push   %edx
+ 96c:	57                   	push   %edi
+ 96d:	e8 91 fc ff ff       	call   603 <write>
+        ap++;
+ 972:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 975:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	e9 be fe ff ff       	jmp    83d <printf+0x4d>
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 986:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 989:	6a 01                	push   $0x1
+ 98b:	e9 11 ff ff ff       	jmp    8a1 <printf+0xb1>
+ 990:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 995:	bb c8 0e 00 00       	mov    $0xec8,%ebx
+ 99a:	e9 61 ff ff ff       	jmp    900 <printf+0x110>
+ 99f:	90                   	nop
+
+000009a0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 9a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9a1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 9a4:	89 e5                	mov    %esp,%ebp
+ 9a6:	57                   	push   %edi
+ 9a7:	56                   	push   %esi
+ 9a8:	53                   	push   %ebx
+ 9a9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ab:	a1 e4 14 00 00       	mov    0x14e4,%eax
+ 9b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b4:	39 ca                	cmp    %ecx,%edx
+ 9b6:	73 30                	jae    9e8 <ufree+0x48>
+ 9b8:	39 c1                	cmp    %eax,%ecx
+ 9ba:	72 04                	jb     9c0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9bc:	39 c2                	cmp    %eax,%edx
+ 9be:	72 f0                	jb     9b0 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9c3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9c6:	39 f8                	cmp    %edi,%eax
+ 9c8:	74 26                	je     9f0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	74 30                	je     a07 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9d7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9d9:	5b                   	pop    %ebx
+  freep = p;
+ 9da:	89 15 e4 14 00 00    	mov    %edx,0x14e4
+}
+ 9e0:	5e                   	pop    %esi
+ 9e1:	5f                   	pop    %edi
+ 9e2:	5d                   	pop    %ebp
+ 9e3:	c3                   	ret
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e8:	39 c1                	cmp    %eax,%ecx
+ 9ea:	72 d0                	jb     9bc <ufree+0x1c>
+ 9ec:	eb c2                	jmp    9b0 <ufree+0x10>
+ 9ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9f0:	03 70 04             	add    0x4(%eax),%esi
+ 9f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f6:	8b 02                	mov    (%edx),%eax
+ 9f8:	8b 00                	mov    (%eax),%eax
+ 9fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9fd:	8b 42 04             	mov    0x4(%edx),%eax
+ a00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a03:	39 f1                	cmp    %esi,%ecx
+ a05:	75 d0                	jne    9d7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ a07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a0a:	89 15 e4 14 00 00    	mov    %edx,0x14e4
+    p->s.size += bp->s.size;
+ a10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a16:	89 0a                	mov    %ecx,(%edx)
+}
+ a18:	5b                   	pop    %ebx
+ a19:	5e                   	pop    %esi
+ a1a:	5f                   	pop    %edi
+ a1b:	5d                   	pop    %ebp
+ a1c:	c3                   	ret
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a20 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	53                   	push   %ebx
+ a24:	83 ec 10             	sub    $0x10,%esp
+ a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ a2a:	68 e0 14 00 00       	push   $0x14e0
+ a2f:	e8 ec 01 00 00       	call   c20 <lock_acquire>
+  ufree(ap);
+ a34:	89 d8                	mov    %ebx,%eax
+ a36:	e8 65 ff ff ff       	call   9a0 <ufree>
+  lock_release(&mlock);
+ a3b:	c7 45 08 e0 14 00 00 	movl   $0x14e0,0x8(%ebp)
+}
+ a42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ a45:	83 c4 10             	add    $0x10,%esp
+}
+ a48:	c9                   	leave
+  lock_release(&mlock);
+ a49:	e9 f2 01 00 00       	jmp    c40 <lock_release>
+ a4e:	66 90                	xchg   %ax,%ax
+
+00000a50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ a5c:	68 e0 14 00 00       	push   $0x14e0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a61:	8d 48 07             	lea    0x7(%eax),%ecx
+ a64:	c1 e9 03             	shr    $0x3,%ecx
+ a67:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ a6a:	e8 b1 01 00 00       	call   c20 <lock_acquire>
+  if((prevp = freep) == 0){
+ a6f:	8b 15 e4 14 00 00    	mov    0x14e4,%edx
+ a75:	83 c4 10             	add    $0x10,%esp
+ a78:	85 d2                	test   %edx,%edx
+ a7a:	0f 84 b0 00 00 00    	je     b30 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a80:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ a82:	8b 47 04             	mov    0x4(%edi),%eax
+ a85:	39 f0                	cmp    %esi,%eax
+ a87:	73 6f                	jae    af8 <malloc+0xa8>
+  if(nu < 4096)
+ a89:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a8e:	39 de                	cmp    %ebx,%esi
+ a90:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a93:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ a9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a9d:	eb 0a                	jmp    aa9 <malloc+0x59>
+ a9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ aa2:	8b 47 04             	mov    0x4(%edi),%eax
+ aa5:	39 f0                	cmp    %esi,%eax
+ aa7:	73 4f                	jae    af8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ aa9:	89 fa                	mov    %edi,%edx
+ aab:	39 3d e4 14 00 00    	cmp    %edi,0x14e4
+ ab1:	75 ed                	jne    aa0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	ff 75 e4             	push   -0x1c(%ebp)
+ ab9:	e8 ad fb ff ff       	call   66b <sbrk>
+  if(p == (char*)-1)
+ abe:	83 c4 10             	add    $0x10,%esp
+ ac1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ac4:	74 15                	je     adb <malloc+0x8b>
+  hp->s.size = nu;
+ ac6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ ac9:	83 c0 08             	add    $0x8,%eax
+ acc:	e8 cf fe ff ff       	call   9a0 <ufree>
+  return freep;
+ ad1:	8b 15 e4 14 00 00    	mov    0x14e4,%edx
+      if((p = morecore(nunits)) == 0){
+ ad7:	85 d2                	test   %edx,%edx
+ ad9:	75 c5                	jne    aa0 <malloc+0x50>
+        lock_release(&mlock);
+ adb:	83 ec 0c             	sub    $0xc,%esp
+ ade:	68 e0 14 00 00       	push   $0x14e0
+ ae3:	e8 58 01 00 00       	call   c40 <lock_release>
+        return 0;
+ ae8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ aee:	31 c0                	xor    %eax,%eax
+}
+ af0:	5b                   	pop    %ebx
+ af1:	5e                   	pop    %esi
+ af2:	5f                   	pop    %edi
+ af3:	5d                   	pop    %ebp
+ af4:	c3                   	ret
+ af5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ af8:	39 c6                	cmp    %eax,%esi
+ afa:	74 64                	je     b60 <malloc+0x110>
+        p->s.size -= nunits;
+ afc:	29 f0                	sub    %esi,%eax
+ afe:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ b01:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ b04:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ b07:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ b0a:	89 15 e4 14 00 00    	mov    %edx,0x14e4
+      lock_release(&mlock);
+ b10:	68 e0 14 00 00       	push   $0x14e0
+ b15:	e8 26 01 00 00       	call   c40 <lock_release>
+      return (void*)(p + 1);
+ b1a:	83 c4 10             	add    $0x10,%esp
+}
+ b1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b20:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ b23:	5b                   	pop    %ebx
+ b24:	5e                   	pop    %esi
+ b25:	5f                   	pop    %edi
+ b26:	5d                   	pop    %ebp
+ b27:	c3                   	ret
+ b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ b30:	c7 05 e4 14 00 00 e8 	movl   $0x14e8,0x14e4
+ b37:	14 00 00 
+    base.s.size = 0;
+ b3a:	bf e8 14 00 00       	mov    $0x14e8,%edi
+    base.s.ptr = freep = prevp = &base;
+ b3f:	c7 05 e8 14 00 00 e8 	movl   $0x14e8,0x14e8
+ b46:	14 00 00 
+    base.s.size = 0;
+ b49:	c7 05 ec 14 00 00 00 	movl   $0x0,0x14ec
+ b50:	00 00 00 
+    if(p->s.size >= nunits){
+ b53:	e9 31 ff ff ff       	jmp    a89 <malloc+0x39>
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b60:	8b 07                	mov    (%edi),%eax
+ b62:	89 02                	mov    %eax,(%edx)
+ b64:	eb a1                	jmp    b07 <malloc+0xb7>
+ b66:	66 90                	xchg   %ax,%ax
+ b68:	66 90                	xchg   %ax,%ax
+ b6a:	66 90                	xchg   %ax,%ax
+ b6c:	66 90                	xchg   %ax,%ax
+ b6e:	66 90                	xchg   %ax,%ax
+
+00000b70 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	53                   	push   %ebx
+ b74:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ b77:	68 00 10 00 00       	push   $0x1000
+ b7c:	e8 cf fe ff ff       	call   a50 <malloc>
+ b81:	83 c4 10             	add    $0x10,%esp
+ b84:	85 c0                	test   %eax,%eax
+ b86:	74 37                	je     bbf <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ b88:	83 ec 04             	sub    $0x4,%esp
+ b8b:	89 c3                	mov    %eax,%ebx
+ b8d:	50                   	push   %eax
+ b8e:	ff 75 0c             	push   0xc(%ebp)
+ b91:	ff 75 08             	push   0x8(%ebp)
+ b94:	e8 0a fb ff ff       	call   6a3 <clone>
+ b99:	83 c4 10             	add    $0x10,%esp
+ b9c:	85 c0                	test   %eax,%eax
+ b9e:	78 08                	js     ba8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ba3:	c9                   	leave
+ ba4:	c3                   	ret
+ ba5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ ba8:	83 ec 0c             	sub    $0xc,%esp
+ bab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bae:	53                   	push   %ebx
+ baf:	e8 6c fe ff ff       	call   a20 <free>
+ bb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ bb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ bba:	83 c4 10             	add    $0x10,%esp
+}
+ bbd:	c9                   	leave
+ bbe:	c3                   	ret
+    return -1;
+ bbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ bc4:	eb da                	jmp    ba0 <thread_create+0x30>
+ bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bd0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ bd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ bd9:	50                   	push   %eax
+ bda:	e8 cc fa ff ff       	call   6ab <join>
+ bdf:	83 c4 10             	add    $0x10,%esp
+ be2:	85 c0                	test   %eax,%eax
+ be4:	79 0a                	jns    bf0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ be6:	c9                   	leave
+ be7:	c3                   	ret
+ be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+ bf0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	ff 75 f4             	push   -0xc(%ebp)
+ bf9:	e8 22 fe ff ff       	call   a20 <free>
+ bfe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c01:	83 c4 10             	add    $0x10,%esp
+}
+ c04:	c9                   	leave
+ c05:	c3                   	ret
+ c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c10 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ c13:	8b 45 08             	mov    0x8(%ebp),%eax
+ c16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c1c:	5d                   	pop    %ebp
+ c1d:	c3                   	ret
+ c1e:	66 90                	xchg   %ax,%ax
+
+00000c20 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ c20:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ c21:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c26:	89 e5                	mov    %esp,%ebp
+ c28:	8b 55 08             	mov    0x8(%ebp),%edx
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+ c30:	89 c8                	mov    %ecx,%eax
+ c32:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ c35:	85 c0                	test   %eax,%eax
+ c37:	75 f7                	jne    c30 <lock_acquire+0x10>
+    ;
+}
+ c39:	5d                   	pop    %ebp
+ c3a:	c3                   	ret
+ c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+
+00000c40 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ c40:	55                   	push   %ebp
+ c41:	31 c0                	xor    %eax,%eax
+ c43:	89 e5                	mov    %esp,%ebp
+ c45:	8b 55 08             	mov    0x8(%ebp),%edx
+ c48:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ c4b:	5d                   	pop    %ebp
+ c4c:	c3                   	ret
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ c53:	8b 45 08             	mov    0x8(%ebp),%eax
+ c56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c5c:	5d                   	pop    %ebp
+ c5d:	c3                   	ret
+ c5e:	66 90                	xchg   %ax,%ax
+
+00000c60 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c60:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ c61:	31 c0                	xor    %eax,%eax
+ c63:	ba 01 00 00 00       	mov    $0x1,%edx
+ c68:	89 e5                	mov    %esp,%ebp
+ c6a:	56                   	push   %esi
+ c6b:	53                   	push   %ebx
+ c6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c6f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ c73:	85 c0                	test   %eax,%eax
+ c75:	74 30                	je     ca7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ c77:	83 f8 02             	cmp    $0x2,%eax
+ c7a:	74 0c                	je     c88 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ c7c:	b8 02 00 00 00       	mov    $0x2,%eax
+ c81:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ c84:	85 c0                	test   %eax,%eax
+ c86:	74 1f                	je     ca7 <mutex_lock+0x47>
+ c88:	be 02 00 00 00       	mov    $0x2,%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ c90:	83 ec 08             	sub    $0x8,%esp
+ c93:	6a 02                	push   $0x2
+ c95:	53                   	push   %ebx
+ c96:	e8 18 fa ff ff       	call   6b3 <futex_wait>
+ c9b:	89 f0                	mov    %esi,%eax
+ c9d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ ca0:	83 c4 10             	add    $0x10,%esp
+ ca3:	85 c0                	test   %eax,%eax
+ ca5:	75 e9                	jne    c90 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ ca7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ caa:	5b                   	pop    %ebx
+ cab:	5e                   	pop    %esi
+ cac:	5d                   	pop    %ebp
+ cad:	c3                   	ret
+ cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	31 c0                	xor    %eax,%eax
+ cb3:	89 e5                	mov    %esp,%ebp
+ cb5:	83 ec 08             	sub    $0x8,%esp
+ cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+ cbb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ cbe:	83 f8 02             	cmp    $0x2,%eax
+ cc1:	74 05                	je     cc8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ cc3:	c9                   	leave
+ cc4:	c3                   	ret
+ cc5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ cc8:	83 ec 08             	sub    $0x8,%esp
+ ccb:	6a 01                	push   $0x1
+ ccd:	52                   	push   %edx
+ cce:	e8 e8 f9 ff ff       	call   6bb <futex_wake>
+ cd3:	83 c4 10             	add    $0x10,%esp
+}
+ cd6:	c9                   	leave
+ cd7:	c3                   	ret
+ cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+
+00000ce0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ ce6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ cec:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ cf3:	5d                   	pop    %ebp
+ cf4:	c3                   	ret
+ cf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d00 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 0c             	sub    $0xc,%esp
+ d09:	8b 75 08             	mov    0x8(%ebp),%esi
+ d0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ d0f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ d14:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ d16:	8b 3e                	mov    (%esi),%edi
+ d18:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ d1b:	83 f8 02             	cmp    $0x2,%eax
+ d1e:	74 60                	je     d80 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ d20:	83 ec 08             	sub    $0x8,%esp
+ d23:	57                   	push   %edi
+ d24:	56                   	push   %esi
+ d25:	e8 89 f9 ff ff       	call   6b3 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ d2a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ d2f:	31 c0                	xor    %eax,%eax
+ d31:	ba 01 00 00 00       	mov    $0x1,%edx
+ d36:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ d3a:	83 c4 10             	add    $0x10,%esp
+ d3d:	85 c0                	test   %eax,%eax
+ d3f:	74 36                	je     d77 <cond_wait+0x77>
+  if(c != 2)
+ d41:	83 f8 02             	cmp    $0x2,%eax
+ d44:	74 0c                	je     d52 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ d46:	b8 02 00 00 00       	mov    $0x2,%eax
+ d4b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ d4e:	85 c0                	test   %eax,%eax
+ d50:	74 25                	je     d77 <cond_wait+0x77>
+ d52:	be 02 00 00 00       	mov    $0x2,%esi
+ d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ d60:	83 ec 08             	sub    $0x8,%esp
+ d63:	6a 02                	push   $0x2
+ d65:	53                   	push   %ebx
+ d66:	e8 48 f9 ff ff       	call   6b3 <futex_wait>
+ d6b:	89 f0                	mov    %esi,%eax
+ d6d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ d70:	83 c4 10             	add    $0x10,%esp
+ d73:	85 c0                	test   %eax,%eax
+ d75:	75 e9                	jne    d60 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d7a:	5b                   	pop    %ebx
+ d7b:	5e                   	pop    %esi
+ d7c:	5f                   	pop    %edi
+ d7d:	5d                   	pop    %ebp
+ d7e:	c3                   	ret
+ d7f:	90                   	nop
+    futex_wake(&m->val, 1);
+ d80:	83 ec 08             	sub    $0x8,%esp
+ d83:	6a 01                	push   $0x1
+ d85:	53                   	push   %ebx
+ d86:	e8 30 f9 ff ff       	call   6bb <futex_wake>
+ d8b:	83 c4 10             	add    $0x10,%esp
+ d8e:	eb 90                	jmp    d20 <cond_wait+0x20>
+
+00000d90 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	83 ec 08             	sub    $0x8,%esp
+ d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ d99:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ d9d:	8b 50 04             	mov    0x4(%eax),%edx
+ da0:	85 d2                	test   %edx,%edx
+ da2:	75 0c                	jne    db0 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ da4:	c9                   	leave
+ da5:	c3                   	ret
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ db0:	83 ec 08             	sub    $0x8,%esp
+ db3:	6a 01                	push   $0x1
+ db5:	50                   	push   %eax
+ db6:	e8 00 f9 ff ff       	call   6bb <futex_wake>
+ dbb:	83 c4 10             	add    $0x10,%esp
+}
+ dbe:	c9                   	leave
+ dbf:	c3                   	ret
+
+00000dc0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	83 ec 08             	sub    $0x8,%esp
+ dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ dc9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ dcd:	8b 50 04             	mov    0x4(%eax),%edx
+ dd0:	85 d2                	test   %edx,%edx
+ dd2:	75 0c                	jne    de0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ dd4:	c9                   	leave
+ dd5:	c3                   	ret
+ dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ de0:	83 ec 08             	sub    $0x8,%esp
+ de3:	68 ff ff ff 7f       	push   $0x7fffffff
+ de8:	50                   	push   %eax
+ de9:	e8 cd f8 ff ff       	call   6bb <futex_wake>
+ dee:	83 c4 10             	add    $0x10,%esp
+}
+ df1:	c9                   	leave
+ df2:	c3                   	ret
@@ -0,0 +1,102 @@
+// Periodic real-time task against a CPU-bound background.
+// Forks hogs that spin forever, makes itself real-time with
+// the given runtime, deadline and period (microseconds), and
+// runs jobs that each spin for work microseconds, then
+// reports its worst response time and missed deadlines.
+// usage: rtbench [-r runtime] [-d deadline] [-p period]
+//                [-w work] [-n jobs] [-l hogs]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+#include "time.h"
+
+#define MAXHOG 64
+
+int hogs[MAXHOG];
+
+// Wraps every 71 minutes; only differences matter.
+static uint
+usecs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, runtime, deadline, period, work, njob, nhog;
+  uint rel, t0, t, worst;
+  struct dlstat ds;
+
+  runtime = 2000;
+  deadline = 5000;
+  period = 10000;
+  work = 1000;
+  njob = 100;
+  nhog = 4;
+  for(i = 1; i+1 < argc; i += 2){
+    if(strcmp(argv[i], "-r") == 0)
+      runtime = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-d") == 0)
+      deadline = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-p") == 0)
+      period = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-w") == 0)
+      work = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-n") == 0)
+      njob = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-l") == 0)
+      nhog = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || njob <= 0 || nhog < 0 || nhog > MAXHOG){
+    printf(2, "usage: rtbench [-r runtime] [-d deadline] [-p period] "
+           "[-w work] [-n jobs] [-l hogs]\n");
+    exit();
+  }
+
+  for(i = 0; i < nhog; i++){
+    if((hogs[i] = fork()) == 0)
+      for(;;)
+        ;
+  }
+  if(sched_setdeadline(0, runtime, deadline, period) < 0){
+    printf(2, "rtbench: reservation refused\n");
+    goto out;
+  }
+
+  // The first period starts now, and each one after the
+  // last, or when the job before finished if that was later.
+  // The response time runs from the start of the period.
+  worst = 0;
+  rel = usecs();
+  for(i = 0; i < njob; i++){
+    t0 = usecs();
+    while(usecs() - t0 < work)
+      ;
+    t = usecs();
+    if(t - rel > worst)
+      worst = t - rel;
+    rel = t - rel > period ? t : rel + period;
+    sched_dlyield();
+  }
+  sched_dlstat(0, &ds);
+  sched_setdeadline(0, 0, 0, 0);
+  printf(1, "%d/%d/%d us, %d hogs: %d jobs, %d missed, %d overran, "
+         "worst response %d us\n", ds.runtime, ds.deadline, ds.period,
+         nhog, ds.jobs, ds.misses, ds.overruns, worst);
+
+out:
+  for(i = 0; i < nhog; i++)
+    kill(hogs[i]);
+  while(wait() >= 0)
+    ;
+  exit();
+}
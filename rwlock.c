@@ -0,0 +1,103 @@
+// Reader-writer spin locks, for read-mostly data.
+//
+// Readers share the lock, so they don't serialize, though
+// each still writes the lock word once to get in and once
+// to get out.  Both sides spin with interrupts off, as for
+// spin locks, and neither may sleep while holding.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+  lk->word = 0;
+  lk->name = name;
+  lk->class = lockclass(name, 0);
+}
+
+void
+acquireread(struct rwlock *lk)
+{
+  uint w;
+  uint64 t0;
+  int contended;
+
+  pushcli();
+  t0 = 0;
+  if(LOCKSTAT && lk->class)
+    t0 = rdtsc();
+  contended = 0;
+  for(;;){
+    w = lk->word;
+    if((w & (RW_WRITER|RW_WAITING)) == 0 &&
+       cmpxchg(&lk->word, w, w+1) == w)
+      break;
+    contended = 1;
+    pause();
+  }
+  __sync_synchronize();
+  if(LOCKSTAT && lk->class)
+    lockacquired(lk->class, contended, rdtsc() - t0);
+}
+
+void
+releaseread(struct rwlock *lk)
+{
+  if((lk->word & ~(RW_WRITER|RW_WAITING)) == 0)
+    panic("releaseread");
+  __sync_synchronize();
+  xadd((int*)&lk->word, -1);
+  popcli();
+}
+
+void
+acquirewrite(struct rwlock *lk)
+{
+  uint w;
+  uint64 t0;
+  int contended;
+
+  pushcli();
+  t0 = 0;
+  if(LOCKSTAT && lk->class)
+    t0 = rdtsc();
+  contended = 0;
+  for(;;){
+    w = lk->word;
+    // Free but for maybe our own or another writer's flag.
+    if((w & ~RW_WAITING) == 0 && cmpxchg(&lk->word, w, RW_WRITER) == w)
+      break;
+    // Keep new readers out until we're in.  Another writer
+    // getting in first clears the flag, so set it again.
+    if((w & RW_WAITING) == 0)
+      cmpxchg(&lk->word, w, w|RW_WAITING);
+    contended = 1;
+    pause();
+  }
+  __sync_synchronize();
+  if(LOCKSTAT && lk->class){
+    lk->tacquire = rdtsc();
+    lockacquired(lk->class, contended, lk->tacquire - t0);
+  }
+}
+
+void
+releasewrite(struct rwlock *lk)
+{
+  if((lk->word & RW_WRITER) == 0)
+    panic("releasewrite");
+  if(LOCKSTAT && lk->class)
+    lockreleased(lk->class, rdtsc() - lk->tacquire);
+  __sync_synchronize();
+  // Leave any waiting writer's flag alone.
+  xadd((int*)&lk->word, -RW_WRITER);
+  popcli();
+}
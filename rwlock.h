@@ -0,0 +1,14 @@
+// Reader-writer spin lock: any number of readers, or one
+// writer.  A waiting writer holds off new readers, so a
+// stream of readers can't starve it.
+struct rwlock {
+  volatile uint word;  // RW_WRITER, RW_WAITING, and the reader count
+
+  // For debugging and lockstat:
+  char *name;          // Name of lock.
+  int class;           // lockstat slot for our name; 0 if none.
+  uint64 tacquire;     // TSC when a writer acquired it.
+};
+
+#define RW_WRITER  0x40000000  // A writer holds the lock
+#define RW_WAITING 0x20000000  // A writer is waiting
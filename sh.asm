@@ -0,0 +1,3365 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 37 01 00 00    	jg     158 <main+0x158>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 c1 17 00 00       	push   $0x17c1
+      2b:	e8 13 0f 00 00       	call   f43 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 33                	jmp    6c <main+0x6c>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      buf[strlen(buf)-1] = 0;  // chop \n
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    if(buf[0] == 'h' && buf[1] == 'i' && buf[2] == 's' && buf[3] == 't'
+      40:	3c 68                	cmp    $0x68,%al
+      42:	75 0d                	jne    51 <main+0x51>
+      44:	80 3d c1 20 00 00 69 	cmpb   $0x69,0x20c1
+      4b:	0f 84 b7 00 00 00    	je     108 <main+0x108>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      51:	e8 a5 0e 00 00       	call   efb <fork>
+  if(pid == -1)
+      56:	83 f8 ff             	cmp    $0xffffffff,%eax
+      59:	0f 84 1f 01 00 00    	je     17e <main+0x17e>
+    if(fork1() == 0)
+      5f:	85 c0                	test   %eax,%eax
+      61:	0f 84 02 01 00 00    	je     169 <main+0x169>
+    wait();
+      67:	e8 9f 0e 00 00       	call   f0b <wait>
+  printf(2, "$ ");
+      6c:	83 ec 08             	sub    $0x8,%esp
+      6f:	68 14 17 00 00       	push   $0x1714
+      74:	6a 02                	push   $0x2
+      76:	e8 95 10 00 00       	call   1110 <printf>
+  memset(buf, 0, nbuf);
+      7b:	83 c4 0c             	add    $0xc,%esp
+      7e:	6a 64                	push   $0x64
+      80:	6a 00                	push   $0x0
+      82:	68 c0 20 00 00       	push   $0x20c0
+      87:	e8 f4 0c 00 00       	call   d80 <memset>
+  gets(buf, nbuf);
+      8c:	58                   	pop    %eax
+      8d:	5a                   	pop    %edx
+      8e:	6a 64                	push   $0x64
+      90:	68 c0 20 00 00       	push   $0x20c0
+      95:	e8 46 0d 00 00       	call   de0 <gets>
+  if(buf[0] == 0) // EOF
+      9a:	0f b6 05 c0 20 00 00 	movzbl 0x20c0,%eax
+      a1:	83 c4 10             	add    $0x10,%esp
+      a4:	84 c0                	test   %al,%al
+      a6:	0f 84 a7 00 00 00    	je     153 <main+0x153>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      ac:	3c 63                	cmp    $0x63,%al
+      ae:	75 90                	jne    40 <main+0x40>
+      b0:	80 3d c1 20 00 00 64 	cmpb   $0x64,0x20c1
+      b7:	75 98                	jne    51 <main+0x51>
+      b9:	80 3d c2 20 00 00 20 	cmpb   $0x20,0x20c2
+      c0:	75 8f                	jne    51 <main+0x51>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      c2:	83 ec 0c             	sub    $0xc,%esp
+      c5:	68 c0 20 00 00       	push   $0x20c0
+      ca:	e8 81 0c 00 00       	call   d50 <strlen>
+      if(chdir(buf+3) < 0)
+      cf:	c7 04 24 c3 20 00 00 	movl   $0x20c3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      d6:	c6 80 bf 20 00 00 00 	movb   $0x0,0x20bf(%eax)
+      if(chdir(buf+3) < 0)
+      dd:	e8 91 0e 00 00       	call   f73 <chdir>
+      e2:	83 c4 10             	add    $0x10,%esp
+      e5:	85 c0                	test   %eax,%eax
+      e7:	79 83                	jns    6c <main+0x6c>
+        printf(2, "cannot cd %s\n", buf+3);
+      e9:	51                   	push   %ecx
+      ea:	68 c3 20 00 00       	push   $0x20c3
+      ef:	68 c9 17 00 00       	push   $0x17c9
+      f4:	6a 02                	push   $0x2
+      f6:	e8 15 10 00 00       	call   1110 <printf>
+      fb:	83 c4 10             	add    $0x10,%esp
+      fe:	e9 69 ff ff ff       	jmp    6c <main+0x6c>
+     103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     107:	90                   	nop
+    if(buf[0] == 'h' && buf[1] == 'i' && buf[2] == 's' && buf[3] == 't'
+     108:	80 3d c2 20 00 00 73 	cmpb   $0x73,0x20c2
+     10f:	0f 85 3c ff ff ff    	jne    51 <main+0x51>
+     115:	80 3d c3 20 00 00 74 	cmpb   $0x74,0x20c3
+     11c:	0f 85 2f ff ff ff    	jne    51 <main+0x51>
+        && buf[4] == 'o' && buf[5] == 'r' && buf[6] == 'y') {
+     122:	80 3d c4 20 00 00 6f 	cmpb   $0x6f,0x20c4
+     129:	0f 85 22 ff ff ff    	jne    51 <main+0x51>
+     12f:	80 3d c5 20 00 00 72 	cmpb   $0x72,0x20c5
+     136:	0f 85 15 ff ff ff    	jne    51 <main+0x51>
+     13c:	80 3d c6 20 00 00 79 	cmpb   $0x79,0x20c6
+     143:	0f 85 08 ff ff ff    	jne    51 <main+0x51>
+      printCurrentHistory();
+     149:	e8 82 00 00 00       	call   1d0 <printCurrentHistory>
+      continue;
+     14e:	e9 19 ff ff ff       	jmp    6c <main+0x6c>
+  exit();
+     153:	e8 ab 0d 00 00       	call   f03 <exit>
+      close(fd);
+     158:	83 ec 0c             	sub    $0xc,%esp
+     15b:	50                   	push   %eax
+     15c:	e8 ca 0d 00 00       	call   f2b <close>
+      break;
+     161:	83 c4 10             	add    $0x10,%esp
+     164:	e9 03 ff ff ff       	jmp    6c <main+0x6c>
+      runcmd(parsecmd(buf));
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	68 c0 20 00 00       	push   $0x20c0
+     171:	e8 da 0a 00 00       	call   c50 <parsecmd>
+     176:	89 04 24             	mov    %eax,(%esp)
+     179:	e8 22 01 00 00       	call   2a0 <runcmd>
+    panic("fork");
+     17e:	83 ec 0c             	sub    $0xc,%esp
+     181:	68 23 17 00 00       	push   $0x1723
+     186:	e8 d5 00 00 00       	call   260 <panic>
+     18b:	66 90                	xchg   %ax,%ax
+     18d:	66 90                	xchg   %ax,%ax
+     18f:	90                   	nop
+
+00000190 <getcmd>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     19b:	83 ec 08             	sub    $0x8,%esp
+     19e:	68 14 17 00 00       	push   $0x1714
+     1a3:	6a 02                	push   $0x2
+     1a5:	e8 66 0f 00 00       	call   1110 <printf>
+  memset(buf, 0, nbuf);
+     1aa:	83 c4 0c             	add    $0xc,%esp
+     1ad:	56                   	push   %esi
+     1ae:	6a 00                	push   $0x0
+     1b0:	53                   	push   %ebx
+     1b1:	e8 ca 0b 00 00       	call   d80 <memset>
+  gets(buf, nbuf);
+     1b6:	58                   	pop    %eax
+     1b7:	5a                   	pop    %edx
+     1b8:	56                   	push   %esi
+     1b9:	53                   	push   %ebx
+     1ba:	e8 21 0c 00 00       	call   de0 <gets>
+  if(buf[0] == 0) // EOF
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     1c5:	19 c0                	sbb    %eax,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <printCurrentHistory>:
+  for( i = 0; i < numCommands; i++ )
+     1d0:	a1 38 20 00 00       	mov    0x2038,%eax
+     1d5:	85 c0                	test   %eax,%eax
+     1d7:	7e 77                	jle    250 <printCurrentHistory+0x80>
+{
+     1d9:	55                   	push   %ebp
+     1da:	89 e5                	mov    %esp,%ebp
+     1dc:	53                   	push   %ebx
+  for( i = 0; i < numCommands; i++ )
+     1dd:	31 db                	xor    %ebx,%ebx
+{
+     1df:	83 ec 04             	sub    $0x4,%esp
+     1e2:	eb 10                	jmp    1f4 <printCurrentHistory+0x24>
+     1e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for( i = 0; i < numCommands; i++ )
+     1e8:	a1 38 20 00 00       	mov    0x2038,%eax
+     1ed:	83 c3 01             	add    $0x1,%ebx
+     1f0:	39 d8                	cmp    %ebx,%eax
+     1f2:	7e 54                	jle    248 <printCurrentHistory+0x78>
+    if( history(buffer, numCommands-i-1) == 0 && strcmp(buffer, "") != 0 )
+     1f4:	29 d8                	sub    %ebx,%eax
+     1f6:	83 ec 08             	sub    $0x8,%esp
+     1f9:	83 e8 01             	sub    $0x1,%eax
+     1fc:	50                   	push   %eax
+     1fd:	68 40 20 00 00       	push   $0x2040
+     202:	e8 a4 0d 00 00       	call   fab <history>
+     207:	83 c4 10             	add    $0x10,%esp
+     20a:	85 c0                	test   %eax,%eax
+     20c:	75 da                	jne    1e8 <printCurrentHistory+0x18>
+     20e:	83 ec 08             	sub    $0x8,%esp
+     211:	68 3e 17 00 00       	push   $0x173e
+     216:	68 40 20 00 00       	push   $0x2040
+     21b:	e8 d0 0a 00 00       	call   cf0 <strcmp>
+     220:	83 c4 10             	add    $0x10,%esp
+     223:	85 c0                	test   %eax,%eax
+     225:	74 c1                	je     1e8 <printCurrentHistory+0x18>
+      printf(1, "cmd %d: %s\n", i, buffer); 
+     227:	68 40 20 00 00       	push   $0x2040
+     22c:	53                   	push   %ebx
+  for( i = 0; i < numCommands; i++ )
+     22d:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "cmd %d: %s\n", i, buffer); 
+     230:	68 17 17 00 00       	push   $0x1717
+     235:	6a 01                	push   $0x1
+     237:	e8 d4 0e 00 00       	call   1110 <printf>
+  for( i = 0; i < numCommands; i++ )
+     23c:	a1 38 20 00 00       	mov    0x2038,%eax
+      printf(1, "cmd %d: %s\n", i, buffer); 
+     241:	83 c4 10             	add    $0x10,%esp
+  for( i = 0; i < numCommands; i++ )
+     244:	39 d8                	cmp    %ebx,%eax
+     246:	7f ac                	jg     1f4 <printCurrentHistory+0x24>
+}
+     248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     24b:	c9                   	leave
+     24c:	c3                   	ret
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+     250:	c3                   	ret
+     251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25f:	90                   	nop
+
+00000260 <panic>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     266:	ff 75 08             	push   0x8(%ebp)
+     269:	68 1f 17 00 00       	push   $0x171f
+     26e:	6a 02                	push   $0x2
+     270:	e8 9b 0e 00 00       	call   1110 <printf>
+  exit();
+     275:	e8 89 0c 00 00       	call   f03 <exit>
+     27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000280 <fork1>:
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     286:	e8 70 0c 00 00       	call   efb <fork>
+  if(pid == -1)
+     28b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     28e:	74 02                	je     292 <fork1+0x12>
+  return pid;
+}
+     290:	c9                   	leave
+     291:	c3                   	ret
+    panic("fork");
+     292:	83 ec 0c             	sub    $0xc,%esp
+     295:	68 23 17 00 00       	push   $0x1723
+     29a:	e8 c1 ff ff ff       	call   260 <panic>
+     29f:	90                   	nop
+
+000002a0 <runcmd>:
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	53                   	push   %ebx
+     2a4:	83 ec 14             	sub    $0x14,%esp
+     2a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     2aa:	85 db                	test   %ebx,%ebx
+     2ac:	74 42                	je     2f0 <runcmd+0x50>
+  switch(cmd->type){
+     2ae:	83 3b 05             	cmpl   $0x5,(%ebx)
+     2b1:	0f 87 e3 00 00 00    	ja     39a <runcmd+0xfa>
+     2b7:	8b 03                	mov    (%ebx),%eax
+     2b9:	ff 24 85 d8 17 00 00 	jmp    *0x17d8(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     2c0:	8b 43 04             	mov    0x4(%ebx),%eax
+     2c3:	85 c0                	test   %eax,%eax
+     2c5:	74 29                	je     2f0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     2c7:	8d 53 04             	lea    0x4(%ebx),%edx
+     2ca:	51                   	push   %ecx
+     2cb:	51                   	push   %ecx
+     2cc:	52                   	push   %edx
+     2cd:	50                   	push   %eax
+     2ce:	e8 68 0c 00 00       	call   f3b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     2d3:	83 c4 0c             	add    $0xc,%esp
+     2d6:	ff 73 04             	push   0x4(%ebx)
+     2d9:	68 2f 17 00 00       	push   $0x172f
+     2de:	6a 02                	push   $0x2
+     2e0:	e8 2b 0e 00 00       	call   1110 <printf>
+    break;
+     2e5:	83 c4 10             	add    $0x10,%esp
+     2e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    exit();
+     2f0:	e8 0e 0c 00 00       	call   f03 <exit>
+    if(fork1() == 0)
+     2f5:	e8 86 ff ff ff       	call   280 <fork1>
+     2fa:	85 c0                	test   %eax,%eax
+     2fc:	75 f2                	jne    2f0 <runcmd+0x50>
+     2fe:	e9 8c 00 00 00       	jmp    38f <runcmd+0xef>
+    if(pipe(p) < 0)
+     303:	83 ec 0c             	sub    $0xc,%esp
+     306:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     309:	50                   	push   %eax
+     30a:	e8 04 0c 00 00       	call   f13 <pipe>
+     30f:	83 c4 10             	add    $0x10,%esp
+     312:	85 c0                	test   %eax,%eax
+     314:	0f 88 a2 00 00 00    	js     3bc <runcmd+0x11c>
+    if(fork1() == 0){
+     31a:	e8 61 ff ff ff       	call   280 <fork1>
+     31f:	85 c0                	test   %eax,%eax
+     321:	0f 84 a2 00 00 00    	je     3c9 <runcmd+0x129>
+    if(fork1() == 0){
+     327:	e8 54 ff ff ff       	call   280 <fork1>
+     32c:	85 c0                	test   %eax,%eax
+     32e:	0f 84 c3 00 00 00    	je     3f7 <runcmd+0x157>
+    close(p[0]);
+     334:	83 ec 0c             	sub    $0xc,%esp
+     337:	ff 75 f0             	push   -0x10(%ebp)
+     33a:	e8 ec 0b 00 00       	call   f2b <close>
+    close(p[1]);
+     33f:	58                   	pop    %eax
+     340:	ff 75 f4             	push   -0xc(%ebp)
+     343:	e8 e3 0b 00 00       	call   f2b <close>
+    wait();
+     348:	e8 be 0b 00 00       	call   f0b <wait>
+    wait();
+     34d:	e8 b9 0b 00 00       	call   f0b <wait>
+    break;
+     352:	83 c4 10             	add    $0x10,%esp
+     355:	eb 99                	jmp    2f0 <runcmd+0x50>
+    if(fork1() == 0)
+     357:	e8 24 ff ff ff       	call   280 <fork1>
+     35c:	85 c0                	test   %eax,%eax
+     35e:	74 2f                	je     38f <runcmd+0xef>
+    wait();
+     360:	e8 a6 0b 00 00       	call   f0b <wait>
+    runcmd(lcmd->right);
+     365:	83 ec 0c             	sub    $0xc,%esp
+     368:	ff 73 08             	push   0x8(%ebx)
+     36b:	e8 30 ff ff ff       	call   2a0 <runcmd>
+    close(rcmd->fd);
+     370:	83 ec 0c             	sub    $0xc,%esp
+     373:	ff 73 14             	push   0x14(%ebx)
+     376:	e8 b0 0b 00 00       	call   f2b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     37b:	58                   	pop    %eax
+     37c:	5a                   	pop    %edx
+     37d:	ff 73 10             	push   0x10(%ebx)
+     380:	ff 73 08             	push   0x8(%ebx)
+     383:	e8 bb 0b 00 00       	call   f43 <open>
+     388:	83 c4 10             	add    $0x10,%esp
+     38b:	85 c0                	test   %eax,%eax
+     38d:	78 18                	js     3a7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     38f:	83 ec 0c             	sub    $0xc,%esp
+     392:	ff 73 04             	push   0x4(%ebx)
+     395:	e8 06 ff ff ff       	call   2a0 <runcmd>
+    panic("runcmd");
+     39a:	83 ec 0c             	sub    $0xc,%esp
+     39d:	68 28 17 00 00       	push   $0x1728
+     3a2:	e8 b9 fe ff ff       	call   260 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     3a7:	51                   	push   %ecx
+     3a8:	ff 73 08             	push   0x8(%ebx)
+     3ab:	68 3f 17 00 00       	push   $0x173f
+     3b0:	6a 02                	push   $0x2
+     3b2:	e8 59 0d 00 00       	call   1110 <printf>
+      exit();
+     3b7:	e8 47 0b 00 00       	call   f03 <exit>
+      panic("pipe");
+     3bc:	83 ec 0c             	sub    $0xc,%esp
+     3bf:	68 4f 17 00 00       	push   $0x174f
+     3c4:	e8 97 fe ff ff       	call   260 <panic>
+      close(1);
+     3c9:	83 ec 0c             	sub    $0xc,%esp
+     3cc:	6a 01                	push   $0x1
+     3ce:	e8 58 0b 00 00       	call   f2b <close>
+      dup(p[1]);
+     3d3:	58                   	pop    %eax
+     3d4:	ff 75 f4             	push   -0xc(%ebp)
+     3d7:	e8 9f 0b 00 00       	call   f7b <dup>
+      close(p[0]);
+     3dc:	58                   	pop    %eax
+     3dd:	ff 75 f0             	push   -0x10(%ebp)
+     3e0:	e8 46 0b 00 00       	call   f2b <close>
+      close(p[1]);
+     3e5:	58                   	pop    %eax
+     3e6:	ff 75 f4             	push   -0xc(%ebp)
+     3e9:	e8 3d 0b 00 00       	call   f2b <close>
+      runcmd(pcmd->left);
+     3ee:	5a                   	pop    %edx
+     3ef:	ff 73 04             	push   0x4(%ebx)
+     3f2:	e8 a9 fe ff ff       	call   2a0 <runcmd>
+      close(0);
+     3f7:	83 ec 0c             	sub    $0xc,%esp
+     3fa:	6a 00                	push   $0x0
+     3fc:	e8 2a 0b 00 00       	call   f2b <close>
+      dup(p[0]);
+     401:	5a                   	pop    %edx
+     402:	ff 75 f0             	push   -0x10(%ebp)
+     405:	e8 71 0b 00 00       	call   f7b <dup>
+      close(p[0]);
+     40a:	59                   	pop    %ecx
+     40b:	ff 75 f0             	push   -0x10(%ebp)
+     40e:	e8 18 0b 00 00       	call   f2b <close>
+      close(p[1]);
+     413:	58                   	pop    %eax
+     414:	ff 75 f4             	push   -0xc(%ebp)
+     417:	e8 0f 0b 00 00       	call   f2b <close>
+      runcmd(pcmd->right);
+     41c:	58                   	pop    %eax
+     41d:	ff 73 08             	push   0x8(%ebx)
+     420:	e8 7b fe ff ff       	call   2a0 <runcmd>
+     425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     437:	6a 54                	push   $0x54
+     439:	e8 32 0f 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     43e:	83 c4 0c             	add    $0xc,%esp
+     441:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     443:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     445:	6a 00                	push   $0x0
+     447:	50                   	push   %eax
+     448:	e8 33 09 00 00       	call   d80 <memset>
+  cmd->type = EXEC;
+     44d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     453:	89 d8                	mov    %ebx,%eax
+     455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     458:	c9                   	leave
+     459:	c3                   	ret
+     45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000460 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	53                   	push   %ebx
+     464:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     467:	6a 18                	push   $0x18
+     469:	e8 02 0f 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     46e:	83 c4 0c             	add    $0xc,%esp
+     471:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     473:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     475:	6a 00                	push   $0x0
+     477:	50                   	push   %eax
+     478:	e8 03 09 00 00       	call   d80 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     47d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     480:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     486:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     489:	8b 45 0c             	mov    0xc(%ebp),%eax
+     48c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     48f:	8b 45 10             	mov    0x10(%ebp),%eax
+     492:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     495:	8b 45 14             	mov    0x14(%ebp),%eax
+     498:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     49b:	8b 45 18             	mov    0x18(%ebp),%eax
+     49e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     4a1:	89 d8                	mov    %ebx,%eax
+     4a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a6:	c9                   	leave
+     4a7:	c3                   	ret
+     4a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4af:	90                   	nop
+
+000004b0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	53                   	push   %ebx
+     4b4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4b7:	6a 0c                	push   $0xc
+     4b9:	e8 b2 0e 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4be:	83 c4 0c             	add    $0xc,%esp
+     4c1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     4c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4c5:	6a 00                	push   $0x0
+     4c7:	50                   	push   %eax
+     4c8:	e8 b3 08 00 00       	call   d80 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     4cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     4d0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     4d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     4d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     4df:	89 d8                	mov    %ebx,%eax
+     4e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e4:	c9                   	leave
+     4e5:	c3                   	ret
+     4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	53                   	push   %ebx
+     4f4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4f7:	6a 0c                	push   $0xc
+     4f9:	e8 72 0e 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4fe:	83 c4 0c             	add    $0xc,%esp
+     501:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     503:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     505:	6a 00                	push   $0x0
+     507:	50                   	push   %eax
+     508:	e8 73 08 00 00       	call   d80 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     50d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     510:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     516:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     519:	8b 45 0c             	mov    0xc(%ebp),%eax
+     51c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     51f:	89 d8                	mov    %ebx,%eax
+     521:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     524:	c9                   	leave
+     525:	c3                   	ret
+     526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	53                   	push   %ebx
+     534:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     537:	6a 08                	push   $0x8
+     539:	e8 32 0e 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     53e:	83 c4 0c             	add    $0xc,%esp
+     541:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     543:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     545:	6a 00                	push   $0x0
+     547:	50                   	push   %eax
+     548:	e8 33 08 00 00       	call   d80 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     54d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     550:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     556:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     559:	89 d8                	mov    %ebx,%eax
+     55b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     55e:	c9                   	leave
+     55f:	c3                   	ret
+
+00000560 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	57                   	push   %edi
+     564:	56                   	push   %esi
+     565:	53                   	push   %ebx
+     566:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     569:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     56c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     56f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     572:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     574:	39 df                	cmp    %ebx,%edi
+     576:	72 0f                	jb     587 <gettoken+0x27>
+     578:	eb 25                	jmp    59f <gettoken+0x3f>
+     57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     580:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     583:	39 fb                	cmp    %edi,%ebx
+     585:	74 18                	je     59f <gettoken+0x3f>
+     587:	0f be 07             	movsbl (%edi),%eax
+     58a:	83 ec 08             	sub    $0x8,%esp
+     58d:	50                   	push   %eax
+     58e:	68 30 20 00 00       	push   $0x2030
+     593:	e8 08 08 00 00       	call   da0 <strchr>
+     598:	83 c4 10             	add    $0x10,%esp
+     59b:	85 c0                	test   %eax,%eax
+     59d:	75 e1                	jne    580 <gettoken+0x20>
+  if(q)
+     59f:	85 f6                	test   %esi,%esi
+     5a1:	74 02                	je     5a5 <gettoken+0x45>
+    *q = s;
+     5a3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     5a5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     5a8:	3c 3c                	cmp    $0x3c,%al
+     5aa:	0f 8f d0 00 00 00    	jg     680 <gettoken+0x120>
+     5b0:	3c 3a                	cmp    $0x3a,%al
+     5b2:	0f 8f bc 00 00 00    	jg     674 <gettoken+0x114>
+     5b8:	84 c0                	test   %al,%al
+     5ba:	75 44                	jne    600 <gettoken+0xa0>
+     5bc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     5be:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     5c1:	85 c9                	test   %ecx,%ecx
+     5c3:	74 05                	je     5ca <gettoken+0x6a>
+    *eq = s;
+     5c5:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     5ca:	39 df                	cmp    %ebx,%edi
+     5cc:	72 09                	jb     5d7 <gettoken+0x77>
+     5ce:	eb 1f                	jmp    5ef <gettoken+0x8f>
+    s++;
+     5d0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     5d3:	39 fb                	cmp    %edi,%ebx
+     5d5:	74 18                	je     5ef <gettoken+0x8f>
+     5d7:	0f be 07             	movsbl (%edi),%eax
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	50                   	push   %eax
+     5de:	68 30 20 00 00       	push   $0x2030
+     5e3:	e8 b8 07 00 00       	call   da0 <strchr>
+     5e8:	83 c4 10             	add    $0x10,%esp
+     5eb:	85 c0                	test   %eax,%eax
+     5ed:	75 e1                	jne    5d0 <gettoken+0x70>
+  *ps = s;
+     5ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     5f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5f7:	89 f0                	mov    %esi,%eax
+     5f9:	5b                   	pop    %ebx
+     5fa:	5e                   	pop    %esi
+     5fb:	5f                   	pop    %edi
+     5fc:	5d                   	pop    %ebp
+     5fd:	c3                   	ret
+     5fe:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     600:	79 66                	jns    668 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     602:	39 df                	cmp    %ebx,%edi
+     604:	72 39                	jb     63f <gettoken+0xdf>
+  if(eq)
+     606:	8b 55 14             	mov    0x14(%ebp),%edx
+     609:	85 d2                	test   %edx,%edx
+     60b:	0f 84 b3 00 00 00    	je     6c4 <gettoken+0x164>
+    *eq = s;
+     611:	8b 45 14             	mov    0x14(%ebp),%eax
+     614:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     616:	e9 a9 00 00 00       	jmp    6c4 <gettoken+0x164>
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     620:	0f be 07             	movsbl (%edi),%eax
+     623:	83 ec 08             	sub    $0x8,%esp
+     626:	50                   	push   %eax
+     627:	68 28 20 00 00       	push   $0x2028
+     62c:	e8 6f 07 00 00       	call   da0 <strchr>
+     631:	83 c4 10             	add    $0x10,%esp
+     634:	85 c0                	test   %eax,%eax
+     636:	75 1f                	jne    657 <gettoken+0xf7>
+      s++;
+     638:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     63b:	39 fb                	cmp    %edi,%ebx
+     63d:	74 77                	je     6b6 <gettoken+0x156>
+     63f:	0f be 07             	movsbl (%edi),%eax
+     642:	83 ec 08             	sub    $0x8,%esp
+     645:	50                   	push   %eax
+     646:	68 30 20 00 00       	push   $0x2030
+     64b:	e8 50 07 00 00       	call   da0 <strchr>
+     650:	83 c4 10             	add    $0x10,%esp
+     653:	85 c0                	test   %eax,%eax
+     655:	74 c9                	je     620 <gettoken+0xc0>
+    ret = 'a';
+     657:	be 61 00 00 00       	mov    $0x61,%esi
+     65c:	e9 5d ff ff ff       	jmp    5be <gettoken+0x5e>
+     661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     668:	3c 26                	cmp    $0x26,%al
+     66a:	74 08                	je     674 <gettoken+0x114>
+     66c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     66f:	80 f9 01             	cmp    $0x1,%cl
+     672:	77 8e                	ja     602 <gettoken+0xa2>
+  ret = *s;
+     674:	0f be f0             	movsbl %al,%esi
+    s++;
+     677:	83 c7 01             	add    $0x1,%edi
+    break;
+     67a:	e9 3f ff ff ff       	jmp    5be <gettoken+0x5e>
+     67f:	90                   	nop
+  switch(*s){
+     680:	3c 3e                	cmp    $0x3e,%al
+     682:	75 1c                	jne    6a0 <gettoken+0x140>
+    if(*s == '>'){
+     684:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     688:	74 1f                	je     6a9 <gettoken+0x149>
+    s++;
+     68a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     68d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     692:	e9 27 ff ff ff       	jmp    5be <gettoken+0x5e>
+     697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     6a0:	3c 7c                	cmp    $0x7c,%al
+     6a2:	74 d0                	je     674 <gettoken+0x114>
+     6a4:	e9 59 ff ff ff       	jmp    602 <gettoken+0xa2>
+      s++;
+     6a9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     6ac:	be 2b 00 00 00       	mov    $0x2b,%esi
+     6b1:	e9 08 ff ff ff       	jmp    5be <gettoken+0x5e>
+  if(eq)
+     6b6:	8b 45 14             	mov    0x14(%ebp),%eax
+     6b9:	85 c0                	test   %eax,%eax
+     6bb:	74 05                	je     6c2 <gettoken+0x162>
+    *eq = s;
+     6bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     6c0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     6c2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     6c4:	be 61 00 00 00       	mov    $0x61,%esi
+     6c9:	e9 21 ff ff ff       	jmp    5ef <gettoken+0x8f>
+     6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 0c             	sub    $0xc,%esp
+     6d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     6dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     6df:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     6e1:	39 f3                	cmp    %esi,%ebx
+     6e3:	72 12                	jb     6f7 <peek+0x27>
+     6e5:	eb 28                	jmp    70f <peek+0x3f>
+     6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ee:	66 90                	xchg   %ax,%ax
+    s++;
+     6f0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     6f3:	39 de                	cmp    %ebx,%esi
+     6f5:	74 18                	je     70f <peek+0x3f>
+     6f7:	0f be 03             	movsbl (%ebx),%eax
+     6fa:	83 ec 08             	sub    $0x8,%esp
+     6fd:	50                   	push   %eax
+     6fe:	68 30 20 00 00       	push   $0x2030
+     703:	e8 98 06 00 00       	call   da0 <strchr>
+     708:	83 c4 10             	add    $0x10,%esp
+     70b:	85 c0                	test   %eax,%eax
+     70d:	75 e1                	jne    6f0 <peek+0x20>
+  *ps = s;
+     70f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     711:	0f be 03             	movsbl (%ebx),%eax
+     714:	31 d2                	xor    %edx,%edx
+     716:	84 c0                	test   %al,%al
+     718:	75 0e                	jne    728 <peek+0x58>
+}
+     71a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     71d:	89 d0                	mov    %edx,%eax
+     71f:	5b                   	pop    %ebx
+     720:	5e                   	pop    %esi
+     721:	5f                   	pop    %edi
+     722:	5d                   	pop    %ebp
+     723:	c3                   	ret
+     724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     728:	83 ec 08             	sub    $0x8,%esp
+     72b:	50                   	push   %eax
+     72c:	ff 75 10             	push   0x10(%ebp)
+     72f:	e8 6c 06 00 00       	call   da0 <strchr>
+     734:	83 c4 10             	add    $0x10,%esp
+     737:	31 d2                	xor    %edx,%edx
+     739:	85 c0                	test   %eax,%eax
+     73b:	0f 95 c2             	setne  %dl
+}
+     73e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     741:	5b                   	pop    %ebx
+     742:	89 d0                	mov    %edx,%eax
+     744:	5e                   	pop    %esi
+     745:	5f                   	pop    %edi
+     746:	5d                   	pop    %ebp
+     747:	c3                   	ret
+     748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	57                   	push   %edi
+     754:	56                   	push   %esi
+     755:	53                   	push   %ebx
+     756:	83 ec 2c             	sub    $0x2c,%esp
+     759:	8b 75 0c             	mov    0xc(%ebp),%esi
+     75c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     75f:	90                   	nop
+     760:	83 ec 04             	sub    $0x4,%esp
+     763:	68 71 17 00 00       	push   $0x1771
+     768:	53                   	push   %ebx
+     769:	56                   	push   %esi
+     76a:	e8 61 ff ff ff       	call   6d0 <peek>
+     76f:	83 c4 10             	add    $0x10,%esp
+     772:	85 c0                	test   %eax,%eax
+     774:	0f 84 f6 00 00 00    	je     870 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     77a:	6a 00                	push   $0x0
+     77c:	6a 00                	push   $0x0
+     77e:	53                   	push   %ebx
+     77f:	56                   	push   %esi
+     780:	e8 db fd ff ff       	call   560 <gettoken>
+     785:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     787:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     78a:	50                   	push   %eax
+     78b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     78e:	50                   	push   %eax
+     78f:	53                   	push   %ebx
+     790:	56                   	push   %esi
+     791:	e8 ca fd ff ff       	call   560 <gettoken>
+     796:	83 c4 20             	add    $0x20,%esp
+     799:	83 f8 61             	cmp    $0x61,%eax
+     79c:	0f 85 d9 00 00 00    	jne    87b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     7a2:	83 ff 3c             	cmp    $0x3c,%edi
+     7a5:	74 69                	je     810 <parseredirs+0xc0>
+     7a7:	83 ff 3e             	cmp    $0x3e,%edi
+     7aa:	74 05                	je     7b1 <parseredirs+0x61>
+     7ac:	83 ff 2b             	cmp    $0x2b,%edi
+     7af:	75 af                	jne    760 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     7b4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     7b7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7ba:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     7bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     7c0:	6a 18                	push   $0x18
+     7c2:	e8 a9 0b 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7c7:	83 c4 0c             	add    $0xc,%esp
+     7ca:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     7cc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     7ce:	6a 00                	push   $0x0
+     7d0:	50                   	push   %eax
+     7d1:	e8 aa 05 00 00       	call   d80 <memset>
+  cmd->type = REDIR;
+     7d6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     7dc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     7df:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     7e2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     7e5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     7e8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     7eb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     7ee:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     7f5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     7f8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     7ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+     802:	e9 59 ff ff ff       	jmp    760 <parseredirs+0x10>
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     810:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     813:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     816:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     819:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     81c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     81f:	6a 18                	push   $0x18
+     821:	e8 4a 0b 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     826:	83 c4 0c             	add    $0xc,%esp
+     829:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     82b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     82d:	6a 00                	push   $0x0
+     82f:	50                   	push   %eax
+     830:	e8 4b 05 00 00       	call   d80 <memset>
+  cmd->cmd = subcmd;
+     835:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     838:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     83b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     83e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     841:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     847:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     84a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     84d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     850:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     853:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     85a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     861:	e9 fa fe ff ff       	jmp    760 <parseredirs+0x10>
+     866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     870:	8b 45 08             	mov    0x8(%ebp),%eax
+     873:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     876:	5b                   	pop    %ebx
+     877:	5e                   	pop    %esi
+     878:	5f                   	pop    %edi
+     879:	5d                   	pop    %ebp
+     87a:	c3                   	ret
+      panic("missing file for redirection");
+     87b:	83 ec 0c             	sub    $0xc,%esp
+     87e:	68 54 17 00 00       	push   $0x1754
+     883:	e8 d8 f9 ff ff       	call   260 <panic>
+     888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+
+00000890 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	53                   	push   %ebx
+     896:	83 ec 30             	sub    $0x30,%esp
+     899:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     89c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     89f:	68 74 17 00 00       	push   $0x1774
+     8a4:	56                   	push   %esi
+     8a5:	53                   	push   %ebx
+     8a6:	e8 25 fe ff ff       	call   6d0 <peek>
+     8ab:	83 c4 10             	add    $0x10,%esp
+     8ae:	85 c0                	test   %eax,%eax
+     8b0:	0f 85 aa 00 00 00    	jne    960 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     8b6:	83 ec 0c             	sub    $0xc,%esp
+     8b9:	89 c7                	mov    %eax,%edi
+     8bb:	6a 54                	push   $0x54
+     8bd:	e8 ae 0a 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8c2:	83 c4 0c             	add    $0xc,%esp
+     8c5:	6a 54                	push   $0x54
+     8c7:	6a 00                	push   $0x0
+     8c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     8cc:	50                   	push   %eax
+     8cd:	e8 ae 04 00 00       	call   d80 <memset>
+  cmd->type = EXEC;
+     8d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     8d5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     8d8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     8de:	56                   	push   %esi
+     8df:	53                   	push   %ebx
+     8e0:	50                   	push   %eax
+     8e1:	e8 6a fe ff ff       	call   750 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     8e6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     8e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     8ec:	eb 15                	jmp    903 <parseexec+0x73>
+     8ee:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     8f0:	83 ec 04             	sub    $0x4,%esp
+     8f3:	56                   	push   %esi
+     8f4:	53                   	push   %ebx
+     8f5:	ff 75 d4             	push   -0x2c(%ebp)
+     8f8:	e8 53 fe ff ff       	call   750 <parseredirs>
+     8fd:	83 c4 10             	add    $0x10,%esp
+     900:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     903:	83 ec 04             	sub    $0x4,%esp
+     906:	68 8b 17 00 00       	push   $0x178b
+     90b:	56                   	push   %esi
+     90c:	53                   	push   %ebx
+     90d:	e8 be fd ff ff       	call   6d0 <peek>
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	75 5f                	jne    978 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     919:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     91c:	50                   	push   %eax
+     91d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     920:	50                   	push   %eax
+     921:	56                   	push   %esi
+     922:	53                   	push   %ebx
+     923:	e8 38 fc ff ff       	call   560 <gettoken>
+     928:	83 c4 10             	add    $0x10,%esp
+     92b:	85 c0                	test   %eax,%eax
+     92d:	74 49                	je     978 <parseexec+0xe8>
+    if(tok != 'a')
+     92f:	83 f8 61             	cmp    $0x61,%eax
+     932:	75 62                	jne    996 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     934:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     937:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     93a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     93e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     941:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     945:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     948:	83 ff 0a             	cmp    $0xa,%edi
+     94b:	75 a3                	jne    8f0 <parseexec+0x60>
+      panic("too many args");
+     94d:	83 ec 0c             	sub    $0xc,%esp
+     950:	68 7d 17 00 00       	push   $0x177d
+     955:	e8 06 f9 ff ff       	call   260 <panic>
+     95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     960:	89 75 0c             	mov    %esi,0xc(%ebp)
+     963:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     969:	5b                   	pop    %ebx
+     96a:	5e                   	pop    %esi
+     96b:	5f                   	pop    %edi
+     96c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     96d:	e9 ae 01 00 00       	jmp    b20 <parseblock>
+     972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     978:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     97b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     982:	00 
+  cmd->eargv[argc] = 0;
+     983:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     98a:	00 
+}
+     98b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     98e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     991:	5b                   	pop    %ebx
+     992:	5e                   	pop    %esi
+     993:	5f                   	pop    %edi
+     994:	5d                   	pop    %ebp
+     995:	c3                   	ret
+      panic("syntax");
+     996:	83 ec 0c             	sub    $0xc,%esp
+     999:	68 76 17 00 00       	push   $0x1776
+     99e:	e8 bd f8 ff ff       	call   260 <panic>
+     9a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009b0 <parsepipe>:
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	56                   	push   %esi
+     9b5:	53                   	push   %ebx
+     9b6:	83 ec 14             	sub    $0x14,%esp
+     9b9:	8b 75 08             	mov    0x8(%ebp),%esi
+     9bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     9bf:	57                   	push   %edi
+     9c0:	56                   	push   %esi
+     9c1:	e8 ca fe ff ff       	call   890 <parseexec>
+  if(peek(ps, es, "|")){
+     9c6:	83 c4 0c             	add    $0xc,%esp
+     9c9:	68 90 17 00 00       	push   $0x1790
+  cmd = parseexec(ps, es);
+     9ce:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     9d0:	57                   	push   %edi
+     9d1:	56                   	push   %esi
+     9d2:	e8 f9 fc ff ff       	call   6d0 <peek>
+     9d7:	83 c4 10             	add    $0x10,%esp
+     9da:	85 c0                	test   %eax,%eax
+     9dc:	75 12                	jne    9f0 <parsepipe+0x40>
+}
+     9de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9e1:	89 d8                	mov    %ebx,%eax
+     9e3:	5b                   	pop    %ebx
+     9e4:	5e                   	pop    %esi
+     9e5:	5f                   	pop    %edi
+     9e6:	5d                   	pop    %ebp
+     9e7:	c3                   	ret
+     9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     9f0:	6a 00                	push   $0x0
+     9f2:	6a 00                	push   $0x0
+     9f4:	57                   	push   %edi
+     9f5:	56                   	push   %esi
+     9f6:	e8 65 fb ff ff       	call   560 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     9fb:	58                   	pop    %eax
+     9fc:	5a                   	pop    %edx
+     9fd:	57                   	push   %edi
+     9fe:	56                   	push   %esi
+     9ff:	e8 ac ff ff ff       	call   9b0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     a04:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     a0b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     a0d:	e8 5e 09 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a12:	83 c4 0c             	add    $0xc,%esp
+     a15:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a17:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a19:	6a 00                	push   $0x0
+     a1b:	50                   	push   %eax
+     a1c:	e8 5f 03 00 00       	call   d80 <memset>
+  cmd->left = left;
+     a21:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a24:	83 c4 10             	add    $0x10,%esp
+     a27:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     a29:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     a2f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a31:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a37:	5b                   	pop    %ebx
+     a38:	5e                   	pop    %esi
+     a39:	5f                   	pop    %edi
+     a3a:	5d                   	pop    %ebp
+     a3b:	c3                   	ret
+     a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <parseline>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	83 ec 24             	sub    $0x24,%esp
+     a49:	8b 75 08             	mov    0x8(%ebp),%esi
+     a4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     a4f:	57                   	push   %edi
+     a50:	56                   	push   %esi
+     a51:	e8 5a ff ff ff       	call   9b0 <parsepipe>
+  while(peek(ps, es, "&")){
+     a56:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     a59:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     a5b:	eb 3b                	jmp    a98 <parseline+0x58>
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     a60:	6a 00                	push   $0x0
+     a62:	6a 00                	push   $0x0
+     a64:	57                   	push   %edi
+     a65:	56                   	push   %esi
+     a66:	e8 f5 fa ff ff       	call   560 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     a6b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     a72:	e8 f9 08 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a77:	83 c4 0c             	add    $0xc,%esp
+     a7a:	6a 08                	push   $0x8
+     a7c:	6a 00                	push   $0x0
+     a7e:	50                   	push   %eax
+     a7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     a82:	e8 f9 02 00 00       	call   d80 <memset>
+  cmd->type = BACK;
+     a87:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     a8a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     a8d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     a93:	89 5a 04             	mov    %ebx,0x4(%edx)
+     a96:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     a98:	83 ec 04             	sub    $0x4,%esp
+     a9b:	68 92 17 00 00       	push   $0x1792
+     aa0:	57                   	push   %edi
+     aa1:	56                   	push   %esi
+     aa2:	e8 29 fc ff ff       	call   6d0 <peek>
+     aa7:	83 c4 10             	add    $0x10,%esp
+     aaa:	85 c0                	test   %eax,%eax
+     aac:	75 b2                	jne    a60 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     aae:	83 ec 04             	sub    $0x4,%esp
+     ab1:	68 8e 17 00 00       	push   $0x178e
+     ab6:	57                   	push   %edi
+     ab7:	56                   	push   %esi
+     ab8:	e8 13 fc ff ff       	call   6d0 <peek>
+     abd:	83 c4 10             	add    $0x10,%esp
+     ac0:	85 c0                	test   %eax,%eax
+     ac2:	75 0c                	jne    ad0 <parseline+0x90>
+}
+     ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac7:	89 d8                	mov    %ebx,%eax
+     ac9:	5b                   	pop    %ebx
+     aca:	5e                   	pop    %esi
+     acb:	5f                   	pop    %edi
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+     ace:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     ad0:	6a 00                	push   $0x0
+     ad2:	6a 00                	push   $0x0
+     ad4:	57                   	push   %edi
+     ad5:	56                   	push   %esi
+     ad6:	e8 85 fa ff ff       	call   560 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     adb:	58                   	pop    %eax
+     adc:	5a                   	pop    %edx
+     add:	57                   	push   %edi
+     ade:	56                   	push   %esi
+     adf:	e8 5c ff ff ff       	call   a40 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     ae4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     aeb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     aed:	e8 7e 08 00 00       	call   1370 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     af2:	83 c4 0c             	add    $0xc,%esp
+     af5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     af7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     af9:	6a 00                	push   $0x0
+     afb:	50                   	push   %eax
+     afc:	e8 7f 02 00 00       	call   d80 <memset>
+  cmd->left = left;
+     b01:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b04:	83 c4 10             	add    $0x10,%esp
+     b07:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     b09:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     b0f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b11:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b17:	5b                   	pop    %ebx
+     b18:	5e                   	pop    %esi
+     b19:	5f                   	pop    %edi
+     b1a:	5d                   	pop    %ebp
+     b1b:	c3                   	ret
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <parseblock>:
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	56                   	push   %esi
+     b25:	53                   	push   %ebx
+     b26:	83 ec 10             	sub    $0x10,%esp
+     b29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     b2f:	68 74 17 00 00       	push   $0x1774
+     b34:	56                   	push   %esi
+     b35:	53                   	push   %ebx
+     b36:	e8 95 fb ff ff       	call   6d0 <peek>
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	85 c0                	test   %eax,%eax
+     b40:	74 4a                	je     b8c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     b42:	6a 00                	push   $0x0
+     b44:	6a 00                	push   $0x0
+     b46:	56                   	push   %esi
+     b47:	53                   	push   %ebx
+     b48:	e8 13 fa ff ff       	call   560 <gettoken>
+  cmd = parseline(ps, es);
+     b4d:	58                   	pop    %eax
+     b4e:	5a                   	pop    %edx
+     b4f:	56                   	push   %esi
+     b50:	53                   	push   %ebx
+     b51:	e8 ea fe ff ff       	call   a40 <parseline>
+  if(!peek(ps, es, ")"))
+     b56:	83 c4 0c             	add    $0xc,%esp
+     b59:	68 b0 17 00 00       	push   $0x17b0
+  cmd = parseline(ps, es);
+     b5e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     b60:	56                   	push   %esi
+     b61:	53                   	push   %ebx
+     b62:	e8 69 fb ff ff       	call   6d0 <peek>
+     b67:	83 c4 10             	add    $0x10,%esp
+     b6a:	85 c0                	test   %eax,%eax
+     b6c:	74 2b                	je     b99 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     b6e:	6a 00                	push   $0x0
+     b70:	6a 00                	push   $0x0
+     b72:	56                   	push   %esi
+     b73:	53                   	push   %ebx
+     b74:	e8 e7 f9 ff ff       	call   560 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     b79:	83 c4 0c             	add    $0xc,%esp
+     b7c:	56                   	push   %esi
+     b7d:	53                   	push   %ebx
+     b7e:	57                   	push   %edi
+     b7f:	e8 cc fb ff ff       	call   750 <parseredirs>
+}
+     b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b87:	5b                   	pop    %ebx
+     b88:	5e                   	pop    %esi
+     b89:	5f                   	pop    %edi
+     b8a:	5d                   	pop    %ebp
+     b8b:	c3                   	ret
+    panic("parseblock");
+     b8c:	83 ec 0c             	sub    $0xc,%esp
+     b8f:	68 94 17 00 00       	push   $0x1794
+     b94:	e8 c7 f6 ff ff       	call   260 <panic>
+    panic("syntax - missing )");
+     b99:	83 ec 0c             	sub    $0xc,%esp
+     b9c:	68 9f 17 00 00       	push   $0x179f
+     ba1:	e8 ba f6 ff ff       	call   260 <panic>
+     ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	53                   	push   %ebx
+     bb4:	83 ec 04             	sub    $0x4,%esp
+     bb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     bba:	85 db                	test   %ebx,%ebx
+     bbc:	0f 84 7e 00 00 00    	je     c40 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     bc2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     bc5:	77 20                	ja     be7 <nulterminate+0x37>
+     bc7:	8b 03                	mov    (%ebx),%eax
+     bc9:	ff 24 85 f0 17 00 00 	jmp    *0x17f0(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     bd0:	83 ec 0c             	sub    $0xc,%esp
+     bd3:	ff 73 04             	push   0x4(%ebx)
+     bd6:	e8 d5 ff ff ff       	call   bb0 <nulterminate>
+    nulterminate(lcmd->right);
+     bdb:	58                   	pop    %eax
+     bdc:	ff 73 08             	push   0x8(%ebx)
+     bdf:	e8 cc ff ff ff       	call   bb0 <nulterminate>
+    break;
+     be4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     be7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     be9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bec:	c9                   	leave
+     bed:	c3                   	ret
+     bee:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	ff 73 04             	push   0x4(%ebx)
+     bf6:	e8 b5 ff ff ff       	call   bb0 <nulterminate>
+    break;
+     bfb:	83 c4 10             	add    $0x10,%esp
+     bfe:	eb e7                	jmp    be7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     c00:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     c03:	8d 43 08             	lea    0x8(%ebx),%eax
+     c06:	85 c9                	test   %ecx,%ecx
+     c08:	74 dd                	je     be7 <nulterminate+0x37>
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     c10:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     c13:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     c16:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     c19:	8b 50 fc             	mov    -0x4(%eax),%edx
+     c1c:	85 d2                	test   %edx,%edx
+     c1e:	75 f0                	jne    c10 <nulterminate+0x60>
+     c20:	eb c5                	jmp    be7 <nulterminate+0x37>
+     c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     c28:	83 ec 0c             	sub    $0xc,%esp
+     c2b:	ff 73 04             	push   0x4(%ebx)
+     c2e:	e8 7d ff ff ff       	call   bb0 <nulterminate>
+    *rcmd->efile = 0;
+     c33:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     c36:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c39:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c3c:	eb a9                	jmp    be7 <nulterminate+0x37>
+     c3e:	66 90                	xchg   %ax,%ax
+    return 0;
+     c40:	31 c0                	xor    %eax,%eax
+     c42:	eb a5                	jmp    be9 <nulterminate+0x39>
+     c44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <parsecmd>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     c55:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     c58:	53                   	push   %ebx
+     c59:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     c5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c5f:	53                   	push   %ebx
+     c60:	e8 eb 00 00 00       	call   d50 <strlen>
+  cmd = parseline(&s, es);
+     c65:	59                   	pop    %ecx
+     c66:	5e                   	pop    %esi
+  es = s + strlen(s);
+     c67:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     c69:	53                   	push   %ebx
+     c6a:	57                   	push   %edi
+     c6b:	e8 d0 fd ff ff       	call   a40 <parseline>
+  peek(&s, es, "");
+     c70:	83 c4 0c             	add    $0xc,%esp
+     c73:	68 3e 17 00 00       	push   $0x173e
+  cmd = parseline(&s, es);
+     c78:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     c7a:	53                   	push   %ebx
+     c7b:	57                   	push   %edi
+     c7c:	e8 4f fa ff ff       	call   6d0 <peek>
+  if(s != es){
+     c81:	8b 45 08             	mov    0x8(%ebp),%eax
+     c84:	83 c4 10             	add    $0x10,%esp
+     c87:	39 d8                	cmp    %ebx,%eax
+     c89:	75 13                	jne    c9e <parsecmd+0x4e>
+  nulterminate(cmd);
+     c8b:	83 ec 0c             	sub    $0xc,%esp
+     c8e:	56                   	push   %esi
+     c8f:	e8 1c ff ff ff       	call   bb0 <nulterminate>
+}
+     c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c97:	89 f0                	mov    %esi,%eax
+     c99:	5b                   	pop    %ebx
+     c9a:	5e                   	pop    %esi
+     c9b:	5f                   	pop    %edi
+     c9c:	5d                   	pop    %ebp
+     c9d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     c9e:	52                   	push   %edx
+     c9f:	50                   	push   %eax
+     ca0:	68 b2 17 00 00       	push   $0x17b2
+     ca5:	6a 02                	push   $0x2
+     ca7:	e8 64 04 00 00       	call   1110 <printf>
+    panic("syntax");
+     cac:	c7 04 24 76 17 00 00 	movl   $0x1776,(%esp)
+     cb3:	e8 a8 f5 ff ff       	call   260 <panic>
+     cb8:	66 90                	xchg   %ax,%ax
+     cba:	66 90                	xchg   %ax,%ax
+     cbc:	66 90                	xchg   %ax,%ax
+     cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     cc0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     cc1:	31 c0                	xor    %eax,%eax
+{
+     cc3:	89 e5                	mov    %esp,%ebp
+     cc5:	53                   	push   %ebx
+     cc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     cc9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     cd0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     cd4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     cd7:	83 c0 01             	add    $0x1,%eax
+     cda:	84 d2                	test   %dl,%dl
+     cdc:	75 f2                	jne    cd0 <strcpy+0x10>
+    ;
+  return os;
+}
+     cde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ce1:	89 c8                	mov    %ecx,%eax
+     ce3:	c9                   	leave
+     ce4:	c3                   	ret
+     ce5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	53                   	push   %ebx
+     cf4:	8b 55 08             	mov    0x8(%ebp),%edx
+     cf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     cfa:	0f b6 02             	movzbl (%edx),%eax
+     cfd:	84 c0                	test   %al,%al
+     cff:	75 17                	jne    d18 <strcmp+0x28>
+     d01:	eb 3a                	jmp    d3d <strcmp+0x4d>
+     d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d07:	90                   	nop
+     d08:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     d0c:	83 c2 01             	add    $0x1,%edx
+     d0f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     d12:	84 c0                	test   %al,%al
+     d14:	74 1a                	je     d30 <strcmp+0x40>
+    p++, q++;
+     d16:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     d18:	0f b6 19             	movzbl (%ecx),%ebx
+     d1b:	38 c3                	cmp    %al,%bl
+     d1d:	74 e9                	je     d08 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     d1f:	29 d8                	sub    %ebx,%eax
+}
+     d21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d24:	c9                   	leave
+     d25:	c3                   	ret
+     d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     d30:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     d34:	31 c0                	xor    %eax,%eax
+     d36:	29 d8                	sub    %ebx,%eax
+}
+     d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d3b:	c9                   	leave
+     d3c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     d3d:	0f b6 19             	movzbl (%ecx),%ebx
+     d40:	31 c0                	xor    %eax,%eax
+     d42:	eb db                	jmp    d1f <strcmp+0x2f>
+     d44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+
+00000d50 <strlen>:
+
+uint
+strlen(char *s)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     d56:	80 3a 00             	cmpb   $0x0,(%edx)
+     d59:	74 15                	je     d70 <strlen+0x20>
+     d5b:	31 c0                	xor    %eax,%eax
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+     d60:	83 c0 01             	add    $0x1,%eax
+     d63:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     d67:	89 c1                	mov    %eax,%ecx
+     d69:	75 f5                	jne    d60 <strlen+0x10>
+    ;
+  return n;
+}
+     d6b:	89 c8                	mov    %ecx,%eax
+     d6d:	5d                   	pop    %ebp
+     d6e:	c3                   	ret
+     d6f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     d70:	31 c9                	xor    %ecx,%ecx
+}
+     d72:	5d                   	pop    %ebp
+     d73:	89 c8                	mov    %ecx,%eax
+     d75:	c3                   	ret
+     d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d80 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	57                   	push   %edi
+     d84:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     d87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     d8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d8d:	89 d7                	mov    %edx,%edi
+     d8f:	fc                   	cld
+     d90:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     d92:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     d95:	89 d0                	mov    %edx,%eax
+     d97:	c9                   	leave
+     d98:	c3                   	ret
+     d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	8b 45 08             	mov    0x8(%ebp),%eax
+     da6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     daa:	0f b6 10             	movzbl (%eax),%edx
+     dad:	84 d2                	test   %dl,%dl
+     daf:	75 12                	jne    dc3 <strchr+0x23>
+     db1:	eb 1d                	jmp    dd0 <strchr+0x30>
+     db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     db7:	90                   	nop
+     db8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     dbc:	83 c0 01             	add    $0x1,%eax
+     dbf:	84 d2                	test   %dl,%dl
+     dc1:	74 0d                	je     dd0 <strchr+0x30>
+    if(*s == c)
+     dc3:	38 d1                	cmp    %dl,%cl
+     dc5:	75 f1                	jne    db8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     dc7:	5d                   	pop    %ebp
+     dc8:	c3                   	ret
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     dd0:	31 c0                	xor    %eax,%eax
+}
+     dd2:	5d                   	pop    %ebp
+     dd3:	c3                   	ret
+     dd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+
+00000de0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     de5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     de8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     de9:	31 db                	xor    %ebx,%ebx
+{
+     deb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     dee:	eb 27                	jmp    e17 <gets+0x37>
+    cc = read(0, &c, 1);
+     df0:	83 ec 04             	sub    $0x4,%esp
+     df3:	6a 01                	push   $0x1
+     df5:	56                   	push   %esi
+     df6:	6a 00                	push   $0x0
+     df8:	e8 1e 01 00 00       	call   f1b <read>
+    if(cc < 1)
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	85 c0                	test   %eax,%eax
+     e02:	7e 1d                	jle    e21 <gets+0x41>
+      break;
+    buf[i++] = c;
+     e04:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     e08:	8b 55 08             	mov    0x8(%ebp),%edx
+     e0b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     e0f:	3c 0a                	cmp    $0xa,%al
+     e11:	74 10                	je     e23 <gets+0x43>
+     e13:	3c 0d                	cmp    $0xd,%al
+     e15:	74 0c                	je     e23 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     e17:	89 df                	mov    %ebx,%edi
+     e19:	83 c3 01             	add    $0x1,%ebx
+     e1c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     e1f:	7c cf                	jl     df0 <gets+0x10>
+     e21:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     e23:	8b 45 08             	mov    0x8(%ebp),%eax
+     e26:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e2d:	5b                   	pop    %ebx
+     e2e:	5e                   	pop    %esi
+     e2f:	5f                   	pop    %edi
+     e30:	5d                   	pop    %ebp
+     e31:	c3                   	ret
+     e32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e40 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	56                   	push   %esi
+     e44:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     e45:	83 ec 08             	sub    $0x8,%esp
+     e48:	6a 00                	push   $0x0
+     e4a:	ff 75 08             	push   0x8(%ebp)
+     e4d:	e8 f1 00 00 00       	call   f43 <open>
+  if(fd < 0)
+     e52:	83 c4 10             	add    $0x10,%esp
+     e55:	85 c0                	test   %eax,%eax
+     e57:	78 27                	js     e80 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     e59:	83 ec 08             	sub    $0x8,%esp
+     e5c:	ff 75 0c             	push   0xc(%ebp)
+     e5f:	89 c3                	mov    %eax,%ebx
+     e61:	50                   	push   %eax
+     e62:	e8 f4 00 00 00       	call   f5b <fstat>
+  close(fd);
+     e67:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     e6a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     e6c:	e8 ba 00 00 00       	call   f2b <close>
+  return r;
+     e71:	83 c4 10             	add    $0x10,%esp
+}
+     e74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e77:	89 f0                	mov    %esi,%eax
+     e79:	5b                   	pop    %ebx
+     e7a:	5e                   	pop    %esi
+     e7b:	5d                   	pop    %ebp
+     e7c:	c3                   	ret
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     e80:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     e85:	eb ed                	jmp    e74 <stat+0x34>
+     e87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8e:	66 90                	xchg   %ax,%ax
+
+00000e90 <atoi>:
+
+int
+atoi(const char *s)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	53                   	push   %ebx
+     e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     e97:	0f be 02             	movsbl (%edx),%eax
+     e9a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     e9d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     ea5:	77 1e                	ja     ec5 <atoi+0x35>
+     ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     eb0:	83 c2 01             	add    $0x1,%edx
+     eb3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     eb6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     eba:	0f be 02             	movsbl (%edx),%eax
+     ebd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     ec0:	80 fb 09             	cmp    $0x9,%bl
+     ec3:	76 eb                	jbe    eb0 <atoi+0x20>
+  return n;
+}
+     ec5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ec8:	89 c8                	mov    %ecx,%eax
+     eca:	c9                   	leave
+     ecb:	c3                   	ret
+     ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ed0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+     edb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     ede:	85 c0                	test   %eax,%eax
+     ee0:	7e 13                	jle    ef5 <memmove+0x25>
+     ee2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     ee4:	89 d7                	mov    %edx,%edi
+     ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     ef0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     ef1:	39 f8                	cmp    %edi,%eax
+     ef3:	75 fb                	jne    ef0 <memmove+0x20>
+  return vdst;
+}
+     ef5:	5e                   	pop    %esi
+     ef6:	89 d0                	mov    %edx,%eax
+     ef8:	5f                   	pop    %edi
+     ef9:	5d                   	pop    %ebp
+     efa:	c3                   	ret
+
+00000efb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     efb:	b8 01 00 00 00       	mov    $0x1,%eax
+     f00:	cd 40                	int    $0x40
+     f02:	c3                   	ret
+
+00000f03 <exit>:
+SYSCALL(exit)
+     f03:	b8 02 00 00 00       	mov    $0x2,%eax
+     f08:	cd 40                	int    $0x40
+     f0a:	c3                   	ret
+
+00000f0b <wait>:
+SYSCALL(wait)
+     f0b:	b8 03 00 00 00       	mov    $0x3,%eax
+     f10:	cd 40                	int    $0x40
+     f12:	c3                   	ret
+
+00000f13 <pipe>:
+SYSCALL(pipe)
+     f13:	b8 04 00 00 00       	mov    $0x4,%eax
+     f18:	cd 40                	int    $0x40
+     f1a:	c3                   	ret
+
+00000f1b <read>:
+SYSCALL(read)
+     f1b:	b8 05 00 00 00       	mov    $0x5,%eax
+     f20:	cd 40                	int    $0x40
+     f22:	c3                   	ret
+
+00000f23 <write>:
+SYSCALL(write)
+     f23:	b8 10 00 00 00       	mov    $0x10,%eax
+     f28:	cd 40                	int    $0x40
+     f2a:	c3                   	ret
+
+00000f2b <close>:
+SYSCALL(close)
+     f2b:	b8 15 00 00 00       	mov    $0x15,%eax
+     f30:	cd 40                	int    $0x40
+     f32:	c3                   	ret
+
+00000f33 <kill>:
+SYSCALL(kill)
+     f33:	b8 06 00 00 00       	mov    $0x6,%eax
+     f38:	cd 40                	int    $0x40
+     f3a:	c3                   	ret
+
+00000f3b <exec>:
+SYSCALL(exec)
+     f3b:	b8 07 00 00 00       	mov    $0x7,%eax
+     f40:	cd 40                	int    $0x40
+     f42:	c3                   	ret
+
+00000f43 <open>:
+SYSCALL(open)
+     f43:	b8 0f 00 00 00       	mov    $0xf,%eax
+     f48:	cd 40                	int    $0x40
+     f4a:	c3                   	ret
+
+00000f4b <mknod>:
+SYSCALL(mknod)
+     f4b:	b8 11 00 00 00       	mov    $0x11,%eax
+     f50:	cd 40                	int    $0x40
+     f52:	c3                   	ret
+
+00000f53 <unlink>:
+SYSCALL(unlink)
+     f53:	b8 12 00 00 00       	mov    $0x12,%eax
+     f58:	cd 40                	int    $0x40
+     f5a:	c3                   	ret
+
+00000f5b <fstat>:
+SYSCALL(fstat)
+     f5b:	b8 08 00 00 00       	mov    $0x8,%eax
+     f60:	cd 40                	int    $0x40
+     f62:	c3                   	ret
+
+00000f63 <link>:
+SYSCALL(link)
+     f63:	b8 13 00 00 00       	mov    $0x13,%eax
+     f68:	cd 40                	int    $0x40
+     f6a:	c3                   	ret
+
+00000f6b <mkdir>:
+SYSCALL(mkdir)
+     f6b:	b8 14 00 00 00       	mov    $0x14,%eax
+     f70:	cd 40                	int    $0x40
+     f72:	c3                   	ret
+
+00000f73 <chdir>:
+SYSCALL(chdir)
+     f73:	b8 09 00 00 00       	mov    $0x9,%eax
+     f78:	cd 40                	int    $0x40
+     f7a:	c3                   	ret
+
+00000f7b <dup>:
+SYSCALL(dup)
+     f7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     f80:	cd 40                	int    $0x40
+     f82:	c3                   	ret
+
+00000f83 <getpid>:
+SYSCALL(getpid)
+     f83:	b8 0b 00 00 00       	mov    $0xb,%eax
+     f88:	cd 40                	int    $0x40
+     f8a:	c3                   	ret
+
+00000f8b <sbrk>:
+SYSCALL(sbrk)
+     f8b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     f90:	cd 40                	int    $0x40
+     f92:	c3                   	ret
+
+00000f93 <sleep>:
+SYSCALL(sleep)
+     f93:	b8 0d 00 00 00       	mov    $0xd,%eax
+     f98:	cd 40                	int    $0x40
+     f9a:	c3                   	ret
+
+00000f9b <uptime>:
+SYSCALL(uptime)
+     f9b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     fa0:	cd 40                	int    $0x40
+     fa2:	c3                   	ret
+
+00000fa3 <add_dir>:
+SYSCALL(add_dir)
+     fa3:	b8 16 00 00 00       	mov    $0x16,%eax
+     fa8:	cd 40                	int    $0x40
+     faa:	c3                   	ret
+
+00000fab <history>:
+SYSCALL(history)
+     fab:	b8 18 00 00 00       	mov    $0x18,%eax
+     fb0:	cd 40                	int    $0x40
+     fb2:	c3                   	ret
+
+00000fb3 <clock_gettime>:
+SYSCALL(clock_gettime)
+     fb3:	b8 19 00 00 00       	mov    $0x19,%eax
+     fb8:	cd 40                	int    $0x40
+     fba:	c3                   	ret
+
+00000fbb <nanosleep>:
+SYSCALL(nanosleep)
+     fbb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     fc0:	cd 40                	int    $0x40
+     fc2:	c3                   	ret
+
+00000fc3 <clone>:
+SYSCALL(clone)
+     fc3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     fc8:	cd 40                	int    $0x40
+     fca:	c3                   	ret
+
+00000fcb <join>:
+SYSCALL(join)
+     fcb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     fd0:	cd 40                	int    $0x40
+     fd2:	c3                   	ret
+
+00000fd3 <futex_wait>:
+SYSCALL(futex_wait)
+     fd3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     fd8:	cd 40                	int    $0x40
+     fda:	c3                   	ret
+
+00000fdb <futex_wake>:
+SYSCALL(futex_wake)
+     fdb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     fe0:	cd 40                	int    $0x40
+     fe2:	c3                   	ret
+
+00000fe3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     fe3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     fe8:	cd 40                	int    $0x40
+     fea:	c3                   	ret
+
+00000feb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     feb:	b8 20 00 00 00       	mov    $0x20,%eax
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <sched_isolate>:
+SYSCALL(sched_isolate)
+     ff3:	b8 21 00 00 00       	mov    $0x21,%eax
+     ff8:	cd 40                	int    $0x40
+     ffa:	c3                   	ret
+
+00000ffb <getprocinfo>:
+SYSCALL(getprocinfo)
+     ffb:	b8 22 00 00 00       	mov    $0x22,%eax
+    1000:	cd 40                	int    $0x40
+    1002:	c3                   	ret
+
+00001003 <waitpid>:
+SYSCALL(waitpid)
+    1003:	b8 23 00 00 00       	mov    $0x23,%eax
+    1008:	cd 40                	int    $0x40
+    100a:	c3                   	ret
+
+0000100b <tracectl>:
+SYSCALL(tracectl)
+    100b:	b8 24 00 00 00       	mov    $0x24,%eax
+    1010:	cd 40                	int    $0x40
+    1012:	c3                   	ret
+
+00001013 <traceread>:
+SYSCALL(traceread)
+    1013:	b8 25 00 00 00       	mov    $0x25,%eax
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+    101b:	b8 26 00 00 00       	mov    $0x26,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+    1023:	b8 27 00 00 00       	mov    $0x27,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+
+0000102b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+    102b:	b8 28 00 00 00       	mov    $0x28,%eax
+    1030:	cd 40                	int    $0x40
+    1032:	c3                   	ret
+
+00001033 <irqroute>:
+SYSCALL(irqroute)
+    1033:	b8 29 00 00 00       	mov    $0x29,%eax
+    1038:	cd 40                	int    $0x40
+    103a:	c3                   	ret
+
+0000103b <irqstat>:
+SYSCALL(irqstat)
+    103b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1040:	cd 40                	int    $0x40
+    1042:	c3                   	ret
+
+00001043 <boottimes>:
+SYSCALL(boottimes)
+    1043:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1048:	cd 40                	int    $0x40
+    104a:	c3                   	ret
+
+0000104b <lockbench>:
+SYSCALL(lockbench)
+    104b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1050:	cd 40                	int    $0x40
+    1052:	c3                   	ret
+
+00001053 <lockstat>:
+SYSCALL(lockstat)
+    1053:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1058:	cd 40                	int    $0x40
+    105a:	c3                   	ret
+
+0000105b <cpustat>:
+SYSCALL(cpustat)
+    105b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1060:	cd 40                	int    $0x40
+    1062:	c3                   	ret
+
+00001063 <bcachesize>:
+SYSCALL(bcachesize)
+    1063:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1068:	cd 40                	int    $0x40
+    106a:	c3                   	ret
+    106b:	66 90                	xchg   %ax,%ax
+    106d:	66 90                	xchg   %ax,%ax
+    106f:	90                   	nop
+
+00001070 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	53                   	push   %ebx
+    1076:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1078:	89 d1                	mov    %edx,%ecx
+{
+    107a:	83 ec 3c             	sub    $0x3c,%esp
+    107d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1080:	85 d2                	test   %edx,%edx
+    1082:	0f 89 80 00 00 00    	jns    1108 <printint+0x98>
+    1088:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    108c:	74 7a                	je     1108 <printint+0x98>
+    x = -xx;
+    108e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1090:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1095:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1098:	31 f6                	xor    %esi,%esi
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    10a0:	89 c8                	mov    %ecx,%eax
+    10a2:	31 d2                	xor    %edx,%edx
+    10a4:	89 f7                	mov    %esi,%edi
+    10a6:	f7 f3                	div    %ebx
+    10a8:	8d 76 01             	lea    0x1(%esi),%esi
+    10ab:	0f b6 92 68 18 00 00 	movzbl 0x1868(%edx),%edx
+    10b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    10b6:	89 ca                	mov    %ecx,%edx
+    10b8:	89 c1                	mov    %eax,%ecx
+    10ba:	39 da                	cmp    %ebx,%edx
+    10bc:	73 e2                	jae    10a0 <printint+0x30>
+  if(neg)
+    10be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    10c1:	85 c0                	test   %eax,%eax
+    10c3:	74 07                	je     10cc <printint+0x5c>
+    buf[i++] = '-';
+    10c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    10ca:	89 f7                	mov    %esi,%edi
+    10cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    10cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    10d2:	01 df                	add    %ebx,%edi
+    10d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    10d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    10db:	83 ec 04             	sub    $0x4,%esp
+    10de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    10e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    10e4:	6a 01                	push   $0x1
+    10e6:	50                   	push   %eax
+    10e7:	56                   	push   %esi
+    10e8:	e8 36 fe ff ff       	call   f23 <write>
+  while(--i >= 0)
+    10ed:	89 f8                	mov    %edi,%eax
+    10ef:	83 c4 10             	add    $0x10,%esp
+    10f2:	83 ef 01             	sub    $0x1,%edi
+    10f5:	39 d8                	cmp    %ebx,%eax
+    10f7:	75 df                	jne    10d8 <printint+0x68>
+}
+    10f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10fc:	5b                   	pop    %ebx
+    10fd:	5e                   	pop    %esi
+    10fe:	5f                   	pop    %edi
+    10ff:	5d                   	pop    %ebp
+    1100:	c3                   	ret
+    1101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1108:	31 c0                	xor    %eax,%eax
+    110a:	eb 89                	jmp    1095 <printint+0x25>
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001110 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	53                   	push   %ebx
+    1116:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1119:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    111c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    111f:	0f b6 1e             	movzbl (%esi),%ebx
+    1122:	83 c6 01             	add    $0x1,%esi
+    1125:	84 db                	test   %bl,%bl
+    1127:	74 67                	je     1190 <printf+0x80>
+    1129:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    112c:	31 d2                	xor    %edx,%edx
+    112e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1131:	eb 34                	jmp    1167 <printf+0x57>
+    1133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1137:	90                   	nop
+    1138:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    113b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1140:	83 f8 25             	cmp    $0x25,%eax
+    1143:	74 18                	je     115d <printf+0x4d>
+  write(fd, &c, 1);
+    1145:	83 ec 04             	sub    $0x4,%esp
+    1148:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    114b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    114e:	6a 01                	push   $0x1
+    1150:	50                   	push   %eax
+    1151:	57                   	push   %edi
+    1152:	e8 cc fd ff ff       	call   f23 <write>
+    1157:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    115a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    115d:	0f b6 1e             	movzbl (%esi),%ebx
+    1160:	83 c6 01             	add    $0x1,%esi
+    1163:	84 db                	test   %bl,%bl
+    1165:	74 29                	je     1190 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1167:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    116a:	85 d2                	test   %edx,%edx
+    116c:	74 ca                	je     1138 <printf+0x28>
+      }
+    } else if(state == '%'){
+    116e:	83 fa 25             	cmp    $0x25,%edx
+    1171:	75 ea                	jne    115d <printf+0x4d>
+      if(c == 'd'){
+    1173:	83 f8 25             	cmp    $0x25,%eax
+    1176:	0f 84 24 01 00 00    	je     12a0 <printf+0x190>
+    117c:	83 e8 63             	sub    $0x63,%eax
+    117f:	83 f8 15             	cmp    $0x15,%eax
+    1182:	77 1c                	ja     11a0 <printf+0x90>
+    1184:	ff 24 85 10 18 00 00 	jmp    *0x1810(,%eax,4)
+    118b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1193:	5b                   	pop    %ebx
+    1194:	5e                   	pop    %esi
+    1195:	5f                   	pop    %edi
+    1196:	5d                   	pop    %ebp
+    1197:	c3                   	ret
+    1198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+  write(fd, &c, 1);
+    11a0:	83 ec 04             	sub    $0x4,%esp
+    11a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    11aa:	6a 01                	push   $0x1
+    11ac:	52                   	push   %edx
+    11ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    11b0:	57                   	push   %edi
+    11b1:	e8 6d fd ff ff       	call   f23 <write>
+    11b6:	83 c4 0c             	add    $0xc,%esp
+    11b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11bc:	6a 01                	push   $0x1
+    11be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    11c1:	52                   	push   %edx
+    11c2:	57                   	push   %edi
+    11c3:	e8 5b fd ff ff       	call   f23 <write>
+        putc(fd, c);
+    11c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11cb:	31 d2                	xor    %edx,%edx
+    11cd:	eb 8e                	jmp    115d <printf+0x4d>
+    11cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    11d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    11d3:	83 ec 0c             	sub    $0xc,%esp
+    11d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    11db:	8b 13                	mov    (%ebx),%edx
+    11dd:	6a 00                	push   $0x0
+    11df:	89 f8                	mov    %edi,%eax
+        ap++;
+    11e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    11e4:	e8 87 fe ff ff       	call   1070 <printint>
+        ap++;
+    11e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11ef:	31 d2                	xor    %edx,%edx
+    11f1:	e9 67 ff ff ff       	jmp    115d <printf+0x4d>
+    11f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1200:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1203:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1205:	83 c0 04             	add    $0x4,%eax
+    1208:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    120b:	85 db                	test   %ebx,%ebx
+    120d:	0f 84 9d 00 00 00    	je     12b0 <printf+0x1a0>
+        while(*s != 0){
+    1213:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1216:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1218:	84 c0                	test   %al,%al
+    121a:	0f 84 3d ff ff ff    	je     115d <printf+0x4d>
+    1220:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1223:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1226:	89 de                	mov    %ebx,%esi
+    1228:	89 d3                	mov    %edx,%ebx
+    122a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1230:	83 ec 04             	sub    $0x4,%esp
+    1233:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1236:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1239:	6a 01                	push   $0x1
+    123b:	53                   	push   %ebx
+    123c:	57                   	push   %edi
+    123d:	e8 e1 fc ff ff       	call   f23 <write>
+        while(*s != 0){
+    1242:	0f b6 06             	movzbl (%esi),%eax
+    1245:	83 c4 10             	add    $0x10,%esp
+    1248:	84 c0                	test   %al,%al
+    124a:	75 e4                	jne    1230 <printf+0x120>
+      state = 0;
+    124c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    124f:	31 d2                	xor    %edx,%edx
+    1251:	e9 07 ff ff ff       	jmp    115d <printf+0x4d>
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1260:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1263:	83 ec 0c             	sub    $0xc,%esp
+    1266:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    126b:	8b 13                	mov    (%ebx),%edx
+    126d:	6a 01                	push   $0x1
+    126f:	e9 6b ff ff ff       	jmp    11df <printf+0xcf>
+    1274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1278:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    127b:	83 ec 04             	sub    $0x4,%esp
+    127e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1281:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1283:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1286:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1289:	6a 01                	push   $0x1
+    128b:	52                   	push   %edx
+    128c:	57                   	push   %edi
+    128d:	e8 91 fc ff ff       	call   f23 <write>
+        ap++;
+    1292:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1295:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1298:	31 d2                	xor    %edx,%edx
+    129a:	e9 be fe ff ff       	jmp    115d <printf+0x4d>
+    129f:	90                   	nop
+  write(fd, &c, 1);
+    12a0:	83 ec 04             	sub    $0x4,%esp
+    12a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12a9:	6a 01                	push   $0x1
+    12ab:	e9 11 ff ff ff       	jmp    11c1 <printf+0xb1>
+    12b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    12b5:	bb 08 18 00 00       	mov    $0x1808,%ebx
+    12ba:	e9 61 ff ff ff       	jmp    1220 <printf+0x110>
+    12bf:	90                   	nop
+
+000012c0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+    12c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    12c1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    12c4:	89 e5                	mov    %esp,%ebp
+    12c6:	57                   	push   %edi
+    12c7:	56                   	push   %esi
+    12c8:	53                   	push   %ebx
+    12c9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12cb:	a1 28 21 00 00       	mov    0x2128,%eax
+    12d0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12d2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12d4:	39 ca                	cmp    %ecx,%edx
+    12d6:	73 30                	jae    1308 <ufree+0x48>
+    12d8:	39 c1                	cmp    %eax,%ecx
+    12da:	72 04                	jb     12e0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12dc:	39 c2                	cmp    %eax,%edx
+    12de:	72 f0                	jb     12d0 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    12e0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    12e3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    12e6:	39 f8                	cmp    %edi,%eax
+    12e8:	74 26                	je     1310 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    12ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    12ed:	8b 42 04             	mov    0x4(%edx),%eax
+    12f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    12f3:	39 f1                	cmp    %esi,%ecx
+    12f5:	74 30                	je     1327 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    12f7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    12f9:	5b                   	pop    %ebx
+  freep = p;
+    12fa:	89 15 28 21 00 00    	mov    %edx,0x2128
+}
+    1300:	5e                   	pop    %esi
+    1301:	5f                   	pop    %edi
+    1302:	5d                   	pop    %ebp
+    1303:	c3                   	ret
+    1304:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1308:	39 c1                	cmp    %eax,%ecx
+    130a:	72 d0                	jb     12dc <ufree+0x1c>
+    130c:	eb c2                	jmp    12d0 <ufree+0x10>
+    130e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1310:	03 70 04             	add    0x4(%eax),%esi
+    1313:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1316:	8b 02                	mov    (%edx),%eax
+    1318:	8b 00                	mov    (%eax),%eax
+    131a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    131d:	8b 42 04             	mov    0x4(%edx),%eax
+    1320:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1323:	39 f1                	cmp    %esi,%ecx
+    1325:	75 d0                	jne    12f7 <ufree+0x37>
+    p->s.size += bp->s.size;
+    1327:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    132a:	89 15 28 21 00 00    	mov    %edx,0x2128
+    p->s.size += bp->s.size;
+    1330:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1333:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1336:	89 0a                	mov    %ecx,(%edx)
+}
+    1338:	5b                   	pop    %ebx
+    1339:	5e                   	pop    %esi
+    133a:	5f                   	pop    %edi
+    133b:	5d                   	pop    %ebp
+    133c:	c3                   	ret
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	53                   	push   %ebx
+    1344:	83 ec 10             	sub    $0x10,%esp
+    1347:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+    134a:	68 24 21 00 00       	push   $0x2124
+    134f:	e8 ec 01 00 00       	call   1540 <lock_acquire>
+  ufree(ap);
+    1354:	89 d8                	mov    %ebx,%eax
+    1356:	e8 65 ff ff ff       	call   12c0 <ufree>
+  lock_release(&mlock);
+    135b:	c7 45 08 24 21 00 00 	movl   $0x2124,0x8(%ebp)
+}
+    1362:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+    1365:	83 c4 10             	add    $0x10,%esp
+}
+    1368:	c9                   	leave
+  lock_release(&mlock);
+    1369:	e9 f2 01 00 00       	jmp    1560 <lock_release>
+    136e:	66 90                	xchg   %ax,%ax
+
+00001370 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	57                   	push   %edi
+    1374:	56                   	push   %esi
+    1375:	53                   	push   %ebx
+    1376:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1379:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+    137c:	68 24 21 00 00       	push   $0x2124
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1381:	8d 48 07             	lea    0x7(%eax),%ecx
+    1384:	c1 e9 03             	shr    $0x3,%ecx
+    1387:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+    138a:	e8 b1 01 00 00       	call   1540 <lock_acquire>
+  if((prevp = freep) == 0){
+    138f:	8b 15 28 21 00 00    	mov    0x2128,%edx
+    1395:	83 c4 10             	add    $0x10,%esp
+    1398:	85 d2                	test   %edx,%edx
+    139a:	0f 84 b0 00 00 00    	je     1450 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13a0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    13a2:	8b 47 04             	mov    0x4(%edi),%eax
+    13a5:	39 f0                	cmp    %esi,%eax
+    13a7:	73 6f                	jae    1418 <malloc+0xa8>
+  if(nu < 4096)
+    13a9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    13ae:	39 de                	cmp    %ebx,%esi
+    13b0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    13b3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    13ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    13bd:	eb 0a                	jmp    13c9 <malloc+0x59>
+    13bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13c0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    13c2:	8b 47 04             	mov    0x4(%edi),%eax
+    13c5:	39 f0                	cmp    %esi,%eax
+    13c7:	73 4f                	jae    1418 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    13c9:	89 fa                	mov    %edi,%edx
+    13cb:	39 3d 28 21 00 00    	cmp    %edi,0x2128
+    13d1:	75 ed                	jne    13c0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    13d3:	83 ec 0c             	sub    $0xc,%esp
+    13d6:	ff 75 e4             	push   -0x1c(%ebp)
+    13d9:	e8 ad fb ff ff       	call   f8b <sbrk>
+  if(p == (char*)-1)
+    13de:	83 c4 10             	add    $0x10,%esp
+    13e1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13e4:	74 15                	je     13fb <malloc+0x8b>
+  hp->s.size = nu;
+    13e6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+    13e9:	83 c0 08             	add    $0x8,%eax
+    13ec:	e8 cf fe ff ff       	call   12c0 <ufree>
+  return freep;
+    13f1:	8b 15 28 21 00 00    	mov    0x2128,%edx
+      if((p = morecore(nunits)) == 0){
+    13f7:	85 d2                	test   %edx,%edx
+    13f9:	75 c5                	jne    13c0 <malloc+0x50>
+        lock_release(&mlock);
+    13fb:	83 ec 0c             	sub    $0xc,%esp
+    13fe:	68 24 21 00 00       	push   $0x2124
+    1403:	e8 58 01 00 00       	call   1560 <lock_release>
+        return 0;
+    1408:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    140b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    140e:	31 c0                	xor    %eax,%eax
+}
+    1410:	5b                   	pop    %ebx
+    1411:	5e                   	pop    %esi
+    1412:	5f                   	pop    %edi
+    1413:	5d                   	pop    %ebp
+    1414:	c3                   	ret
+    1415:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1418:	39 c6                	cmp    %eax,%esi
+    141a:	74 64                	je     1480 <malloc+0x110>
+        p->s.size -= nunits;
+    141c:	29 f0                	sub    %esi,%eax
+    141e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1421:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1424:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+    1427:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    142a:	89 15 28 21 00 00    	mov    %edx,0x2128
+      lock_release(&mlock);
+    1430:	68 24 21 00 00       	push   $0x2124
+    1435:	e8 26 01 00 00       	call   1560 <lock_release>
+      return (void*)(p + 1);
+    143a:	83 c4 10             	add    $0x10,%esp
+}
+    143d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1440:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1443:	5b                   	pop    %ebx
+    1444:	5e                   	pop    %esi
+    1445:	5f                   	pop    %edi
+    1446:	5d                   	pop    %ebp
+    1447:	c3                   	ret
+    1448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1450:	c7 05 28 21 00 00 2c 	movl   $0x212c,0x2128
+    1457:	21 00 00 
+    base.s.size = 0;
+    145a:	bf 2c 21 00 00       	mov    $0x212c,%edi
+    base.s.ptr = freep = prevp = &base;
+    145f:	c7 05 2c 21 00 00 2c 	movl   $0x212c,0x212c
+    1466:	21 00 00 
+    base.s.size = 0;
+    1469:	c7 05 30 21 00 00 00 	movl   $0x0,0x2130
+    1470:	00 00 00 
+    if(p->s.size >= nunits){
+    1473:	e9 31 ff ff ff       	jmp    13a9 <malloc+0x39>
+    1478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1480:	8b 07                	mov    (%edi),%eax
+    1482:	89 02                	mov    %eax,(%edx)
+    1484:	eb a1                	jmp    1427 <malloc+0xb7>
+    1486:	66 90                	xchg   %ax,%ax
+    1488:	66 90                	xchg   %ax,%ax
+    148a:	66 90                	xchg   %ax,%ax
+    148c:	66 90                	xchg   %ax,%ax
+    148e:	66 90                	xchg   %ax,%ax
+
+00001490 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	53                   	push   %ebx
+    1494:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+    1497:	68 00 10 00 00       	push   $0x1000
+    149c:	e8 cf fe ff ff       	call   1370 <malloc>
+    14a1:	83 c4 10             	add    $0x10,%esp
+    14a4:	85 c0                	test   %eax,%eax
+    14a6:	74 37                	je     14df <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+    14a8:	83 ec 04             	sub    $0x4,%esp
+    14ab:	89 c3                	mov    %eax,%ebx
+    14ad:	50                   	push   %eax
+    14ae:	ff 75 0c             	push   0xc(%ebp)
+    14b1:	ff 75 08             	push   0x8(%ebp)
+    14b4:	e8 0a fb ff ff       	call   fc3 <clone>
+    14b9:	83 c4 10             	add    $0x10,%esp
+    14bc:	85 c0                	test   %eax,%eax
+    14be:	78 08                	js     14c8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+    14c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14c3:	c9                   	leave
+    14c4:	c3                   	ret
+    14c5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+    14c8:	83 ec 0c             	sub    $0xc,%esp
+    14cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    14ce:	53                   	push   %ebx
+    14cf:	e8 6c fe ff ff       	call   1340 <free>
+    14d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    14d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+    14da:	83 c4 10             	add    $0x10,%esp
+}
+    14dd:	c9                   	leave
+    14de:	c3                   	ret
+    return -1;
+    14df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14e4:	eb da                	jmp    14c0 <thread_create+0x30>
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014f0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    14f0:	55                   	push   %ebp
+    14f1:	89 e5                	mov    %esp,%ebp
+    14f3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    14f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    14f9:	50                   	push   %eax
+    14fa:	e8 cc fa ff ff       	call   fcb <join>
+    14ff:	83 c4 10             	add    $0x10,%esp
+    1502:	85 c0                	test   %eax,%eax
+    1504:	79 0a                	jns    1510 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+    1506:	c9                   	leave
+    1507:	c3                   	ret
+    1508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150f:	90                   	nop
+    1510:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+    1513:	83 ec 0c             	sub    $0xc,%esp
+    1516:	ff 75 f4             	push   -0xc(%ebp)
+    1519:	e8 22 fe ff ff       	call   1340 <free>
+    151e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1521:	83 c4 10             	add    $0x10,%esp
+}
+    1524:	c9                   	leave
+    1525:	c3                   	ret
+    1526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001530 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1533:	8b 45 08             	mov    0x8(%ebp),%eax
+    1536:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    153c:	5d                   	pop    %ebp
+    153d:	c3                   	ret
+    153e:	66 90                	xchg   %ax,%ax
+
+00001540 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+    1540:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1541:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1546:	89 e5                	mov    %esp,%ebp
+    1548:	8b 55 08             	mov    0x8(%ebp),%edx
+    154b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    154f:	90                   	nop
+    1550:	89 c8                	mov    %ecx,%eax
+    1552:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1555:	85 c0                	test   %eax,%eax
+    1557:	75 f7                	jne    1550 <lock_acquire+0x10>
+    ;
+}
+    1559:	5d                   	pop    %ebp
+    155a:	c3                   	ret
+    155b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    155f:	90                   	nop
+
+00001560 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+    1560:	55                   	push   %ebp
+    1561:	31 c0                	xor    %eax,%eax
+    1563:	89 e5                	mov    %esp,%ebp
+    1565:	8b 55 08             	mov    0x8(%ebp),%edx
+    1568:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    156b:	5d                   	pop    %ebp
+    156c:	c3                   	ret
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001570 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+    1573:	8b 45 08             	mov    0x8(%ebp),%eax
+    1576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    157c:	5d                   	pop    %ebp
+    157d:	c3                   	ret
+    157e:	66 90                	xchg   %ax,%ax
+
+00001580 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    1580:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+    1581:	31 c0                	xor    %eax,%eax
+    1583:	ba 01 00 00 00       	mov    $0x1,%edx
+    1588:	89 e5                	mov    %esp,%ebp
+    158a:	56                   	push   %esi
+    158b:	53                   	push   %ebx
+    158c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    158f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+    1593:	85 c0                	test   %eax,%eax
+    1595:	74 30                	je     15c7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+    1597:	83 f8 02             	cmp    $0x2,%eax
+    159a:	74 0c                	je     15a8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+    159c:	b8 02 00 00 00       	mov    $0x2,%eax
+    15a1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+    15a4:	85 c0                	test   %eax,%eax
+    15a6:	74 1f                	je     15c7 <mutex_lock+0x47>
+    15a8:	be 02 00 00 00       	mov    $0x2,%esi
+    15ad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+    15b0:	83 ec 08             	sub    $0x8,%esp
+    15b3:	6a 02                	push   $0x2
+    15b5:	53                   	push   %ebx
+    15b6:	e8 18 fa ff ff       	call   fd3 <futex_wait>
+    15bb:	89 f0                	mov    %esi,%eax
+    15bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    15c0:	83 c4 10             	add    $0x10,%esp
+    15c3:	85 c0                	test   %eax,%eax
+    15c5:	75 e9                	jne    15b0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+    15c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15ca:	5b                   	pop    %ebx
+    15cb:	5e                   	pop    %esi
+    15cc:	5d                   	pop    %ebp
+    15cd:	c3                   	ret
+    15ce:	66 90                	xchg   %ax,%ax
+
+000015d0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	31 c0                	xor    %eax,%eax
+    15d3:	89 e5                	mov    %esp,%ebp
+    15d5:	83 ec 08             	sub    $0x8,%esp
+    15d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    15db:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+    15de:	83 f8 02             	cmp    $0x2,%eax
+    15e1:	74 05                	je     15e8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+    15e3:	c9                   	leave
+    15e4:	c3                   	ret
+    15e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+    15e8:	83 ec 08             	sub    $0x8,%esp
+    15eb:	6a 01                	push   $0x1
+    15ed:	52                   	push   %edx
+    15ee:	e8 e8 f9 ff ff       	call   fdb <futex_wake>
+    15f3:	83 c4 10             	add    $0x10,%esp
+}
+    15f6:	c9                   	leave
+    15f7:	c3                   	ret
+    15f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ff:	90                   	nop
+
+00001600 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    1600:	55                   	push   %ebp
+    1601:	89 e5                	mov    %esp,%ebp
+    1603:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+    1606:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+    160c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    1613:	5d                   	pop    %ebp
+    1614:	c3                   	ret
+    1615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001620 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	57                   	push   %edi
+    1624:	56                   	push   %esi
+    1625:	53                   	push   %ebx
+    1626:	83 ec 0c             	sub    $0xc,%esp
+    1629:	8b 75 08             	mov    0x8(%ebp),%esi
+    162c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+    162f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+    1634:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+    1636:	8b 3e                	mov    (%esi),%edi
+    1638:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+    163b:	83 f8 02             	cmp    $0x2,%eax
+    163e:	74 60                	je     16a0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+    1640:	83 ec 08             	sub    $0x8,%esp
+    1643:	57                   	push   %edi
+    1644:	56                   	push   %esi
+    1645:	e8 89 f9 ff ff       	call   fd3 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+    164a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+    164f:	31 c0                	xor    %eax,%eax
+    1651:	ba 01 00 00 00       	mov    $0x1,%edx
+    1656:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+    165a:	83 c4 10             	add    $0x10,%esp
+    165d:	85 c0                	test   %eax,%eax
+    165f:	74 36                	je     1697 <cond_wait+0x77>
+  if(c != 2)
+    1661:	83 f8 02             	cmp    $0x2,%eax
+    1664:	74 0c                	je     1672 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+    1666:	b8 02 00 00 00       	mov    $0x2,%eax
+    166b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    166e:	85 c0                	test   %eax,%eax
+    1670:	74 25                	je     1697 <cond_wait+0x77>
+    1672:	be 02 00 00 00       	mov    $0x2,%esi
+    1677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+    1680:	83 ec 08             	sub    $0x8,%esp
+    1683:	6a 02                	push   $0x2
+    1685:	53                   	push   %ebx
+    1686:	e8 48 f9 ff ff       	call   fd3 <futex_wait>
+    168b:	89 f0                	mov    %esi,%eax
+    168d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    1690:	83 c4 10             	add    $0x10,%esp
+    1693:	85 c0                	test   %eax,%eax
+    1695:	75 e9                	jne    1680 <cond_wait+0x60>
+  mutex_lock(m);
+}
+    1697:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    169a:	5b                   	pop    %ebx
+    169b:	5e                   	pop    %esi
+    169c:	5f                   	pop    %edi
+    169d:	5d                   	pop    %ebp
+    169e:	c3                   	ret
+    169f:	90                   	nop
+    futex_wake(&m->val, 1);
+    16a0:	83 ec 08             	sub    $0x8,%esp
+    16a3:	6a 01                	push   $0x1
+    16a5:	53                   	push   %ebx
+    16a6:	e8 30 f9 ff ff       	call   fdb <futex_wake>
+    16ab:	83 c4 10             	add    $0x10,%esp
+    16ae:	eb 90                	jmp    1640 <cond_wait+0x20>
+
+000016b0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	83 ec 08             	sub    $0x8,%esp
+    16b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    16b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    16bd:	8b 50 04             	mov    0x4(%eax),%edx
+    16c0:	85 d2                	test   %edx,%edx
+    16c2:	75 0c                	jne    16d0 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+    16c4:	c9                   	leave
+    16c5:	c3                   	ret
+    16c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+    16d0:	83 ec 08             	sub    $0x8,%esp
+    16d3:	6a 01                	push   $0x1
+    16d5:	50                   	push   %eax
+    16d6:	e8 00 f9 ff ff       	call   fdb <futex_wake>
+    16db:	83 c4 10             	add    $0x10,%esp
+}
+    16de:	c9                   	leave
+    16df:	c3                   	ret
+
+000016e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	83 ec 08             	sub    $0x8,%esp
+    16e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    16e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    16ed:	8b 50 04             	mov    0x4(%eax),%edx
+    16f0:	85 d2                	test   %edx,%edx
+    16f2:	75 0c                	jne    1700 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+    16f4:	c9                   	leave
+    16f5:	c3                   	ret
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+    1700:	83 ec 08             	sub    $0x8,%esp
+    1703:	68 ff ff ff 7f       	push   $0x7fffffff
+    1708:	50                   	push   %eax
+    1709:	e8 cd f8 ff ff       	call   fdb <futex_wake>
+    170e:	83 c4 10             	add    $0x10,%esp
+}
+    1711:	c9                   	leave
+    1712:	c3                   	ret
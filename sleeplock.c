@@ -6,28 +6,77 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 
+// The longest acquiresleep spins, in microseconds, waiting
+// for a holder running on another CPU to let go.  Buf and
+// inode locks are mostly held for less than this, and a
+// sleep and wakeup costs more.
+#define SPINUS 20
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
+  lk->class = lockclass(name, 1);
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
+}
+
+// Spin while lk is held by a process that is running, so
+// it is likely to let go soon, for up to SPINUS.  Peeks
+// without lk->lk; acquiresleep looks again with it.  Procs
+// are never freed, so a stale owner is safe to read.
+// Return whether lk was let go.
+static int
+spinsleep(struct sleeplock *lk)
+{
+  struct proc *owner;
+  uint64 end;
+
+  end = rdtsc() + tsckhz*SPINUS/1000;
+  while(*(volatile uint*)&lk->locked){
+    // Owner is 0 only between its acquire's two stores.
+    owner = *(struct proc *volatile*)&lk->owner;
+    if((owner && owner->state != RUNNING) || rdtsc() > end)
+      return 0;
+    pause();
+  }
+  return 1;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  uint64 t0;
+  int spun, slept;
+
+  t0 = 0;
+  if(LOCKSTAT && lk->class)
+    t0 = rdtsc();
+  spun = slept = 0;
+  if(*(volatile uint*)&lk->locked && lk->owner != proc){
+    spun = 1;
+    spinsleep(lk);
+  }
   acquire(&lk->lk);
   while (lk->locked) {
+    slept = 1;
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
   lk->pid = proc->pid;
+  lk->owner = proc;
+  if(LOCKSTAT && lk->class){
+    lk->tacquire = rdtsc();
+    lockacquired(lk->class, spun || slept, lk->tacquire - t0);
+    if(spun)
+      lockspun(lk->class, !slept);
+  }
   release(&lk->lk);
 }
 
@@ -35,8 +84,11 @@ void
 releasesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
+  if(LOCKSTAT && lk->class)
+    lockreleased(lk->class, rdtsc() - lk->tacquire);
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
   wakeup(lk);
   release(&lk->lk);
 }
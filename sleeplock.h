@@ -6,5 +6,10 @@ struct sleeplock {
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *owner; // Process holding lock, for adaptive spinning
+
+  // For lockstat:
+  int class;         // Statistics slot for our name; 0 if none.
+  uint64 tacquire;   // TSC when acquired.
 };
 
@@ -6,17 +6,85 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "lockstat.h"
 
+// Initialize a lock of the given kind.  Ticket locks hand
+// the lock out in arrival order, so no CPU starves, but every
+// waiter still spins on the same cache line.  MCS locks queue
+// the waiters so that each spins on its own node and a release
+// touches only the next waiter's line; they cost a few more
+// atomic operations when uncontended, so use them for the
+// hottest locks.
 void
-initlock(struct spinlock *lk, char *name)
+initlockkind(struct spinlock *lk, char *name, int kind)
 {
   lk->name = name;
+  lk->kind = kind;
   lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
+  lk->tail = 0;
+  lk->node = 0;
+  lk->class = lockclass(name, 0);
   lk->cpu = 0;
 }
 
+void
+initlock(struct spinlock *lk, char *name)
+{
+  initlockkind(lk, name, LOCK_TICKET);
+}
+
+// Join the queue of MCS lock lk and wait to reach its head.
+// Return whether we had to wait.
+static int
+mcsacquire(struct spinlock *lk)
+{
+  struct mcsnode *n, *prev;
+  int i;
+
+  for(i = 0; i < NMCS; i++)
+    if((cpu->mcsbusy & (1 << i)) == 0)
+      break;
+  if(i == NMCS)
+    panic("mcsacquire: out of nodes");
+  cpu->mcsbusy |= 1 << i;
+  n = &cpu->mcs[i];
+  n->next = 0;
+  n->wait = 1;
+  __sync_synchronize();
+  prev = (struct mcsnode*)xchg((uint*)&lk->tail, (uint)n);
+  if(prev){
+    prev->next = n;
+    while(n->wait)
+      pause();
+  }
+  lk->node = n;
+  return prev != 0;
+}
+
+// Hand MCS lock lk to the next CPU in its queue, if any.
+static void
+mcsrelease(struct spinlock *lk)
+{
+  struct mcsnode *n;
+
+  n = lk->node;
+  lk->node = 0;
+  if(n->next == 0){
+    if(cmpxchg((uint*)&lk->tail, (uint)n, 0) != (uint)n){
+      // Someone has swapped in behind us but not yet linked.
+      while(n->next == 0)
+        pause();
+      n->next->wait = 0;
+    }
+  } else
+    n->next->wait = 0;
+  cpu->mcsbusy &= ~(1 << (n - cpu->mcs));
+}
+
 // Acquire the lock.
 // Loops (spins) until the lock is acquired.
 // Holding a lock for a long time may cause
@@ -24,13 +92,39 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint t;
+  uint64 t0;
+  int contended;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  t0 = 0;
+  if(LOCKSTAT && lk->class)
+    t0 = rdtsc();
+  contended = 0;
+  switch(lk->kind){
+  case LOCK_TAS:
+    // The xchg is atomic.
+    while(xchg(&lk->locked, 1) != 0)
+      contended = 1;
+    break;
+  case LOCK_TICKET:
+    t = xadd((int*)&lk->next, 1);
+    while(lk->owner != t){
+      contended = 1;
+      pause();
+    }
+    lk->locked = 1;
+    break;
+  case LOCK_MCS:
+    contended = mcsacquire(lk);
+    lk->locked = 1;
+    break;
+  default:
+    panic("acquire: kind");
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -39,7 +133,12 @@ acquire(struct spinlock *lk)
 
   // Record info about lock acquisition for debugging.
   lk->cpu = cpu;
-  getcallerpcs(&lk, lk->pcs);
+  if(LOCKPCS)
+    getcallerpcs(&lk, lk->pcs);
+  if(LOCKSTAT && lk->class){
+    lk->tacquire = rdtsc();
+    lockacquired(lk->class, contended, lk->tacquire - t0);
+  }
 }
 
 // Release the lock.
@@ -49,7 +148,10 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
-  lk->pcs[0] = 0;
+  if(LOCKSTAT && lk->class)
+    lockreleased(lk->class, rdtsc() - lk->tacquire);
+  if(LOCKPCS)
+    lk->pcs[0] = 0;
   lk->cpu = 0;
 
   // Tell the C compiler and the processor to not move loads or stores
@@ -63,10 +165,49 @@ release(struct spinlock *lk)
   // This code can't use a C assignment, since it might
   // not be atomic. A real OS would use C atomics here.
   asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  if(lk->kind == LOCK_TICKET)
+    lk->owner++;  // only the holder writes owner
+  else if(lk->kind == LOCK_MCS)
+    mcsrelease(lk);
 
   popcli();
 }
 
+// Locks for lockbench, one of each kind, and the data
+// their critical section updates.
+static struct spinlock benchlocks[] = {
+  [LOCK_TAS]    { .kind = LOCK_TAS, .name = "bench tas" },
+  [LOCK_TICKET] { .kind = LOCK_TICKET, .name = "bench ticket" },
+  [LOCK_MCS]    { .kind = LOCK_MCS, .name = "bench mcs" },
+};
+static uint benchdata[16] CACHEALIGN;
+
+// Lock stress test: for ms milliseconds, repeatedly take the
+// bench lock of the given kind, which every caller shares, and
+// do a little work inside and outside it.  Return how many
+// times this CPU got the lock.
+int
+lockbench(int kind, int ms)
+{
+  struct spinlock *lk;
+  uint64 end;
+  int i, n;
+
+  if(kind < 0 || kind >= NELEM(benchlocks))
+    return -1;
+  lk = &benchlocks[kind];
+  end = rdtsc() + (uint64)ms * tsckhz;
+  for(n = 0; rdtsc() < end; n++){
+    acquire(lk);
+    for(i = 0; i < NELEM(benchdata); i++)
+      benchdata[i]++;
+    release(lk);
+    for(i = 0; i < 64; i++)
+      pause();
+  }
+  return n;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -120,3 +261,130 @@ popcli(void)
     sti();
 }
 
+//PAGEBREAK!
+// Lock contention statistics.
+//
+// Locks are counted by name, since there are too many of
+// them, and they come and go (pipes), to count each one.
+// Each CPU counts into its own row with interrupts off: spin
+// locks update it while held, and sleep locks while holding
+// their spin lock.  So counting needs no atomic operations
+// and no cache line is shared, and readers just add up the
+// rows.  Times are in TSC cycles until read.
+
+struct lockclass {
+  char *volatile name;  // Set once, by cmpxchg
+  int sleep;
+};
+
+struct lockcount {
+  uint nacquire;
+  uint ncontend;
+  uint64 wait;
+  uint64 maxhold;
+  uint nspin;
+  uint nspinwon;
+};
+
+// Slot 0 stands for "not counted".
+static struct lockclass classes[NLOCKCLASS];
+static struct {
+  struct lockcount c[NLOCKCLASS];
+} CACHEALIGN counts[NCPU];
+
+// Return the statistics slot for locks called name, or 0
+// if every slot is taken.  Called from initlock, which may
+// run before this CPU can take locks, so new names claim
+// the first free slot with cmpxchg.  Everyone scans in the
+// same order, so two CPUs adding the same name agree.
+int
+lockclass(char *name, int sleep)
+{
+  struct lockclass *c;
+
+  if(!LOCKSTAT)
+    return 0;
+  for(c = classes+1; c < classes+NLOCKCLASS; c++){
+    if(c->name == 0 &&
+       cmpxchg((uint*)&c->name, 0, (uint)name) == 0){
+      c->sleep = sleep;
+      return c - classes;
+    }
+    if(c->name == name || strncmp(c->name, name, 16) == 0)
+      return c - classes;
+  }
+  return 0;
+}
+
+// A lock of class cls has been acquired after waiting
+// wait cycles, which is contended if it couldn't have been
+// had at once.  The caller has interrupts off.
+void
+lockacquired(int cls, int contended, uint64 wait)
+{
+  struct lockcount *lc;
+
+  lc = &counts[cpu-cpus].c[cls];
+  lc->nacquire++;
+  if(contended){
+    lc->ncontend++;
+    lc->wait += wait;
+  }
+}
+
+// An acquirer of sleep lock class cls spun waiting for a
+// running holder, and won if it then didn't have to sleep.
+// The caller has interrupts off.
+void
+lockspun(int cls, int won)
+{
+  struct lockcount *lc;
+
+  lc = &counts[cpu-cpus].c[cls];
+  lc->nspin++;
+  if(won)
+    lc->nspinwon++;
+}
+
+// A lock of class cls is being released after being held
+// for held cycles.  The caller has interrupts off.
+void
+lockreleased(int cls, uint64 held)
+{
+  struct lockcount *lc;
+
+  lc = &counts[cpu-cpus].c[cls];
+  if(held > lc->maxhold)
+    lc->maxhold = held;
+}
+
+// Copy the statistics of up to n lock names to ls.
+// Return the number copied.
+int
+lockstat(struct lockstat *ls, int n)
+{
+  struct lockclass *c;
+  struct lockcount *lc;
+  uint64 wait, maxhold;
+  int i;
+
+  for(c = classes+1; c < classes+NLOCKCLASS && c->name && n > 0; c++, ls++, n--){
+    safestrcpy(ls->name, c->name, sizeof(ls->name));
+    ls->sleep = c->sleep;
+    ls->nacquire = ls->ncontend = ls->nspin = ls->nspinwon = 0;
+    wait = maxhold = 0;
+    for(i = 0; i < ncpu; i++){
+      lc = &counts[i].c[c-classes];
+      ls->nacquire += lc->nacquire;
+      ls->ncontend += lc->ncontend;
+      ls->nspin += lc->nspin;
+      ls->nspinwon += lc->nspinwon;
+      wait += lc->wait;
+      if(lc->maxhold > maxhold)
+        maxhold = lc->maxhold;
+    }
+    ls->waitus = divu64(wait*1000, tsckhz);
+    ls->maxholdns = divu64(maxhold*1000000, tsckhz);
+  }
+  return c - (classes+1);
+}
@@ -1,6 +1,33 @@
+// Kinds of spin lock; see initlockkind.
+#define LOCK_TAS     0  // test-and-set: unfair, one cache line for all waiters
+#define LOCK_TICKET  1  // FIFO: take a ticket, spin until it is served
+#define LOCK_MCS     2  // FIFO queue: each waiter spins on its own node
+
+#define NMCS 4  // MCS locks a CPU can hold or wait for at once
+
+// A CPU's place in the queue of an MCS lock.
+struct mcsnode {
+  struct mcsnode *volatile next;  // Who waits behind us.
+  volatile uint wait;             // Cleared by our predecessor.
+};
+
 // Mutual exclusion lock.
 struct spinlock {
   uint locked;       // Is the lock held?
+  uint kind;         // LOCK_TAS, LOCK_TICKET or LOCK_MCS
+
+  // LOCK_TICKET: the next ticket to hand out and the one
+  // being served.
+  volatile uint next;
+  volatile uint owner;
+
+  // LOCK_MCS: the last CPU in the queue, and the holder's node.
+  struct mcsnode *volatile tail;
+  struct mcsnode *node;
+
+  // For lockstat:
+  int class;         // Statistics slot for our name; 0 if none.
+  uint64 tacquire;   // TSC when acquired.
 
   // For debugging:
   char *name;        // Name of lock.
@@ -8,4 +35,3 @@ struct spinlock {
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
 };
-
@@ -3,12 +3,25 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "sleeplock.h"
+#include "vm.h"
 #include "x86.h"
 #include "syscall.h"
+#include "work.h"
 
+// A version of PATH, in a page of its own, and the work
+// that frees it once it has been replaced and no reader can
+// be using it.
+struct pathpage {
+  struct pathtable path;
+  struct work free;
+};
 
-
+static struct pathpage path0;
+struct pathtable *volatile PATH = &path0.path;
+static struct spinlock pathlock;  // serializes sys_add_dir
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -16,31 +29,66 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+static void
+freepath(void *pg)
+{
+  kfree(pg);
+}
+
+void
+pathinit(void)
+{
+  initlock(&pathlock, "path");
+}
+
 //Write a directory path into our array of paths for our global PATH
+//Readers take no lock, so build a new copy of PATH under pathlock,
+//which keeps other writers out, and publish it with one store
 int sys_add_dir(void)
 {
   char *path;
+  struct pathpage *old, *new;
+  struct pathtable *p;
   int l;
 
   // Initialize function argument
   if(argstr(0, &path) < 0)
     return -1;
+  if((new = (struct pathpage*)kalloc()) == 0)
+    return -1;
+  p = &new->path;
+
+  acquire(&pathlock);
+  old = (struct pathpage*)PATH;
 
   // Check to make sure that there is still room in PATH
-  if(PATH.num_directories == NUM_OF_DIRECTORIES_IN_PATH)
+  if(old->path.num_directories == NUM_OF_DIRECTORIES_IN_PATH){
+    release(&pathlock);
+    kfree((char*)new);
     return -1;
-
-  safestrcpy(PATH.directories[PATH.num_directories], path, DIRECTORY_BUFFER);
+  }
+  memmove(p, &old->path, sizeof(*p));
+  safestrcpy(p->directories[p->num_directories], path, DIRECTORY_BUFFER);
 
   // Append trailing '/' character if necessary
   l = strlen(path);
-  if(path[l-1] != '/' && l < DIRECTORY_BUFFER - 1) {
-    PATH.directories[PATH.num_directories][l] = '/';
-    PATH.directories[PATH.num_directories][l+1] = '\0';
+  if(l > 0 && path[l-1] != '/' && l < DIRECTORY_BUFFER - 1) {
+    p->directories[p->num_directories][l] = '/';
+    p->directories[p->num_directories][l+1] = '\0';
   }
 
-  PATH.num_directories++;
+  p->num_directories++;
+
+  // Readers must see the whole copy once they see the pointer.
+  __sync_synchronize();
+  PATH = p;
+  release(&pathlock);
 
+  if(old != &path0){
+    old->free.fn = freepath;
+    old->free.arg = old;
+    rcucall(&old->free);
+  }
   return 0;
 }
 
@@ -48,7 +96,7 @@ int sys_add_dir(void)
 int
 fetchint(uint addr, int *ip)
 {
-  if(addr >= proc->sz || addr+4 > proc->sz)
+  if(addr >= proc->vm->sz || addr+4 > proc->vm->sz)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -62,10 +110,10 @@ fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
 
-  if(addr >= proc->sz)
+  if(addr >= proc->vm->sz)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)proc->sz;
+  ep = (char*)proc->vm->sz;
   for(s = *pp; s < ep; s++)
     if(*s == 0)
       return s - *pp;
@@ -89,7 +137,7 @@ argptr(int n, char **pp, int size)
 
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= proc->sz || (uint)i+size > proc->sz)
+  if(size < 0 || (uint)i >= proc->vm->sz || (uint)i+size > proc->vm->sz)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -97,8 +145,8 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (Threads made by clone share writable memory, so another thread
+// could change the string between this check and its use.)
 int
 argstr(int n, char **pp)
 {
@@ -131,6 +179,29 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_add_dir(void);
 extern int sys_history(void);
+extern int sys_clock_gettime(void);
+extern int sys_nanosleep(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_sched_isolate(void);
+extern int sys_getprocinfo(void);
+extern int sys_waitpid(void);
+extern int sys_tracectl(void);
+extern int sys_traceread(void);
+extern int sys_sched_setdeadline(void);
+extern int sys_sched_dlyield(void);
+extern int sys_sched_dlstat(void);
+extern int sys_irqroute(void);
+extern int sys_irqstat(void);
+extern int sys_boottimes(void);
+extern int sys_lockbench(void);
+extern int sys_lockstat(void);
+extern int sys_cpustat(void);
+extern int sys_bcachesize(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -156,6 +227,29 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_add_dir] sys_add_dir,
 [SYS_history] sys_history,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_sched_isolate] sys_sched_isolate,
+[SYS_getprocinfo] sys_getprocinfo,
+[SYS_waitpid] sys_waitpid,
+[SYS_tracectl] sys_tracectl,
+[SYS_traceread] sys_traceread,
+[SYS_sched_setdeadline] sys_sched_setdeadline,
+[SYS_sched_dlyield] sys_sched_dlyield,
+[SYS_sched_dlstat] sys_sched_dlstat,
+[SYS_irqroute] sys_irqroute,
+[SYS_irqstat] sys_irqstat,
+[SYS_boottimes] sys_boottimes,
+[SYS_lockbench] sys_lockbench,
+[SYS_lockstat] sys_lockstat,
+[SYS_cpustat] sys_cpustat,
+[SYS_bcachesize] sys_bcachesize,
 };
 
 void
@@ -164,6 +258,7 @@ syscall(void)
   int num;
 
   num = proc->tf->eax;
+  proc->nsyscall++;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     proc->tf->eax = syscalls[num]();
   } else {
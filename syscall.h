@@ -22,3 +22,26 @@
 #define SYS_close  21
 #define SYS_add_dir 22
 #define SYS_history 24
+#define SYS_clock_gettime 25
+#define SYS_nanosleep 26
+#define SYS_clone  27
+#define SYS_join   28
+#define SYS_futex_wait 29
+#define SYS_futex_wake 30
+#define SYS_sched_setaffinity 31
+#define SYS_sched_getaffinity 32
+#define SYS_sched_isolate 33
+#define SYS_getprocinfo 34
+#define SYS_waitpid 35
+#define SYS_tracectl 36
+#define SYS_traceread 37
+#define SYS_sched_setdeadline 38
+#define SYS_sched_dlyield 39
+#define SYS_sched_dlstat 40
+#define SYS_irqroute 41
+#define SYS_irqstat 42
+#define SYS_boottimes 43
+#define SYS_lockbench 44
+#define SYS_lockstat 45
+#define SYS_cpustat 46
+#define SYS_bcachesize 47
@@ -9,59 +9,99 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return the corresponding struct file.  If threads share the
+// descriptor table, another could close the file while we use it,
+// so take a reference and set *put, for the caller to fdput.
 static int
-argfd(int n, int *pfd, struct file **pf)
+argfd(int n, struct file **pf, int *put)
 {
   int fd;
+  struct fdtable *t;
   struct file *f;
 
-  if(argint(n, &fd) < 0)
+  if(argint(n, &fd) < 0 || fd < 0 || fd >= NOFILE)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+  t = proc->fdt;
+  *put = t->ref > 1;
+  if(!*put)
+    f = t->ofile[fd];
+  else {
+    acquire(&t->lock);
+    if((f = t->ofile[fd]) != 0)
+      filedup(f);
+    release(&t->lock);
+  }
+  if(f == 0)
     return -1;
-  if(pfd)
-    *pfd = fd;
-  if(pf)
-    *pf = f;
+  *pf = f;
   return 0;
 }
 
+// Drop the reference argfd took, if it took one.
+static void
+fdput(struct file *f, int put)
+{
+  if(put)
+    fileclose(f);
+}
+
 // Allocate a file descriptor for the given file.
 // Takes over file reference from caller on success.
 static int
 fdalloc(struct file *f)
 {
+  struct fdtable *t;
   int fd;
 
+  t = proc->fdt;
+  acquire(&t->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd] == 0){
-      proc->ofile[fd] = f;
+    if(t->ofile[fd] == 0){
+      t->ofile[fd] = f;
+      release(&t->lock);
       return fd;
     }
   }
+  release(&t->lock);
   return -1;
 }
 
+// Take the file out of descriptor fd and return it,
+// or return 0 if fd isn't open.
+static struct file*
+fdremove(int fd)
+{
+  struct fdtable *t;
+  struct file *f;
+
+  t = proc->fdt;
+  acquire(&t->lock);
+  f = t->ofile[fd];
+  t->ofile[fd] = 0;
+  release(&t->lock);
+  return f;
+}
+
 int
 sys_dup(void)
 {
   struct file *f;
-  int fd;
+  int fd, put;
 
-  if(argfd(0, 0, &f) < 0)
-    return -1;
-  if((fd=fdalloc(f)) < 0)
+  if(argfd(0, &f, &put) < 0)
     return -1;
   filedup(f);
+  if((fd=fdalloc(f)) < 0)
+    fileclose(f);
+  fdput(f, put);
   return fd;
 }
 
@@ -69,24 +109,28 @@ int
 sys_read(void)
 {
   struct file *f;
-  int n;
+  int n, put;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, &f, &put) < 0)
     return -1;
-  return fileread(f, p, n);
+  n = fileread(f, p, n);
+  fdput(f, put);
+  return n;
 }
 
 int
 sys_write(void)
 {
   struct file *f;
-  int n;
+  int n, put;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, &f, &put) < 0)
     return -1;
-  return filewrite(f, p, n);
+  n = filewrite(f, p, n);
+  fdput(f, put);
+  return n;
 }
 
 int
@@ -95,9 +139,8 @@ sys_close(void)
   int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE || (f = fdremove(fd)) == 0)
     return -1;
-  proc->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -107,10 +150,13 @@ sys_fstat(void)
 {
   struct file *f;
   struct stat *st;
+  int r, put;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argptr(1, (void*)&st, sizeof(*st)) < 0 || argfd(0, &f, &put) < 0)
     return -1;
-  return filestat(f, st);
+  r = filestat(f, st);
+  fdput(f, put);
+  return r;
 }
 
 // Create the path new as a link to the same inode as old.
@@ -327,6 +373,9 @@ sys_open(void)
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
+  f->ranext = 0;
+  f->rawin = 0;
+  f->raend = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
   return fd;
@@ -372,7 +421,7 @@ int
 sys_chdir(void)
 {
   char *path;
-  struct inode *ip;
+  struct inode *ip, *old;
 
   begin_op();
   if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
@@ -386,9 +435,12 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(proc->cwd);
+  acquire(&proc->fdt->lock);
+  old = proc->fdt->cwd;
+  proc->fdt->cwd = ip;
+  release(&proc->fdt->lock);
+  iput(old);
   end_op();
-  proc->cwd = ip;
   return 0;
 }
 
@@ -432,7 +484,7 @@ sys_pipe(void)
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      proc->ofile[fd0] = 0;
+      fdremove(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
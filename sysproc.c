@@ -2,10 +2,18 @@
 #include "x86.h"
 #include "defs.h"
 #include "date.h"
+#include "time.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "sleeplock.h"
+#include "vm.h"
+#include "pstat.h"
+#include "trace.h"
+#include "irq.h"
+#include "lockstat.h"
 
 int sys_history(void) {
   char *buffer;//Params as dictated by assignment description
@@ -36,6 +44,58 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_waitpid(void)
+{
+  int pid, options;
+
+  if(argint(0, &pid) < 0 || argint(1, &options) < 0)
+    return -1;
+  return waitpid(pid, options);
+}
+
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*))fn, (void*)arg, (void*)stack);
+}
+
+int
+sys_join(void)
+{
+  void **stack;
+
+  if(argptr(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  return join(stack);
+}
+
+int
+sys_futex_wait(void)
+{
+  uint *addr;
+  int val;
+
+  if(argptr(0, (void*)&addr, sizeof(*addr)) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futex_wake(void)
+{
+  uint *addr;
+  int n;
+
+  if(argptr(0, (void*)&addr, sizeof(*addr)) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
 int
 sys_kill(void)
 {
@@ -60,7 +120,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = proc->sz;
+  addr = proc->vm->sz;
   if(growproc(n) < 0)
     return -1;
   return addr;
@@ -70,21 +130,12 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(proc->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  if(n < 0)
+    n = 0;
+  return sleepuntil(nsecs() + (uint64)n * TICKNS);
 }
 
 // return how many clock tick interrupts have occurred
@@ -92,10 +143,245 @@ sys_sleep(void)
 int
 sys_uptime(void)
 {
-  uint xticks;
+  return divu64(nsecs(), TICKNS);
+}
+
+int
+sys_clock_gettime(void)
+{
+  int clock;
+  struct timespec *ts;
+  uint64 t;
+
+  if(argint(0, &clock) < 0 || argptr(1, (void*)&ts, sizeof(*ts)) < 0)
+    return -1;
+  if(clock != CLOCK_MONOTONIC)
+    return -1;
+  t = nsecs();
+  ts->tv_sec = divu64(t, 1000000000);
+  ts->tv_nsec = t - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+
+int
+sys_nanosleep(void)
+{
+  struct timespec *req;
+
+  if(argptr(0, (void*)&req, sizeof(*req)) < 0)
+    return -1;
+  if(req->tv_nsec >= 1000000000)
+    return -1;
+  return sleepuntil(nsecs() + (uint64)req->tv_sec * 1000000000 + req->tv_nsec);
+}
+
+// Pin process pid (0 for self) to the CPUs in a bit mask.
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+  uint *mask;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&mask, sizeof(*mask)) < 0)
+    return -1;
+  return getaffinity(pid, mask);
+}
+
+// Reserve the CPUs in a bit mask for pinned processes.
+int
+sys_sched_isolate(void)
+{
+  int mask;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+  return isolate(mask);
+}
+
+// Fill a user array of struct procinfo; return the count.
+int
+sys_getprocinfo(void)
+{
+  struct procinfo *pi;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NPROC)
+    n = NPROC;
+  if(argptr(0, (void*)&pi, n*sizeof(*pi)) < 0)
+    return -1;
+  return getprocinfo(pi, n);
+}
+
+// Fill a user array of struct cpustat, one per CPU;
+// return the count.
+int
+sys_cpustat(void)
+{
+  struct cpustat *cs;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NCPU)
+    n = NCPU;
+  if(argptr(0, (void*)&cs, n*sizeof(*cs)) < 0)
+    return -1;
+  return cpustat(cs, n);
+}
+
+// Turn scheduler tracing on or off.
+int
+sys_tracectl(void)
+{
+  int on;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  return tracectl(on);
+}
+
+// Fill a user array of struct traceevent; return the count.
+int
+sys_traceread(void)
+{
+  struct traceevent *ev;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > proc->vm->sz / sizeof(*ev))
+    return -1;
+  if(argptr(0, (void*)&ev, n*sizeof(*ev)) < 0)
+    return -1;
+  return traceread(ev, n);
+}
+
+// Make process pid (0 for self) real-time with a runtime,
+// deadline and period in microseconds, or normal if the
+// runtime is 0.
+int
+sys_sched_setdeadline(void)
+{
+  int pid, runtime, deadline, period;
+
+  if(argint(0, &pid) < 0 || argint(1, &runtime) < 0 ||
+     argint(2, &deadline) < 0 || argint(3, &period) < 0)
+    return -1;
+  return setdeadline(pid, runtime, deadline, period);
+}
+
+// Finish this period's job and wait for the next period.
+int
+sys_sched_dlyield(void)
+{
+  return edfyield();
+}
+
+int
+sys_sched_dlstat(void)
+{
+  struct dlstat *ds;
+  int pid;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&ds, sizeof(*ds)) < 0)
+    return -1;
+  return getdlstat(pid, ds);
+}
+
+// Route a device IRQ to a CPU, or back to balancing if -1.
+int
+sys_irqroute(void)
+{
+  int irq, c;
 
-  acquire(&tickslock);
-  xticks = ticks;
-  release(&tickslock);
-  return xticks;
+  if(argint(0, &irq) < 0 || argint(1, &c) < 0)
+    return -1;
+  return irqroute(irq, c);
+}
+
+// Fill a user array of struct irqinfo, one per IRQ
+// from 0; return the count.
+int
+sys_irqstat(void)
+{
+  struct irqinfo *ii;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NIRQ)
+    n = NIRQ;
+  if(argptr(0, (void*)&ii, n*sizeof(*ii)) < 0)
+    return -1;
+  return irqstat(ii, n);
+}
+
+// Fill a user array of struct bootphase with the
+// boot timeline; return the count.
+int
+sys_boottimes(void)
+{
+  struct bootphase *bp;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NBOOTPHASE)
+    n = NBOOTPHASE;
+  if(argptr(0, (void*)&bp, n*sizeof(*bp)) < 0)
+    return -1;
+  return boottimes(bp, n);
+}
+
+// Hammer a shared kernel lock of the given kind for ms
+// milliseconds; return how many times we took it.
+int
+sys_lockbench(void)
+{
+  int kind, ms;
+
+  if(argint(0, &kind) < 0 || argint(1, &ms) < 0)
+    return -1;
+  if(ms <= 0 || ms > 10000)
+    return -1;
+  return lockbench(kind, ms);
+}
+
+// Fill a user array of struct lockstat, one per lock
+// name; return the count.
+int
+sys_lockstat(void)
+{
+  struct lockstat *ls;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKCLASS)
+    n = NLOCKCLASS;
+  if(argptr(0, (void*)&ls, n*sizeof(*ls)) < 0)
+    return -1;
+  return lockstat(ls, n);
+}
+
+// Limit the buffer cache to n buffers, or just report
+// the limit if n is 0.  Returns the old limit.
+int
+sys_bcachesize(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0 || n < 0)
+    return -1;
+  return bcachesize(n);
 }
@@ -0,0 +1,1962 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pid;
+  uint m;
+
+  if(argc < 2)
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	7e 74                	jle    92 <main+0x92>
+    usage();
+  if(strcmp(argv[1], "-p") == 0){
+  1e:	51                   	push   %ecx
+  1f:	51                   	push   %ecx
+  20:	68 13 0d 00 00       	push   $0xd13
+  25:	ff 76 04             	push   0x4(%esi)
+  28:	e8 23 02 00 00       	call   250 <strcmp>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 c0                	test   %eax,%eax
+  32:	75 63                	jne    97 <main+0x97>
+    if(argc < 3)
+  34:	83 fb 02             	cmp    $0x2,%ebx
+  37:	74 59                	je     92 <main+0x92>
+      usage();
+    pid = atoi(argv[2]);
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 76 08             	push   0x8(%esi)
+  3f:	e8 ac 03 00 00       	call   3f0 <atoi>
+    if(argc > 3 && sched_setaffinity(pid, mask(argv[3])) < 0){
+  44:	83 c4 10             	add    $0x10,%esp
+    pid = atoi(argv[2]);
+  47:	89 c7                	mov    %eax,%edi
+    if(argc > 3 && sched_setaffinity(pid, mask(argv[3])) < 0){
+  49:	83 fb 03             	cmp    $0x3,%ebx
+  4c:	74 1c                	je     6a <main+0x6a>
+  4e:	8b 46 0c             	mov    0xc(%esi),%eax
+  51:	e8 3a 01 00 00       	call   190 <mask>
+  56:	52                   	push   %edx
+  57:	52                   	push   %edx
+  58:	50                   	push   %eax
+  59:	57                   	push   %edi
+  5a:	e8 e4 04 00 00       	call   543 <sched_setaffinity>
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c0                	test   %eax,%eax
+  64:	0f 88 bf 00 00 00    	js     129 <main+0x129>
+      printf(2, "taskset: cannot set affinity of %d\n", pid);
+      exit();
+    }
+    if(sched_getaffinity(pid, &m) < 0){
+  6a:	50                   	push   %eax
+  6b:	50                   	push   %eax
+  6c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  6f:	50                   	push   %eax
+  70:	57                   	push   %edi
+  71:	e8 d5 04 00 00       	call   54b <sched_getaffinity>
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	85 c0                	test   %eax,%eax
+  7b:	78 56                	js     d3 <main+0xd3>
+      printf(2, "taskset: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask 0x%x\n", pid, m);
+  7d:	ff 75 e4             	push   -0x1c(%ebp)
+  80:	57                   	push   %edi
+  81:	68 2e 0d 00 00       	push   $0xd2e
+  86:	6a 01                	push   $0x1
+  88:	e8 e3 05 00 00       	call   670 <printf>
+    exit();
+  8d:	e8 d1 03 00 00       	call   463 <exit>
+    usage();
+  92:	e8 d9 00 00 00       	call   170 <usage>
+  }
+  if(strcmp(argv[1], "-i") == 0){
+  97:	57                   	push   %edi
+  98:	57                   	push   %edi
+  99:	68 40 0d 00 00       	push   $0xd40
+  9e:	ff 76 04             	push   0x4(%esi)
+  a1:	e8 aa 01 00 00       	call   250 <strcmp>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	85 c0                	test   %eax,%eax
+  ab:	75 39                	jne    e6 <main+0xe6>
+    if(argc < 3)
+  ad:	83 fb 02             	cmp    $0x2,%ebx
+  b0:	74 e0                	je     92 <main+0x92>
+      usage();
+    if(sched_isolate(mask(argv[2])) < 0)
+  b2:	8b 46 08             	mov    0x8(%esi),%eax
+  b5:	e8 d6 00 00 00       	call   190 <mask>
+  ba:	83 ec 0c             	sub    $0xc,%esp
+  bd:	50                   	push   %eax
+  be:	e8 90 04 00 00       	call   553 <sched_isolate>
+  c3:	83 c4 10             	add    $0x10,%esp
+  c6:	85 c0                	test   %eax,%eax
+  c8:	0f 88 83 00 00 00    	js     151 <main+0x151>
+      printf(2, "taskset: cannot isolate every cpu\n");
+    exit();
+  ce:	e8 90 03 00 00       	call   463 <exit>
+      printf(2, "taskset: no process %d\n", pid);
+  d3:	50                   	push   %eax
+  d4:	57                   	push   %edi
+  d5:	68 16 0d 00 00       	push   $0xd16
+  da:	6a 02                	push   $0x2
+  dc:	e8 8f 05 00 00       	call   670 <printf>
+      exit();
+  e1:	e8 7d 03 00 00       	call   463 <exit>
+  }
+  if(argc < 3)
+  e6:	83 fb 02             	cmp    $0x2,%ebx
+  e9:	74 a7                	je     92 <main+0x92>
+    usage();
+  if(sched_setaffinity(0, mask(argv[1])) < 0){
+  eb:	8b 46 04             	mov    0x4(%esi),%eax
+  ee:	e8 9d 00 00 00       	call   190 <mask>
+  f3:	51                   	push   %ecx
+  f4:	51                   	push   %ecx
+  f5:	50                   	push   %eax
+  f6:	6a 00                	push   $0x0
+  f8:	e8 46 04 00 00       	call   543 <sched_setaffinity>
+  fd:	83 c4 10             	add    $0x10,%esp
+ 100:	85 c0                	test   %eax,%eax
+ 102:	78 38                	js     13c <main+0x13c>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv+2);
+ 104:	50                   	push   %eax
+ 105:	50                   	push   %eax
+ 106:	8d 46 08             	lea    0x8(%esi),%eax
+ 109:	50                   	push   %eax
+ 10a:	ff 76 08             	push   0x8(%esi)
+ 10d:	e8 89 03 00 00       	call   49b <exec>
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+ 112:	83 c4 0c             	add    $0xc,%esp
+ 115:	ff 76 08             	push   0x8(%esi)
+ 118:	68 59 0d 00 00       	push   $0xd59
+ 11d:	6a 02                	push   $0x2
+ 11f:	e8 4c 05 00 00       	call   670 <printf>
+  exit();
+ 124:	e8 3a 03 00 00       	call   463 <exit>
+      printf(2, "taskset: cannot set affinity of %d\n", pid);
+ 129:	50                   	push   %eax
+ 12a:	57                   	push   %edi
+ 12b:	68 cc 0c 00 00       	push   $0xccc
+ 130:	6a 02                	push   $0x2
+ 132:	e8 39 05 00 00       	call   670 <printf>
+      exit();
+ 137:	e8 27 03 00 00       	call   463 <exit>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+ 13c:	52                   	push   %edx
+ 13d:	ff 76 04             	push   0x4(%esi)
+ 140:	68 43 0d 00 00       	push   $0xd43
+ 145:	6a 02                	push   $0x2
+ 147:	e8 24 05 00 00       	call   670 <printf>
+    exit();
+ 14c:	e8 12 03 00 00       	call   463 <exit>
+      printf(2, "taskset: cannot isolate every cpu\n");
+ 151:	53                   	push   %ebx
+ 152:	53                   	push   %ebx
+ 153:	68 f0 0c 00 00       	push   $0xcf0
+ 158:	6a 02                	push   $0x2
+ 15a:	e8 11 05 00 00       	call   670 <printf>
+ 15f:	83 c4 10             	add    $0x10,%esp
+ 162:	e9 67 ff ff ff       	jmp    ce <main+0xce>
+ 167:	66 90                	xchg   %ax,%ax
+ 169:	66 90                	xchg   %ax,%ax
+ 16b:	66 90                	xchg   %ax,%ax
+ 16d:	66 90                	xchg   %ax,%ax
+ 16f:	90                   	nop
+
+00000170 <usage>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: taskset mask prog [arg...]\n"
+ 176:	68 74 0c 00 00       	push   $0xc74
+ 17b:	6a 02                	push   $0x2
+ 17d:	e8 ee 04 00 00       	call   670 <printf>
+  exit();
+ 182:	e8 dc 02 00 00       	call   463 <exit>
+ 187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <mask>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	53                   	push   %ebx
+ 194:	83 ec 04             	sub    $0x4,%esp
+  if(s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+ 197:	80 38 30             	cmpb   $0x30,(%eax)
+ 19a:	75 4f                	jne    1eb <mask+0x5b>
+ 19c:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1a0:	83 e2 df             	and    $0xffffffdf,%edx
+ 1a3:	80 fa 58             	cmp    $0x58,%dl
+ 1a6:	75 43                	jne    1eb <mask+0x5b>
+  for(s += 2; *s; s++){
+ 1a8:	0f be 50 02          	movsbl 0x2(%eax),%edx
+ 1ac:	8d 48 02             	lea    0x2(%eax),%ecx
+  n = 0;
+ 1af:	31 c0                	xor    %eax,%eax
+  for(s += 2; *s; s++){
+ 1b1:	84 d2                	test   %dl,%dl
+ 1b3:	75 1d                	jne    1d2 <mask+0x42>
+ 1b5:	eb 40                	jmp    1f7 <mask+0x67>
+ 1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1be:	66 90                	xchg   %ax,%ax
+      n = n*16 + *s - '0';
+ 1c0:	c1 e0 04             	shl    $0x4,%eax
+ 1c3:	8d 44 10 d0          	lea    -0x30(%eax,%edx,1),%eax
+  for(s += 2; *s; s++){
+ 1c7:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+ 1cb:	83 c1 01             	add    $0x1,%ecx
+ 1ce:	84 d2                	test   %dl,%dl
+ 1d0:	74 25                	je     1f7 <mask+0x67>
+    if(*s >= '0' && *s <= '9')
+ 1d2:	8d 5a d0             	lea    -0x30(%edx),%ebx
+ 1d5:	80 fb 09             	cmp    $0x9,%bl
+ 1d8:	76 e6                	jbe    1c0 <mask+0x30>
+    else if(*s >= 'a' && *s <= 'f')
+ 1da:	8d 5a 9f             	lea    -0x61(%edx),%ebx
+ 1dd:	80 fb 05             	cmp    $0x5,%bl
+ 1e0:	77 1e                	ja     200 <mask+0x70>
+      n = n*16 + *s - 'a' + 10;
+ 1e2:	c1 e0 04             	shl    $0x4,%eax
+ 1e5:	8d 44 10 a9          	lea    -0x57(%eax,%edx,1),%eax
+ 1e9:	eb dc                	jmp    1c7 <mask+0x37>
+    return atoi(s);
+ 1eb:	83 ec 0c             	sub    $0xc,%esp
+ 1ee:	50                   	push   %eax
+ 1ef:	e8 fc 01 00 00       	call   3f0 <atoi>
+ 1f4:	83 c4 10             	add    $0x10,%esp
+}
+ 1f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fa:	c9                   	leave
+ 1fb:	c3                   	ret
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    else if(*s >= 'A' && *s <= 'F')
+ 200:	8d 5a bf             	lea    -0x41(%edx),%ebx
+ 203:	80 fb 05             	cmp    $0x5,%bl
+ 206:	77 ef                	ja     1f7 <mask+0x67>
+      n = n*16 + *s - 'A' + 10;
+ 208:	c1 e0 04             	shl    $0x4,%eax
+ 20b:	8d 44 10 c9          	lea    -0x37(%eax,%edx,1),%eax
+ 20f:	eb b6                	jmp    1c7 <mask+0x37>
+ 211:	66 90                	xchg   %ax,%ax
+ 213:	66 90                	xchg   %ax,%ax
+ 215:	66 90                	xchg   %ax,%ax
+ 217:	66 90                	xchg   %ax,%ax
+ 219:	66 90                	xchg   %ax,%ax
+ 21b:	66 90                	xchg   %ax,%ax
+ 21d:	66 90                	xchg   %ax,%ax
+ 21f:	90                   	nop
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 221:	31 c0                	xor    %eax,%eax
+{
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 237:	83 c0 01             	add    $0x1,%eax
+ 23a:	84 d2                	test   %dl,%dl
+ 23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	89 c8                	mov    %ecx,%eax
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+ 245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 25a:	0f b6 02             	movzbl (%edx),%eax
+ 25d:	84 c0                	test   %al,%al
+ 25f:	75 17                	jne    278 <strcmp+0x28>
+ 261:	eb 3a                	jmp    29d <strcmp+0x4d>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 272:	84 c0                	test   %al,%al
+ 274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+ 276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 278:	0f b6 19             	movzbl (%ecx),%ebx
+ 27b:	38 c3                	cmp    %al,%bl
+ 27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 27f:	29 d8                	sub    %ebx,%eax
+}
+ 281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	29 d8                	sub    %ebx,%eax
+}
+ 298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 29d:	0f b6 19             	movzbl (%ecx),%ebx
+ 2a0:	31 c0                	xor    %eax,%eax
+ 2a2:	eb db                	jmp    27f <strcmp+0x2f>
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2b9:	74 15                	je     2d0 <strlen+0x20>
+ 2bb:	31 c0                	xor    %eax,%eax
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2c7:	89 c1                	mov    %eax,%ecx
+ 2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2cb:	89 c8                	mov    %ecx,%eax
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+ 2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2d0:	31 c9                	xor    %ecx,%ecx
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	89 c8                	mov    %ecx,%eax
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ed:	89 d7                	mov    %edx,%edi
+ 2ef:	fc                   	cld
+ 2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 30a:	0f b6 10             	movzbl (%eax),%edx
+ 30d:	84 d2                	test   %dl,%dl
+ 30f:	75 12                	jne    323 <strchr+0x23>
+ 311:	eb 1d                	jmp    330 <strchr+0x30>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+ 323:	38 d1                	cmp    %dl,%cl
+ 325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 330:	31 c0                	xor    %eax,%eax
+}
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 349:	31 db                	xor    %ebx,%ebx
+{
+ 34b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 34e:	eb 27                	jmp    377 <gets+0x37>
+    cc = read(0, &c, 1);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	6a 01                	push   $0x1
+ 355:	56                   	push   %esi
+ 356:	6a 00                	push   $0x0
+ 358:	e8 1e 01 00 00       	call   47b <read>
+    if(cc < 1)
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	7e 1d                	jle    381 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 36f:	3c 0a                	cmp    $0xa,%al
+ 371:	74 10                	je     383 <gets+0x43>
+ 373:	3c 0d                	cmp    $0xd,%al
+ 375:	74 0c                	je     383 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 377:	89 df                	mov    %ebx,%edi
+ 379:	83 c3 01             	add    $0x1,%ebx
+ 37c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 37f:	7c cf                	jl     350 <gets+0x10>
+ 381:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 38a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5f                   	pop    %edi
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+ 392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	6a 00                	push   $0x0
+ 3aa:	ff 75 08             	push   0x8(%ebp)
+ 3ad:	e8 f1 00 00 00       	call   4a3 <open>
+  if(fd < 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	78 27                	js     3e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	89 c3                	mov    %eax,%ebx
+ 3c1:	50                   	push   %eax
+ 3c2:	e8 f4 00 00 00       	call   4bb <fstat>
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3cc:	e8 ba 00 00 00       	call   48b <close>
+  return r;
+ 3d1:	83 c4 10             	add    $0x10,%esp
+}
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	89 f0                	mov    %esi,%eax
+ 3d9:	5b                   	pop    %ebx
+ 3da:	5e                   	pop    %esi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e5:	eb ed                	jmp    3d4 <stat+0x34>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3f7:	0f be 02             	movsbl (%edx),%eax
+ 3fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 405:	77 1e                	ja     425 <atoi+0x35>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 410:	83 c2 01             	add    $0x1,%edx
+ 413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 41a:	0f be 02             	movsbl (%edx),%eax
+ 41d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 420:	80 fb 09             	cmp    $0x9,%bl
+ 423:	76 eb                	jbe    410 <atoi+0x20>
+  return n;
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	89 c8                	mov    %ecx,%eax
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+
+0000045b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 45b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <exit>:
+SYSCALL(exit)
+ 463:	b8 02 00 00 00       	mov    $0x2,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <wait>:
+SYSCALL(wait)
+ 46b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <pipe>:
+SYSCALL(pipe)
+ 473:	b8 04 00 00 00       	mov    $0x4,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <read>:
+SYSCALL(read)
+ 47b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <write>:
+SYSCALL(write)
+ 483:	b8 10 00 00 00       	mov    $0x10,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <close>:
+SYSCALL(close)
+ 48b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <kill>:
+SYSCALL(kill)
+ 493:	b8 06 00 00 00       	mov    $0x6,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <exec>:
+SYSCALL(exec)
+ 49b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <open>:
+SYSCALL(open)
+ 4a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mknod>:
+SYSCALL(mknod)
+ 4ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <unlink>:
+SYSCALL(unlink)
+ 4b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <fstat>:
+SYSCALL(fstat)
+ 4bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <link>:
+SYSCALL(link)
+ 4c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mkdir>:
+SYSCALL(mkdir)
+ 4cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <chdir>:
+SYSCALL(chdir)
+ 4d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <dup>:
+SYSCALL(dup)
+ 4db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getpid>:
+SYSCALL(getpid)
+ 4e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <sbrk>:
+SYSCALL(sbrk)
+ 4eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sleep>:
+SYSCALL(sleep)
+ 4f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <uptime>:
+SYSCALL(uptime)
+ 4fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <add_dir>:
+SYSCALL(add_dir)
+ 503:	b8 16 00 00 00       	mov    $0x16,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <history>:
+SYSCALL(history)
+ 50b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 513:	b8 19 00 00 00       	mov    $0x19,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <nanosleep>:
+SYSCALL(nanosleep)
+ 51b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <clone>:
+SYSCALL(clone)
+ 523:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <join>:
+SYSCALL(join)
+ 52b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <futex_wait>:
+SYSCALL(futex_wait)
+ 533:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <futex_wake>:
+SYSCALL(futex_wake)
+ 53b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 543:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 54b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 553:	b8 21 00 00 00       	mov    $0x21,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 55b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <waitpid>:
+SYSCALL(waitpid)
+ 563:	b8 23 00 00 00       	mov    $0x23,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <tracectl>:
+SYSCALL(tracectl)
+ 56b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <traceread>:
+SYSCALL(traceread)
+ 573:	b8 25 00 00 00       	mov    $0x25,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 57b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 583:	b8 27 00 00 00       	mov    $0x27,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 58b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <irqroute>:
+SYSCALL(irqroute)
+ 593:	b8 29 00 00 00       	mov    $0x29,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <irqstat>:
+SYSCALL(irqstat)
+ 59b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <boottimes>:
+SYSCALL(boottimes)
+ 5a3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <lockbench>:
+SYSCALL(lockbench)
+ 5ab:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <lockstat>:
+SYSCALL(lockstat)
+ 5b3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <cpustat>:
+SYSCALL(cpustat)
+ 5bb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <bcachesize>:
+SYSCALL(bcachesize)
+ 5c3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+ 5cb:	66 90                	xchg   %ax,%ax
+ 5cd:	66 90                	xchg   %ax,%ax
+ 5cf:	90                   	nop
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5d8:	89 d1                	mov    %edx,%ecx
+{
+ 5da:	83 ec 3c             	sub    $0x3c,%esp
+ 5dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	85 d2                	test   %edx,%edx
+ 5e2:	0f 89 80 00 00 00    	jns    668 <printint+0x98>
+ 5e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ec:	74 7a                	je     668 <printint+0x98>
+    x = -xx;
+ 5ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5f8:	31 f6                	xor    %esi,%esi
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+ 604:	89 f7                	mov    %esi,%edi
+ 606:	f7 f3                	div    %ebx
+ 608:	8d 76 01             	lea    0x1(%esi),%esi
+ 60b:	0f b6 92 d4 0d 00 00 	movzbl 0xdd4(%edx),%edx
+ 612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 616:	89 ca                	mov    %ecx,%edx
+ 618:	89 c1                	mov    %eax,%ecx
+ 61a:	39 da                	cmp    %ebx,%edx
+ 61c:	73 e2                	jae    600 <printint+0x30>
+  if(neg)
+ 61e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 621:	85 c0                	test   %eax,%eax
+ 623:	74 07                	je     62c <printint+0x5c>
+    buf[i++] = '-';
+ 625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 62a:	89 f7                	mov    %esi,%edi
+ 62c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 62f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 632:	01 df                	add    %ebx,%edi
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 644:	6a 01                	push   $0x1
+ 646:	50                   	push   %eax
+ 647:	56                   	push   %esi
+ 648:	e8 36 fe ff ff       	call   483 <write>
+  while(--i >= 0)
+ 64d:	89 f8                	mov    %edi,%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	83 ef 01             	sub    $0x1,%edi
+ 655:	39 d8                	cmp    %ebx,%eax
+ 657:	75 df                	jne    638 <printint+0x68>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 668:	31 c0                	xor    %eax,%eax
+ 66a:	eb 89                	jmp    5f5 <printint+0x25>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 67c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 67f:	0f b6 1e             	movzbl (%esi),%ebx
+ 682:	83 c6 01             	add    $0x1,%esi
+ 685:	84 db                	test   %bl,%bl
+ 687:	74 67                	je     6f0 <printf+0x80>
+ 689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 691:	eb 34                	jmp    6c7 <printf+0x57>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 69b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6a0:	83 f8 25             	cmp    $0x25,%eax
+ 6a3:	74 18                	je     6bd <printf+0x4d>
+  write(fd, &c, 1);
+ 6a5:	83 ec 04             	sub    $0x4,%esp
+ 6a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	50                   	push   %eax
+ 6b1:	57                   	push   %edi
+ 6b2:	e8 cc fd ff ff       	call   483 <write>
+ 6b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c0:	83 c6 01             	add    $0x1,%esi
+ 6c3:	84 db                	test   %bl,%bl
+ 6c5:	74 29                	je     6f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ca:	85 d2                	test   %edx,%edx
+ 6cc:	74 ca                	je     698 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ce:	83 fa 25             	cmp    $0x25,%edx
+ 6d1:	75 ea                	jne    6bd <printf+0x4d>
+      if(c == 'd'){
+ 6d3:	83 f8 25             	cmp    $0x25,%eax
+ 6d6:	0f 84 24 01 00 00    	je     800 <printf+0x190>
+ 6dc:	83 e8 63             	sub    $0x63,%eax
+ 6df:	83 f8 15             	cmp    $0x15,%eax
+ 6e2:	77 1c                	ja     700 <printf+0x90>
+ 6e4:	ff 24 85 7c 0d 00 00 	jmp    *0xd7c(,%eax,4)
+ 6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 70a:	6a 01                	push   $0x1
+ 70c:	52                   	push   %edx
+ 70d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 710:	57                   	push   %edi
+ 711:	e8 6d fd ff ff       	call   483 <write>
+ 716:	83 c4 0c             	add    $0xc,%esp
+ 719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71c:	6a 01                	push   $0x1
+ 71e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 721:	52                   	push   %edx
+ 722:	57                   	push   %edi
+ 723:	e8 5b fd ff ff       	call   483 <write>
+        putc(fd, c);
+ 728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72b:	31 d2                	xor    %edx,%edx
+ 72d:	eb 8e                	jmp    6bd <printf+0x4d>
+ 72f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 00                	push   $0x0
+ 73f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 744:	e8 87 fe ff ff       	call   5d0 <printint>
+        ap++;
+ 749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 67 ff ff ff       	jmp    6bd <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 765:	83 c0 04             	add    $0x4,%eax
+ 768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 76b:	85 db                	test   %ebx,%ebx
+ 76d:	0f 84 9d 00 00 00    	je     810 <printf+0x1a0>
+        while(*s != 0){
+ 773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 778:	84 c0                	test   %al,%al
+ 77a:	0f 84 3d ff ff ff    	je     6bd <printf+0x4d>
+ 780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 786:	89 de                	mov    %ebx,%esi
+ 788:	89 d3                	mov    %edx,%ebx
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	53                   	push   %ebx
+ 79c:	57                   	push   %edi
+ 79d:	e8 e1 fc ff ff       	call   483 <write>
+        while(*s != 0){
+ 7a2:	0f b6 06             	movzbl (%esi),%eax
+ 7a5:	83 c4 10             	add    $0x10,%esp
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	75 e4                	jne    790 <printf+0x120>
+      state = 0;
+ 7ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 07 ff ff ff       	jmp    6bd <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 01                	push   $0x1
+ 7cf:	e9 6b ff ff ff       	jmp    73f <printf+0xcf>
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	52                   	push   %edx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 91 fc ff ff       	call   483 <write>
+        ap++;
+ 7f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f8:	31 d2                	xor    %edx,%edx
+ 7fa:	e9 be fe ff ff       	jmp    6bd <printf+0x4d>
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 809:	6a 01                	push   $0x1
+ 80b:	e9 11 ff ff ff       	jmp    721 <printf+0xb1>
+ 810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 815:	bb 72 0d 00 00       	mov    $0xd72,%ebx
+ 81a:	e9 61 ff ff ff       	jmp    780 <printf+0x110>
+ 81f:	90                   	nop
+
+00000820 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 821:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 824:	89 e5                	mov    %esp,%ebp
+ 826:	57                   	push   %edi
+ 827:	56                   	push   %esi
+ 828:	53                   	push   %ebx
+ 829:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 82b:	a1 b0 12 00 00       	mov    0x12b0,%eax
+ 830:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 832:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 834:	39 ca                	cmp    %ecx,%edx
+ 836:	73 30                	jae    868 <ufree+0x48>
+ 838:	39 c1                	cmp    %eax,%ecx
+ 83a:	72 04                	jb     840 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 83c:	39 c2                	cmp    %eax,%edx
+ 83e:	72 f0                	jb     830 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 840:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 843:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 846:	39 f8                	cmp    %edi,%eax
+ 848:	74 26                	je     870 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 84a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 84d:	8b 42 04             	mov    0x4(%edx),%eax
+ 850:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 853:	39 f1                	cmp    %esi,%ecx
+ 855:	74 30                	je     887 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 857:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 859:	5b                   	pop    %ebx
+  freep = p;
+ 85a:	89 15 b0 12 00 00    	mov    %edx,0x12b0
+}
+ 860:	5e                   	pop    %esi
+ 861:	5f                   	pop    %edi
+ 862:	5d                   	pop    %ebp
+ 863:	c3                   	ret
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 868:	39 c1                	cmp    %eax,%ecx
+ 86a:	72 d0                	jb     83c <ufree+0x1c>
+ 86c:	eb c2                	jmp    830 <ufree+0x10>
+ 86e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 870:	03 70 04             	add    0x4(%eax),%esi
+ 873:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 876:	8b 02                	mov    (%edx),%eax
+ 878:	8b 00                	mov    (%eax),%eax
+ 87a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 87d:	8b 42 04             	mov    0x4(%edx),%eax
+ 880:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 883:	39 f1                	cmp    %esi,%ecx
+ 885:	75 d0                	jne    857 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 887:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 88a:	89 15 b0 12 00 00    	mov    %edx,0x12b0
+    p->s.size += bp->s.size;
+ 890:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 893:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 896:	89 0a                	mov    %ecx,(%edx)
+}
+ 898:	5b                   	pop    %ebx
+ 899:	5e                   	pop    %esi
+ 89a:	5f                   	pop    %edi
+ 89b:	5d                   	pop    %ebp
+ 89c:	c3                   	ret
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	53                   	push   %ebx
+ 8a4:	83 ec 10             	sub    $0x10,%esp
+ 8a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 8aa:	68 ac 12 00 00       	push   $0x12ac
+ 8af:	e8 ec 01 00 00       	call   aa0 <lock_acquire>
+  ufree(ap);
+ 8b4:	89 d8                	mov    %ebx,%eax
+ 8b6:	e8 65 ff ff ff       	call   820 <ufree>
+  lock_release(&mlock);
+ 8bb:	c7 45 08 ac 12 00 00 	movl   $0x12ac,0x8(%ebp)
+}
+ 8c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 8c5:	83 c4 10             	add    $0x10,%esp
+}
+ 8c8:	c9                   	leave
+  lock_release(&mlock);
+ 8c9:	e9 f2 01 00 00       	jmp    ac0 <lock_release>
+ 8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 8dc:	68 ac 12 00 00       	push   $0x12ac
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e1:	8d 48 07             	lea    0x7(%eax),%ecx
+ 8e4:	c1 e9 03             	shr    $0x3,%ecx
+ 8e7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 8ea:	e8 b1 01 00 00       	call   aa0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 8ef:	8b 15 b0 12 00 00    	mov    0x12b0,%edx
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	85 d2                	test   %edx,%edx
+ 8fa:	0f 84 b0 00 00 00    	je     9b0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 900:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 902:	8b 47 04             	mov    0x4(%edi),%eax
+ 905:	39 f0                	cmp    %esi,%eax
+ 907:	73 6f                	jae    978 <malloc+0xa8>
+  if(nu < 4096)
+ 909:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 90e:	39 de                	cmp    %ebx,%esi
+ 910:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 913:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 91a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 91d:	eb 0a                	jmp    929 <malloc+0x59>
+ 91f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 920:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 922:	8b 47 04             	mov    0x4(%edi),%eax
+ 925:	39 f0                	cmp    %esi,%eax
+ 927:	73 4f                	jae    978 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 929:	89 fa                	mov    %edi,%edx
+ 92b:	39 3d b0 12 00 00    	cmp    %edi,0x12b0
+ 931:	75 ed                	jne    920 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	ff 75 e4             	push   -0x1c(%ebp)
+ 939:	e8 ad fb ff ff       	call   4eb <sbrk>
+  if(p == (char*)-1)
+ 93e:	83 c4 10             	add    $0x10,%esp
+ 941:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 944:	74 15                	je     95b <malloc+0x8b>
+  hp->s.size = nu;
+ 946:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 949:	83 c0 08             	add    $0x8,%eax
+ 94c:	e8 cf fe ff ff       	call   820 <ufree>
+  return freep;
+ 951:	8b 15 b0 12 00 00    	mov    0x12b0,%edx
+      if((p = morecore(nunits)) == 0){
+ 957:	85 d2                	test   %edx,%edx
+ 959:	75 c5                	jne    920 <malloc+0x50>
+        lock_release(&mlock);
+ 95b:	83 ec 0c             	sub    $0xc,%esp
+ 95e:	68 ac 12 00 00       	push   $0x12ac
+ 963:	e8 58 01 00 00       	call   ac0 <lock_release>
+        return 0;
+ 968:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 96b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 96e:	31 c0                	xor    %eax,%eax
+}
+ 970:	5b                   	pop    %ebx
+ 971:	5e                   	pop    %esi
+ 972:	5f                   	pop    %edi
+ 973:	5d                   	pop    %ebp
+ 974:	c3                   	ret
+ 975:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 978:	39 c6                	cmp    %eax,%esi
+ 97a:	74 64                	je     9e0 <malloc+0x110>
+        p->s.size -= nunits;
+ 97c:	29 f0                	sub    %esi,%eax
+ 97e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 981:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 984:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 987:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 98a:	89 15 b0 12 00 00    	mov    %edx,0x12b0
+      lock_release(&mlock);
+ 990:	68 ac 12 00 00       	push   $0x12ac
+ 995:	e8 26 01 00 00       	call   ac0 <lock_release>
+      return (void*)(p + 1);
+ 99a:	83 c4 10             	add    $0x10,%esp
+}
+ 99d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9a0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 9b0:	c7 05 b0 12 00 00 b4 	movl   $0x12b4,0x12b0
+ 9b7:	12 00 00 
+    base.s.size = 0;
+ 9ba:	bf b4 12 00 00       	mov    $0x12b4,%edi
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 05 b4 12 00 00 b4 	movl   $0x12b4,0x12b4
+ 9c6:	12 00 00 
+    base.s.size = 0;
+ 9c9:	c7 05 b8 12 00 00 00 	movl   $0x0,0x12b8
+ 9d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9d3:	e9 31 ff ff ff       	jmp    909 <malloc+0x39>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9e0:	8b 07                	mov    (%edi),%eax
+ 9e2:	89 02                	mov    %eax,(%edx)
+ 9e4:	eb a1                	jmp    987 <malloc+0xb7>
+ 9e6:	66 90                	xchg   %ax,%ax
+ 9e8:	66 90                	xchg   %ax,%ax
+ 9ea:	66 90                	xchg   %ax,%ax
+ 9ec:	66 90                	xchg   %ax,%ax
+ 9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	53                   	push   %ebx
+ 9f4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 9f7:	68 00 10 00 00       	push   $0x1000
+ 9fc:	e8 cf fe ff ff       	call   8d0 <malloc>
+ a01:	83 c4 10             	add    $0x10,%esp
+ a04:	85 c0                	test   %eax,%eax
+ a06:	74 37                	je     a3f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ a08:	83 ec 04             	sub    $0x4,%esp
+ a0b:	89 c3                	mov    %eax,%ebx
+ a0d:	50                   	push   %eax
+ a0e:	ff 75 0c             	push   0xc(%ebp)
+ a11:	ff 75 08             	push   0x8(%ebp)
+ a14:	e8 0a fb ff ff       	call   523 <clone>
+ a19:	83 c4 10             	add    $0x10,%esp
+ a1c:	85 c0                	test   %eax,%eax
+ a1e:	78 08                	js     a28 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a23:	c9                   	leave
+ a24:	c3                   	ret
+ a25:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ a28:	83 ec 0c             	sub    $0xc,%esp
+ a2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a2e:	53                   	push   %ebx
+ a2f:	e8 6c fe ff ff       	call   8a0 <free>
+ a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ a3a:	83 c4 10             	add    $0x10,%esp
+}
+ a3d:	c9                   	leave
+ a3e:	c3                   	ret
+    return -1;
+ a3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a44:	eb da                	jmp    a20 <thread_create+0x30>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ a56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a59:	50                   	push   %eax
+ a5a:	e8 cc fa ff ff       	call   52b <join>
+ a5f:	83 c4 10             	add    $0x10,%esp
+ a62:	85 c0                	test   %eax,%eax
+ a64:	79 0a                	jns    a70 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ a66:	c9                   	leave
+ a67:	c3                   	ret
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+ a70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	ff 75 f4             	push   -0xc(%ebp)
+ a79:	e8 22 fe ff ff       	call   8a0 <free>
+ a7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a81:	83 c4 10             	add    $0x10,%esp
+}
+ a84:	c9                   	leave
+ a85:	c3                   	ret
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ a93:	8b 45 08             	mov    0x8(%ebp),%eax
+ a96:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a9c:	5d                   	pop    %ebp
+ a9d:	c3                   	ret
+ a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ aa0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ aa1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ aa6:	89 e5                	mov    %esp,%ebp
+ aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+ aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+ ab0:	89 c8                	mov    %ecx,%eax
+ ab2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ ab5:	85 c0                	test   %eax,%eax
+ ab7:	75 f7                	jne    ab0 <lock_acquire+0x10>
+    ;
+}
+ ab9:	5d                   	pop    %ebp
+ aba:	c3                   	ret
+ abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+
+00000ac0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	31 c0                	xor    %eax,%eax
+ ac3:	89 e5                	mov    %esp,%ebp
+ ac5:	8b 55 08             	mov    0x8(%ebp),%edx
+ ac8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ acb:	5d                   	pop    %ebp
+ acc:	c3                   	ret
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ adc:	5d                   	pop    %ebp
+ add:	c3                   	ret
+ ade:	66 90                	xchg   %ax,%ax
+
+00000ae0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ae0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ ae1:	31 c0                	xor    %eax,%eax
+ ae3:	ba 01 00 00 00       	mov    $0x1,%edx
+ ae8:	89 e5                	mov    %esp,%ebp
+ aea:	56                   	push   %esi
+ aeb:	53                   	push   %ebx
+ aec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ aef:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ af3:	85 c0                	test   %eax,%eax
+ af5:	74 30                	je     b27 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ af7:	83 f8 02             	cmp    $0x2,%eax
+ afa:	74 0c                	je     b08 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ afc:	b8 02 00 00 00       	mov    $0x2,%eax
+ b01:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ b04:	85 c0                	test   %eax,%eax
+ b06:	74 1f                	je     b27 <mutex_lock+0x47>
+ b08:	be 02 00 00 00       	mov    $0x2,%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ b10:	83 ec 08             	sub    $0x8,%esp
+ b13:	6a 02                	push   $0x2
+ b15:	53                   	push   %ebx
+ b16:	e8 18 fa ff ff       	call   533 <futex_wait>
+ b1b:	89 f0                	mov    %esi,%eax
+ b1d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b20:	83 c4 10             	add    $0x10,%esp
+ b23:	85 c0                	test   %eax,%eax
+ b25:	75 e9                	jne    b10 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ b27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b2a:	5b                   	pop    %ebx
+ b2b:	5e                   	pop    %esi
+ b2c:	5d                   	pop    %ebp
+ b2d:	c3                   	ret
+ b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b30:	55                   	push   %ebp
+ b31:	31 c0                	xor    %eax,%eax
+ b33:	89 e5                	mov    %esp,%ebp
+ b35:	83 ec 08             	sub    $0x8,%esp
+ b38:	8b 55 08             	mov    0x8(%ebp),%edx
+ b3b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ b3e:	83 f8 02             	cmp    $0x2,%eax
+ b41:	74 05                	je     b48 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ b43:	c9                   	leave
+ b44:	c3                   	ret
+ b45:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ b48:	83 ec 08             	sub    $0x8,%esp
+ b4b:	6a 01                	push   $0x1
+ b4d:	52                   	push   %edx
+ b4e:	e8 e8 f9 ff ff       	call   53b <futex_wake>
+ b53:	83 c4 10             	add    $0x10,%esp
+}
+ b56:	c9                   	leave
+ b57:	c3                   	ret
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+
+00000b60 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ b66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ b6c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b73:	5d                   	pop    %ebp
+ b74:	c3                   	ret
+ b75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b80 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 0c             	sub    $0xc,%esp
+ b89:	8b 75 08             	mov    0x8(%ebp),%esi
+ b8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ b8f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ b94:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ b96:	8b 3e                	mov    (%esi),%edi
+ b98:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ b9b:	83 f8 02             	cmp    $0x2,%eax
+ b9e:	74 60                	je     c00 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ ba0:	83 ec 08             	sub    $0x8,%esp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	e8 89 f9 ff ff       	call   533 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ baa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ baf:	31 c0                	xor    %eax,%eax
+ bb1:	ba 01 00 00 00       	mov    $0x1,%edx
+ bb6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ bba:	83 c4 10             	add    $0x10,%esp
+ bbd:	85 c0                	test   %eax,%eax
+ bbf:	74 36                	je     bf7 <cond_wait+0x77>
+  if(c != 2)
+ bc1:	83 f8 02             	cmp    $0x2,%eax
+ bc4:	74 0c                	je     bd2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ bc6:	b8 02 00 00 00       	mov    $0x2,%eax
+ bcb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ bce:	85 c0                	test   %eax,%eax
+ bd0:	74 25                	je     bf7 <cond_wait+0x77>
+ bd2:	be 02 00 00 00       	mov    $0x2,%esi
+ bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bde:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ be0:	83 ec 08             	sub    $0x8,%esp
+ be3:	6a 02                	push   $0x2
+ be5:	53                   	push   %ebx
+ be6:	e8 48 f9 ff ff       	call   533 <futex_wait>
+ beb:	89 f0                	mov    %esi,%eax
+ bed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ bf0:	83 c4 10             	add    $0x10,%esp
+ bf3:	85 c0                	test   %eax,%eax
+ bf5:	75 e9                	jne    be0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ bf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bfa:	5b                   	pop    %ebx
+ bfb:	5e                   	pop    %esi
+ bfc:	5f                   	pop    %edi
+ bfd:	5d                   	pop    %ebp
+ bfe:	c3                   	ret
+ bff:	90                   	nop
+    futex_wake(&m->val, 1);
+ c00:	83 ec 08             	sub    $0x8,%esp
+ c03:	6a 01                	push   $0x1
+ c05:	53                   	push   %ebx
+ c06:	e8 30 f9 ff ff       	call   53b <futex_wake>
+ c0b:	83 c4 10             	add    $0x10,%esp
+ c0e:	eb 90                	jmp    ba0 <cond_wait+0x20>
+
+00000c10 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	83 ec 08             	sub    $0x8,%esp
+ c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c19:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c1d:	8b 50 04             	mov    0x4(%eax),%edx
+ c20:	85 d2                	test   %edx,%edx
+ c22:	75 0c                	jne    c30 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ c24:	c9                   	leave
+ c25:	c3                   	ret
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ c30:	83 ec 08             	sub    $0x8,%esp
+ c33:	6a 01                	push   $0x1
+ c35:	50                   	push   %eax
+ c36:	e8 00 f9 ff ff       	call   53b <futex_wake>
+ c3b:	83 c4 10             	add    $0x10,%esp
+}
+ c3e:	c9                   	leave
+ c3f:	c3                   	ret
+
+00000c40 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	83 ec 08             	sub    $0x8,%esp
+ c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c49:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c4d:	8b 50 04             	mov    0x4(%eax),%edx
+ c50:	85 d2                	test   %edx,%edx
+ c52:	75 0c                	jne    c60 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ c54:	c9                   	leave
+ c55:	c3                   	ret
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ c60:	83 ec 08             	sub    $0x8,%esp
+ c63:	68 ff ff ff 7f       	push   $0x7fffffff
+ c68:	50                   	push   %eax
+ c69:	e8 cd f8 ff ff       	call   53b <futex_wake>
+ c6e:	83 c4 10             	add    $0x10,%esp
+}
+ c71:	c9                   	leave
+ c72:	c3                   	ret
@@ -0,0 +1,78 @@
+// Run a program on a set of CPUs, or change the CPUs of a
+// running process, or reserve CPUs for pinned processes.
+// Masks are bit masks of CPU numbers, in decimal or 0x hex.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static uint
+mask(char *s)
+{
+  uint n;
+
+  if(s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+    return atoi(s);
+  n = 0;
+  for(s += 2; *s; s++){
+    if(*s >= '0' && *s <= '9')
+      n = n*16 + *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      n = n*16 + *s - 'a' + 10;
+    else if(*s >= 'A' && *s <= 'F')
+      n = n*16 + *s - 'A' + 10;
+    else
+      break;
+  }
+  return n;
+}
+
+static void
+usage(void)
+{
+  printf(2, "usage: taskset mask prog [arg...]\n"
+            "       taskset -p pid [mask]\n"
+            "       taskset -i mask\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid;
+  uint m;
+
+  if(argc < 2)
+    usage();
+  if(strcmp(argv[1], "-p") == 0){
+    if(argc < 3)
+      usage();
+    pid = atoi(argv[2]);
+    if(argc > 3 && sched_setaffinity(pid, mask(argv[3])) < 0){
+      printf(2, "taskset: cannot set affinity of %d\n", pid);
+      exit();
+    }
+    if(sched_getaffinity(pid, &m) < 0){
+      printf(2, "taskset: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask 0x%x\n", pid, m);
+    exit();
+  }
+  if(strcmp(argv[1], "-i") == 0){
+    if(argc < 3)
+      usage();
+    if(sched_isolate(mask(argv[2])) < 0)
+      printf(2, "taskset: cannot isolate every cpu\n");
+    exit();
+  }
+  if(argc < 3)
+    usage();
+  if(sched_setaffinity(0, mask(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv+2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
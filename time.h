@@ -0,0 +1,12 @@
+#define CLOCK_MONOTONIC  1   // nanoseconds since boot, from the TSC
+
+struct timespec {
+  uint tv_sec;   // seconds
+  uint tv_nsec;  // nanoseconds, less than 1000000000
+};
+
+// A phase of booting, as returned by boottimes().
+struct bootphase {
+  char name[16];
+  uint usec;     // when it ended, in microseconds since reset
+};
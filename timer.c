@@ -1,13 +1,20 @@
 // Intel 8253/8254/82C54 Programmable Interval Timer (PIT).
-// Only used on uniprocessors;
+// Counter 0 drives the tick only on uniprocessors;
 // SMP machines use the local APIC timer.
+// Counter 2 is used once at boot to calibrate the TSC,
+// which then backs the kernel's nanosecond clock.
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
 #include "traps.h"
 #include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
 
 #define IO_TIMER1       0x040           // 8253 Timer #1
+#define IO_TIMER2       (IO_TIMER1 + 2) // counter 2, gated by port B
 
 // Frequency of all three count-down timers;
 // (TIMER_FREQ/freq) is the appropriate count
@@ -18,9 +25,19 @@
 
 #define TIMER_MODE      (IO_TIMER1 + 3) // timer mode port
 #define TIMER_SEL0      0x00    // select counter 0
+#define TIMER_SEL2      0x80    // select counter 2
+#define TIMER_INTTC     0x00    // mode 0, interrupt on terminal count
 #define TIMER_RATEGEN   0x04    // mode 2, rate generator
 #define TIMER_16BIT     0x30    // r/w counter 16 bits, LSB first
 
+#define PORTB           0x61    // keyboard controller port B
+#define PORTB_GATE2     0x01    // counter 2 gate
+#define PORTB_SPKR      0x02    // speaker enable
+#define PORTB_OUT2      0x20    // counter 2 output
+
+uint tsckhz;            // TSC cycles per millisecond
+static uint64 tscboot;  // TSC at calibration; nsecs() counts from here
+
 void
 timerinit(void)
 {
@@ -30,3 +47,87 @@ timerinit(void)
   outb(IO_TIMER1, TIMER_DIV(100) / 256);
   picenable(IRQ_TIMER);
 }
+
+// Measure the TSC frequency by counting cycles while
+// counter 2 counts down 10ms, with the speaker off.
+void
+tscinit(void)
+{
+  uint64 t0, t1;
+
+  outb(PORTB, (inb(PORTB) & ~PORTB_SPKR) | PORTB_GATE2);
+  outb(TIMER_MODE, TIMER_SEL2 | TIMER_INTTC | TIMER_16BIT);
+  outb(IO_TIMER2, TIMER_DIV(100) % 256);
+  outb(IO_TIMER2, TIMER_DIV(100) / 256);
+  t0 = rdtsc();
+  while((inb(PORTB) & PORTB_OUT2) == 0)
+    ;
+  t1 = rdtsc();
+
+  tsckhz = divu64(t1 - t0, 10);
+  if(tsckhz == 0)
+    panic("tscinit");
+  tscboot = t1;
+}
+
+// Nanoseconds since boot when the TSC read tsc.
+uint64
+tsc2ns(uint64 tsc)
+{
+  uint64 c, ms;
+
+  c = tsc - tscboot;
+  ms = divu64(c, tsckhz);
+  return ms*1000000 + divu64((c - ms*tsckhz) * 1000000, tsckhz);
+}
+
+// Nanoseconds since boot.
+uint64
+nsecs(void)
+{
+  return tsc2ns(rdtsc());
+}
+
+// Make sure this CPU's timer interrupts no later than deadline.
+void
+clockarm(uint64 deadline)
+{
+  uint64 now;
+
+  pushcli();
+  if(deadline < cpu->nextevent){
+    cpu->nextevent = deadline;
+    now = nsecs();
+    lapicarm(deadline > now ? deadline - now : 0);
+  }
+  popcli();
+}
+
+// Timer interrupt on this CPU.  Wake the processes on its
+// timer list whose timed sleep has expired and re-arm the one-shot LAPIC timer for
+// the next tick or the earliest pending deadline, whichever
+// comes first.  An idle CPU gets no tick, only deadlines;
+// if there are none its timer stays off until idle() ends.
+void
+clockintr(void)
+{
+  uint64 now, next;
+
+  now = nsecs();
+  next = wakeuptimed(now);
+  irqbalance(now);
+  if(!lapic)
+    return;  // the PIT is periodic
+
+  if(!cpu->idle){
+    // The LAPIC and TSC calibrations differ slightly;
+    // don't let that turn into an extra interrupt per tick.
+    if(cpu->nexttick <= now + TICKNS/16)
+      cpu->nexttick = now + TICKNS;
+    if(next > cpu->nexttick)
+      next = cpu->nexttick;
+  }
+  cpu->nextevent = next;
+  if(next != ~0ULL)
+    lapicarm(next - now);
+}
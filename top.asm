@@ -0,0 +1,2161 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	89 c8                	mov    %ecx,%eax
+   c:	55                   	push   %ebp
+   d:	89 e5                	mov    %esp,%ebp
+   f:	57                   	push   %edi
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 48             	sub    $0x48,%esp
+  16:	8b 09                	mov    (%ecx),%ecx
+  18:	8b 58 04             	mov    0x4(%eax),%ebx
+  int i, iter, secs, c;
+  uint t0, t1;
+
+  iter = 5;
+  secs = 1;
+  for(i = 1; i+1 < argc; i += 2){
+  1b:	83 f9 02             	cmp    $0x2,%ecx
+  1e:	0f 8e 5a 03 00 00    	jle    37e <main+0x37e>
+  24:	8d 79 fd             	lea    -0x3(%ecx),%edi
+  secs = 1;
+  27:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  2e:	be 01 00 00 00       	mov    $0x1,%esi
+  33:	83 e7 fe             	and    $0xfffffffe,%edi
+  iter = 5;
+  36:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  3d:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  40:	83 c7 03             	add    $0x3,%edi
+  43:	eb 1c                	jmp    61 <main+0x61>
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+    if(strcmp(argv[i], "-n") == 0)
+      iter = atoi(argv[i+1]);
+  48:	83 ec 0c             	sub    $0xc,%esp
+  4b:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  for(i = 1; i+1 < argc; i += 2){
+  4f:	83 c6 02             	add    $0x2,%esi
+      iter = atoi(argv[i+1]);
+  52:	e8 b9 05 00 00       	call   610 <atoi>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  5d:	39 fe                	cmp    %edi,%esi
+  5f:	74 47                	je     a8 <main+0xa8>
+    if(strcmp(argv[i], "-n") == 0)
+  61:	83 ec 08             	sub    $0x8,%esp
+  64:	68 99 0e 00 00       	push   $0xe99
+  69:	ff 34 b3             	push   (%ebx,%esi,4)
+  6c:	e8 ff 03 00 00       	call   470 <strcmp>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	85 c0                	test   %eax,%eax
+  76:	74 d0                	je     48 <main+0x48>
+    else if(strcmp(argv[i], "-d") == 0)
+  78:	83 ec 08             	sub    $0x8,%esp
+  7b:	68 9c 0e 00 00       	push   $0xe9c
+  80:	ff 34 b3             	push   (%ebx,%esi,4)
+  83:	e8 e8 03 00 00       	call   470 <strcmp>
+  88:	83 c4 10             	add    $0x10,%esp
+  8b:	85 c0                	test   %eax,%eax
+  8d:	75 19                	jne    a8 <main+0xa8>
+      secs = atoi(argv[i+1]);
+  8f:	83 ec 0c             	sub    $0xc,%esp
+  92:	ff 74 b3 04          	push   0x4(%ebx,%esi,4)
+  for(i = 1; i+1 < argc; i += 2){
+  96:	83 c6 02             	add    $0x2,%esi
+      secs = atoi(argv[i+1]);
+  99:	e8 72 05 00 00       	call   610 <atoi>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+  a4:	39 fe                	cmp    %edi,%esi
+  a6:	75 b9                	jne    61 <main+0x61>
+  a8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    else
+      break;
+  }
+  if(i < argc || iter <= 0 || secs <= 0){
+  ab:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  ae:	39 f1                	cmp    %esi,%ecx
+  b0:	0f 9f c0             	setg   %al
+  b3:	85 db                	test   %ebx,%ebx
+  b5:	0f 9e c2             	setle  %dl
+  b8:	08 d0                	or     %dl,%al
+  ba:	75 06                	jne    c2 <main+0xc2>
+  bc:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  c0:	7f 14                	jg     d6 <main+0xd6>
+    printf(2, "usage: top [-n iterations] [-d seconds]\n");
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	68 a4 0e 00 00       	push   $0xea4
+  ca:	6a 02                	push   $0x2
+  cc:	e8 bf 07 00 00       	call   890 <printf>
+    exit();
+  d1:	e8 ad 05 00 00       	call   683 <exit>
+  }
+
+  c = 0;
+  nsnap[c] = getprocinfo(snap[c], NPROC);
+  d6:	50                   	push   %eax
+  d7:	50                   	push   %eax
+  d8:	68 00 10 00 00       	push   $0x1000
+  dd:	68 80 14 00 00       	push   $0x1480
+  e2:	e8 94 06 00 00       	call   77b <getprocinfo>
+  e7:	a3 60 14 00 00       	mov    %eax,0x1460
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ec:	58                   	pop    %eax
+  ed:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  f0:	5a                   	pop    %edx
+  f1:	50                   	push   %eax
+  f2:	6a 01                	push   $0x1
+  f4:	e8 3a 06 00 00       	call   733 <clock_gettime>
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+  f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  fc:	b9 40 42 0f 00       	mov    $0xf4240,%ecx
+ 101:	31 d2                	xor    %edx,%edx
+ 103:	69 5d e0 e8 03 00 00 	imul   $0x3e8,-0x20(%ebp),%ebx
+ 10a:	83 c4 10             	add    $0x10,%esp
+ 10d:	f7 f1                	div    %ecx
+  c = 0;
+ 10f:	31 c9                	xor    %ecx,%ecx
+ 111:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 114:	01 d8                	add    %ebx,%eax
+ 116:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  t0 = msecs();
+  while(iter-- > 0){
+    sleep(secs*100);
+ 119:	6b 45 d0 64          	imul   $0x64,-0x30(%ebp),%eax
+ 11d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 120:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 123:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	83 ec 0c             	sub    $0xc,%esp
+ 133:	ff 75 b4             	push   -0x4c(%ebp)
+ 136:	e8 d8 05 00 00       	call   713 <sleep>
+    c = !c;
+ 13b:	8b 7d c0             	mov    -0x40(%ebp),%edi
+ 13e:	89 fb                	mov    %edi,%ebx
+ 140:	83 f7 01             	xor    $0x1,%edi
+    nsnap[c] = getprocinfo(snap[c], NPROC);
+ 143:	69 c7 00 c0 03 00    	imul   $0x3c000,%edi,%eax
+ 149:	89 7d c0             	mov    %edi,-0x40(%ebp)
+ 14c:	5a                   	pop    %edx
+ 14d:	59                   	pop    %ecx
+ 14e:	68 00 10 00 00       	push   $0x1000
+ 153:	05 80 14 00 00       	add    $0x1480,%eax
+ 158:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 15b:	50                   	push   %eax
+ 15c:	e8 1a 06 00 00       	call   77b <getprocinfo>
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 161:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+ 164:	5e                   	pop    %esi
+    nsnap[c] = getprocinfo(snap[c], NPROC);
+ 165:	89 04 bd 60 14 00 00 	mov    %eax,0x1460(,%edi,4)
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 16c:	58                   	pop    %eax
+ 16d:	51                   	push   %ecx
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 be 05 00 00       	call   733 <clock_gettime>
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 175:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+ 17a:	f7 65 e4             	mull   -0x1c(%ebp)
+ 17d:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+ 180:	69 75 e0 e8 03 00 00 	imul   $0x3e8,-0x20(%ebp),%esi
+    t1 = msecs();
+    show(snap[c], nsnap[c], snap[!c], nsnap[!c], t1 - t0);
+ 187:	8b 3c bd 60 14 00 00 	mov    0x1460(,%edi,4),%edi
+  for(i = 0; i < ncur; i++){
+ 18e:	83 c4 10             	add    $0x10,%esp
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 191:	c1 ea 12             	shr    $0x12,%edx
+    show(snap[c], nsnap[c], snap[!c], nsnap[!c], t1 - t0);
+ 194:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 197:	8d 04 16             	lea    (%esi,%edx,1),%eax
+    show(snap[c], nsnap[c], snap[!c], nsnap[!c], t1 - t0);
+ 19a:	8b 34 9d 60 14 00 00 	mov    0x1460(,%ebx,4),%esi
+ 1a1:	69 db 00 c0 03 00    	imul   $0x3c000,%ebx,%ebx
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+ 1a7:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    show(snap[c], nsnap[c], snap[!c], nsnap[!c], t1 - t0);
+ 1aa:	29 c8                	sub    %ecx,%eax
+ 1ac:	81 c3 80 14 00 00    	add    $0x1480,%ebx
+ 1b2:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+  for(i = 0; i < ncur; i++){
+ 1b5:	85 ff                	test   %edi,%edi
+ 1b7:	0f 8e 8e 01 00 00    	jle    34b <main+0x34b>
+  total = 0;
+ 1bd:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+ 1c4:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  for(i = 0; i < ncur; i++){
+ 1c7:	31 ff                	xor    %edi,%edi
+ 1c9:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < nold; i++)
+ 1d0:	85 f6                	test   %esi,%esi
+ 1d2:	0f 8e 68 01 00 00    	jle    340 <main+0x340>
+    if(old[i].pid == cur->pid)
+ 1d8:	8b 1a                	mov    (%edx),%ebx
+ 1da:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  for(i = 0; i < nold; i++)
+ 1dd:	31 c9                	xor    %ecx,%ecx
+ 1df:	eb 15                	jmp    1f6 <main+0x1f6>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	83 c1 01             	add    $0x1,%ecx
+ 1eb:	83 c0 3c             	add    $0x3c,%eax
+ 1ee:	39 ce                	cmp    %ecx,%esi
+ 1f0:	0f 84 4a 01 00 00    	je     340 <main+0x340>
+    if(old[i].pid == cur->pid)
+ 1f6:	39 18                	cmp    %ebx,(%eax)
+ 1f8:	75 ee                	jne    1e8 <main+0x1e8>
+      return cur->utime + cur->stime - old[i].utime - old[i].stime;
+ 1fa:	8b 4a 18             	mov    0x18(%edx),%ecx
+ 1fd:	03 4a 14             	add    0x14(%edx),%ecx
+ 200:	2b 48 14             	sub    0x14(%eax),%ecx
+ 203:	2b 48 18             	sub    0x18(%eax),%ecx
+    total += delta[i];
+ 206:	01 4d c8             	add    %ecx,-0x38(%ebp)
+    for(j = i; j > 0 && delta[order[j-1]] < delta[i]; j--)
+ 209:	89 f8                	mov    %edi,%eax
+    delta[i] = used(&cur[i], old, nold);
+ 20b:	89 0c bd 80 d4 07 00 	mov    %ecx,0x7d480(,%edi,4)
+    for(j = i; j > 0 && delta[order[j-1]] < delta[i]; j--)
+ 212:	85 ff                	test   %edi,%edi
+ 214:	0f 84 19 01 00 00    	je     333 <main+0x333>
+ 21a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 21d:	eb 10                	jmp    22f <main+0x22f>
+ 21f:	90                   	nop
+      order[j] = order[j-1];
+ 220:	89 34 85 84 94 07 00 	mov    %esi,0x79484(,%eax,4)
+    for(j = i; j > 0 && delta[order[j-1]] < delta[i]; j--)
+ 227:	85 c0                	test   %eax,%eax
+ 229:	0f 84 01 01 00 00    	je     330 <main+0x330>
+ 22f:	89 c3                	mov    %eax,%ebx
+ 231:	83 e8 01             	sub    $0x1,%eax
+ 234:	8b 34 85 80 94 07 00 	mov    0x79480(,%eax,4),%esi
+ 23b:	39 0c b5 80 d4 07 00 	cmp    %ecx,0x7d480(,%esi,4)
+ 242:	72 dc                	jb     220 <main+0x220>
+ 244:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    order[j] = i;
+ 247:	89 3c 9d 80 94 07 00 	mov    %edi,0x79480(,%ebx,4)
+  for(i = 0; i < ncur; i++){
+ 24e:	83 c2 3c             	add    $0x3c,%edx
+ 251:	83 c7 01             	add    $0x1,%edi
+ 254:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+ 257:	0f 85 73 ff ff ff    	jne    1d0 <main+0x1d0>
+ 25d:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  if(ms == 0)
+ 260:	ba 01 00 00 00       	mov    $0x1,%edx
+ 265:	85 c0                	test   %eax,%eax
+ 267:	0f 45 d0             	cmovne %eax,%edx
+  printf(1, "\n%d processes, %d%% of one cpu busy over %d ms\n",
+ 26a:	83 ec 0c             	sub    $0xc,%esp
+ 26d:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 270:	89 d7                	mov    %edx,%edi
+ 272:	52                   	push   %edx
+         ncur, total*100/ms, ms);
+ 273:	6b 45 c8 64          	imul   $0x64,-0x38(%ebp),%eax
+  printf(1, "\n%d processes, %d%% of one cpu busy over %d ms\n",
+ 277:	31 d2                	xor    %edx,%edx
+ 279:	f7 f7                	div    %edi
+  for(k = 0; k < ncur && k < NSHOW; k++){
+ 27b:	31 ff                	xor    %edi,%edi
+  printf(1, "\n%d processes, %d%% of one cpu busy over %d ms\n",
+ 27d:	50                   	push   %eax
+ 27e:	ff 75 d4             	push   -0x2c(%ebp)
+ 281:	68 d0 0e 00 00       	push   $0xed0
+ 286:	6a 01                	push   $0x1
+ 288:	e8 03 06 00 00       	call   890 <printf>
+  printf(1, "PID   CPU%%  USER    SYS     IVCSW   NAME\n");
+ 28d:	83 c4 18             	add    $0x18,%esp
+ 290:	68 00 0f 00 00       	push   $0xf00
+ 295:	6a 01                	push   $0x1
+ 297:	e8 f4 05 00 00       	call   890 <printf>
+ 29c:	83 c4 10             	add    $0x10,%esp
+ 29f:	90                   	nop
+    i = order[k];
+ 2a0:	8b 1c bd 80 94 07 00 	mov    0x79480(,%edi,4),%ebx
+    coln(cur[i].pid, 6);
+ 2a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 2aa:	ba 06 00 00 00       	mov    $0x6,%edx
+  for(k = 0; k < ncur && k < NSHOW; k++){
+ 2af:	83 c7 01             	add    $0x1,%edi
+    d = delta[i];
+ 2b2:	8b 34 9d 80 d4 07 00 	mov    0x7d480(,%ebx,4),%esi
+    coln(cur[i].pid, 6);
+ 2b9:	6b db 3c             	imul   $0x3c,%ebx,%ebx
+ 2bc:	01 c3                	add    %eax,%ebx
+ 2be:	8b 03                	mov    (%ebx),%eax
+    printf(1, "%s\n", cur[i].name);
+ 2c0:	83 c3 2c             	add    $0x2c,%ebx
+    coln(cur[i].pid, 6);
+ 2c3:	e8 d8 00 00 00       	call   3a0 <coln>
+    coln(d*100/ms, 6);
+ 2c8:	6b c6 64             	imul   $0x64,%esi,%eax
+ 2cb:	31 d2                	xor    %edx,%edx
+ 2cd:	f7 75 d0             	divl   -0x30(%ebp)
+ 2d0:	ba 06 00 00 00       	mov    $0x6,%edx
+ 2d5:	e8 c6 00 00 00       	call   3a0 <coln>
+    coln(cur[i].utime, 8);
+ 2da:	8b 43 e8             	mov    -0x18(%ebx),%eax
+ 2dd:	ba 08 00 00 00       	mov    $0x8,%edx
+ 2e2:	e8 b9 00 00 00       	call   3a0 <coln>
+    coln(cur[i].stime, 8);
+ 2e7:	8b 43 ec             	mov    -0x14(%ebx),%eax
+ 2ea:	ba 08 00 00 00       	mov    $0x8,%edx
+ 2ef:	e8 ac 00 00 00       	call   3a0 <coln>
+    coln(cur[i].nivcsw, 8);
+ 2f4:	8b 43 f4             	mov    -0xc(%ebx),%eax
+ 2f7:	ba 08 00 00 00       	mov    $0x8,%edx
+ 2fc:	e8 9f 00 00 00       	call   3a0 <coln>
+    printf(1, "%s\n", cur[i].name);
+ 301:	83 ec 04             	sub    $0x4,%esp
+ 304:	53                   	push   %ebx
+ 305:	68 9f 0e 00 00       	push   $0xe9f
+ 30a:	6a 01                	push   $0x1
+ 30c:	e8 7f 05 00 00       	call   890 <printf>
+  for(k = 0; k < ncur && k < NSHOW; k++){
+ 311:	83 c4 10             	add    $0x10,%esp
+ 314:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+ 317:	7e 05                	jle    31e <main+0x31e>
+ 319:	83 ff 09             	cmp    $0x9,%edi
+ 31c:	7e 82                	jle    2a0 <main+0x2a0>
+  while(iter-- > 0){
+ 31e:	83 6d b0 01          	subl   $0x1,-0x50(%ebp)
+ 322:	0f 85 08 fe ff ff    	jne    130 <main+0x130>
+    t0 = t1;
+  }
+  exit();
+ 328:	e8 56 03 00 00       	call   683 <exit>
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+ 330:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    for(j = i; j > 0 && delta[order[j-1]] < delta[i]; j--)
+ 333:	31 db                	xor    %ebx,%ebx
+ 335:	e9 0d ff ff ff       	jmp    247 <main+0x247>
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return cur->utime + cur->stime;
+ 340:	8b 4a 18             	mov    0x18(%edx),%ecx
+ 343:	03 4a 14             	add    0x14(%edx),%ecx
+ 346:	e9 bb fe ff ff       	jmp    206 <main+0x206>
+  printf(1, "\n%d processes, %d%% of one cpu busy over %d ms\n",
+ 34b:	83 ec 0c             	sub    $0xc,%esp
+ 34e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 353:	85 c0                	test   %eax,%eax
+ 355:	0f 44 c2             	cmove  %edx,%eax
+ 358:	50                   	push   %eax
+ 359:	6a 00                	push   $0x0
+ 35b:	ff 75 d4             	push   -0x2c(%ebp)
+ 35e:	68 d0 0e 00 00       	push   $0xed0
+ 363:	6a 01                	push   $0x1
+ 365:	e8 26 05 00 00       	call   890 <printf>
+  printf(1, "PID   CPU%%  USER    SYS     IVCSW   NAME\n");
+ 36a:	83 c4 18             	add    $0x18,%esp
+ 36d:	68 00 0f 00 00       	push   $0xf00
+ 372:	6a 01                	push   $0x1
+ 374:	e8 17 05 00 00       	call   890 <printf>
+ 379:	83 c4 10             	add    $0x10,%esp
+ 37c:	eb a0                	jmp    31e <main+0x31e>
+  secs = 1;
+ 37e:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  for(i = 1; i+1 < argc; i += 2){
+ 385:	be 01 00 00 00       	mov    $0x1,%esi
+  iter = 5;
+ 38a:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+ 391:	e9 15 fd ff ff       	jmp    ab <main+0xab>
+ 396:	66 90                	xchg   %ax,%ax
+ 398:	66 90                	xchg   %ax,%ax
+ 39a:	66 90                	xchg   %ax,%ax
+ 39c:	66 90                	xchg   %ax,%ax
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <coln>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 c1                	mov    %eax,%ecx
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	57                   	push   %edi
+ 3a6:	56                   	push   %esi
+    buf[--i] = '0' + x % 10;
+ 3a7:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+{
+ 3ac:	53                   	push   %ebx
+  i = sizeof(buf) - 1;
+ 3ad:	bb 0f 00 00 00       	mov    $0xf,%ebx
+{
+ 3b2:	83 ec 2c             	sub    $0x2c,%esp
+  buf[i] = 0;
+ 3b5:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    buf[--i] = '0' + x % 10;
+ 3b9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c0:	89 c8                	mov    %ecx,%eax
+ 3c2:	83 eb 01             	sub    $0x1,%ebx
+ 3c5:	f7 e6                	mul    %esi
+ 3c7:	89 c8                	mov    %ecx,%eax
+ 3c9:	c1 ea 03             	shr    $0x3,%edx
+ 3cc:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 3cf:	01 ff                	add    %edi,%edi
+ 3d1:	29 f8                	sub    %edi,%eax
+ 3d3:	83 c0 30             	add    $0x30,%eax
+ 3d6:	88 44 1d d8          	mov    %al,-0x28(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+ 3da:	89 c8                	mov    %ecx,%eax
+ 3dc:	89 d1                	mov    %edx,%ecx
+ 3de:	83 f8 09             	cmp    $0x9,%eax
+ 3e1:	77 dd                	ja     3c0 <coln+0x20>
+  col(buf+i, w);
+ 3e3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  n = strlen(s);
+ 3e6:	83 ec 0c             	sub    $0xc,%esp
+  col(buf+i, w);
+ 3e9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 3ec:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+  n = strlen(s);
+ 3ef:	56                   	push   %esi
+ 3f0:	e8 db 00 00 00       	call   4d0 <strlen>
+  printf(1, "%s", s);
+ 3f5:	83 c4 0c             	add    $0xc,%esp
+ 3f8:	56                   	push   %esi
+  n = strlen(s);
+ 3f9:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s", s);
+ 3fb:	68 94 0e 00 00       	push   $0xe94
+ 400:	6a 01                	push   $0x1
+ 402:	e8 89 04 00 00       	call   890 <printf>
+  for(; n < w; n++)
+ 407:	83 c4 10             	add    $0x10,%esp
+ 40a:	39 df                	cmp    %ebx,%edi
+ 40c:	7e 1b                	jle    429 <coln+0x89>
+ 40e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+ 410:	83 ec 08             	sub    $0x8,%esp
+  for(; n < w; n++)
+ 413:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+ 416:	68 97 0e 00 00       	push   $0xe97
+ 41b:	6a 01                	push   $0x1
+ 41d:	e8 6e 04 00 00       	call   890 <printf>
+  for(; n < w; n++)
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	39 df                	cmp    %ebx,%edi
+ 427:	75 e7                	jne    410 <coln+0x70>
+}
+ 429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5f                   	pop    %edi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+ 431:	66 90                	xchg   %ax,%ax
+ 433:	66 90                	xchg   %ax,%ax
+ 435:	66 90                	xchg   %ax,%ax
+ 437:	66 90                	xchg   %ax,%ax
+ 439:	66 90                	xchg   %ax,%ax
+ 43b:	66 90                	xchg   %ax,%ax
+ 43d:	66 90                	xchg   %ax,%ax
+ 43f:	90                   	nop
+
+00000440 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 440:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 441:	31 c0                	xor    %eax,%eax
+{
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	53                   	push   %ebx
+ 446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 449:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 450:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 454:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 457:	83 c0 01             	add    $0x1,%eax
+ 45a:	84 d2                	test   %dl,%dl
+ 45c:	75 f2                	jne    450 <strcpy+0x10>
+    ;
+  return os;
+}
+ 45e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 461:	89 c8                	mov    %ecx,%eax
+ 463:	c9                   	leave
+ 464:	c3                   	ret
+ 465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+ 477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 47a:	0f b6 02             	movzbl (%edx),%eax
+ 47d:	84 c0                	test   %al,%al
+ 47f:	75 17                	jne    498 <strcmp+0x28>
+ 481:	eb 3a                	jmp    4bd <strcmp+0x4d>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 48c:	83 c2 01             	add    $0x1,%edx
+ 48f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 492:	84 c0                	test   %al,%al
+ 494:	74 1a                	je     4b0 <strcmp+0x40>
+    p++, q++;
+ 496:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 498:	0f b6 19             	movzbl (%ecx),%ebx
+ 49b:	38 c3                	cmp    %al,%bl
+ 49d:	74 e9                	je     488 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 49f:	29 d8                	sub    %ebx,%eax
+}
+ 4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a4:	c9                   	leave
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4b4:	31 c0                	xor    %eax,%eax
+ 4b6:	29 d8                	sub    %ebx,%eax
+}
+ 4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4c0:	31 c0                	xor    %eax,%eax
+ 4c2:	eb db                	jmp    49f <strcmp+0x2f>
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4d9:	74 15                	je     4f0 <strlen+0x20>
+ 4db:	31 c0                	xor    %eax,%eax
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4e0:	83 c0 01             	add    $0x1,%eax
+ 4e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4e7:	89 c1                	mov    %eax,%ecx
+ 4e9:	75 f5                	jne    4e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4eb:	89 c8                	mov    %ecx,%eax
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+ 4ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4f0:	31 c9                	xor    %ecx,%ecx
+}
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	89 c8                	mov    %ecx,%eax
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 507:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 50a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50d:	89 d7                	mov    %edx,%edi
+ 50f:	fc                   	cld
+ 510:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 512:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 515:	89 d0                	mov    %edx,%eax
+ 517:	c9                   	leave
+ 518:	c3                   	ret
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 52a:	0f b6 10             	movzbl (%eax),%edx
+ 52d:	84 d2                	test   %dl,%dl
+ 52f:	75 12                	jne    543 <strchr+0x23>
+ 531:	eb 1d                	jmp    550 <strchr+0x30>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 53c:	83 c0 01             	add    $0x1,%eax
+ 53f:	84 d2                	test   %dl,%dl
+ 541:	74 0d                	je     550 <strchr+0x30>
+    if(*s == c)
+ 543:	38 d1                	cmp    %dl,%cl
+ 545:	75 f1                	jne    538 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 547:	5d                   	pop    %ebp
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 550:	31 c0                	xor    %eax,%eax
+}
+ 552:	5d                   	pop    %ebp
+ 553:	c3                   	ret
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 565:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 568:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 569:	31 db                	xor    %ebx,%ebx
+{
+ 56b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 56e:	eb 27                	jmp    597 <gets+0x37>
+    cc = read(0, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	6a 01                	push   $0x1
+ 575:	56                   	push   %esi
+ 576:	6a 00                	push   $0x0
+ 578:	e8 1e 01 00 00       	call   69b <read>
+    if(cc < 1)
+ 57d:	83 c4 10             	add    $0x10,%esp
+ 580:	85 c0                	test   %eax,%eax
+ 582:	7e 1d                	jle    5a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 584:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 58f:	3c 0a                	cmp    $0xa,%al
+ 591:	74 10                	je     5a3 <gets+0x43>
+ 593:	3c 0d                	cmp    $0xd,%al
+ 595:	74 0c                	je     5a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 597:	89 df                	mov    %ebx,%edi
+ 599:	83 c3 01             	add    $0x1,%ebx
+ 59c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 59f:	7c cf                	jl     570 <gets+0x10>
+ 5a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ad:	5b                   	pop    %ebx
+ 5ae:	5e                   	pop    %esi
+ 5af:	5f                   	pop    %edi
+ 5b0:	5d                   	pop    %ebp
+ 5b1:	c3                   	ret
+ 5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	56                   	push   %esi
+ 5c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	6a 00                	push   $0x0
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 f1 00 00 00       	call   6c3 <open>
+  if(fd < 0)
+ 5d2:	83 c4 10             	add    $0x10,%esp
+ 5d5:	85 c0                	test   %eax,%eax
+ 5d7:	78 27                	js     600 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5d9:	83 ec 08             	sub    $0x8,%esp
+ 5dc:	ff 75 0c             	push   0xc(%ebp)
+ 5df:	89 c3                	mov    %eax,%ebx
+ 5e1:	50                   	push   %eax
+ 5e2:	e8 f4 00 00 00       	call   6db <fstat>
+  close(fd);
+ 5e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5ec:	e8 ba 00 00 00       	call   6ab <close>
+  return r;
+ 5f1:	83 c4 10             	add    $0x10,%esp
+}
+ 5f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5f7:	89 f0                	mov    %esi,%eax
+ 5f9:	5b                   	pop    %ebx
+ 5fa:	5e                   	pop    %esi
+ 5fb:	5d                   	pop    %ebp
+ 5fc:	c3                   	ret
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 600:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 605:	eb ed                	jmp    5f4 <stat+0x34>
+ 607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	53                   	push   %ebx
+ 614:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 617:	0f be 02             	movsbl (%edx),%eax
+ 61a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 61d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 625:	77 1e                	ja     645 <atoi+0x35>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 630:	83 c2 01             	add    $0x1,%edx
+ 633:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 636:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 63a:	0f be 02             	movsbl (%edx),%eax
+ 63d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 640:	80 fb 09             	cmp    $0x9,%bl
+ 643:	76 eb                	jbe    630 <atoi+0x20>
+  return n;
+}
+ 645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 648:	89 c8                	mov    %ecx,%eax
+ 64a:	c9                   	leave
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	8b 45 10             	mov    0x10(%ebp),%eax
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 65e:	85 c0                	test   %eax,%eax
+ 660:	7e 13                	jle    675 <memmove+0x25>
+ 662:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 664:	89 d7                	mov    %edx,%edi
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 670:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 671:	39 f8                	cmp    %edi,%eax
+ 673:	75 fb                	jne    670 <memmove+0x20>
+  return vdst;
+}
+ 675:	5e                   	pop    %esi
+ 676:	89 d0                	mov    %edx,%eax
+ 678:	5f                   	pop    %edi
+ 679:	5d                   	pop    %ebp
+ 67a:	c3                   	ret
+
+0000067b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 67b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <exit>:
+SYSCALL(exit)
+ 683:	b8 02 00 00 00       	mov    $0x2,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <pipe>:
+SYSCALL(pipe)
+ 693:	b8 04 00 00 00       	mov    $0x4,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <read>:
+SYSCALL(read)
+ 69b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <write>:
+SYSCALL(write)
+ 6a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <close>:
+SYSCALL(close)
+ 6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <kill>:
+SYSCALL(kill)
+ 6b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <exec>:
+SYSCALL(exec)
+ 6bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <open>:
+SYSCALL(open)
+ 6c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <unlink>:
+SYSCALL(unlink)
+ 6d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <fstat>:
+SYSCALL(fstat)
+ 6db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <link>:
+SYSCALL(link)
+ 6e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mkdir>:
+SYSCALL(mkdir)
+ 6eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chdir>:
+SYSCALL(chdir)
+ 6f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dup>:
+SYSCALL(dup)
+ 6fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getpid>:
+SYSCALL(getpid)
+ 703:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sbrk>:
+SYSCALL(sbrk)
+ 70b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+ 713:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <uptime>:
+SYSCALL(uptime)
+ 71b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <add_dir>:
+SYSCALL(add_dir)
+ 723:	b8 16 00 00 00       	mov    $0x16,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <history>:
+SYSCALL(history)
+ 72b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 733:	b8 19 00 00 00       	mov    $0x19,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <nanosleep>:
+SYSCALL(nanosleep)
+ 73b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <clone>:
+SYSCALL(clone)
+ 743:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <join>:
+SYSCALL(join)
+ 74b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <futex_wait>:
+SYSCALL(futex_wait)
+ 753:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <futex_wake>:
+SYSCALL(futex_wake)
+ 75b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 763:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 76b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 773:	b8 21 00 00 00       	mov    $0x21,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 77b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <waitpid>:
+SYSCALL(waitpid)
+ 783:	b8 23 00 00 00       	mov    $0x23,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <tracectl>:
+SYSCALL(tracectl)
+ 78b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <traceread>:
+SYSCALL(traceread)
+ 793:	b8 25 00 00 00       	mov    $0x25,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 79b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 7a3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 7ab:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <irqroute>:
+SYSCALL(irqroute)
+ 7b3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <irqstat>:
+SYSCALL(irqstat)
+ 7bb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <boottimes>:
+SYSCALL(boottimes)
+ 7c3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <lockbench>:
+SYSCALL(lockbench)
+ 7cb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <lockstat>:
+SYSCALL(lockstat)
+ 7d3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <cpustat>:
+SYSCALL(cpustat)
+ 7db:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <bcachesize>:
+SYSCALL(bcachesize)
+ 7e3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+ 7eb:	66 90                	xchg   %ax,%ax
+ 7ed:	66 90                	xchg   %ax,%ax
+ 7ef:	90                   	nop
+
+000007f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7f8:	89 d1                	mov    %edx,%ecx
+{
+ 7fa:	83 ec 3c             	sub    $0x3c,%esp
+ 7fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 800:	85 d2                	test   %edx,%edx
+ 802:	0f 89 80 00 00 00    	jns    888 <printint+0x98>
+ 808:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 80c:	74 7a                	je     888 <printint+0x98>
+    x = -xx;
+ 80e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 810:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 815:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 818:	31 f6                	xor    %esi,%esi
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 820:	89 c8                	mov    %ecx,%eax
+ 822:	31 d2                	xor    %edx,%edx
+ 824:	89 f7                	mov    %esi,%edi
+ 826:	f7 f3                	div    %ebx
+ 828:	8d 76 01             	lea    0x1(%esi),%esi
+ 82b:	0f b6 92 8c 0f 00 00 	movzbl 0xf8c(%edx),%edx
+ 832:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 836:	89 ca                	mov    %ecx,%edx
+ 838:	89 c1                	mov    %eax,%ecx
+ 83a:	39 da                	cmp    %ebx,%edx
+ 83c:	73 e2                	jae    820 <printint+0x30>
+  if(neg)
+ 83e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 841:	85 c0                	test   %eax,%eax
+ 843:	74 07                	je     84c <printint+0x5c>
+    buf[i++] = '-';
+ 845:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 84a:	89 f7                	mov    %esi,%edi
+ 84c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 84f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 852:	01 df                	add    %ebx,%edi
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 858:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 85b:	83 ec 04             	sub    $0x4,%esp
+ 85e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 861:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 864:	6a 01                	push   $0x1
+ 866:	50                   	push   %eax
+ 867:	56                   	push   %esi
+ 868:	e8 36 fe ff ff       	call   6a3 <write>
+  while(--i >= 0)
+ 86d:	89 f8                	mov    %edi,%eax
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	83 ef 01             	sub    $0x1,%edi
+ 875:	39 d8                	cmp    %ebx,%eax
+ 877:	75 df                	jne    858 <printint+0x68>
+}
+ 879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87c:	5b                   	pop    %ebx
+ 87d:	5e                   	pop    %esi
+ 87e:	5f                   	pop    %edi
+ 87f:	5d                   	pop    %ebp
+ 880:	c3                   	ret
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 888:	31 c0                	xor    %eax,%eax
+ 88a:	eb 89                	jmp    815 <printint+0x25>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000890 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 899:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 89c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 89f:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a2:	83 c6 01             	add    $0x1,%esi
+ 8a5:	84 db                	test   %bl,%bl
+ 8a7:	74 67                	je     910 <printf+0x80>
+ 8a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8ac:	31 d2                	xor    %edx,%edx
+ 8ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8b1:	eb 34                	jmp    8e7 <printf+0x57>
+ 8b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8b7:	90                   	nop
+ 8b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8c0:	83 f8 25             	cmp    $0x25,%eax
+ 8c3:	74 18                	je     8dd <printf+0x4d>
+  write(fd, &c, 1);
+ 8c5:	83 ec 04             	sub    $0x4,%esp
+ 8c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ce:	6a 01                	push   $0x1
+ 8d0:	50                   	push   %eax
+ 8d1:	57                   	push   %edi
+ 8d2:	e8 cc fd ff ff       	call   6a3 <write>
+ 8d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8e0:	83 c6 01             	add    $0x1,%esi
+ 8e3:	84 db                	test   %bl,%bl
+ 8e5:	74 29                	je     910 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8ea:	85 d2                	test   %edx,%edx
+ 8ec:	74 ca                	je     8b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ee:	83 fa 25             	cmp    $0x25,%edx
+ 8f1:	75 ea                	jne    8dd <printf+0x4d>
+      if(c == 'd'){
+ 8f3:	83 f8 25             	cmp    $0x25,%eax
+ 8f6:	0f 84 24 01 00 00    	je     a20 <printf+0x190>
+ 8fc:	83 e8 63             	sub    $0x63,%eax
+ 8ff:	83 f8 15             	cmp    $0x15,%eax
+ 902:	77 1c                	ja     920 <printf+0x90>
+ 904:	ff 24 85 34 0f 00 00 	jmp    *0xf34(,%eax,4)
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 913:	5b                   	pop    %ebx
+ 914:	5e                   	pop    %esi
+ 915:	5f                   	pop    %edi
+ 916:	5d                   	pop    %ebp
+ 917:	c3                   	ret
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 926:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 92a:	6a 01                	push   $0x1
+ 92c:	52                   	push   %edx
+ 92d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 930:	57                   	push   %edi
+ 931:	e8 6d fd ff ff       	call   6a3 <write>
+ 936:	83 c4 0c             	add    $0xc,%esp
+ 939:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 93c:	6a 01                	push   $0x1
+ 93e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 941:	52                   	push   %edx
+ 942:	57                   	push   %edi
+ 943:	e8 5b fd ff ff       	call   6a3 <write>
+        putc(fd, c);
+ 948:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94b:	31 d2                	xor    %edx,%edx
+ 94d:	eb 8e                	jmp    8dd <printf+0x4d>
+ 94f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 950:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 95b:	8b 13                	mov    (%ebx),%edx
+ 95d:	6a 00                	push   $0x0
+ 95f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 961:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 964:	e8 87 fe ff ff       	call   7f0 <printint>
+        ap++;
+ 969:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 96c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 67 ff ff ff       	jmp    8dd <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 980:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 983:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 985:	83 c0 04             	add    $0x4,%eax
+ 988:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 98b:	85 db                	test   %ebx,%ebx
+ 98d:	0f 84 9d 00 00 00    	je     a30 <printf+0x1a0>
+        while(*s != 0){
+ 993:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 996:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 998:	84 c0                	test   %al,%al
+ 99a:	0f 84 3d ff ff ff    	je     8dd <printf+0x4d>
+ 9a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9a6:	89 de                	mov    %ebx,%esi
+ 9a8:	89 d3                	mov    %edx,%ebx
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	53                   	push   %ebx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 e1 fc ff ff       	call   6a3 <write>
+        while(*s != 0){
+ 9c2:	0f b6 06             	movzbl (%esi),%eax
+ 9c5:	83 c4 10             	add    $0x10,%esp
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	75 e4                	jne    9b0 <printf+0x120>
+      state = 0;
+ 9cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9cf:	31 d2                	xor    %edx,%edx
+ 9d1:	e9 07 ff ff ff       	jmp    8dd <printf+0x4d>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 01                	push   $0x1
+ 9ef:	e9 6b ff ff ff       	jmp    95f <printf+0xcf>
+ 9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9fb:	83 ec 04             	sub    $0x4,%esp
+ 9fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a09:	6a 01                	push   $0x1
+ a0b:	52                   	push   %edx
+ a0c:	57                   	push   %edi
+ a0d:	e8 91 fc ff ff       	call   6a3 <write>
+        ap++;
+ a12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a18:	31 d2                	xor    %edx,%edx
+ a1a:	e9 be fe ff ff       	jmp    8dd <printf+0x4d>
+ a1f:	90                   	nop
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a29:	6a 01                	push   $0x1
+ a2b:	e9 11 ff ff ff       	jmp    941 <printf+0xb1>
+ a30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a35:	bb 2b 0f 00 00       	mov    $0xf2b,%ebx
+ a3a:	e9 61 ff ff ff       	jmp    9a0 <printf+0x110>
+ a3f:	90                   	nop
+
+00000a40 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ a40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a41:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ a44:	89 e5                	mov    %esp,%ebp
+ a46:	57                   	push   %edi
+ a47:	56                   	push   %esi
+ a48:	53                   	push   %ebx
+ a49:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a4b:	a1 84 14 08 00       	mov    0x81484,%eax
+ a50:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a52:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a54:	39 ca                	cmp    %ecx,%edx
+ a56:	73 30                	jae    a88 <ufree+0x48>
+ a58:	39 c1                	cmp    %eax,%ecx
+ a5a:	72 04                	jb     a60 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a5c:	39 c2                	cmp    %eax,%edx
+ a5e:	72 f0                	jb     a50 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a60:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a63:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a66:	39 f8                	cmp    %edi,%eax
+ a68:	74 26                	je     a90 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a6d:	8b 42 04             	mov    0x4(%edx),%eax
+ a70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a73:	39 f1                	cmp    %esi,%ecx
+ a75:	74 30                	je     aa7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a77:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a79:	5b                   	pop    %ebx
+  freep = p;
+ a7a:	89 15 84 14 08 00    	mov    %edx,0x81484
+}
+ a80:	5e                   	pop    %esi
+ a81:	5f                   	pop    %edi
+ a82:	5d                   	pop    %ebp
+ a83:	c3                   	ret
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a88:	39 c1                	cmp    %eax,%ecx
+ a8a:	72 d0                	jb     a5c <ufree+0x1c>
+ a8c:	eb c2                	jmp    a50 <ufree+0x10>
+ a8e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a90:	03 70 04             	add    0x4(%eax),%esi
+ a93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a96:	8b 02                	mov    (%edx),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a9d:	8b 42 04             	mov    0x4(%edx),%eax
+ aa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aa3:	39 f1                	cmp    %esi,%ecx
+ aa5:	75 d0                	jne    a77 <ufree+0x37>
+    p->s.size += bp->s.size;
+ aa7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aaa:	89 15 84 14 08 00    	mov    %edx,0x81484
+    p->s.size += bp->s.size;
+ ab0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ab3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ab6:	89 0a                	mov    %ecx,(%edx)
+}
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	53                   	push   %ebx
+ ac4:	83 ec 10             	sub    $0x10,%esp
+ ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ aca:	68 80 14 08 00       	push   $0x81480
+ acf:	e8 ec 01 00 00       	call   cc0 <lock_acquire>
+  ufree(ap);
+ ad4:	89 d8                	mov    %ebx,%eax
+ ad6:	e8 65 ff ff ff       	call   a40 <ufree>
+  lock_release(&mlock);
+ adb:	c7 45 08 80 14 08 00 	movl   $0x81480,0x8(%ebp)
+}
+ ae2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ ae5:	83 c4 10             	add    $0x10,%esp
+}
+ ae8:	c9                   	leave
+  lock_release(&mlock);
+ ae9:	e9 f2 01 00 00       	jmp    ce0 <lock_release>
+ aee:	66 90                	xchg   %ax,%ax
+
+00000af0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ afc:	68 80 14 08 00       	push   $0x81480
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b01:	8d 48 07             	lea    0x7(%eax),%ecx
+ b04:	c1 e9 03             	shr    $0x3,%ecx
+ b07:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ b0a:	e8 b1 01 00 00       	call   cc0 <lock_acquire>
+  if((prevp = freep) == 0){
+ b0f:	8b 15 84 14 08 00    	mov    0x81484,%edx
+ b15:	83 c4 10             	add    $0x10,%esp
+ b18:	85 d2                	test   %edx,%edx
+ b1a:	0f 84 b0 00 00 00    	je     bd0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b20:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ b22:	8b 47 04             	mov    0x4(%edi),%eax
+ b25:	39 f0                	cmp    %esi,%eax
+ b27:	73 6f                	jae    b98 <malloc+0xa8>
+  if(nu < 4096)
+ b29:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b2e:	39 de                	cmp    %ebx,%esi
+ b30:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b33:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ b3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b3d:	eb 0a                	jmp    b49 <malloc+0x59>
+ b3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b40:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ b42:	8b 47 04             	mov    0x4(%edi),%eax
+ b45:	39 f0                	cmp    %esi,%eax
+ b47:	73 4f                	jae    b98 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b49:	89 fa                	mov    %edi,%edx
+ b4b:	39 3d 84 14 08 00    	cmp    %edi,0x81484
+ b51:	75 ed                	jne    b40 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ b53:	83 ec 0c             	sub    $0xc,%esp
+ b56:	ff 75 e4             	push   -0x1c(%ebp)
+ b59:	e8 ad fb ff ff       	call   70b <sbrk>
+  if(p == (char*)-1)
+ b5e:	83 c4 10             	add    $0x10,%esp
+ b61:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b64:	74 15                	je     b7b <malloc+0x8b>
+  hp->s.size = nu;
+ b66:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ b69:	83 c0 08             	add    $0x8,%eax
+ b6c:	e8 cf fe ff ff       	call   a40 <ufree>
+  return freep;
+ b71:	8b 15 84 14 08 00    	mov    0x81484,%edx
+      if((p = morecore(nunits)) == 0){
+ b77:	85 d2                	test   %edx,%edx
+ b79:	75 c5                	jne    b40 <malloc+0x50>
+        lock_release(&mlock);
+ b7b:	83 ec 0c             	sub    $0xc,%esp
+ b7e:	68 80 14 08 00       	push   $0x81480
+ b83:	e8 58 01 00 00       	call   ce0 <lock_release>
+        return 0;
+ b88:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ b8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b8e:	31 c0                	xor    %eax,%eax
+}
+ b90:	5b                   	pop    %ebx
+ b91:	5e                   	pop    %esi
+ b92:	5f                   	pop    %edi
+ b93:	5d                   	pop    %ebp
+ b94:	c3                   	ret
+ b95:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b98:	39 c6                	cmp    %eax,%esi
+ b9a:	74 64                	je     c00 <malloc+0x110>
+        p->s.size -= nunits;
+ b9c:	29 f0                	sub    %esi,%eax
+ b9e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ ba1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ ba4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ ba7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ baa:	89 15 84 14 08 00    	mov    %edx,0x81484
+      lock_release(&mlock);
+ bb0:	68 80 14 08 00       	push   $0x81480
+ bb5:	e8 26 01 00 00       	call   ce0 <lock_release>
+      return (void*)(p + 1);
+ bba:	83 c4 10             	add    $0x10,%esp
+}
+ bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bc0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ bc3:	5b                   	pop    %ebx
+ bc4:	5e                   	pop    %esi
+ bc5:	5f                   	pop    %edi
+ bc6:	5d                   	pop    %ebp
+ bc7:	c3                   	ret
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ bd0:	c7 05 84 14 08 00 88 	movl   $0x81488,0x81484
+ bd7:	14 08 00 
+    base.s.size = 0;
+ bda:	bf 88 14 08 00       	mov    $0x81488,%edi
+    base.s.ptr = freep = prevp = &base;
+ bdf:	c7 05 88 14 08 00 88 	movl   $0x81488,0x81488
+ be6:	14 08 00 
+    base.s.size = 0;
+ be9:	c7 05 8c 14 08 00 00 	movl   $0x0,0x8148c
+ bf0:	00 00 00 
+    if(p->s.size >= nunits){
+ bf3:	e9 31 ff ff ff       	jmp    b29 <malloc+0x39>
+ bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c00:	8b 07                	mov    (%edi),%eax
+ c02:	89 02                	mov    %eax,(%edx)
+ c04:	eb a1                	jmp    ba7 <malloc+0xb7>
+ c06:	66 90                	xchg   %ax,%ax
+ c08:	66 90                	xchg   %ax,%ax
+ c0a:	66 90                	xchg   %ax,%ax
+ c0c:	66 90                	xchg   %ax,%ax
+ c0e:	66 90                	xchg   %ax,%ax
+
+00000c10 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	53                   	push   %ebx
+ c14:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ c17:	68 00 10 00 00       	push   $0x1000
+ c1c:	e8 cf fe ff ff       	call   af0 <malloc>
+ c21:	83 c4 10             	add    $0x10,%esp
+ c24:	85 c0                	test   %eax,%eax
+ c26:	74 37                	je     c5f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ c28:	83 ec 04             	sub    $0x4,%esp
+ c2b:	89 c3                	mov    %eax,%ebx
+ c2d:	50                   	push   %eax
+ c2e:	ff 75 0c             	push   0xc(%ebp)
+ c31:	ff 75 08             	push   0x8(%ebp)
+ c34:	e8 0a fb ff ff       	call   743 <clone>
+ c39:	83 c4 10             	add    $0x10,%esp
+ c3c:	85 c0                	test   %eax,%eax
+ c3e:	78 08                	js     c48 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c43:	c9                   	leave
+ c44:	c3                   	ret
+ c45:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ c48:	83 ec 0c             	sub    $0xc,%esp
+ c4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c4e:	53                   	push   %ebx
+ c4f:	e8 6c fe ff ff       	call   ac0 <free>
+ c54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ c5a:	83 c4 10             	add    $0x10,%esp
+}
+ c5d:	c9                   	leave
+ c5e:	c3                   	ret
+    return -1;
+ c5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c64:	eb da                	jmp    c40 <thread_create+0x30>
+ c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c70 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ c76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ c79:	50                   	push   %eax
+ c7a:	e8 cc fa ff ff       	call   74b <join>
+ c7f:	83 c4 10             	add    $0x10,%esp
+ c82:	85 c0                	test   %eax,%eax
+ c84:	79 0a                	jns    c90 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ c86:	c9                   	leave
+ c87:	c3                   	ret
+ c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+ c90:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ c93:	83 ec 0c             	sub    $0xc,%esp
+ c96:	ff 75 f4             	push   -0xc(%ebp)
+ c99:	e8 22 fe ff ff       	call   ac0 <free>
+ c9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ca1:	83 c4 10             	add    $0x10,%esp
+}
+ ca4:	c9                   	leave
+ ca5:	c3                   	ret
+ ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cbc:	5d                   	pop    %ebp
+ cbd:	c3                   	ret
+ cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ cc0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ cc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cc6:	89 e5                	mov    %esp,%ebp
+ cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+ cd0:	89 c8                	mov    %ecx,%eax
+ cd2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ cd5:	85 c0                	test   %eax,%eax
+ cd7:	75 f7                	jne    cd0 <lock_acquire+0x10>
+    ;
+}
+ cd9:	5d                   	pop    %ebp
+ cda:	c3                   	ret
+ cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+
+00000ce0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	31 c0                	xor    %eax,%eax
+ ce3:	89 e5                	mov    %esp,%ebp
+ ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+ ce8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ ceb:	5d                   	pop    %ebp
+ cec:	c3                   	ret
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cf0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cfc:	5d                   	pop    %ebp
+ cfd:	c3                   	ret
+ cfe:	66 90                	xchg   %ax,%ax
+
+00000d00 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ d00:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ d01:	31 c0                	xor    %eax,%eax
+ d03:	ba 01 00 00 00       	mov    $0x1,%edx
+ d08:	89 e5                	mov    %esp,%ebp
+ d0a:	56                   	push   %esi
+ d0b:	53                   	push   %ebx
+ d0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d0f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ d13:	85 c0                	test   %eax,%eax
+ d15:	74 30                	je     d47 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ d17:	83 f8 02             	cmp    $0x2,%eax
+ d1a:	74 0c                	je     d28 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ d1c:	b8 02 00 00 00       	mov    $0x2,%eax
+ d21:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ d24:	85 c0                	test   %eax,%eax
+ d26:	74 1f                	je     d47 <mutex_lock+0x47>
+ d28:	be 02 00 00 00       	mov    $0x2,%esi
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ d30:	83 ec 08             	sub    $0x8,%esp
+ d33:	6a 02                	push   $0x2
+ d35:	53                   	push   %ebx
+ d36:	e8 18 fa ff ff       	call   753 <futex_wait>
+ d3b:	89 f0                	mov    %esi,%eax
+ d3d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ d40:	83 c4 10             	add    $0x10,%esp
+ d43:	85 c0                	test   %eax,%eax
+ d45:	75 e9                	jne    d30 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ d47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d4a:	5b                   	pop    %ebx
+ d4b:	5e                   	pop    %esi
+ d4c:	5d                   	pop    %ebp
+ d4d:	c3                   	ret
+ d4e:	66 90                	xchg   %ax,%ax
+
+00000d50 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ d50:	55                   	push   %ebp
+ d51:	31 c0                	xor    %eax,%eax
+ d53:	89 e5                	mov    %esp,%ebp
+ d55:	83 ec 08             	sub    $0x8,%esp
+ d58:	8b 55 08             	mov    0x8(%ebp),%edx
+ d5b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ d5e:	83 f8 02             	cmp    $0x2,%eax
+ d61:	74 05                	je     d68 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ d63:	c9                   	leave
+ d64:	c3                   	ret
+ d65:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ d68:	83 ec 08             	sub    $0x8,%esp
+ d6b:	6a 01                	push   $0x1
+ d6d:	52                   	push   %edx
+ d6e:	e8 e8 f9 ff ff       	call   75b <futex_wake>
+ d73:	83 c4 10             	add    $0x10,%esp
+}
+ d76:	c9                   	leave
+ d77:	c3                   	ret
+ d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7f:	90                   	nop
+
+00000d80 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ d80:	55                   	push   %ebp
+ d81:	89 e5                	mov    %esp,%ebp
+ d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ d86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ d8c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d93:	5d                   	pop    %ebp
+ d94:	c3                   	ret
+ d95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	57                   	push   %edi
+ da4:	56                   	push   %esi
+ da5:	53                   	push   %ebx
+ da6:	83 ec 0c             	sub    $0xc,%esp
+ da9:	8b 75 08             	mov    0x8(%ebp),%esi
+ dac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ daf:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ db4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ db6:	8b 3e                	mov    (%esi),%edi
+ db8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ dbb:	83 f8 02             	cmp    $0x2,%eax
+ dbe:	74 60                	je     e20 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ dc0:	83 ec 08             	sub    $0x8,%esp
+ dc3:	57                   	push   %edi
+ dc4:	56                   	push   %esi
+ dc5:	e8 89 f9 ff ff       	call   753 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ dca:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ dcf:	31 c0                	xor    %eax,%eax
+ dd1:	ba 01 00 00 00       	mov    $0x1,%edx
+ dd6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ dda:	83 c4 10             	add    $0x10,%esp
+ ddd:	85 c0                	test   %eax,%eax
+ ddf:	74 36                	je     e17 <cond_wait+0x77>
+  if(c != 2)
+ de1:	83 f8 02             	cmp    $0x2,%eax
+ de4:	74 0c                	je     df2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ de6:	b8 02 00 00 00       	mov    $0x2,%eax
+ deb:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ dee:	85 c0                	test   %eax,%eax
+ df0:	74 25                	je     e17 <cond_wait+0x77>
+ df2:	be 02 00 00 00       	mov    $0x2,%esi
+ df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfe:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ e00:	83 ec 08             	sub    $0x8,%esp
+ e03:	6a 02                	push   $0x2
+ e05:	53                   	push   %ebx
+ e06:	e8 48 f9 ff ff       	call   753 <futex_wait>
+ e0b:	89 f0                	mov    %esi,%eax
+ e0d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ e10:	83 c4 10             	add    $0x10,%esp
+ e13:	85 c0                	test   %eax,%eax
+ e15:	75 e9                	jne    e00 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e1a:	5b                   	pop    %ebx
+ e1b:	5e                   	pop    %esi
+ e1c:	5f                   	pop    %edi
+ e1d:	5d                   	pop    %ebp
+ e1e:	c3                   	ret
+ e1f:	90                   	nop
+    futex_wake(&m->val, 1);
+ e20:	83 ec 08             	sub    $0x8,%esp
+ e23:	6a 01                	push   $0x1
+ e25:	53                   	push   %ebx
+ e26:	e8 30 f9 ff ff       	call   75b <futex_wake>
+ e2b:	83 c4 10             	add    $0x10,%esp
+ e2e:	eb 90                	jmp    dc0 <cond_wait+0x20>
+
+00000e30 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e30:	55                   	push   %ebp
+ e31:	89 e5                	mov    %esp,%ebp
+ e33:	83 ec 08             	sub    $0x8,%esp
+ e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ e39:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ e3d:	8b 50 04             	mov    0x4(%eax),%edx
+ e40:	85 d2                	test   %edx,%edx
+ e42:	75 0c                	jne    e50 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ e44:	c9                   	leave
+ e45:	c3                   	ret
+ e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ e50:	83 ec 08             	sub    $0x8,%esp
+ e53:	6a 01                	push   $0x1
+ e55:	50                   	push   %eax
+ e56:	e8 00 f9 ff ff       	call   75b <futex_wake>
+ e5b:	83 c4 10             	add    $0x10,%esp
+}
+ e5e:	c9                   	leave
+ e5f:	c3                   	ret
+
+00000e60 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	83 ec 08             	sub    $0x8,%esp
+ e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ e69:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ e6d:	8b 50 04             	mov    0x4(%eax),%edx
+ e70:	85 d2                	test   %edx,%edx
+ e72:	75 0c                	jne    e80 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ e74:	c9                   	leave
+ e75:	c3                   	ret
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ e80:	83 ec 08             	sub    $0x8,%esp
+ e83:	68 ff ff ff 7f       	push   $0x7fffffff
+ e88:	50                   	push   %eax
+ e89:	e8 cd f8 ff ff       	call   75b <futex_wake>
+ e8e:	83 c4 10             	add    $0x10,%esp
+}
+ e91:	c9                   	leave
+ e92:	c3                   	ret
@@ -0,0 +1,131 @@
+// Show which processes used the most CPU time
+// over each interval, busiest first.
+// usage: top [-n iterations] [-d seconds]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+#include "time.h"
+
+#define NSHOW 10
+
+struct procinfo snap[2][NPROC];
+int nsnap[2];
+
+// Print s left-justified in a field of width w.
+static void
+col(char *s, int w)
+{
+  int n;
+
+  n = strlen(s);
+  printf(1, "%s", s);
+  for(; n < w; n++)
+    printf(1, " ");
+}
+
+static void
+coln(uint x, int w)
+{
+  char buf[16];
+  int i;
+
+  i = sizeof(buf) - 1;
+  buf[i] = 0;
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  col(buf+i, w);
+}
+
+static uint
+msecs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+// CPU milliseconds used by cur since the previous snapshot.
+static uint
+used(struct procinfo *cur, struct procinfo *old, int nold)
+{
+  int i;
+
+  for(i = 0; i < nold; i++)
+    if(old[i].pid == cur->pid)
+      return cur->utime + cur->stime - old[i].utime - old[i].stime;
+  return cur->utime + cur->stime;
+}
+
+static void
+show(struct procinfo *cur, int ncur, struct procinfo *old, int nold, uint ms)
+{
+  static uint delta[NPROC];
+  static int order[NPROC];
+  uint total, d;
+  int i, j, k;
+
+  total = 0;
+  for(i = 0; i < ncur; i++){
+    delta[i] = used(&cur[i], old, nold);
+    total += delta[i];
+    // Insertion sort, busiest first.
+    for(j = i; j > 0 && delta[order[j-1]] < delta[i]; j--)
+      order[j] = order[j-1];
+    order[j] = i;
+  }
+  if(ms == 0)
+    ms = 1;
+  printf(1, "\n%d processes, %d%% of one cpu busy over %d ms\n",
+         ncur, total*100/ms, ms);
+  printf(1, "PID   CPU%%  USER    SYS     IVCSW   NAME\n");
+  for(k = 0; k < ncur && k < NSHOW; k++){
+    i = order[k];
+    d = delta[i];
+    coln(cur[i].pid, 6);
+    coln(d*100/ms, 6);
+    coln(cur[i].utime, 8);
+    coln(cur[i].stime, 8);
+    coln(cur[i].nivcsw, 8);
+    printf(1, "%s\n", cur[i].name);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, iter, secs, c;
+  uint t0, t1;
+
+  iter = 5;
+  secs = 1;
+  for(i = 1; i+1 < argc; i += 2){
+    if(strcmp(argv[i], "-n") == 0)
+      iter = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-d") == 0)
+      secs = atoi(argv[i+1]);
+    else
+      break;
+  }
+  if(i < argc || iter <= 0 || secs <= 0){
+    printf(2, "usage: top [-n iterations] [-d seconds]\n");
+    exit();
+  }
+
+  c = 0;
+  nsnap[c] = getprocinfo(snap[c], NPROC);
+  t0 = msecs();
+  while(iter-- > 0){
+    sleep(secs*100);
+    c = !c;
+    nsnap[c] = getprocinfo(snap[c], NPROC);
+    t1 = msecs();
+    show(snap[c], nsnap[c], snap[!c], nsnap[!c], t1 - t0);
+    t0 = t1;
+  }
+  exit();
+}
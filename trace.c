@@ -0,0 +1,164 @@
+// Scheduler event tracing.
+//
+// Each CPU appends events to its own ring buffer with
+// interrupts off and no lock, so tracing costs little and
+// can't perturb the locking it is watching.  Readers take
+// tracelock among themselves and copy events out from
+// behind the writers, dropping any that a writer may have
+// overwritten while they were being copied.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "trace.h"
+
+#define NTRACEPG  8                                 // pages per CPU
+#define PERPAGE   (PGSIZE / sizeof(struct tracerec))
+#define NTRACE    (NTRACEPG * PERPAGE)              // events per CPU
+
+struct tracerec {
+  uint64 tsc;
+  int type;
+  int pid;
+  int arg;
+  int pad[3];   // 32 bytes, so PERPAGE is a power of two
+};
+
+struct tracebuf {
+  volatile uint head;     // events written; only this CPU changes it
+  uint tail;              // events read; protected by tracelock
+  struct tracerec *page[NTRACEPG];
+} CACHEALIGN;
+
+static struct spinlock tracelock;
+static struct tracebuf tracebufs[NCPU];
+static int tracealloced;
+int tracing;
+
+void
+traceinit(void)
+{
+  initlock(&tracelock, "trace");
+}
+
+// Record an event on this CPU, if tracing is on.
+void
+trace(int type, int pid, int arg)
+{
+  struct tracebuf *t;
+  struct tracerec *r;
+  uint h;
+
+  if(!tracing)
+    return;
+  pushcli();
+  t = &tracebufs[cpu-cpus];
+  h = t->head;
+  r = &t->page[(h / PERPAGE) % NTRACEPG][h % PERPAGE];
+  r->tsc = rdtsc();
+  r->type = type;
+  r->pid = pid;
+  r->arg = arg;
+  // The record must be complete before a reader sees head move.
+  __sync_synchronize();
+  t->head = h + 1;
+  popcli();
+}
+
+// Give back the buffer pages tracectl got before kalloc ran
+// out.  tracelock must be held.
+static void
+tracefree(void)
+{
+  struct tracebuf *t;
+  int i;
+
+  for(t = tracebufs; t < tracebufs+ncpu; t++){
+    for(i = 0; i < NTRACEPG; i++){
+      if(t->page[i]){
+        kfree((char*)t->page[i]);
+        t->page[i] = 0;
+      }
+    }
+  }
+}
+
+// Turn tracing on or off; return whether it was on.
+// Buffers are allocated the first time it is turned on,
+// and events left from before are discarded.
+int
+tracectl(int on)
+{
+  struct tracebuf *t;
+  int i, was;
+
+  acquire(&tracelock);
+  was = tracing;
+  if(on && !tracealloced){
+    for(t = tracebufs; t < tracebufs+ncpu; t++){
+      for(i = 0; i < NTRACEPG; i++){
+        if((t->page[i] = (struct tracerec*)kalloc()) == 0){
+          tracefree();
+          release(&tracelock);
+          return -1;
+        }
+      }
+    }
+    tracealloced = 1;
+  }
+  if(on && !was)
+    for(t = tracebufs; t < tracebufs+ncpu; t++)
+      t->tail = t->head;
+  tracing = on != 0;
+  release(&tracelock);
+  return was;
+}
+
+// Copy up to n unread events into ev, one CPU after another,
+// converting their times to nanoseconds since boot.
+// Return the number copied.
+int
+traceread(struct traceevent *ev, int n)
+{
+  struct tracebuf *t;
+  struct tracerec r;
+  uint i, head;
+  uint64 ns;
+  int got;
+
+  got = 0;
+  acquire(&tracelock);
+  if(!tracealloced){
+    release(&tracelock);
+    return 0;
+  }
+  for(t = tracebufs; t < tracebufs+ncpu && got < n; t++){
+    head = t->head;
+    i = t->tail;
+    if(head - i > NTRACE)
+      i = head - NTRACE;   // the writer lapped us
+    for(; i != head && got < n; i++){
+      r = t->page[(i / PERPAGE) % NTRACEPG][i % PERPAGE];
+      __sync_synchronize();
+      if(t->head - i > NTRACE)
+        continue;          // overwritten while we copied it
+      ns = tsc2ns(r.tsc);
+      ev->sec = divu64(ns, 1000000000);
+      ev->nsec = ns - (uint64)ev->sec * 1000000000;
+      ev->type = r.type;
+      ev->cpu = t - tracebufs;
+      ev->pid = r.pid;
+      ev->arg = r.arg;
+      ev++;
+      got++;
+    }
+    t->tail = i;
+  }
+  release(&tracelock);
+  return got;
+}
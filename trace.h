@@ -0,0 +1,21 @@
+// Scheduler trace events, as returned by traceread().
+
+#define TR_SWITCHIN   1   // pid starts running; arg is the CPU it last ran on
+#define TR_SWITCHOUT  2   // pid stops running; arg is its new state (TS_*)
+#define TR_WAKEUP     3   // pid becomes runnable; arg is the waker's pid or 0
+#define TR_SLEEP      4   // pid goes to sleep; arg is the sleep channel
+#define TR_MIGRATE    5   // pid moves to a new CPU; arg is the old one
+
+// New states in TR_SWITCHOUT.
+#define TS_SLEEPING   1
+#define TS_RUNNABLE   2   // preempted or yielded
+#define TS_ZOMBIE     3
+
+struct traceevent {
+  uint sec;     // time since boot
+  uint nsec;
+  int type;     // TR_*
+  int cpu;
+  int pid;
+  int arg;
+};
@@ -0,0 +1,1971 @@
+
+_tracedump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, "name %d %s\n", pi[i].pid, pi[i].name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 19                	mov    (%ecx),%ebx
+  15:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pid, secs;
+
+  if(argc < 2 || (strcmp(argv[1], "-s") == 0 && argc != 3)){
+  18:	83 fb 01             	cmp    $0x1,%ebx
+  1b:	7e 1b                	jle    38 <main+0x38>
+  1d:	50                   	push   %eax
+  1e:	50                   	push   %eax
+  1f:	68 e6 0c 00 00       	push   $0xce6
+  24:	ff 76 04             	push   0x4(%esi)
+  27:	e8 74 02 00 00       	call   2a0 <strcmp>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	75 19                	jne    4c <main+0x4c>
+  33:	83 fb 03             	cmp    $0x3,%ebx
+  36:	74 14                	je     4c <main+0x4c>
+    printf(2, "usage: tracedump -s seconds | tracedump cmd [arg...]\n");
+  38:	83 ec 08             	sub    $0x8,%esp
+  3b:	68 50 0d 00 00       	push   $0xd50
+  40:	6a 02                	push   $0x2
+  42:	e8 79 06 00 00       	call   6c0 <printf>
+    exit();
+  47:	e8 67 04 00 00       	call   4b3 <exit>
+  }
+  if(tracectl(1) < 0){
+  4c:	83 ec 0c             	sub    $0xc,%esp
+  4f:	6a 01                	push   $0x1
+  51:	e8 65 05 00 00       	call   5bb <tracectl>
+  56:	83 c4 10             	add    $0x10,%esp
+  59:	85 c0                	test   %eax,%eax
+  5b:	78 73                	js     d0 <main+0xd0>
+    printf(2, "tracedump: cannot start tracing\n");
+    exit();
+  }
+  drain();  // discard nothing, but name what is running
+  5d:	e8 ee 00 00 00       	call   150 <drain>
+
+  if(strcmp(argv[1], "-s") == 0){
+  62:	53                   	push   %ebx
+  63:	53                   	push   %ebx
+  64:	68 e6 0c 00 00       	push   $0xce6
+  69:	ff 76 04             	push   0x4(%esi)
+  6c:	e8 2f 02 00 00       	call   2a0 <strcmp>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	85 c0                	test   %eax,%eax
+  76:	75 6b                	jne    e3 <main+0xe3>
+    for(secs = atoi(argv[2])*10; secs > 0; secs--){
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	ff 76 08             	push   0x8(%esi)
+  7e:	e8 bd 03 00 00       	call   440 <atoi>
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	6b d8 0a             	imul   $0xa,%eax,%ebx
+  89:	85 db                	test   %ebx,%ebx
+  8b:	7e 1a                	jle    a7 <main+0xa7>
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+      sleep(10);
+  90:	83 ec 0c             	sub    $0xc,%esp
+  93:	6a 0a                	push   $0xa
+  95:	e8 a9 04 00 00       	call   543 <sleep>
+      drain();
+  9a:	e8 b1 00 00 00       	call   150 <drain>
+    for(secs = atoi(argv[2])*10; secs > 0; secs--){
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	83 eb 01             	sub    $0x1,%ebx
+  a5:	75 e9                	jne    90 <main+0x90>
+    while(waitpid(pid, WNOHANG) == 0){
+      sleep(1);
+      drain();
+    }
+  }
+  tracectl(0);
+  a7:	83 ec 0c             	sub    $0xc,%esp
+  aa:	6a 00                	push   $0x0
+  ac:	e8 0a 05 00 00       	call   5bb <tracectl>
+  drain();
+  b1:	e8 9a 00 00 00       	call   150 <drain>
+  printf(2, "tracedump: %d events\n", nevent);
+  b6:	83 c4 0c             	add    $0xc,%esp
+  b9:	ff 35 00 13 00 00    	push   0x1300
+  bf:	68 e9 0c 00 00       	push   $0xce9
+  c4:	6a 02                	push   $0x2
+  c6:	e8 f5 05 00 00       	call   6c0 <printf>
+  exit();
+  cb:	e8 e3 03 00 00       	call   4b3 <exit>
+    printf(2, "tracedump: cannot start tracing\n");
+  d0:	56                   	push   %esi
+  d1:	56                   	push   %esi
+  d2:	68 88 0d 00 00       	push   $0xd88
+  d7:	6a 02                	push   $0x2
+  d9:	e8 e2 05 00 00       	call   6c0 <printf>
+    exit();
+  de:	e8 d0 03 00 00       	call   4b3 <exit>
+    pid = fork();
+  e3:	e8 c3 03 00 00       	call   4ab <fork>
+  e8:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  ea:	85 c0                	test   %eax,%eax
+  ec:	78 4f                	js     13d <main+0x13d>
+    if(pid == 0){
+  ee:	75 37                	jne    127 <main+0x127>
+      exec(argv[1], argv+1);
+  f0:	8d 46 04             	lea    0x4(%esi),%eax
+  f3:	52                   	push   %edx
+  f4:	52                   	push   %edx
+  f5:	50                   	push   %eax
+  f6:	ff 76 04             	push   0x4(%esi)
+  f9:	e8 ed 03 00 00       	call   4eb <exec>
+      printf(2, "tracedump: exec %s failed\n", argv[1]);
+  fe:	83 c4 0c             	add    $0xc,%esp
+ 101:	ff 76 04             	push   0x4(%esi)
+ 104:	68 17 0d 00 00       	push   $0xd17
+ 109:	6a 02                	push   $0x2
+ 10b:	e8 b0 05 00 00       	call   6c0 <printf>
+      exit();
+ 110:	e8 9e 03 00 00       	call   4b3 <exit>
+      sleep(1);
+ 115:	83 ec 0c             	sub    $0xc,%esp
+ 118:	6a 01                	push   $0x1
+ 11a:	e8 24 04 00 00       	call   543 <sleep>
+      drain();
+ 11f:	e8 2c 00 00 00       	call   150 <drain>
+ 124:	83 c4 10             	add    $0x10,%esp
+    while(waitpid(pid, WNOHANG) == 0){
+ 127:	50                   	push   %eax
+ 128:	50                   	push   %eax
+ 129:	6a 01                	push   $0x1
+ 12b:	53                   	push   %ebx
+ 12c:	e8 82 04 00 00       	call   5b3 <waitpid>
+ 131:	83 c4 10             	add    $0x10,%esp
+ 134:	85 c0                	test   %eax,%eax
+ 136:	74 dd                	je     115 <main+0x115>
+ 138:	e9 6a ff ff ff       	jmp    a7 <main+0xa7>
+      printf(2, "tracedump: fork failed\n");
+ 13d:	51                   	push   %ecx
+ 13e:	51                   	push   %ecx
+ 13f:	68 ff 0c 00 00       	push   $0xcff
+ 144:	6a 02                	push   $0x2
+ 146:	e8 75 05 00 00       	call   6c0 <printf>
+      exit();
+ 14b:	e8 63 03 00 00       	call   4b3 <exit>
+
+00000150 <drain>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+ 155:	8d 75 de             	lea    -0x22(%ebp),%esi
+ 158:	53                   	push   %ebx
+ 159:	83 ec 2c             	sub    $0x2c,%esp
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((n = traceread(ev, NEV)) > 0){
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	68 00 01 00 00       	push   $0x100
+ 168:	68 20 d3 03 00       	push   $0x3d320
+ 16d:	e8 51 04 00 00       	call   5c3 <traceread>
+ 172:	83 c4 10             	add    $0x10,%esp
+ 175:	85 c0                	test   %eax,%eax
+ 177:	0f 8e 97 00 00 00    	jle    214 <drain+0xc4>
+    for(e = ev; e < ev+n; e++){
+ 17d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+ 180:	bf 20 d3 03 00       	mov    $0x3d320,%edi
+ 185:	8d 14 d5 20 d3 03 00 	lea    0x3d320(,%edx,8),%edx
+ 18c:	39 fa                	cmp    %edi,%edx
+ 18e:	76 79                	jbe    209 <drain+0xb9>
+ 190:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 193:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+      x = e->nsec;
+ 1a0:	8b 4f 04             	mov    0x4(%edi),%ecx
+      for(j = 8; j >= 0; j--){
+ 1a3:	8d 5d e6             	lea    -0x1a(%ebp),%ebx
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+        ns[j] = '0' + x % 10;
+ 1b0:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 1b5:	f7 e1                	mul    %ecx
+ 1b7:	c1 ea 03             	shr    $0x3,%edx
+ 1ba:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 1bd:	01 c0                	add    %eax,%eax
+ 1bf:	29 c1                	sub    %eax,%ecx
+ 1c1:	89 d8                	mov    %ebx,%eax
+      for(j = 8; j >= 0; j--){
+ 1c3:	83 eb 01             	sub    $0x1,%ebx
+        ns[j] = '0' + x % 10;
+ 1c6:	83 c1 30             	add    $0x30,%ecx
+ 1c9:	88 4b 01             	mov    %cl,0x1(%ebx)
+        x /= 10;
+ 1cc:	89 d1                	mov    %edx,%ecx
+      for(j = 8; j >= 0; j--){
+ 1ce:	39 c6                	cmp    %eax,%esi
+ 1d0:	75 de                	jne    1b0 <drain+0x60>
+      ns[9] = 0;
+ 1d2:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    for(e = ev; e < ev+n; e++){
+ 1d6:	83 c7 18             	add    $0x18,%edi
+      printf(1, "ev %d.%s %d %s %d %d\n", e->sec, ns, e->cpu,
+ 1d9:	ff 77 fc             	push   -0x4(%edi)
+ 1dc:	ff 77 f8             	push   -0x8(%edi)
+ 1df:	8b 47 f0             	mov    -0x10(%edi),%eax
+ 1e2:	ff 34 85 ac 0d 00 00 	push   0xdac(,%eax,4)
+ 1e9:	ff 77 f4             	push   -0xc(%edi)
+ 1ec:	56                   	push   %esi
+ 1ed:	ff 77 e8             	push   -0x18(%edi)
+ 1f0:	68 c4 0c 00 00       	push   $0xcc4
+ 1f5:	6a 01                	push   $0x1
+ 1f7:	e8 c4 04 00 00       	call   6c0 <printf>
+    for(e = ev; e < ev+n; e++){
+ 1fc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1ff:	83 c4 20             	add    $0x20,%esp
+ 202:	39 c7                	cmp    %eax,%edi
+ 204:	72 9a                	jb     1a0 <drain+0x50>
+ 206:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    nevent += n;
+ 209:	01 05 00 13 00 00    	add    %eax,0x1300
+ 20f:	e9 4c ff ff ff       	jmp    160 <drain+0x10>
+  n = getprocinfo(pi, NPROC);
+ 214:	83 ec 08             	sub    $0x8,%esp
+ 217:	68 00 10 00 00       	push   $0x1000
+ 21c:	68 20 13 00 00       	push   $0x1320
+ 221:	e8 85 03 00 00       	call   5ab <getprocinfo>
+  for(i = 0; i < n; i++)
+ 226:	83 c4 10             	add    $0x10,%esp
+  n = getprocinfo(pi, NPROC);
+ 229:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+ 22b:	85 c0                	test   %eax,%eax
+ 22d:	7e 2e                	jle    25d <drain+0x10d>
+ 22f:	bb 4c 13 00 00       	mov    $0x134c,%ebx
+ 234:	31 f6                	xor    %esi,%esi
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "name %d %s\n", pi[i].pid, pi[i].name);
+ 240:	53                   	push   %ebx
+  for(i = 0; i < n; i++)
+ 241:	83 c6 01             	add    $0x1,%esi
+ 244:	83 c3 3c             	add    $0x3c,%ebx
+    printf(1, "name %d %s\n", pi[i].pid, pi[i].name);
+ 247:	ff 73 98             	push   -0x68(%ebx)
+ 24a:	68 da 0c 00 00       	push   $0xcda
+ 24f:	6a 01                	push   $0x1
+ 251:	e8 6a 04 00 00       	call   6c0 <printf>
+  for(i = 0; i < n; i++)
+ 256:	83 c4 10             	add    $0x10,%esp
+ 259:	39 f7                	cmp    %esi,%edi
+ 25b:	75 e3                	jne    240 <drain+0xf0>
+}
+ 25d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 260:	5b                   	pop    %ebx
+ 261:	5e                   	pop    %esi
+ 262:	5f                   	pop    %edi
+ 263:	5d                   	pop    %ebp
+ 264:	c3                   	ret
+ 265:	66 90                	xchg   %ax,%ax
+ 267:	66 90                	xchg   %ax,%ax
+ 269:	66 90                	xchg   %ax,%ax
+ 26b:	66 90                	xchg   %ax,%ax
+ 26d:	66 90                	xchg   %ax,%ax
+ 26f:	90                   	nop
+
+00000270 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 271:	31 c0                	xor    %eax,%eax
+{
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	53                   	push   %ebx
+ 276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 287:	83 c0 01             	add    $0x1,%eax
+ 28a:	84 d2                	test   %dl,%dl
+ 28c:	75 f2                	jne    280 <strcpy+0x10>
+    ;
+  return os;
+}
+ 28e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 291:	89 c8                	mov    %ecx,%eax
+ 293:	c9                   	leave
+ 294:	c3                   	ret
+ 295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2aa:	0f b6 02             	movzbl (%edx),%eax
+ 2ad:	84 c0                	test   %al,%al
+ 2af:	75 17                	jne    2c8 <strcmp+0x28>
+ 2b1:	eb 3a                	jmp    2ed <strcmp+0x4d>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2bc:	83 c2 01             	add    $0x1,%edx
+ 2bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2c2:	84 c0                	test   %al,%al
+ 2c4:	74 1a                	je     2e0 <strcmp+0x40>
+    p++, q++;
+ 2c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2cb:	38 c3                	cmp    %al,%bl
+ 2cd:	74 e9                	je     2b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2cf:	29 d8                	sub    %ebx,%eax
+}
+ 2d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2e4:	31 c0                	xor    %eax,%eax
+ 2e6:	29 d8                	sub    %ebx,%eax
+}
+ 2e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2eb:	c9                   	leave
+ 2ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 2f0:	31 c0                	xor    %eax,%eax
+ 2f2:	eb db                	jmp    2cf <strcmp+0x2f>
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 306:	80 3a 00             	cmpb   $0x0,(%edx)
+ 309:	74 15                	je     320 <strlen+0x20>
+ 30b:	31 c0                	xor    %eax,%eax
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	83 c0 01             	add    $0x1,%eax
+ 313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 317:	89 c1                	mov    %eax,%ecx
+ 319:	75 f5                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+ 31b:	89 c8                	mov    %ecx,%eax
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+ 31f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 320:	31 c9                	xor    %ecx,%ecx
+}
+ 322:	5d                   	pop    %ebp
+ 323:	89 c8                	mov    %ecx,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33d:	89 d7                	mov    %edx,%edi
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 345:	89 d0                	mov    %edx,%eax
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 35a:	0f b6 10             	movzbl (%eax),%edx
+ 35d:	84 d2                	test   %dl,%dl
+ 35f:	75 12                	jne    373 <strchr+0x23>
+ 361:	eb 1d                	jmp    380 <strchr+0x30>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	84 d2                	test   %dl,%dl
+ 371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+ 373:	38 d1                	cmp    %dl,%cl
+ 375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 380:	31 c0                	xor    %eax,%eax
+}
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 399:	31 db                	xor    %ebx,%ebx
+{
+ 39b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 39e:	eb 27                	jmp    3c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 01                	push   $0x1
+ 3a5:	56                   	push   %esi
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	e8 1e 01 00 00       	call   4cb <read>
+    if(cc < 1)
+ 3ad:	83 c4 10             	add    $0x10,%esp
+ 3b0:	85 c0                	test   %eax,%eax
+ 3b2:	7e 1d                	jle    3d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3bf:	3c 0a                	cmp    $0xa,%al
+ 3c1:	74 10                	je     3d3 <gets+0x43>
+ 3c3:	3c 0d                	cmp    $0xd,%al
+ 3c5:	74 0c                	je     3d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3c7:	89 df                	mov    %ebx,%edi
+ 3c9:	83 c3 01             	add    $0x1,%ebx
+ 3cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3cf:	7c cf                	jl     3a0 <gets+0x10>
+ 3d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3dd:	5b                   	pop    %ebx
+ 3de:	5e                   	pop    %esi
+ 3df:	5f                   	pop    %edi
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+ 3e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	ff 75 08             	push   0x8(%ebp)
+ 3fd:	e8 f1 00 00 00       	call   4f3 <open>
+  if(fd < 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	78 27                	js     430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 409:	83 ec 08             	sub    $0x8,%esp
+ 40c:	ff 75 0c             	push   0xc(%ebp)
+ 40f:	89 c3                	mov    %eax,%ebx
+ 411:	50                   	push   %eax
+ 412:	e8 f4 00 00 00       	call   50b <fstat>
+  close(fd);
+ 417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 41a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 41c:	e8 ba 00 00 00       	call   4db <close>
+  return r;
+ 421:	83 c4 10             	add    $0x10,%esp
+}
+ 424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 427:	89 f0                	mov    %esi,%eax
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 435:	eb ed                	jmp    424 <stat+0x34>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	53                   	push   %ebx
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 447:	0f be 02             	movsbl (%edx),%eax
+ 44a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 44d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 455:	77 1e                	ja     475 <atoi+0x35>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 460:	83 c2 01             	add    $0x1,%edx
+ 463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 46a:	0f be 02             	movsbl (%edx),%eax
+ 46d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 470:	80 fb 09             	cmp    $0x9,%bl
+ 473:	76 eb                	jbe    460 <atoi+0x20>
+  return n;
+}
+ 475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 478:	89 c8                	mov    %ecx,%eax
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+
+000004ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <exit>:
+SYSCALL(exit)
+ 4b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <wait>:
+SYSCALL(wait)
+ 4bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <pipe>:
+SYSCALL(pipe)
+ 4c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <read>:
+SYSCALL(read)
+ 4cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <write>:
+SYSCALL(write)
+ 4d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <close>:
+SYSCALL(close)
+ 4db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <kill>:
+SYSCALL(kill)
+ 4e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <exec>:
+SYSCALL(exec)
+ 4eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <open>:
+SYSCALL(open)
+ 4f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mknod>:
+SYSCALL(mknod)
+ 4fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <unlink>:
+SYSCALL(unlink)
+ 503:	b8 12 00 00 00       	mov    $0x12,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <fstat>:
+SYSCALL(fstat)
+ 50b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <link>:
+SYSCALL(link)
+ 513:	b8 13 00 00 00       	mov    $0x13,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mkdir>:
+SYSCALL(mkdir)
+ 51b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <chdir>:
+SYSCALL(chdir)
+ 523:	b8 09 00 00 00       	mov    $0x9,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <dup>:
+SYSCALL(dup)
+ 52b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getpid>:
+SYSCALL(getpid)
+ 533:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sbrk>:
+SYSCALL(sbrk)
+ 53b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sleep>:
+SYSCALL(sleep)
+ 543:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <uptime>:
+SYSCALL(uptime)
+ 54b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <add_dir>:
+SYSCALL(add_dir)
+ 553:	b8 16 00 00 00       	mov    $0x16,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <history>:
+SYSCALL(history)
+ 55b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 563:	b8 19 00 00 00       	mov    $0x19,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <nanosleep>:
+SYSCALL(nanosleep)
+ 56b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <clone>:
+SYSCALL(clone)
+ 573:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <join>:
+SYSCALL(join)
+ 57b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <futex_wait>:
+SYSCALL(futex_wait)
+ 583:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <futex_wake>:
+SYSCALL(futex_wake)
+ 58b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 593:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 59b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 5a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <getprocinfo>:
+SYSCALL(getprocinfo)
+ 5ab:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <waitpid>:
+SYSCALL(waitpid)
+ 5b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <tracectl>:
+SYSCALL(tracectl)
+ 5bb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <traceread>:
+SYSCALL(traceread)
+ 5c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 5cb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 5d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 5db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <irqroute>:
+SYSCALL(irqroute)
+ 5e3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <irqstat>:
+SYSCALL(irqstat)
+ 5eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <boottimes>:
+SYSCALL(boottimes)
+ 5f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <lockbench>:
+SYSCALL(lockbench)
+ 5fb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <lockstat>:
+SYSCALL(lockstat)
+ 603:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <cpustat>:
+SYSCALL(cpustat)
+ 60b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <bcachesize>:
+SYSCALL(bcachesize)
+ 613:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+ 61b:	66 90                	xchg   %ax,%ax
+ 61d:	66 90                	xchg   %ax,%ax
+ 61f:	90                   	nop
+
+00000620 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 628:	89 d1                	mov    %edx,%ecx
+{
+ 62a:	83 ec 3c             	sub    $0x3c,%esp
+ 62d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 630:	85 d2                	test   %edx,%edx
+ 632:	0f 89 80 00 00 00    	jns    6b8 <printint+0x98>
+ 638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 63c:	74 7a                	je     6b8 <printint+0x98>
+    x = -xx;
+ 63e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 645:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 648:	31 f6                	xor    %esi,%esi
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	31 d2                	xor    %edx,%edx
+ 654:	89 f7                	mov    %esi,%edi
+ 656:	f7 f3                	div    %ebx
+ 658:	8d 76 01             	lea    0x1(%esi),%esi
+ 65b:	0f b6 92 24 0e 00 00 	movzbl 0xe24(%edx),%edx
+ 662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 666:	89 ca                	mov    %ecx,%edx
+ 668:	89 c1                	mov    %eax,%ecx
+ 66a:	39 da                	cmp    %ebx,%edx
+ 66c:	73 e2                	jae    650 <printint+0x30>
+  if(neg)
+ 66e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 07                	je     67c <printint+0x5c>
+    buf[i++] = '-';
+ 675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 67a:	89 f7                	mov    %esi,%edi
+ 67c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 67f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 682:	01 df                	add    %ebx,%edi
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 688:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 691:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 694:	6a 01                	push   $0x1
+ 696:	50                   	push   %eax
+ 697:	56                   	push   %esi
+ 698:	e8 36 fe ff ff       	call   4d3 <write>
+  while(--i >= 0)
+ 69d:	89 f8                	mov    %edi,%eax
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	83 ef 01             	sub    $0x1,%edi
+ 6a5:	39 d8                	cmp    %ebx,%eax
+ 6a7:	75 df                	jne    688 <printint+0x68>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6b8:	31 c0                	xor    %eax,%eax
+ 6ba:	eb 89                	jmp    645 <printint+0x25>
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	83 c6 01             	add    $0x1,%esi
+ 6d5:	84 db                	test   %bl,%bl
+ 6d7:	74 67                	je     740 <printf+0x80>
+ 6d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6dc:	31 d2                	xor    %edx,%edx
+ 6de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6e1:	eb 34                	jmp    717 <printf+0x57>
+ 6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6e7:	90                   	nop
+ 6e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6f0:	83 f8 25             	cmp    $0x25,%eax
+ 6f3:	74 18                	je     70d <printf+0x4d>
+  write(fd, &c, 1);
+ 6f5:	83 ec 04             	sub    $0x4,%esp
+ 6f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fe:	6a 01                	push   $0x1
+ 700:	50                   	push   %eax
+ 701:	57                   	push   %edi
+ 702:	e8 cc fd ff ff       	call   4d3 <write>
+ 707:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 70a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 70d:	0f b6 1e             	movzbl (%esi),%ebx
+ 710:	83 c6 01             	add    $0x1,%esi
+ 713:	84 db                	test   %bl,%bl
+ 715:	74 29                	je     740 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 d2                	test   %edx,%edx
+ 71c:	74 ca                	je     6e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 71e:	83 fa 25             	cmp    $0x25,%edx
+ 721:	75 ea                	jne    70d <printf+0x4d>
+      if(c == 'd'){
+ 723:	83 f8 25             	cmp    $0x25,%eax
+ 726:	0f 84 24 01 00 00    	je     850 <printf+0x190>
+ 72c:	83 e8 63             	sub    $0x63,%eax
+ 72f:	83 f8 15             	cmp    $0x15,%eax
+ 732:	77 1c                	ja     750 <printf+0x90>
+ 734:	ff 24 85 cc 0d 00 00 	jmp    *0xdcc(,%eax,4)
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 743:	5b                   	pop    %ebx
+ 744:	5e                   	pop    %esi
+ 745:	5f                   	pop    %edi
+ 746:	5d                   	pop    %ebp
+ 747:	c3                   	ret
+ 748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 756:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 75a:	6a 01                	push   $0x1
+ 75c:	52                   	push   %edx
+ 75d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 760:	57                   	push   %edi
+ 761:	e8 6d fd ff ff       	call   4d3 <write>
+ 766:	83 c4 0c             	add    $0xc,%esp
+ 769:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76c:	6a 01                	push   $0x1
+ 76e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 771:	52                   	push   %edx
+ 772:	57                   	push   %edi
+ 773:	e8 5b fd ff ff       	call   4d3 <write>
+        putc(fd, c);
+ 778:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77b:	31 d2                	xor    %edx,%edx
+ 77d:	eb 8e                	jmp    70d <printf+0x4d>
+ 77f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 00                	push   $0x0
+ 78f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 791:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 794:	e8 87 fe ff ff       	call   620 <printint>
+        ap++;
+ 799:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 79c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 67 ff ff ff       	jmp    70d <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7b5:	83 c0 04             	add    $0x4,%eax
+ 7b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7bb:	85 db                	test   %ebx,%ebx
+ 7bd:	0f 84 9d 00 00 00    	je     860 <printf+0x1a0>
+        while(*s != 0){
+ 7c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	0f 84 3d ff ff ff    	je     70d <printf+0x4d>
+ 7d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7d6:	89 de                	mov    %ebx,%esi
+ 7d8:	89 d3                	mov    %edx,%ebx
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	53                   	push   %ebx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 e1 fc ff ff       	call   4d3 <write>
+        while(*s != 0){
+ 7f2:	0f b6 06             	movzbl (%esi),%eax
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 e4                	jne    7e0 <printf+0x120>
+      state = 0;
+ 7fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 07 ff ff ff       	jmp    70d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 01                	push   $0x1
+ 81f:	e9 6b ff ff ff       	jmp    78f <printf+0xcf>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 828:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 82b:	83 ec 04             	sub    $0x4,%esp
+ 82e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 831:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 833:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	52                   	push   %edx
+ 83c:	57                   	push   %edi
+ 83d:	e8 91 fc ff ff       	call   4d3 <write>
+        ap++;
+ 842:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 845:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 848:	31 d2                	xor    %edx,%edx
+ 84a:	e9 be fe ff ff       	jmp    70d <printf+0x4d>
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 856:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 859:	6a 01                	push   $0x1
+ 85b:	e9 11 ff ff ff       	jmp    771 <printf+0xb1>
+ 860:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 865:	bb c4 0d 00 00       	mov    $0xdc4,%ebx
+ 86a:	e9 61 ff ff ff       	jmp    7d0 <printf+0x110>
+ 86f:	90                   	nop
+
+00000870 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 870:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 871:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 874:	89 e5                	mov    %esp,%ebp
+ 876:	57                   	push   %edi
+ 877:	56                   	push   %esi
+ 878:	53                   	push   %ebx
+ 879:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 87b:	a1 24 eb 03 00       	mov    0x3eb24,%eax
+ 880:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 882:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 884:	39 ca                	cmp    %ecx,%edx
+ 886:	73 30                	jae    8b8 <ufree+0x48>
+ 888:	39 c1                	cmp    %eax,%ecx
+ 88a:	72 04                	jb     890 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88c:	39 c2                	cmp    %eax,%edx
+ 88e:	72 f0                	jb     880 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 890:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 893:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 896:	39 f8                	cmp    %edi,%eax
+ 898:	74 26                	je     8c0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 89a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 89d:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8a3:	39 f1                	cmp    %esi,%ecx
+ 8a5:	74 30                	je     8d7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8a7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8a9:	5b                   	pop    %ebx
+  freep = p;
+ 8aa:	89 15 24 eb 03 00    	mov    %edx,0x3eb24
+}
+ 8b0:	5e                   	pop    %esi
+ 8b1:	5f                   	pop    %edi
+ 8b2:	5d                   	pop    %ebp
+ 8b3:	c3                   	ret
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b8:	39 c1                	cmp    %eax,%ecx
+ 8ba:	72 d0                	jb     88c <ufree+0x1c>
+ 8bc:	eb c2                	jmp    880 <ufree+0x10>
+ 8be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	03 70 04             	add    0x4(%eax),%esi
+ 8c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c6:	8b 02                	mov    (%edx),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8d3:	39 f1                	cmp    %esi,%ecx
+ 8d5:	75 d0                	jne    8a7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 8d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8da:	89 15 24 eb 03 00    	mov    %edx,0x3eb24
+    p->s.size += bp->s.size;
+ 8e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8e8:	5b                   	pop    %ebx
+ 8e9:	5e                   	pop    %esi
+ 8ea:	5f                   	pop    %edi
+ 8eb:	5d                   	pop    %ebp
+ 8ec:	c3                   	ret
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	53                   	push   %ebx
+ 8f4:	83 ec 10             	sub    $0x10,%esp
+ 8f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 8fa:	68 20 eb 03 00       	push   $0x3eb20
+ 8ff:	e8 ec 01 00 00       	call   af0 <lock_acquire>
+  ufree(ap);
+ 904:	89 d8                	mov    %ebx,%eax
+ 906:	e8 65 ff ff ff       	call   870 <ufree>
+  lock_release(&mlock);
+ 90b:	c7 45 08 20 eb 03 00 	movl   $0x3eb20,0x8(%ebp)
+}
+ 912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 915:	83 c4 10             	add    $0x10,%esp
+}
+ 918:	c9                   	leave
+  lock_release(&mlock);
+ 919:	e9 f2 01 00 00       	jmp    b10 <lock_release>
+ 91e:	66 90                	xchg   %ax,%ax
+
+00000920 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 92c:	68 20 eb 03 00       	push   $0x3eb20
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 931:	8d 48 07             	lea    0x7(%eax),%ecx
+ 934:	c1 e9 03             	shr    $0x3,%ecx
+ 937:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 93a:	e8 b1 01 00 00       	call   af0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 93f:	8b 15 24 eb 03 00    	mov    0x3eb24,%edx
+ 945:	83 c4 10             	add    $0x10,%esp
+ 948:	85 d2                	test   %edx,%edx
+ 94a:	0f 84 b0 00 00 00    	je     a00 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 950:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 952:	8b 47 04             	mov    0x4(%edi),%eax
+ 955:	39 f0                	cmp    %esi,%eax
+ 957:	73 6f                	jae    9c8 <malloc+0xa8>
+  if(nu < 4096)
+ 959:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 95e:	39 de                	cmp    %ebx,%esi
+ 960:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 963:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 96a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 96d:	eb 0a                	jmp    979 <malloc+0x59>
+ 96f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 970:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 972:	8b 47 04             	mov    0x4(%edi),%eax
+ 975:	39 f0                	cmp    %esi,%eax
+ 977:	73 4f                	jae    9c8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 979:	89 fa                	mov    %edi,%edx
+ 97b:	39 3d 24 eb 03 00    	cmp    %edi,0x3eb24
+ 981:	75 ed                	jne    970 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	ff 75 e4             	push   -0x1c(%ebp)
+ 989:	e8 ad fb ff ff       	call   53b <sbrk>
+  if(p == (char*)-1)
+ 98e:	83 c4 10             	add    $0x10,%esp
+ 991:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 994:	74 15                	je     9ab <malloc+0x8b>
+  hp->s.size = nu;
+ 996:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 999:	83 c0 08             	add    $0x8,%eax
+ 99c:	e8 cf fe ff ff       	call   870 <ufree>
+  return freep;
+ 9a1:	8b 15 24 eb 03 00    	mov    0x3eb24,%edx
+      if((p = morecore(nunits)) == 0){
+ 9a7:	85 d2                	test   %edx,%edx
+ 9a9:	75 c5                	jne    970 <malloc+0x50>
+        lock_release(&mlock);
+ 9ab:	83 ec 0c             	sub    $0xc,%esp
+ 9ae:	68 20 eb 03 00       	push   $0x3eb20
+ 9b3:	e8 58 01 00 00       	call   b10 <lock_release>
+        return 0;
+ 9b8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 9bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9be:	31 c0                	xor    %eax,%eax
+}
+ 9c0:	5b                   	pop    %ebx
+ 9c1:	5e                   	pop    %esi
+ 9c2:	5f                   	pop    %edi
+ 9c3:	5d                   	pop    %ebp
+ 9c4:	c3                   	ret
+ 9c5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9c8:	39 c6                	cmp    %eax,%esi
+ 9ca:	74 64                	je     a30 <malloc+0x110>
+        p->s.size -= nunits;
+ 9cc:	29 f0                	sub    %esi,%eax
+ 9ce:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 9d1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 9d4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 9d7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 9da:	89 15 24 eb 03 00    	mov    %edx,0x3eb24
+      lock_release(&mlock);
+ 9e0:	68 20 eb 03 00       	push   $0x3eb20
+ 9e5:	e8 26 01 00 00       	call   b10 <lock_release>
+      return (void*)(p + 1);
+ 9ea:	83 c4 10             	add    $0x10,%esp
+}
+ 9ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9f0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ a00:	c7 05 24 eb 03 00 28 	movl   $0x3eb28,0x3eb24
+ a07:	eb 03 00 
+    base.s.size = 0;
+ a0a:	bf 28 eb 03 00       	mov    $0x3eb28,%edi
+    base.s.ptr = freep = prevp = &base;
+ a0f:	c7 05 28 eb 03 00 28 	movl   $0x3eb28,0x3eb28
+ a16:	eb 03 00 
+    base.s.size = 0;
+ a19:	c7 05 2c eb 03 00 00 	movl   $0x0,0x3eb2c
+ a20:	00 00 00 
+    if(p->s.size >= nunits){
+ a23:	e9 31 ff ff ff       	jmp    959 <malloc+0x39>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 07                	mov    (%edi),%eax
+ a32:	89 02                	mov    %eax,(%edx)
+ a34:	eb a1                	jmp    9d7 <malloc+0xb7>
+ a36:	66 90                	xchg   %ax,%ax
+ a38:	66 90                	xchg   %ax,%ax
+ a3a:	66 90                	xchg   %ax,%ax
+ a3c:	66 90                	xchg   %ax,%ax
+ a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	53                   	push   %ebx
+ a44:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ a47:	68 00 10 00 00       	push   $0x1000
+ a4c:	e8 cf fe ff ff       	call   920 <malloc>
+ a51:	83 c4 10             	add    $0x10,%esp
+ a54:	85 c0                	test   %eax,%eax
+ a56:	74 37                	je     a8f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ a58:	83 ec 04             	sub    $0x4,%esp
+ a5b:	89 c3                	mov    %eax,%ebx
+ a5d:	50                   	push   %eax
+ a5e:	ff 75 0c             	push   0xc(%ebp)
+ a61:	ff 75 08             	push   0x8(%ebp)
+ a64:	e8 0a fb ff ff       	call   573 <clone>
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 c0                	test   %eax,%eax
+ a6e:	78 08                	js     a78 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ a70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a73:	c9                   	leave
+ a74:	c3                   	ret
+ a75:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ a78:	83 ec 0c             	sub    $0xc,%esp
+ a7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a7e:	53                   	push   %ebx
+ a7f:	e8 6c fe ff ff       	call   8f0 <free>
+ a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ a8a:	83 c4 10             	add    $0x10,%esp
+}
+ a8d:	c9                   	leave
+ a8e:	c3                   	ret
+    return -1;
+ a8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a94:	eb da                	jmp    a70 <thread_create+0x30>
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000aa0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ aa6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ aa9:	50                   	push   %eax
+ aaa:	e8 cc fa ff ff       	call   57b <join>
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	85 c0                	test   %eax,%eax
+ ab4:	79 0a                	jns    ac0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ ab6:	c9                   	leave
+ ab7:	c3                   	ret
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+ ac0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	ff 75 f4             	push   -0xc(%ebp)
+ ac9:	e8 22 fe ff ff       	call   8f0 <free>
+ ace:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ad1:	83 c4 10             	add    $0x10,%esp
+}
+ ad4:	c9                   	leave
+ ad5:	c3                   	ret
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ae0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ aec:	5d                   	pop    %ebp
+ aed:	c3                   	ret
+ aee:	66 90                	xchg   %ax,%ax
+
+00000af0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ af0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ af1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ af6:	89 e5                	mov    %esp,%ebp
+ af8:	8b 55 08             	mov    0x8(%ebp),%edx
+ afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+ b00:	89 c8                	mov    %ecx,%eax
+ b02:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ b05:	85 c0                	test   %eax,%eax
+ b07:	75 f7                	jne    b00 <lock_acquire+0x10>
+    ;
+}
+ b09:	5d                   	pop    %ebp
+ b0a:	c3                   	ret
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+
+00000b10 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ b10:	55                   	push   %ebp
+ b11:	31 c0                	xor    %eax,%eax
+ b13:	89 e5                	mov    %esp,%ebp
+ b15:	8b 55 08             	mov    0x8(%ebp),%edx
+ b18:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ b1b:	5d                   	pop    %ebp
+ b1c:	c3                   	ret
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b20 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ b23:	8b 45 08             	mov    0x8(%ebp),%eax
+ b26:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b2c:	5d                   	pop    %ebp
+ b2d:	c3                   	ret
+ b2e:	66 90                	xchg   %ax,%ax
+
+00000b30 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b30:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ b31:	31 c0                	xor    %eax,%eax
+ b33:	ba 01 00 00 00       	mov    $0x1,%edx
+ b38:	89 e5                	mov    %esp,%ebp
+ b3a:	56                   	push   %esi
+ b3b:	53                   	push   %ebx
+ b3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b3f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ b43:	85 c0                	test   %eax,%eax
+ b45:	74 30                	je     b77 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ b47:	83 f8 02             	cmp    $0x2,%eax
+ b4a:	74 0c                	je     b58 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ b4c:	b8 02 00 00 00       	mov    $0x2,%eax
+ b51:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ b54:	85 c0                	test   %eax,%eax
+ b56:	74 1f                	je     b77 <mutex_lock+0x47>
+ b58:	be 02 00 00 00       	mov    $0x2,%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ b60:	83 ec 08             	sub    $0x8,%esp
+ b63:	6a 02                	push   $0x2
+ b65:	53                   	push   %ebx
+ b66:	e8 18 fa ff ff       	call   583 <futex_wait>
+ b6b:	89 f0                	mov    %esi,%eax
+ b6d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b70:	83 c4 10             	add    $0x10,%esp
+ b73:	85 c0                	test   %eax,%eax
+ b75:	75 e9                	jne    b60 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ b77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b7a:	5b                   	pop    %ebx
+ b7b:	5e                   	pop    %esi
+ b7c:	5d                   	pop    %ebp
+ b7d:	c3                   	ret
+ b7e:	66 90                	xchg   %ax,%ax
+
+00000b80 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b80:	55                   	push   %ebp
+ b81:	31 c0                	xor    %eax,%eax
+ b83:	89 e5                	mov    %esp,%ebp
+ b85:	83 ec 08             	sub    $0x8,%esp
+ b88:	8b 55 08             	mov    0x8(%ebp),%edx
+ b8b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ b8e:	83 f8 02             	cmp    $0x2,%eax
+ b91:	74 05                	je     b98 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ b93:	c9                   	leave
+ b94:	c3                   	ret
+ b95:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ b98:	83 ec 08             	sub    $0x8,%esp
+ b9b:	6a 01                	push   $0x1
+ b9d:	52                   	push   %edx
+ b9e:	e8 e8 f9 ff ff       	call   58b <futex_wake>
+ ba3:	83 c4 10             	add    $0x10,%esp
+}
+ ba6:	c9                   	leave
+ ba7:	c3                   	ret
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+
+00000bb0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ bb6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ bbc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ bc3:	5d                   	pop    %ebp
+ bc4:	c3                   	ret
+ bc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	53                   	push   %ebx
+ bd6:	83 ec 0c             	sub    $0xc,%esp
+ bd9:	8b 75 08             	mov    0x8(%ebp),%esi
+ bdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ bdf:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ be4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ be6:	8b 3e                	mov    (%esi),%edi
+ be8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ beb:	83 f8 02             	cmp    $0x2,%eax
+ bee:	74 60                	je     c50 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	e8 89 f9 ff ff       	call   583 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ bfa:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ bff:	31 c0                	xor    %eax,%eax
+ c01:	ba 01 00 00 00       	mov    $0x1,%edx
+ c06:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ c0a:	83 c4 10             	add    $0x10,%esp
+ c0d:	85 c0                	test   %eax,%eax
+ c0f:	74 36                	je     c47 <cond_wait+0x77>
+  if(c != 2)
+ c11:	83 f8 02             	cmp    $0x2,%eax
+ c14:	74 0c                	je     c22 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ c16:	b8 02 00 00 00       	mov    $0x2,%eax
+ c1b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c1e:	85 c0                	test   %eax,%eax
+ c20:	74 25                	je     c47 <cond_wait+0x77>
+ c22:	be 02 00 00 00       	mov    $0x2,%esi
+ c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ c30:	83 ec 08             	sub    $0x8,%esp
+ c33:	6a 02                	push   $0x2
+ c35:	53                   	push   %ebx
+ c36:	e8 48 f9 ff ff       	call   583 <futex_wait>
+ c3b:	89 f0                	mov    %esi,%eax
+ c3d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ c40:	83 c4 10             	add    $0x10,%esp
+ c43:	85 c0                	test   %eax,%eax
+ c45:	75 e9                	jne    c30 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c4a:	5b                   	pop    %ebx
+ c4b:	5e                   	pop    %esi
+ c4c:	5f                   	pop    %edi
+ c4d:	5d                   	pop    %ebp
+ c4e:	c3                   	ret
+ c4f:	90                   	nop
+    futex_wake(&m->val, 1);
+ c50:	83 ec 08             	sub    $0x8,%esp
+ c53:	6a 01                	push   $0x1
+ c55:	53                   	push   %ebx
+ c56:	e8 30 f9 ff ff       	call   58b <futex_wake>
+ c5b:	83 c4 10             	add    $0x10,%esp
+ c5e:	eb 90                	jmp    bf0 <cond_wait+0x20>
+
+00000c60 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	83 ec 08             	sub    $0x8,%esp
+ c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c69:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c6d:	8b 50 04             	mov    0x4(%eax),%edx
+ c70:	85 d2                	test   %edx,%edx
+ c72:	75 0c                	jne    c80 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ c74:	c9                   	leave
+ c75:	c3                   	ret
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ c80:	83 ec 08             	sub    $0x8,%esp
+ c83:	6a 01                	push   $0x1
+ c85:	50                   	push   %eax
+ c86:	e8 00 f9 ff ff       	call   58b <futex_wake>
+ c8b:	83 c4 10             	add    $0x10,%esp
+}
+ c8e:	c9                   	leave
+ c8f:	c3                   	ret
+
+00000c90 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	83 ec 08             	sub    $0x8,%esp
+ c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ c99:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ c9d:	8b 50 04             	mov    0x4(%eax),%edx
+ ca0:	85 d2                	test   %edx,%edx
+ ca2:	75 0c                	jne    cb0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ ca4:	c9                   	leave
+ ca5:	c3                   	ret
+ ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ cb0:	83 ec 08             	sub    $0x8,%esp
+ cb3:	68 ff ff ff 7f       	push   $0x7fffffff
+ cb8:	50                   	push   %eax
+ cb9:	e8 cd f8 ff ff       	call   58b <futex_wake>
+ cbe:	83 c4 10             	add    $0x10,%esp
+}
+ cc1:	c9                   	leave
+ cc2:	c3                   	ret
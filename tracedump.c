@@ -0,0 +1,100 @@
+// Trace the scheduler while a command runs, or for a number
+// of seconds, and print the events, one per line:
+//   ev sec.nsec cpu type pid arg
+// followed by the names of the processes seen:
+//   name pid name
+// tracestat.pl on the host turns this output into latency
+// histograms and a timeline.
+// usage: tracedump -s seconds | tracedump cmd [arg...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+#include "trace.h"
+#include "wait.h"
+
+#define NEV 256
+
+struct traceevent ev[NEV];
+struct procinfo pi[NPROC];
+int nevent;
+
+static char *types[] = {
+[TR_SWITCHIN]   "in",
+[TR_SWITCHOUT]  "out",
+[TR_WAKEUP]     "wakeup",
+[TR_SLEEP]      "sleep",
+[TR_MIGRATE]    "migrate",
+};
+
+// Print the events read so far, and remember the
+// names of their processes while they are still around.
+static void
+drain(void)
+{
+  struct traceevent *e;
+  char ns[10];
+  int i, n, j;
+  uint x;
+
+  while((n = traceread(ev, NEV)) > 0){
+    for(e = ev; e < ev+n; e++){
+      x = e->nsec;
+      for(j = 8; j >= 0; j--){
+        ns[j] = '0' + x % 10;
+        x /= 10;
+      }
+      ns[9] = 0;
+      printf(1, "ev %d.%s %d %s %d %d\n", e->sec, ns, e->cpu,
+             types[e->type], e->pid, e->arg);
+    }
+    nevent += n;
+  }
+  n = getprocinfo(pi, NPROC);
+  for(i = 0; i < n; i++)
+    printf(1, "name %d %s\n", pi[i].pid, pi[i].name);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid, secs;
+
+  if(argc < 2 || (strcmp(argv[1], "-s") == 0 && argc != 3)){
+    printf(2, "usage: tracedump -s seconds | tracedump cmd [arg...]\n");
+    exit();
+  }
+  if(tracectl(1) < 0){
+    printf(2, "tracedump: cannot start tracing\n");
+    exit();
+  }
+  drain();  // discard nothing, but name what is running
+
+  if(strcmp(argv[1], "-s") == 0){
+    for(secs = atoi(argv[2])*10; secs > 0; secs--){
+      sleep(10);
+      drain();
+    }
+  } else {
+    pid = fork();
+    if(pid < 0){
+      printf(2, "tracedump: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      printf(2, "tracedump: exec %s failed\n", argv[1]);
+      exit();
+    }
+    while(waitpid(pid, WNOHANG) == 0){
+      sleep(1);
+      drain();
+    }
+  }
+  tracectl(0);
+  drain();
+  printf(2, "tracedump: %d events\n", nevent);
+  exit();
+}
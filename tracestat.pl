@@ -0,0 +1,88 @@
+#!/usr/bin/perl -w
+
+# Summarize the output of tracedump, captured from the console.
+# For each process, print a histogram of run-queue latency:
+# the time from becoming runnable (woken, or preempted while
+# still runnable) to being switched in, in power-of-two
+# microsecond buckets.  With -t, also print a per-CPU timeline
+# of which process ran when.
+#
+# usage: tracestat.pl [-t] [file...]
+
+use strict;
+
+my $timeline = 0;
+if(@ARGV && $ARGV[0] eq "-t"){
+    $timeline = 1;
+    shift @ARGV;
+}
+
+my (@ev, %name, %ready, %hist, %total);
+
+while(<>){
+    s/\r//;
+    if(/^ev (\d+)\.(\d+) (\d+) (\w+) (\d+) (-?\d+)$/){
+        push @ev, [$1*1e9 + $2, $3, $4, $5, $6];
+    } elsif(/^name (\d+) (\S+)$/){
+        $name{$1} = $2;
+    }
+}
+
+# Each CPU's events arrive in order, but the CPUs are interleaved.
+@ev = sort { $a->[0] <=> $b->[0] } @ev;
+die "tracestat: no events\n" if !@ev;
+
+my %run;    # cpu -> [pid, since]
+my @spans;  # [cpu, pid, from, to]
+
+foreach my $e (@ev){
+    my ($t, $cpu, $type, $pid, $arg) = @$e;
+    if($type eq "wakeup"){
+        $ready{$pid} = $t if !defined $ready{$pid};
+    } elsif($type eq "out"){
+        # arg 2 is TS_RUNNABLE: preempted or yielded.
+        $ready{$pid} = $t if $arg == 2;
+        if(defined $run{$cpu}){
+            push @spans, [$cpu, $pid, $run{$cpu}[1], $t];
+            delete $run{$cpu};
+        }
+    } elsif($type eq "in"){
+        if(defined $ready{$pid}){
+            my $us = ($t - $ready{$pid}) / 1000;
+            my $b = 0;
+            $b++ while (1 << $b) <= $us;
+            $hist{$pid}[$b]++;
+            $total{$pid}++;
+            delete $ready{$pid};
+        }
+        $run{$cpu} = [$pid, $t];
+    }
+}
+
+sub name {
+    my ($pid) = @_;
+    return defined $name{$pid} ? "$name{$pid}/$pid" : "$pid";
+}
+
+foreach my $pid (sort { $a <=> $b } keys %hist){
+    printf "%s: %d switch-ins\n", name($pid), $total{$pid};
+    printf "  %10s  %8s\n", "usecs", "count";
+    my $h = $hist{$pid};
+    for(my $b = 0; $b < @$h; $b++){
+        my $n = $h->[$b] || 0;
+        my $lo = $b ? 1 << ($b-1) : 0;
+        my $hi = (1 << $b) - 1;
+        printf "  %4d..%-5d %8d |%s\n", $lo, $hi, $n,
+            "*" x int(40 * $n / $total{$pid} + 0.5);
+    }
+    print "\n";
+}
+
+if($timeline){
+    my $t0 = $ev[0][0];
+    print "cpu  start(us)    end(us)  process\n";
+    foreach my $s (sort { $a->[0] <=> $b->[0] || $a->[2] <=> $b->[2] } @spans){
+        printf "%3d %10d %10d  %s\n", $s->[0],
+            ($s->[2] - $t0) / 1000, ($s->[3] - $t0) / 1000, name($s->[1]);
+    }
+}
@@ -3,16 +3,15 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
+#include "pstat.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
-struct spinlock tickslock;
-uint ticks;
 
 void
 tvinit(void)
@@ -22,8 +21,6 @@ tvinit(void)
   for(i = 0; i < 256; i++)
     SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
-
-  initlock(&tickslock, "time");
 }
 
 void
@@ -36,24 +33,43 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  if(proc && (tf->cs&3) == DPL_USER)
+    acct(1);
+
   if(tf->trapno == T_SYSCALL){
     if(proc->killed)
       exit();
     proc->tf = tf;
+    cpustatinc(CS_SYSCALL);
     syscall();
     if(proc->killed)
       exit();
+    acct(0);
     return;
   }
 
+  if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + NIRQ){
+    cpu->nirq[tf->trapno - T_IRQ0]++;
+    cpustatinc(CS_INTR);
+  }
+
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpunum() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    if((tf->cs&3) == DPL_USER)
+      rcuquiescent();
+    clockintr();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLBFLUSH:
+    lcr3(rcr3());
+    cpu->tlbflush = 0;
+    cpustatinc(CS_TLBFLUSH);
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // wakecpu() kicked us out of idle(), and the scheduler
+    // will find the new work; or edfpreempt() wants us to
+    // yield, below.
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -91,6 +107,8 @@ trap(struct trapframe *tf)
             "eip 0x%x addr 0x%x--kill proc\n",
             proc->pid, proc->name, tf->trapno, tf->err, cpunum(), tf->eip,
             rcr2());
+    if(tf->trapno == T_PGFLT)
+      proc->nfault++;
     proc->killed = 1;
   }
 
@@ -100,12 +118,22 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, or when
+  // edfpreempt() wants the CPU for a real-time process.
+  // A real-time process that has used up its runtime
+  // sleeps until its next period instead, once it is
+  // back in user space and holds no locks.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
-    yield();
+  if(proc && proc->state == RUNNING &&
+     (tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED)){
+    if(proc->dlruntime == 0 || (tf->cs&3) != DPL_USER || !edfthrottle())
+      yield();
+  }
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
+
+  if(proc && (tf->cs&3) == DPL_USER)
+    acct(0);
 }
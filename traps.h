@@ -34,5 +34,9 @@
 #define IRQ_COM1         4
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_RESCHED     20      // IPI: wake an idle CPU or preempt
+#define IRQ_TLBFLUSH    21      // IPI: flush the TLB
 #define IRQ_SPURIOUS    31
 
+#define IRQ_ANYCPU      -1      // ioapicenable: let the kernel choose
+
@@ -42,7 +42,7 @@ uartinit(void)
   inb(COM1+2);
   inb(COM1+0);
   picenable(IRQ_COM1);
-  ioapicenable(IRQ_COM1, 0);
+  ioapicenable(IRQ_COM1, IRQ_ANYCPU);
 
   // Announce that we're here.
   for(p="xv6...\n"; *p; p++)
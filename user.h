@@ -1,10 +1,19 @@
 struct stat;
+struct bootphase;
+struct cpustat;
+struct dlstat;
+struct irqinfo;
+struct lockstat;
+struct procinfo;
 struct rtcdate;
+struct timespec;
+struct traceevent;
 
 // system calls
 int fork(void);
 int exit(void) __attribute__((noreturn));
 int wait(void);
+int waitpid(int, int);
 int pipe(int*);
 int write(int, void*, int);
 int read(int, void*, int);
@@ -24,6 +33,28 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int add_dir( char * );
+int clock_gettime(int, struct timespec*);
+int nanosleep(struct timespec*);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex_wait(uint*, uint);
+int futex_wake(uint*, int);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int, uint*);
+int sched_isolate(uint);
+int getprocinfo(struct procinfo*, int);
+int tracectl(int);
+int traceread(struct traceevent*, int);
+int sched_setdeadline(int, int, int, int);
+int sched_dlyield(void);
+int sched_dlstat(int, struct dlstat*);
+int irqroute(int, int);
+int irqstat(struct irqinfo*, int);
+int boottimes(struct bootphase*, int);
+int lockbench(int, int);
+int lockstat(struct lockstat*, int);
+int cpustat(struct cpustat*, int);
+int bcachesize(int);
 
 int add_directory(char *);
 int history(char * buffer, int historyId);
@@ -41,3 +72,30 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+
+// uthread.c
+struct lock {
+  uint locked;
+};
+
+struct mutex {
+  uint val;     // 0 unlocked, 1 locked, 2 locked with waiters
+};
+
+struct cond {
+  uint seq;     // bumped by each signal
+  uint nwait;   // threads in cond_wait
+};
+
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
+void lock_init(struct lock*);
+void lock_acquire(struct lock*);
+void lock_release(struct lock*);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
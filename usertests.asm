@@ -0,0 +1,9670 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 5c 6e 00 00       	push   $0x6e5c
+      16:	6a 01                	push   $0x1
+      18:	e8 23 53 00 00       	call   5340 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 70 6e 00 00       	push   $0x6e70
+      26:	e8 48 51 00 00       	call   5173 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 10 79 00 00       	push   $0x7910
+      39:	6a 01                	push   $0x1
+      3b:	e8 00 53 00 00       	call   5340 <printf>
+    exit();
+      40:	e8 ee 50 00 00       	call   5133 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 70 6e 00 00       	push   $0x6e70
+      51:	e8 1d 51 00 00       	call   5173 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 fd 50 00 00       	call   515b <close>
+
+  argptest();
+      5e:	e8 fd 4d 00 00       	call   4e60 <argptest>
+  createdelete();
+      63:	e8 48 2a 00 00       	call   2ab0 <createdelete>
+  linkunlink();
+      68:	e8 e3 32 00 00       	call   3350 <linkunlink>
+  concreate();
+      6d:	e8 de 2f 00 00       	call   3050 <concreate>
+  fourfiles();
+      72:	e8 39 28 00 00       	call   28b0 <fourfiles>
+  sharedfd();
+      77:	e8 74 26 00 00       	call   26f0 <sharedfd>
+
+  bigargtest();
+      7c:	e8 9f 4a 00 00       	call   4b20 <bigargtest>
+  bigwrite();
+      81:	e8 ea 3b 00 00       	call   3c70 <bigwrite>
+  bigargtest();
+      86:	e8 95 4a 00 00       	call   4b20 <bigargtest>
+  bsstest();
+      8b:	e8 20 4a 00 00       	call   4ab0 <bsstest>
+  sbrktest();
+      90:	e8 1b 45 00 00       	call   45b0 <sbrktest>
+  validatetest();
+      95:	e8 66 49 00 00       	call   4a00 <validatetest>
+
+  opentest();
+      9a:	e8 a1 04 00 00       	call   540 <opentest>
+  writetest();
+      9f:	e8 2c 05 00 00       	call   5d0 <writetest>
+  writetest1();
+      a4:	e8 07 07 00 00       	call   7b0 <writetest1>
+  createtest();
+      a9:	e8 d2 08 00 00       	call   980 <createtest>
+
+  openiputtest();
+      ae:	e8 8d 03 00 00       	call   440 <openiputtest>
+  exitiputtest();
+      b3:	e8 88 02 00 00       	call   340 <exitiputtest>
+  iputtest();
+      b8:	e8 a3 01 00 00       	call   260 <iputtest>
+
+  mem();
+      bd:	e8 5e 25 00 00       	call   2620 <mem>
+  pipe1();
+      c2:	e8 99 0a 00 00       	call   b60 <pipe1>
+  preempt();
+      c7:	e8 34 0c 00 00       	call   d00 <preempt>
+  exitwait();
+      cc:	e8 8f 0d 00 00       	call   e60 <exitwait>
+  clocktest();
+      d1:	e8 0a 0e 00 00       	call   ee0 <clocktest>
+  threadtest();
+      d6:	e8 e5 0e 00 00       	call   fc0 <threadtest>
+  futextest();
+      db:	e8 c0 0f 00 00       	call   10a0 <futextest>
+  affinitytest();
+      e0:	e8 ab 10 00 00       	call   1190 <affinitytest>
+  accttest();
+      e5:	e8 f6 12 00 00       	call   13e0 <accttest>
+  waitpidtest();
+      ea:	e8 e1 13 00 00       	call   14d0 <waitpidtest>
+  parforktest();
+      ef:	e8 1c 15 00 00       	call   1610 <parforktest>
+  tracetest();
+      f4:	e8 e7 15 00 00       	call   16e0 <tracetest>
+  edftest();
+      f9:	e8 32 17 00 00       	call   1830 <edftest>
+  irqtest();
+      fe:	e8 fd 19 00 00       	call   1b00 <irqtest>
+  locktest();
+     103:	e8 88 1b 00 00       	call   1c90 <locktest>
+  lockstattest();
+     108:	e8 93 1c 00 00       	call   1da0 <lockstattest>
+  icachetest();
+     10d:	e8 ce 1d 00 00       	call   1ee0 <icachetest>
+  cpustattest();
+     112:	e8 e9 1e 00 00       	call   2000 <cpustattest>
+  bcachetest();
+     117:	e8 a4 1f 00 00       	call   20c0 <bcachetest>
+  readaheadtest();
+     11c:	e8 0f 22 00 00       	call   2330 <readaheadtest>
+
+  rmdot();
+     121:	e8 3a 3f 00 00       	call   4060 <rmdot>
+  fourteen();
+     126:	e8 f5 3d 00 00       	call   3f20 <fourteen>
+  bigfile();
+     12b:	e8 20 3c 00 00       	call   3d50 <bigfile>
+  subdir();
+     130:	e8 5b 34 00 00       	call   3590 <subdir>
+  linktest();
+     135:	e8 06 2d 00 00       	call   2e40 <linktest>
+  unlinkread();
+     13a:	e8 71 2b 00 00       	call   2cb0 <unlinkread>
+  dirfile();
+     13f:	e8 9c 40 00 00       	call   41e0 <dirfile>
+  iref();
+     144:	e8 97 42 00 00       	call   43e0 <iref>
+  forktest();
+     149:	e8 b2 43 00 00       	call   4500 <forktest>
+  bigdir(); // slow
+     14e:	e8 0d 33 00 00       	call   3460 <bigdir>
+
+  uio();
+     153:	e8 98 4c 00 00       	call   4df0 <uio>
+
+  exectest();
+     158:	e8 b3 09 00 00       	call   b10 <exectest>
+
+  exit();
+     15d:	e8 d1 4f 00 00       	call   5133 <exit>
+     162:	66 90                	xchg   %ax,%ax
+     164:	66 90                	xchg   %ax,%ax
+     166:	66 90                	xchg   %ax,%ax
+     168:	66 90                	xchg   %ax,%ax
+     16a:	66 90                	xchg   %ax,%ax
+     16c:	66 90                	xchg   %ax,%ax
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <threadinc>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	56                   	push   %esi
+     174:	53                   	push   %ebx
+     175:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < (int)arg; i++){
+     178:	85 f6                	test   %esi,%esi
+     17a:	7e 2e                	jle    1aa <threadinc+0x3a>
+     17c:	31 db                	xor    %ebx,%ebx
+     17e:	66 90                	xchg   %ax,%ax
+    lock_acquire(&tlock);
+     180:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < (int)arg; i++){
+     183:	83 c3 01             	add    $0x1,%ebx
+    lock_acquire(&tlock);
+     186:	68 f4 6e 04 00       	push   $0x46ef4
+     18b:	e8 e0 55 00 00       	call   5770 <lock_acquire>
+    lock_release(&tlock);
+     190:	c7 04 24 f4 6e 04 00 	movl   $0x46ef4,(%esp)
+    tcount++;
+     197:	83 05 f0 6e 04 00 01 	addl   $0x1,0x46ef0
+    lock_release(&tlock);
+     19e:	e8 ed 55 00 00       	call   5790 <lock_release>
+  for(i = 0; i < (int)arg; i++){
+     1a3:	83 c4 10             	add    $0x10,%esp
+     1a6:	39 f3                	cmp    %esi,%ebx
+     1a8:	75 d6                	jne    180 <threadinc+0x10>
+  exit();
+     1aa:	e8 84 4f 00 00       	call   5133 <exit>
+     1af:	90                   	nop
+
+000001b0 <futexworker>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	56                   	push   %esi
+  me = (int)arg;
+     1b4:	be 64 00 00 00       	mov    $0x64,%esi
+{
+     1b9:	53                   	push   %ebx
+     1ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i = 0; i < 100; i++){
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    mutex_lock(&fmutex);
+     1c0:	83 ec 0c             	sub    $0xc,%esp
+     1c3:	68 ec 6e 04 00       	push   $0x46eec
+     1c8:	e8 e3 55 00 00       	call   57b0 <mutex_lock>
+    while(fturn % 4 != me)
+     1cd:	8b 0d e0 6e 04 00    	mov    0x46ee0,%ecx
+     1d3:	83 c4 10             	add    $0x10,%esp
+     1d6:	89 ca                	mov    %ecx,%edx
+     1d8:	c1 fa 1f             	sar    $0x1f,%edx
+     1db:	c1 ea 1e             	shr    $0x1e,%edx
+     1de:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+     1e1:	83 e0 03             	and    $0x3,%eax
+     1e4:	29 d0                	sub    %edx,%eax
+     1e6:	39 c3                	cmp    %eax,%ebx
+     1e8:	74 35                	je     21f <futexworker+0x6f>
+     1ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      cond_wait(&fcond, &fmutex);
+     1f0:	83 ec 08             	sub    $0x8,%esp
+     1f3:	68 ec 6e 04 00       	push   $0x46eec
+     1f8:	68 e4 6e 04 00       	push   $0x46ee4
+     1fd:	e8 4e 56 00 00       	call   5850 <cond_wait>
+    while(fturn % 4 != me)
+     202:	8b 0d e0 6e 04 00    	mov    0x46ee0,%ecx
+     208:	83 c4 10             	add    $0x10,%esp
+     20b:	89 ca                	mov    %ecx,%edx
+     20d:	c1 fa 1f             	sar    $0x1f,%edx
+     210:	c1 ea 1e             	shr    $0x1e,%edx
+     213:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+     216:	83 e0 03             	and    $0x3,%eax
+     219:	29 d0                	sub    %edx,%eax
+     21b:	39 d8                	cmp    %ebx,%eax
+     21d:	75 d1                	jne    1f0 <futexworker+0x40>
+    cond_broadcast(&fcond);
+     21f:	83 ec 0c             	sub    $0xc,%esp
+    fturn++;
+     222:	83 c1 01             	add    $0x1,%ecx
+    cond_broadcast(&fcond);
+     225:	68 e4 6e 04 00       	push   $0x46ee4
+    fturn++;
+     22a:	89 0d e0 6e 04 00    	mov    %ecx,0x46ee0
+    cond_broadcast(&fcond);
+     230:	e8 db 56 00 00       	call   5910 <cond_broadcast>
+    mutex_unlock(&fmutex);
+     235:	c7 04 24 ec 6e 04 00 	movl   $0x46eec,(%esp)
+     23c:	e8 bf 55 00 00       	call   5800 <mutex_unlock>
+  for(i = 0; i < 100; i++){
+     241:	83 c4 10             	add    $0x10,%esp
+     244:	83 ee 01             	sub    $0x1,%esi
+     247:	0f 85 73 ff ff ff    	jne    1c0 <futexworker+0x10>
+  exit();
+     24d:	e8 e1 4e 00 00       	call   5133 <exit>
+     252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <iputtest>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     266:	68 d8 59 00 00       	push   $0x59d8
+     26b:	ff 35 a8 87 00 00    	push   0x87a8
+     271:	e8 ca 50 00 00       	call   5340 <printf>
+  if(mkdir("iputdir") < 0){
+     276:	c7 04 24 6b 59 00 00 	movl   $0x596b,(%esp)
+     27d:	e8 19 4f 00 00       	call   519b <mkdir>
+     282:	83 c4 10             	add    $0x10,%esp
+     285:	85 c0                	test   %eax,%eax
+     287:	78 58                	js     2e1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     289:	83 ec 0c             	sub    $0xc,%esp
+     28c:	68 6b 59 00 00       	push   $0x596b
+     291:	e8 0d 4f 00 00       	call   51a3 <chdir>
+     296:	83 c4 10             	add    $0x10,%esp
+     299:	85 c0                	test   %eax,%eax
+     29b:	0f 88 85 00 00 00    	js     326 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     2a1:	83 ec 0c             	sub    $0xc,%esp
+     2a4:	68 68 59 00 00       	push   $0x5968
+     2a9:	e8 d5 4e 00 00       	call   5183 <unlink>
+     2ae:	83 c4 10             	add    $0x10,%esp
+     2b1:	85 c0                	test   %eax,%eax
+     2b3:	78 5a                	js     30f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     2b5:	83 ec 0c             	sub    $0xc,%esp
+     2b8:	68 8d 59 00 00       	push   $0x598d
+     2bd:	e8 e1 4e 00 00       	call   51a3 <chdir>
+     2c2:	83 c4 10             	add    $0x10,%esp
+     2c5:	85 c0                	test   %eax,%eax
+     2c7:	78 2f                	js     2f8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     2c9:	83 ec 08             	sub    $0x8,%esp
+     2cc:	68 10 5a 00 00       	push   $0x5a10
+     2d1:	ff 35 a8 87 00 00    	push   0x87a8
+     2d7:	e8 64 50 00 00       	call   5340 <printf>
+}
+     2dc:	83 c4 10             	add    $0x10,%esp
+     2df:	c9                   	leave
+     2e0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     2e1:	50                   	push   %eax
+     2e2:	50                   	push   %eax
+     2e3:	68 44 59 00 00       	push   $0x5944
+     2e8:	ff 35 a8 87 00 00    	push   0x87a8
+     2ee:	e8 4d 50 00 00       	call   5340 <printf>
+    exit();
+     2f3:	e8 3b 4e 00 00       	call   5133 <exit>
+    printf(stdout, "chdir / failed\n");
+     2f8:	50                   	push   %eax
+     2f9:	50                   	push   %eax
+     2fa:	68 8f 59 00 00       	push   $0x598f
+     2ff:	ff 35 a8 87 00 00    	push   0x87a8
+     305:	e8 36 50 00 00       	call   5340 <printf>
+    exit();
+     30a:	e8 24 4e 00 00       	call   5133 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     30f:	52                   	push   %edx
+     310:	52                   	push   %edx
+     311:	68 73 59 00 00       	push   $0x5973
+     316:	ff 35 a8 87 00 00    	push   0x87a8
+     31c:	e8 1f 50 00 00       	call   5340 <printf>
+    exit();
+     321:	e8 0d 4e 00 00       	call   5133 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     326:	51                   	push   %ecx
+     327:	51                   	push   %ecx
+     328:	68 52 59 00 00       	push   $0x5952
+     32d:	ff 35 a8 87 00 00    	push   0x87a8
+     333:	e8 08 50 00 00       	call   5340 <printf>
+    exit();
+     338:	e8 f6 4d 00 00       	call   5133 <exit>
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <exitiputtest>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     346:	68 9f 59 00 00       	push   $0x599f
+     34b:	ff 35 a8 87 00 00    	push   0x87a8
+     351:	e8 ea 4f 00 00       	call   5340 <printf>
+  pid = fork();
+     356:	e8 d0 4d 00 00       	call   512b <fork>
+  if(pid < 0){
+     35b:	83 c4 10             	add    $0x10,%esp
+     35e:	85 c0                	test   %eax,%eax
+     360:	0f 88 8a 00 00 00    	js     3f0 <exitiputtest+0xb0>
+  if(pid == 0){
+     366:	75 50                	jne    3b8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     368:	83 ec 0c             	sub    $0xc,%esp
+     36b:	68 6b 59 00 00       	push   $0x596b
+     370:	e8 26 4e 00 00       	call   519b <mkdir>
+     375:	83 c4 10             	add    $0x10,%esp
+     378:	85 c0                	test   %eax,%eax
+     37a:	0f 88 87 00 00 00    	js     407 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	68 6b 59 00 00       	push   $0x596b
+     388:	e8 16 4e 00 00       	call   51a3 <chdir>
+     38d:	83 c4 10             	add    $0x10,%esp
+     390:	85 c0                	test   %eax,%eax
+     392:	0f 88 86 00 00 00    	js     41e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     398:	83 ec 0c             	sub    $0xc,%esp
+     39b:	68 68 59 00 00       	push   $0x5968
+     3a0:	e8 de 4d 00 00       	call   5183 <unlink>
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	85 c0                	test   %eax,%eax
+     3aa:	78 2c                	js     3d8 <exitiputtest+0x98>
+    exit();
+     3ac:	e8 82 4d 00 00       	call   5133 <exit>
+     3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     3b8:	e8 7e 4d 00 00       	call   513b <wait>
+  printf(stdout, "exitiput test ok\n");
+     3bd:	83 ec 08             	sub    $0x8,%esp
+     3c0:	68 c2 59 00 00       	push   $0x59c2
+     3c5:	ff 35 a8 87 00 00    	push   0x87a8
+     3cb:	e8 70 4f 00 00       	call   5340 <printf>
+}
+     3d0:	83 c4 10             	add    $0x10,%esp
+     3d3:	c9                   	leave
+     3d4:	c3                   	ret
+     3d5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     3d8:	83 ec 08             	sub    $0x8,%esp
+     3db:	68 73 59 00 00       	push   $0x5973
+     3e0:	ff 35 a8 87 00 00    	push   0x87a8
+     3e6:	e8 55 4f 00 00       	call   5340 <printf>
+      exit();
+     3eb:	e8 43 4d 00 00       	call   5133 <exit>
+    printf(stdout, "fork failed\n");
+     3f0:	51                   	push   %ecx
+     3f1:	51                   	push   %ecx
+     3f2:	68 af 6d 00 00       	push   $0x6daf
+     3f7:	ff 35 a8 87 00 00    	push   0x87a8
+     3fd:	e8 3e 4f 00 00       	call   5340 <printf>
+    exit();
+     402:	e8 2c 4d 00 00       	call   5133 <exit>
+      printf(stdout, "mkdir failed\n");
+     407:	52                   	push   %edx
+     408:	52                   	push   %edx
+     409:	68 44 59 00 00       	push   $0x5944
+     40e:	ff 35 a8 87 00 00    	push   0x87a8
+     414:	e8 27 4f 00 00       	call   5340 <printf>
+      exit();
+     419:	e8 15 4d 00 00       	call   5133 <exit>
+      printf(stdout, "child chdir failed\n");
+     41e:	50                   	push   %eax
+     41f:	50                   	push   %eax
+     420:	68 ae 59 00 00       	push   $0x59ae
+     425:	ff 35 a8 87 00 00    	push   0x87a8
+     42b:	e8 10 4f 00 00       	call   5340 <printf>
+      exit();
+     430:	e8 fe 4c 00 00       	call   5133 <exit>
+     435:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <openiputtest>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     446:	68 d4 59 00 00       	push   $0x59d4
+     44b:	ff 35 a8 87 00 00    	push   0x87a8
+     451:	e8 ea 4e 00 00       	call   5340 <printf>
+  if(mkdir("oidir") < 0){
+     456:	c7 04 24 e3 59 00 00 	movl   $0x59e3,(%esp)
+     45d:	e8 39 4d 00 00       	call   519b <mkdir>
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	0f 88 9f 00 00 00    	js     50c <openiputtest+0xcc>
+  pid = fork();
+     46d:	e8 b9 4c 00 00       	call   512b <fork>
+  if(pid < 0){
+     472:	85 c0                	test   %eax,%eax
+     474:	78 7f                	js     4f5 <openiputtest+0xb5>
+  if(pid == 0){
+     476:	75 38                	jne    4b0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     478:	83 ec 08             	sub    $0x8,%esp
+     47b:	6a 02                	push   $0x2
+     47d:	68 e3 59 00 00       	push   $0x59e3
+     482:	e8 ec 4c 00 00       	call   5173 <open>
+    if(fd >= 0){
+     487:	83 c4 10             	add    $0x10,%esp
+     48a:	85 c0                	test   %eax,%eax
+     48c:	78 62                	js     4f0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     48e:	83 ec 08             	sub    $0x8,%esp
+     491:	68 90 6e 00 00       	push   $0x6e90
+     496:	ff 35 a8 87 00 00    	push   0x87a8
+     49c:	e8 9f 4e 00 00       	call   5340 <printf>
+      exit();
+     4a1:	e8 8d 4c 00 00       	call   5133 <exit>
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     4b0:	83 ec 0c             	sub    $0xc,%esp
+     4b3:	6a 01                	push   $0x1
+     4b5:	e8 09 4d 00 00       	call   51c3 <sleep>
+  if(unlink("oidir") != 0){
+     4ba:	c7 04 24 e3 59 00 00 	movl   $0x59e3,(%esp)
+     4c1:	e8 bd 4c 00 00       	call   5183 <unlink>
+     4c6:	83 c4 10             	add    $0x10,%esp
+     4c9:	85 c0                	test   %eax,%eax
+     4cb:	75 56                	jne    523 <openiputtest+0xe3>
+  wait();
+     4cd:	e8 69 4c 00 00       	call   513b <wait>
+  printf(stdout, "openiput test ok\n");
+     4d2:	83 ec 08             	sub    $0x8,%esp
+     4d5:	68 0c 5a 00 00       	push   $0x5a0c
+     4da:	ff 35 a8 87 00 00    	push   0x87a8
+     4e0:	e8 5b 4e 00 00       	call   5340 <printf>
+}
+     4e5:	83 c4 10             	add    $0x10,%esp
+     4e8:	c9                   	leave
+     4e9:	c3                   	ret
+     4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     4f0:	e8 3e 4c 00 00       	call   5133 <exit>
+    printf(stdout, "fork failed\n");
+     4f5:	52                   	push   %edx
+     4f6:	52                   	push   %edx
+     4f7:	68 af 6d 00 00       	push   $0x6daf
+     4fc:	ff 35 a8 87 00 00    	push   0x87a8
+     502:	e8 39 4e 00 00       	call   5340 <printf>
+    exit();
+     507:	e8 27 4c 00 00       	call   5133 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     50c:	51                   	push   %ecx
+     50d:	51                   	push   %ecx
+     50e:	68 e9 59 00 00       	push   $0x59e9
+     513:	ff 35 a8 87 00 00    	push   0x87a8
+     519:	e8 22 4e 00 00       	call   5340 <printf>
+    exit();
+     51e:	e8 10 4c 00 00       	call   5133 <exit>
+    printf(stdout, "unlink failed\n");
+     523:	50                   	push   %eax
+     524:	50                   	push   %eax
+     525:	68 fd 59 00 00       	push   $0x59fd
+     52a:	ff 35 a8 87 00 00    	push   0x87a8
+     530:	e8 0b 4e 00 00       	call   5340 <printf>
+    exit();
+     535:	e8 f9 4b 00 00       	call   5133 <exit>
+     53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <opentest>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     546:	68 1e 5a 00 00       	push   $0x5a1e
+     54b:	ff 35 a8 87 00 00    	push   0x87a8
+     551:	e8 ea 4d 00 00       	call   5340 <printf>
+  fd = open("echo", 0);
+     556:	58                   	pop    %eax
+     557:	5a                   	pop    %edx
+     558:	6a 00                	push   $0x0
+     55a:	68 29 5a 00 00       	push   $0x5a29
+     55f:	e8 0f 4c 00 00       	call   5173 <open>
+  if(fd < 0){
+     564:	83 c4 10             	add    $0x10,%esp
+     567:	85 c0                	test   %eax,%eax
+     569:	78 36                	js     5a1 <opentest+0x61>
+  close(fd);
+     56b:	83 ec 0c             	sub    $0xc,%esp
+     56e:	50                   	push   %eax
+     56f:	e8 e7 4b 00 00       	call   515b <close>
+  fd = open("doesnotexist", 0);
+     574:	5a                   	pop    %edx
+     575:	59                   	pop    %ecx
+     576:	6a 00                	push   $0x0
+     578:	68 41 5a 00 00       	push   $0x5a41
+     57d:	e8 f1 4b 00 00       	call   5173 <open>
+  if(fd >= 0){
+     582:	83 c4 10             	add    $0x10,%esp
+     585:	85 c0                	test   %eax,%eax
+     587:	79 2f                	jns    5b8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     589:	83 ec 08             	sub    $0x8,%esp
+     58c:	68 6c 5a 00 00       	push   $0x5a6c
+     591:	ff 35 a8 87 00 00    	push   0x87a8
+     597:	e8 a4 4d 00 00       	call   5340 <printf>
+}
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	c9                   	leave
+     5a0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     5a1:	50                   	push   %eax
+     5a2:	50                   	push   %eax
+     5a3:	68 2e 5a 00 00       	push   $0x5a2e
+     5a8:	ff 35 a8 87 00 00    	push   0x87a8
+     5ae:	e8 8d 4d 00 00       	call   5340 <printf>
+    exit();
+     5b3:	e8 7b 4b 00 00       	call   5133 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     5b8:	50                   	push   %eax
+     5b9:	50                   	push   %eax
+     5ba:	68 4e 5a 00 00       	push   $0x5a4e
+     5bf:	ff 35 a8 87 00 00    	push   0x87a8
+     5c5:	e8 76 4d 00 00       	call   5340 <printf>
+    exit();
+     5ca:	e8 64 4b 00 00       	call   5133 <exit>
+     5cf:	90                   	nop
+
+000005d0 <writetest>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	56                   	push   %esi
+     5d4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     5d5:	83 ec 08             	sub    $0x8,%esp
+     5d8:	68 7a 5a 00 00       	push   $0x5a7a
+     5dd:	ff 35 a8 87 00 00    	push   0x87a8
+     5e3:	e8 58 4d 00 00       	call   5340 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     5e8:	58                   	pop    %eax
+     5e9:	5a                   	pop    %edx
+     5ea:	68 02 02 00 00       	push   $0x202
+     5ef:	68 8b 5a 00 00       	push   $0x5a8b
+     5f4:	e8 7a 4b 00 00       	call   5173 <open>
+  if(fd >= 0){
+     5f9:	83 c4 10             	add    $0x10,%esp
+     5fc:	85 c0                	test   %eax,%eax
+     5fe:	0f 88 88 01 00 00    	js     78c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     604:	83 ec 08             	sub    $0x8,%esp
+     607:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     609:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     60b:	68 91 5a 00 00       	push   $0x5a91
+     610:	ff 35 a8 87 00 00    	push   0x87a8
+     616:	e8 25 4d 00 00       	call   5340 <printf>
+     61b:	83 c4 10             	add    $0x10,%esp
+     61e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     620:	83 ec 04             	sub    $0x4,%esp
+     623:	6a 0a                	push   $0xa
+     625:	68 c8 5a 00 00       	push   $0x5ac8
+     62a:	56                   	push   %esi
+     62b:	e8 23 4b 00 00       	call   5153 <write>
+     630:	83 c4 10             	add    $0x10,%esp
+     633:	83 f8 0a             	cmp    $0xa,%eax
+     636:	0f 85 d9 00 00 00    	jne    715 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     63c:	83 ec 04             	sub    $0x4,%esp
+     63f:	6a 0a                	push   $0xa
+     641:	68 d3 5a 00 00       	push   $0x5ad3
+     646:	56                   	push   %esi
+     647:	e8 07 4b 00 00       	call   5153 <write>
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	83 f8 0a             	cmp    $0xa,%eax
+     652:	0f 85 d6 00 00 00    	jne    72e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     658:	83 c3 01             	add    $0x1,%ebx
+     65b:	83 fb 64             	cmp    $0x64,%ebx
+     65e:	75 c0                	jne    620 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     660:	83 ec 08             	sub    $0x8,%esp
+     663:	68 de 5a 00 00       	push   $0x5ade
+     668:	ff 35 a8 87 00 00    	push   0x87a8
+     66e:	e8 cd 4c 00 00       	call   5340 <printf>
+  close(fd);
+     673:	89 34 24             	mov    %esi,(%esp)
+     676:	e8 e0 4a 00 00       	call   515b <close>
+  fd = open("small", O_RDONLY);
+     67b:	5b                   	pop    %ebx
+     67c:	5e                   	pop    %esi
+     67d:	6a 00                	push   $0x0
+     67f:	68 8b 5a 00 00       	push   $0x5a8b
+     684:	e8 ea 4a 00 00       	call   5173 <open>
+  if(fd >= 0){
+     689:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     68c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     68e:	85 c0                	test   %eax,%eax
+     690:	0f 88 b1 00 00 00    	js     747 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     696:	83 ec 08             	sub    $0x8,%esp
+     699:	68 e9 5a 00 00       	push   $0x5ae9
+     69e:	ff 35 a8 87 00 00    	push   0x87a8
+     6a4:	e8 97 4c 00 00       	call   5340 <printf>
+  i = read(fd, buf, 2000);
+     6a9:	83 c4 0c             	add    $0xc,%esp
+     6ac:	68 d0 07 00 00       	push   $0x7d0
+     6b1:	68 00 6f 04 00       	push   $0x46f00
+     6b6:	53                   	push   %ebx
+     6b7:	e8 8f 4a 00 00       	call   514b <read>
+  if(i == 2000){
+     6bc:	83 c4 10             	add    $0x10,%esp
+     6bf:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     6c4:	0f 85 94 00 00 00    	jne    75e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     6ca:	83 ec 08             	sub    $0x8,%esp
+     6cd:	68 1d 5b 00 00       	push   $0x5b1d
+     6d2:	ff 35 a8 87 00 00    	push   0x87a8
+     6d8:	e8 63 4c 00 00       	call   5340 <printf>
+  close(fd);
+     6dd:	89 1c 24             	mov    %ebx,(%esp)
+     6e0:	e8 76 4a 00 00       	call   515b <close>
+  if(unlink("small") < 0){
+     6e5:	c7 04 24 8b 5a 00 00 	movl   $0x5a8b,(%esp)
+     6ec:	e8 92 4a 00 00       	call   5183 <unlink>
+     6f1:	83 c4 10             	add    $0x10,%esp
+     6f4:	85 c0                	test   %eax,%eax
+     6f6:	78 7d                	js     775 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     6f8:	83 ec 08             	sub    $0x8,%esp
+     6fb:	68 45 5b 00 00       	push   $0x5b45
+     700:	ff 35 a8 87 00 00    	push   0x87a8
+     706:	e8 35 4c 00 00       	call   5340 <printf>
+}
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     711:	5b                   	pop    %ebx
+     712:	5e                   	pop    %esi
+     713:	5d                   	pop    %ebp
+     714:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     715:	83 ec 04             	sub    $0x4,%esp
+     718:	53                   	push   %ebx
+     719:	68 b4 6e 00 00       	push   $0x6eb4
+     71e:	ff 35 a8 87 00 00    	push   0x87a8
+     724:	e8 17 4c 00 00       	call   5340 <printf>
+      exit();
+     729:	e8 05 4a 00 00       	call   5133 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     72e:	83 ec 04             	sub    $0x4,%esp
+     731:	53                   	push   %ebx
+     732:	68 d8 6e 00 00       	push   $0x6ed8
+     737:	ff 35 a8 87 00 00    	push   0x87a8
+     73d:	e8 fe 4b 00 00       	call   5340 <printf>
+      exit();
+     742:	e8 ec 49 00 00       	call   5133 <exit>
+    printf(stdout, "error: open small failed!\n");
+     747:	51                   	push   %ecx
+     748:	51                   	push   %ecx
+     749:	68 02 5b 00 00       	push   $0x5b02
+     74e:	ff 35 a8 87 00 00    	push   0x87a8
+     754:	e8 e7 4b 00 00       	call   5340 <printf>
+    exit();
+     759:	e8 d5 49 00 00       	call   5133 <exit>
+    printf(stdout, "read failed\n");
+     75e:	52                   	push   %edx
+     75f:	52                   	push   %edx
+     760:	68 7e 63 00 00       	push   $0x637e
+     765:	ff 35 a8 87 00 00    	push   0x87a8
+     76b:	e8 d0 4b 00 00       	call   5340 <printf>
+    exit();
+     770:	e8 be 49 00 00       	call   5133 <exit>
+    printf(stdout, "unlink small failed\n");
+     775:	50                   	push   %eax
+     776:	50                   	push   %eax
+     777:	68 30 5b 00 00       	push   $0x5b30
+     77c:	ff 35 a8 87 00 00    	push   0x87a8
+     782:	e8 b9 4b 00 00       	call   5340 <printf>
+    exit();
+     787:	e8 a7 49 00 00       	call   5133 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     78c:	50                   	push   %eax
+     78d:	50                   	push   %eax
+     78e:	68 ac 5a 00 00       	push   $0x5aac
+     793:	ff 35 a8 87 00 00    	push   0x87a8
+     799:	e8 a2 4b 00 00       	call   5340 <printf>
+    exit();
+     79e:	e8 90 49 00 00       	call   5133 <exit>
+     7a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007b0 <writetest1>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	56                   	push   %esi
+     7b4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     7b5:	83 ec 08             	sub    $0x8,%esp
+     7b8:	68 59 5b 00 00       	push   $0x5b59
+     7bd:	ff 35 a8 87 00 00    	push   0x87a8
+     7c3:	e8 78 4b 00 00       	call   5340 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     7c8:	58                   	pop    %eax
+     7c9:	5a                   	pop    %edx
+     7ca:	68 02 02 00 00       	push   $0x202
+     7cf:	68 d3 5b 00 00       	push   $0x5bd3
+     7d4:	e8 9a 49 00 00       	call   5173 <open>
+  if(fd < 0){
+     7d9:	83 c4 10             	add    $0x10,%esp
+     7dc:	85 c0                	test   %eax,%eax
+     7de:	0f 88 61 01 00 00    	js     945 <writetest1+0x195>
+     7e4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     7e6:	31 db                	xor    %ebx,%ebx
+     7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     7f0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     7f3:	89 1d 00 6f 04 00    	mov    %ebx,0x46f00
+    if(write(fd, buf, 512) != 512){
+     7f9:	68 00 02 00 00       	push   $0x200
+     7fe:	68 00 6f 04 00       	push   $0x46f00
+     803:	56                   	push   %esi
+     804:	e8 4a 49 00 00       	call   5153 <write>
+     809:	83 c4 10             	add    $0x10,%esp
+     80c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     811:	0f 85 b3 00 00 00    	jne    8ca <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     817:	83 c3 01             	add    $0x1,%ebx
+     81a:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     820:	75 ce                	jne    7f0 <writetest1+0x40>
+  close(fd);
+     822:	83 ec 0c             	sub    $0xc,%esp
+     825:	56                   	push   %esi
+     826:	e8 30 49 00 00       	call   515b <close>
+  fd = open("big", O_RDONLY);
+     82b:	5b                   	pop    %ebx
+     82c:	5e                   	pop    %esi
+     82d:	6a 00                	push   $0x0
+     82f:	68 d3 5b 00 00       	push   $0x5bd3
+     834:	e8 3a 49 00 00       	call   5173 <open>
+  if(fd < 0){
+     839:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     83c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     83e:	85 c0                	test   %eax,%eax
+     840:	0f 88 e8 00 00 00    	js     92e <writetest1+0x17e>
+  n = 0;
+     846:	31 f6                	xor    %esi,%esi
+     848:	eb 1d                	jmp    867 <writetest1+0xb7>
+     84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     850:	3d 00 02 00 00       	cmp    $0x200,%eax
+     855:	0f 85 9f 00 00 00    	jne    8fa <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     85b:	a1 00 6f 04 00       	mov    0x46f00,%eax
+     860:	39 f0                	cmp    %esi,%eax
+     862:	75 7f                	jne    8e3 <writetest1+0x133>
+    n++;
+     864:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     867:	83 ec 04             	sub    $0x4,%esp
+     86a:	68 00 02 00 00       	push   $0x200
+     86f:	68 00 6f 04 00       	push   $0x46f00
+     874:	53                   	push   %ebx
+     875:	e8 d1 48 00 00       	call   514b <read>
+    if(i == 0){
+     87a:	83 c4 10             	add    $0x10,%esp
+     87d:	85 c0                	test   %eax,%eax
+     87f:	75 cf                	jne    850 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     881:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     887:	0f 84 86 00 00 00    	je     913 <writetest1+0x163>
+  close(fd);
+     88d:	83 ec 0c             	sub    $0xc,%esp
+     890:	53                   	push   %ebx
+     891:	e8 c5 48 00 00       	call   515b <close>
+  if(unlink("big") < 0){
+     896:	c7 04 24 d3 5b 00 00 	movl   $0x5bd3,(%esp)
+     89d:	e8 e1 48 00 00       	call   5183 <unlink>
+     8a2:	83 c4 10             	add    $0x10,%esp
+     8a5:	85 c0                	test   %eax,%eax
+     8a7:	0f 88 af 00 00 00    	js     95c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     8ad:	83 ec 08             	sub    $0x8,%esp
+     8b0:	68 fa 5b 00 00       	push   $0x5bfa
+     8b5:	ff 35 a8 87 00 00    	push   0x87a8
+     8bb:	e8 80 4a 00 00       	call   5340 <printf>
+}
+     8c0:	83 c4 10             	add    $0x10,%esp
+     8c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8c6:	5b                   	pop    %ebx
+     8c7:	5e                   	pop    %esi
+     8c8:	5d                   	pop    %ebp
+     8c9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     8ca:	83 ec 04             	sub    $0x4,%esp
+     8cd:	53                   	push   %ebx
+     8ce:	68 83 5b 00 00       	push   $0x5b83
+     8d3:	ff 35 a8 87 00 00    	push   0x87a8
+     8d9:	e8 62 4a 00 00       	call   5340 <printf>
+      exit();
+     8de:	e8 50 48 00 00       	call   5133 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     8e3:	50                   	push   %eax
+     8e4:	56                   	push   %esi
+     8e5:	68 fc 6e 00 00       	push   $0x6efc
+     8ea:	ff 35 a8 87 00 00    	push   0x87a8
+     8f0:	e8 4b 4a 00 00       	call   5340 <printf>
+      exit();
+     8f5:	e8 39 48 00 00       	call   5133 <exit>
+      printf(stdout, "read failed %d\n", i);
+     8fa:	83 ec 04             	sub    $0x4,%esp
+     8fd:	50                   	push   %eax
+     8fe:	68 d7 5b 00 00       	push   $0x5bd7
+     903:	ff 35 a8 87 00 00    	push   0x87a8
+     909:	e8 32 4a 00 00       	call   5340 <printf>
+      exit();
+     90e:	e8 20 48 00 00       	call   5133 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     913:	52                   	push   %edx
+     914:	68 8b 00 00 00       	push   $0x8b
+     919:	68 ba 5b 00 00       	push   $0x5bba
+     91e:	ff 35 a8 87 00 00    	push   0x87a8
+     924:	e8 17 4a 00 00       	call   5340 <printf>
+        exit();
+     929:	e8 05 48 00 00       	call   5133 <exit>
+    printf(stdout, "error: open big failed!\n");
+     92e:	51                   	push   %ecx
+     92f:	51                   	push   %ecx
+     930:	68 a1 5b 00 00       	push   $0x5ba1
+     935:	ff 35 a8 87 00 00    	push   0x87a8
+     93b:	e8 00 4a 00 00       	call   5340 <printf>
+    exit();
+     940:	e8 ee 47 00 00       	call   5133 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     945:	50                   	push   %eax
+     946:	50                   	push   %eax
+     947:	68 69 5b 00 00       	push   $0x5b69
+     94c:	ff 35 a8 87 00 00    	push   0x87a8
+     952:	e8 e9 49 00 00       	call   5340 <printf>
+    exit();
+     957:	e8 d7 47 00 00       	call   5133 <exit>
+    printf(stdout, "unlink big failed\n");
+     95c:	50                   	push   %eax
+     95d:	50                   	push   %eax
+     95e:	68 e7 5b 00 00       	push   $0x5be7
+     963:	ff 35 a8 87 00 00    	push   0x87a8
+     969:	e8 d2 49 00 00       	call   5340 <printf>
+    exit();
+     96e:	e8 c0 47 00 00       	call   5133 <exit>
+     973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000980 <createtest>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	53                   	push   %ebx
+  name[2] = '\0';
+     984:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     989:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     98c:	68 1c 6f 00 00       	push   $0x6f1c
+     991:	ff 35 a8 87 00 00    	push   0x87a8
+     997:	e8 a4 49 00 00       	call   5340 <printf>
+  name[0] = 'a';
+     99c:	c6 05 f8 6e 04 00 61 	movb   $0x61,0x46ef8
+  name[2] = '\0';
+     9a3:	83 c4 10             	add    $0x10,%esp
+     9a6:	c6 05 fa 6e 04 00 00 	movb   $0x0,0x46efa
+  for(i = 0; i < 52; i++){
+     9ad:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     9b0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     9b3:	88 1d f9 6e 04 00    	mov    %bl,0x46ef9
+  for(i = 0; i < 52; i++){
+     9b9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     9bc:	68 02 02 00 00       	push   $0x202
+     9c1:	68 f8 6e 04 00       	push   $0x46ef8
+     9c6:	e8 a8 47 00 00       	call   5173 <open>
+    close(fd);
+     9cb:	89 04 24             	mov    %eax,(%esp)
+     9ce:	e8 88 47 00 00       	call   515b <close>
+  for(i = 0; i < 52; i++){
+     9d3:	83 c4 10             	add    $0x10,%esp
+     9d6:	80 fb 64             	cmp    $0x64,%bl
+     9d9:	75 d5                	jne    9b0 <createtest+0x30>
+  name[0] = 'a';
+     9db:	c6 05 f8 6e 04 00 61 	movb   $0x61,0x46ef8
+  name[2] = '\0';
+     9e2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     9e7:	c6 05 fa 6e 04 00 00 	movb   $0x0,0x46efa
+  for(i = 0; i < 52; i++){
+     9ee:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     9f0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     9f3:	88 1d f9 6e 04 00    	mov    %bl,0x46ef9
+  for(i = 0; i < 52; i++){
+     9f9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     9fc:	68 f8 6e 04 00       	push   $0x46ef8
+     a01:	e8 7d 47 00 00       	call   5183 <unlink>
+  for(i = 0; i < 52; i++){
+     a06:	83 c4 10             	add    $0x10,%esp
+     a09:	80 fb 64             	cmp    $0x64,%bl
+     a0c:	75 e2                	jne    9f0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     a0e:	83 ec 08             	sub    $0x8,%esp
+     a11:	68 44 6f 00 00       	push   $0x6f44
+     a16:	ff 35 a8 87 00 00    	push   0x87a8
+     a1c:	e8 1f 49 00 00       	call   5340 <printf>
+}
+     a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a24:	83 c4 10             	add    $0x10,%esp
+     a27:	c9                   	leave
+     a28:	c3                   	ret
+     a29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <dirtest>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     a36:	68 08 5c 00 00       	push   $0x5c08
+     a3b:	ff 35 a8 87 00 00    	push   0x87a8
+     a41:	e8 fa 48 00 00       	call   5340 <printf>
+  if(mkdir("dir0") < 0){
+     a46:	c7 04 24 14 5c 00 00 	movl   $0x5c14,(%esp)
+     a4d:	e8 49 47 00 00       	call   519b <mkdir>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	78 58                	js     ab1 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     a59:	83 ec 0c             	sub    $0xc,%esp
+     a5c:	68 14 5c 00 00       	push   $0x5c14
+     a61:	e8 3d 47 00 00       	call   51a3 <chdir>
+     a66:	83 c4 10             	add    $0x10,%esp
+     a69:	85 c0                	test   %eax,%eax
+     a6b:	0f 88 85 00 00 00    	js     af6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     a71:	83 ec 0c             	sub    $0xc,%esp
+     a74:	68 ee 66 00 00       	push   $0x66ee
+     a79:	e8 25 47 00 00       	call   51a3 <chdir>
+     a7e:	83 c4 10             	add    $0x10,%esp
+     a81:	85 c0                	test   %eax,%eax
+     a83:	78 5a                	js     adf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     a85:	83 ec 0c             	sub    $0xc,%esp
+     a88:	68 14 5c 00 00       	push   $0x5c14
+     a8d:	e8 f1 46 00 00       	call   5183 <unlink>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	85 c0                	test   %eax,%eax
+     a97:	78 2f                	js     ac8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     a99:	83 ec 08             	sub    $0x8,%esp
+     a9c:	68 51 5c 00 00       	push   $0x5c51
+     aa1:	ff 35 a8 87 00 00    	push   0x87a8
+     aa7:	e8 94 48 00 00       	call   5340 <printf>
+}
+     aac:	83 c4 10             	add    $0x10,%esp
+     aaf:	c9                   	leave
+     ab0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     ab1:	50                   	push   %eax
+     ab2:	50                   	push   %eax
+     ab3:	68 44 59 00 00       	push   $0x5944
+     ab8:	ff 35 a8 87 00 00    	push   0x87a8
+     abe:	e8 7d 48 00 00       	call   5340 <printf>
+    exit();
+     ac3:	e8 6b 46 00 00       	call   5133 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     ac8:	50                   	push   %eax
+     ac9:	50                   	push   %eax
+     aca:	68 3d 5c 00 00       	push   $0x5c3d
+     acf:	ff 35 a8 87 00 00    	push   0x87a8
+     ad5:	e8 66 48 00 00       	call   5340 <printf>
+    exit();
+     ada:	e8 54 46 00 00       	call   5133 <exit>
+    printf(stdout, "chdir .. failed\n");
+     adf:	52                   	push   %edx
+     ae0:	52                   	push   %edx
+     ae1:	68 2c 5c 00 00       	push   $0x5c2c
+     ae6:	ff 35 a8 87 00 00    	push   0x87a8
+     aec:	e8 4f 48 00 00       	call   5340 <printf>
+    exit();
+     af1:	e8 3d 46 00 00       	call   5133 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     af6:	51                   	push   %ecx
+     af7:	51                   	push   %ecx
+     af8:	68 19 5c 00 00       	push   $0x5c19
+     afd:	ff 35 a8 87 00 00    	push   0x87a8
+     b03:	e8 38 48 00 00       	call   5340 <printf>
+    exit();
+     b08:	e8 26 46 00 00       	call   5133 <exit>
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b10 <exectest>:
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     b16:	68 60 5c 00 00       	push   $0x5c60
+     b1b:	ff 35 a8 87 00 00    	push   0x87a8
+     b21:	e8 1a 48 00 00       	call   5340 <printf>
+  if(exec("echo", echoargv) < 0){
+     b26:	5a                   	pop    %edx
+     b27:	59                   	pop    %ecx
+     b28:	68 ac 87 00 00       	push   $0x87ac
+     b2d:	68 29 5a 00 00       	push   $0x5a29
+     b32:	e8 34 46 00 00       	call   516b <exec>
+     b37:	83 c4 10             	add    $0x10,%esp
+     b3a:	85 c0                	test   %eax,%eax
+     b3c:	78 02                	js     b40 <exectest+0x30>
+}
+     b3e:	c9                   	leave
+     b3f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     b40:	50                   	push   %eax
+     b41:	50                   	push   %eax
+     b42:	68 6b 5c 00 00       	push   $0x5c6b
+     b47:	ff 35 a8 87 00 00    	push   0x87a8
+     b4d:	e8 ee 47 00 00       	call   5340 <printf>
+    exit();
+     b52:	e8 dc 45 00 00       	call   5133 <exit>
+     b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5e:	66 90                	xchg   %ax,%ax
+
+00000b60 <pipe1>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     b65:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     b68:	53                   	push   %ebx
+     b69:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     b6c:	50                   	push   %eax
+     b6d:	e8 d1 45 00 00       	call   5143 <pipe>
+     b72:	83 c4 10             	add    $0x10,%esp
+     b75:	85 c0                	test   %eax,%eax
+     b77:	0f 85 41 01 00 00    	jne    cbe <pipe1+0x15e>
+     b7d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     b7f:	e8 a7 45 00 00       	call   512b <fork>
+  if(pid == 0){
+     b84:	85 c0                	test   %eax,%eax
+     b86:	0f 84 92 00 00 00    	je     c1e <pipe1+0xbe>
+  } else if(pid > 0){
+     b8c:	0f 8e 3f 01 00 00    	jle    cd1 <pipe1+0x171>
+    close(fds[1]);
+     b92:	83 ec 0c             	sub    $0xc,%esp
+     b95:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     b98:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     b9a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     b9f:	e8 b7 45 00 00       	call   515b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     ba4:	83 c4 10             	add    $0x10,%esp
+     ba7:	83 ec 04             	sub    $0x4,%esp
+     baa:	57                   	push   %edi
+     bab:	68 00 6f 04 00       	push   $0x46f00
+     bb0:	ff 75 e0             	push   -0x20(%ebp)
+     bb3:	e8 93 45 00 00       	call   514b <read>
+     bb8:	83 c4 10             	add    $0x10,%esp
+     bbb:	89 c1                	mov    %eax,%ecx
+     bbd:	85 c0                	test   %eax,%eax
+     bbf:	0f 8e b8 00 00 00    	jle    c7d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     bc5:	89 f0                	mov    %esi,%eax
+     bc7:	32 05 00 6f 04 00    	xor    0x46f00,%al
+     bcd:	0f b6 c0             	movzbl %al,%eax
+     bd0:	85 c0                	test   %eax,%eax
+     bd2:	75 30                	jne    c04 <pipe1+0xa4>
+     bd4:	83 c6 01             	add    $0x1,%esi
+     bd7:	eb 0f                	jmp    be8 <pipe1+0x88>
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     be0:	38 90 00 6f 04 00    	cmp    %dl,0x46f00(%eax)
+     be6:	75 1c                	jne    c04 <pipe1+0xa4>
+     be8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     beb:	83 c0 01             	add    $0x1,%eax
+     bee:	39 c1                	cmp    %eax,%ecx
+     bf0:	75 ee                	jne    be0 <pipe1+0x80>
+      cc = cc * 2;
+     bf2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     bf4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     bf9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     bfb:	89 d6                	mov    %edx,%esi
+     bfd:	39 c7                	cmp    %eax,%edi
+     bff:	0f 4f f8             	cmovg  %eax,%edi
+     c02:	eb a3                	jmp    ba7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     c04:	83 ec 08             	sub    $0x8,%esp
+     c07:	68 9a 5c 00 00       	push   $0x5c9a
+     c0c:	6a 01                	push   $0x1
+     c0e:	e8 2d 47 00 00       	call   5340 <printf>
+     c13:	83 c4 10             	add    $0x10,%esp
+}
+     c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c19:	5b                   	pop    %ebx
+     c1a:	5e                   	pop    %esi
+     c1b:	5f                   	pop    %edi
+     c1c:	5d                   	pop    %ebp
+     c1d:	c3                   	ret
+    close(fds[0]);
+     c1e:	83 ec 0c             	sub    $0xc,%esp
+     c21:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     c24:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     c26:	e8 30 45 00 00       	call   515b <close>
+     c2b:	83 c4 10             	add    $0x10,%esp
+     c2e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     c30:	31 c0                	xor    %eax,%eax
+     c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     c38:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     c3b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     c3e:	88 90 ff 6e 04 00    	mov    %dl,0x46eff(%eax)
+      for(i = 0; i < 1033; i++)
+     c44:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c49:	75 ed                	jne    c38 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     c4b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     c4e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c54:	68 09 04 00 00       	push   $0x409
+     c59:	68 00 6f 04 00       	push   $0x46f00
+     c5e:	ff 75 e4             	push   -0x1c(%ebp)
+     c61:	e8 ed 44 00 00       	call   5153 <write>
+     c66:	83 c4 10             	add    $0x10,%esp
+     c69:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c6e:	75 74                	jne    ce4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     c70:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c76:	75 b8                	jne    c30 <pipe1+0xd0>
+    exit();
+     c78:	e8 b6 44 00 00       	call   5133 <exit>
+    if(total != 5 * 1033){
+     c7d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c83:	75 26                	jne    cab <pipe1+0x14b>
+    close(fds[0]);
+     c85:	83 ec 0c             	sub    $0xc,%esp
+     c88:	ff 75 e0             	push   -0x20(%ebp)
+     c8b:	e8 cb 44 00 00       	call   515b <close>
+    wait();
+     c90:	e8 a6 44 00 00       	call   513b <wait>
+  printf(1, "pipe1 ok\n");
+     c95:	5a                   	pop    %edx
+     c96:	59                   	pop    %ecx
+     c97:	68 bf 5c 00 00       	push   $0x5cbf
+     c9c:	6a 01                	push   $0x1
+     c9e:	e8 9d 46 00 00       	call   5340 <printf>
+     ca3:	83 c4 10             	add    $0x10,%esp
+     ca6:	e9 6b ff ff ff       	jmp    c16 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     cab:	56                   	push   %esi
+     cac:	53                   	push   %ebx
+     cad:	68 a8 5c 00 00       	push   $0x5ca8
+     cb2:	6a 01                	push   $0x1
+     cb4:	e8 87 46 00 00       	call   5340 <printf>
+      exit();
+     cb9:	e8 75 44 00 00       	call   5133 <exit>
+    printf(1, "pipe() failed\n");
+     cbe:	50                   	push   %eax
+     cbf:	50                   	push   %eax
+     cc0:	68 7d 5c 00 00       	push   $0x5c7d
+     cc5:	6a 01                	push   $0x1
+     cc7:	e8 74 46 00 00       	call   5340 <printf>
+    exit();
+     ccc:	e8 62 44 00 00       	call   5133 <exit>
+    printf(1, "fork() failed\n");
+     cd1:	50                   	push   %eax
+     cd2:	50                   	push   %eax
+     cd3:	68 c9 5c 00 00       	push   $0x5cc9
+     cd8:	6a 01                	push   $0x1
+     cda:	e8 61 46 00 00       	call   5340 <printf>
+    exit();
+     cdf:	e8 4f 44 00 00       	call   5133 <exit>
+        printf(1, "pipe1 oops 1\n");
+     ce4:	57                   	push   %edi
+     ce5:	57                   	push   %edi
+     ce6:	68 8c 5c 00 00       	push   $0x5c8c
+     ceb:	6a 01                	push   $0x1
+     ced:	e8 4e 46 00 00       	call   5340 <printf>
+        exit();
+     cf2:	e8 3c 44 00 00       	call   5133 <exit>
+     cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfe:	66 90                	xchg   %ax,%ax
+
+00000d00 <preempt>:
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+     d05:	53                   	push   %ebx
+     d06:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     d09:	68 d8 5c 00 00       	push   $0x5cd8
+     d0e:	6a 01                	push   $0x1
+     d10:	e8 2b 46 00 00       	call   5340 <printf>
+  pid1 = fork();
+     d15:	e8 11 44 00 00       	call   512b <fork>
+  if(pid1 == 0)
+     d1a:	83 c4 10             	add    $0x10,%esp
+     d1d:	85 c0                	test   %eax,%eax
+     d1f:	75 07                	jne    d28 <preempt+0x28>
+    for(;;)
+     d21:	eb fe                	jmp    d21 <preempt+0x21>
+     d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d27:	90                   	nop
+     d28:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     d2a:	e8 fc 43 00 00       	call   512b <fork>
+     d2f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     d31:	85 c0                	test   %eax,%eax
+     d33:	75 0b                	jne    d40 <preempt+0x40>
+    for(;;)
+     d35:	eb fe                	jmp    d35 <preempt+0x35>
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     d40:	83 ec 0c             	sub    $0xc,%esp
+     d43:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d46:	50                   	push   %eax
+     d47:	e8 f7 43 00 00       	call   5143 <pipe>
+  pid3 = fork();
+     d4c:	e8 da 43 00 00       	call   512b <fork>
+  if(pid3 == 0){
+     d51:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     d54:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     d56:	85 c0                	test   %eax,%eax
+     d58:	75 3e                	jne    d98 <preempt+0x98>
+    close(pfds[0]);
+     d5a:	83 ec 0c             	sub    $0xc,%esp
+     d5d:	ff 75 e0             	push   -0x20(%ebp)
+     d60:	e8 f6 43 00 00       	call   515b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     d65:	83 c4 0c             	add    $0xc,%esp
+     d68:	6a 01                	push   $0x1
+     d6a:	68 d2 67 00 00       	push   $0x67d2
+     d6f:	ff 75 e4             	push   -0x1c(%ebp)
+     d72:	e8 dc 43 00 00       	call   5153 <write>
+     d77:	83 c4 10             	add    $0x10,%esp
+     d7a:	83 f8 01             	cmp    $0x1,%eax
+     d7d:	0f 85 b8 00 00 00    	jne    e3b <preempt+0x13b>
+    close(pfds[1]);
+     d83:	83 ec 0c             	sub    $0xc,%esp
+     d86:	ff 75 e4             	push   -0x1c(%ebp)
+     d89:	e8 cd 43 00 00       	call   515b <close>
+     d8e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     d91:	eb fe                	jmp    d91 <preempt+0x91>
+     d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d97:	90                   	nop
+  close(pfds[1]);
+     d98:	83 ec 0c             	sub    $0xc,%esp
+     d9b:	ff 75 e4             	push   -0x1c(%ebp)
+     d9e:	e8 b8 43 00 00       	call   515b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     da3:	83 c4 0c             	add    $0xc,%esp
+     da6:	68 00 20 00 00       	push   $0x2000
+     dab:	68 00 6f 04 00       	push   $0x46f00
+     db0:	ff 75 e0             	push   -0x20(%ebp)
+     db3:	e8 93 43 00 00       	call   514b <read>
+     db8:	83 c4 10             	add    $0x10,%esp
+     dbb:	83 f8 01             	cmp    $0x1,%eax
+     dbe:	75 67                	jne    e27 <preempt+0x127>
+  close(pfds[0]);
+     dc0:	83 ec 0c             	sub    $0xc,%esp
+     dc3:	ff 75 e0             	push   -0x20(%ebp)
+     dc6:	e8 90 43 00 00       	call   515b <close>
+  printf(1, "kill... ");
+     dcb:	58                   	pop    %eax
+     dcc:	5a                   	pop    %edx
+     dcd:	68 09 5d 00 00       	push   $0x5d09
+     dd2:	6a 01                	push   $0x1
+     dd4:	e8 67 45 00 00       	call   5340 <printf>
+  kill(pid1);
+     dd9:	89 1c 24             	mov    %ebx,(%esp)
+     ddc:	e8 82 43 00 00       	call   5163 <kill>
+  kill(pid2);
+     de1:	89 34 24             	mov    %esi,(%esp)
+     de4:	e8 7a 43 00 00       	call   5163 <kill>
+  kill(pid3);
+     de9:	89 3c 24             	mov    %edi,(%esp)
+     dec:	e8 72 43 00 00       	call   5163 <kill>
+  printf(1, "wait... ");
+     df1:	59                   	pop    %ecx
+     df2:	5b                   	pop    %ebx
+     df3:	68 12 5d 00 00       	push   $0x5d12
+     df8:	6a 01                	push   $0x1
+     dfa:	e8 41 45 00 00       	call   5340 <printf>
+  wait();
+     dff:	e8 37 43 00 00       	call   513b <wait>
+  wait();
+     e04:	e8 32 43 00 00       	call   513b <wait>
+  wait();
+     e09:	e8 2d 43 00 00       	call   513b <wait>
+  printf(1, "preempt ok\n");
+     e0e:	5e                   	pop    %esi
+     e0f:	5f                   	pop    %edi
+     e10:	68 1b 5d 00 00       	push   $0x5d1b
+     e15:	6a 01                	push   $0x1
+     e17:	e8 24 45 00 00       	call   5340 <printf>
+     e1c:	83 c4 10             	add    $0x10,%esp
+}
+     e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e22:	5b                   	pop    %ebx
+     e23:	5e                   	pop    %esi
+     e24:	5f                   	pop    %edi
+     e25:	5d                   	pop    %ebp
+     e26:	c3                   	ret
+    printf(1, "preempt read error");
+     e27:	83 ec 08             	sub    $0x8,%esp
+     e2a:	68 f6 5c 00 00       	push   $0x5cf6
+     e2f:	6a 01                	push   $0x1
+     e31:	e8 0a 45 00 00       	call   5340 <printf>
+     e36:	83 c4 10             	add    $0x10,%esp
+     e39:	eb e4                	jmp    e1f <preempt+0x11f>
+      printf(1, "preempt write error");
+     e3b:	83 ec 08             	sub    $0x8,%esp
+     e3e:	68 e2 5c 00 00       	push   $0x5ce2
+     e43:	6a 01                	push   $0x1
+     e45:	e8 f6 44 00 00       	call   5340 <printf>
+     e4a:	83 c4 10             	add    $0x10,%esp
+     e4d:	e9 31 ff ff ff       	jmp    d83 <preempt+0x83>
+     e52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e60 <exitwait>:
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	56                   	push   %esi
+     e64:	be 64 00 00 00       	mov    $0x64,%esi
+     e69:	53                   	push   %ebx
+     e6a:	eb 14                	jmp    e80 <exitwait+0x20>
+     e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     e70:	74 68                	je     eda <exitwait+0x7a>
+      if(wait() != pid){
+     e72:	e8 c4 42 00 00       	call   513b <wait>
+     e77:	39 d8                	cmp    %ebx,%eax
+     e79:	75 2d                	jne    ea8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     e7b:	83 ee 01             	sub    $0x1,%esi
+     e7e:	74 41                	je     ec1 <exitwait+0x61>
+    pid = fork();
+     e80:	e8 a6 42 00 00       	call   512b <fork>
+     e85:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     e87:	85 c0                	test   %eax,%eax
+     e89:	79 e5                	jns    e70 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     e8b:	83 ec 08             	sub    $0x8,%esp
+     e8e:	68 af 6d 00 00       	push   $0x6daf
+     e93:	6a 01                	push   $0x1
+     e95:	e8 a6 44 00 00       	call   5340 <printf>
+      return;
+     e9a:	83 c4 10             	add    $0x10,%esp
+}
+     e9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea0:	5b                   	pop    %ebx
+     ea1:	5e                   	pop    %esi
+     ea2:	5d                   	pop    %ebp
+     ea3:	c3                   	ret
+     ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     ea8:	83 ec 08             	sub    $0x8,%esp
+     eab:	68 27 5d 00 00       	push   $0x5d27
+     eb0:	6a 01                	push   $0x1
+     eb2:	e8 89 44 00 00       	call   5340 <printf>
+        return;
+     eb7:	83 c4 10             	add    $0x10,%esp
+}
+     eba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ebd:	5b                   	pop    %ebx
+     ebe:	5e                   	pop    %esi
+     ebf:	5d                   	pop    %ebp
+     ec0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     ec1:	83 ec 08             	sub    $0x8,%esp
+     ec4:	68 37 5d 00 00       	push   $0x5d37
+     ec9:	6a 01                	push   $0x1
+     ecb:	e8 70 44 00 00       	call   5340 <printf>
+     ed0:	83 c4 10             	add    $0x10,%esp
+}
+     ed3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ed6:	5b                   	pop    %ebx
+     ed7:	5e                   	pop    %esi
+     ed8:	5d                   	pop    %ebp
+     ed9:	c3                   	ret
+      exit();
+     eda:	e8 54 42 00 00       	call   5133 <exit>
+     edf:	90                   	nop
+
+00000ee0 <clocktest>:
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	83 ec 30             	sub    $0x30,%esp
+  printf(1, "clock test\n");
+     ee6:	68 44 5d 00 00       	push   $0x5d44
+     eeb:	6a 01                	push   $0x1
+     eed:	e8 4e 44 00 00       	call   5340 <printf>
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0){
+     ef2:	58                   	pop    %eax
+     ef3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ef6:	5a                   	pop    %edx
+     ef7:	50                   	push   %eax
+     ef8:	6a 01                	push   $0x1
+     efa:	e8 e4 42 00 00       	call   51e3 <clock_gettime>
+     eff:	83 c4 10             	add    $0x10,%esp
+     f02:	85 c0                	test   %eax,%eax
+     f04:	78 64                	js     f6a <clocktest+0x8a>
+  if(nanosleep(&req) < 0){
+     f06:	83 ec 0c             	sub    $0xc,%esp
+     f09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  req.tv_sec = 0;
+     f0c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  req.tv_nsec = 2000000;
+     f13:	c7 45 f4 80 84 1e 00 	movl   $0x1e8480,-0xc(%ebp)
+  if(nanosleep(&req) < 0){
+     f1a:	50                   	push   %eax
+     f1b:	e8 cb 42 00 00       	call   51eb <nanosleep>
+     f20:	83 c4 10             	add    $0x10,%esp
+     f23:	85 c0                	test   %eax,%eax
+     f25:	78 7c                	js     fa3 <clocktest+0xc3>
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+     f27:	83 ec 08             	sub    $0x8,%esp
+     f2a:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     f2d:	50                   	push   %eax
+     f2e:	6a 01                	push   $0x1
+     f30:	e8 ae 42 00 00       	call   51e3 <clock_gettime>
+  ns = (t1.tv_sec - t0.tv_sec) * 1000000000 + t1.tv_nsec - t0.tv_nsec;
+     f35:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f38:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  if(ns < req.tv_nsec){
+     f3b:	83 c4 10             	add    $0x10,%esp
+  ns = (t1.tv_sec - t0.tv_sec) * 1000000000 + t1.tv_nsec - t0.tv_nsec;
+     f3e:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+     f44:	03 45 ec             	add    -0x14(%ebp),%eax
+     f47:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+  if(ns < req.tv_nsec){
+     f4a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     f4d:	72 41                	jb     f90 <clocktest+0xb0>
+  if(ns > 1000000000){
+     f4f:	3d 00 ca 9a 3b       	cmp    $0x3b9aca00,%eax
+     f54:	77 27                	ja     f7d <clocktest+0x9d>
+  printf(1, "clock test ok\n");
+     f56:	83 ec 08             	sub    $0x8,%esp
+     f59:	68 8e 5d 00 00       	push   $0x5d8e
+     f5e:	6a 01                	push   $0x1
+     f60:	e8 db 43 00 00       	call   5340 <printf>
+}
+     f65:	83 c4 10             	add    $0x10,%esp
+     f68:	c9                   	leave
+     f69:	c3                   	ret
+    printf(1, "clock_gettime failed\n");
+     f6a:	50                   	push   %eax
+     f6b:	50                   	push   %eax
+     f6c:	68 50 5d 00 00       	push   $0x5d50
+     f71:	6a 01                	push   $0x1
+     f73:	e8 c8 43 00 00       	call   5340 <printf>
+    exit();
+     f78:	e8 b6 41 00 00       	call   5133 <exit>
+    printf(1, "nanosleep took %d ns\n", ns);
+     f7d:	52                   	push   %edx
+     f7e:	50                   	push   %eax
+     f7f:	68 78 5d 00 00       	push   $0x5d78
+     f84:	6a 01                	push   $0x1
+     f86:	e8 b5 43 00 00       	call   5340 <printf>
+    exit();
+     f8b:	e8 a3 41 00 00       	call   5133 <exit>
+    printf(1, "nanosleep returned after %d ns\n", ns);
+     f90:	51                   	push   %ecx
+     f91:	50                   	push   %eax
+     f92:	68 6c 6f 00 00       	push   $0x6f6c
+     f97:	6a 01                	push   $0x1
+     f99:	e8 a2 43 00 00       	call   5340 <printf>
+    exit();
+     f9e:	e8 90 41 00 00       	call   5133 <exit>
+    printf(1, "nanosleep failed\n");
+     fa3:	50                   	push   %eax
+     fa4:	50                   	push   %eax
+     fa5:	68 66 5d 00 00       	push   $0x5d66
+     faa:	6a 01                	push   $0x1
+     fac:	e8 8f 43 00 00       	call   5340 <printf>
+    exit();
+     fb1:	e8 7d 41 00 00       	call   5133 <exit>
+     fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fc0 <threadtest>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	53                   	push   %ebx
+  tcount = 0;
+     fc4:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+     fc9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "thread test\n");
+     fcc:	68 9d 5d 00 00       	push   $0x5d9d
+     fd1:	6a 01                	push   $0x1
+     fd3:	e8 68 43 00 00       	call   5340 <printf>
+  lock_init(&tlock);
+     fd8:	c7 04 24 f4 6e 04 00 	movl   $0x46ef4,(%esp)
+     fdf:	e8 7c 47 00 00       	call   5760 <lock_init>
+  tcount = 0;
+     fe4:	83 c4 10             	add    $0x10,%esp
+     fe7:	c7 05 f0 6e 04 00 00 	movl   $0x0,0x46ef0
+     fee:	00 00 00 
+    if(thread_create(threadinc, (void*)1000) < 0){
+     ff1:	83 ec 08             	sub    $0x8,%esp
+     ff4:	68 e8 03 00 00       	push   $0x3e8
+     ff9:	68 70 01 00 00       	push   $0x170
+     ffe:	e8 bd 46 00 00       	call   56c0 <thread_create>
+    1003:	83 c4 10             	add    $0x10,%esp
+    1006:	85 c0                	test   %eax,%eax
+    1008:	78 45                	js     104f <threadtest+0x8f>
+  for(i = 0; i < 4; i++){
+    100a:	83 eb 01             	sub    $0x1,%ebx
+    100d:	75 e2                	jne    ff1 <threadtest+0x31>
+    100f:	bb 04 00 00 00       	mov    $0x4,%ebx
+    if(thread_join() < 0){
+    1014:	e8 07 47 00 00       	call   5720 <thread_join>
+    1019:	85 c0                	test   %eax,%eax
+    101b:	78 46                	js     1063 <threadtest+0xa3>
+  for(i = 0; i < 4; i++){
+    101d:	83 eb 01             	sub    $0x1,%ebx
+    1020:	75 f2                	jne    1014 <threadtest+0x54>
+  if(thread_join() != -1){
+    1022:	e8 f9 46 00 00       	call   5720 <thread_join>
+    1027:	83 f8 ff             	cmp    $0xffffffff,%eax
+    102a:	75 5e                	jne    108a <threadtest+0xca>
+  if(tcount != 4000){
+    102c:	a1 f0 6e 04 00       	mov    0x46ef0,%eax
+    1031:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+    1036:	75 3f                	jne    1077 <threadtest+0xb7>
+  printf(1, "thread test ok\n");
+    1038:	83 ec 08             	sub    $0x8,%esp
+    103b:	68 ee 5d 00 00       	push   $0x5dee
+    1040:	6a 01                	push   $0x1
+    1042:	e8 f9 42 00 00       	call   5340 <printf>
+}
+    1047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  printf(1, "thread test ok\n");
+    104a:	83 c4 10             	add    $0x10,%esp
+}
+    104d:	c9                   	leave
+    104e:	c3                   	ret
+      printf(1, "thread_create failed\n");
+    104f:	83 ec 08             	sub    $0x8,%esp
+    1052:	68 aa 5d 00 00       	push   $0x5daa
+    1057:	6a 01                	push   $0x1
+    1059:	e8 e2 42 00 00       	call   5340 <printf>
+      exit();
+    105e:	e8 d0 40 00 00       	call   5133 <exit>
+      printf(1, "thread_join failed\n");
+    1063:	83 ec 08             	sub    $0x8,%esp
+    1066:	68 c0 5d 00 00       	push   $0x5dc0
+    106b:	6a 01                	push   $0x1
+    106d:	e8 ce 42 00 00       	call   5340 <printf>
+      exit();
+    1072:	e8 bc 40 00 00       	call   5133 <exit>
+    printf(1, "thread test: count %d, expected 4000\n", tcount);
+    1077:	52                   	push   %edx
+    1078:	50                   	push   %eax
+    1079:	68 8c 6f 00 00       	push   $0x6f8c
+    107e:	6a 01                	push   $0x1
+    1080:	e8 bb 42 00 00       	call   5340 <printf>
+    exit();
+    1085:	e8 a9 40 00 00       	call   5133 <exit>
+    printf(1, "thread_join got too many\n");
+    108a:	51                   	push   %ecx
+    108b:	51                   	push   %ecx
+    108c:	68 d4 5d 00 00       	push   $0x5dd4
+    1091:	6a 01                	push   $0x1
+    1093:	e8 a8 42 00 00       	call   5340 <printf>
+    exit();
+    1098:	e8 96 40 00 00       	call   5133 <exit>
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010a0 <futextest>:
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	53                   	push   %ebx
+    10a4:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "futex test\n");
+    10a7:	68 fe 5d 00 00       	push   $0x5dfe
+    10ac:	6a 01                	push   $0x1
+    10ae:	e8 8d 42 00 00       	call   5340 <printf>
+  word = 1;
+    10b3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  if(futex_wait(&word, 0) != -1){
+    10ba:	5b                   	pop    %ebx
+    10bb:	58                   	pop    %eax
+    10bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10bf:	6a 00                	push   $0x0
+    10c1:	50                   	push   %eax
+    10c2:	e8 3c 41 00 00       	call   5203 <futex_wait>
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10cd:	0f 85 90 00 00 00    	jne    1163 <futextest+0xc3>
+  mutex_init(&fmutex);
+    10d3:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 4; i++){
+    10d6:	31 db                	xor    %ebx,%ebx
+  mutex_init(&fmutex);
+    10d8:	68 ec 6e 04 00       	push   $0x46eec
+    10dd:	e8 be 46 00 00       	call   57a0 <mutex_init>
+  cond_init(&fcond);
+    10e2:	c7 04 24 e4 6e 04 00 	movl   $0x46ee4,(%esp)
+    10e9:	e8 42 47 00 00       	call   5830 <cond_init>
+  fturn = 0;
+    10ee:	83 c4 10             	add    $0x10,%esp
+    10f1:	c7 05 e0 6e 04 00 00 	movl   $0x0,0x46ee0
+    10f8:	00 00 00 
+    if(thread_create(futexworker, (void*)i) < 0){
+    10fb:	83 ec 08             	sub    $0x8,%esp
+    10fe:	53                   	push   %ebx
+    10ff:	68 b0 01 00 00       	push   $0x1b0
+    1104:	e8 b7 45 00 00       	call   56c0 <thread_create>
+    1109:	83 c4 10             	add    $0x10,%esp
+    110c:	85 c0                	test   %eax,%eax
+    110e:	78 3f                	js     114f <futextest+0xaf>
+  for(i = 0; i < 4; i++){
+    1110:	83 c3 01             	add    $0x1,%ebx
+    1113:	83 fb 04             	cmp    $0x4,%ebx
+    1116:	75 e3                	jne    10fb <futextest+0x5b>
+    thread_join();
+    1118:	e8 03 46 00 00       	call   5720 <thread_join>
+    111d:	e8 fe 45 00 00       	call   5720 <thread_join>
+    1122:	e8 f9 45 00 00       	call   5720 <thread_join>
+    1127:	e8 f4 45 00 00       	call   5720 <thread_join>
+  if(fturn != 400){
+    112c:	a1 e0 6e 04 00       	mov    0x46ee0,%eax
+    1131:	3d 90 01 00 00       	cmp    $0x190,%eax
+    1136:	75 3e                	jne    1176 <futextest+0xd6>
+  printf(1, "futex test ok\n");
+    1138:	83 ec 08             	sub    $0x8,%esp
+    113b:	68 0a 5e 00 00       	push   $0x5e0a
+    1140:	6a 01                	push   $0x1
+    1142:	e8 f9 41 00 00       	call   5340 <printf>
+}
+    1147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  printf(1, "futex test ok\n");
+    114a:	83 c4 10             	add    $0x10,%esp
+}
+    114d:	c9                   	leave
+    114e:	c3                   	ret
+      printf(1, "thread_create failed\n");
+    114f:	83 ec 08             	sub    $0x8,%esp
+    1152:	68 aa 5d 00 00       	push   $0x5daa
+    1157:	6a 01                	push   $0x1
+    1159:	e8 e2 41 00 00       	call   5340 <printf>
+      exit();
+    115e:	e8 d0 3f 00 00       	call   5133 <exit>
+    printf(1, "futex_wait slept on a changed value\n");
+    1163:	51                   	push   %ecx
+    1164:	51                   	push   %ecx
+    1165:	68 b4 6f 00 00       	push   $0x6fb4
+    116a:	6a 01                	push   $0x1
+    116c:	e8 cf 41 00 00       	call   5340 <printf>
+    exit();
+    1171:	e8 bd 3f 00 00       	call   5133 <exit>
+    printf(1, "futex test: %d turns, expected 400\n", fturn);
+    1176:	52                   	push   %edx
+    1177:	50                   	push   %eax
+    1178:	68 dc 6f 00 00       	push   $0x6fdc
+    117d:	6a 01                	push   $0x1
+    117f:	e8 bc 41 00 00       	call   5340 <printf>
+    exit();
+    1184:	e8 aa 3f 00 00       	call   5133 <exit>
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001190 <affinitytest>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	56                   	push   %esi
+    1194:	53                   	push   %ebx
+    1195:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "affinity test\n");
+    1198:	68 19 5e 00 00       	push   $0x5e19
+    119d:	6a 01                	push   $0x1
+    119f:	e8 9c 41 00 00       	call   5340 <printf>
+  if(sched_getaffinity(0, &old) < 0 || old == 0){
+    11a4:	58                   	pop    %eax
+    11a5:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    11a8:	5a                   	pop    %edx
+    11a9:	50                   	push   %eax
+    11aa:	6a 00                	push   $0x0
+    11ac:	e8 6a 40 00 00       	call   521b <sched_getaffinity>
+    11b1:	83 c4 10             	add    $0x10,%esp
+    11b4:	85 c0                	test   %eax,%eax
+    11b6:	0f 88 30 01 00 00    	js     12ec <affinitytest+0x15c>
+    11bc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11bf:	85 c0                	test   %eax,%eax
+    11c1:	0f 84 25 01 00 00    	je     12ec <affinitytest+0x15c>
+  if(sched_setaffinity(0, 0) != -1){
+    11c7:	83 ec 08             	sub    $0x8,%esp
+    11ca:	6a 00                	push   $0x0
+    11cc:	6a 00                	push   $0x0
+    11ce:	e8 40 40 00 00       	call   5213 <sched_setaffinity>
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11d9:	0f 85 7a 01 00 00    	jne    1359 <affinitytest+0x1c9>
+  if(sched_setaffinity(0, 1) < 0 || sched_getaffinity(0, &m) < 0 || m != 1){
+    11df:	83 ec 08             	sub    $0x8,%esp
+    11e2:	6a 01                	push   $0x1
+    11e4:	6a 00                	push   $0x0
+    11e6:	e8 28 40 00 00       	call   5213 <sched_setaffinity>
+    11eb:	83 c4 10             	add    $0x10,%esp
+    11ee:	85 c0                	test   %eax,%eax
+    11f0:	0f 88 ce 00 00 00    	js     12c4 <affinitytest+0x134>
+    11f6:	83 ec 08             	sub    $0x8,%esp
+    11f9:	8d 75 ec             	lea    -0x14(%ebp),%esi
+    11fc:	56                   	push   %esi
+    11fd:	6a 00                	push   $0x0
+    11ff:	e8 17 40 00 00       	call   521b <sched_getaffinity>
+    1204:	83 c4 10             	add    $0x10,%esp
+    1207:	85 c0                	test   %eax,%eax
+    1209:	0f 88 b5 00 00 00    	js     12c4 <affinitytest+0x134>
+    120f:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    1213:	0f 85 ab 00 00 00    	jne    12c4 <affinitytest+0x134>
+  if(pipe(fds) < 0){
+    1219:	83 ec 0c             	sub    $0xc,%esp
+    121c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    121f:	50                   	push   %eax
+    1220:	e8 1e 3f 00 00       	call   5143 <pipe>
+    1225:	83 c4 10             	add    $0x10,%esp
+    1228:	85 c0                	test   %eax,%eax
+    122a:	0f 88 03 01 00 00    	js     1333 <affinitytest+0x1a3>
+  pid = fork();
+    1230:	e8 f6 3e 00 00       	call   512b <fork>
+    1235:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    1237:	85 c0                	test   %eax,%eax
+    1239:	0f 88 07 01 00 00    	js     1346 <affinitytest+0x1b6>
+  if(pid == 0){
+    123f:	0f 84 cd 00 00 00    	je     1312 <affinitytest+0x182>
+  close(fds[0]);
+    1245:	83 ec 0c             	sub    $0xc,%esp
+    1248:	ff 75 f0             	push   -0x10(%ebp)
+    124b:	e8 0b 3f 00 00       	call   515b <close>
+  if(sched_getaffinity(pid, &m) < 0 || m != 1){
+    1250:	58                   	pop    %eax
+    1251:	5a                   	pop    %edx
+    1252:	56                   	push   %esi
+    1253:	53                   	push   %ebx
+    1254:	e8 c2 3f 00 00       	call   521b <sched_getaffinity>
+    1259:	83 c4 10             	add    $0x10,%esp
+    125c:	85 c0                	test   %eax,%eax
+    125e:	0f 88 9b 00 00 00    	js     12ff <affinitytest+0x16f>
+    1264:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    1268:	0f 85 91 00 00 00    	jne    12ff <affinitytest+0x16f>
+  close(fds[1]);
+    126e:	83 ec 0c             	sub    $0xc,%esp
+    1271:	ff 75 f4             	push   -0xc(%ebp)
+    1274:	e8 e2 3e 00 00       	call   515b <close>
+  wait();
+    1279:	e8 bd 3e 00 00       	call   513b <wait>
+  if(sched_setaffinity(0, old) < 0 || sched_getaffinity(0, &m) < 0 || m != old){
+    127e:	58                   	pop    %eax
+    127f:	5a                   	pop    %edx
+    1280:	ff 75 e8             	push   -0x18(%ebp)
+    1283:	6a 00                	push   $0x0
+    1285:	e8 89 3f 00 00       	call   5213 <sched_setaffinity>
+    128a:	83 c4 10             	add    $0x10,%esp
+    128d:	85 c0                	test   %eax,%eax
+    128f:	78 47                	js     12d8 <affinitytest+0x148>
+    1291:	83 ec 08             	sub    $0x8,%esp
+    1294:	56                   	push   %esi
+    1295:	6a 00                	push   $0x0
+    1297:	e8 7f 3f 00 00       	call   521b <sched_getaffinity>
+    129c:	83 c4 10             	add    $0x10,%esp
+    129f:	85 c0                	test   %eax,%eax
+    12a1:	78 35                	js     12d8 <affinitytest+0x148>
+    12a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    12a6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    12a9:	75 2d                	jne    12d8 <affinitytest+0x148>
+  printf(1, "affinity test ok\n");
+    12ab:	83 ec 08             	sub    $0x8,%esp
+    12ae:	68 81 5e 00 00       	push   $0x5e81
+    12b3:	6a 01                	push   $0x1
+    12b5:	e8 86 40 00 00       	call   5340 <printf>
+}
+    12ba:	83 c4 10             	add    $0x10,%esp
+    12bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12c0:	5b                   	pop    %ebx
+    12c1:	5e                   	pop    %esi
+    12c2:	5d                   	pop    %ebp
+    12c3:	c3                   	ret
+    printf(1, "setaffinity to cpu 0 failed\n");
+    12c4:	83 ec 08             	sub    $0x8,%esp
+    12c7:	68 3c 5e 00 00       	push   $0x5e3c
+    12cc:	6a 01                	push   $0x1
+    12ce:	e8 6d 40 00 00       	call   5340 <printf>
+    exit();
+    12d3:	e8 5b 3e 00 00       	call   5133 <exit>
+    printf(1, "restoring affinity failed\n");
+    12d8:	83 ec 08             	sub    $0x8,%esp
+    12db:	68 66 5e 00 00       	push   $0x5e66
+    12e0:	6a 01                	push   $0x1
+    12e2:	e8 59 40 00 00       	call   5340 <printf>
+    exit();
+    12e7:	e8 47 3e 00 00       	call   5133 <exit>
+    printf(1, "getaffinity failed\n");
+    12ec:	50                   	push   %eax
+    12ed:	50                   	push   %eax
+    12ee:	68 28 5e 00 00       	push   $0x5e28
+    12f3:	6a 01                	push   $0x1
+    12f5:	e8 46 40 00 00       	call   5340 <printf>
+    exit();
+    12fa:	e8 34 3e 00 00       	call   5133 <exit>
+    printf(1, "child did not inherit affinity\n");
+    12ff:	51                   	push   %ecx
+    1300:	51                   	push   %ecx
+    1301:	68 24 70 00 00       	push   $0x7024
+    1306:	6a 01                	push   $0x1
+    1308:	e8 33 40 00 00       	call   5340 <printf>
+    exit();
+    130d:	e8 21 3e 00 00       	call   5133 <exit>
+    close(fds[1]);
+    1312:	83 ec 0c             	sub    $0xc,%esp
+    1315:	ff 75 f4             	push   -0xc(%ebp)
+    1318:	e8 3e 3e 00 00       	call   515b <close>
+    read(fds[0], &c, 1);
+    131d:	83 c4 0c             	add    $0xc,%esp
+    1320:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1323:	6a 01                	push   $0x1
+    1325:	50                   	push   %eax
+    1326:	ff 75 f0             	push   -0x10(%ebp)
+    1329:	e8 1d 3e 00 00       	call   514b <read>
+    exit();
+    132e:	e8 00 3e 00 00       	call   5133 <exit>
+    printf(1, "pipe failed\n");
+    1333:	53                   	push   %ebx
+    1334:	53                   	push   %ebx
+    1335:	68 59 5e 00 00       	push   $0x5e59
+    133a:	6a 01                	push   $0x1
+    133c:	e8 ff 3f 00 00       	call   5340 <printf>
+    exit();
+    1341:	e8 ed 3d 00 00       	call   5133 <exit>
+    printf(1, "fork failed\n");
+    1346:	51                   	push   %ecx
+    1347:	51                   	push   %ecx
+    1348:	68 af 6d 00 00       	push   $0x6daf
+    134d:	6a 01                	push   $0x1
+    134f:	e8 ec 3f 00 00       	call   5340 <printf>
+    exit();
+    1354:	e8 da 3d 00 00       	call   5133 <exit>
+    printf(1, "setaffinity accepted an empty mask\n");
+    1359:	56                   	push   %esi
+    135a:	56                   	push   %esi
+    135b:	68 00 70 00 00       	push   $0x7000
+    1360:	6a 01                	push   $0x1
+    1362:	e8 d9 3f 00 00       	call   5340 <printf>
+    exit();
+    1367:	e8 c7 3d 00 00       	call   5133 <exit>
+    136c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001370 <myinfo>:
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	83 ec 04             	sub    $0x4,%esp
+  pid = getpid();
+    1377:	e8 37 3e 00 00       	call   51b3 <getpid>
+  n = getprocinfo(pinfo, NPROC);
+    137c:	83 ec 08             	sub    $0x8,%esp
+    137f:	68 00 10 00 00       	push   $0x1000
+  pid = getpid();
+    1384:	89 c3                	mov    %eax,%ebx
+  n = getprocinfo(pinfo, NPROC);
+    1386:	68 e0 ae 00 00       	push   $0xaee0
+    138b:	e8 9b 3e 00 00       	call   522b <getprocinfo>
+  for(i = 0; i < n; i++)
+    1390:	83 c4 10             	add    $0x10,%esp
+    1393:	85 c0                	test   %eax,%eax
+    1395:	7e 26                	jle    13bd <myinfo+0x4d>
+    1397:	31 d2                	xor    %edx,%edx
+    1399:	eb 0c                	jmp    13a7 <myinfo+0x37>
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+    13a0:	83 c2 01             	add    $0x1,%edx
+    13a3:	39 d0                	cmp    %edx,%eax
+    13a5:	74 16                	je     13bd <myinfo+0x4d>
+    if(pinfo[i].pid == pid)
+    13a7:	6b ca 3c             	imul   $0x3c,%edx,%ecx
+    13aa:	39 99 e0 ae 00 00    	cmp    %ebx,0xaee0(%ecx)
+    13b0:	75 ee                	jne    13a0 <myinfo+0x30>
+}
+    13b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return &pinfo[i];
+    13b5:	8d 81 e0 ae 00 00    	lea    0xaee0(%ecx),%eax
+}
+    13bb:	c9                   	leave
+    13bc:	c3                   	ret
+  printf(1, "getprocinfo did not list pid %d\n", pid);
+    13bd:	83 ec 04             	sub    $0x4,%esp
+    13c0:	53                   	push   %ebx
+    13c1:	68 44 70 00 00       	push   $0x7044
+    13c6:	6a 01                	push   $0x1
+    13c8:	e8 73 3f 00 00       	call   5340 <printf>
+  exit();
+    13cd:	e8 61 3d 00 00       	call   5133 <exit>
+    13d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013e0 <accttest>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "acct test\n");
+    13e9:	68 93 5e 00 00       	push   $0x5e93
+    13ee:	6a 01                	push   $0x1
+    13f0:	e8 4b 3f 00 00       	call   5340 <printf>
+  pi = myinfo();
+    13f5:	e8 76 ff ff ff       	call   1370 <myinfo>
+  if(pi->state != PS_RUNNING || pi->ppid == 0){
+    13fa:	83 c4 10             	add    $0x10,%esp
+    13fd:	8b 50 08             	mov    0x8(%eax),%edx
+    1400:	83 fa 04             	cmp    $0x4,%edx
+    1403:	0f 85 81 00 00 00    	jne    148a <accttest+0xaa>
+    1409:	8b 70 04             	mov    0x4(%eax),%esi
+    140c:	85 f6                	test   %esi,%esi
+    140e:	74 7a                	je     148a <accttest+0xaa>
+  t0 = pi->utime + pi->stime;
+    1410:	8b 58 18             	mov    0x18(%eax),%ebx
+  nsyscall = pi->nsyscall;
+    1413:	8b 78 24             	mov    0x24(%eax),%edi
+  for(i = 0; i < 20000000; i++)
+    1416:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  nvcsw = pi->nvcsw;
+    141d:	8b 70 1c             	mov    0x1c(%eax),%esi
+  t0 = pi->utime + pi->stime;
+    1420:	03 58 14             	add    0x14(%eax),%ebx
+  for(i = 0; i < 20000000; i++)
+    1423:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1426:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+    142b:	7f 16                	jg     1443 <accttest+0x63>
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+    1430:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1433:	83 c0 01             	add    $0x1,%eax
+    1436:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1439:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    143c:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+    1441:	7e ed                	jle    1430 <accttest+0x50>
+  sleep(1);
+    1443:	83 ec 0c             	sub    $0xc,%esp
+    1446:	6a 01                	push   $0x1
+    1448:	e8 76 3d 00 00       	call   51c3 <sleep>
+  pi = myinfo();
+    144d:	e8 1e ff ff ff       	call   1370 <myinfo>
+  if(pi->utime + pi->stime <= t0){
+    1452:	83 c4 10             	add    $0x10,%esp
+    1455:	8b 50 18             	mov    0x18(%eax),%edx
+    1458:	03 50 14             	add    0x14(%eax),%edx
+    145b:	39 d3                	cmp    %edx,%ebx
+    145d:	73 5a                	jae    14b9 <accttest+0xd9>
+  if(pi->nsyscall < nsyscall + 3 || pi->nvcsw <= nvcsw){
+    145f:	8b 50 24             	mov    0x24(%eax),%edx
+    1462:	8d 4f 03             	lea    0x3(%edi),%ecx
+    1465:	8b 40 1c             	mov    0x1c(%eax),%eax
+    1468:	39 ca                	cmp    %ecx,%edx
+    146a:	72 33                	jb     149f <accttest+0xbf>
+    146c:	39 c6                	cmp    %eax,%esi
+    146e:	73 2f                	jae    149f <accttest+0xbf>
+  printf(1, "acct test ok\n");
+    1470:	83 ec 08             	sub    $0x8,%esp
+    1473:	68 9e 5e 00 00       	push   $0x5e9e
+    1478:	6a 01                	push   $0x1
+    147a:	e8 c1 3e 00 00       	call   5340 <printf>
+}
+    147f:	83 c4 10             	add    $0x10,%esp
+    1482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1485:	5b                   	pop    %ebx
+    1486:	5e                   	pop    %esi
+    1487:	5f                   	pop    %edi
+    1488:	5d                   	pop    %ebp
+    1489:	c3                   	ret
+    printf(1, "getprocinfo: bad state %d ppid %d\n", pi->state, pi->ppid);
+    148a:	ff 70 04             	push   0x4(%eax)
+    148d:	52                   	push   %edx
+    148e:	68 68 70 00 00       	push   $0x7068
+    1493:	6a 01                	push   $0x1
+    1495:	e8 a6 3e 00 00       	call   5340 <printf>
+    exit();
+    149a:	e8 94 3c 00 00       	call   5133 <exit>
+    printf(1, "acct: syscalls %d -> %d, vcsw %d -> %d\n",
+    149f:	51                   	push   %ecx
+    14a0:	51                   	push   %ecx
+    14a1:	50                   	push   %eax
+    14a2:	56                   	push   %esi
+    14a3:	52                   	push   %edx
+    14a4:	57                   	push   %edi
+    14a5:	68 b0 70 00 00       	push   $0x70b0
+    14aa:	6a 01                	push   $0x1
+    14ac:	e8 8f 3e 00 00       	call   5340 <printf>
+    exit();
+    14b1:	83 c4 20             	add    $0x20,%esp
+    14b4:	e8 7a 3c 00 00       	call   5133 <exit>
+    printf(1, "acct: busy loop used no cpu time\n");
+    14b9:	53                   	push   %ebx
+    14ba:	53                   	push   %ebx
+    14bb:	68 8c 70 00 00       	push   $0x708c
+    14c0:	6a 01                	push   $0x1
+    14c2:	e8 79 3e 00 00       	call   5340 <printf>
+    exit();
+    14c7:	e8 67 3c 00 00       	call   5133 <exit>
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014d0 <waitpidtest>:
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	56                   	push   %esi
+    14d4:	53                   	push   %ebx
+  printf(1, "waitpid test\n");
+    14d5:	83 ec 08             	sub    $0x8,%esp
+    14d8:	68 ac 5e 00 00       	push   $0x5eac
+    14dd:	6a 01                	push   $0x1
+    14df:	e8 5c 3e 00 00       	call   5340 <printf>
+  if(waitpid(-1, WNOHANG) != -1){
+    14e4:	58                   	pop    %eax
+    14e5:	5a                   	pop    %edx
+    14e6:	6a 01                	push   $0x1
+    14e8:	6a ff                	push   $0xffffffff
+    14ea:	e8 44 3d 00 00       	call   5233 <waitpid>
+    14ef:	83 c4 10             	add    $0x10,%esp
+    14f2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14f5:	0f 85 8f 00 00 00    	jne    158a <waitpidtest+0xba>
+  slow = fork();
+    14fb:	e8 2b 3c 00 00       	call   512b <fork>
+    1500:	89 c6                	mov    %eax,%esi
+  if(slow == 0){
+    1502:	85 c0                	test   %eax,%eax
+    1504:	0f 84 f7 00 00 00    	je     1601 <waitpidtest+0x131>
+  fast = fork();
+    150a:	e8 1c 3c 00 00       	call   512b <fork>
+    150f:	89 c3                	mov    %eax,%ebx
+  if(fast == 0)
+    1511:	85 c0                	test   %eax,%eax
+    1513:	0f 84 e3 00 00 00    	je     15fc <waitpidtest+0x12c>
+  if(slow < 0 || fast < 0){
+    1519:	89 f0                	mov    %esi,%eax
+    151b:	09 d8                	or     %ebx,%eax
+    151d:	0f 88 c6 00 00 00    	js     15e9 <waitpidtest+0x119>
+  if(waitpid(slow, WNOHANG) != 0){
+    1523:	83 ec 08             	sub    $0x8,%esp
+    1526:	6a 01                	push   $0x1
+    1528:	56                   	push   %esi
+    1529:	e8 05 3d 00 00       	call   5233 <waitpid>
+    152e:	83 c4 10             	add    $0x10,%esp
+    1531:	85 c0                	test   %eax,%eax
+    1533:	0f 85 9d 00 00 00    	jne    15d6 <waitpidtest+0x106>
+  if((r = waitpid(fast, 0)) != fast){
+    1539:	83 ec 08             	sub    $0x8,%esp
+    153c:	6a 00                	push   $0x0
+    153e:	53                   	push   %ebx
+    153f:	e8 ef 3c 00 00       	call   5233 <waitpid>
+    1544:	83 c4 10             	add    $0x10,%esp
+    1547:	39 c3                	cmp    %eax,%ebx
+    1549:	75 78                	jne    15c3 <waitpidtest+0xf3>
+  if(waitpid(fast, WNOHANG) != -1){
+    154b:	83 ec 08             	sub    $0x8,%esp
+    154e:	6a 01                	push   $0x1
+    1550:	53                   	push   %ebx
+    1551:	e8 dd 3c 00 00       	call   5233 <waitpid>
+    1556:	83 c4 10             	add    $0x10,%esp
+    1559:	83 f8 ff             	cmp    $0xffffffff,%eax
+    155c:	75 52                	jne    15b0 <waitpidtest+0xe0>
+  if((r = waitpid(-1, 0)) != slow){
+    155e:	83 ec 08             	sub    $0x8,%esp
+    1561:	6a 00                	push   $0x0
+    1563:	6a ff                	push   $0xffffffff
+    1565:	e8 c9 3c 00 00       	call   5233 <waitpid>
+    156a:	83 c4 10             	add    $0x10,%esp
+    156d:	39 c6                	cmp    %eax,%esi
+    156f:	75 2c                	jne    159d <waitpidtest+0xcd>
+  printf(1, "waitpid test ok\n");
+    1571:	83 ec 08             	sub    $0x8,%esp
+    1574:	68 0a 5f 00 00       	push   $0x5f0a
+    1579:	6a 01                	push   $0x1
+    157b:	e8 c0 3d 00 00       	call   5340 <printf>
+}
+    1580:	83 c4 10             	add    $0x10,%esp
+    1583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1586:	5b                   	pop    %ebx
+    1587:	5e                   	pop    %esi
+    1588:	5d                   	pop    %ebp
+    1589:	c3                   	ret
+    printf(1, "waitpid with no children did not fail\n");
+    158a:	50                   	push   %eax
+    158b:	50                   	push   %eax
+    158c:	68 d8 70 00 00       	push   $0x70d8
+    1591:	6a 01                	push   $0x1
+    1593:	e8 a8 3d 00 00       	call   5340 <printf>
+    exit();
+    1598:	e8 96 3b 00 00       	call   5133 <exit>
+    printf(1, "waitpid(-1) returned %d\n", r);
+    159d:	52                   	push   %edx
+    159e:	50                   	push   %eax
+    159f:	68 f1 5e 00 00       	push   $0x5ef1
+    15a4:	6a 01                	push   $0x1
+    15a6:	e8 95 3d 00 00       	call   5340 <printf>
+    exit();
+    15ab:	e8 83 3b 00 00       	call   5133 <exit>
+    printf(1, "waitpid found a reaped child\n");
+    15b0:	51                   	push   %ecx
+    15b1:	51                   	push   %ecx
+    15b2:	68 d3 5e 00 00       	push   $0x5ed3
+    15b7:	6a 01                	push   $0x1
+    15b9:	e8 82 3d 00 00       	call   5340 <printf>
+    exit();
+    15be:	e8 70 3b 00 00       	call   5133 <exit>
+    printf(1, "waitpid(%d) returned %d\n", fast, r);
+    15c3:	50                   	push   %eax
+    15c4:	53                   	push   %ebx
+    15c5:	68 ba 5e 00 00       	push   $0x5eba
+    15ca:	6a 01                	push   $0x1
+    15cc:	e8 6f 3d 00 00       	call   5340 <printf>
+    exit();
+    15d1:	e8 5d 3b 00 00       	call   5133 <exit>
+    printf(1, "waitpid WNOHANG reaped a running child\n");
+    15d6:	53                   	push   %ebx
+    15d7:	53                   	push   %ebx
+    15d8:	68 00 71 00 00       	push   $0x7100
+    15dd:	6a 01                	push   $0x1
+    15df:	e8 5c 3d 00 00       	call   5340 <printf>
+    exit();
+    15e4:	e8 4a 3b 00 00       	call   5133 <exit>
+    printf(1, "fork failed\n");
+    15e9:	56                   	push   %esi
+    15ea:	56                   	push   %esi
+    15eb:	68 af 6d 00 00       	push   $0x6daf
+    15f0:	6a 01                	push   $0x1
+    15f2:	e8 49 3d 00 00       	call   5340 <printf>
+    exit();
+    15f7:	e8 37 3b 00 00       	call   5133 <exit>
+    exit();
+    15fc:	e8 32 3b 00 00       	call   5133 <exit>
+    sleep(20);
+    1601:	83 ec 0c             	sub    $0xc,%esp
+    1604:	6a 14                	push   $0x14
+    1606:	e8 b8 3b 00 00       	call   51c3 <sleep>
+    exit();
+    160b:	e8 23 3b 00 00       	call   5133 <exit>
+
+00001610 <parforktest>:
+{
+    1610:	55                   	push   %ebp
+    1611:	89 e5                	mov    %esp,%ebp
+    1613:	56                   	push   %esi
+    1614:	53                   	push   %ebx
+  printf(1, "parallel fork test\n");
+    1615:	bb 04 00 00 00       	mov    $0x4,%ebx
+    161a:	83 ec 08             	sub    $0x8,%esp
+    161d:	68 1b 5f 00 00       	push   $0x5f1b
+    1622:	6a 01                	push   $0x1
+    1624:	e8 17 3d 00 00       	call   5340 <printf>
+    1629:	83 c4 10             	add    $0x10,%esp
+    pids[i] = fork();
+    162c:	e8 fa 3a 00 00       	call   512b <fork>
+    if(pids[i] < 0){
+    1631:	85 c0                	test   %eax,%eax
+    1633:	78 77                	js     16ac <parforktest+0x9c>
+    if(pids[i] == 0){
+    1635:	74 39                	je     1670 <parforktest+0x60>
+  for(i = 0; i < 4; i++){
+    1637:	83 eb 01             	sub    $0x1,%ebx
+    163a:	75 f0                	jne    162c <parforktest+0x1c>
+    163c:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(wait() < 0){
+    1648:	e8 ee 3a 00 00       	call   513b <wait>
+    164d:	85 c0                	test   %eax,%eax
+    164f:	78 6f                	js     16c0 <parforktest+0xb0>
+  for(i = 0; i < 4; i++){
+    1651:	83 eb 01             	sub    $0x1,%ebx
+    1654:	75 f2                	jne    1648 <parforktest+0x38>
+  printf(1, "parallel fork test ok\n");
+    1656:	83 ec 08             	sub    $0x8,%esp
+    1659:	68 4b 5f 00 00       	push   $0x5f4b
+    165e:	6a 01                	push   $0x1
+    1660:	e8 db 3c 00 00       	call   5340 <printf>
+}
+    1665:	83 c4 10             	add    $0x10,%esp
+    1668:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    166b:	5b                   	pop    %ebx
+    166c:	5e                   	pop    %esi
+    166d:	5d                   	pop    %ebp
+    166e:	c3                   	ret
+    166f:	90                   	nop
+    1670:	be c8 00 00 00       	mov    $0xc8,%esi
+    1675:	8d 76 00             	lea    0x0(%esi),%esi
+        pid = fork();
+    1678:	e8 ae 3a 00 00       	call   512b <fork>
+    167d:	89 c3                	mov    %eax,%ebx
+        if(pid < 0)
+    167f:	85 c0                	test   %eax,%eax
+    1681:	78 0b                	js     168e <parforktest+0x7e>
+        if(pid == 0)
+    1683:	74 0e                	je     1693 <parforktest+0x83>
+        if(wait() != pid){
+    1685:	e8 b1 3a 00 00       	call   513b <wait>
+    168a:	39 d8                	cmp    %ebx,%eax
+    168c:	75 0a                	jne    1698 <parforktest+0x88>
+      for(j = 0; j < 200; j++){
+    168e:	83 ee 01             	sub    $0x1,%esi
+    1691:	75 e5                	jne    1678 <parforktest+0x68>
+          exit();
+    1693:	e8 9b 3a 00 00       	call   5133 <exit>
+          printf(1, "parallel fork: wait got the wrong child\n");
+    1698:	83 ec 08             	sub    $0x8,%esp
+    169b:	68 28 71 00 00       	push   $0x7128
+    16a0:	6a 01                	push   $0x1
+    16a2:	e8 99 3c 00 00       	call   5340 <printf>
+          exit();
+    16a7:	e8 87 3a 00 00       	call   5133 <exit>
+      printf(1, "fork failed\n");
+    16ac:	83 ec 08             	sub    $0x8,%esp
+    16af:	68 af 6d 00 00       	push   $0x6daf
+    16b4:	6a 01                	push   $0x1
+    16b6:	e8 85 3c 00 00       	call   5340 <printf>
+      exit();
+    16bb:	e8 73 3a 00 00       	call   5133 <exit>
+      printf(1, "parallel fork: wait failed\n");
+    16c0:	83 ec 08             	sub    $0x8,%esp
+    16c3:	68 2f 5f 00 00       	push   $0x5f2f
+    16c8:	6a 01                	push   $0x1
+    16ca:	e8 71 3c 00 00       	call   5340 <printf>
+      exit();
+    16cf:	e8 5f 3a 00 00       	call   5133 <exit>
+    16d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16df:	90                   	nop
+
+000016e0 <tracetest>:
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	56                   	push   %esi
+    16e5:	53                   	push   %ebx
+    16e6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "trace test\n");
+    16e9:	68 62 5f 00 00       	push   $0x5f62
+    16ee:	6a 01                	push   $0x1
+    16f0:	e8 4b 3c 00 00       	call   5340 <printf>
+  if((was = tracectl(1)) < 0){
+    16f5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    16fc:	e8 3a 3b 00 00       	call   523b <tracectl>
+    1701:	83 c4 10             	add    $0x10,%esp
+    1704:	85 c0                	test   %eax,%eax
+    1706:	0f 88 11 01 00 00    	js     181d <tracetest+0x13d>
+    170c:	89 c3                	mov    %eax,%ebx
+    170e:	66 90                	xchg   %ax,%ax
+  while(traceread(ev, 64) > 0)
+    1710:	83 ec 08             	sub    $0x8,%esp
+    1713:	6a 40                	push   $0x40
+    1715:	68 c0 b0 04 00       	push   $0x4b0c0
+    171a:	e8 24 3b 00 00       	call   5243 <traceread>
+    171f:	83 c4 10             	add    $0x10,%esp
+    1722:	85 c0                	test   %eax,%eax
+    1724:	7f ea                	jg     1710 <tracetest+0x30>
+  pid = fork();
+    1726:	e8 00 3a 00 00       	call   512b <fork>
+    172b:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    172d:	85 c0                	test   %eax,%eax
+    172f:	0f 88 d5 00 00 00    	js     180a <tracetest+0x12a>
+  if(pid == 0){
+    1735:	0f 84 c0 00 00 00    	je     17fb <tracetest+0x11b>
+  wait();
+    173b:	e8 fb 39 00 00       	call   513b <wait>
+  tracectl(was);
+    1740:	83 ec 0c             	sub    $0xc,%esp
+    1743:	53                   	push   %ebx
+  seen = 0;
+    1744:	31 db                	xor    %ebx,%ebx
+  tracectl(was);
+    1746:	e8 f0 3a 00 00       	call   523b <tracectl>
+  while((n = traceread(ev, 64)) > 0){
+    174b:	83 c4 10             	add    $0x10,%esp
+    174e:	66 90                	xchg   %ax,%ax
+    1750:	83 ec 08             	sub    $0x8,%esp
+    1753:	6a 40                	push   $0x40
+    1755:	68 c0 b0 04 00       	push   $0x4b0c0
+    175a:	e8 e4 3a 00 00       	call   5243 <traceread>
+    175f:	83 c4 10             	add    $0x10,%esp
+    1762:	89 c7                	mov    %eax,%edi
+    1764:	85 c0                	test   %eax,%eax
+    1766:	7e 4d                	jle    17b5 <tracetest+0xd5>
+    for(i = 0; i < n; i++){
+    1768:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    176b:	b8 c4 b0 04 00       	mov    $0x4b0c4,%eax
+    1770:	31 d2                	xor    %edx,%edx
+    1772:	eb 1f                	jmp    1793 <tracetest+0xb3>
+    1774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(ev[i].type == TR_WAKEUP)
+    1778:	83 f9 03             	cmp    $0x3,%ecx
+    177b:	75 2b                	jne    17a8 <tracetest+0xc8>
+        seen |= 2;
+    177d:	83 cb 02             	or     $0x2,%ebx
+      if(ev[i].nsec >= 1000000000){
+    1780:	81 38 ff c9 9a 3b    	cmpl   $0x3b9ac9ff,(%eax)
+    1786:	77 4c                	ja     17d4 <tracetest+0xf4>
+    for(i = 0; i < n; i++){
+    1788:	83 c2 01             	add    $0x1,%edx
+    178b:	83 c0 18             	add    $0x18,%eax
+    178e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+    1791:	74 bd                	je     1750 <tracetest+0x70>
+      if(ev[i].pid != pid)
+    1793:	39 70 0c             	cmp    %esi,0xc(%eax)
+    1796:	75 f0                	jne    1788 <tracetest+0xa8>
+      if(ev[i].type == TR_SLEEP)
+    1798:	8b 48 04             	mov    0x4(%eax),%ecx
+    179b:	83 f9 04             	cmp    $0x4,%ecx
+    179e:	75 d8                	jne    1778 <tracetest+0x98>
+        seen |= 1;
+    17a0:	83 cb 01             	or     $0x1,%ebx
+      if(ev[i].type == TR_SWITCHIN)
+    17a3:	eb db                	jmp    1780 <tracetest+0xa0>
+    17a5:	8d 76 00             	lea    0x0(%esi),%esi
+        seen |= 4;
+    17a8:	89 df                	mov    %ebx,%edi
+    17aa:	83 cf 04             	or     $0x4,%edi
+    17ad:	83 f9 01             	cmp    $0x1,%ecx
+    17b0:	0f 44 df             	cmove  %edi,%ebx
+    17b3:	eb cb                	jmp    1780 <tracetest+0xa0>
+  if(seen != 7){
+    17b5:	83 fb 07             	cmp    $0x7,%ebx
+    17b8:	75 2e                	jne    17e8 <tracetest+0x108>
+  printf(1, "trace test ok\n");
+    17ba:	83 ec 08             	sub    $0x8,%esp
+    17bd:	68 aa 5f 00 00       	push   $0x5faa
+    17c2:	6a 01                	push   $0x1
+    17c4:	e8 77 3b 00 00       	call   5340 <printf>
+}
+    17c9:	83 c4 10             	add    $0x10,%esp
+    17cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17cf:	5b                   	pop    %ebx
+    17d0:	5e                   	pop    %esi
+    17d1:	5f                   	pop    %edi
+    17d2:	5d                   	pop    %ebp
+    17d3:	c3                   	ret
+        printf(1, "trace: bad time\n");
+    17d4:	83 ec 08             	sub    $0x8,%esp
+    17d7:	68 7f 5f 00 00       	push   $0x5f7f
+    17dc:	6a 01                	push   $0x1
+    17de:	e8 5d 3b 00 00       	call   5340 <printf>
+        exit();
+    17e3:	e8 4b 39 00 00       	call   5133 <exit>
+    printf(1, "trace: missing events %x\n", seen);
+    17e8:	50                   	push   %eax
+    17e9:	53                   	push   %ebx
+    17ea:	68 90 5f 00 00       	push   $0x5f90
+    17ef:	6a 01                	push   $0x1
+    17f1:	e8 4a 3b 00 00       	call   5340 <printf>
+    exit();
+    17f6:	e8 38 39 00 00       	call   5133 <exit>
+    sleep(2);
+    17fb:	83 ec 0c             	sub    $0xc,%esp
+    17fe:	6a 02                	push   $0x2
+    1800:	e8 be 39 00 00       	call   51c3 <sleep>
+    exit();
+    1805:	e8 29 39 00 00       	call   5133 <exit>
+    printf(1, "fork failed\n");
+    180a:	52                   	push   %edx
+    180b:	52                   	push   %edx
+    180c:	68 af 6d 00 00       	push   $0x6daf
+    1811:	6a 01                	push   $0x1
+    1813:	e8 28 3b 00 00       	call   5340 <printf>
+    exit();
+    1818:	e8 16 39 00 00       	call   5133 <exit>
+    printf(1, "tracectl failed\n");
+    181d:	51                   	push   %ecx
+    181e:	51                   	push   %ecx
+    181f:	68 6e 5f 00 00       	push   $0x5f6e
+    1824:	6a 01                	push   $0x1
+    1826:	e8 15 3b 00 00       	call   5340 <printf>
+    exit();
+    182b:	e8 03 39 00 00       	call   5133 <exit>
+
+00001830 <edftest>:
+{
+    1830:	55                   	push   %ebp
+    1831:	89 e5                	mov    %esp,%ebp
+    1833:	57                   	push   %edi
+    1834:	56                   	push   %esi
+    1835:	53                   	push   %ebx
+    1836:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "edf test\n");
+    1839:	68 b9 5f 00 00       	push   $0x5fb9
+    183e:	6a 01                	push   $0x1
+    1840:	e8 fb 3a 00 00       	call   5340 <printf>
+  if(sched_setdeadline(0, 2000, 1000, 5000) >= 0 ||
+    1845:	68 88 13 00 00       	push   $0x1388
+    184a:	68 e8 03 00 00       	push   $0x3e8
+    184f:	68 d0 07 00 00       	push   $0x7d0
+    1854:	6a 00                	push   $0x0
+    1856:	e8 f0 39 00 00       	call   524b <sched_setdeadline>
+    185b:	83 c4 20             	add    $0x20,%esp
+    185e:	85 c0                	test   %eax,%eax
+    1860:	0f 89 5b 02 00 00    	jns    1ac1 <edftest+0x291>
+     sched_setdeadline(0, 1000, 6000, 5000) >= 0){
+    1866:	68 88 13 00 00       	push   $0x1388
+    186b:	68 70 17 00 00       	push   $0x1770
+    1870:	68 e8 03 00 00       	push   $0x3e8
+    1875:	6a 00                	push   $0x0
+    1877:	e8 cf 39 00 00       	call   524b <sched_setdeadline>
+  if(sched_setdeadline(0, 2000, 1000, 5000) >= 0 ||
+    187c:	83 c4 10             	add    $0x10,%esp
+    187f:	85 c0                	test   %eax,%eax
+    1881:	0f 89 3a 02 00 00    	jns    1ac1 <edftest+0x291>
+  if(pipe(fd) < 0){
+    1887:	83 ec 0c             	sub    $0xc,%esp
+    188a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    188d:	50                   	push   %eax
+    188e:	e8 b0 38 00 00       	call   5143 <pipe>
+    1893:	83 c4 10             	add    $0x10,%esp
+    1896:	85 c0                	test   %eax,%eax
+    1898:	0f 88 10 02 00 00    	js     1aae <edftest+0x27e>
+  for(n = 0; n < 2*NCPU && !refused; n++){
+    189e:	31 db                	xor    %ebx,%ebx
+    18a0:	eb 0e                	jmp    18b0 <edftest+0x80>
+    18a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    18a8:	89 f0                	mov    %esi,%eax
+    18aa:	84 c0                	test   %al,%al
+    18ac:	74 3e                	je     18ec <edftest+0xbc>
+    18ae:	89 fb                	mov    %edi,%ebx
+    if((pid = fork()) == 0){
+    18b0:	e8 76 38 00 00       	call   512b <fork>
+    18b5:	85 c0                	test   %eax,%eax
+    18b7:	0f 84 7c 01 00 00    	je     1a39 <edftest+0x209>
+    if(pid < 0){
+    18bd:	0f 88 97 01 00 00    	js     1a5a <edftest+0x22a>
+    refused = sched_setdeadline(pid, 9000, 10000, 10000) < 0;
+    18c3:	68 10 27 00 00       	push   $0x2710
+  for(n = 0; n < 2*NCPU && !refused; n++){
+    18c8:	8d 7b 01             	lea    0x1(%ebx),%edi
+    refused = sched_setdeadline(pid, 9000, 10000, 10000) < 0;
+    18cb:	68 10 27 00 00       	push   $0x2710
+    18d0:	68 28 23 00 00       	push   $0x2328
+    18d5:	50                   	push   %eax
+    18d6:	e8 70 39 00 00       	call   524b <sched_setdeadline>
+  for(n = 0; n < 2*NCPU && !refused; n++){
+    18db:	83 c4 10             	add    $0x10,%esp
+    18de:	89 c6                	mov    %eax,%esi
+    refused = sched_setdeadline(pid, 9000, 10000, 10000) < 0;
+    18e0:	89 c2                	mov    %eax,%edx
+  for(n = 0; n < 2*NCPU && !refused; n++){
+    18e2:	f7 d6                	not    %esi
+    18e4:	c1 ee 1f             	shr    $0x1f,%esi
+    18e7:	83 ff 3f             	cmp    $0x3f,%edi
+    18ea:	7e bc                	jle    18a8 <edftest+0x78>
+  close(fd[0]);
+    18ec:	83 ec 0c             	sub    $0xc,%esp
+    18ef:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+    18f2:	ff 75 c0             	push   -0x40(%ebp)
+    18f5:	e8 61 38 00 00       	call   515b <close>
+  close(fd[1]);
+    18fa:	58                   	pop    %eax
+    18fb:	ff 75 c4             	push   -0x3c(%ebp)
+    18fe:	e8 58 38 00 00       	call   515b <close>
+  for(i = 0; i < n; i++)
+    1903:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+    190a:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    190d:	83 c4 10             	add    $0x10,%esp
+    1910:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+    wait();
+    1913:	e8 23 38 00 00       	call   513b <wait>
+  for(i = 0; i < n; i++)
+    1918:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    191b:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    191e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1921:	39 d8                	cmp    %ebx,%eax
+    1923:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+    1926:	7c e8                	jl     1910 <edftest+0xe0>
+  if(!refused || n < 2){
+    1928:	83 ff 01             	cmp    $0x1,%edi
+    192b:	0f 8e 3d 01 00 00    	jle    1a6e <edftest+0x23e>
+    1931:	89 f0                	mov    %esi,%eax
+    1933:	84 c0                	test   %al,%al
+    1935:	0f 85 33 01 00 00    	jne    1a6e <edftest+0x23e>
+  if(sched_setdeadline(0, 2000, 10000, 10000) < 0){
+    193b:	68 10 27 00 00       	push   $0x2710
+    1940:	68 10 27 00 00       	push   $0x2710
+    1945:	68 d0 07 00 00       	push   $0x7d0
+    194a:	6a 00                	push   $0x0
+    194c:	e8 fa 38 00 00       	call   524b <sched_setdeadline>
+    1951:	83 c4 10             	add    $0x10,%esp
+    1954:	85 c0                	test   %eax,%eax
+    1956:	0f 88 3f 01 00 00    	js     1a9b <edftest+0x26b>
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+    195c:	83 ec 08             	sub    $0x8,%esp
+    195f:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    1962:	56                   	push   %esi
+    1963:	6a 01                	push   $0x1
+    1965:	e8 79 38 00 00       	call   51e3 <clock_gettime>
+  t0 = ts.tv_sec*1000 + ts.tv_nsec/1000000;
+    196a:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+    196f:	f7 65 cc             	mull   -0x34(%ebp)
+  for(i = 0; i < 3; i++)
+    1972:	83 c4 10             	add    $0x10,%esp
+  t0 = ts.tv_sec*1000 + ts.tv_nsec/1000000;
+    1975:	69 7d c8 e8 03 00 00 	imul   $0x3e8,-0x38(%ebp),%edi
+  for(i = 0; i < 3; i++)
+    197c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  t0 = ts.tv_sec*1000 + ts.tv_nsec/1000000;
+    1983:	89 d3                	mov    %edx,%ebx
+    1985:	c1 eb 12             	shr    $0x12,%ebx
+  for(i = 0; i < 3; i++)
+    1988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198f:	90                   	nop
+    sched_dlyield();
+    1990:	e8 be 38 00 00       	call   5253 <sched_dlyield>
+  for(i = 0; i < 3; i++)
+    1995:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    1998:	83 c0 01             	add    $0x1,%eax
+    199b:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    199e:	83 f8 02             	cmp    $0x2,%eax
+    19a1:	7e ed                	jle    1990 <edftest+0x160>
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+    19a3:	83 ec 08             	sub    $0x8,%esp
+    19a6:	56                   	push   %esi
+    19a7:	6a 01                	push   $0x1
+    19a9:	e8 35 38 00 00       	call   51e3 <clock_gettime>
+  if(ts.tv_sec*1000 + ts.tv_nsec/1000000 - t0 < 20){
+    19ae:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+    19b3:	f7 65 cc             	mull   -0x34(%ebp)
+    19b6:	83 c4 10             	add    $0x10,%esp
+    19b9:	69 4d c8 e8 03 00 00 	imul   $0x3e8,-0x38(%ebp),%ecx
+    19c0:	c1 ea 12             	shr    $0x12,%edx
+    19c3:	01 d1                	add    %edx,%ecx
+    19c5:	29 f9                	sub    %edi,%ecx
+    19c7:	29 d9                	sub    %ebx,%ecx
+    19c9:	83 f9 13             	cmp    $0x13,%ecx
+    19cc:	0f 86 b6 00 00 00    	jbe    1a88 <edftest+0x258>
+  if(sched_dlstat(0, &ds) < 0 || ds.jobs != 3 || ds.period != 10000){
+    19d2:	83 ec 08             	sub    $0x8,%esp
+    19d5:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    19d8:	50                   	push   %eax
+    19d9:	6a 00                	push   $0x0
+    19db:	e8 7b 38 00 00       	call   525b <sched_dlstat>
+    19e0:	83 c4 10             	add    $0x10,%esp
+    19e3:	85 c0                	test   %eax,%eax
+    19e5:	0f 88 fc 00 00 00    	js     1ae7 <edftest+0x2b7>
+    19eb:	83 7d dc 03          	cmpl   $0x3,-0x24(%ebp)
+    19ef:	0f 85 f2 00 00 00    	jne    1ae7 <edftest+0x2b7>
+    19f5:	81 7d d8 10 27 00 00 	cmpl   $0x2710,-0x28(%ebp)
+    19fc:	0f 85 e5 00 00 00    	jne    1ae7 <edftest+0x2b7>
+  sched_setdeadline(0, 0, 0, 0);
+    1a02:	6a 00                	push   $0x0
+    1a04:	6a 00                	push   $0x0
+    1a06:	6a 00                	push   $0x0
+    1a08:	6a 00                	push   $0x0
+    1a0a:	e8 3c 38 00 00       	call   524b <sched_setdeadline>
+  if(sched_dlyield() >= 0){
+    1a0f:	e8 3f 38 00 00       	call   5253 <sched_dlyield>
+    1a14:	83 c4 10             	add    $0x10,%esp
+    1a17:	85 c0                	test   %eax,%eax
+    1a19:	0f 89 b5 00 00 00    	jns    1ad4 <edftest+0x2a4>
+  printf(1, "edf test ok\n");
+    1a1f:	83 ec 08             	sub    $0x8,%esp
+    1a22:	68 09 60 00 00       	push   $0x6009
+    1a27:	6a 01                	push   $0x1
+    1a29:	e8 12 39 00 00       	call   5340 <printf>
+}
+    1a2e:	83 c4 10             	add    $0x10,%esp
+    1a31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a34:	5b                   	pop    %ebx
+    1a35:	5e                   	pop    %esi
+    1a36:	5f                   	pop    %edi
+    1a37:	5d                   	pop    %ebp
+    1a38:	c3                   	ret
+      close(fd[1]);
+    1a39:	83 ec 0c             	sub    $0xc,%esp
+    1a3c:	ff 75 c4             	push   -0x3c(%ebp)
+    1a3f:	e8 17 37 00 00       	call   515b <close>
+      read(fd[0], &i, 1);
+    1a44:	83 c4 0c             	add    $0xc,%esp
+    1a47:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    1a4a:	6a 01                	push   $0x1
+    1a4c:	50                   	push   %eax
+    1a4d:	ff 75 c0             	push   -0x40(%ebp)
+    1a50:	e8 f6 36 00 00       	call   514b <read>
+      exit();
+    1a55:	e8 d9 36 00 00       	call   5133 <exit>
+      printf(1, "fork failed\n");
+    1a5a:	83 ec 08             	sub    $0x8,%esp
+    1a5d:	68 af 6d 00 00       	push   $0x6daf
+    1a62:	6a 01                	push   $0x1
+    1a64:	e8 d7 38 00 00       	call   5340 <printf>
+      exit();
+    1a69:	e8 c5 36 00 00       	call   5133 <exit>
+    refused = sched_setdeadline(pid, 9000, 10000, 10000) < 0;
+    1a6e:	c1 ea 1f             	shr    $0x1f,%edx
+    printf(1, "edf: admitted %d of 90%% each\n", n - refused);
+    1a71:	89 f8                	mov    %edi,%eax
+    1a73:	53                   	push   %ebx
+    1a74:	29 d0                	sub    %edx,%eax
+    1a76:	50                   	push   %eax
+    1a77:	68 54 71 00 00       	push   $0x7154
+    1a7c:	6a 01                	push   $0x1
+    1a7e:	e8 bd 38 00 00       	call   5340 <printf>
+    exit();
+    1a83:	e8 ab 36 00 00       	call   5133 <exit>
+    printf(1, "edf: periods too short\n");
+    1a88:	52                   	push   %edx
+    1a89:	52                   	push   %edx
+    1a8a:	68 e1 5f 00 00       	push   $0x5fe1
+    1a8f:	6a 01                	push   $0x1
+    1a91:	e8 aa 38 00 00       	call   5340 <printf>
+    exit();
+    1a96:	e8 98 36 00 00       	call   5133 <exit>
+    printf(1, "edf: reservation not given back\n");
+    1a9b:	51                   	push   %ecx
+    1a9c:	51                   	push   %ecx
+    1a9d:	68 74 71 00 00       	push   $0x7174
+    1aa2:	6a 01                	push   $0x1
+    1aa4:	e8 97 38 00 00       	call   5340 <printf>
+    exit();
+    1aa9:	e8 85 36 00 00       	call   5133 <exit>
+    printf(1, "pipe failed\n");
+    1aae:	50                   	push   %eax
+    1aaf:	50                   	push   %eax
+    1ab0:	68 59 5e 00 00       	push   $0x5e59
+    1ab5:	6a 01                	push   $0x1
+    1ab7:	e8 84 38 00 00       	call   5340 <printf>
+    exit();
+    1abc:	e8 72 36 00 00       	call   5133 <exit>
+    printf(1, "edf: bad parameters accepted\n");
+    1ac1:	50                   	push   %eax
+    1ac2:	50                   	push   %eax
+    1ac3:	68 c3 5f 00 00       	push   $0x5fc3
+    1ac8:	6a 01                	push   $0x1
+    1aca:	e8 71 38 00 00       	call   5340 <printf>
+    exit();
+    1acf:	e8 5f 36 00 00       	call   5133 <exit>
+    printf(1, "edf: dlyield as a normal process\n");
+    1ad4:	50                   	push   %eax
+    1ad5:	50                   	push   %eax
+    1ad6:	68 98 71 00 00       	push   $0x7198
+    1adb:	6a 01                	push   $0x1
+    1add:	e8 5e 38 00 00       	call   5340 <printf>
+    exit();
+    1ae2:	e8 4c 36 00 00       	call   5133 <exit>
+    printf(1, "edf: bad stats\n");
+    1ae7:	83 ec 08             	sub    $0x8,%esp
+    1aea:	68 f9 5f 00 00       	push   $0x5ff9
+    1aef:	6a 01                	push   $0x1
+    1af1:	e8 4a 38 00 00       	call   5340 <printf>
+    exit();
+    1af6:	e8 38 36 00 00       	call   5133 <exit>
+    1afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1aff:	90                   	nop
+
+00001b00 <irqtest>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "irq test\n");
+    1b09:	68 16 60 00 00       	push   $0x6016
+    1b0e:	6a 01                	push   $0x1
+    1b10:	e8 2b 38 00 00       	call   5340 <printf>
+  if(irqstat(ii, NIRQ) != NIRQ){
+    1b15:	58                   	pop    %eax
+    1b16:	5a                   	pop    %edx
+    1b17:	6a 20                	push   $0x20
+    1b19:	68 c0 9f 04 00       	push   $0x49fc0
+    1b1e:	e8 48 37 00 00       	call   526b <irqstat>
+    1b23:	83 c4 10             	add    $0x10,%esp
+    1b26:	83 f8 20             	cmp    $0x20,%eax
+    1b29:	0f 85 2d 01 00 00    	jne    1c5c <irqtest+0x15c>
+  if(irqroute(NIRQ, 0) >= 0 || irqroute(IRQ_IDE, NCPU) >= 0){
+    1b2f:	83 ec 08             	sub    $0x8,%esp
+    1b32:	6a 00                	push   $0x0
+    1b34:	6a 20                	push   $0x20
+    1b36:	e8 28 37 00 00       	call   5263 <irqroute>
+    1b3b:	83 c4 10             	add    $0x10,%esp
+    1b3e:	85 c0                	test   %eax,%eax
+    1b40:	0f 89 f0 00 00 00    	jns    1c36 <irqtest+0x136>
+    1b46:	83 ec 08             	sub    $0x8,%esp
+    1b49:	6a 20                	push   $0x20
+    1b4b:	6a 0e                	push   $0xe
+    1b4d:	e8 11 37 00 00       	call   5263 <irqroute>
+    1b52:	83 c4 10             	add    $0x10,%esp
+    1b55:	85 c0                	test   %eax,%eax
+    1b57:	0f 89 d9 00 00 00    	jns    1c36 <irqtest+0x136>
+  if(ii[IRQ_IDE].cpu < 0){
+    1b5d:	8b 1d 30 a7 04 00    	mov    0x4a730,%ebx
+    1b63:	85 db                	test   %ebx,%ebx
+    1b65:	0f 88 b4 00 00 00    	js     1c1f <irqtest+0x11f>
+  if(irqroute(IRQ_IDE, 0) < 0){
+    1b6b:	83 ec 08             	sub    $0x8,%esp
+    1b6e:	6a 00                	push   $0x0
+    1b70:	6a 0e                	push   $0xe
+    1b72:	e8 ec 36 00 00       	call   5263 <irqroute>
+    1b77:	83 c4 10             	add    $0x10,%esp
+    1b7a:	85 c0                	test   %eax,%eax
+    1b7c:	0f 88 ed 00 00 00    	js     1c6f <irqtest+0x16f>
+  irqstat(ii, NIRQ);
+    1b82:	83 ec 08             	sub    $0x8,%esp
+  fd = open("irqfile", O_CREATE|O_RDWR);
+    1b85:	bb 14 00 00 00       	mov    $0x14,%ebx
+  irqstat(ii, NIRQ);
+    1b8a:	6a 20                	push   $0x20
+    1b8c:	68 c0 9f 04 00       	push   $0x49fc0
+    1b91:	e8 d5 36 00 00       	call   526b <irqstat>
+  fd = open("irqfile", O_CREATE|O_RDWR);
+    1b96:	58                   	pop    %eax
+  before = ii[IRQ_IDE].count[0];
+    1b97:	8b 3d 38 a7 04 00    	mov    0x4a738,%edi
+  fd = open("irqfile", O_CREATE|O_RDWR);
+    1b9d:	5a                   	pop    %edx
+    1b9e:	68 02 02 00 00       	push   $0x202
+    1ba3:	68 69 60 00 00       	push   $0x6069
+    1ba8:	e8 c6 35 00 00       	call   5173 <open>
+    1bad:	83 c4 10             	add    $0x10,%esp
+    1bb0:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++)
+    1bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, buf, sizeof(buf));
+    1bb8:	83 ec 04             	sub    $0x4,%esp
+    1bbb:	68 00 20 00 00       	push   $0x2000
+    1bc0:	68 00 6f 04 00       	push   $0x46f00
+    1bc5:	56                   	push   %esi
+    1bc6:	e8 88 35 00 00       	call   5153 <write>
+  for(i = 0; i < 20; i++)
+    1bcb:	83 c4 10             	add    $0x10,%esp
+    1bce:	83 eb 01             	sub    $0x1,%ebx
+    1bd1:	75 e5                	jne    1bb8 <irqtest+0xb8>
+  close(fd);
+    1bd3:	83 ec 0c             	sub    $0xc,%esp
+    1bd6:	56                   	push   %esi
+    1bd7:	e8 7f 35 00 00       	call   515b <close>
+  unlink("irqfile");
+    1bdc:	c7 04 24 69 60 00 00 	movl   $0x6069,(%esp)
+    1be3:	e8 9b 35 00 00       	call   5183 <unlink>
+  irqstat(ii, NIRQ);
+    1be8:	59                   	pop    %ecx
+    1be9:	5b                   	pop    %ebx
+    1bea:	6a 20                	push   $0x20
+    1bec:	68 c0 9f 04 00       	push   $0x49fc0
+    1bf1:	e8 75 36 00 00       	call   526b <irqstat>
+  irqroute(IRQ_IDE, -1);
+    1bf6:	5e                   	pop    %esi
+    1bf7:	58                   	pop    %eax
+    1bf8:	6a ff                	push   $0xffffffff
+    1bfa:	6a 0e                	push   $0xe
+    1bfc:	e8 62 36 00 00       	call   5263 <irqroute>
+  if(ii[IRQ_IDE].cpu != 0 || !ii[IRQ_IDE].pinned || ii[IRQ_IDE].count[0] == before){
+    1c01:	a1 30 a7 04 00       	mov    0x4a730,%eax
+    1c06:	83 c4 10             	add    $0x10,%esp
+    1c09:	85 c0                	test   %eax,%eax
+    1c0b:	75 3c                	jne    1c49 <irqtest+0x149>
+    1c0d:	8b 15 34 a7 04 00    	mov    0x4a734,%edx
+    1c13:	85 d2                	test   %edx,%edx
+    1c15:	74 32                	je     1c49 <irqtest+0x149>
+    1c17:	39 3d 38 a7 04 00    	cmp    %edi,0x4a738
+    1c1d:	74 2a                	je     1c49 <irqtest+0x149>
+    printf(1, "irq test ok\n");
+    1c1f:	83 ec 08             	sub    $0x8,%esp
+    1c22:	68 49 60 00 00       	push   $0x6049
+    1c27:	6a 01                	push   $0x1
+    1c29:	e8 12 37 00 00       	call   5340 <printf>
+}
+    1c2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c31:	5b                   	pop    %ebx
+    1c32:	5e                   	pop    %esi
+    1c33:	5f                   	pop    %edi
+    1c34:	5d                   	pop    %ebp
+    1c35:	c3                   	ret
+    printf(1, "irq: bad route accepted\n");
+    1c36:	56                   	push   %esi
+    1c37:	56                   	push   %esi
+    1c38:	68 30 60 00 00       	push   $0x6030
+    1c3d:	6a 01                	push   $0x1
+    1c3f:	e8 fc 36 00 00       	call   5340 <printf>
+    exit();
+    1c44:	e8 ea 34 00 00       	call   5133 <exit>
+    printf(1, "irq: disk interrupts not on cpu 0\n");
+    1c49:	50                   	push   %eax
+    1c4a:	50                   	push   %eax
+    1c4b:	68 bc 71 00 00       	push   $0x71bc
+    1c50:	6a 01                	push   $0x1
+    1c52:	e8 e9 36 00 00       	call   5340 <printf>
+    exit();
+    1c57:	e8 d7 34 00 00       	call   5133 <exit>
+    printf(1, "irqstat failed\n");
+    1c5c:	57                   	push   %edi
+    1c5d:	57                   	push   %edi
+    1c5e:	68 20 60 00 00       	push   $0x6020
+    1c63:	6a 01                	push   $0x1
+    1c65:	e8 d6 36 00 00       	call   5340 <printf>
+    exit();
+    1c6a:	e8 c4 34 00 00       	call   5133 <exit>
+    printf(1, "irq: route failed\n");
+    1c6f:	51                   	push   %ecx
+    1c70:	51                   	push   %ecx
+    1c71:	68 56 60 00 00       	push   $0x6056
+    1c76:	6a 01                	push   $0x1
+    1c78:	e8 c3 36 00 00       	call   5340 <printf>
+    exit();
+    1c7d:	e8 b1 34 00 00       	call   5133 <exit>
+    1c82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c90 <locktest>:
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	56                   	push   %esi
+    1c94:	53                   	push   %ebx
+  printf(1, "lock test\n");
+    1c95:	83 ec 08             	sub    $0x8,%esp
+    1c98:	68 45 5d 00 00       	push   $0x5d45
+    1c9d:	6a 01                	push   $0x1
+    1c9f:	e8 9c 36 00 00       	call   5340 <printf>
+  if(lockbench(3, 10) >= 0 || lockbench(0, 0) >= 0){
+    1ca4:	5a                   	pop    %edx
+    1ca5:	59                   	pop    %ecx
+    1ca6:	6a 0a                	push   $0xa
+    1ca8:	6a 03                	push   $0x3
+    1caa:	e8 cc 35 00 00       	call   527b <lockbench>
+    1caf:	83 c4 10             	add    $0x10,%esp
+    1cb2:	85 c0                	test   %eax,%eax
+    1cb4:	0f 89 a0 00 00 00    	jns    1d5a <locktest+0xca>
+    1cba:	83 ec 08             	sub    $0x8,%esp
+    1cbd:	6a 00                	push   $0x0
+    1cbf:	6a 00                	push   $0x0
+    1cc1:	e8 b5 35 00 00       	call   527b <lockbench>
+    1cc6:	83 c4 10             	add    $0x10,%esp
+    1cc9:	85 c0                	test   %eax,%eax
+    1ccb:	0f 89 89 00 00 00    	jns    1d5a <locktest+0xca>
+  for(kind = 0; kind < 3; kind++){
+    1cd1:	31 f6                	xor    %esi,%esi
+{
+    1cd3:	bb 04 00 00 00       	mov    $0x4,%ebx
+      pid = fork();
+    1cd8:	e8 4e 34 00 00       	call   512b <fork>
+      if(pid < 0){
+    1cdd:	85 c0                	test   %eax,%eax
+    1cdf:	78 4e                	js     1d2f <locktest+0x9f>
+      if(pid == 0){
+    1ce1:	74 60                	je     1d43 <locktest+0xb3>
+    for(i = 0; i < 4; i++){
+    1ce3:	83 eb 01             	sub    $0x1,%ebx
+    1ce6:	75 f0                	jne    1cd8 <locktest+0x48>
+    if((n = lockbench(kind, 50)) <= 0){
+    1ce8:	83 ec 08             	sub    $0x8,%esp
+    1ceb:	6a 32                	push   $0x32
+    1ced:	56                   	push   %esi
+    1cee:	e8 88 35 00 00       	call   527b <lockbench>
+    1cf3:	83 c4 10             	add    $0x10,%esp
+    1cf6:	85 c0                	test   %eax,%eax
+    1cf8:	7e 73                	jle    1d6d <locktest+0xdd>
+      wait();
+    1cfa:	e8 3c 34 00 00       	call   513b <wait>
+  for(kind = 0; kind < 3; kind++){
+    1cff:	83 c6 01             	add    $0x1,%esi
+      wait();
+    1d02:	e8 34 34 00 00       	call   513b <wait>
+    1d07:	e8 2f 34 00 00       	call   513b <wait>
+    1d0c:	e8 2a 34 00 00       	call   513b <wait>
+  for(kind = 0; kind < 3; kind++){
+    1d11:	83 fe 03             	cmp    $0x3,%esi
+    1d14:	75 bd                	jne    1cd3 <locktest+0x43>
+  printf(1, "lock test ok\n");
+    1d16:	83 ec 08             	sub    $0x8,%esp
+    1d19:	68 8f 5d 00 00       	push   $0x5d8f
+    1d1e:	6a 01                	push   $0x1
+    1d20:	e8 1b 36 00 00       	call   5340 <printf>
+    1d25:	83 c4 10             	add    $0x10,%esp
+}
+    1d28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d2b:	5b                   	pop    %ebx
+    1d2c:	5e                   	pop    %esi
+    1d2d:	5d                   	pop    %ebp
+    1d2e:	c3                   	ret
+        printf(1, "fork failed\n");
+    1d2f:	83 ec 08             	sub    $0x8,%esp
+    1d32:	68 af 6d 00 00       	push   $0x6daf
+    1d37:	6a 01                	push   $0x1
+    1d39:	e8 02 36 00 00       	call   5340 <printf>
+        exit();
+    1d3e:	e8 f0 33 00 00       	call   5133 <exit>
+        if(lockbench(kind, 50) <= 0)
+    1d43:	83 ec 08             	sub    $0x8,%esp
+    1d46:	6a 32                	push   $0x32
+    1d48:	56                   	push   %esi
+    1d49:	e8 2d 35 00 00       	call   527b <lockbench>
+    1d4e:	83 c4 10             	add    $0x10,%esp
+    1d51:	85 c0                	test   %eax,%eax
+    1d53:	7e 2b                	jle    1d80 <locktest+0xf0>
+        exit();
+    1d55:	e8 d9 33 00 00       	call   5133 <exit>
+    printf(1, "lock: bad lockbench accepted\n");
+    1d5a:	50                   	push   %eax
+    1d5b:	50                   	push   %eax
+    1d5c:	68 71 60 00 00       	push   $0x6071
+    1d61:	6a 01                	push   $0x1
+    1d63:	e8 d8 35 00 00       	call   5340 <printf>
+    exit();
+    1d68:	e8 c6 33 00 00       	call   5133 <exit>
+      printf(1, "lock: kind %d got %d\n", kind, n);
+    1d6d:	50                   	push   %eax
+    1d6e:	56                   	push   %esi
+    1d6f:	68 a6 60 00 00       	push   $0x60a6
+    1d74:	6a 01                	push   $0x1
+    1d76:	e8 c5 35 00 00       	call   5340 <printf>
+      exit();
+    1d7b:	e8 b3 33 00 00       	call   5133 <exit>
+          printf(1, "lock: kind %d starved\n", kind);
+    1d80:	83 ec 04             	sub    $0x4,%esp
+    1d83:	56                   	push   %esi
+    1d84:	68 8f 60 00 00       	push   $0x608f
+    1d89:	6a 01                	push   $0x1
+    1d8b:	e8 b0 35 00 00       	call   5340 <printf>
+    1d90:	83 c4 10             	add    $0x10,%esp
+    1d93:	eb c0                	jmp    1d55 <locktest+0xc5>
+    1d95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001da0 <lockstattest>:
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	57                   	push   %edi
+    1da4:	56                   	push   %esi
+    1da5:	53                   	push   %ebx
+    1da6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "lockstat test\n");
+    1da9:	68 bc 60 00 00       	push   $0x60bc
+    1dae:	6a 01                	push   $0x1
+    1db0:	e8 8b 35 00 00       	call   5340 <printf>
+  if(lockstat(ls, -1) >= 0){
+    1db5:	58                   	pop    %eax
+    1db6:	5a                   	pop    %edx
+    1db7:	6a ff                	push   $0xffffffff
+    1db9:	68 80 97 04 00       	push   $0x49780
+    1dbe:	e8 c0 34 00 00       	call   5283 <lockstat>
+    1dc3:	83 c4 10             	add    $0x10,%esp
+    1dc6:	85 c0                	test   %eax,%eax
+    1dc8:	0f 89 fc 00 00 00    	jns    1eca <lockstattest+0x12a>
+  n = lockstat(ls, NLOCKCLASS);
+    1dce:	83 ec 08             	sub    $0x8,%esp
+    1dd1:	6a 30                	push   $0x30
+    1dd3:	68 80 97 04 00       	push   $0x49780
+    1dd8:	e8 a6 34 00 00       	call   5283 <lockstat>
+  for(i = 0; i < n; i++){
+    1ddd:	83 c4 10             	add    $0x10,%esp
+  n = lockstat(ls, NLOCKCLASS);
+    1de0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++){
+    1de2:	85 c0                	test   %eax,%eax
+    1de4:	0f 8e b7 00 00 00    	jle    1ea1 <lockstattest+0x101>
+  ptable = bcache = 0;
+    1dea:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    1df1:	be 80 97 04 00       	mov    $0x49780,%esi
+  for(i = 0; i < n; i++){
+    1df6:	31 db                	xor    %ebx,%ebx
+  ptable = bcache = 0;
+    1df8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    1dff:	90                   	nop
+    if(strcmp(ls[i].name, "ptable") == 0 && ls[i].nacquire > 0 && !ls[i].sleep)
+    1e00:	83 ec 08             	sub    $0x8,%esp
+    1e03:	68 e9 60 00 00       	push   $0x60e9
+    1e08:	56                   	push   %esi
+    1e09:	e8 12 31 00 00       	call   4f20 <strcmp>
+    1e0e:	83 c4 10             	add    $0x10,%esp
+    1e11:	85 c0                	test   %eax,%eax
+    1e13:	75 18                	jne    1e2d <lockstattest+0x8d>
+    1e15:	8b 46 14             	mov    0x14(%esi),%eax
+    1e18:	85 c0                	test   %eax,%eax
+    1e1a:	74 11                	je     1e2d <lockstattest+0x8d>
+      ptable = 1;
+    1e1c:	8b 46 10             	mov    0x10(%esi),%eax
+    1e1f:	85 c0                	test   %eax,%eax
+    1e21:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e26:	0f 45 45 e4          	cmovne -0x1c(%ebp),%eax
+    1e2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(strcmp(ls[i].name, "buffer") == 0 && ls[i].nacquire > 0 && ls[i].sleep)
+    1e2d:	83 ec 08             	sub    $0x8,%esp
+    1e30:	68 f0 60 00 00       	push   $0x60f0
+    1e35:	56                   	push   %esi
+    1e36:	e8 e5 30 00 00       	call   4f20 <strcmp>
+    1e3b:	83 c4 10             	add    $0x10,%esp
+    1e3e:	85 c0                	test   %eax,%eax
+    1e40:	75 18                	jne    1e5a <lockstattest+0xba>
+    1e42:	8b 4e 14             	mov    0x14(%esi),%ecx
+    1e45:	85 c9                	test   %ecx,%ecx
+    1e47:	74 11                	je     1e5a <lockstattest+0xba>
+      bcache = 1;
+    1e49:	8b 56 10             	mov    0x10(%esi),%edx
+    1e4c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e51:	85 d2                	test   %edx,%edx
+    1e53:	0f 44 45 e0          	cmove  -0x20(%ebp),%eax
+    1e57:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(ls[i].nspinwon > ls[i].nspin || (ls[i].nspin && !ls[i].sleep)){
+    1e5a:	8b 46 24             	mov    0x24(%esi),%eax
+    1e5d:	3b 46 28             	cmp    0x28(%esi),%eax
+    1e60:	72 53                	jb     1eb5 <lockstattest+0x115>
+    1e62:	85 c0                	test   %eax,%eax
+    1e64:	74 07                	je     1e6d <lockstattest+0xcd>
+    1e66:	8b 46 10             	mov    0x10(%esi),%eax
+    1e69:	85 c0                	test   %eax,%eax
+    1e6b:	74 48                	je     1eb5 <lockstattest+0x115>
+  for(i = 0; i < n; i++){
+    1e6d:	83 c3 01             	add    $0x1,%ebx
+    1e70:	83 c6 2c             	add    $0x2c,%esi
+    1e73:	39 df                	cmp    %ebx,%edi
+    1e75:	75 89                	jne    1e00 <lockstattest+0x60>
+  if(!ptable || !bcache){
+    1e77:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1e7a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    1e7d:	83 f6 01             	xor    $0x1,%esi
+    1e80:	83 f7 01             	xor    $0x1,%edi
+    1e83:	09 fe                	or     %edi,%esi
+    1e85:	75 1a                	jne    1ea1 <lockstattest+0x101>
+  printf(1, "lockstat test ok\n");
+    1e87:	83 ec 08             	sub    $0x8,%esp
+    1e8a:	68 f7 60 00 00       	push   $0x60f7
+    1e8f:	6a 01                	push   $0x1
+    1e91:	e8 aa 34 00 00       	call   5340 <printf>
+}
+    1e96:	83 c4 10             	add    $0x10,%esp
+    1e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e9c:	5b                   	pop    %ebx
+    1e9d:	5e                   	pop    %esi
+    1e9e:	5f                   	pop    %edi
+    1e9f:	5d                   	pop    %ebp
+    1ea0:	c3                   	ret
+    printf(1, "lockstat: ptable or buffer locks not counted\n");
+    1ea1:	83 ec 08             	sub    $0x8,%esp
+    1ea4:	68 00 72 00 00       	push   $0x7200
+    1ea9:	6a 01                	push   $0x1
+    1eab:	e8 90 34 00 00       	call   5340 <printf>
+    exit();
+    1eb0:	e8 7e 32 00 00       	call   5133 <exit>
+      printf(1, "lockstat: %s: bad spin counts\n", ls[i].name);
+    1eb5:	83 ec 04             	sub    $0x4,%esp
+    1eb8:	56                   	push   %esi
+    1eb9:	68 e0 71 00 00       	push   $0x71e0
+    1ebe:	6a 01                	push   $0x1
+    1ec0:	e8 7b 34 00 00       	call   5340 <printf>
+      exit();
+    1ec5:	e8 69 32 00 00       	call   5133 <exit>
+    printf(1, "lockstat: bad count accepted\n");
+    1eca:	50                   	push   %eax
+    1ecb:	50                   	push   %eax
+    1ecc:	68 cb 60 00 00       	push   $0x60cb
+    1ed1:	6a 01                	push   $0x1
+    1ed3:	e8 68 34 00 00       	call   5340 <printf>
+    exit();
+    1ed8:	e8 56 32 00 00       	call   5133 <exit>
+    1edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001ee0 <icachetest>:
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	57                   	push   %edi
+    1ee4:	56                   	push   %esi
+    1ee5:	53                   	push   %ebx
+    1ee6:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "icache test\n");
+    1ee9:	68 09 61 00 00       	push   $0x6109
+    1eee:	6a 01                	push   $0x1
+    1ef0:	e8 4b 34 00 00       	call   5340 <printf>
+  if(stat(".", &st0) < 0){
+    1ef5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1ef8:	5a                   	pop    %edx
+    1ef9:	59                   	pop    %ecx
+    1efa:	50                   	push   %eax
+    1efb:	68 ef 66 00 00       	push   $0x66ef
+    1f00:	e8 6b 31 00 00       	call   5070 <stat>
+    1f05:	83 c4 10             	add    $0x10,%esp
+    1f08:	85 c0                	test   %eax,%eax
+    1f0a:	0f 88 cf 00 00 00    	js     1fdf <icachetest+0xff>
+    1f10:	bb 04 00 00 00       	mov    $0x4,%ebx
+    pid = fork();
+    1f15:	e8 11 32 00 00       	call   512b <fork>
+    if(pid < 0){
+    1f1a:	85 c0                	test   %eax,%eax
+    1f1c:	0f 88 a9 00 00 00    	js     1fcb <icachetest+0xeb>
+    if(pid == 0){
+    1f22:	74 3c                	je     1f60 <icachetest+0x80>
+  for(i = 0; i < 4; i++){
+    1f24:	83 eb 01             	sub    $0x1,%ebx
+    1f27:	75 ec                	jne    1f15 <icachetest+0x35>
+    wait();
+    1f29:	e8 0d 32 00 00       	call   513b <wait>
+    1f2e:	e8 08 32 00 00       	call   513b <wait>
+    1f33:	e8 03 32 00 00       	call   513b <wait>
+    1f38:	e8 fe 31 00 00       	call   513b <wait>
+  printf(1, "icache test ok\n");
+    1f3d:	83 ec 08             	sub    $0x8,%esp
+    1f40:	68 42 61 00 00       	push   $0x6142
+    1f45:	6a 01                	push   $0x1
+    1f47:	e8 f4 33 00 00       	call   5340 <printf>
+}
+    1f4c:	83 c4 10             	add    $0x10,%esp
+    1f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f52:	5b                   	pop    %ebx
+    1f53:	5e                   	pop    %esi
+    1f54:	5f                   	pop    %edi
+    1f55:	5d                   	pop    %ebp
+    1f56:	c3                   	ret
+    1f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f5e:	66 90                	xchg   %ax,%ax
+    1f60:	be f4 01 00 00       	mov    $0x1f4,%esi
+        if((fd = open(".", 0)) < 0 || fstat(fd, &st) < 0 || st.ino != st0.ino){
+    1f65:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+    1f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6f:	90                   	nop
+    1f70:	83 ec 08             	sub    $0x8,%esp
+    1f73:	6a 00                	push   $0x0
+    1f75:	68 ef 66 00 00       	push   $0x66ef
+    1f7a:	e8 f4 31 00 00       	call   5173 <open>
+    1f7f:	83 c4 10             	add    $0x10,%esp
+    1f82:	89 c3                	mov    %eax,%ebx
+    1f84:	85 c0                	test   %eax,%eax
+    1f86:	78 2f                	js     1fb7 <icachetest+0xd7>
+    1f88:	83 ec 08             	sub    $0x8,%esp
+    1f8b:	57                   	push   %edi
+    1f8c:	50                   	push   %eax
+    1f8d:	e8 f9 31 00 00       	call   518b <fstat>
+    1f92:	83 c4 10             	add    $0x10,%esp
+    1f95:	85 c0                	test   %eax,%eax
+    1f97:	78 1e                	js     1fb7 <icachetest+0xd7>
+    1f99:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    1f9c:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+    1f9f:	75 16                	jne    1fb7 <icachetest+0xd7>
+        close(fd);
+    1fa1:	83 ec 0c             	sub    $0xc,%esp
+    1fa4:	53                   	push   %ebx
+    1fa5:	e8 b1 31 00 00       	call   515b <close>
+      for(j = 0; j < 500; j++){
+    1faa:	83 c4 10             	add    $0x10,%esp
+    1fad:	83 ee 01             	sub    $0x1,%esi
+    1fb0:	75 be                	jne    1f70 <icachetest+0x90>
+      exit();
+    1fb2:	e8 7c 31 00 00       	call   5133 <exit>
+          printf(1, "icache: wrong inode\n");
+    1fb7:	83 ec 08             	sub    $0x8,%esp
+    1fba:	68 2d 61 00 00       	push   $0x612d
+    1fbf:	6a 01                	push   $0x1
+    1fc1:	e8 7a 33 00 00       	call   5340 <printf>
+          exit();
+    1fc6:	e8 68 31 00 00       	call   5133 <exit>
+      printf(1, "fork failed\n");
+    1fcb:	83 ec 08             	sub    $0x8,%esp
+    1fce:	68 af 6d 00 00       	push   $0x6daf
+    1fd3:	6a 01                	push   $0x1
+    1fd5:	e8 66 33 00 00       	call   5340 <printf>
+      exit();
+    1fda:	e8 54 31 00 00       	call   5133 <exit>
+    printf(1, "icache: stat . failed\n");
+    1fdf:	50                   	push   %eax
+    1fe0:	50                   	push   %eax
+    1fe1:	68 16 61 00 00       	push   $0x6116
+    1fe6:	6a 01                	push   $0x1
+    1fe8:	e8 53 33 00 00       	call   5340 <printf>
+    exit();
+    1fed:	e8 41 31 00 00       	call   5133 <exit>
+    1ff2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002000 <cpustattest>:
+{
+    2000:	55                   	push   %ebp
+    2001:	89 e5                	mov    %esp,%ebp
+    2003:	56                   	push   %esi
+    2004:	53                   	push   %ebx
+  printf(1, "cpustat test\n");
+    2005:	83 ec 08             	sub    $0x8,%esp
+    2008:	68 52 61 00 00       	push   $0x6152
+    200d:	6a 01                	push   $0x1
+    200f:	e8 2c 33 00 00       	call   5340 <printf>
+  n = cpustat(before, NCPU);
+    2014:	59                   	pop    %ecx
+    2015:	5b                   	pop    %ebx
+    2016:	6a 20                	push   $0x20
+    2018:	68 80 93 04 00       	push   $0x49380
+    201d:	e8 69 32 00 00       	call   528b <cpustat>
+  if(n < 1 || n > NCPU){
+    2022:	83 c4 10             	add    $0x10,%esp
+  n = cpustat(before, NCPU);
+    2025:	89 c6                	mov    %eax,%esi
+  if(n < 1 || n > NCPU){
+    2027:	83 e8 01             	sub    $0x1,%eax
+    202a:	83 f8 1f             	cmp    $0x1f,%eax
+    202d:	77 64                	ja     2093 <cpustattest+0x93>
+    202f:	bb 64 00 00 00       	mov    $0x64,%ebx
+    2034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    getpid();
+    2038:	e8 76 31 00 00       	call   51b3 <getpid>
+  for(i = 0; i < 100; i++)
+    203d:	83 eb 01             	sub    $0x1,%ebx
+    2040:	75 f6                	jne    2038 <cpustattest+0x38>
+  cpustat(after, NCPU);
+    2042:	83 ec 08             	sub    $0x8,%esp
+    2045:	6a 20                	push   $0x20
+    2047:	68 80 8f 04 00       	push   $0x48f80
+    204c:	e8 3a 32 00 00       	call   528b <cpustat>
+  for(i = 0; i < n; i++){
+    2051:	89 f0                	mov    %esi,%eax
+    2053:	83 c4 10             	add    $0x10,%esp
+  cpustat(after, NCPU);
+    2056:	31 d2                	xor    %edx,%edx
+    2058:	c1 e0 05             	shl    $0x5,%eax
+  nb = na = 0;
+    205b:	31 c9                	xor    %ecx,%ecx
+    205d:	8d 76 00             	lea    0x0(%esi),%esi
+    nb += before[i].stat[CS_SYSCALL];
+    2060:	03 9a 80 93 04 00    	add    0x49380(%edx),%ebx
+    na += after[i].stat[CS_SYSCALL];
+    2066:	03 8a 80 8f 04 00    	add    0x48f80(%edx),%ecx
+  for(i = 0; i < n; i++){
+    206c:	83 c2 20             	add    $0x20,%edx
+    206f:	39 d0                	cmp    %edx,%eax
+    2071:	75 ed                	jne    2060 <cpustattest+0x60>
+  if(na - nb < 100){
+    2073:	29 d9                	sub    %ebx,%ecx
+    2075:	83 f9 63             	cmp    $0x63,%ecx
+    2078:	76 2c                	jbe    20a6 <cpustattest+0xa6>
+  printf(1, "cpustat test ok\n");
+    207a:	83 ec 08             	sub    $0x8,%esp
+    207d:	68 72 61 00 00       	push   $0x6172
+    2082:	6a 01                	push   $0x1
+    2084:	e8 b7 32 00 00       	call   5340 <printf>
+}
+    2089:	83 c4 10             	add    $0x10,%esp
+    208c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    208f:	5b                   	pop    %ebx
+    2090:	5e                   	pop    %esi
+    2091:	5d                   	pop    %ebp
+    2092:	c3                   	ret
+    printf(1, "cpustat: %d cpus\n", n);
+    2093:	52                   	push   %edx
+    2094:	56                   	push   %esi
+    2095:	68 60 61 00 00       	push   $0x6160
+    209a:	6a 01                	push   $0x1
+    209c:	e8 9f 32 00 00       	call   5340 <printf>
+    exit();
+    20a1:	e8 8d 30 00 00       	call   5133 <exit>
+    printf(1, "cpustat: %d system calls counted, not 100\n", na - nb);
+    20a6:	50                   	push   %eax
+    20a7:	51                   	push   %ecx
+    20a8:	68 30 72 00 00       	push   $0x7230
+    20ad:	6a 01                	push   $0x1
+    20af:	e8 8c 32 00 00       	call   5340 <printf>
+    exit();
+    20b4:	e8 7a 30 00 00       	call   5133 <exit>
+    20b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000020c0 <bcachetest>:
+{
+    20c0:	55                   	push   %ebp
+    20c1:	89 e5                	mov    %esp,%ebp
+    20c3:	57                   	push   %edi
+    20c4:	56                   	push   %esi
+    20c5:	53                   	push   %ebx
+    20c6:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(1, "bcache test\n");
+    20cc:	68 83 61 00 00       	push   $0x6183
+    20d1:	6a 01                	push   $0x1
+    20d3:	e8 68 32 00 00       	call   5340 <printf>
+  old = bcachesize(1);
+    20d8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    20df:	e8 af 31 00 00       	call   5293 <bcachesize>
+  if(bcachesize(0) != NBUF){
+    20e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  old = bcachesize(1);
+    20eb:	89 c6                	mov    %eax,%esi
+  if(bcachesize(0) != NBUF){
+    20ed:	e8 a1 31 00 00       	call   5293 <bcachesize>
+    20f2:	83 c4 10             	add    $0x10,%esp
+    20f5:	83 f8 1e             	cmp    $0x1e,%eax
+    20f8:	0f 85 03 02 00 00    	jne    2301 <bcachetest+0x241>
+  name[0] = 'b';
+    20fe:	c6 85 e5 fd ff ff 62 	movb   $0x62,-0x21b(%ebp)
+  for(i = 0; i < 4; i++){
+    2105:	31 db                	xor    %ebx,%ebx
+  name[2] = 0;
+    2107:	c6 85 e7 fd ff ff 00 	movb   $0x0,-0x219(%ebp)
+    name[1] = '0' + i;
+    210e:	8d 43 30             	lea    0x30(%ebx),%eax
+    2111:	88 85 e6 fd ff ff    	mov    %al,-0x21a(%ebp)
+    pid = fork();
+    2117:	e8 0f 30 00 00       	call   512b <fork>
+    if(pid < 0){
+    211c:	85 c0                	test   %eax,%eax
+    211e:	0f 88 c9 01 00 00    	js     22ed <bcachetest+0x22d>
+    if(pid == 0){
+    2124:	0f 84 86 00 00 00    	je     21b0 <bcachetest+0xf0>
+  for(i = 0; i < 4; i++){
+    212a:	83 c3 01             	add    $0x1,%ebx
+    212d:	83 fb 04             	cmp    $0x4,%ebx
+    2130:	75 dc                	jne    210e <bcachetest+0x4e>
+    wait();
+    2132:	e8 04 30 00 00       	call   513b <wait>
+    unlink(name);
+    2137:	8d 9d e5 fd ff ff    	lea    -0x21b(%ebp),%ebx
+    wait();
+    213d:	e8 f9 2f 00 00       	call   513b <wait>
+    2142:	e8 f4 2f 00 00       	call   513b <wait>
+    2147:	e8 ef 2f 00 00       	call   513b <wait>
+    unlink(name);
+    214c:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+    214f:	c6 85 e6 fd ff ff 30 	movb   $0x30,-0x21a(%ebp)
+    unlink(name);
+    2156:	53                   	push   %ebx
+    2157:	e8 27 30 00 00       	call   5183 <unlink>
+    name[1] = '0' + i;
+    215c:	c6 85 e6 fd ff ff 31 	movb   $0x31,-0x21a(%ebp)
+    unlink(name);
+    2163:	89 1c 24             	mov    %ebx,(%esp)
+    2166:	e8 18 30 00 00       	call   5183 <unlink>
+    name[1] = '0' + i;
+    216b:	c6 85 e6 fd ff ff 32 	movb   $0x32,-0x21a(%ebp)
+    unlink(name);
+    2172:	89 1c 24             	mov    %ebx,(%esp)
+    2175:	e8 09 30 00 00       	call   5183 <unlink>
+    name[1] = '0' + i;
+    217a:	c6 85 e6 fd ff ff 33 	movb   $0x33,-0x21a(%ebp)
+    unlink(name);
+    2181:	89 1c 24             	mov    %ebx,(%esp)
+    2184:	e8 fa 2f 00 00       	call   5183 <unlink>
+  bcachesize(old);
+    2189:	89 34 24             	mov    %esi,(%esp)
+    218c:	e8 02 31 00 00       	call   5293 <bcachesize>
+  printf(1, "bcache test ok\n");
+    2191:	58                   	pop    %eax
+    2192:	5a                   	pop    %edx
+    2193:	68 da 61 00 00       	push   $0x61da
+    2198:	6a 01                	push   $0x1
+    219a:	e8 a1 31 00 00       	call   5340 <printf>
+}
+    219f:	83 c4 10             	add    $0x10,%esp
+    21a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21a5:	5b                   	pop    %ebx
+    21a6:	5e                   	pop    %esi
+    21a7:	5f                   	pop    %edi
+    21a8:	5d                   	pop    %ebp
+    21a9:	c3                   	ret
+    21aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      fd = open(name, O_CREATE|O_RDWR);
+    21b0:	83 ec 08             	sub    $0x8,%esp
+    21b3:	8d 85 e5 fd ff ff    	lea    -0x21b(%ebp),%eax
+      memset(data, 'a'+i, sizeof(data));
+    21b9:	83 c3 61             	add    $0x61,%ebx
+    21bc:	be 14 00 00 00       	mov    $0x14,%esi
+      fd = open(name, O_CREATE|O_RDWR);
+    21c1:	68 02 02 00 00       	push   $0x202
+      memset(data, 'a'+i, sizeof(data));
+    21c6:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+      fd = open(name, O_CREATE|O_RDWR);
+    21cc:	50                   	push   %eax
+    21cd:	e8 a1 2f 00 00       	call   5173 <open>
+      memset(data, 'a'+i, sizeof(data));
+    21d2:	83 c4 0c             	add    $0xc,%esp
+      fd = open(name, O_CREATE|O_RDWR);
+    21d5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+      memset(data, 'a'+i, sizeof(data));
+    21db:	68 00 02 00 00       	push   $0x200
+    21e0:	53                   	push   %ebx
+    21e1:	57                   	push   %edi
+    21e2:	e8 c9 2d 00 00       	call   4fb0 <memset>
+    21e7:	89 9d d0 fd ff ff    	mov    %ebx,-0x230(%ebp)
+    21ed:	83 c4 10             	add    $0x10,%esp
+    21f0:	8b 9d d4 fd ff ff    	mov    -0x22c(%ebp),%ebx
+    21f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21fd:	8d 76 00             	lea    0x0(%esi),%esi
+        if(write(fd, data, sizeof(data)) != sizeof(data)){
+    2200:	83 ec 04             	sub    $0x4,%esp
+    2203:	68 00 02 00 00       	push   $0x200
+    2208:	57                   	push   %edi
+    2209:	53                   	push   %ebx
+    220a:	e8 44 2f 00 00       	call   5153 <write>
+    220f:	83 c4 10             	add    $0x10,%esp
+    2212:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2217:	0f 85 bc 00 00 00    	jne    22d9 <bcachetest+0x219>
+      for(j = 0; j < 20; j++)
+    221d:	83 ee 01             	sub    $0x1,%esi
+    2220:	75 de                	jne    2200 <bcachetest+0x140>
+      close(fd);
+    2222:	83 ec 0c             	sub    $0xc,%esp
+    2225:	8b 9d d0 fd ff ff    	mov    -0x230(%ebp),%ebx
+    222b:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    2231:	e8 25 2f 00 00       	call   515b <close>
+    2236:	83 c4 10             	add    $0x10,%esp
+    2239:	c7 85 d0 fd ff ff 05 	movl   $0x5,-0x230(%ebp)
+    2240:	00 00 00 
+        fd = open(name, O_RDONLY);
+    2243:	83 ec 08             	sub    $0x8,%esp
+    2246:	8d 85 e5 fd ff ff    	lea    -0x21b(%ebp),%eax
+    224c:	be 14 00 00 00       	mov    $0x14,%esi
+    2251:	6a 00                	push   $0x0
+    2253:	50                   	push   %eax
+    2254:	e8 1a 2f 00 00       	call   5173 <open>
+    2259:	83 c4 10             	add    $0x10,%esp
+    225c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    2262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+          if(read(fd, data, sizeof(data)) != sizeof(data) ||
+    2268:	83 ec 04             	sub    $0x4,%esp
+    226b:	68 00 02 00 00       	push   $0x200
+    2270:	57                   	push   %edi
+    2271:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    2277:	e8 cf 2e 00 00       	call   514b <read>
+    227c:	83 c4 10             	add    $0x10,%esp
+    227f:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2284:	75 38                	jne    22be <bcachetest+0x1fe>
+             data[0] != 'a'+i || data[511] != 'a'+i){
+    2286:	0f be 85 e8 fd ff ff 	movsbl -0x218(%ebp),%eax
+          if(read(fd, data, sizeof(data)) != sizeof(data) ||
+    228d:	39 c3                	cmp    %eax,%ebx
+    228f:	75 2d                	jne    22be <bcachetest+0x1fe>
+             data[0] != 'a'+i || data[511] != 'a'+i){
+    2291:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+    2295:	39 c3                	cmp    %eax,%ebx
+    2297:	75 25                	jne    22be <bcachetest+0x1fe>
+        for(j = 0; j < 20; j++)
+    2299:	83 ee 01             	sub    $0x1,%esi
+    229c:	75 ca                	jne    2268 <bcachetest+0x1a8>
+        close(fd);
+    229e:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+    22a4:	83 ec 0c             	sub    $0xc,%esp
+    22a7:	52                   	push   %edx
+    22a8:	e8 ae 2e 00 00       	call   515b <close>
+      for(k = 0; k < 5; k++){
+    22ad:	83 c4 10             	add    $0x10,%esp
+    22b0:	83 ad d0 fd ff ff 01 	subl   $0x1,-0x230(%ebp)
+    22b7:	75 8a                	jne    2243 <bcachetest+0x183>
+      exit();
+    22b9:	e8 75 2e 00 00       	call   5133 <exit>
+            printf(1, "bcache: wrong data in %s\n", name);
+    22be:	83 ec 04             	sub    $0x4,%esp
+    22c1:	8d 85 e5 fd ff ff    	lea    -0x21b(%ebp),%eax
+    22c7:	50                   	push   %eax
+    22c8:	68 c0 61 00 00       	push   $0x61c0
+    22cd:	6a 01                	push   $0x1
+    22cf:	e8 6c 30 00 00       	call   5340 <printf>
+            exit();
+    22d4:	e8 5a 2e 00 00       	call   5133 <exit>
+          printf(1, "bcache: write failed\n");
+    22d9:	83 ec 08             	sub    $0x8,%esp
+    22dc:	68 aa 61 00 00       	push   $0x61aa
+    22e1:	6a 01                	push   $0x1
+    22e3:	e8 58 30 00 00       	call   5340 <printf>
+          exit();
+    22e8:	e8 46 2e 00 00       	call   5133 <exit>
+      printf(1, "fork failed\n");
+    22ed:	83 ec 08             	sub    $0x8,%esp
+    22f0:	68 af 6d 00 00       	push   $0x6daf
+    22f5:	6a 01                	push   $0x1
+    22f7:	e8 44 30 00 00       	call   5340 <printf>
+      exit();
+    22fc:	e8 32 2e 00 00       	call   5133 <exit>
+    printf(1, "bcache: limit %d, not %d\n", bcachesize(0), NBUF);
+    2301:	83 ec 0c             	sub    $0xc,%esp
+    2304:	6a 00                	push   $0x0
+    2306:	e8 88 2f 00 00       	call   5293 <bcachesize>
+    230b:	6a 1e                	push   $0x1e
+    230d:	50                   	push   %eax
+    230e:	68 90 61 00 00       	push   $0x6190
+    2313:	6a 01                	push   $0x1
+    2315:	e8 26 30 00 00       	call   5340 <printf>
+    exit();
+    231a:	83 c4 20             	add    $0x20,%esp
+    231d:	e8 11 2e 00 00       	call   5133 <exit>
+    2322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002330 <readaheadtest>:
+{
+    2330:	55                   	push   %ebp
+    2331:	89 e5                	mov    %esp,%ebp
+    2333:	57                   	push   %edi
+    2334:	56                   	push   %esi
+    2335:	53                   	push   %ebx
+    2336:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    233c:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  printf(1, "readahead test\n");
+    2342:	68 ea 61 00 00       	push   $0x61ea
+    2347:	6a 01                	push   $0x1
+    2349:	e8 f2 2f 00 00       	call   5340 <printf>
+  unlink("ra");
+    234e:	c7 04 24 fa 61 00 00 	movl   $0x61fa,(%esp)
+    2355:	e8 29 2e 00 00       	call   5183 <unlink>
+  fd = open("ra", O_CREATE|O_RDWR);
+    235a:	5f                   	pop    %edi
+    235b:	58                   	pop    %eax
+    235c:	68 02 02 00 00       	push   $0x202
+    2361:	68 fa 61 00 00       	push   $0x61fa
+  for(i = 0; i < 40; i++){
+    2366:	31 ff                	xor    %edi,%edi
+  fd = open("ra", O_CREATE|O_RDWR);
+    2368:	e8 06 2e 00 00       	call   5173 <open>
+    236d:	83 c4 10             	add    $0x10,%esp
+    2370:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 40; i++){
+    2372:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memset(data, 'a' + i%26, sizeof(data));
+    2378:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    237d:	83 ec 04             	sub    $0x4,%esp
+    2380:	f7 e7                	mul    %edi
+    2382:	89 f8                	mov    %edi,%eax
+    2384:	68 00 02 00 00       	push   $0x200
+    2389:	c1 ea 03             	shr    $0x3,%edx
+    238c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    238f:	29 d0                	sub    %edx,%eax
+    2391:	83 c0 61             	add    $0x61,%eax
+    2394:	50                   	push   %eax
+    2395:	53                   	push   %ebx
+    2396:	e8 15 2c 00 00       	call   4fb0 <memset>
+    if(write(fd, data, sizeof(data)) != sizeof(data)){
+    239b:	83 c4 0c             	add    $0xc,%esp
+    239e:	68 00 02 00 00       	push   $0x200
+    23a3:	53                   	push   %ebx
+    23a4:	56                   	push   %esi
+    23a5:	e8 a9 2d 00 00       	call   5153 <write>
+    23aa:	83 c4 10             	add    $0x10,%esp
+    23ad:	3d 00 02 00 00       	cmp    $0x200,%eax
+    23b2:	0f 85 15 02 00 00    	jne    25cd <readaheadtest+0x29d>
+  for(i = 0; i < 40; i++){
+    23b8:	83 c7 01             	add    $0x1,%edi
+    23bb:	83 ff 28             	cmp    $0x28,%edi
+    23be:	75 b8                	jne    2378 <readaheadtest+0x48>
+  close(fd);
+    23c0:	83 ec 0c             	sub    $0xc,%esp
+       data[0] != 'a' + i%26 || data[511] != 'a' + i%26){
+    23c3:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  close(fd);
+    23c8:	56                   	push   %esi
+    23c9:	e8 8d 2d 00 00       	call   515b <close>
+  fd1 = open("ra", O_RDONLY);
+    23ce:	58                   	pop    %eax
+    23cf:	5a                   	pop    %edx
+    23d0:	6a 00                	push   $0x0
+    23d2:	68 fa 61 00 00       	push   $0x61fa
+    23d7:	e8 97 2d 00 00       	call   5173 <open>
+    23dc:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  fd2 = open("ra", O_RDWR);
+    23e2:	59                   	pop    %ecx
+    23e3:	5e                   	pop    %esi
+    23e4:	6a 02                	push   $0x2
+  for(i = 0; i < 40; i++){
+    23e6:	31 f6                	xor    %esi,%esi
+  fd2 = open("ra", O_RDWR);
+    23e8:	68 fa 61 00 00       	push   $0x61fa
+    23ed:	e8 81 2d 00 00       	call   5173 <open>
+    23f2:	83 c4 10             	add    $0x10,%esp
+    23f5:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  for(i = 0; i < 40; i++){
+    23fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23ff:	90                   	nop
+    if(read(fd1, data, sizeof(data)) != sizeof(data) ||
+    2400:	83 ec 04             	sub    $0x4,%esp
+    2403:	68 00 02 00 00       	push   $0x200
+    2408:	53                   	push   %ebx
+    2409:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+    240f:	e8 37 2d 00 00       	call   514b <read>
+    2414:	83 c4 10             	add    $0x10,%esp
+    2417:	3d 00 02 00 00       	cmp    $0x200,%eax
+    241c:	0f 85 81 01 00 00    	jne    25a3 <readaheadtest+0x273>
+       data[0] != 'a' + i%26 || data[511] != 'a' + i%26){
+    2422:	89 f0                	mov    %esi,%eax
+    2424:	f7 e7                	mul    %edi
+    2426:	89 f0                	mov    %esi,%eax
+    2428:	c1 ea 03             	shr    $0x3,%edx
+    242b:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    242e:	29 d0                	sub    %edx,%eax
+    2430:	0f be 95 e8 fd ff ff 	movsbl -0x218(%ebp),%edx
+    2437:	83 c0 61             	add    $0x61,%eax
+    if(read(fd1, data, sizeof(data)) != sizeof(data) ||
+    243a:	39 c2                	cmp    %eax,%edx
+    243c:	0f 85 61 01 00 00    	jne    25a3 <readaheadtest+0x273>
+       data[0] != 'a' + i%26 || data[511] != 'a' + i%26){
+    2442:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+    2446:	39 c2                	cmp    %eax,%edx
+    2448:	0f 85 55 01 00 00    	jne    25a3 <readaheadtest+0x273>
+    if(i%2 == 0)
+    244e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+    2454:	74 6f                	je     24c5 <readaheadtest+0x195>
+    if(read(fd2, data, sizeof(data)) != sizeof(data) ||
+    2456:	83 ec 04             	sub    $0x4,%esp
+    2459:	68 00 02 00 00       	push   $0x200
+    245e:	53                   	push   %ebx
+    245f:	ff b5 e0 fd ff ff    	push   -0x220(%ebp)
+    2465:	e8 e1 2c 00 00       	call   514b <read>
+    246a:	83 c4 10             	add    $0x10,%esp
+    246d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2472:	0f 85 69 01 00 00    	jne    25e1 <readaheadtest+0x2b1>
+       data[0] != 'a' + (i-1)%26){
+    2478:	0f be 85 e8 fd ff ff 	movsbl -0x218(%ebp),%eax
+    247f:	8d 4e ff             	lea    -0x1(%esi),%ecx
+    2482:	89 85 dc fd ff ff    	mov    %eax,-0x224(%ebp)
+    2488:	89 c8                	mov    %ecx,%eax
+    248a:	f7 e7                	mul    %edi
+    248c:	c1 ea 03             	shr    $0x3,%edx
+    248f:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2492:	29 d1                	sub    %edx,%ecx
+    2494:	83 c1 61             	add    $0x61,%ecx
+    if(read(fd2, data, sizeof(data)) != sizeof(data) ||
+    2497:	39 8d dc fd ff ff    	cmp    %ecx,-0x224(%ebp)
+    249d:	0f 85 3e 01 00 00    	jne    25e1 <readaheadtest+0x2b1>
+    if(write(fd2, data, sizeof(data)) != sizeof(data)){
+    24a3:	83 ec 04             	sub    $0x4,%esp
+    24a6:	68 00 02 00 00       	push   $0x200
+    24ab:	53                   	push   %ebx
+    24ac:	ff b5 e0 fd ff ff    	push   -0x220(%ebp)
+    24b2:	e8 9c 2c 00 00       	call   5153 <write>
+    24b7:	83 c4 10             	add    $0x10,%esp
+    24ba:	3d 00 02 00 00       	cmp    $0x200,%eax
+    24bf:	0f 85 30 01 00 00    	jne    25f5 <readaheadtest+0x2c5>
+  for(i = 0; i < 40; i++){
+    24c5:	83 c6 01             	add    $0x1,%esi
+    24c8:	83 fe 28             	cmp    $0x28,%esi
+    24cb:	0f 85 2f ff ff ff    	jne    2400 <readaheadtest+0xd0>
+  if(read(fd1, data, sizeof(data)) != 0){
+    24d1:	83 ec 04             	sub    $0x4,%esp
+    24d4:	68 00 02 00 00       	push   $0x200
+    24d9:	53                   	push   %ebx
+    24da:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+    24e0:	e8 66 2c 00 00       	call   514b <read>
+    24e5:	83 c4 10             	add    $0x10,%esp
+    24e8:	89 c6                	mov    %eax,%esi
+    24ea:	85 c0                	test   %eax,%eax
+    24ec:	0f 85 17 01 00 00    	jne    2609 <readaheadtest+0x2d9>
+  close(fd1);
+    24f2:	83 ec 0c             	sub    $0xc,%esp
+    24f5:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+    24fb:	e8 5b 2c 00 00       	call   515b <close>
+  close(fd2);
+    2500:	59                   	pop    %ecx
+    2501:	ff b5 e0 fd ff ff    	push   -0x220(%ebp)
+    2507:	e8 4f 2c 00 00       	call   515b <close>
+  fd = open("ra", O_RDONLY);
+    250c:	5f                   	pop    %edi
+    250d:	58                   	pop    %eax
+    250e:	6a 00                	push   $0x0
+    2510:	68 fa 61 00 00       	push   $0x61fa
+    2515:	e8 59 2c 00 00       	call   5173 <open>
+    251a:	83 c4 10             	add    $0x10,%esp
+    251d:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  for(i = 0; i < 40; i++)
+    2523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2527:	90                   	nop
+    if(read(fd, data, sizeof(data)) != sizeof(data) ||
+    2528:	83 ec 04             	sub    $0x4,%esp
+    252b:	68 00 02 00 00       	push   $0x200
+    2530:	53                   	push   %ebx
+    2531:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+    2537:	e8 0f 2c 00 00       	call   514b <read>
+    253c:	83 c4 10             	add    $0x10,%esp
+    253f:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2544:	75 72                	jne    25b8 <readaheadtest+0x288>
+       data[0] != 'a' + (i - i%2)%26){
+    2546:	89 f1                	mov    %esi,%ecx
+    2548:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    254d:	0f be bd e8 fd ff ff 	movsbl -0x218(%ebp),%edi
+    2554:	83 e1 fe             	and    $0xfffffffe,%ecx
+    2557:	f7 e1                	mul    %ecx
+    2559:	c1 ea 03             	shr    $0x3,%edx
+    255c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    255f:	29 d1                	sub    %edx,%ecx
+    2561:	83 c1 61             	add    $0x61,%ecx
+    if(read(fd, data, sizeof(data)) != sizeof(data) ||
+    2564:	39 cf                	cmp    %ecx,%edi
+    2566:	75 50                	jne    25b8 <readaheadtest+0x288>
+  for(i = 0; i < 40; i++)
+    2568:	83 c6 01             	add    $0x1,%esi
+    256b:	83 fe 28             	cmp    $0x28,%esi
+    256e:	75 b8                	jne    2528 <readaheadtest+0x1f8>
+  close(fd);
+    2570:	83 ec 0c             	sub    $0xc,%esp
+    2573:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+    2579:	e8 dd 2b 00 00       	call   515b <close>
+  unlink("ra");
+    257e:	c7 04 24 fa 61 00 00 	movl   $0x61fa,(%esp)
+    2585:	e8 f9 2b 00 00       	call   5183 <unlink>
+  printf(1, "readahead test ok\n");
+    258a:	58                   	pop    %eax
+    258b:	5a                   	pop    %edx
+    258c:	68 66 62 00 00       	push   $0x6266
+    2591:	6a 01                	push   $0x1
+    2593:	e8 a8 2d 00 00       	call   5340 <printf>
+}
+    2598:	83 c4 10             	add    $0x10,%esp
+    259b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    259e:	5b                   	pop    %ebx
+    259f:	5e                   	pop    %esi
+    25a0:	5f                   	pop    %edi
+    25a1:	5d                   	pop    %ebp
+    25a2:	c3                   	ret
+      printf(1, "readahead: wrong data in block %d\n", i);
+    25a3:	83 ec 04             	sub    $0x4,%esp
+    25a6:	56                   	push   %esi
+    25a7:	68 5c 72 00 00       	push   $0x725c
+    25ac:	6a 01                	push   $0x1
+    25ae:	e8 8d 2d 00 00       	call   5340 <printf>
+      exit();
+    25b3:	e8 7b 2b 00 00       	call   5133 <exit>
+      printf(1, "readahead: stale block %d\n", i);
+    25b8:	83 ec 04             	sub    $0x4,%esp
+    25bb:	56                   	push   %esi
+    25bc:	68 4b 62 00 00       	push   $0x624b
+    25c1:	6a 01                	push   $0x1
+    25c3:	e8 78 2d 00 00       	call   5340 <printf>
+      exit();
+    25c8:	e8 66 2b 00 00       	call   5133 <exit>
+      printf(1, "readahead: write failed\n");
+    25cd:	83 ec 08             	sub    $0x8,%esp
+    25d0:	68 fd 61 00 00       	push   $0x61fd
+    25d5:	6a 01                	push   $0x1
+    25d7:	e8 64 2d 00 00       	call   5340 <printf>
+      exit();
+    25dc:	e8 52 2b 00 00       	call   5133 <exit>
+      printf(1, "readahead: wrong data through fd2\n");
+    25e1:	83 ec 08             	sub    $0x8,%esp
+    25e4:	68 80 72 00 00       	push   $0x7280
+    25e9:	6a 01                	push   $0x1
+    25eb:	e8 50 2d 00 00       	call   5340 <printf>
+      exit();
+    25f0:	e8 3e 2b 00 00       	call   5133 <exit>
+      printf(1, "readahead: rewrite failed\n");
+    25f5:	83 ec 08             	sub    $0x8,%esp
+    25f8:	68 16 62 00 00       	push   $0x6216
+    25fd:	6a 01                	push   $0x1
+    25ff:	e8 3c 2d 00 00       	call   5340 <printf>
+      exit();
+    2604:	e8 2a 2b 00 00       	call   5133 <exit>
+    printf(1, "readahead: read past end\n");
+    2609:	50                   	push   %eax
+    260a:	50                   	push   %eax
+    260b:	68 31 62 00 00       	push   $0x6231
+    2610:	6a 01                	push   $0x1
+    2612:	e8 29 2d 00 00       	call   5340 <printf>
+    exit();
+    2617:	e8 17 2b 00 00       	call   5133 <exit>
+    261c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002620 <mem>:
+{
+    2620:	55                   	push   %ebp
+    2621:	89 e5                	mov    %esp,%ebp
+    2623:	56                   	push   %esi
+    2624:	31 f6                	xor    %esi,%esi
+    2626:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    2627:	83 ec 08             	sub    $0x8,%esp
+    262a:	68 79 62 00 00       	push   $0x6279
+    262f:	6a 01                	push   $0x1
+    2631:	e8 0a 2d 00 00       	call   5340 <printf>
+  ppid = getpid();
+    2636:	e8 78 2b 00 00       	call   51b3 <getpid>
+    263b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    263d:	e8 e9 2a 00 00       	call   512b <fork>
+    2642:	83 c4 10             	add    $0x10,%esp
+    2645:	85 c0                	test   %eax,%eax
+    2647:	74 0b                	je     2654 <mem+0x34>
+    2649:	e9 8a 00 00 00       	jmp    26d8 <mem+0xb8>
+    264e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    2650:	89 30                	mov    %esi,(%eax)
+    2652:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    2654:	83 ec 0c             	sub    $0xc,%esp
+    2657:	68 11 27 00 00       	push   $0x2711
+    265c:	e8 3f 2f 00 00       	call   55a0 <malloc>
+    2661:	83 c4 10             	add    $0x10,%esp
+    2664:	85 c0                	test   %eax,%eax
+    2666:	75 e8                	jne    2650 <mem+0x30>
+    while(m1){
+    2668:	85 f6                	test   %esi,%esi
+    266a:	74 18                	je     2684 <mem+0x64>
+    266c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    2670:	89 f0                	mov    %esi,%eax
+      free(m1);
+    2672:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    2675:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    2677:	50                   	push   %eax
+    2678:	e8 f3 2e 00 00       	call   5570 <free>
+    while(m1){
+    267d:	83 c4 10             	add    $0x10,%esp
+    2680:	85 f6                	test   %esi,%esi
+    2682:	75 ec                	jne    2670 <mem+0x50>
+    m1 = malloc(1024*20);
+    2684:	83 ec 0c             	sub    $0xc,%esp
+    2687:	68 00 50 00 00       	push   $0x5000
+    268c:	e8 0f 2f 00 00       	call   55a0 <malloc>
+    if(m1 == 0){
+    2691:	83 c4 10             	add    $0x10,%esp
+    2694:	85 c0                	test   %eax,%eax
+    2696:	74 20                	je     26b8 <mem+0x98>
+    free(m1);
+    2698:	83 ec 0c             	sub    $0xc,%esp
+    269b:	50                   	push   %eax
+    269c:	e8 cf 2e 00 00       	call   5570 <free>
+    printf(1, "mem ok\n");
+    26a1:	58                   	pop    %eax
+    26a2:	5a                   	pop    %edx
+    26a3:	68 9d 62 00 00       	push   $0x629d
+    26a8:	6a 01                	push   $0x1
+    26aa:	e8 91 2c 00 00       	call   5340 <printf>
+    exit();
+    26af:	e8 7f 2a 00 00       	call   5133 <exit>
+    26b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    26b8:	83 ec 08             	sub    $0x8,%esp
+    26bb:	68 83 62 00 00       	push   $0x6283
+    26c0:	6a 01                	push   $0x1
+    26c2:	e8 79 2c 00 00       	call   5340 <printf>
+      kill(ppid);
+    26c7:	89 1c 24             	mov    %ebx,(%esp)
+    26ca:	e8 94 2a 00 00       	call   5163 <kill>
+      exit();
+    26cf:	e8 5f 2a 00 00       	call   5133 <exit>
+    26d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    26d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    26db:	5b                   	pop    %ebx
+    26dc:	5e                   	pop    %esi
+    26dd:	5d                   	pop    %ebp
+    wait();
+    26de:	e9 58 2a 00 00       	jmp    513b <wait>
+    26e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000026f0 <sharedfd>:
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	57                   	push   %edi
+    26f4:	56                   	push   %esi
+    26f5:	53                   	push   %ebx
+    26f6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    26f9:	68 a5 62 00 00       	push   $0x62a5
+    26fe:	6a 01                	push   $0x1
+    2700:	e8 3b 2c 00 00       	call   5340 <printf>
+  unlink("sharedfd");
+    2705:	c7 04 24 b4 62 00 00 	movl   $0x62b4,(%esp)
+    270c:	e8 72 2a 00 00       	call   5183 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    2711:	5b                   	pop    %ebx
+    2712:	5e                   	pop    %esi
+    2713:	68 02 02 00 00       	push   $0x202
+    2718:	68 b4 62 00 00       	push   $0x62b4
+    271d:	e8 51 2a 00 00       	call   5173 <open>
+  if(fd < 0){
+    2722:	83 c4 10             	add    $0x10,%esp
+    2725:	85 c0                	test   %eax,%eax
+    2727:	0f 88 2a 01 00 00    	js     2857 <sharedfd+0x167>
+    272d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    272f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    2732:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    2737:	e8 ef 29 00 00       	call   512b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    273c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    273f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    2742:	19 c0                	sbb    %eax,%eax
+    2744:	83 ec 04             	sub    $0x4,%esp
+    2747:	83 e0 f3             	and    $0xfffffff3,%eax
+    274a:	6a 0a                	push   $0xa
+    274c:	83 c0 70             	add    $0x70,%eax
+    274f:	50                   	push   %eax
+    2750:	56                   	push   %esi
+    2751:	e8 5a 28 00 00       	call   4fb0 <memset>
+    2756:	83 c4 10             	add    $0x10,%esp
+    2759:	eb 0a                	jmp    2765 <sharedfd+0x75>
+    275b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    275f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    2760:	83 eb 01             	sub    $0x1,%ebx
+    2763:	74 26                	je     278b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    2765:	83 ec 04             	sub    $0x4,%esp
+    2768:	6a 0a                	push   $0xa
+    276a:	56                   	push   %esi
+    276b:	57                   	push   %edi
+    276c:	e8 e2 29 00 00       	call   5153 <write>
+    2771:	83 c4 10             	add    $0x10,%esp
+    2774:	83 f8 0a             	cmp    $0xa,%eax
+    2777:	74 e7                	je     2760 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    2779:	83 ec 08             	sub    $0x8,%esp
+    277c:	68 d0 72 00 00       	push   $0x72d0
+    2781:	6a 01                	push   $0x1
+    2783:	e8 b8 2b 00 00       	call   5340 <printf>
+      break;
+    2788:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    278b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    278e:	85 c9                	test   %ecx,%ecx
+    2790:	0f 84 f5 00 00 00    	je     288b <sharedfd+0x19b>
+    wait();
+    2796:	e8 a0 29 00 00       	call   513b <wait>
+  close(fd);
+    279b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    279e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    27a0:	57                   	push   %edi
+    27a1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    27a4:	e8 b2 29 00 00       	call   515b <close>
+  fd = open("sharedfd", 0);
+    27a9:	58                   	pop    %eax
+    27aa:	5a                   	pop    %edx
+    27ab:	6a 00                	push   $0x0
+    27ad:	68 b4 62 00 00       	push   $0x62b4
+    27b2:	e8 bc 29 00 00       	call   5173 <open>
+  if(fd < 0){
+    27b7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    27ba:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    27bc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    27bf:	85 c0                	test   %eax,%eax
+    27c1:	0f 88 aa 00 00 00    	js     2871 <sharedfd+0x181>
+    27c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27ce:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    27d0:	83 ec 04             	sub    $0x4,%esp
+    27d3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    27d6:	6a 0a                	push   $0xa
+    27d8:	56                   	push   %esi
+    27d9:	ff 75 d0             	push   -0x30(%ebp)
+    27dc:	e8 6a 29 00 00       	call   514b <read>
+    27e1:	83 c4 10             	add    $0x10,%esp
+    27e4:	85 c0                	test   %eax,%eax
+    27e6:	7e 28                	jle    2810 <sharedfd+0x120>
+    27e8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    27eb:	89 f0                	mov    %esi,%eax
+    27ed:	eb 13                	jmp    2802 <sharedfd+0x112>
+    27ef:	90                   	nop
+        np++;
+    27f0:	80 f9 70             	cmp    $0x70,%cl
+    27f3:	0f 94 c1             	sete   %cl
+    27f6:	0f b6 c9             	movzbl %cl,%ecx
+    27f9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    27fb:	83 c0 01             	add    $0x1,%eax
+    27fe:	39 f8                	cmp    %edi,%eax
+    2800:	74 ce                	je     27d0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    2802:	0f b6 08             	movzbl (%eax),%ecx
+    2805:	80 f9 63             	cmp    $0x63,%cl
+    2808:	75 e6                	jne    27f0 <sharedfd+0x100>
+        nc++;
+    280a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    280d:	eb ec                	jmp    27fb <sharedfd+0x10b>
+    280f:	90                   	nop
+  close(fd);
+    2810:	83 ec 0c             	sub    $0xc,%esp
+    2813:	ff 75 d0             	push   -0x30(%ebp)
+    2816:	e8 40 29 00 00       	call   515b <close>
+  unlink("sharedfd");
+    281b:	c7 04 24 b4 62 00 00 	movl   $0x62b4,(%esp)
+    2822:	e8 5c 29 00 00       	call   5183 <unlink>
+  if(nc == 10000 && np == 10000){
+    2827:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    282a:	83 c4 10             	add    $0x10,%esp
+    282d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    2833:	75 5b                	jne    2890 <sharedfd+0x1a0>
+    2835:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    283b:	75 53                	jne    2890 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    283d:	83 ec 08             	sub    $0x8,%esp
+    2840:	68 bd 62 00 00       	push   $0x62bd
+    2845:	6a 01                	push   $0x1
+    2847:	e8 f4 2a 00 00       	call   5340 <printf>
+    284c:	83 c4 10             	add    $0x10,%esp
+}
+    284f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2852:	5b                   	pop    %ebx
+    2853:	5e                   	pop    %esi
+    2854:	5f                   	pop    %edi
+    2855:	5d                   	pop    %ebp
+    2856:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    2857:	83 ec 08             	sub    $0x8,%esp
+    285a:	68 a4 72 00 00       	push   $0x72a4
+    285f:	6a 01                	push   $0x1
+    2861:	e8 da 2a 00 00       	call   5340 <printf>
+    return;
+    2866:	83 c4 10             	add    $0x10,%esp
+}
+    2869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    286c:	5b                   	pop    %ebx
+    286d:	5e                   	pop    %esi
+    286e:	5f                   	pop    %edi
+    286f:	5d                   	pop    %ebp
+    2870:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    2871:	83 ec 08             	sub    $0x8,%esp
+    2874:	68 f0 72 00 00       	push   $0x72f0
+    2879:	6a 01                	push   $0x1
+    287b:	e8 c0 2a 00 00       	call   5340 <printf>
+    return;
+    2880:	83 c4 10             	add    $0x10,%esp
+}
+    2883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2886:	5b                   	pop    %ebx
+    2887:	5e                   	pop    %esi
+    2888:	5f                   	pop    %edi
+    2889:	5d                   	pop    %ebp
+    288a:	c3                   	ret
+    exit();
+    288b:	e8 a3 28 00 00       	call   5133 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    2890:	53                   	push   %ebx
+    2891:	52                   	push   %edx
+    2892:	68 ca 62 00 00       	push   $0x62ca
+    2897:	6a 01                	push   $0x1
+    2899:	e8 a2 2a 00 00       	call   5340 <printf>
+    exit();
+    289e:	e8 90 28 00 00       	call   5133 <exit>
+    28a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000028b0 <fourfiles>:
+{
+    28b0:	55                   	push   %ebp
+    28b1:	89 e5                	mov    %esp,%ebp
+    28b3:	57                   	push   %edi
+    28b4:	56                   	push   %esi
+    28b5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    28b6:	31 db                	xor    %ebx,%ebx
+{
+    28b8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    28bb:	c7 45 d8 df 62 00 00 	movl   $0x62df,-0x28(%ebp)
+    28c2:	c7 45 dc 28 64 00 00 	movl   $0x6428,-0x24(%ebp)
+    28c9:	c7 45 e0 2c 64 00 00 	movl   $0x642c,-0x20(%ebp)
+    28d0:	c7 45 e4 e2 62 00 00 	movl   $0x62e2,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    28d7:	68 e5 62 00 00       	push   $0x62e5
+    28dc:	6a 01                	push   $0x1
+    28de:	e8 5d 2a 00 00       	call   5340 <printf>
+    28e3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    28e6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    28ea:	83 ec 0c             	sub    $0xc,%esp
+    28ed:	56                   	push   %esi
+    28ee:	e8 90 28 00 00       	call   5183 <unlink>
+    pid = fork();
+    28f3:	e8 33 28 00 00       	call   512b <fork>
+    if(pid < 0){
+    28f8:	83 c4 10             	add    $0x10,%esp
+    28fb:	85 c0                	test   %eax,%eax
+    28fd:	0f 88 65 01 00 00    	js     2a68 <fourfiles+0x1b8>
+    if(pid == 0){
+    2903:	0f 84 eb 00 00 00    	je     29f4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    2909:	83 c3 01             	add    $0x1,%ebx
+    290c:	83 fb 04             	cmp    $0x4,%ebx
+    290f:	75 d5                	jne    28e6 <fourfiles+0x36>
+    wait();
+    2911:	e8 25 28 00 00       	call   513b <wait>
+  for(i = 0; i < 2; i++){
+    2916:	31 f6                	xor    %esi,%esi
+    wait();
+    2918:	e8 1e 28 00 00       	call   513b <wait>
+    291d:	e8 19 28 00 00       	call   513b <wait>
+    2922:	e8 14 28 00 00       	call   513b <wait>
+    fname = names[i];
+    2927:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    292b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    292e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    2930:	6a 00                	push   $0x0
+    2932:	53                   	push   %ebx
+    2933:	e8 3b 28 00 00       	call   5173 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    2938:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    293b:	83 c4 10             	add    $0x10,%esp
+    293e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    2941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2948:	83 ec 04             	sub    $0x4,%esp
+    294b:	68 00 20 00 00       	push   $0x2000
+    2950:	68 00 6f 04 00       	push   $0x46f00
+    2955:	ff 75 d4             	push   -0x2c(%ebp)
+    2958:	e8 ee 27 00 00       	call   514b <read>
+    295d:	83 c4 10             	add    $0x10,%esp
+    2960:	89 c3                	mov    %eax,%ebx
+    2962:	85 c0                	test   %eax,%eax
+    2964:	7e 28                	jle    298e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    2966:	31 c0                	xor    %eax,%eax
+    2968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    296f:	90                   	nop
+        if(buf[j] != '0'+i){
+    2970:	83 fe 01             	cmp    $0x1,%esi
+    2973:	0f be 88 00 6f 04 00 	movsbl 0x46f00(%eax),%ecx
+    297a:	19 d2                	sbb    %edx,%edx
+    297c:	83 c2 31             	add    $0x31,%edx
+    297f:	39 d1                	cmp    %edx,%ecx
+    2981:	75 5d                	jne    29e0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    2983:	83 c0 01             	add    $0x1,%eax
+    2986:	39 c3                	cmp    %eax,%ebx
+    2988:	75 e6                	jne    2970 <fourfiles+0xc0>
+      total += n;
+    298a:	01 df                	add    %ebx,%edi
+    298c:	eb ba                	jmp    2948 <fourfiles+0x98>
+    close(fd);
+    298e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    2991:	83 ec 0c             	sub    $0xc,%esp
+    2994:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2997:	51                   	push   %ecx
+    2998:	e8 be 27 00 00       	call   515b <close>
+    if(total != 12*500){
+    299d:	83 c4 10             	add    $0x10,%esp
+    29a0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    29a6:	0f 85 d0 00 00 00    	jne    2a7c <fourfiles+0x1cc>
+    unlink(fname);
+    29ac:	83 ec 0c             	sub    $0xc,%esp
+    29af:	53                   	push   %ebx
+    29b0:	e8 ce 27 00 00       	call   5183 <unlink>
+  for(i = 0; i < 2; i++){
+    29b5:	83 c4 10             	add    $0x10,%esp
+    29b8:	85 f6                	test   %esi,%esi
+    29ba:	75 0a                	jne    29c6 <fourfiles+0x116>
+    29bc:	be 01 00 00 00       	mov    $0x1,%esi
+    29c1:	e9 61 ff ff ff       	jmp    2927 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    29c6:	83 ec 08             	sub    $0x8,%esp
+    29c9:	68 23 63 00 00       	push   $0x6323
+    29ce:	6a 01                	push   $0x1
+    29d0:	e8 6b 29 00 00       	call   5340 <printf>
+}
+    29d5:	83 c4 10             	add    $0x10,%esp
+    29d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29db:	5b                   	pop    %ebx
+    29dc:	5e                   	pop    %esi
+    29dd:	5f                   	pop    %edi
+    29de:	5d                   	pop    %ebp
+    29df:	c3                   	ret
+          printf(1, "wrong char\n");
+    29e0:	83 ec 08             	sub    $0x8,%esp
+    29e3:	68 06 63 00 00       	push   $0x6306
+    29e8:	6a 01                	push   $0x1
+    29ea:	e8 51 29 00 00       	call   5340 <printf>
+          exit();
+    29ef:	e8 3f 27 00 00       	call   5133 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    29f4:	83 ec 08             	sub    $0x8,%esp
+    29f7:	68 02 02 00 00       	push   $0x202
+    29fc:	56                   	push   %esi
+    29fd:	e8 71 27 00 00       	call   5173 <open>
+      if(fd < 0){
+    2a02:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    2a05:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    2a07:	85 c0                	test   %eax,%eax
+    2a09:	78 45                	js     2a50 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    2a0b:	83 ec 04             	sub    $0x4,%esp
+    2a0e:	83 c3 30             	add    $0x30,%ebx
+    2a11:	68 00 02 00 00       	push   $0x200
+    2a16:	53                   	push   %ebx
+    2a17:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    2a1c:	68 00 6f 04 00       	push   $0x46f00
+    2a21:	e8 8a 25 00 00       	call   4fb0 <memset>
+    2a26:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    2a29:	83 ec 04             	sub    $0x4,%esp
+    2a2c:	68 f4 01 00 00       	push   $0x1f4
+    2a31:	68 00 6f 04 00       	push   $0x46f00
+    2a36:	56                   	push   %esi
+    2a37:	e8 17 27 00 00       	call   5153 <write>
+    2a3c:	83 c4 10             	add    $0x10,%esp
+    2a3f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    2a44:	75 49                	jne    2a8f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    2a46:	83 eb 01             	sub    $0x1,%ebx
+    2a49:	75 de                	jne    2a29 <fourfiles+0x179>
+      exit();
+    2a4b:	e8 e3 26 00 00       	call   5133 <exit>
+        printf(1, "create failed\n");
+    2a50:	51                   	push   %ecx
+    2a51:	51                   	push   %ecx
+    2a52:	68 80 65 00 00       	push   $0x6580
+    2a57:	6a 01                	push   $0x1
+    2a59:	e8 e2 28 00 00       	call   5340 <printf>
+        exit();
+    2a5e:	e8 d0 26 00 00       	call   5133 <exit>
+    2a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a67:	90                   	nop
+      printf(1, "fork failed\n");
+    2a68:	83 ec 08             	sub    $0x8,%esp
+    2a6b:	68 af 6d 00 00       	push   $0x6daf
+    2a70:	6a 01                	push   $0x1
+    2a72:	e8 c9 28 00 00       	call   5340 <printf>
+      exit();
+    2a77:	e8 b7 26 00 00       	call   5133 <exit>
+      printf(1, "wrong length %d\n", total);
+    2a7c:	50                   	push   %eax
+    2a7d:	57                   	push   %edi
+    2a7e:	68 12 63 00 00       	push   $0x6312
+    2a83:	6a 01                	push   $0x1
+    2a85:	e8 b6 28 00 00       	call   5340 <printf>
+      exit();
+    2a8a:	e8 a4 26 00 00       	call   5133 <exit>
+          printf(1, "write failed %d\n", n);
+    2a8f:	52                   	push   %edx
+    2a90:	50                   	push   %eax
+    2a91:	68 f5 62 00 00       	push   $0x62f5
+    2a96:	6a 01                	push   $0x1
+    2a98:	e8 a3 28 00 00       	call   5340 <printf>
+          exit();
+    2a9d:	e8 91 26 00 00       	call   5133 <exit>
+    2aa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002ab0 <createdelete>:
+{
+    2ab0:	55                   	push   %ebp
+    2ab1:	89 e5                	mov    %esp,%ebp
+    2ab3:	57                   	push   %edi
+    2ab4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    2ab5:	31 f6                	xor    %esi,%esi
+{
+    2ab7:	53                   	push   %ebx
+    2ab8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    2abb:	68 31 63 00 00       	push   $0x6331
+    2ac0:	6a 01                	push   $0x1
+    2ac2:	e8 79 28 00 00       	call   5340 <printf>
+    2ac7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    2aca:	e8 5c 26 00 00       	call   512b <fork>
+    2acf:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    2ad1:	85 c0                	test   %eax,%eax
+    2ad3:	0f 88 ac 01 00 00    	js     2c85 <createdelete+0x1d5>
+    if(pid == 0){
+    2ad9:	0f 84 01 01 00 00    	je     2be0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    2adf:	83 c6 01             	add    $0x1,%esi
+    2ae2:	83 fe 04             	cmp    $0x4,%esi
+    2ae5:	75 e3                	jne    2aca <createdelete+0x1a>
+    wait();
+    2ae7:	e8 4f 26 00 00       	call   513b <wait>
+  for(i = 0; i < N; i++){
+    2aec:	31 ff                	xor    %edi,%edi
+    2aee:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    2af1:	e8 45 26 00 00       	call   513b <wait>
+    2af6:	e8 40 26 00 00       	call   513b <wait>
+    2afb:	e8 3b 26 00 00       	call   513b <wait>
+  name[0] = name[1] = name[2] = 0;
+    2b00:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    2b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    2b08:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    2b0a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    2b0d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    2b12:	0f 94 c2             	sete   %dl
+    2b15:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    2b18:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    2b1b:	0f 9f c0             	setg   %al
+    2b1e:	09 c2                	or     %eax,%edx
+    2b20:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    2b23:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    2b27:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    2b2a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    2b2d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    2b30:	6a 00                	push   $0x0
+    2b32:	56                   	push   %esi
+    2b33:	e8 3b 26 00 00       	call   5173 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    2b38:	83 c4 10             	add    $0x10,%esp
+    2b3b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    2b3f:	74 7f                	je     2bc0 <createdelete+0x110>
+    2b41:	85 c0                	test   %eax,%eax
+    2b43:	0f 88 27 01 00 00    	js     2c70 <createdelete+0x1c0>
+        close(fd);
+    2b49:	83 ec 0c             	sub    $0xc,%esp
+    2b4c:	50                   	push   %eax
+    2b4d:	e8 09 26 00 00       	call   515b <close>
+    2b52:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    2b55:	83 c3 01             	add    $0x1,%ebx
+    2b58:	80 fb 74             	cmp    $0x74,%bl
+    2b5b:	75 c6                	jne    2b23 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    2b5d:	83 c7 01             	add    $0x1,%edi
+    2b60:	83 ff 14             	cmp    $0x14,%edi
+    2b63:	75 a3                	jne    2b08 <createdelete+0x58>
+    2b65:	bf 70 00 00 00       	mov    $0x70,%edi
+    2b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    2b70:	8d 47 c0             	lea    -0x40(%edi),%eax
+    2b73:	bb 04 00 00 00       	mov    $0x4,%ebx
+    2b78:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    2b7b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    2b7d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    2b80:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    2b83:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    2b87:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    2b8a:	56                   	push   %esi
+    2b8b:	e8 f3 25 00 00       	call   5183 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    2b90:	83 c4 10             	add    $0x10,%esp
+    2b93:	83 eb 01             	sub    $0x1,%ebx
+    2b96:	75 e3                	jne    2b7b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    2b98:	83 c7 01             	add    $0x1,%edi
+    2b9b:	89 f8                	mov    %edi,%eax
+    2b9d:	3c 84                	cmp    $0x84,%al
+    2b9f:	75 cf                	jne    2b70 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    2ba1:	83 ec 08             	sub    $0x8,%esp
+    2ba4:	68 44 63 00 00       	push   $0x6344
+    2ba9:	6a 01                	push   $0x1
+    2bab:	e8 90 27 00 00       	call   5340 <printf>
+}
+    2bb0:	83 c4 10             	add    $0x10,%esp
+    2bb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2bb6:	5b                   	pop    %ebx
+    2bb7:	5e                   	pop    %esi
+    2bb8:	5f                   	pop    %edi
+    2bb9:	5d                   	pop    %ebp
+    2bba:	c3                   	ret
+    2bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2bbf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    2bc0:	85 c0                	test   %eax,%eax
+    2bc2:	78 91                	js     2b55 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    2bc4:	50                   	push   %eax
+    2bc5:	56                   	push   %esi
+    2bc6:	68 40 73 00 00       	push   $0x7340
+    2bcb:	6a 01                	push   $0x1
+    2bcd:	e8 6e 27 00 00       	call   5340 <printf>
+        exit();
+    2bd2:	e8 5c 25 00 00       	call   5133 <exit>
+    2bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bde:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    2be0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    2be3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    2be7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    2bea:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    2bed:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    2bf0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    2bf3:	8d 43 30             	lea    0x30(%ebx),%eax
+    2bf6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    2bf9:	68 02 02 00 00       	push   $0x202
+    2bfe:	56                   	push   %esi
+    2bff:	e8 6f 25 00 00       	call   5173 <open>
+        if(fd < 0){
+    2c04:	83 c4 10             	add    $0x10,%esp
+    2c07:	85 c0                	test   %eax,%eax
+    2c09:	0f 88 8a 00 00 00    	js     2c99 <createdelete+0x1e9>
+        close(fd);
+    2c0f:	83 ec 0c             	sub    $0xc,%esp
+    2c12:	50                   	push   %eax
+    2c13:	e8 43 25 00 00       	call   515b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    2c18:	83 c4 10             	add    $0x10,%esp
+    2c1b:	85 db                	test   %ebx,%ebx
+    2c1d:	74 19                	je     2c38 <createdelete+0x188>
+    2c1f:	f6 c3 01             	test   $0x1,%bl
+    2c22:	74 1b                	je     2c3f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    2c24:	83 c3 01             	add    $0x1,%ebx
+    2c27:	83 fb 14             	cmp    $0x14,%ebx
+    2c2a:	75 c4                	jne    2bf0 <createdelete+0x140>
+      exit();
+    2c2c:	e8 02 25 00 00       	call   5133 <exit>
+    2c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    2c38:	bb 01 00 00 00       	mov    $0x1,%ebx
+    2c3d:	eb b1                	jmp    2bf0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    2c3f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    2c41:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    2c44:	d1 f8                	sar    %eax
+    2c46:	83 c0 30             	add    $0x30,%eax
+    2c49:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    2c4c:	56                   	push   %esi
+    2c4d:	e8 31 25 00 00       	call   5183 <unlink>
+    2c52:	83 c4 10             	add    $0x10,%esp
+    2c55:	85 c0                	test   %eax,%eax
+    2c57:	79 cb                	jns    2c24 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    2c59:	52                   	push   %edx
+    2c5a:	52                   	push   %edx
+    2c5b:	68 fd 59 00 00       	push   $0x59fd
+    2c60:	6a 01                	push   $0x1
+    2c62:	e8 d9 26 00 00       	call   5340 <printf>
+            exit();
+    2c67:	e8 c7 24 00 00       	call   5133 <exit>
+    2c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    2c70:	83 ec 04             	sub    $0x4,%esp
+    2c73:	56                   	push   %esi
+    2c74:	68 1c 73 00 00       	push   $0x731c
+    2c79:	6a 01                	push   $0x1
+    2c7b:	e8 c0 26 00 00       	call   5340 <printf>
+        exit();
+    2c80:	e8 ae 24 00 00       	call   5133 <exit>
+      printf(1, "fork failed\n");
+    2c85:	83 ec 08             	sub    $0x8,%esp
+    2c88:	68 af 6d 00 00       	push   $0x6daf
+    2c8d:	6a 01                	push   $0x1
+    2c8f:	e8 ac 26 00 00       	call   5340 <printf>
+      exit();
+    2c94:	e8 9a 24 00 00       	call   5133 <exit>
+          printf(1, "create failed\n");
+    2c99:	83 ec 08             	sub    $0x8,%esp
+    2c9c:	68 80 65 00 00       	push   $0x6580
+    2ca1:	6a 01                	push   $0x1
+    2ca3:	e8 98 26 00 00       	call   5340 <printf>
+          exit();
+    2ca8:	e8 86 24 00 00       	call   5133 <exit>
+    2cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002cb0 <unlinkread>:
+{
+    2cb0:	55                   	push   %ebp
+    2cb1:	89 e5                	mov    %esp,%ebp
+    2cb3:	56                   	push   %esi
+    2cb4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    2cb5:	83 ec 08             	sub    $0x8,%esp
+    2cb8:	68 55 63 00 00       	push   $0x6355
+    2cbd:	6a 01                	push   $0x1
+    2cbf:	e8 7c 26 00 00       	call   5340 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2cc4:	5b                   	pop    %ebx
+    2cc5:	5e                   	pop    %esi
+    2cc6:	68 02 02 00 00       	push   $0x202
+    2ccb:	68 66 63 00 00       	push   $0x6366
+    2cd0:	e8 9e 24 00 00       	call   5173 <open>
+  if(fd < 0){
+    2cd5:	83 c4 10             	add    $0x10,%esp
+    2cd8:	85 c0                	test   %eax,%eax
+    2cda:	0f 88 e6 00 00 00    	js     2dc6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    2ce0:	83 ec 04             	sub    $0x4,%esp
+    2ce3:	89 c3                	mov    %eax,%ebx
+    2ce5:	6a 05                	push   $0x5
+    2ce7:	68 8b 63 00 00       	push   $0x638b
+    2cec:	50                   	push   %eax
+    2ced:	e8 61 24 00 00       	call   5153 <write>
+  close(fd);
+    2cf2:	89 1c 24             	mov    %ebx,(%esp)
+    2cf5:	e8 61 24 00 00       	call   515b <close>
+  fd = open("unlinkread", O_RDWR);
+    2cfa:	58                   	pop    %eax
+    2cfb:	5a                   	pop    %edx
+    2cfc:	6a 02                	push   $0x2
+    2cfe:	68 66 63 00 00       	push   $0x6366
+    2d03:	e8 6b 24 00 00       	call   5173 <open>
+  if(fd < 0){
+    2d08:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    2d0b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2d0d:	85 c0                	test   %eax,%eax
+    2d0f:	0f 88 10 01 00 00    	js     2e25 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    2d15:	83 ec 0c             	sub    $0xc,%esp
+    2d18:	68 66 63 00 00       	push   $0x6366
+    2d1d:	e8 61 24 00 00       	call   5183 <unlink>
+    2d22:	83 c4 10             	add    $0x10,%esp
+    2d25:	85 c0                	test   %eax,%eax
+    2d27:	0f 85 e5 00 00 00    	jne    2e12 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    2d2d:	83 ec 08             	sub    $0x8,%esp
+    2d30:	68 02 02 00 00       	push   $0x202
+    2d35:	68 66 63 00 00       	push   $0x6366
+    2d3a:	e8 34 24 00 00       	call   5173 <open>
+  write(fd1, "yyy", 3);
+    2d3f:	83 c4 0c             	add    $0xc,%esp
+    2d42:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    2d44:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    2d46:	68 c3 63 00 00       	push   $0x63c3
+    2d4b:	50                   	push   %eax
+    2d4c:	e8 02 24 00 00       	call   5153 <write>
+  close(fd1);
+    2d51:	89 34 24             	mov    %esi,(%esp)
+    2d54:	e8 02 24 00 00       	call   515b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2d59:	83 c4 0c             	add    $0xc,%esp
+    2d5c:	68 00 20 00 00       	push   $0x2000
+    2d61:	68 00 6f 04 00       	push   $0x46f00
+    2d66:	53                   	push   %ebx
+    2d67:	e8 df 23 00 00       	call   514b <read>
+    2d6c:	83 c4 10             	add    $0x10,%esp
+    2d6f:	83 f8 05             	cmp    $0x5,%eax
+    2d72:	0f 85 87 00 00 00    	jne    2dff <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    2d78:	80 3d 00 6f 04 00 68 	cmpb   $0x68,0x46f00
+    2d7f:	75 6b                	jne    2dec <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2d81:	83 ec 04             	sub    $0x4,%esp
+    2d84:	6a 0a                	push   $0xa
+    2d86:	68 00 6f 04 00       	push   $0x46f00
+    2d8b:	53                   	push   %ebx
+    2d8c:	e8 c2 23 00 00       	call   5153 <write>
+    2d91:	83 c4 10             	add    $0x10,%esp
+    2d94:	83 f8 0a             	cmp    $0xa,%eax
+    2d97:	75 40                	jne    2dd9 <unlinkread+0x129>
+  close(fd);
+    2d99:	83 ec 0c             	sub    $0xc,%esp
+    2d9c:	53                   	push   %ebx
+    2d9d:	e8 b9 23 00 00       	call   515b <close>
+  unlink("unlinkread");
+    2da2:	c7 04 24 66 63 00 00 	movl   $0x6366,(%esp)
+    2da9:	e8 d5 23 00 00       	call   5183 <unlink>
+  printf(1, "unlinkread ok\n");
+    2dae:	58                   	pop    %eax
+    2daf:	5a                   	pop    %edx
+    2db0:	68 0e 64 00 00       	push   $0x640e
+    2db5:	6a 01                	push   $0x1
+    2db7:	e8 84 25 00 00       	call   5340 <printf>
+}
+    2dbc:	83 c4 10             	add    $0x10,%esp
+    2dbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2dc2:	5b                   	pop    %ebx
+    2dc3:	5e                   	pop    %esi
+    2dc4:	5d                   	pop    %ebp
+    2dc5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2dc6:	51                   	push   %ecx
+    2dc7:	51                   	push   %ecx
+    2dc8:	68 71 63 00 00       	push   $0x6371
+    2dcd:	6a 01                	push   $0x1
+    2dcf:	e8 6c 25 00 00       	call   5340 <printf>
+    exit();
+    2dd4:	e8 5a 23 00 00       	call   5133 <exit>
+    printf(1, "unlinkread write failed\n");
+    2dd9:	51                   	push   %ecx
+    2dda:	51                   	push   %ecx
+    2ddb:	68 f5 63 00 00       	push   $0x63f5
+    2de0:	6a 01                	push   $0x1
+    2de2:	e8 59 25 00 00       	call   5340 <printf>
+    exit();
+    2de7:	e8 47 23 00 00       	call   5133 <exit>
+    printf(1, "unlinkread wrong data\n");
+    2dec:	53                   	push   %ebx
+    2ded:	53                   	push   %ebx
+    2dee:	68 de 63 00 00       	push   $0x63de
+    2df3:	6a 01                	push   $0x1
+    2df5:	e8 46 25 00 00       	call   5340 <printf>
+    exit();
+    2dfa:	e8 34 23 00 00       	call   5133 <exit>
+    printf(1, "unlinkread read failed");
+    2dff:	56                   	push   %esi
+    2e00:	56                   	push   %esi
+    2e01:	68 c7 63 00 00       	push   $0x63c7
+    2e06:	6a 01                	push   $0x1
+    2e08:	e8 33 25 00 00       	call   5340 <printf>
+    exit();
+    2e0d:	e8 21 23 00 00       	call   5133 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    2e12:	50                   	push   %eax
+    2e13:	50                   	push   %eax
+    2e14:	68 a9 63 00 00       	push   $0x63a9
+    2e19:	6a 01                	push   $0x1
+    2e1b:	e8 20 25 00 00       	call   5340 <printf>
+    exit();
+    2e20:	e8 0e 23 00 00       	call   5133 <exit>
+    printf(1, "open unlinkread failed\n");
+    2e25:	50                   	push   %eax
+    2e26:	50                   	push   %eax
+    2e27:	68 91 63 00 00       	push   $0x6391
+    2e2c:	6a 01                	push   $0x1
+    2e2e:	e8 0d 25 00 00       	call   5340 <printf>
+    exit();
+    2e33:	e8 fb 22 00 00       	call   5133 <exit>
+    2e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e3f:	90                   	nop
+
+00002e40 <linktest>:
+{
+    2e40:	55                   	push   %ebp
+    2e41:	89 e5                	mov    %esp,%ebp
+    2e43:	53                   	push   %ebx
+    2e44:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    2e47:	68 1d 64 00 00       	push   $0x641d
+    2e4c:	6a 01                	push   $0x1
+    2e4e:	e8 ed 24 00 00       	call   5340 <printf>
+  unlink("lf1");
+    2e53:	c7 04 24 27 64 00 00 	movl   $0x6427,(%esp)
+    2e5a:	e8 24 23 00 00       	call   5183 <unlink>
+  unlink("lf2");
+    2e5f:	c7 04 24 2b 64 00 00 	movl   $0x642b,(%esp)
+    2e66:	e8 18 23 00 00       	call   5183 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    2e6b:	58                   	pop    %eax
+    2e6c:	5a                   	pop    %edx
+    2e6d:	68 02 02 00 00       	push   $0x202
+    2e72:	68 27 64 00 00       	push   $0x6427
+    2e77:	e8 f7 22 00 00       	call   5173 <open>
+  if(fd < 0){
+    2e7c:	83 c4 10             	add    $0x10,%esp
+    2e7f:	85 c0                	test   %eax,%eax
+    2e81:	0f 88 1e 01 00 00    	js     2fa5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2e87:	83 ec 04             	sub    $0x4,%esp
+    2e8a:	89 c3                	mov    %eax,%ebx
+    2e8c:	6a 05                	push   $0x5
+    2e8e:	68 8b 63 00 00       	push   $0x638b
+    2e93:	50                   	push   %eax
+    2e94:	e8 ba 22 00 00       	call   5153 <write>
+    2e99:	83 c4 10             	add    $0x10,%esp
+    2e9c:	83 f8 05             	cmp    $0x5,%eax
+    2e9f:	0f 85 98 01 00 00    	jne    303d <linktest+0x1fd>
+  close(fd);
+    2ea5:	83 ec 0c             	sub    $0xc,%esp
+    2ea8:	53                   	push   %ebx
+    2ea9:	e8 ad 22 00 00       	call   515b <close>
+  if(link("lf1", "lf2") < 0){
+    2eae:	5b                   	pop    %ebx
+    2eaf:	58                   	pop    %eax
+    2eb0:	68 2b 64 00 00       	push   $0x642b
+    2eb5:	68 27 64 00 00       	push   $0x6427
+    2eba:	e8 d4 22 00 00       	call   5193 <link>
+    2ebf:	83 c4 10             	add    $0x10,%esp
+    2ec2:	85 c0                	test   %eax,%eax
+    2ec4:	0f 88 60 01 00 00    	js     302a <linktest+0x1ea>
+  unlink("lf1");
+    2eca:	83 ec 0c             	sub    $0xc,%esp
+    2ecd:	68 27 64 00 00       	push   $0x6427
+    2ed2:	e8 ac 22 00 00       	call   5183 <unlink>
+  if(open("lf1", 0) >= 0){
+    2ed7:	58                   	pop    %eax
+    2ed8:	5a                   	pop    %edx
+    2ed9:	6a 00                	push   $0x0
+    2edb:	68 27 64 00 00       	push   $0x6427
+    2ee0:	e8 8e 22 00 00       	call   5173 <open>
+    2ee5:	83 c4 10             	add    $0x10,%esp
+    2ee8:	85 c0                	test   %eax,%eax
+    2eea:	0f 89 27 01 00 00    	jns    3017 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    2ef0:	83 ec 08             	sub    $0x8,%esp
+    2ef3:	6a 00                	push   $0x0
+    2ef5:	68 2b 64 00 00       	push   $0x642b
+    2efa:	e8 74 22 00 00       	call   5173 <open>
+  if(fd < 0){
+    2eff:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    2f02:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2f04:	85 c0                	test   %eax,%eax
+    2f06:	0f 88 f8 00 00 00    	js     3004 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2f0c:	83 ec 04             	sub    $0x4,%esp
+    2f0f:	68 00 20 00 00       	push   $0x2000
+    2f14:	68 00 6f 04 00       	push   $0x46f00
+    2f19:	50                   	push   %eax
+    2f1a:	e8 2c 22 00 00       	call   514b <read>
+    2f1f:	83 c4 10             	add    $0x10,%esp
+    2f22:	83 f8 05             	cmp    $0x5,%eax
+    2f25:	0f 85 c6 00 00 00    	jne    2ff1 <linktest+0x1b1>
+  close(fd);
+    2f2b:	83 ec 0c             	sub    $0xc,%esp
+    2f2e:	53                   	push   %ebx
+    2f2f:	e8 27 22 00 00       	call   515b <close>
+  if(link("lf2", "lf2") >= 0){
+    2f34:	58                   	pop    %eax
+    2f35:	5a                   	pop    %edx
+    2f36:	68 2b 64 00 00       	push   $0x642b
+    2f3b:	68 2b 64 00 00       	push   $0x642b
+    2f40:	e8 4e 22 00 00       	call   5193 <link>
+    2f45:	83 c4 10             	add    $0x10,%esp
+    2f48:	85 c0                	test   %eax,%eax
+    2f4a:	0f 89 8e 00 00 00    	jns    2fde <linktest+0x19e>
+  unlink("lf2");
+    2f50:	83 ec 0c             	sub    $0xc,%esp
+    2f53:	68 2b 64 00 00       	push   $0x642b
+    2f58:	e8 26 22 00 00       	call   5183 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    2f5d:	59                   	pop    %ecx
+    2f5e:	5b                   	pop    %ebx
+    2f5f:	68 27 64 00 00       	push   $0x6427
+    2f64:	68 2b 64 00 00       	push   $0x642b
+    2f69:	e8 25 22 00 00       	call   5193 <link>
+    2f6e:	83 c4 10             	add    $0x10,%esp
+    2f71:	85 c0                	test   %eax,%eax
+    2f73:	79 56                	jns    2fcb <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    2f75:	83 ec 08             	sub    $0x8,%esp
+    2f78:	68 27 64 00 00       	push   $0x6427
+    2f7d:	68 ef 66 00 00       	push   $0x66ef
+    2f82:	e8 0c 22 00 00       	call   5193 <link>
+    2f87:	83 c4 10             	add    $0x10,%esp
+    2f8a:	85 c0                	test   %eax,%eax
+    2f8c:	79 2a                	jns    2fb8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    2f8e:	83 ec 08             	sub    $0x8,%esp
+    2f91:	68 c5 64 00 00       	push   $0x64c5
+    2f96:	6a 01                	push   $0x1
+    2f98:	e8 a3 23 00 00       	call   5340 <printf>
+}
+    2f9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2fa0:	83 c4 10             	add    $0x10,%esp
+    2fa3:	c9                   	leave
+    2fa4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2fa5:	50                   	push   %eax
+    2fa6:	50                   	push   %eax
+    2fa7:	68 2f 64 00 00       	push   $0x642f
+    2fac:	6a 01                	push   $0x1
+    2fae:	e8 8d 23 00 00       	call   5340 <printf>
+    exit();
+    2fb3:	e8 7b 21 00 00       	call   5133 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2fb8:	50                   	push   %eax
+    2fb9:	50                   	push   %eax
+    2fba:	68 a9 64 00 00       	push   $0x64a9
+    2fbf:	6a 01                	push   $0x1
+    2fc1:	e8 7a 23 00 00       	call   5340 <printf>
+    exit();
+    2fc6:	e8 68 21 00 00       	call   5133 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    2fcb:	52                   	push   %edx
+    2fcc:	52                   	push   %edx
+    2fcd:	68 88 73 00 00       	push   $0x7388
+    2fd2:	6a 01                	push   $0x1
+    2fd4:	e8 67 23 00 00       	call   5340 <printf>
+    exit();
+    2fd9:	e8 55 21 00 00       	call   5133 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    2fde:	50                   	push   %eax
+    2fdf:	50                   	push   %eax
+    2fe0:	68 8b 64 00 00       	push   $0x648b
+    2fe5:	6a 01                	push   $0x1
+    2fe7:	e8 54 23 00 00       	call   5340 <printf>
+    exit();
+    2fec:	e8 42 21 00 00       	call   5133 <exit>
+    printf(1, "read lf2 failed\n");
+    2ff1:	51                   	push   %ecx
+    2ff2:	51                   	push   %ecx
+    2ff3:	68 7a 64 00 00       	push   $0x647a
+    2ff8:	6a 01                	push   $0x1
+    2ffa:	e8 41 23 00 00       	call   5340 <printf>
+    exit();
+    2fff:	e8 2f 21 00 00       	call   5133 <exit>
+    printf(1, "open lf2 failed\n");
+    3004:	53                   	push   %ebx
+    3005:	53                   	push   %ebx
+    3006:	68 69 64 00 00       	push   $0x6469
+    300b:	6a 01                	push   $0x1
+    300d:	e8 2e 23 00 00       	call   5340 <printf>
+    exit();
+    3012:	e8 1c 21 00 00       	call   5133 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    3017:	50                   	push   %eax
+    3018:	50                   	push   %eax
+    3019:	68 60 73 00 00       	push   $0x7360
+    301e:	6a 01                	push   $0x1
+    3020:	e8 1b 23 00 00       	call   5340 <printf>
+    exit();
+    3025:	e8 09 21 00 00       	call   5133 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    302a:	51                   	push   %ecx
+    302b:	51                   	push   %ecx
+    302c:	68 54 64 00 00       	push   $0x6454
+    3031:	6a 01                	push   $0x1
+    3033:	e8 08 23 00 00       	call   5340 <printf>
+    exit();
+    3038:	e8 f6 20 00 00       	call   5133 <exit>
+    printf(1, "write lf1 failed\n");
+    303d:	50                   	push   %eax
+    303e:	50                   	push   %eax
+    303f:	68 42 64 00 00       	push   $0x6442
+    3044:	6a 01                	push   $0x1
+    3046:	e8 f5 22 00 00       	call   5340 <printf>
+    exit();
+    304b:	e8 e3 20 00 00       	call   5133 <exit>
+
+00003050 <concreate>:
+{
+    3050:	55                   	push   %ebp
+    3051:	89 e5                	mov    %esp,%ebp
+    3053:	57                   	push   %edi
+    3054:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    3055:	31 f6                	xor    %esi,%esi
+{
+    3057:	53                   	push   %ebx
+    3058:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    305b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    305e:	68 d2 64 00 00       	push   $0x64d2
+    3063:	6a 01                	push   $0x1
+    3065:	e8 d6 22 00 00       	call   5340 <printf>
+  file[0] = 'C';
+    306a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    306e:	83 c4 10             	add    $0x10,%esp
+    3071:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    3075:	eb 4c                	jmp    30c3 <concreate+0x73>
+    3077:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    307e:	66 90                	xchg   %ax,%ax
+    3080:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    3086:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    308b:	0f 83 8f 00 00 00    	jae    3120 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    3091:	83 ec 08             	sub    $0x8,%esp
+    3094:	68 02 02 00 00       	push   $0x202
+    3099:	53                   	push   %ebx
+    309a:	e8 d4 20 00 00       	call   5173 <open>
+      if(fd < 0){
+    309f:	83 c4 10             	add    $0x10,%esp
+    30a2:	85 c0                	test   %eax,%eax
+    30a4:	78 63                	js     3109 <concreate+0xb9>
+      close(fd);
+    30a6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    30a9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    30ac:	50                   	push   %eax
+    30ad:	e8 a9 20 00 00       	call   515b <close>
+    30b2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    30b5:	e8 81 20 00 00       	call   513b <wait>
+  for(i = 0; i < 40; i++){
+    30ba:	83 fe 28             	cmp    $0x28,%esi
+    30bd:	0f 84 7f 00 00 00    	je     3142 <concreate+0xf2>
+    unlink(file);
+    30c3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    30c6:	8d 46 30             	lea    0x30(%esi),%eax
+    30c9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    30cc:	53                   	push   %ebx
+    30cd:	e8 b1 20 00 00       	call   5183 <unlink>
+    pid = fork();
+    30d2:	e8 54 20 00 00       	call   512b <fork>
+    if(pid && (i % 3) == 1){
+    30d7:	83 c4 10             	add    $0x10,%esp
+    30da:	85 c0                	test   %eax,%eax
+    30dc:	75 a2                	jne    3080 <concreate+0x30>
+      link("C0", file);
+    30de:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    30e4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    30ea:	0f 83 d0 00 00 00    	jae    31c0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    30f0:	83 ec 08             	sub    $0x8,%esp
+    30f3:	68 02 02 00 00       	push   $0x202
+    30f8:	53                   	push   %ebx
+    30f9:	e8 75 20 00 00       	call   5173 <open>
+      if(fd < 0){
+    30fe:	83 c4 10             	add    $0x10,%esp
+    3101:	85 c0                	test   %eax,%eax
+    3103:	0f 89 ea 01 00 00    	jns    32f3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    3109:	83 ec 04             	sub    $0x4,%esp
+    310c:	53                   	push   %ebx
+    310d:	68 e5 64 00 00       	push   $0x64e5
+    3112:	6a 01                	push   $0x1
+    3114:	e8 27 22 00 00       	call   5340 <printf>
+        exit();
+    3119:	e8 15 20 00 00       	call   5133 <exit>
+    311e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    3120:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    3123:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    3126:	53                   	push   %ebx
+    3127:	68 e2 64 00 00       	push   $0x64e2
+    312c:	e8 62 20 00 00       	call   5193 <link>
+    3131:	83 c4 10             	add    $0x10,%esp
+      wait();
+    3134:	e8 02 20 00 00       	call   513b <wait>
+  for(i = 0; i < 40; i++){
+    3139:	83 fe 28             	cmp    $0x28,%esi
+    313c:	0f 85 81 ff ff ff    	jne    30c3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    3142:	83 ec 04             	sub    $0x4,%esp
+    3145:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    3148:	6a 28                	push   $0x28
+    314a:	6a 00                	push   $0x0
+    314c:	50                   	push   %eax
+    314d:	e8 5e 1e 00 00       	call   4fb0 <memset>
+  fd = open(".", 0);
+    3152:	5e                   	pop    %esi
+    3153:	5f                   	pop    %edi
+    3154:	6a 00                	push   $0x0
+    3156:	68 ef 66 00 00       	push   $0x66ef
+    315b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    315e:	e8 10 20 00 00       	call   5173 <open>
+  n = 0;
+    3163:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    316a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    316d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    316f:	90                   	nop
+    3170:	83 ec 04             	sub    $0x4,%esp
+    3173:	6a 10                	push   $0x10
+    3175:	57                   	push   %edi
+    3176:	56                   	push   %esi
+    3177:	e8 cf 1f 00 00       	call   514b <read>
+    317c:	83 c4 10             	add    $0x10,%esp
+    317f:	85 c0                	test   %eax,%eax
+    3181:	7e 5d                	jle    31e0 <concreate+0x190>
+    if(de.inum == 0)
+    3183:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    3188:	74 e6                	je     3170 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    318a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    318e:	75 e0                	jne    3170 <concreate+0x120>
+    3190:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    3194:	75 da                	jne    3170 <concreate+0x120>
+      i = de.name[1] - '0';
+    3196:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    319a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    319d:	83 f8 27             	cmp    $0x27,%eax
+    31a0:	0f 87 5e 01 00 00    	ja     3304 <concreate+0x2b4>
+      if(fa[i]){
+    31a6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    31ab:	0f 85 7e 01 00 00    	jne    332f <concreate+0x2df>
+      n++;
+    31b1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    31b5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    31ba:	eb b4                	jmp    3170 <concreate+0x120>
+    31bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    31c0:	83 ec 08             	sub    $0x8,%esp
+    31c3:	53                   	push   %ebx
+    31c4:	68 e2 64 00 00       	push   $0x64e2
+    31c9:	e8 c5 1f 00 00       	call   5193 <link>
+    31ce:	83 c4 10             	add    $0x10,%esp
+      exit();
+    31d1:	e8 5d 1f 00 00       	call   5133 <exit>
+    31d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31dd:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    31e0:	83 ec 0c             	sub    $0xc,%esp
+    31e3:	56                   	push   %esi
+    31e4:	e8 72 1f 00 00       	call   515b <close>
+  if(n != 40){
+    31e9:	83 c4 10             	add    $0x10,%esp
+    31ec:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    31f0:	0f 85 26 01 00 00    	jne    331c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    31f6:	31 f6                	xor    %esi,%esi
+    31f8:	eb 48                	jmp    3242 <concreate+0x1f2>
+    31fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    3200:	85 ff                	test   %edi,%edi
+    3202:	74 05                	je     3209 <concreate+0x1b9>
+    3204:	83 f8 01             	cmp    $0x1,%eax
+    3207:	74 68                	je     3271 <concreate+0x221>
+      unlink(file);
+    3209:	83 ec 0c             	sub    $0xc,%esp
+    320c:	53                   	push   %ebx
+    320d:	e8 71 1f 00 00       	call   5183 <unlink>
+      unlink(file);
+    3212:	89 1c 24             	mov    %ebx,(%esp)
+    3215:	e8 69 1f 00 00       	call   5183 <unlink>
+      unlink(file);
+    321a:	89 1c 24             	mov    %ebx,(%esp)
+    321d:	e8 61 1f 00 00       	call   5183 <unlink>
+      unlink(file);
+    3222:	89 1c 24             	mov    %ebx,(%esp)
+    3225:	e8 59 1f 00 00       	call   5183 <unlink>
+    322a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    322d:	85 ff                	test   %edi,%edi
+    322f:	74 a0                	je     31d1 <concreate+0x181>
+      wait();
+    3231:	e8 05 1f 00 00       	call   513b <wait>
+  for(i = 0; i < 40; i++){
+    3236:	83 c6 01             	add    $0x1,%esi
+    3239:	83 fe 28             	cmp    $0x28,%esi
+    323c:	0f 84 86 00 00 00    	je     32c8 <concreate+0x278>
+    file[1] = '0' + i;
+    3242:	8d 46 30             	lea    0x30(%esi),%eax
+    3245:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    3248:	e8 de 1e 00 00       	call   512b <fork>
+    324d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    324f:	85 c0                	test   %eax,%eax
+    3251:	0f 88 88 00 00 00    	js     32df <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    3257:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    325c:	f7 e6                	mul    %esi
+    325e:	89 d0                	mov    %edx,%eax
+    3260:	83 e2 fe             	and    $0xfffffffe,%edx
+    3263:	d1 e8                	shr    %eax
+    3265:	01 c2                	add    %eax,%edx
+    3267:	89 f0                	mov    %esi,%eax
+    3269:	29 d0                	sub    %edx,%eax
+    326b:	89 c1                	mov    %eax,%ecx
+    326d:	09 f9                	or     %edi,%ecx
+    326f:	75 8f                	jne    3200 <concreate+0x1b0>
+      close(open(file, 0));
+    3271:	83 ec 08             	sub    $0x8,%esp
+    3274:	6a 00                	push   $0x0
+    3276:	53                   	push   %ebx
+    3277:	e8 f7 1e 00 00       	call   5173 <open>
+    327c:	89 04 24             	mov    %eax,(%esp)
+    327f:	e8 d7 1e 00 00       	call   515b <close>
+      close(open(file, 0));
+    3284:	58                   	pop    %eax
+    3285:	5a                   	pop    %edx
+    3286:	6a 00                	push   $0x0
+    3288:	53                   	push   %ebx
+    3289:	e8 e5 1e 00 00       	call   5173 <open>
+    328e:	89 04 24             	mov    %eax,(%esp)
+    3291:	e8 c5 1e 00 00       	call   515b <close>
+      close(open(file, 0));
+    3296:	59                   	pop    %ecx
+    3297:	58                   	pop    %eax
+    3298:	6a 00                	push   $0x0
+    329a:	53                   	push   %ebx
+    329b:	e8 d3 1e 00 00       	call   5173 <open>
+    32a0:	89 04 24             	mov    %eax,(%esp)
+    32a3:	e8 b3 1e 00 00       	call   515b <close>
+      close(open(file, 0));
+    32a8:	58                   	pop    %eax
+    32a9:	5a                   	pop    %edx
+    32aa:	6a 00                	push   $0x0
+    32ac:	53                   	push   %ebx
+    32ad:	e8 c1 1e 00 00       	call   5173 <open>
+    32b2:	89 04 24             	mov    %eax,(%esp)
+    32b5:	e8 a1 1e 00 00       	call   515b <close>
+    32ba:	83 c4 10             	add    $0x10,%esp
+    32bd:	e9 6b ff ff ff       	jmp    322d <concreate+0x1dd>
+    32c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    32c8:	83 ec 08             	sub    $0x8,%esp
+    32cb:	68 37 65 00 00       	push   $0x6537
+    32d0:	6a 01                	push   $0x1
+    32d2:	e8 69 20 00 00       	call   5340 <printf>
+}
+    32d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    32da:	5b                   	pop    %ebx
+    32db:	5e                   	pop    %esi
+    32dc:	5f                   	pop    %edi
+    32dd:	5d                   	pop    %ebp
+    32de:	c3                   	ret
+      printf(1, "fork failed\n");
+    32df:	83 ec 08             	sub    $0x8,%esp
+    32e2:	68 af 6d 00 00       	push   $0x6daf
+    32e7:	6a 01                	push   $0x1
+    32e9:	e8 52 20 00 00       	call   5340 <printf>
+      exit();
+    32ee:	e8 40 1e 00 00       	call   5133 <exit>
+      close(fd);
+    32f3:	83 ec 0c             	sub    $0xc,%esp
+    32f6:	50                   	push   %eax
+    32f7:	e8 5f 1e 00 00       	call   515b <close>
+    32fc:	83 c4 10             	add    $0x10,%esp
+    32ff:	e9 cd fe ff ff       	jmp    31d1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    3304:	83 ec 04             	sub    $0x4,%esp
+    3307:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    330a:	50                   	push   %eax
+    330b:	68 01 65 00 00       	push   $0x6501
+    3310:	6a 01                	push   $0x1
+    3312:	e8 29 20 00 00       	call   5340 <printf>
+        exit();
+    3317:	e8 17 1e 00 00       	call   5133 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    331c:	51                   	push   %ecx
+    331d:	51                   	push   %ecx
+    331e:	68 ac 73 00 00       	push   $0x73ac
+    3323:	6a 01                	push   $0x1
+    3325:	e8 16 20 00 00       	call   5340 <printf>
+    exit();
+    332a:	e8 04 1e 00 00       	call   5133 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    332f:	83 ec 04             	sub    $0x4,%esp
+    3332:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    3335:	50                   	push   %eax
+    3336:	68 1a 65 00 00       	push   $0x651a
+    333b:	6a 01                	push   $0x1
+    333d:	e8 fe 1f 00 00       	call   5340 <printf>
+        exit();
+    3342:	e8 ec 1d 00 00       	call   5133 <exit>
+    3347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    334e:	66 90                	xchg   %ax,%ax
+
+00003350 <linkunlink>:
+{
+    3350:	55                   	push   %ebp
+    3351:	89 e5                	mov    %esp,%ebp
+    3353:	57                   	push   %edi
+    3354:	56                   	push   %esi
+    3355:	53                   	push   %ebx
+    3356:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    3359:	68 45 65 00 00       	push   $0x6545
+    335e:	6a 01                	push   $0x1
+    3360:	e8 db 1f 00 00       	call   5340 <printf>
+  unlink("x");
+    3365:	c7 04 24 d2 67 00 00 	movl   $0x67d2,(%esp)
+    336c:	e8 12 1e 00 00       	call   5183 <unlink>
+  pid = fork();
+    3371:	e8 b5 1d 00 00       	call   512b <fork>
+  if(pid < 0){
+    3376:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3379:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    337c:	85 c0                	test   %eax,%eax
+    337e:	0f 88 b6 00 00 00    	js     343a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    3384:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    3388:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    338d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    3392:	19 ff                	sbb    %edi,%edi
+    3394:	83 e7 60             	and    $0x60,%edi
+    3397:	83 c7 01             	add    $0x1,%edi
+    339a:	eb 1e                	jmp    33ba <linkunlink+0x6a>
+    339c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    33a0:	83 f8 01             	cmp    $0x1,%eax
+    33a3:	74 7b                	je     3420 <linkunlink+0xd0>
+      unlink("x");
+    33a5:	83 ec 0c             	sub    $0xc,%esp
+    33a8:	68 d2 67 00 00       	push   $0x67d2
+    33ad:	e8 d1 1d 00 00       	call   5183 <unlink>
+    33b2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    33b5:	83 eb 01             	sub    $0x1,%ebx
+    33b8:	74 41                	je     33fb <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    33ba:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    33c0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    33c6:	89 f8                	mov    %edi,%eax
+    33c8:	f7 e6                	mul    %esi
+    33ca:	89 d0                	mov    %edx,%eax
+    33cc:	83 e2 fe             	and    $0xfffffffe,%edx
+    33cf:	d1 e8                	shr    %eax
+    33d1:	01 c2                	add    %eax,%edx
+    33d3:	89 f8                	mov    %edi,%eax
+    33d5:	29 d0                	sub    %edx,%eax
+    33d7:	75 c7                	jne    33a0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    33d9:	83 ec 08             	sub    $0x8,%esp
+    33dc:	68 02 02 00 00       	push   $0x202
+    33e1:	68 d2 67 00 00       	push   $0x67d2
+    33e6:	e8 88 1d 00 00       	call   5173 <open>
+    33eb:	89 04 24             	mov    %eax,(%esp)
+    33ee:	e8 68 1d 00 00       	call   515b <close>
+    33f3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    33f6:	83 eb 01             	sub    $0x1,%ebx
+    33f9:	75 bf                	jne    33ba <linkunlink+0x6a>
+  if(pid)
+    33fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    33fe:	85 c0                	test   %eax,%eax
+    3400:	74 4b                	je     344d <linkunlink+0xfd>
+    wait();
+    3402:	e8 34 1d 00 00       	call   513b <wait>
+  printf(1, "linkunlink ok\n");
+    3407:	83 ec 08             	sub    $0x8,%esp
+    340a:	68 5a 65 00 00       	push   $0x655a
+    340f:	6a 01                	push   $0x1
+    3411:	e8 2a 1f 00 00       	call   5340 <printf>
+}
+    3416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3419:	5b                   	pop    %ebx
+    341a:	5e                   	pop    %esi
+    341b:	5f                   	pop    %edi
+    341c:	5d                   	pop    %ebp
+    341d:	c3                   	ret
+    341e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    3420:	83 ec 08             	sub    $0x8,%esp
+    3423:	68 d2 67 00 00       	push   $0x67d2
+    3428:	68 56 65 00 00       	push   $0x6556
+    342d:	e8 61 1d 00 00       	call   5193 <link>
+    3432:	83 c4 10             	add    $0x10,%esp
+    3435:	e9 7b ff ff ff       	jmp    33b5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    343a:	52                   	push   %edx
+    343b:	52                   	push   %edx
+    343c:	68 af 6d 00 00       	push   $0x6daf
+    3441:	6a 01                	push   $0x1
+    3443:	e8 f8 1e 00 00       	call   5340 <printf>
+    exit();
+    3448:	e8 e6 1c 00 00       	call   5133 <exit>
+    exit();
+    344d:	e8 e1 1c 00 00       	call   5133 <exit>
+    3452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003460 <bigdir>:
+{
+    3460:	55                   	push   %ebp
+    3461:	89 e5                	mov    %esp,%ebp
+    3463:	57                   	push   %edi
+    3464:	56                   	push   %esi
+    3465:	53                   	push   %ebx
+    3466:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    3469:	68 69 65 00 00       	push   $0x6569
+    346e:	6a 01                	push   $0x1
+    3470:	e8 cb 1e 00 00       	call   5340 <printf>
+  unlink("bd");
+    3475:	c7 04 24 76 65 00 00 	movl   $0x6576,(%esp)
+    347c:	e8 02 1d 00 00       	call   5183 <unlink>
+  fd = open("bd", O_CREATE);
+    3481:	5a                   	pop    %edx
+    3482:	59                   	pop    %ecx
+    3483:	68 00 02 00 00       	push   $0x200
+    3488:	68 76 65 00 00       	push   $0x6576
+    348d:	e8 e1 1c 00 00       	call   5173 <open>
+  if(fd < 0){
+    3492:	83 c4 10             	add    $0x10,%esp
+    3495:	85 c0                	test   %eax,%eax
+    3497:	0f 88 de 00 00 00    	js     357b <bigdir+0x11b>
+  close(fd);
+    349d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    34a0:	31 f6                	xor    %esi,%esi
+    34a2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    34a5:	50                   	push   %eax
+    34a6:	e8 b0 1c 00 00       	call   515b <close>
+    34ab:	83 c4 10             	add    $0x10,%esp
+    34ae:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    34b0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    34b2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    34b5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    34b9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    34bc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    34c0:	83 c0 30             	add    $0x30,%eax
+    34c3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    34c6:	89 f0                	mov    %esi,%eax
+    34c8:	83 e0 3f             	and    $0x3f,%eax
+    34cb:	83 c0 30             	add    $0x30,%eax
+    34ce:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    34d1:	57                   	push   %edi
+    34d2:	68 76 65 00 00       	push   $0x6576
+    34d7:	e8 b7 1c 00 00       	call   5193 <link>
+    34dc:	83 c4 10             	add    $0x10,%esp
+    34df:	89 c3                	mov    %eax,%ebx
+    34e1:	85 c0                	test   %eax,%eax
+    34e3:	75 6e                	jne    3553 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    34e5:	83 c6 01             	add    $0x1,%esi
+    34e8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    34ee:	75 c0                	jne    34b0 <bigdir+0x50>
+  unlink("bd");
+    34f0:	83 ec 0c             	sub    $0xc,%esp
+    34f3:	68 76 65 00 00       	push   $0x6576
+    34f8:	e8 86 1c 00 00       	call   5183 <unlink>
+    34fd:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    3500:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    3502:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    3505:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    3509:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    350c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    3510:	83 c0 30             	add    $0x30,%eax
+    3513:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    3516:	89 d8                	mov    %ebx,%eax
+    3518:	83 e0 3f             	and    $0x3f,%eax
+    351b:	83 c0 30             	add    $0x30,%eax
+    351e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    3521:	57                   	push   %edi
+    3522:	e8 5c 1c 00 00       	call   5183 <unlink>
+    3527:	83 c4 10             	add    $0x10,%esp
+    352a:	85 c0                	test   %eax,%eax
+    352c:	75 39                	jne    3567 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    352e:	83 c3 01             	add    $0x1,%ebx
+    3531:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    3537:	75 c7                	jne    3500 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    3539:	83 ec 08             	sub    $0x8,%esp
+    353c:	68 b8 65 00 00       	push   $0x65b8
+    3541:	6a 01                	push   $0x1
+    3543:	e8 f8 1d 00 00       	call   5340 <printf>
+    3548:	83 c4 10             	add    $0x10,%esp
+}
+    354b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    354e:	5b                   	pop    %ebx
+    354f:	5e                   	pop    %esi
+    3550:	5f                   	pop    %edi
+    3551:	5d                   	pop    %ebp
+    3552:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    3553:	83 ec 08             	sub    $0x8,%esp
+    3556:	68 8f 65 00 00       	push   $0x658f
+    355b:	6a 01                	push   $0x1
+    355d:	e8 de 1d 00 00       	call   5340 <printf>
+      exit();
+    3562:	e8 cc 1b 00 00       	call   5133 <exit>
+      printf(1, "bigdir unlink failed");
+    3567:	83 ec 08             	sub    $0x8,%esp
+    356a:	68 a3 65 00 00       	push   $0x65a3
+    356f:	6a 01                	push   $0x1
+    3571:	e8 ca 1d 00 00       	call   5340 <printf>
+      exit();
+    3576:	e8 b8 1b 00 00       	call   5133 <exit>
+    printf(1, "bigdir create failed\n");
+    357b:	50                   	push   %eax
+    357c:	50                   	push   %eax
+    357d:	68 79 65 00 00       	push   $0x6579
+    3582:	6a 01                	push   $0x1
+    3584:	e8 b7 1d 00 00       	call   5340 <printf>
+    exit();
+    3589:	e8 a5 1b 00 00       	call   5133 <exit>
+    358e:	66 90                	xchg   %ax,%ax
+
+00003590 <subdir>:
+{
+    3590:	55                   	push   %ebp
+    3591:	89 e5                	mov    %esp,%ebp
+    3593:	53                   	push   %ebx
+    3594:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    3597:	68 c3 65 00 00       	push   $0x65c3
+    359c:	6a 01                	push   $0x1
+    359e:	e8 9d 1d 00 00       	call   5340 <printf>
+  unlink("ff");
+    35a3:	c7 04 24 4c 66 00 00 	movl   $0x664c,(%esp)
+    35aa:	e8 d4 1b 00 00       	call   5183 <unlink>
+  if(mkdir("dd") != 0){
+    35af:	c7 04 24 e9 66 00 00 	movl   $0x66e9,(%esp)
+    35b6:	e8 e0 1b 00 00       	call   519b <mkdir>
+    35bb:	83 c4 10             	add    $0x10,%esp
+    35be:	85 c0                	test   %eax,%eax
+    35c0:	0f 85 b3 05 00 00    	jne    3b79 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    35c6:	83 ec 08             	sub    $0x8,%esp
+    35c9:	68 02 02 00 00       	push   $0x202
+    35ce:	68 22 66 00 00       	push   $0x6622
+    35d3:	e8 9b 1b 00 00       	call   5173 <open>
+  if(fd < 0){
+    35d8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    35db:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    35dd:	85 c0                	test   %eax,%eax
+    35df:	0f 88 81 05 00 00    	js     3b66 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    35e5:	83 ec 04             	sub    $0x4,%esp
+    35e8:	6a 02                	push   $0x2
+    35ea:	68 4c 66 00 00       	push   $0x664c
+    35ef:	50                   	push   %eax
+    35f0:	e8 5e 1b 00 00       	call   5153 <write>
+  close(fd);
+    35f5:	89 1c 24             	mov    %ebx,(%esp)
+    35f8:	e8 5e 1b 00 00       	call   515b <close>
+  if(unlink("dd") >= 0){
+    35fd:	c7 04 24 e9 66 00 00 	movl   $0x66e9,(%esp)
+    3604:	e8 7a 1b 00 00       	call   5183 <unlink>
+    3609:	83 c4 10             	add    $0x10,%esp
+    360c:	85 c0                	test   %eax,%eax
+    360e:	0f 89 3f 05 00 00    	jns    3b53 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    3614:	83 ec 0c             	sub    $0xc,%esp
+    3617:	68 fd 65 00 00       	push   $0x65fd
+    361c:	e8 7a 1b 00 00       	call   519b <mkdir>
+    3621:	83 c4 10             	add    $0x10,%esp
+    3624:	85 c0                	test   %eax,%eax
+    3626:	0f 85 14 05 00 00    	jne    3b40 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    362c:	83 ec 08             	sub    $0x8,%esp
+    362f:	68 02 02 00 00       	push   $0x202
+    3634:	68 1f 66 00 00       	push   $0x661f
+    3639:	e8 35 1b 00 00       	call   5173 <open>
+  if(fd < 0){
+    363e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    3641:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3643:	85 c0                	test   %eax,%eax
+    3645:	0f 88 24 04 00 00    	js     3a6f <subdir+0x4df>
+  write(fd, "FF", 2);
+    364b:	83 ec 04             	sub    $0x4,%esp
+    364e:	6a 02                	push   $0x2
+    3650:	68 40 66 00 00       	push   $0x6640
+    3655:	50                   	push   %eax
+    3656:	e8 f8 1a 00 00       	call   5153 <write>
+  close(fd);
+    365b:	89 1c 24             	mov    %ebx,(%esp)
+    365e:	e8 f8 1a 00 00       	call   515b <close>
+  fd = open("dd/dd/../ff", 0);
+    3663:	58                   	pop    %eax
+    3664:	5a                   	pop    %edx
+    3665:	6a 00                	push   $0x0
+    3667:	68 43 66 00 00       	push   $0x6643
+    366c:	e8 02 1b 00 00       	call   5173 <open>
+  if(fd < 0){
+    3671:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    3674:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3676:	85 c0                	test   %eax,%eax
+    3678:	0f 88 de 03 00 00    	js     3a5c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    367e:	83 ec 04             	sub    $0x4,%esp
+    3681:	68 00 20 00 00       	push   $0x2000
+    3686:	68 00 6f 04 00       	push   $0x46f00
+    368b:	50                   	push   %eax
+    368c:	e8 ba 1a 00 00       	call   514b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    3691:	83 c4 10             	add    $0x10,%esp
+    3694:	83 f8 02             	cmp    $0x2,%eax
+    3697:	0f 85 3a 03 00 00    	jne    39d7 <subdir+0x447>
+    369d:	80 3d 00 6f 04 00 66 	cmpb   $0x66,0x46f00
+    36a4:	0f 85 2d 03 00 00    	jne    39d7 <subdir+0x447>
+  close(fd);
+    36aa:	83 ec 0c             	sub    $0xc,%esp
+    36ad:	53                   	push   %ebx
+    36ae:	e8 a8 1a 00 00       	call   515b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    36b3:	59                   	pop    %ecx
+    36b4:	5b                   	pop    %ebx
+    36b5:	68 83 66 00 00       	push   $0x6683
+    36ba:	68 1f 66 00 00       	push   $0x661f
+    36bf:	e8 cf 1a 00 00       	call   5193 <link>
+    36c4:	83 c4 10             	add    $0x10,%esp
+    36c7:	85 c0                	test   %eax,%eax
+    36c9:	0f 85 c6 03 00 00    	jne    3a95 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    36cf:	83 ec 0c             	sub    $0xc,%esp
+    36d2:	68 1f 66 00 00       	push   $0x661f
+    36d7:	e8 a7 1a 00 00       	call   5183 <unlink>
+    36dc:	83 c4 10             	add    $0x10,%esp
+    36df:	85 c0                	test   %eax,%eax
+    36e1:	0f 85 16 03 00 00    	jne    39fd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    36e7:	83 ec 08             	sub    $0x8,%esp
+    36ea:	6a 00                	push   $0x0
+    36ec:	68 1f 66 00 00       	push   $0x661f
+    36f1:	e8 7d 1a 00 00       	call   5173 <open>
+    36f6:	83 c4 10             	add    $0x10,%esp
+    36f9:	85 c0                	test   %eax,%eax
+    36fb:	0f 89 2c 04 00 00    	jns    3b2d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    3701:	83 ec 0c             	sub    $0xc,%esp
+    3704:	68 e9 66 00 00       	push   $0x66e9
+    3709:	e8 95 1a 00 00       	call   51a3 <chdir>
+    370e:	83 c4 10             	add    $0x10,%esp
+    3711:	85 c0                	test   %eax,%eax
+    3713:	0f 85 01 04 00 00    	jne    3b1a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    3719:	83 ec 0c             	sub    $0xc,%esp
+    371c:	68 b7 66 00 00       	push   $0x66b7
+    3721:	e8 7d 1a 00 00       	call   51a3 <chdir>
+    3726:	83 c4 10             	add    $0x10,%esp
+    3729:	85 c0                	test   %eax,%eax
+    372b:	0f 85 b9 02 00 00    	jne    39ea <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    3731:	83 ec 0c             	sub    $0xc,%esp
+    3734:	68 dd 66 00 00       	push   $0x66dd
+    3739:	e8 65 1a 00 00       	call   51a3 <chdir>
+    373e:	83 c4 10             	add    $0x10,%esp
+    3741:	85 c0                	test   %eax,%eax
+    3743:	0f 85 a1 02 00 00    	jne    39ea <subdir+0x45a>
+  if(chdir("./..") != 0){
+    3749:	83 ec 0c             	sub    $0xc,%esp
+    374c:	68 ec 66 00 00       	push   $0x66ec
+    3751:	e8 4d 1a 00 00       	call   51a3 <chdir>
+    3756:	83 c4 10             	add    $0x10,%esp
+    3759:	85 c0                	test   %eax,%eax
+    375b:	0f 85 21 03 00 00    	jne    3a82 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    3761:	83 ec 08             	sub    $0x8,%esp
+    3764:	6a 00                	push   $0x0
+    3766:	68 83 66 00 00       	push   $0x6683
+    376b:	e8 03 1a 00 00       	call   5173 <open>
+  if(fd < 0){
+    3770:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    3773:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3775:	85 c0                	test   %eax,%eax
+    3777:	0f 88 e0 04 00 00    	js     3c5d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    377d:	83 ec 04             	sub    $0x4,%esp
+    3780:	68 00 20 00 00       	push   $0x2000
+    3785:	68 00 6f 04 00       	push   $0x46f00
+    378a:	50                   	push   %eax
+    378b:	e8 bb 19 00 00       	call   514b <read>
+    3790:	83 c4 10             	add    $0x10,%esp
+    3793:	83 f8 02             	cmp    $0x2,%eax
+    3796:	0f 85 ae 04 00 00    	jne    3c4a <subdir+0x6ba>
+  close(fd);
+    379c:	83 ec 0c             	sub    $0xc,%esp
+    379f:	53                   	push   %ebx
+    37a0:	e8 b6 19 00 00       	call   515b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    37a5:	58                   	pop    %eax
+    37a6:	5a                   	pop    %edx
+    37a7:	6a 00                	push   $0x0
+    37a9:	68 1f 66 00 00       	push   $0x661f
+    37ae:	e8 c0 19 00 00       	call   5173 <open>
+    37b3:	83 c4 10             	add    $0x10,%esp
+    37b6:	85 c0                	test   %eax,%eax
+    37b8:	0f 89 65 02 00 00    	jns    3a23 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    37be:	83 ec 08             	sub    $0x8,%esp
+    37c1:	68 02 02 00 00       	push   $0x202
+    37c6:	68 37 67 00 00       	push   $0x6737
+    37cb:	e8 a3 19 00 00       	call   5173 <open>
+    37d0:	83 c4 10             	add    $0x10,%esp
+    37d3:	85 c0                	test   %eax,%eax
+    37d5:	0f 89 35 02 00 00    	jns    3a10 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    37db:	83 ec 08             	sub    $0x8,%esp
+    37de:	68 02 02 00 00       	push   $0x202
+    37e3:	68 5c 67 00 00       	push   $0x675c
+    37e8:	e8 86 19 00 00       	call   5173 <open>
+    37ed:	83 c4 10             	add    $0x10,%esp
+    37f0:	85 c0                	test   %eax,%eax
+    37f2:	0f 89 0f 03 00 00    	jns    3b07 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    37f8:	83 ec 08             	sub    $0x8,%esp
+    37fb:	68 00 02 00 00       	push   $0x200
+    3800:	68 e9 66 00 00       	push   $0x66e9
+    3805:	e8 69 19 00 00       	call   5173 <open>
+    380a:	83 c4 10             	add    $0x10,%esp
+    380d:	85 c0                	test   %eax,%eax
+    380f:	0f 89 df 02 00 00    	jns    3af4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    3815:	83 ec 08             	sub    $0x8,%esp
+    3818:	6a 02                	push   $0x2
+    381a:	68 e9 66 00 00       	push   $0x66e9
+    381f:	e8 4f 19 00 00       	call   5173 <open>
+    3824:	83 c4 10             	add    $0x10,%esp
+    3827:	85 c0                	test   %eax,%eax
+    3829:	0f 89 b2 02 00 00    	jns    3ae1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    382f:	83 ec 08             	sub    $0x8,%esp
+    3832:	6a 01                	push   $0x1
+    3834:	68 e9 66 00 00       	push   $0x66e9
+    3839:	e8 35 19 00 00       	call   5173 <open>
+    383e:	83 c4 10             	add    $0x10,%esp
+    3841:	85 c0                	test   %eax,%eax
+    3843:	0f 89 85 02 00 00    	jns    3ace <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    3849:	83 ec 08             	sub    $0x8,%esp
+    384c:	68 cb 67 00 00       	push   $0x67cb
+    3851:	68 37 67 00 00       	push   $0x6737
+    3856:	e8 38 19 00 00       	call   5193 <link>
+    385b:	83 c4 10             	add    $0x10,%esp
+    385e:	85 c0                	test   %eax,%eax
+    3860:	0f 84 55 02 00 00    	je     3abb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    3866:	83 ec 08             	sub    $0x8,%esp
+    3869:	68 cb 67 00 00       	push   $0x67cb
+    386e:	68 5c 67 00 00       	push   $0x675c
+    3873:	e8 1b 19 00 00       	call   5193 <link>
+    3878:	83 c4 10             	add    $0x10,%esp
+    387b:	85 c0                	test   %eax,%eax
+    387d:	0f 84 25 02 00 00    	je     3aa8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    3883:	83 ec 08             	sub    $0x8,%esp
+    3886:	68 83 66 00 00       	push   $0x6683
+    388b:	68 22 66 00 00       	push   $0x6622
+    3890:	e8 fe 18 00 00       	call   5193 <link>
+    3895:	83 c4 10             	add    $0x10,%esp
+    3898:	85 c0                	test   %eax,%eax
+    389a:	0f 84 a9 01 00 00    	je     3a49 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    38a0:	83 ec 0c             	sub    $0xc,%esp
+    38a3:	68 37 67 00 00       	push   $0x6737
+    38a8:	e8 ee 18 00 00       	call   519b <mkdir>
+    38ad:	83 c4 10             	add    $0x10,%esp
+    38b0:	85 c0                	test   %eax,%eax
+    38b2:	0f 84 7e 01 00 00    	je     3a36 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    38b8:	83 ec 0c             	sub    $0xc,%esp
+    38bb:	68 5c 67 00 00       	push   $0x675c
+    38c0:	e8 d6 18 00 00       	call   519b <mkdir>
+    38c5:	83 c4 10             	add    $0x10,%esp
+    38c8:	85 c0                	test   %eax,%eax
+    38ca:	0f 84 67 03 00 00    	je     3c37 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    38d0:	83 ec 0c             	sub    $0xc,%esp
+    38d3:	68 83 66 00 00       	push   $0x6683
+    38d8:	e8 be 18 00 00       	call   519b <mkdir>
+    38dd:	83 c4 10             	add    $0x10,%esp
+    38e0:	85 c0                	test   %eax,%eax
+    38e2:	0f 84 3c 03 00 00    	je     3c24 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    38e8:	83 ec 0c             	sub    $0xc,%esp
+    38eb:	68 5c 67 00 00       	push   $0x675c
+    38f0:	e8 8e 18 00 00       	call   5183 <unlink>
+    38f5:	83 c4 10             	add    $0x10,%esp
+    38f8:	85 c0                	test   %eax,%eax
+    38fa:	0f 84 11 03 00 00    	je     3c11 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    3900:	83 ec 0c             	sub    $0xc,%esp
+    3903:	68 37 67 00 00       	push   $0x6737
+    3908:	e8 76 18 00 00       	call   5183 <unlink>
+    390d:	83 c4 10             	add    $0x10,%esp
+    3910:	85 c0                	test   %eax,%eax
+    3912:	0f 84 e6 02 00 00    	je     3bfe <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    3918:	83 ec 0c             	sub    $0xc,%esp
+    391b:	68 22 66 00 00       	push   $0x6622
+    3920:	e8 7e 18 00 00       	call   51a3 <chdir>
+    3925:	83 c4 10             	add    $0x10,%esp
+    3928:	85 c0                	test   %eax,%eax
+    392a:	0f 84 bb 02 00 00    	je     3beb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    3930:	83 ec 0c             	sub    $0xc,%esp
+    3933:	68 ce 67 00 00       	push   $0x67ce
+    3938:	e8 66 18 00 00       	call   51a3 <chdir>
+    393d:	83 c4 10             	add    $0x10,%esp
+    3940:	85 c0                	test   %eax,%eax
+    3942:	0f 84 90 02 00 00    	je     3bd8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    3948:	83 ec 0c             	sub    $0xc,%esp
+    394b:	68 83 66 00 00       	push   $0x6683
+    3950:	e8 2e 18 00 00       	call   5183 <unlink>
+    3955:	83 c4 10             	add    $0x10,%esp
+    3958:	85 c0                	test   %eax,%eax
+    395a:	0f 85 9d 00 00 00    	jne    39fd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    3960:	83 ec 0c             	sub    $0xc,%esp
+    3963:	68 22 66 00 00       	push   $0x6622
+    3968:	e8 16 18 00 00       	call   5183 <unlink>
+    396d:	83 c4 10             	add    $0x10,%esp
+    3970:	85 c0                	test   %eax,%eax
+    3972:	0f 85 4d 02 00 00    	jne    3bc5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    3978:	83 ec 0c             	sub    $0xc,%esp
+    397b:	68 e9 66 00 00       	push   $0x66e9
+    3980:	e8 fe 17 00 00       	call   5183 <unlink>
+    3985:	83 c4 10             	add    $0x10,%esp
+    3988:	85 c0                	test   %eax,%eax
+    398a:	0f 84 22 02 00 00    	je     3bb2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    3990:	83 ec 0c             	sub    $0xc,%esp
+    3993:	68 fe 65 00 00       	push   $0x65fe
+    3998:	e8 e6 17 00 00       	call   5183 <unlink>
+    399d:	83 c4 10             	add    $0x10,%esp
+    39a0:	85 c0                	test   %eax,%eax
+    39a2:	0f 88 f7 01 00 00    	js     3b9f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    39a8:	83 ec 0c             	sub    $0xc,%esp
+    39ab:	68 e9 66 00 00       	push   $0x66e9
+    39b0:	e8 ce 17 00 00       	call   5183 <unlink>
+    39b5:	83 c4 10             	add    $0x10,%esp
+    39b8:	85 c0                	test   %eax,%eax
+    39ba:	0f 88 cc 01 00 00    	js     3b8c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    39c0:	83 ec 08             	sub    $0x8,%esp
+    39c3:	68 cb 68 00 00       	push   $0x68cb
+    39c8:	6a 01                	push   $0x1
+    39ca:	e8 71 19 00 00       	call   5340 <printf>
+}
+    39cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    39d2:	83 c4 10             	add    $0x10,%esp
+    39d5:	c9                   	leave
+    39d6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    39d7:	50                   	push   %eax
+    39d8:	50                   	push   %eax
+    39d9:	68 68 66 00 00       	push   $0x6668
+    39de:	6a 01                	push   $0x1
+    39e0:	e8 5b 19 00 00       	call   5340 <printf>
+    exit();
+    39e5:	e8 49 17 00 00       	call   5133 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    39ea:	50                   	push   %eax
+    39eb:	50                   	push   %eax
+    39ec:	68 c3 66 00 00       	push   $0x66c3
+    39f1:	6a 01                	push   $0x1
+    39f3:	e8 48 19 00 00       	call   5340 <printf>
+    exit();
+    39f8:	e8 36 17 00 00       	call   5133 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    39fd:	50                   	push   %eax
+    39fe:	50                   	push   %eax
+    39ff:	68 8e 66 00 00       	push   $0x668e
+    3a04:	6a 01                	push   $0x1
+    3a06:	e8 35 19 00 00       	call   5340 <printf>
+    exit();
+    3a0b:	e8 23 17 00 00       	call   5133 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    3a10:	51                   	push   %ecx
+    3a11:	51                   	push   %ecx
+    3a12:	68 40 67 00 00       	push   $0x6740
+    3a17:	6a 01                	push   $0x1
+    3a19:	e8 22 19 00 00       	call   5340 <printf>
+    exit();
+    3a1e:	e8 10 17 00 00       	call   5133 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    3a23:	53                   	push   %ebx
+    3a24:	53                   	push   %ebx
+    3a25:	68 50 74 00 00       	push   $0x7450
+    3a2a:	6a 01                	push   $0x1
+    3a2c:	e8 0f 19 00 00       	call   5340 <printf>
+    exit();
+    3a31:	e8 fd 16 00 00       	call   5133 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    3a36:	51                   	push   %ecx
+    3a37:	51                   	push   %ecx
+    3a38:	68 d4 67 00 00       	push   $0x67d4
+    3a3d:	6a 01                	push   $0x1
+    3a3f:	e8 fc 18 00 00       	call   5340 <printf>
+    exit();
+    3a44:	e8 ea 16 00 00       	call   5133 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    3a49:	53                   	push   %ebx
+    3a4a:	53                   	push   %ebx
+    3a4b:	68 c0 74 00 00       	push   $0x74c0
+    3a50:	6a 01                	push   $0x1
+    3a52:	e8 e9 18 00 00       	call   5340 <printf>
+    exit();
+    3a57:	e8 d7 16 00 00       	call   5133 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    3a5c:	50                   	push   %eax
+    3a5d:	50                   	push   %eax
+    3a5e:	68 4f 66 00 00       	push   $0x664f
+    3a63:	6a 01                	push   $0x1
+    3a65:	e8 d6 18 00 00       	call   5340 <printf>
+    exit();
+    3a6a:	e8 c4 16 00 00       	call   5133 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    3a6f:	51                   	push   %ecx
+    3a70:	51                   	push   %ecx
+    3a71:	68 28 66 00 00       	push   $0x6628
+    3a76:	6a 01                	push   $0x1
+    3a78:	e8 c3 18 00 00       	call   5340 <printf>
+    exit();
+    3a7d:	e8 b1 16 00 00       	call   5133 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3a82:	50                   	push   %eax
+    3a83:	50                   	push   %eax
+    3a84:	68 f1 66 00 00       	push   $0x66f1
+    3a89:	6a 01                	push   $0x1
+    3a8b:	e8 b0 18 00 00       	call   5340 <printf>
+    exit();
+    3a90:	e8 9e 16 00 00       	call   5133 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3a95:	52                   	push   %edx
+    3a96:	52                   	push   %edx
+    3a97:	68 08 74 00 00       	push   $0x7408
+    3a9c:	6a 01                	push   $0x1
+    3a9e:	e8 9d 18 00 00       	call   5340 <printf>
+    exit();
+    3aa3:	e8 8b 16 00 00       	call   5133 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3aa8:	50                   	push   %eax
+    3aa9:	50                   	push   %eax
+    3aaa:	68 9c 74 00 00       	push   $0x749c
+    3aaf:	6a 01                	push   $0x1
+    3ab1:	e8 8a 18 00 00       	call   5340 <printf>
+    exit();
+    3ab6:	e8 78 16 00 00       	call   5133 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    3abb:	50                   	push   %eax
+    3abc:	50                   	push   %eax
+    3abd:	68 78 74 00 00       	push   $0x7478
+    3ac2:	6a 01                	push   $0x1
+    3ac4:	e8 77 18 00 00       	call   5340 <printf>
+    exit();
+    3ac9:	e8 65 16 00 00       	call   5133 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    3ace:	50                   	push   %eax
+    3acf:	50                   	push   %eax
+    3ad0:	68 b0 67 00 00       	push   $0x67b0
+    3ad5:	6a 01                	push   $0x1
+    3ad7:	e8 64 18 00 00       	call   5340 <printf>
+    exit();
+    3adc:	e8 52 16 00 00       	call   5133 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    3ae1:	50                   	push   %eax
+    3ae2:	50                   	push   %eax
+    3ae3:	68 97 67 00 00       	push   $0x6797
+    3ae8:	6a 01                	push   $0x1
+    3aea:	e8 51 18 00 00       	call   5340 <printf>
+    exit();
+    3aef:	e8 3f 16 00 00       	call   5133 <exit>
+    printf(1, "create dd succeeded!\n");
+    3af4:	50                   	push   %eax
+    3af5:	50                   	push   %eax
+    3af6:	68 81 67 00 00       	push   $0x6781
+    3afb:	6a 01                	push   $0x1
+    3afd:	e8 3e 18 00 00       	call   5340 <printf>
+    exit();
+    3b02:	e8 2c 16 00 00       	call   5133 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3b07:	52                   	push   %edx
+    3b08:	52                   	push   %edx
+    3b09:	68 65 67 00 00       	push   $0x6765
+    3b0e:	6a 01                	push   $0x1
+    3b10:	e8 2b 18 00 00       	call   5340 <printf>
+    exit();
+    3b15:	e8 19 16 00 00       	call   5133 <exit>
+    printf(1, "chdir dd failed\n");
+    3b1a:	50                   	push   %eax
+    3b1b:	50                   	push   %eax
+    3b1c:	68 a6 66 00 00       	push   $0x66a6
+    3b21:	6a 01                	push   $0x1
+    3b23:	e8 18 18 00 00       	call   5340 <printf>
+    exit();
+    3b28:	e8 06 16 00 00       	call   5133 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    3b2d:	50                   	push   %eax
+    3b2e:	50                   	push   %eax
+    3b2f:	68 2c 74 00 00       	push   $0x742c
+    3b34:	6a 01                	push   $0x1
+    3b36:	e8 05 18 00 00       	call   5340 <printf>
+    exit();
+    3b3b:	e8 f3 15 00 00       	call   5133 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    3b40:	53                   	push   %ebx
+    3b41:	53                   	push   %ebx
+    3b42:	68 04 66 00 00       	push   $0x6604
+    3b47:	6a 01                	push   $0x1
+    3b49:	e8 f2 17 00 00       	call   5340 <printf>
+    exit();
+    3b4e:	e8 e0 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3b53:	50                   	push   %eax
+    3b54:	50                   	push   %eax
+    3b55:	68 e0 73 00 00       	push   $0x73e0
+    3b5a:	6a 01                	push   $0x1
+    3b5c:	e8 df 17 00 00       	call   5340 <printf>
+    exit();
+    3b61:	e8 cd 15 00 00       	call   5133 <exit>
+    printf(1, "create dd/ff failed\n");
+    3b66:	50                   	push   %eax
+    3b67:	50                   	push   %eax
+    3b68:	68 e8 65 00 00       	push   $0x65e8
+    3b6d:	6a 01                	push   $0x1
+    3b6f:	e8 cc 17 00 00       	call   5340 <printf>
+    exit();
+    3b74:	e8 ba 15 00 00       	call   5133 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    3b79:	50                   	push   %eax
+    3b7a:	50                   	push   %eax
+    3b7b:	68 d0 65 00 00       	push   $0x65d0
+    3b80:	6a 01                	push   $0x1
+    3b82:	e8 b9 17 00 00       	call   5340 <printf>
+    exit();
+    3b87:	e8 a7 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd failed\n");
+    3b8c:	50                   	push   %eax
+    3b8d:	50                   	push   %eax
+    3b8e:	68 b9 68 00 00       	push   $0x68b9
+    3b93:	6a 01                	push   $0x1
+    3b95:	e8 a6 17 00 00       	call   5340 <printf>
+    exit();
+    3b9a:	e8 94 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    3b9f:	52                   	push   %edx
+    3ba0:	52                   	push   %edx
+    3ba1:	68 a4 68 00 00       	push   $0x68a4
+    3ba6:	6a 01                	push   $0x1
+    3ba8:	e8 93 17 00 00       	call   5340 <printf>
+    exit();
+    3bad:	e8 81 15 00 00       	call   5133 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3bb2:	51                   	push   %ecx
+    3bb3:	51                   	push   %ecx
+    3bb4:	68 e4 74 00 00       	push   $0x74e4
+    3bb9:	6a 01                	push   $0x1
+    3bbb:	e8 80 17 00 00       	call   5340 <printf>
+    exit();
+    3bc0:	e8 6e 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    3bc5:	53                   	push   %ebx
+    3bc6:	53                   	push   %ebx
+    3bc7:	68 8f 68 00 00       	push   $0x688f
+    3bcc:	6a 01                	push   $0x1
+    3bce:	e8 6d 17 00 00       	call   5340 <printf>
+    exit();
+    3bd3:	e8 5b 15 00 00       	call   5133 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3bd8:	50                   	push   %eax
+    3bd9:	50                   	push   %eax
+    3bda:	68 77 68 00 00       	push   $0x6877
+    3bdf:	6a 01                	push   $0x1
+    3be1:	e8 5a 17 00 00       	call   5340 <printf>
+    exit();
+    3be6:	e8 48 15 00 00       	call   5133 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    3beb:	50                   	push   %eax
+    3bec:	50                   	push   %eax
+    3bed:	68 5f 68 00 00       	push   $0x685f
+    3bf2:	6a 01                	push   $0x1
+    3bf4:	e8 47 17 00 00       	call   5340 <printf>
+    exit();
+    3bf9:	e8 35 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    3bfe:	50                   	push   %eax
+    3bff:	50                   	push   %eax
+    3c00:	68 43 68 00 00       	push   $0x6843
+    3c05:	6a 01                	push   $0x1
+    3c07:	e8 34 17 00 00       	call   5340 <printf>
+    exit();
+    3c0c:	e8 22 15 00 00       	call   5133 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3c11:	50                   	push   %eax
+    3c12:	50                   	push   %eax
+    3c13:	68 27 68 00 00       	push   $0x6827
+    3c18:	6a 01                	push   $0x1
+    3c1a:	e8 21 17 00 00       	call   5340 <printf>
+    exit();
+    3c1f:	e8 0f 15 00 00       	call   5133 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3c24:	50                   	push   %eax
+    3c25:	50                   	push   %eax
+    3c26:	68 0a 68 00 00       	push   $0x680a
+    3c2b:	6a 01                	push   $0x1
+    3c2d:	e8 0e 17 00 00       	call   5340 <printf>
+    exit();
+    3c32:	e8 fc 14 00 00       	call   5133 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3c37:	52                   	push   %edx
+    3c38:	52                   	push   %edx
+    3c39:	68 ef 67 00 00       	push   $0x67ef
+    3c3e:	6a 01                	push   $0x1
+    3c40:	e8 fb 16 00 00       	call   5340 <printf>
+    exit();
+    3c45:	e8 e9 14 00 00       	call   5133 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    3c4a:	51                   	push   %ecx
+    3c4b:	51                   	push   %ecx
+    3c4c:	68 1c 67 00 00       	push   $0x671c
+    3c51:	6a 01                	push   $0x1
+    3c53:	e8 e8 16 00 00       	call   5340 <printf>
+    exit();
+    3c58:	e8 d6 14 00 00       	call   5133 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    3c5d:	53                   	push   %ebx
+    3c5e:	53                   	push   %ebx
+    3c5f:	68 04 67 00 00       	push   $0x6704
+    3c64:	6a 01                	push   $0x1
+    3c66:	e8 d5 16 00 00       	call   5340 <printf>
+    exit();
+    3c6b:	e8 c3 14 00 00       	call   5133 <exit>
+
+00003c70 <bigwrite>:
+{
+    3c70:	55                   	push   %ebp
+    3c71:	89 e5                	mov    %esp,%ebp
+    3c73:	56                   	push   %esi
+    3c74:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    3c75:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    3c7a:	83 ec 08             	sub    $0x8,%esp
+    3c7d:	68 d6 68 00 00       	push   $0x68d6
+    3c82:	6a 01                	push   $0x1
+    3c84:	e8 b7 16 00 00       	call   5340 <printf>
+  unlink("bigwrite");
+    3c89:	c7 04 24 e5 68 00 00 	movl   $0x68e5,(%esp)
+    3c90:	e8 ee 14 00 00       	call   5183 <unlink>
+    3c95:	83 c4 10             	add    $0x10,%esp
+    3c98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c9f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3ca0:	83 ec 08             	sub    $0x8,%esp
+    3ca3:	68 02 02 00 00       	push   $0x202
+    3ca8:	68 e5 68 00 00       	push   $0x68e5
+    3cad:	e8 c1 14 00 00       	call   5173 <open>
+    if(fd < 0){
+    3cb2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3cb5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3cb7:	85 c0                	test   %eax,%eax
+    3cb9:	78 7e                	js     3d39 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    3cbb:	83 ec 04             	sub    $0x4,%esp
+    3cbe:	53                   	push   %ebx
+    3cbf:	68 00 6f 04 00       	push   $0x46f00
+    3cc4:	50                   	push   %eax
+    3cc5:	e8 89 14 00 00       	call   5153 <write>
+      if(cc != sz){
+    3cca:	83 c4 10             	add    $0x10,%esp
+    3ccd:	39 d8                	cmp    %ebx,%eax
+    3ccf:	75 55                	jne    3d26 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    3cd1:	83 ec 04             	sub    $0x4,%esp
+    3cd4:	53                   	push   %ebx
+    3cd5:	68 00 6f 04 00       	push   $0x46f00
+    3cda:	56                   	push   %esi
+    3cdb:	e8 73 14 00 00       	call   5153 <write>
+      if(cc != sz){
+    3ce0:	83 c4 10             	add    $0x10,%esp
+    3ce3:	39 c3                	cmp    %eax,%ebx
+    3ce5:	75 3f                	jne    3d26 <bigwrite+0xb6>
+    close(fd);
+    3ce7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    3cea:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    3cf0:	56                   	push   %esi
+    3cf1:	e8 65 14 00 00       	call   515b <close>
+    unlink("bigwrite");
+    3cf6:	c7 04 24 e5 68 00 00 	movl   $0x68e5,(%esp)
+    3cfd:	e8 81 14 00 00       	call   5183 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3d02:	83 c4 10             	add    $0x10,%esp
+    3d05:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    3d0b:	75 93                	jne    3ca0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    3d0d:	83 ec 08             	sub    $0x8,%esp
+    3d10:	68 18 69 00 00       	push   $0x6918
+    3d15:	6a 01                	push   $0x1
+    3d17:	e8 24 16 00 00       	call   5340 <printf>
+}
+    3d1c:	83 c4 10             	add    $0x10,%esp
+    3d1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3d22:	5b                   	pop    %ebx
+    3d23:	5e                   	pop    %esi
+    3d24:	5d                   	pop    %ebp
+    3d25:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    3d26:	50                   	push   %eax
+    3d27:	53                   	push   %ebx
+    3d28:	68 06 69 00 00       	push   $0x6906
+    3d2d:	6a 01                	push   $0x1
+    3d2f:	e8 0c 16 00 00       	call   5340 <printf>
+        exit();
+    3d34:	e8 fa 13 00 00       	call   5133 <exit>
+      printf(1, "cannot create bigwrite\n");
+    3d39:	83 ec 08             	sub    $0x8,%esp
+    3d3c:	68 ee 68 00 00       	push   $0x68ee
+    3d41:	6a 01                	push   $0x1
+    3d43:	e8 f8 15 00 00       	call   5340 <printf>
+      exit();
+    3d48:	e8 e6 13 00 00       	call   5133 <exit>
+    3d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003d50 <bigfile>:
+{
+    3d50:	55                   	push   %ebp
+    3d51:	89 e5                	mov    %esp,%ebp
+    3d53:	57                   	push   %edi
+    3d54:	56                   	push   %esi
+    3d55:	53                   	push   %ebx
+    3d56:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    3d59:	68 25 69 00 00       	push   $0x6925
+    3d5e:	6a 01                	push   $0x1
+    3d60:	e8 db 15 00 00       	call   5340 <printf>
+  unlink("bigfile");
+    3d65:	c7 04 24 41 69 00 00 	movl   $0x6941,(%esp)
+    3d6c:	e8 12 14 00 00       	call   5183 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3d71:	58                   	pop    %eax
+    3d72:	5a                   	pop    %edx
+    3d73:	68 02 02 00 00       	push   $0x202
+    3d78:	68 41 69 00 00       	push   $0x6941
+    3d7d:	e8 f1 13 00 00       	call   5173 <open>
+  if(fd < 0){
+    3d82:	83 c4 10             	add    $0x10,%esp
+    3d85:	85 c0                	test   %eax,%eax
+    3d87:	0f 88 5e 01 00 00    	js     3eeb <bigfile+0x19b>
+    3d8d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    3d8f:	31 db                	xor    %ebx,%ebx
+    3d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3d98:	83 ec 04             	sub    $0x4,%esp
+    3d9b:	68 58 02 00 00       	push   $0x258
+    3da0:	53                   	push   %ebx
+    3da1:	68 00 6f 04 00       	push   $0x46f00
+    3da6:	e8 05 12 00 00       	call   4fb0 <memset>
+    if(write(fd, buf, 600) != 600){
+    3dab:	83 c4 0c             	add    $0xc,%esp
+    3dae:	68 58 02 00 00       	push   $0x258
+    3db3:	68 00 6f 04 00       	push   $0x46f00
+    3db8:	56                   	push   %esi
+    3db9:	e8 95 13 00 00       	call   5153 <write>
+    3dbe:	83 c4 10             	add    $0x10,%esp
+    3dc1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3dc6:	0f 85 f8 00 00 00    	jne    3ec4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    3dcc:	83 c3 01             	add    $0x1,%ebx
+    3dcf:	83 fb 14             	cmp    $0x14,%ebx
+    3dd2:	75 c4                	jne    3d98 <bigfile+0x48>
+  close(fd);
+    3dd4:	83 ec 0c             	sub    $0xc,%esp
+    3dd7:	56                   	push   %esi
+    3dd8:	e8 7e 13 00 00       	call   515b <close>
+  fd = open("bigfile", 0);
+    3ddd:	5e                   	pop    %esi
+    3dde:	5f                   	pop    %edi
+    3ddf:	6a 00                	push   $0x0
+    3de1:	68 41 69 00 00       	push   $0x6941
+    3de6:	e8 88 13 00 00       	call   5173 <open>
+  if(fd < 0){
+    3deb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    3dee:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    3df0:	85 c0                	test   %eax,%eax
+    3df2:	0f 88 e0 00 00 00    	js     3ed8 <bigfile+0x188>
+  total = 0;
+    3df8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    3dfa:	31 ff                	xor    %edi,%edi
+    3dfc:	eb 30                	jmp    3e2e <bigfile+0xde>
+    3dfe:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    3e00:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    3e05:	0f 85 91 00 00 00    	jne    3e9c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    3e0b:	89 fa                	mov    %edi,%edx
+    3e0d:	0f be 05 00 6f 04 00 	movsbl 0x46f00,%eax
+    3e14:	d1 fa                	sar    %edx
+    3e16:	39 d0                	cmp    %edx,%eax
+    3e18:	75 6e                	jne    3e88 <bigfile+0x138>
+    3e1a:	0f be 15 2b 70 04 00 	movsbl 0x4702b,%edx
+    3e21:	39 d0                	cmp    %edx,%eax
+    3e23:	75 63                	jne    3e88 <bigfile+0x138>
+    total += cc;
+    3e25:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    3e2b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    3e2e:	83 ec 04             	sub    $0x4,%esp
+    3e31:	68 2c 01 00 00       	push   $0x12c
+    3e36:	68 00 6f 04 00       	push   $0x46f00
+    3e3b:	56                   	push   %esi
+    3e3c:	e8 0a 13 00 00       	call   514b <read>
+    if(cc < 0){
+    3e41:	83 c4 10             	add    $0x10,%esp
+    3e44:	85 c0                	test   %eax,%eax
+    3e46:	78 68                	js     3eb0 <bigfile+0x160>
+    if(cc == 0)
+    3e48:	75 b6                	jne    3e00 <bigfile+0xb0>
+  close(fd);
+    3e4a:	83 ec 0c             	sub    $0xc,%esp
+    3e4d:	56                   	push   %esi
+    3e4e:	e8 08 13 00 00       	call   515b <close>
+  if(total != 20*600){
+    3e53:	83 c4 10             	add    $0x10,%esp
+    3e56:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    3e5c:	0f 85 9c 00 00 00    	jne    3efe <bigfile+0x1ae>
+  unlink("bigfile");
+    3e62:	83 ec 0c             	sub    $0xc,%esp
+    3e65:	68 41 69 00 00       	push   $0x6941
+    3e6a:	e8 14 13 00 00       	call   5183 <unlink>
+  printf(1, "bigfile test ok\n");
+    3e6f:	58                   	pop    %eax
+    3e70:	5a                   	pop    %edx
+    3e71:	68 d0 69 00 00       	push   $0x69d0
+    3e76:	6a 01                	push   $0x1
+    3e78:	e8 c3 14 00 00       	call   5340 <printf>
+}
+    3e7d:	83 c4 10             	add    $0x10,%esp
+    3e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3e83:	5b                   	pop    %ebx
+    3e84:	5e                   	pop    %esi
+    3e85:	5f                   	pop    %edi
+    3e86:	5d                   	pop    %ebp
+    3e87:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3e88:	83 ec 08             	sub    $0x8,%esp
+    3e8b:	68 9d 69 00 00       	push   $0x699d
+    3e90:	6a 01                	push   $0x1
+    3e92:	e8 a9 14 00 00       	call   5340 <printf>
+      exit();
+    3e97:	e8 97 12 00 00       	call   5133 <exit>
+      printf(1, "short read bigfile\n");
+    3e9c:	83 ec 08             	sub    $0x8,%esp
+    3e9f:	68 89 69 00 00       	push   $0x6989
+    3ea4:	6a 01                	push   $0x1
+    3ea6:	e8 95 14 00 00       	call   5340 <printf>
+      exit();
+    3eab:	e8 83 12 00 00       	call   5133 <exit>
+      printf(1, "read bigfile failed\n");
+    3eb0:	83 ec 08             	sub    $0x8,%esp
+    3eb3:	68 74 69 00 00       	push   $0x6974
+    3eb8:	6a 01                	push   $0x1
+    3eba:	e8 81 14 00 00       	call   5340 <printf>
+      exit();
+    3ebf:	e8 6f 12 00 00       	call   5133 <exit>
+      printf(1, "write bigfile failed\n");
+    3ec4:	83 ec 08             	sub    $0x8,%esp
+    3ec7:	68 49 69 00 00       	push   $0x6949
+    3ecc:	6a 01                	push   $0x1
+    3ece:	e8 6d 14 00 00       	call   5340 <printf>
+      exit();
+    3ed3:	e8 5b 12 00 00       	call   5133 <exit>
+    printf(1, "cannot open bigfile\n");
+    3ed8:	53                   	push   %ebx
+    3ed9:	53                   	push   %ebx
+    3eda:	68 5f 69 00 00       	push   $0x695f
+    3edf:	6a 01                	push   $0x1
+    3ee1:	e8 5a 14 00 00       	call   5340 <printf>
+    exit();
+    3ee6:	e8 48 12 00 00       	call   5133 <exit>
+    printf(1, "cannot create bigfile");
+    3eeb:	50                   	push   %eax
+    3eec:	50                   	push   %eax
+    3eed:	68 33 69 00 00       	push   $0x6933
+    3ef2:	6a 01                	push   $0x1
+    3ef4:	e8 47 14 00 00       	call   5340 <printf>
+    exit();
+    3ef9:	e8 35 12 00 00       	call   5133 <exit>
+    printf(1, "read bigfile wrong total\n");
+    3efe:	51                   	push   %ecx
+    3eff:	51                   	push   %ecx
+    3f00:	68 b6 69 00 00       	push   $0x69b6
+    3f05:	6a 01                	push   $0x1
+    3f07:	e8 34 14 00 00       	call   5340 <printf>
+    exit();
+    3f0c:	e8 22 12 00 00       	call   5133 <exit>
+    3f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f1f:	90                   	nop
+
+00003f20 <fourteen>:
+{
+    3f20:	55                   	push   %ebp
+    3f21:	89 e5                	mov    %esp,%ebp
+    3f23:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3f26:	68 e1 69 00 00       	push   $0x69e1
+    3f2b:	6a 01                	push   $0x1
+    3f2d:	e8 0e 14 00 00       	call   5340 <printf>
+  if(mkdir("12345678901234") != 0){
+    3f32:	c7 04 24 1c 6a 00 00 	movl   $0x6a1c,(%esp)
+    3f39:	e8 5d 12 00 00       	call   519b <mkdir>
+    3f3e:	83 c4 10             	add    $0x10,%esp
+    3f41:	85 c0                	test   %eax,%eax
+    3f43:	0f 85 97 00 00 00    	jne    3fe0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3f49:	83 ec 0c             	sub    $0xc,%esp
+    3f4c:	68 04 75 00 00       	push   $0x7504
+    3f51:	e8 45 12 00 00       	call   519b <mkdir>
+    3f56:	83 c4 10             	add    $0x10,%esp
+    3f59:	85 c0                	test   %eax,%eax
+    3f5b:	0f 85 de 00 00 00    	jne    403f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3f61:	83 ec 08             	sub    $0x8,%esp
+    3f64:	68 00 02 00 00       	push   $0x200
+    3f69:	68 54 75 00 00       	push   $0x7554
+    3f6e:	e8 00 12 00 00       	call   5173 <open>
+  if(fd < 0){
+    3f73:	83 c4 10             	add    $0x10,%esp
+    3f76:	85 c0                	test   %eax,%eax
+    3f78:	0f 88 ae 00 00 00    	js     402c <fourteen+0x10c>
+  close(fd);
+    3f7e:	83 ec 0c             	sub    $0xc,%esp
+    3f81:	50                   	push   %eax
+    3f82:	e8 d4 11 00 00       	call   515b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3f87:	58                   	pop    %eax
+    3f88:	5a                   	pop    %edx
+    3f89:	6a 00                	push   $0x0
+    3f8b:	68 c4 75 00 00       	push   $0x75c4
+    3f90:	e8 de 11 00 00       	call   5173 <open>
+  if(fd < 0){
+    3f95:	83 c4 10             	add    $0x10,%esp
+    3f98:	85 c0                	test   %eax,%eax
+    3f9a:	78 7d                	js     4019 <fourteen+0xf9>
+  close(fd);
+    3f9c:	83 ec 0c             	sub    $0xc,%esp
+    3f9f:	50                   	push   %eax
+    3fa0:	e8 b6 11 00 00       	call   515b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3fa5:	c7 04 24 0d 6a 00 00 	movl   $0x6a0d,(%esp)
+    3fac:	e8 ea 11 00 00       	call   519b <mkdir>
+    3fb1:	83 c4 10             	add    $0x10,%esp
+    3fb4:	85 c0                	test   %eax,%eax
+    3fb6:	74 4e                	je     4006 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3fb8:	83 ec 0c             	sub    $0xc,%esp
+    3fbb:	68 60 76 00 00       	push   $0x7660
+    3fc0:	e8 d6 11 00 00       	call   519b <mkdir>
+    3fc5:	83 c4 10             	add    $0x10,%esp
+    3fc8:	85 c0                	test   %eax,%eax
+    3fca:	74 27                	je     3ff3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    3fcc:	83 ec 08             	sub    $0x8,%esp
+    3fcf:	68 2b 6a 00 00       	push   $0x6a2b
+    3fd4:	6a 01                	push   $0x1
+    3fd6:	e8 65 13 00 00       	call   5340 <printf>
+}
+    3fdb:	83 c4 10             	add    $0x10,%esp
+    3fde:	c9                   	leave
+    3fdf:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3fe0:	50                   	push   %eax
+    3fe1:	50                   	push   %eax
+    3fe2:	68 f0 69 00 00       	push   $0x69f0
+    3fe7:	6a 01                	push   $0x1
+    3fe9:	e8 52 13 00 00       	call   5340 <printf>
+    exit();
+    3fee:	e8 40 11 00 00       	call   5133 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3ff3:	50                   	push   %eax
+    3ff4:	50                   	push   %eax
+    3ff5:	68 80 76 00 00       	push   $0x7680
+    3ffa:	6a 01                	push   $0x1
+    3ffc:	e8 3f 13 00 00       	call   5340 <printf>
+    exit();
+    4001:	e8 2d 11 00 00       	call   5133 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    4006:	52                   	push   %edx
+    4007:	52                   	push   %edx
+    4008:	68 30 76 00 00       	push   $0x7630
+    400d:	6a 01                	push   $0x1
+    400f:	e8 2c 13 00 00       	call   5340 <printf>
+    exit();
+    4014:	e8 1a 11 00 00       	call   5133 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    4019:	51                   	push   %ecx
+    401a:	51                   	push   %ecx
+    401b:	68 f4 75 00 00       	push   $0x75f4
+    4020:	6a 01                	push   $0x1
+    4022:	e8 19 13 00 00       	call   5340 <printf>
+    exit();
+    4027:	e8 07 11 00 00       	call   5133 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    402c:	51                   	push   %ecx
+    402d:	51                   	push   %ecx
+    402e:	68 84 75 00 00       	push   $0x7584
+    4033:	6a 01                	push   $0x1
+    4035:	e8 06 13 00 00       	call   5340 <printf>
+    exit();
+    403a:	e8 f4 10 00 00       	call   5133 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    403f:	50                   	push   %eax
+    4040:	50                   	push   %eax
+    4041:	68 24 75 00 00       	push   $0x7524
+    4046:	6a 01                	push   $0x1
+    4048:	e8 f3 12 00 00       	call   5340 <printf>
+    exit();
+    404d:	e8 e1 10 00 00       	call   5133 <exit>
+    4052:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4059:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004060 <rmdot>:
+{
+    4060:	55                   	push   %ebp
+    4061:	89 e5                	mov    %esp,%ebp
+    4063:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    4066:	68 38 6a 00 00       	push   $0x6a38
+    406b:	6a 01                	push   $0x1
+    406d:	e8 ce 12 00 00       	call   5340 <printf>
+  if(mkdir("dots") != 0){
+    4072:	c7 04 24 44 6a 00 00 	movl   $0x6a44,(%esp)
+    4079:	e8 1d 11 00 00       	call   519b <mkdir>
+    407e:	83 c4 10             	add    $0x10,%esp
+    4081:	85 c0                	test   %eax,%eax
+    4083:	0f 85 b0 00 00 00    	jne    4139 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    4089:	83 ec 0c             	sub    $0xc,%esp
+    408c:	68 44 6a 00 00       	push   $0x6a44
+    4091:	e8 0d 11 00 00       	call   51a3 <chdir>
+    4096:	83 c4 10             	add    $0x10,%esp
+    4099:	85 c0                	test   %eax,%eax
+    409b:	0f 85 1d 01 00 00    	jne    41be <rmdot+0x15e>
+  if(unlink(".") == 0){
+    40a1:	83 ec 0c             	sub    $0xc,%esp
+    40a4:	68 ef 66 00 00       	push   $0x66ef
+    40a9:	e8 d5 10 00 00       	call   5183 <unlink>
+    40ae:	83 c4 10             	add    $0x10,%esp
+    40b1:	85 c0                	test   %eax,%eax
+    40b3:	0f 84 f2 00 00 00    	je     41ab <rmdot+0x14b>
+  if(unlink("..") == 0){
+    40b9:	83 ec 0c             	sub    $0xc,%esp
+    40bc:	68 ee 66 00 00       	push   $0x66ee
+    40c1:	e8 bd 10 00 00       	call   5183 <unlink>
+    40c6:	83 c4 10             	add    $0x10,%esp
+    40c9:	85 c0                	test   %eax,%eax
+    40cb:	0f 84 c7 00 00 00    	je     4198 <rmdot+0x138>
+  if(chdir("/") != 0){
+    40d1:	83 ec 0c             	sub    $0xc,%esp
+    40d4:	68 8d 59 00 00       	push   $0x598d
+    40d9:	e8 c5 10 00 00       	call   51a3 <chdir>
+    40de:	83 c4 10             	add    $0x10,%esp
+    40e1:	85 c0                	test   %eax,%eax
+    40e3:	0f 85 9c 00 00 00    	jne    4185 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    40e9:	83 ec 0c             	sub    $0xc,%esp
+    40ec:	68 8c 6a 00 00       	push   $0x6a8c
+    40f1:	e8 8d 10 00 00       	call   5183 <unlink>
+    40f6:	83 c4 10             	add    $0x10,%esp
+    40f9:	85 c0                	test   %eax,%eax
+    40fb:	74 75                	je     4172 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    40fd:	83 ec 0c             	sub    $0xc,%esp
+    4100:	68 aa 6a 00 00       	push   $0x6aaa
+    4105:	e8 79 10 00 00       	call   5183 <unlink>
+    410a:	83 c4 10             	add    $0x10,%esp
+    410d:	85 c0                	test   %eax,%eax
+    410f:	74 4e                	je     415f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    4111:	83 ec 0c             	sub    $0xc,%esp
+    4114:	68 44 6a 00 00       	push   $0x6a44
+    4119:	e8 65 10 00 00       	call   5183 <unlink>
+    411e:	83 c4 10             	add    $0x10,%esp
+    4121:	85 c0                	test   %eax,%eax
+    4123:	75 27                	jne    414c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    4125:	83 ec 08             	sub    $0x8,%esp
+    4128:	68 df 6a 00 00       	push   $0x6adf
+    412d:	6a 01                	push   $0x1
+    412f:	e8 0c 12 00 00       	call   5340 <printf>
+}
+    4134:	83 c4 10             	add    $0x10,%esp
+    4137:	c9                   	leave
+    4138:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    4139:	50                   	push   %eax
+    413a:	50                   	push   %eax
+    413b:	68 49 6a 00 00       	push   $0x6a49
+    4140:	6a 01                	push   $0x1
+    4142:	e8 f9 11 00 00       	call   5340 <printf>
+    exit();
+    4147:	e8 e7 0f 00 00       	call   5133 <exit>
+    printf(1, "unlink dots failed!\n");
+    414c:	50                   	push   %eax
+    414d:	50                   	push   %eax
+    414e:	68 ca 6a 00 00       	push   $0x6aca
+    4153:	6a 01                	push   $0x1
+    4155:	e8 e6 11 00 00       	call   5340 <printf>
+    exit();
+    415a:	e8 d4 0f 00 00       	call   5133 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    415f:	52                   	push   %edx
+    4160:	52                   	push   %edx
+    4161:	68 b2 6a 00 00       	push   $0x6ab2
+    4166:	6a 01                	push   $0x1
+    4168:	e8 d3 11 00 00       	call   5340 <printf>
+    exit();
+    416d:	e8 c1 0f 00 00       	call   5133 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    4172:	51                   	push   %ecx
+    4173:	51                   	push   %ecx
+    4174:	68 93 6a 00 00       	push   $0x6a93
+    4179:	6a 01                	push   $0x1
+    417b:	e8 c0 11 00 00       	call   5340 <printf>
+    exit();
+    4180:	e8 ae 0f 00 00       	call   5133 <exit>
+    printf(1, "chdir / failed\n");
+    4185:	50                   	push   %eax
+    4186:	50                   	push   %eax
+    4187:	68 8f 59 00 00       	push   $0x598f
+    418c:	6a 01                	push   $0x1
+    418e:	e8 ad 11 00 00       	call   5340 <printf>
+    exit();
+    4193:	e8 9b 0f 00 00       	call   5133 <exit>
+    printf(1, "rm .. worked!\n");
+    4198:	50                   	push   %eax
+    4199:	50                   	push   %eax
+    419a:	68 7d 6a 00 00       	push   $0x6a7d
+    419f:	6a 01                	push   $0x1
+    41a1:	e8 9a 11 00 00       	call   5340 <printf>
+    exit();
+    41a6:	e8 88 0f 00 00       	call   5133 <exit>
+    printf(1, "rm . worked!\n");
+    41ab:	50                   	push   %eax
+    41ac:	50                   	push   %eax
+    41ad:	68 6f 6a 00 00       	push   $0x6a6f
+    41b2:	6a 01                	push   $0x1
+    41b4:	e8 87 11 00 00       	call   5340 <printf>
+    exit();
+    41b9:	e8 75 0f 00 00       	call   5133 <exit>
+    printf(1, "chdir dots failed\n");
+    41be:	50                   	push   %eax
+    41bf:	50                   	push   %eax
+    41c0:	68 5c 6a 00 00       	push   $0x6a5c
+    41c5:	6a 01                	push   $0x1
+    41c7:	e8 74 11 00 00       	call   5340 <printf>
+    exit();
+    41cc:	e8 62 0f 00 00       	call   5133 <exit>
+    41d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41df:	90                   	nop
+
+000041e0 <dirfile>:
+{
+    41e0:	55                   	push   %ebp
+    41e1:	89 e5                	mov    %esp,%ebp
+    41e3:	53                   	push   %ebx
+    41e4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    41e7:	68 e9 6a 00 00       	push   $0x6ae9
+    41ec:	6a 01                	push   $0x1
+    41ee:	e8 4d 11 00 00       	call   5340 <printf>
+  fd = open("dirfile", O_CREATE);
+    41f3:	5b                   	pop    %ebx
+    41f4:	58                   	pop    %eax
+    41f5:	68 00 02 00 00       	push   $0x200
+    41fa:	68 f6 6a 00 00       	push   $0x6af6
+    41ff:	e8 6f 0f 00 00       	call   5173 <open>
+  if(fd < 0){
+    4204:	83 c4 10             	add    $0x10,%esp
+    4207:	85 c0                	test   %eax,%eax
+    4209:	0f 88 43 01 00 00    	js     4352 <dirfile+0x172>
+  close(fd);
+    420f:	83 ec 0c             	sub    $0xc,%esp
+    4212:	50                   	push   %eax
+    4213:	e8 43 0f 00 00       	call   515b <close>
+  if(chdir("dirfile") == 0){
+    4218:	c7 04 24 f6 6a 00 00 	movl   $0x6af6,(%esp)
+    421f:	e8 7f 0f 00 00       	call   51a3 <chdir>
+    4224:	83 c4 10             	add    $0x10,%esp
+    4227:	85 c0                	test   %eax,%eax
+    4229:	0f 84 10 01 00 00    	je     433f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    422f:	83 ec 08             	sub    $0x8,%esp
+    4232:	6a 00                	push   $0x0
+    4234:	68 2f 6b 00 00       	push   $0x6b2f
+    4239:	e8 35 0f 00 00       	call   5173 <open>
+  if(fd >= 0){
+    423e:	83 c4 10             	add    $0x10,%esp
+    4241:	85 c0                	test   %eax,%eax
+    4243:	0f 89 e3 00 00 00    	jns    432c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    4249:	83 ec 08             	sub    $0x8,%esp
+    424c:	68 00 02 00 00       	push   $0x200
+    4251:	68 2f 6b 00 00       	push   $0x6b2f
+    4256:	e8 18 0f 00 00       	call   5173 <open>
+  if(fd >= 0){
+    425b:	83 c4 10             	add    $0x10,%esp
+    425e:	85 c0                	test   %eax,%eax
+    4260:	0f 89 c6 00 00 00    	jns    432c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    4266:	83 ec 0c             	sub    $0xc,%esp
+    4269:	68 2f 6b 00 00       	push   $0x6b2f
+    426e:	e8 28 0f 00 00       	call   519b <mkdir>
+    4273:	83 c4 10             	add    $0x10,%esp
+    4276:	85 c0                	test   %eax,%eax
+    4278:	0f 84 46 01 00 00    	je     43c4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    427e:	83 ec 0c             	sub    $0xc,%esp
+    4281:	68 2f 6b 00 00       	push   $0x6b2f
+    4286:	e8 f8 0e 00 00       	call   5183 <unlink>
+    428b:	83 c4 10             	add    $0x10,%esp
+    428e:	85 c0                	test   %eax,%eax
+    4290:	0f 84 1b 01 00 00    	je     43b1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    4296:	83 ec 08             	sub    $0x8,%esp
+    4299:	68 2f 6b 00 00       	push   $0x6b2f
+    429e:	68 93 6b 00 00       	push   $0x6b93
+    42a3:	e8 eb 0e 00 00       	call   5193 <link>
+    42a8:	83 c4 10             	add    $0x10,%esp
+    42ab:	85 c0                	test   %eax,%eax
+    42ad:	0f 84 eb 00 00 00    	je     439e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    42b3:	83 ec 0c             	sub    $0xc,%esp
+    42b6:	68 f6 6a 00 00       	push   $0x6af6
+    42bb:	e8 c3 0e 00 00       	call   5183 <unlink>
+    42c0:	83 c4 10             	add    $0x10,%esp
+    42c3:	85 c0                	test   %eax,%eax
+    42c5:	0f 85 c0 00 00 00    	jne    438b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    42cb:	83 ec 08             	sub    $0x8,%esp
+    42ce:	6a 02                	push   $0x2
+    42d0:	68 ef 66 00 00       	push   $0x66ef
+    42d5:	e8 99 0e 00 00       	call   5173 <open>
+  if(fd >= 0){
+    42da:	83 c4 10             	add    $0x10,%esp
+    42dd:	85 c0                	test   %eax,%eax
+    42df:	0f 89 93 00 00 00    	jns    4378 <dirfile+0x198>
+  fd = open(".", 0);
+    42e5:	83 ec 08             	sub    $0x8,%esp
+    42e8:	6a 00                	push   $0x0
+    42ea:	68 ef 66 00 00       	push   $0x66ef
+    42ef:	e8 7f 0e 00 00       	call   5173 <open>
+  if(write(fd, "x", 1) > 0){
+    42f4:	83 c4 0c             	add    $0xc,%esp
+    42f7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    42f9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    42fb:	68 d2 67 00 00       	push   $0x67d2
+    4300:	50                   	push   %eax
+    4301:	e8 4d 0e 00 00       	call   5153 <write>
+    4306:	83 c4 10             	add    $0x10,%esp
+    4309:	85 c0                	test   %eax,%eax
+    430b:	7f 58                	jg     4365 <dirfile+0x185>
+  close(fd);
+    430d:	83 ec 0c             	sub    $0xc,%esp
+    4310:	53                   	push   %ebx
+    4311:	e8 45 0e 00 00       	call   515b <close>
+  printf(1, "dir vs file OK\n");
+    4316:	58                   	pop    %eax
+    4317:	5a                   	pop    %edx
+    4318:	68 c6 6b 00 00       	push   $0x6bc6
+    431d:	6a 01                	push   $0x1
+    431f:	e8 1c 10 00 00       	call   5340 <printf>
+}
+    4324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4327:	83 c4 10             	add    $0x10,%esp
+    432a:	c9                   	leave
+    432b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    432c:	50                   	push   %eax
+    432d:	50                   	push   %eax
+    432e:	68 3a 6b 00 00       	push   $0x6b3a
+    4333:	6a 01                	push   $0x1
+    4335:	e8 06 10 00 00       	call   5340 <printf>
+    exit();
+    433a:	e8 f4 0d 00 00       	call   5133 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    433f:	52                   	push   %edx
+    4340:	52                   	push   %edx
+    4341:	68 15 6b 00 00       	push   $0x6b15
+    4346:	6a 01                	push   $0x1
+    4348:	e8 f3 0f 00 00       	call   5340 <printf>
+    exit();
+    434d:	e8 e1 0d 00 00       	call   5133 <exit>
+    printf(1, "create dirfile failed\n");
+    4352:	51                   	push   %ecx
+    4353:	51                   	push   %ecx
+    4354:	68 fe 6a 00 00       	push   $0x6afe
+    4359:	6a 01                	push   $0x1
+    435b:	e8 e0 0f 00 00       	call   5340 <printf>
+    exit();
+    4360:	e8 ce 0d 00 00       	call   5133 <exit>
+    printf(1, "write . succeeded!\n");
+    4365:	51                   	push   %ecx
+    4366:	51                   	push   %ecx
+    4367:	68 b2 6b 00 00       	push   $0x6bb2
+    436c:	6a 01                	push   $0x1
+    436e:	e8 cd 0f 00 00       	call   5340 <printf>
+    exit();
+    4373:	e8 bb 0d 00 00       	call   5133 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    4378:	53                   	push   %ebx
+    4379:	53                   	push   %ebx
+    437a:	68 d4 76 00 00       	push   $0x76d4
+    437f:	6a 01                	push   $0x1
+    4381:	e8 ba 0f 00 00       	call   5340 <printf>
+    exit();
+    4386:	e8 a8 0d 00 00       	call   5133 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    438b:	50                   	push   %eax
+    438c:	50                   	push   %eax
+    438d:	68 9a 6b 00 00       	push   $0x6b9a
+    4392:	6a 01                	push   $0x1
+    4394:	e8 a7 0f 00 00       	call   5340 <printf>
+    exit();
+    4399:	e8 95 0d 00 00       	call   5133 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    439e:	50                   	push   %eax
+    439f:	50                   	push   %eax
+    43a0:	68 b4 76 00 00       	push   $0x76b4
+    43a5:	6a 01                	push   $0x1
+    43a7:	e8 94 0f 00 00       	call   5340 <printf>
+    exit();
+    43ac:	e8 82 0d 00 00       	call   5133 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    43b1:	50                   	push   %eax
+    43b2:	50                   	push   %eax
+    43b3:	68 75 6b 00 00       	push   $0x6b75
+    43b8:	6a 01                	push   $0x1
+    43ba:	e8 81 0f 00 00       	call   5340 <printf>
+    exit();
+    43bf:	e8 6f 0d 00 00       	call   5133 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    43c4:	50                   	push   %eax
+    43c5:	50                   	push   %eax
+    43c6:	68 58 6b 00 00       	push   $0x6b58
+    43cb:	6a 01                	push   $0x1
+    43cd:	e8 6e 0f 00 00       	call   5340 <printf>
+    exit();
+    43d2:	e8 5c 0d 00 00       	call   5133 <exit>
+    43d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43de:	66 90                	xchg   %ax,%ax
+
+000043e0 <iref>:
+{
+    43e0:	55                   	push   %ebp
+    43e1:	89 e5                	mov    %esp,%ebp
+    43e3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    43e4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    43e9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    43ec:	68 d6 6b 00 00       	push   $0x6bd6
+    43f1:	6a 01                	push   $0x1
+    43f3:	e8 48 0f 00 00       	call   5340 <printf>
+    43f8:	83 c4 10             	add    $0x10,%esp
+    43fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43ff:	90                   	nop
+    if(mkdir("irefd") != 0){
+    4400:	83 ec 0c             	sub    $0xc,%esp
+    4403:	68 e7 6b 00 00       	push   $0x6be7
+    4408:	e8 8e 0d 00 00       	call   519b <mkdir>
+    440d:	83 c4 10             	add    $0x10,%esp
+    4410:	85 c0                	test   %eax,%eax
+    4412:	0f 85 bb 00 00 00    	jne    44d3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    4418:	83 ec 0c             	sub    $0xc,%esp
+    441b:	68 e7 6b 00 00       	push   $0x6be7
+    4420:	e8 7e 0d 00 00       	call   51a3 <chdir>
+    4425:	83 c4 10             	add    $0x10,%esp
+    4428:	85 c0                	test   %eax,%eax
+    442a:	0f 85 b7 00 00 00    	jne    44e7 <iref+0x107>
+    mkdir("");
+    4430:	83 ec 0c             	sub    $0xc,%esp
+    4433:	68 9c 62 00 00       	push   $0x629c
+    4438:	e8 5e 0d 00 00       	call   519b <mkdir>
+    link("README", "");
+    443d:	59                   	pop    %ecx
+    443e:	58                   	pop    %eax
+    443f:	68 9c 62 00 00       	push   $0x629c
+    4444:	68 93 6b 00 00       	push   $0x6b93
+    4449:	e8 45 0d 00 00       	call   5193 <link>
+    fd = open("", O_CREATE);
+    444e:	58                   	pop    %eax
+    444f:	5a                   	pop    %edx
+    4450:	68 00 02 00 00       	push   $0x200
+    4455:	68 9c 62 00 00       	push   $0x629c
+    445a:	e8 14 0d 00 00       	call   5173 <open>
+    if(fd >= 0)
+    445f:	83 c4 10             	add    $0x10,%esp
+    4462:	85 c0                	test   %eax,%eax
+    4464:	78 0c                	js     4472 <iref+0x92>
+      close(fd);
+    4466:	83 ec 0c             	sub    $0xc,%esp
+    4469:	50                   	push   %eax
+    446a:	e8 ec 0c 00 00       	call   515b <close>
+    446f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    4472:	83 ec 08             	sub    $0x8,%esp
+    4475:	68 00 02 00 00       	push   $0x200
+    447a:	68 d1 67 00 00       	push   $0x67d1
+    447f:	e8 ef 0c 00 00       	call   5173 <open>
+    if(fd >= 0)
+    4484:	83 c4 10             	add    $0x10,%esp
+    4487:	85 c0                	test   %eax,%eax
+    4489:	78 0c                	js     4497 <iref+0xb7>
+      close(fd);
+    448b:	83 ec 0c             	sub    $0xc,%esp
+    448e:	50                   	push   %eax
+    448f:	e8 c7 0c 00 00       	call   515b <close>
+    4494:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    4497:	83 ec 0c             	sub    $0xc,%esp
+    449a:	68 d1 67 00 00       	push   $0x67d1
+    449f:	e8 df 0c 00 00       	call   5183 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    44a4:	83 c4 10             	add    $0x10,%esp
+    44a7:	83 eb 01             	sub    $0x1,%ebx
+    44aa:	0f 85 50 ff ff ff    	jne    4400 <iref+0x20>
+  chdir("/");
+    44b0:	83 ec 0c             	sub    $0xc,%esp
+    44b3:	68 8d 59 00 00       	push   $0x598d
+    44b8:	e8 e6 0c 00 00       	call   51a3 <chdir>
+  printf(1, "empty file name OK\n");
+    44bd:	58                   	pop    %eax
+    44be:	5a                   	pop    %edx
+    44bf:	68 15 6c 00 00       	push   $0x6c15
+    44c4:	6a 01                	push   $0x1
+    44c6:	e8 75 0e 00 00       	call   5340 <printf>
+}
+    44cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    44ce:	83 c4 10             	add    $0x10,%esp
+    44d1:	c9                   	leave
+    44d2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    44d3:	83 ec 08             	sub    $0x8,%esp
+    44d6:	68 ed 6b 00 00       	push   $0x6bed
+    44db:	6a 01                	push   $0x1
+    44dd:	e8 5e 0e 00 00       	call   5340 <printf>
+      exit();
+    44e2:	e8 4c 0c 00 00       	call   5133 <exit>
+      printf(1, "chdir irefd failed\n");
+    44e7:	83 ec 08             	sub    $0x8,%esp
+    44ea:	68 01 6c 00 00       	push   $0x6c01
+    44ef:	6a 01                	push   $0x1
+    44f1:	e8 4a 0e 00 00       	call   5340 <printf>
+      exit();
+    44f6:	e8 38 0c 00 00       	call   5133 <exit>
+    44fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44ff:	90                   	nop
+
+00004500 <forktest>:
+{
+    4500:	55                   	push   %ebp
+    4501:	89 e5                	mov    %esp,%ebp
+    4503:	53                   	push   %ebx
+  for(n=0; n<NPROC; n++){
+    4504:	31 db                	xor    %ebx,%ebx
+{
+    4506:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    4509:	68 24 5f 00 00       	push   $0x5f24
+    450e:	6a 01                	push   $0x1
+    4510:	e8 2b 0e 00 00       	call   5340 <printf>
+    4515:	83 c4 10             	add    $0x10,%esp
+    4518:	eb 13                	jmp    452d <forktest+0x2d>
+    451a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    4520:	74 4d                	je     456f <forktest+0x6f>
+  for(n=0; n<NPROC; n++){
+    4522:	83 c3 01             	add    $0x1,%ebx
+    4525:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    452b:	74 6e                	je     459b <forktest+0x9b>
+    pid = fork();
+    452d:	e8 f9 0b 00 00       	call   512b <fork>
+    if(pid < 0)
+    4532:	85 c0                	test   %eax,%eax
+    4534:	79 ea                	jns    4520 <forktest+0x20>
+  for(; n > 0; n--){
+    4536:	85 db                	test   %ebx,%ebx
+    4538:	74 14                	je     454e <forktest+0x4e>
+    453a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    4540:	e8 f6 0b 00 00       	call   513b <wait>
+    4545:	85 c0                	test   %eax,%eax
+    4547:	78 2b                	js     4574 <forktest+0x74>
+  for(; n > 0; n--){
+    4549:	83 eb 01             	sub    $0x1,%ebx
+    454c:	75 f2                	jne    4540 <forktest+0x40>
+  if(wait() != -1){
+    454e:	e8 e8 0b 00 00       	call   513b <wait>
+    4553:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4556:	75 30                	jne    4588 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    4558:	83 ec 08             	sub    $0x8,%esp
+    455b:	68 50 6c 00 00       	push   $0x6c50
+    4560:	6a 01                	push   $0x1
+    4562:	e8 d9 0d 00 00       	call   5340 <printf>
+}
+    4567:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    456a:	83 c4 10             	add    $0x10,%esp
+    456d:	c9                   	leave
+    456e:	c3                   	ret
+      exit();
+    456f:	e8 bf 0b 00 00       	call   5133 <exit>
+      printf(1, "wait stopped early\n");
+    4574:	83 ec 08             	sub    $0x8,%esp
+    4577:	68 29 6c 00 00       	push   $0x6c29
+    457c:	6a 01                	push   $0x1
+    457e:	e8 bd 0d 00 00       	call   5340 <printf>
+      exit();
+    4583:	e8 ab 0b 00 00       	call   5133 <exit>
+    printf(1, "wait got too many\n");
+    4588:	50                   	push   %eax
+    4589:	50                   	push   %eax
+    458a:	68 3d 6c 00 00       	push   $0x6c3d
+    458f:	6a 01                	push   $0x1
+    4591:	e8 aa 0d 00 00       	call   5340 <printf>
+    exit();
+    4596:	e8 98 0b 00 00       	call   5133 <exit>
+    printf(1, "fork claimed to work NPROC times!\n");
+    459b:	52                   	push   %edx
+    459c:	52                   	push   %edx
+    459d:	68 f4 76 00 00       	push   $0x76f4
+    45a2:	6a 01                	push   $0x1
+    45a4:	e8 97 0d 00 00       	call   5340 <printf>
+    exit();
+    45a9:	e8 85 0b 00 00       	call   5133 <exit>
+    45ae:	66 90                	xchg   %ax,%ax
+
+000045b0 <sbrktest>:
+{
+    45b0:	55                   	push   %ebp
+    45b1:	89 e5                	mov    %esp,%ebp
+    45b3:	57                   	push   %edi
+    45b4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    45b5:	31 f6                	xor    %esi,%esi
+{
+    45b7:	53                   	push   %ebx
+    45b8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    45bb:	68 5e 6c 00 00       	push   $0x6c5e
+    45c0:	ff 35 a8 87 00 00    	push   0x87a8
+    45c6:	e8 75 0d 00 00       	call   5340 <printf>
+  oldbrk = sbrk(0);
+    45cb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    45d2:	e8 e4 0b 00 00       	call   51bb <sbrk>
+    45d7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    45da:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    45e1:	e8 d5 0b 00 00       	call   51bb <sbrk>
+    45e6:	83 c4 10             	add    $0x10,%esp
+    45e9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    45eb:	eb 05                	jmp    45f2 <sbrktest+0x42>
+    45ed:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    45f0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    45f2:	83 ec 0c             	sub    $0xc,%esp
+    45f5:	6a 01                	push   $0x1
+    45f7:	e8 bf 0b 00 00       	call   51bb <sbrk>
+    if(b != a){
+    45fc:	83 c4 10             	add    $0x10,%esp
+    45ff:	39 d8                	cmp    %ebx,%eax
+    4601:	0f 85 9c 02 00 00    	jne    48a3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    4607:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    460a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    460d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    4610:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    4616:	75 d8                	jne    45f0 <sbrktest+0x40>
+  pid = fork();
+    4618:	e8 0e 0b 00 00       	call   512b <fork>
+    461d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    461f:	85 c0                	test   %eax,%eax
+    4621:	0f 88 02 03 00 00    	js     4929 <sbrktest+0x379>
+  c = sbrk(1);
+    4627:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    462a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    462d:	6a 01                	push   $0x1
+    462f:	e8 87 0b 00 00       	call   51bb <sbrk>
+  c = sbrk(1);
+    4634:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    463b:	e8 7b 0b 00 00       	call   51bb <sbrk>
+  if(c != a + 1){
+    4640:	83 c4 10             	add    $0x10,%esp
+    4643:	39 c3                	cmp    %eax,%ebx
+    4645:	0f 85 3b 03 00 00    	jne    4986 <sbrktest+0x3d6>
+  if(pid == 0)
+    464b:	85 f6                	test   %esi,%esi
+    464d:	0f 84 2e 03 00 00    	je     4981 <sbrktest+0x3d1>
+  wait();
+    4653:	e8 e3 0a 00 00       	call   513b <wait>
+  a = sbrk(0);
+    4658:	83 ec 0c             	sub    $0xc,%esp
+    465b:	6a 00                	push   $0x0
+    465d:	e8 59 0b 00 00       	call   51bb <sbrk>
+    4662:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    4664:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4669:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    466b:	89 04 24             	mov    %eax,(%esp)
+    466e:	e8 48 0b 00 00       	call   51bb <sbrk>
+  if (p != a) {
+    4673:	83 c4 10             	add    $0x10,%esp
+    4676:	39 c3                	cmp    %eax,%ebx
+    4678:	0f 85 94 02 00 00    	jne    4912 <sbrktest+0x362>
+  a = sbrk(0);
+    467e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    4681:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    4688:	6a 00                	push   $0x0
+    468a:	e8 2c 0b 00 00       	call   51bb <sbrk>
+  c = sbrk(-4096);
+    468f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    4696:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    4698:	e8 1e 0b 00 00       	call   51bb <sbrk>
+  if(c == (char*)0xffffffff){
+    469d:	83 c4 10             	add    $0x10,%esp
+    46a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    46a3:	0f 84 22 03 00 00    	je     49cb <sbrktest+0x41b>
+  c = sbrk(0);
+    46a9:	83 ec 0c             	sub    $0xc,%esp
+    46ac:	6a 00                	push   $0x0
+    46ae:	e8 08 0b 00 00       	call   51bb <sbrk>
+  if(c != a - 4096){
+    46b3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    46b9:	83 c4 10             	add    $0x10,%esp
+    46bc:	39 d0                	cmp    %edx,%eax
+    46be:	0f 85 f0 02 00 00    	jne    49b4 <sbrktest+0x404>
+  a = sbrk(0);
+    46c4:	83 ec 0c             	sub    $0xc,%esp
+    46c7:	6a 00                	push   $0x0
+    46c9:	e8 ed 0a 00 00       	call   51bb <sbrk>
+  c = sbrk(4096);
+    46ce:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    46d5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    46d7:	e8 df 0a 00 00       	call   51bb <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    46dc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    46df:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    46e1:	39 c3                	cmp    %eax,%ebx
+    46e3:	0f 85 b4 02 00 00    	jne    499d <sbrktest+0x3ed>
+    46e9:	83 ec 0c             	sub    $0xc,%esp
+    46ec:	6a 00                	push   $0x0
+    46ee:	e8 c8 0a 00 00       	call   51bb <sbrk>
+    46f3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    46f9:	83 c4 10             	add    $0x10,%esp
+    46fc:	39 c2                	cmp    %eax,%edx
+    46fe:	0f 85 99 02 00 00    	jne    499d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    4704:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    470b:	0f 84 2f 02 00 00    	je     4940 <sbrktest+0x390>
+  a = sbrk(0);
+    4711:	83 ec 0c             	sub    $0xc,%esp
+    4714:	6a 00                	push   $0x0
+    4716:	e8 a0 0a 00 00       	call   51bb <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    471b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    4722:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    4724:	e8 92 0a 00 00       	call   51bb <sbrk>
+    4729:	89 c2                	mov    %eax,%edx
+    472b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    472e:	29 d0                	sub    %edx,%eax
+    4730:	89 04 24             	mov    %eax,(%esp)
+    4733:	e8 83 0a 00 00       	call   51bb <sbrk>
+  if(c != a){
+    4738:	83 c4 10             	add    $0x10,%esp
+    473b:	39 c3                	cmp    %eax,%ebx
+    473d:	0f 85 b8 01 00 00    	jne    48fb <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4743:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    4748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    474f:	90                   	nop
+    ppid = getpid();
+    4750:	e8 5e 0a 00 00       	call   51b3 <getpid>
+    4755:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    4757:	e8 cf 09 00 00       	call   512b <fork>
+    if(pid < 0){
+    475c:	85 c0                	test   %eax,%eax
+    475e:	0f 88 5d 01 00 00    	js     48c1 <sbrktest+0x311>
+    if(pid == 0){
+    4764:	0f 84 6f 01 00 00    	je     48d9 <sbrktest+0x329>
+    wait();
+    476a:	e8 cc 09 00 00       	call   513b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    476f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    4775:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    477b:	75 d3                	jne    4750 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    477d:	83 ec 0c             	sub    $0xc,%esp
+    4780:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    4783:	50                   	push   %eax
+    4784:	e8 ba 09 00 00       	call   5143 <pipe>
+    4789:	83 c4 10             	add    $0x10,%esp
+    478c:	85 c0                	test   %eax,%eax
+    478e:	0f 85 da 01 00 00    	jne    496e <sbrktest+0x3be>
+    4794:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    4797:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    479a:	89 df                	mov    %ebx,%edi
+    479c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    47a0:	e8 86 09 00 00       	call   512b <fork>
+    47a5:	89 07                	mov    %eax,(%edi)
+    47a7:	85 c0                	test   %eax,%eax
+    47a9:	0f 84 91 00 00 00    	je     4840 <sbrktest+0x290>
+    if(pids[i] != -1)
+    47af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    47b2:	74 14                	je     47c8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    47b4:	83 ec 04             	sub    $0x4,%esp
+    47b7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    47ba:	6a 01                	push   $0x1
+    47bc:	50                   	push   %eax
+    47bd:	ff 75 b8             	push   -0x48(%ebp)
+    47c0:	e8 86 09 00 00       	call   514b <read>
+    47c5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    47c8:	83 c7 04             	add    $0x4,%edi
+    47cb:	39 f7                	cmp    %esi,%edi
+    47cd:	75 d1                	jne    47a0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    47cf:	83 ec 0c             	sub    $0xc,%esp
+    47d2:	68 00 10 00 00       	push   $0x1000
+    47d7:	e8 df 09 00 00       	call   51bb <sbrk>
+    47dc:	83 c4 10             	add    $0x10,%esp
+    47df:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    47e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    47e8:	8b 03                	mov    (%ebx),%eax
+    47ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+    47ed:	74 11                	je     4800 <sbrktest+0x250>
+    kill(pids[i]);
+    47ef:	83 ec 0c             	sub    $0xc,%esp
+    47f2:	50                   	push   %eax
+    47f3:	e8 6b 09 00 00       	call   5163 <kill>
+    wait();
+    47f8:	e8 3e 09 00 00       	call   513b <wait>
+    47fd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4800:	83 c3 04             	add    $0x4,%ebx
+    4803:	39 f3                	cmp    %esi,%ebx
+    4805:	75 e1                	jne    47e8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    4807:	83 ff ff             	cmp    $0xffffffff,%edi
+    480a:	0f 84 47 01 00 00    	je     4957 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    4810:	83 ec 0c             	sub    $0xc,%esp
+    4813:	6a 00                	push   $0x0
+    4815:	e8 a1 09 00 00       	call   51bb <sbrk>
+    481a:	83 c4 10             	add    $0x10,%esp
+    481d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    4820:	72 60                	jb     4882 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    4822:	83 ec 08             	sub    $0x8,%esp
+    4825:	68 06 6d 00 00       	push   $0x6d06
+    482a:	ff 35 a8 87 00 00    	push   0x87a8
+    4830:	e8 0b 0b 00 00       	call   5340 <printf>
+}
+    4835:	83 c4 10             	add    $0x10,%esp
+    4838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    483b:	5b                   	pop    %ebx
+    483c:	5e                   	pop    %esi
+    483d:	5f                   	pop    %edi
+    483e:	5d                   	pop    %ebp
+    483f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    4840:	83 ec 0c             	sub    $0xc,%esp
+    4843:	6a 00                	push   $0x0
+    4845:	e8 71 09 00 00       	call   51bb <sbrk>
+    484a:	89 c2                	mov    %eax,%edx
+    484c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4851:	29 d0                	sub    %edx,%eax
+    4853:	89 04 24             	mov    %eax,(%esp)
+    4856:	e8 60 09 00 00       	call   51bb <sbrk>
+      write(fds[1], "x", 1);
+    485b:	83 c4 0c             	add    $0xc,%esp
+    485e:	6a 01                	push   $0x1
+    4860:	68 d2 67 00 00       	push   $0x67d2
+    4865:	ff 75 bc             	push   -0x44(%ebp)
+    4868:	e8 e6 08 00 00       	call   5153 <write>
+    486d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    4870:	83 ec 0c             	sub    $0xc,%esp
+    4873:	68 e8 03 00 00       	push   $0x3e8
+    4878:	e8 46 09 00 00       	call   51c3 <sleep>
+    487d:	83 c4 10             	add    $0x10,%esp
+    4880:	eb ee                	jmp    4870 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    4882:	83 ec 0c             	sub    $0xc,%esp
+    4885:	6a 00                	push   $0x0
+    4887:	e8 2f 09 00 00       	call   51bb <sbrk>
+    488c:	89 c2                	mov    %eax,%edx
+    488e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    4891:	29 d0                	sub    %edx,%eax
+    4893:	89 04 24             	mov    %eax,(%esp)
+    4896:	e8 20 09 00 00       	call   51bb <sbrk>
+    489b:	83 c4 10             	add    $0x10,%esp
+    489e:	e9 7f ff ff ff       	jmp    4822 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    48a3:	83 ec 0c             	sub    $0xc,%esp
+    48a6:	50                   	push   %eax
+    48a7:	53                   	push   %ebx
+    48a8:	56                   	push   %esi
+    48a9:	68 69 6c 00 00       	push   $0x6c69
+    48ae:	ff 35 a8 87 00 00    	push   0x87a8
+    48b4:	e8 87 0a 00 00       	call   5340 <printf>
+      exit();
+    48b9:	83 c4 20             	add    $0x20,%esp
+    48bc:	e8 72 08 00 00       	call   5133 <exit>
+      printf(stdout, "fork failed\n");
+    48c1:	83 ec 08             	sub    $0x8,%esp
+    48c4:	68 af 6d 00 00       	push   $0x6daf
+    48c9:	ff 35 a8 87 00 00    	push   0x87a8
+    48cf:	e8 6c 0a 00 00       	call   5340 <printf>
+      exit();
+    48d4:	e8 5a 08 00 00       	call   5133 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    48d9:	0f be 03             	movsbl (%ebx),%eax
+    48dc:	50                   	push   %eax
+    48dd:	53                   	push   %ebx
+    48de:	68 d2 6c 00 00       	push   $0x6cd2
+    48e3:	ff 35 a8 87 00 00    	push   0x87a8
+    48e9:	e8 52 0a 00 00       	call   5340 <printf>
+      kill(ppid);
+    48ee:	89 34 24             	mov    %esi,(%esp)
+    48f1:	e8 6d 08 00 00       	call   5163 <kill>
+      exit();
+    48f6:	e8 38 08 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    48fb:	50                   	push   %eax
+    48fc:	53                   	push   %ebx
+    48fd:	68 e8 77 00 00       	push   $0x77e8
+    4902:	ff 35 a8 87 00 00    	push   0x87a8
+    4908:	e8 33 0a 00 00       	call   5340 <printf>
+    exit();
+    490d:	e8 21 08 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    4912:	56                   	push   %esi
+    4913:	56                   	push   %esi
+    4914:	68 18 77 00 00       	push   $0x7718
+    4919:	ff 35 a8 87 00 00    	push   0x87a8
+    491f:	e8 1c 0a 00 00       	call   5340 <printf>
+    exit();
+    4924:	e8 0a 08 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    4929:	50                   	push   %eax
+    492a:	50                   	push   %eax
+    492b:	68 84 6c 00 00       	push   $0x6c84
+    4930:	ff 35 a8 87 00 00    	push   0x87a8
+    4936:	e8 05 0a 00 00       	call   5340 <printf>
+    exit();
+    493b:	e8 f3 07 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    4940:	51                   	push   %ecx
+    4941:	51                   	push   %ecx
+    4942:	68 b8 77 00 00       	push   $0x77b8
+    4947:	ff 35 a8 87 00 00    	push   0x87a8
+    494d:	e8 ee 09 00 00       	call   5340 <printf>
+    exit();
+    4952:	e8 dc 07 00 00       	call   5133 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    4957:	50                   	push   %eax
+    4958:	50                   	push   %eax
+    4959:	68 eb 6c 00 00       	push   $0x6ceb
+    495e:	ff 35 a8 87 00 00    	push   0x87a8
+    4964:	e8 d7 09 00 00       	call   5340 <printf>
+    exit();
+    4969:	e8 c5 07 00 00       	call   5133 <exit>
+    printf(1, "pipe() failed\n");
+    496e:	52                   	push   %edx
+    496f:	52                   	push   %edx
+    4970:	68 7d 5c 00 00       	push   $0x5c7d
+    4975:	6a 01                	push   $0x1
+    4977:	e8 c4 09 00 00       	call   5340 <printf>
+    exit();
+    497c:	e8 b2 07 00 00       	call   5133 <exit>
+    exit();
+    4981:	e8 ad 07 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    4986:	57                   	push   %edi
+    4987:	57                   	push   %edi
+    4988:	68 9b 6c 00 00       	push   $0x6c9b
+    498d:	ff 35 a8 87 00 00    	push   0x87a8
+    4993:	e8 a8 09 00 00       	call   5340 <printf>
+    exit();
+    4998:	e8 96 07 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    499d:	56                   	push   %esi
+    499e:	53                   	push   %ebx
+    499f:	68 90 77 00 00       	push   $0x7790
+    49a4:	ff 35 a8 87 00 00    	push   0x87a8
+    49aa:	e8 91 09 00 00       	call   5340 <printf>
+    exit();
+    49af:	e8 7f 07 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    49b4:	50                   	push   %eax
+    49b5:	53                   	push   %ebx
+    49b6:	68 58 77 00 00       	push   $0x7758
+    49bb:	ff 35 a8 87 00 00    	push   0x87a8
+    49c1:	e8 7a 09 00 00       	call   5340 <printf>
+    exit();
+    49c6:	e8 68 07 00 00       	call   5133 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    49cb:	53                   	push   %ebx
+    49cc:	53                   	push   %ebx
+    49cd:	68 b7 6c 00 00       	push   $0x6cb7
+    49d2:	ff 35 a8 87 00 00    	push   0x87a8
+    49d8:	e8 63 09 00 00       	call   5340 <printf>
+    exit();
+    49dd:	e8 51 07 00 00       	call   5133 <exit>
+    49e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000049f0 <validateint>:
+}
+    49f0:	c3                   	ret
+    49f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49ff:	90                   	nop
+
+00004a00 <validatetest>:
+{
+    4a00:	55                   	push   %ebp
+    4a01:	89 e5                	mov    %esp,%ebp
+    4a03:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4a04:	31 f6                	xor    %esi,%esi
+{
+    4a06:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    4a07:	83 ec 08             	sub    $0x8,%esp
+    4a0a:	68 14 6d 00 00       	push   $0x6d14
+    4a0f:	ff 35 a8 87 00 00    	push   0x87a8
+    4a15:	e8 26 09 00 00       	call   5340 <printf>
+    4a1a:	83 c4 10             	add    $0x10,%esp
+    4a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    4a20:	e8 06 07 00 00       	call   512b <fork>
+    4a25:	89 c3                	mov    %eax,%ebx
+    4a27:	85 c0                	test   %eax,%eax
+    4a29:	74 63                	je     4a8e <validatetest+0x8e>
+    sleep(0);
+    4a2b:	83 ec 0c             	sub    $0xc,%esp
+    4a2e:	6a 00                	push   $0x0
+    4a30:	e8 8e 07 00 00       	call   51c3 <sleep>
+    sleep(0);
+    4a35:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4a3c:	e8 82 07 00 00       	call   51c3 <sleep>
+    kill(pid);
+    4a41:	89 1c 24             	mov    %ebx,(%esp)
+    4a44:	e8 1a 07 00 00       	call   5163 <kill>
+    wait();
+    4a49:	e8 ed 06 00 00       	call   513b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    4a4e:	58                   	pop    %eax
+    4a4f:	5a                   	pop    %edx
+    4a50:	56                   	push   %esi
+    4a51:	68 23 6d 00 00       	push   $0x6d23
+    4a56:	e8 38 07 00 00       	call   5193 <link>
+    4a5b:	83 c4 10             	add    $0x10,%esp
+    4a5e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4a61:	75 30                	jne    4a93 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4a63:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4a69:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    4a6f:	75 af                	jne    4a20 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    4a71:	83 ec 08             	sub    $0x8,%esp
+    4a74:	68 47 6d 00 00       	push   $0x6d47
+    4a79:	ff 35 a8 87 00 00    	push   0x87a8
+    4a7f:	e8 bc 08 00 00       	call   5340 <printf>
+}
+    4a84:	83 c4 10             	add    $0x10,%esp
+    4a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4a8a:	5b                   	pop    %ebx
+    4a8b:	5e                   	pop    %esi
+    4a8c:	5d                   	pop    %ebp
+    4a8d:	c3                   	ret
+      exit();
+    4a8e:	e8 a0 06 00 00       	call   5133 <exit>
+      printf(stdout, "link should not succeed\n");
+    4a93:	83 ec 08             	sub    $0x8,%esp
+    4a96:	68 2e 6d 00 00       	push   $0x6d2e
+    4a9b:	ff 35 a8 87 00 00    	push   0x87a8
+    4aa1:	e8 9a 08 00 00       	call   5340 <printf>
+      exit();
+    4aa6:	e8 88 06 00 00       	call   5133 <exit>
+    4aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4aaf:	90                   	nop
+
+00004ab0 <bsstest>:
+{
+    4ab0:	55                   	push   %ebp
+    4ab1:	89 e5                	mov    %esp,%ebp
+    4ab3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4ab6:	68 54 6d 00 00       	push   $0x6d54
+    4abb:	ff 35 a8 87 00 00    	push   0x87a8
+    4ac1:	e8 7a 08 00 00       	call   5340 <printf>
+    4ac6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4ac9:	31 c0                	xor    %eax,%eax
+    4acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4acf:	90                   	nop
+    if(uninit[i] != '\0'){
+    4ad0:	80 b8 c0 87 00 00 00 	cmpb   $0x0,0x87c0(%eax)
+    4ad7:	75 22                	jne    4afb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4ad9:	83 c0 01             	add    $0x1,%eax
+    4adc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4ae1:	75 ed                	jne    4ad0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4ae3:	83 ec 08             	sub    $0x8,%esp
+    4ae6:	68 6f 6d 00 00       	push   $0x6d6f
+    4aeb:	ff 35 a8 87 00 00    	push   0x87a8
+    4af1:	e8 4a 08 00 00       	call   5340 <printf>
+}
+    4af6:	83 c4 10             	add    $0x10,%esp
+    4af9:	c9                   	leave
+    4afa:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    4afb:	83 ec 08             	sub    $0x8,%esp
+    4afe:	68 5e 6d 00 00       	push   $0x6d5e
+    4b03:	ff 35 a8 87 00 00    	push   0x87a8
+    4b09:	e8 32 08 00 00       	call   5340 <printf>
+      exit();
+    4b0e:	e8 20 06 00 00       	call   5133 <exit>
+    4b13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004b20 <bigargtest>:
+{
+    4b20:	55                   	push   %ebp
+    4b21:	89 e5                	mov    %esp,%ebp
+    4b23:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    4b26:	68 7c 6d 00 00       	push   $0x6d7c
+    4b2b:	e8 53 06 00 00       	call   5183 <unlink>
+  pid = fork();
+    4b30:	e8 f6 05 00 00       	call   512b <fork>
+  if(pid == 0){
+    4b35:	83 c4 10             	add    $0x10,%esp
+    4b38:	85 c0                	test   %eax,%eax
+    4b3a:	74 44                	je     4b80 <bigargtest+0x60>
+  } else if(pid < 0){
+    4b3c:	0f 88 c3 00 00 00    	js     4c05 <bigargtest+0xe5>
+  wait();
+    4b42:	e8 f4 05 00 00       	call   513b <wait>
+  fd = open("bigarg-ok", 0);
+    4b47:	83 ec 08             	sub    $0x8,%esp
+    4b4a:	6a 00                	push   $0x0
+    4b4c:	68 7c 6d 00 00       	push   $0x6d7c
+    4b51:	e8 1d 06 00 00       	call   5173 <open>
+  if(fd < 0){
+    4b56:	83 c4 10             	add    $0x10,%esp
+    4b59:	85 c0                	test   %eax,%eax
+    4b5b:	0f 88 8d 00 00 00    	js     4bee <bigargtest+0xce>
+  close(fd);
+    4b61:	83 ec 0c             	sub    $0xc,%esp
+    4b64:	50                   	push   %eax
+    4b65:	e8 f1 05 00 00       	call   515b <close>
+  unlink("bigarg-ok");
+    4b6a:	c7 04 24 7c 6d 00 00 	movl   $0x6d7c,(%esp)
+    4b71:	e8 0d 06 00 00       	call   5183 <unlink>
+}
+    4b76:	83 c4 10             	add    $0x10,%esp
+    4b79:	c9                   	leave
+    4b7a:	c3                   	ret
+    4b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4b7f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4b80:	c7 04 85 00 8f 04 00 	movl   $0x780c,0x48f00(,%eax,4)
+    4b87:	0c 78 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    4b8b:	83 c0 01             	add    $0x1,%eax
+    4b8e:	83 f8 1f             	cmp    $0x1f,%eax
+    4b91:	75 ed                	jne    4b80 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4b93:	31 c9                	xor    %ecx,%ecx
+    4b95:	89 0d 7c 8f 04 00    	mov    %ecx,0x48f7c
+    printf(stdout, "bigarg test\n");
+    4b9b:	50                   	push   %eax
+    4b9c:	50                   	push   %eax
+    4b9d:	68 86 6d 00 00       	push   $0x6d86
+    4ba2:	ff 35 a8 87 00 00    	push   0x87a8
+    4ba8:	e8 93 07 00 00       	call   5340 <printf>
+    exec("echo", args);
+    4bad:	58                   	pop    %eax
+    4bae:	5a                   	pop    %edx
+    4baf:	68 00 8f 04 00       	push   $0x48f00
+    4bb4:	68 29 5a 00 00       	push   $0x5a29
+    4bb9:	e8 ad 05 00 00       	call   516b <exec>
+    printf(stdout, "bigarg test ok\n");
+    4bbe:	59                   	pop    %ecx
+    4bbf:	58                   	pop    %eax
+    4bc0:	68 93 6d 00 00       	push   $0x6d93
+    4bc5:	ff 35 a8 87 00 00    	push   0x87a8
+    4bcb:	e8 70 07 00 00       	call   5340 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4bd0:	58                   	pop    %eax
+    4bd1:	5a                   	pop    %edx
+    4bd2:	68 00 02 00 00       	push   $0x200
+    4bd7:	68 7c 6d 00 00       	push   $0x6d7c
+    4bdc:	e8 92 05 00 00       	call   5173 <open>
+    close(fd);
+    4be1:	89 04 24             	mov    %eax,(%esp)
+    4be4:	e8 72 05 00 00       	call   515b <close>
+    exit();
+    4be9:	e8 45 05 00 00       	call   5133 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    4bee:	50                   	push   %eax
+    4bef:	50                   	push   %eax
+    4bf0:	68 bc 6d 00 00       	push   $0x6dbc
+    4bf5:	ff 35 a8 87 00 00    	push   0x87a8
+    4bfb:	e8 40 07 00 00       	call   5340 <printf>
+    exit();
+    4c00:	e8 2e 05 00 00       	call   5133 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4c05:	52                   	push   %edx
+    4c06:	52                   	push   %edx
+    4c07:	68 a3 6d 00 00       	push   $0x6da3
+    4c0c:	ff 35 a8 87 00 00    	push   0x87a8
+    4c12:	e8 29 07 00 00       	call   5340 <printf>
+    exit();
+    4c17:	e8 17 05 00 00       	call   5133 <exit>
+    4c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004c20 <fsfull>:
+{
+    4c20:	55                   	push   %ebp
+    4c21:	89 e5                	mov    %esp,%ebp
+    4c23:	57                   	push   %edi
+    4c24:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4c25:	31 f6                	xor    %esi,%esi
+{
+    4c27:	53                   	push   %ebx
+    4c28:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    4c2b:	68 d1 6d 00 00       	push   $0x6dd1
+    4c30:	6a 01                	push   $0x1
+    4c32:	e8 09 07 00 00       	call   5340 <printf>
+    4c37:	83 c4 10             	add    $0x10,%esp
+    4c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4c40:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c45:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    4c4a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    4c4d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4c51:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4c53:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4c57:	c1 ea 06             	shr    $0x6,%edx
+    4c5a:	8d 42 30             	lea    0x30(%edx),%eax
+    4c5d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4c60:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4c66:	89 f2                	mov    %esi,%edx
+    4c68:	29 c2                	sub    %eax,%edx
+    4c6a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    4c6f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c71:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4c76:	c1 ea 05             	shr    $0x5,%edx
+    4c79:	83 c2 30             	add    $0x30,%edx
+    4c7c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c7f:	f7 e6                	mul    %esi
+    4c81:	c1 ea 05             	shr    $0x5,%edx
+    4c84:	6b c2 64             	imul   $0x64,%edx,%eax
+    4c87:	89 f2                	mov    %esi,%edx
+    4c89:	29 c2                	sub    %eax,%edx
+    4c8b:	89 d0                	mov    %edx,%eax
+    4c8d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4c8f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4c91:	c1 ea 03             	shr    $0x3,%edx
+    4c94:	83 c2 30             	add    $0x30,%edx
+    4c97:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4c9a:	f7 e1                	mul    %ecx
+    4c9c:	89 f0                	mov    %esi,%eax
+    4c9e:	c1 ea 03             	shr    $0x3,%edx
+    4ca1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4ca4:	01 d2                	add    %edx,%edx
+    4ca6:	29 d0                	sub    %edx,%eax
+    4ca8:	83 c0 30             	add    $0x30,%eax
+    4cab:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    4cae:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4cb1:	50                   	push   %eax
+    4cb2:	68 de 6d 00 00       	push   $0x6dde
+    4cb7:	6a 01                	push   $0x1
+    4cb9:	e8 82 06 00 00       	call   5340 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    4cbe:	58                   	pop    %eax
+    4cbf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4cc2:	5a                   	pop    %edx
+    4cc3:	68 02 02 00 00       	push   $0x202
+    4cc8:	50                   	push   %eax
+    4cc9:	e8 a5 04 00 00       	call   5173 <open>
+    if(fd < 0){
+    4cce:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4cd1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4cd3:	85 c0                	test   %eax,%eax
+    4cd5:	78 4f                	js     4d26 <fsfull+0x106>
+    int total = 0;
+    4cd7:	31 db                	xor    %ebx,%ebx
+    4cd9:	eb 07                	jmp    4ce2 <fsfull+0xc2>
+    4cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4cdf:	90                   	nop
+      total += cc;
+    4ce0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4ce2:	83 ec 04             	sub    $0x4,%esp
+    4ce5:	68 00 02 00 00       	push   $0x200
+    4cea:	68 00 6f 04 00       	push   $0x46f00
+    4cef:	57                   	push   %edi
+    4cf0:	e8 5e 04 00 00       	call   5153 <write>
+      if(cc < 512)
+    4cf5:	83 c4 10             	add    $0x10,%esp
+    4cf8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    4cfd:	7f e1                	jg     4ce0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    4cff:	83 ec 04             	sub    $0x4,%esp
+    4d02:	53                   	push   %ebx
+    4d03:	68 fa 6d 00 00       	push   $0x6dfa
+    4d08:	6a 01                	push   $0x1
+    4d0a:	e8 31 06 00 00       	call   5340 <printf>
+    close(fd);
+    4d0f:	89 3c 24             	mov    %edi,(%esp)
+    4d12:	e8 44 04 00 00       	call   515b <close>
+    if(total == 0)
+    4d17:	83 c4 10             	add    $0x10,%esp
+    4d1a:	85 db                	test   %ebx,%ebx
+    4d1c:	74 1e                	je     4d3c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    4d1e:	83 c6 01             	add    $0x1,%esi
+    4d21:	e9 1a ff ff ff       	jmp    4c40 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4d26:	83 ec 04             	sub    $0x4,%esp
+    4d29:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4d2c:	50                   	push   %eax
+    4d2d:	68 ea 6d 00 00       	push   $0x6dea
+    4d32:	6a 01                	push   $0x1
+    4d34:	e8 07 06 00 00       	call   5340 <printf>
+      break;
+    4d39:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    4d3c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d41:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d4d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4d50:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4d52:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4d55:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4d59:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    4d5b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4d5f:	c1 ea 06             	shr    $0x6,%edx
+    4d62:	8d 42 30             	lea    0x30(%edx),%eax
+    4d65:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d68:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4d6e:	89 f2                	mov    %esi,%edx
+    4d70:	29 c2                	sub    %eax,%edx
+    4d72:	89 d0                	mov    %edx,%eax
+    4d74:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d76:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4d78:	c1 ea 05             	shr    $0x5,%edx
+    4d7b:	83 c2 30             	add    $0x30,%edx
+    4d7e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d81:	f7 e3                	mul    %ebx
+    4d83:	c1 ea 05             	shr    $0x5,%edx
+    4d86:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4d89:	89 f2                	mov    %esi,%edx
+    4d8b:	29 ca                	sub    %ecx,%edx
+    4d8d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4d92:	89 d0                	mov    %edx,%eax
+    4d94:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4d96:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4d98:	c1 ea 03             	shr    $0x3,%edx
+    4d9b:	83 c2 30             	add    $0x30,%edx
+    4d9e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4da1:	f7 e1                	mul    %ecx
+    4da3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4da5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4da8:	c1 ea 03             	shr    $0x3,%edx
+    4dab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4dae:	01 d2                	add    %edx,%edx
+    4db0:	29 d0                	sub    %edx,%eax
+    4db2:	83 c0 30             	add    $0x30,%eax
+    4db5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4db8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4dbb:	50                   	push   %eax
+    4dbc:	e8 c2 03 00 00       	call   5183 <unlink>
+  while(nfiles >= 0){
+    4dc1:	83 c4 10             	add    $0x10,%esp
+    4dc4:	83 fe ff             	cmp    $0xffffffff,%esi
+    4dc7:	75 87                	jne    4d50 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4dc9:	83 ec 08             	sub    $0x8,%esp
+    4dcc:	68 0a 6e 00 00       	push   $0x6e0a
+    4dd1:	6a 01                	push   $0x1
+    4dd3:	e8 68 05 00 00       	call   5340 <printf>
+}
+    4dd8:	83 c4 10             	add    $0x10,%esp
+    4ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4dde:	5b                   	pop    %ebx
+    4ddf:	5e                   	pop    %esi
+    4de0:	5f                   	pop    %edi
+    4de1:	5d                   	pop    %ebp
+    4de2:	c3                   	ret
+    4de3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004df0 <uio>:
+{
+    4df0:	55                   	push   %ebp
+    4df1:	89 e5                	mov    %esp,%ebp
+    4df3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4df6:	68 20 6e 00 00       	push   $0x6e20
+    4dfb:	6a 01                	push   $0x1
+    4dfd:	e8 3e 05 00 00       	call   5340 <printf>
+  pid = fork();
+    4e02:	e8 24 03 00 00       	call   512b <fork>
+  if(pid == 0){
+    4e07:	83 c4 10             	add    $0x10,%esp
+    4e0a:	85 c0                	test   %eax,%eax
+    4e0c:	74 1b                	je     4e29 <uio+0x39>
+  } else if(pid < 0){
+    4e0e:	78 3d                	js     4e4d <uio+0x5d>
+  wait();
+    4e10:	e8 26 03 00 00       	call   513b <wait>
+  printf(1, "uio test done\n");
+    4e15:	83 ec 08             	sub    $0x8,%esp
+    4e18:	68 2a 6e 00 00       	push   $0x6e2a
+    4e1d:	6a 01                	push   $0x1
+    4e1f:	e8 1c 05 00 00       	call   5340 <printf>
+}
+    4e24:	83 c4 10             	add    $0x10,%esp
+    4e27:	c9                   	leave
+    4e28:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4e29:	b8 09 00 00 00       	mov    $0x9,%eax
+    4e2e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4e33:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4e34:	ba 71 00 00 00       	mov    $0x71,%edx
+    4e39:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    4e3a:	52                   	push   %edx
+    4e3b:	52                   	push   %edx
+    4e3c:	68 ec 78 00 00       	push   $0x78ec
+    4e41:	6a 01                	push   $0x1
+    4e43:	e8 f8 04 00 00       	call   5340 <printf>
+    exit();
+    4e48:	e8 e6 02 00 00       	call   5133 <exit>
+    printf (1, "fork failed\n");
+    4e4d:	50                   	push   %eax
+    4e4e:	50                   	push   %eax
+    4e4f:	68 af 6d 00 00       	push   $0x6daf
+    4e54:	6a 01                	push   $0x1
+    4e56:	e8 e5 04 00 00       	call   5340 <printf>
+    exit();
+    4e5b:	e8 d3 02 00 00       	call   5133 <exit>
+
+00004e60 <argptest>:
+{
+    4e60:	55                   	push   %ebp
+    4e61:	89 e5                	mov    %esp,%ebp
+    4e63:	53                   	push   %ebx
+    4e64:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4e67:	6a 00                	push   $0x0
+    4e69:	68 39 6e 00 00       	push   $0x6e39
+    4e6e:	e8 00 03 00 00       	call   5173 <open>
+  if (fd < 0) {
+    4e73:	83 c4 10             	add    $0x10,%esp
+    4e76:	85 c0                	test   %eax,%eax
+    4e78:	78 39                	js     4eb3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    4e7a:	83 ec 0c             	sub    $0xc,%esp
+    4e7d:	89 c3                	mov    %eax,%ebx
+    4e7f:	6a 00                	push   $0x0
+    4e81:	e8 35 03 00 00       	call   51bb <sbrk>
+    4e86:	83 c4 0c             	add    $0xc,%esp
+    4e89:	83 e8 01             	sub    $0x1,%eax
+    4e8c:	6a ff                	push   $0xffffffff
+    4e8e:	50                   	push   %eax
+    4e8f:	53                   	push   %ebx
+    4e90:	e8 b6 02 00 00       	call   514b <read>
+  close(fd);
+    4e95:	89 1c 24             	mov    %ebx,(%esp)
+    4e98:	e8 be 02 00 00       	call   515b <close>
+  printf(1, "arg test passed\n");
+    4e9d:	58                   	pop    %eax
+    4e9e:	5a                   	pop    %edx
+    4e9f:	68 4b 6e 00 00       	push   $0x6e4b
+    4ea4:	6a 01                	push   $0x1
+    4ea6:	e8 95 04 00 00       	call   5340 <printf>
+}
+    4eab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4eae:	83 c4 10             	add    $0x10,%esp
+    4eb1:	c9                   	leave
+    4eb2:	c3                   	ret
+    printf(2, "open failed\n");
+    4eb3:	51                   	push   %ecx
+    4eb4:	51                   	push   %ecx
+    4eb5:	68 3e 6e 00 00       	push   $0x6e3e
+    4eba:	6a 02                	push   $0x2
+    4ebc:	e8 7f 04 00 00       	call   5340 <printf>
+    exit();
+    4ec1:	e8 6d 02 00 00       	call   5133 <exit>
+    4ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004ed0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4ed0:	69 05 a4 87 00 00 0d 	imul   $0x19660d,0x87a4,%eax
+    4ed7:	66 19 00 
+    4eda:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    4edf:	a3 a4 87 00 00       	mov    %eax,0x87a4
+}
+    4ee4:	c3                   	ret
+    4ee5:	66 90                	xchg   %ax,%ax
+    4ee7:	66 90                	xchg   %ax,%ax
+    4ee9:	66 90                	xchg   %ax,%ax
+    4eeb:	66 90                	xchg   %ax,%ax
+    4eed:	66 90                	xchg   %ax,%ax
+    4eef:	90                   	nop
+
+00004ef0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    4ef0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4ef1:	31 c0                	xor    %eax,%eax
+{
+    4ef3:	89 e5                	mov    %esp,%ebp
+    4ef5:	53                   	push   %ebx
+    4ef6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4ef9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    4efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4f00:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4f04:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4f07:	83 c0 01             	add    $0x1,%eax
+    4f0a:	84 d2                	test   %dl,%dl
+    4f0c:	75 f2                	jne    4f00 <strcpy+0x10>
+    ;
+  return os;
+}
+    4f0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f11:	89 c8                	mov    %ecx,%eax
+    4f13:	c9                   	leave
+    4f14:	c3                   	ret
+    4f15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004f20 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4f20:	55                   	push   %ebp
+    4f21:	89 e5                	mov    %esp,%ebp
+    4f23:	53                   	push   %ebx
+    4f24:	8b 55 08             	mov    0x8(%ebp),%edx
+    4f27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    4f2a:	0f b6 02             	movzbl (%edx),%eax
+    4f2d:	84 c0                	test   %al,%al
+    4f2f:	75 17                	jne    4f48 <strcmp+0x28>
+    4f31:	eb 3a                	jmp    4f6d <strcmp+0x4d>
+    4f33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4f37:	90                   	nop
+    4f38:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    4f3c:	83 c2 01             	add    $0x1,%edx
+    4f3f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4f42:	84 c0                	test   %al,%al
+    4f44:	74 1a                	je     4f60 <strcmp+0x40>
+    p++, q++;
+    4f46:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4f48:	0f b6 19             	movzbl (%ecx),%ebx
+    4f4b:	38 c3                	cmp    %al,%bl
+    4f4d:	74 e9                	je     4f38 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    4f4f:	29 d8                	sub    %ebx,%eax
+}
+    4f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f54:	c9                   	leave
+    4f55:	c3                   	ret
+    4f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f5d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4f60:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4f64:	31 c0                	xor    %eax,%eax
+    4f66:	29 d8                	sub    %ebx,%eax
+}
+    4f68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f6b:	c9                   	leave
+    4f6c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    4f6d:	0f b6 19             	movzbl (%ecx),%ebx
+    4f70:	31 c0                	xor    %eax,%eax
+    4f72:	eb db                	jmp    4f4f <strcmp+0x2f>
+    4f74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4f7f:	90                   	nop
+
+00004f80 <strlen>:
+
+uint
+strlen(char *s)
+{
+    4f80:	55                   	push   %ebp
+    4f81:	89 e5                	mov    %esp,%ebp
+    4f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4f86:	80 3a 00             	cmpb   $0x0,(%edx)
+    4f89:	74 15                	je     4fa0 <strlen+0x20>
+    4f8b:	31 c0                	xor    %eax,%eax
+    4f8d:	8d 76 00             	lea    0x0(%esi),%esi
+    4f90:	83 c0 01             	add    $0x1,%eax
+    4f93:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4f97:	89 c1                	mov    %eax,%ecx
+    4f99:	75 f5                	jne    4f90 <strlen+0x10>
+    ;
+  return n;
+}
+    4f9b:	89 c8                	mov    %ecx,%eax
+    4f9d:	5d                   	pop    %ebp
+    4f9e:	c3                   	ret
+    4f9f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4fa0:	31 c9                	xor    %ecx,%ecx
+}
+    4fa2:	5d                   	pop    %ebp
+    4fa3:	89 c8                	mov    %ecx,%eax
+    4fa5:	c3                   	ret
+    4fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004fb0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4fb0:	55                   	push   %ebp
+    4fb1:	89 e5                	mov    %esp,%ebp
+    4fb3:	57                   	push   %edi
+    4fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4fb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4fba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4fbd:	89 d7                	mov    %edx,%edi
+    4fbf:	fc                   	cld
+    4fc0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4fc2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4fc5:	89 d0                	mov    %edx,%eax
+    4fc7:	c9                   	leave
+    4fc8:	c3                   	ret
+    4fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004fd0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4fd0:	55                   	push   %ebp
+    4fd1:	89 e5                	mov    %esp,%ebp
+    4fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+    4fd6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    4fda:	0f b6 10             	movzbl (%eax),%edx
+    4fdd:	84 d2                	test   %dl,%dl
+    4fdf:	75 12                	jne    4ff3 <strchr+0x23>
+    4fe1:	eb 1d                	jmp    5000 <strchr+0x30>
+    4fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4fe7:	90                   	nop
+    4fe8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    4fec:	83 c0 01             	add    $0x1,%eax
+    4fef:	84 d2                	test   %dl,%dl
+    4ff1:	74 0d                	je     5000 <strchr+0x30>
+    if(*s == c)
+    4ff3:	38 d1                	cmp    %dl,%cl
+    4ff5:	75 f1                	jne    4fe8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4ff7:	5d                   	pop    %ebp
+    4ff8:	c3                   	ret
+    4ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    5000:	31 c0                	xor    %eax,%eax
+}
+    5002:	5d                   	pop    %ebp
+    5003:	c3                   	ret
+    5004:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    500b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    500f:	90                   	nop
+
+00005010 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    5010:	55                   	push   %ebp
+    5011:	89 e5                	mov    %esp,%ebp
+    5013:	57                   	push   %edi
+    5014:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    5015:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    5018:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    5019:	31 db                	xor    %ebx,%ebx
+{
+    501b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    501e:	eb 27                	jmp    5047 <gets+0x37>
+    cc = read(0, &c, 1);
+    5020:	83 ec 04             	sub    $0x4,%esp
+    5023:	6a 01                	push   $0x1
+    5025:	56                   	push   %esi
+    5026:	6a 00                	push   $0x0
+    5028:	e8 1e 01 00 00       	call   514b <read>
+    if(cc < 1)
+    502d:	83 c4 10             	add    $0x10,%esp
+    5030:	85 c0                	test   %eax,%eax
+    5032:	7e 1d                	jle    5051 <gets+0x41>
+      break;
+    buf[i++] = c;
+    5034:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    5038:	8b 55 08             	mov    0x8(%ebp),%edx
+    503b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    503f:	3c 0a                	cmp    $0xa,%al
+    5041:	74 10                	je     5053 <gets+0x43>
+    5043:	3c 0d                	cmp    $0xd,%al
+    5045:	74 0c                	je     5053 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    5047:	89 df                	mov    %ebx,%edi
+    5049:	83 c3 01             	add    $0x1,%ebx
+    504c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    504f:	7c cf                	jl     5020 <gets+0x10>
+    5051:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    5053:	8b 45 08             	mov    0x8(%ebp),%eax
+    5056:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    505a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    505d:	5b                   	pop    %ebx
+    505e:	5e                   	pop    %esi
+    505f:	5f                   	pop    %edi
+    5060:	5d                   	pop    %ebp
+    5061:	c3                   	ret
+    5062:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005070 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    5070:	55                   	push   %ebp
+    5071:	89 e5                	mov    %esp,%ebp
+    5073:	56                   	push   %esi
+    5074:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    5075:	83 ec 08             	sub    $0x8,%esp
+    5078:	6a 00                	push   $0x0
+    507a:	ff 75 08             	push   0x8(%ebp)
+    507d:	e8 f1 00 00 00       	call   5173 <open>
+  if(fd < 0)
+    5082:	83 c4 10             	add    $0x10,%esp
+    5085:	85 c0                	test   %eax,%eax
+    5087:	78 27                	js     50b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    5089:	83 ec 08             	sub    $0x8,%esp
+    508c:	ff 75 0c             	push   0xc(%ebp)
+    508f:	89 c3                	mov    %eax,%ebx
+    5091:	50                   	push   %eax
+    5092:	e8 f4 00 00 00       	call   518b <fstat>
+  close(fd);
+    5097:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    509a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    509c:	e8 ba 00 00 00       	call   515b <close>
+  return r;
+    50a1:	83 c4 10             	add    $0x10,%esp
+}
+    50a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    50a7:	89 f0                	mov    %esi,%eax
+    50a9:	5b                   	pop    %ebx
+    50aa:	5e                   	pop    %esi
+    50ab:	5d                   	pop    %ebp
+    50ac:	c3                   	ret
+    50ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    50b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    50b5:	eb ed                	jmp    50a4 <stat+0x34>
+    50b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    50be:	66 90                	xchg   %ax,%ax
+
+000050c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    50c0:	55                   	push   %ebp
+    50c1:	89 e5                	mov    %esp,%ebp
+    50c3:	53                   	push   %ebx
+    50c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    50c7:	0f be 02             	movsbl (%edx),%eax
+    50ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    50cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    50d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    50d5:	77 1e                	ja     50f5 <atoi+0x35>
+    50d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    50de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    50e0:	83 c2 01             	add    $0x1,%edx
+    50e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    50e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    50ea:	0f be 02             	movsbl (%edx),%eax
+    50ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    50f0:	80 fb 09             	cmp    $0x9,%bl
+    50f3:	76 eb                	jbe    50e0 <atoi+0x20>
+  return n;
+}
+    50f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    50f8:	89 c8                	mov    %ecx,%eax
+    50fa:	c9                   	leave
+    50fb:	c3                   	ret
+    50fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005100 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    5100:	55                   	push   %ebp
+    5101:	89 e5                	mov    %esp,%ebp
+    5103:	57                   	push   %edi
+    5104:	56                   	push   %esi
+    5105:	8b 45 10             	mov    0x10(%ebp),%eax
+    5108:	8b 55 08             	mov    0x8(%ebp),%edx
+    510b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    510e:	85 c0                	test   %eax,%eax
+    5110:	7e 13                	jle    5125 <memmove+0x25>
+    5112:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    5114:	89 d7                	mov    %edx,%edi
+    5116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    511d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    5120:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    5121:	39 f8                	cmp    %edi,%eax
+    5123:	75 fb                	jne    5120 <memmove+0x20>
+  return vdst;
+}
+    5125:	5e                   	pop    %esi
+    5126:	89 d0                	mov    %edx,%eax
+    5128:	5f                   	pop    %edi
+    5129:	5d                   	pop    %ebp
+    512a:	c3                   	ret
+
+0000512b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    512b:	b8 01 00 00 00       	mov    $0x1,%eax
+    5130:	cd 40                	int    $0x40
+    5132:	c3                   	ret
+
+00005133 <exit>:
+SYSCALL(exit)
+    5133:	b8 02 00 00 00       	mov    $0x2,%eax
+    5138:	cd 40                	int    $0x40
+    513a:	c3                   	ret
+
+0000513b <wait>:
+SYSCALL(wait)
+    513b:	b8 03 00 00 00       	mov    $0x3,%eax
+    5140:	cd 40                	int    $0x40
+    5142:	c3                   	ret
+
+00005143 <pipe>:
+SYSCALL(pipe)
+    5143:	b8 04 00 00 00       	mov    $0x4,%eax
+    5148:	cd 40                	int    $0x40
+    514a:	c3                   	ret
+
+0000514b <read>:
+SYSCALL(read)
+    514b:	b8 05 00 00 00       	mov    $0x5,%eax
+    5150:	cd 40                	int    $0x40
+    5152:	c3                   	ret
+
+00005153 <write>:
+SYSCALL(write)
+    5153:	b8 10 00 00 00       	mov    $0x10,%eax
+    5158:	cd 40                	int    $0x40
+    515a:	c3                   	ret
+
+0000515b <close>:
+SYSCALL(close)
+    515b:	b8 15 00 00 00       	mov    $0x15,%eax
+    5160:	cd 40                	int    $0x40
+    5162:	c3                   	ret
+
+00005163 <kill>:
+SYSCALL(kill)
+    5163:	b8 06 00 00 00       	mov    $0x6,%eax
+    5168:	cd 40                	int    $0x40
+    516a:	c3                   	ret
+
+0000516b <exec>:
+SYSCALL(exec)
+    516b:	b8 07 00 00 00       	mov    $0x7,%eax
+    5170:	cd 40                	int    $0x40
+    5172:	c3                   	ret
+
+00005173 <open>:
+SYSCALL(open)
+    5173:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5178:	cd 40                	int    $0x40
+    517a:	c3                   	ret
+
+0000517b <mknod>:
+SYSCALL(mknod)
+    517b:	b8 11 00 00 00       	mov    $0x11,%eax
+    5180:	cd 40                	int    $0x40
+    5182:	c3                   	ret
+
+00005183 <unlink>:
+SYSCALL(unlink)
+    5183:	b8 12 00 00 00       	mov    $0x12,%eax
+    5188:	cd 40                	int    $0x40
+    518a:	c3                   	ret
+
+0000518b <fstat>:
+SYSCALL(fstat)
+    518b:	b8 08 00 00 00       	mov    $0x8,%eax
+    5190:	cd 40                	int    $0x40
+    5192:	c3                   	ret
+
+00005193 <link>:
+SYSCALL(link)
+    5193:	b8 13 00 00 00       	mov    $0x13,%eax
+    5198:	cd 40                	int    $0x40
+    519a:	c3                   	ret
+
+0000519b <mkdir>:
+SYSCALL(mkdir)
+    519b:	b8 14 00 00 00       	mov    $0x14,%eax
+    51a0:	cd 40                	int    $0x40
+    51a2:	c3                   	ret
+
+000051a3 <chdir>:
+SYSCALL(chdir)
+    51a3:	b8 09 00 00 00       	mov    $0x9,%eax
+    51a8:	cd 40                	int    $0x40
+    51aa:	c3                   	ret
+
+000051ab <dup>:
+SYSCALL(dup)
+    51ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+    51b0:	cd 40                	int    $0x40
+    51b2:	c3                   	ret
+
+000051b3 <getpid>:
+SYSCALL(getpid)
+    51b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    51b8:	cd 40                	int    $0x40
+    51ba:	c3                   	ret
+
+000051bb <sbrk>:
+SYSCALL(sbrk)
+    51bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    51c0:	cd 40                	int    $0x40
+    51c2:	c3                   	ret
+
+000051c3 <sleep>:
+SYSCALL(sleep)
+    51c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    51c8:	cd 40                	int    $0x40
+    51ca:	c3                   	ret
+
+000051cb <uptime>:
+SYSCALL(uptime)
+    51cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    51d0:	cd 40                	int    $0x40
+    51d2:	c3                   	ret
+
+000051d3 <add_dir>:
+SYSCALL(add_dir)
+    51d3:	b8 16 00 00 00       	mov    $0x16,%eax
+    51d8:	cd 40                	int    $0x40
+    51da:	c3                   	ret
+
+000051db <history>:
+SYSCALL(history)
+    51db:	b8 18 00 00 00       	mov    $0x18,%eax
+    51e0:	cd 40                	int    $0x40
+    51e2:	c3                   	ret
+
+000051e3 <clock_gettime>:
+SYSCALL(clock_gettime)
+    51e3:	b8 19 00 00 00       	mov    $0x19,%eax
+    51e8:	cd 40                	int    $0x40
+    51ea:	c3                   	ret
+
+000051eb <nanosleep>:
+SYSCALL(nanosleep)
+    51eb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    51f0:	cd 40                	int    $0x40
+    51f2:	c3                   	ret
+
+000051f3 <clone>:
+SYSCALL(clone)
+    51f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    51f8:	cd 40                	int    $0x40
+    51fa:	c3                   	ret
+
+000051fb <join>:
+SYSCALL(join)
+    51fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    5200:	cd 40                	int    $0x40
+    5202:	c3                   	ret
+
+00005203 <futex_wait>:
+SYSCALL(futex_wait)
+    5203:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    5208:	cd 40                	int    $0x40
+    520a:	c3                   	ret
+
+0000520b <futex_wake>:
+SYSCALL(futex_wake)
+    520b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    5210:	cd 40                	int    $0x40
+    5212:	c3                   	ret
+
+00005213 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    5213:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    5218:	cd 40                	int    $0x40
+    521a:	c3                   	ret
+
+0000521b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    521b:	b8 20 00 00 00       	mov    $0x20,%eax
+    5220:	cd 40                	int    $0x40
+    5222:	c3                   	ret
+
+00005223 <sched_isolate>:
+SYSCALL(sched_isolate)
+    5223:	b8 21 00 00 00       	mov    $0x21,%eax
+    5228:	cd 40                	int    $0x40
+    522a:	c3                   	ret
+
+0000522b <getprocinfo>:
+SYSCALL(getprocinfo)
+    522b:	b8 22 00 00 00       	mov    $0x22,%eax
+    5230:	cd 40                	int    $0x40
+    5232:	c3                   	ret
+
+00005233 <waitpid>:
+SYSCALL(waitpid)
+    5233:	b8 23 00 00 00       	mov    $0x23,%eax
+    5238:	cd 40                	int    $0x40
+    523a:	c3                   	ret
+
+0000523b <tracectl>:
+SYSCALL(tracectl)
+    523b:	b8 24 00 00 00       	mov    $0x24,%eax
+    5240:	cd 40                	int    $0x40
+    5242:	c3                   	ret
+
+00005243 <traceread>:
+SYSCALL(traceread)
+    5243:	b8 25 00 00 00       	mov    $0x25,%eax
+    5248:	cd 40                	int    $0x40
+    524a:	c3                   	ret
+
+0000524b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+    524b:	b8 26 00 00 00       	mov    $0x26,%eax
+    5250:	cd 40                	int    $0x40
+    5252:	c3                   	ret
+
+00005253 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+    5253:	b8 27 00 00 00       	mov    $0x27,%eax
+    5258:	cd 40                	int    $0x40
+    525a:	c3                   	ret
+
+0000525b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+    525b:	b8 28 00 00 00       	mov    $0x28,%eax
+    5260:	cd 40                	int    $0x40
+    5262:	c3                   	ret
+
+00005263 <irqroute>:
+SYSCALL(irqroute)
+    5263:	b8 29 00 00 00       	mov    $0x29,%eax
+    5268:	cd 40                	int    $0x40
+    526a:	c3                   	ret
+
+0000526b <irqstat>:
+SYSCALL(irqstat)
+    526b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    5270:	cd 40                	int    $0x40
+    5272:	c3                   	ret
+
+00005273 <boottimes>:
+SYSCALL(boottimes)
+    5273:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    5278:	cd 40                	int    $0x40
+    527a:	c3                   	ret
+
+0000527b <lockbench>:
+SYSCALL(lockbench)
+    527b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    5280:	cd 40                	int    $0x40
+    5282:	c3                   	ret
+
+00005283 <lockstat>:
+SYSCALL(lockstat)
+    5283:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    5288:	cd 40                	int    $0x40
+    528a:	c3                   	ret
+
+0000528b <cpustat>:
+SYSCALL(cpustat)
+    528b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    5290:	cd 40                	int    $0x40
+    5292:	c3                   	ret
+
+00005293 <bcachesize>:
+SYSCALL(bcachesize)
+    5293:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    5298:	cd 40                	int    $0x40
+    529a:	c3                   	ret
+    529b:	66 90                	xchg   %ax,%ax
+    529d:	66 90                	xchg   %ax,%ax
+    529f:	90                   	nop
+
+000052a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    52a0:	55                   	push   %ebp
+    52a1:	89 e5                	mov    %esp,%ebp
+    52a3:	57                   	push   %edi
+    52a4:	56                   	push   %esi
+    52a5:	53                   	push   %ebx
+    52a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    52a8:	89 d1                	mov    %edx,%ecx
+{
+    52aa:	83 ec 3c             	sub    $0x3c,%esp
+    52ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    52b0:	85 d2                	test   %edx,%edx
+    52b2:	0f 89 80 00 00 00    	jns    5338 <printint+0x98>
+    52b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    52bc:	74 7a                	je     5338 <printint+0x98>
+    x = -xx;
+    52be:	f7 d9                	neg    %ecx
+    neg = 1;
+    52c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    52c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    52c8:	31 f6                	xor    %esi,%esi
+    52ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    52d0:	89 c8                	mov    %ecx,%eax
+    52d2:	31 d2                	xor    %edx,%edx
+    52d4:	89 f7                	mov    %esi,%edi
+    52d6:	f7 f3                	div    %ebx
+    52d8:	8d 76 01             	lea    0x1(%esi),%esi
+    52db:	0f b6 92 9c 79 00 00 	movzbl 0x799c(%edx),%edx
+    52e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    52e6:	89 ca                	mov    %ecx,%edx
+    52e8:	89 c1                	mov    %eax,%ecx
+    52ea:	39 da                	cmp    %ebx,%edx
+    52ec:	73 e2                	jae    52d0 <printint+0x30>
+  if(neg)
+    52ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    52f1:	85 c0                	test   %eax,%eax
+    52f3:	74 07                	je     52fc <printint+0x5c>
+    buf[i++] = '-';
+    52f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    52fa:	89 f7                	mov    %esi,%edi
+    52fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    52ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    5302:	01 df                	add    %ebx,%edi
+    5304:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    5308:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    530b:	83 ec 04             	sub    $0x4,%esp
+    530e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    5311:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    5314:	6a 01                	push   $0x1
+    5316:	50                   	push   %eax
+    5317:	56                   	push   %esi
+    5318:	e8 36 fe ff ff       	call   5153 <write>
+  while(--i >= 0)
+    531d:	89 f8                	mov    %edi,%eax
+    531f:	83 c4 10             	add    $0x10,%esp
+    5322:	83 ef 01             	sub    $0x1,%edi
+    5325:	39 d8                	cmp    %ebx,%eax
+    5327:	75 df                	jne    5308 <printint+0x68>
+}
+    5329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    532c:	5b                   	pop    %ebx
+    532d:	5e                   	pop    %esi
+    532e:	5f                   	pop    %edi
+    532f:	5d                   	pop    %ebp
+    5330:	c3                   	ret
+    5331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    5338:	31 c0                	xor    %eax,%eax
+    533a:	eb 89                	jmp    52c5 <printint+0x25>
+    533c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005340 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    5340:	55                   	push   %ebp
+    5341:	89 e5                	mov    %esp,%ebp
+    5343:	57                   	push   %edi
+    5344:	56                   	push   %esi
+    5345:	53                   	push   %ebx
+    5346:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    5349:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    534c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    534f:	0f b6 1e             	movzbl (%esi),%ebx
+    5352:	83 c6 01             	add    $0x1,%esi
+    5355:	84 db                	test   %bl,%bl
+    5357:	74 67                	je     53c0 <printf+0x80>
+    5359:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    535c:	31 d2                	xor    %edx,%edx
+    535e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    5361:	eb 34                	jmp    5397 <printf+0x57>
+    5363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5367:	90                   	nop
+    5368:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    536b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    5370:	83 f8 25             	cmp    $0x25,%eax
+    5373:	74 18                	je     538d <printf+0x4d>
+  write(fd, &c, 1);
+    5375:	83 ec 04             	sub    $0x4,%esp
+    5378:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    537b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    537e:	6a 01                	push   $0x1
+    5380:	50                   	push   %eax
+    5381:	57                   	push   %edi
+    5382:	e8 cc fd ff ff       	call   5153 <write>
+    5387:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    538a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    538d:	0f b6 1e             	movzbl (%esi),%ebx
+    5390:	83 c6 01             	add    $0x1,%esi
+    5393:	84 db                	test   %bl,%bl
+    5395:	74 29                	je     53c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    5397:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    539a:	85 d2                	test   %edx,%edx
+    539c:	74 ca                	je     5368 <printf+0x28>
+      }
+    } else if(state == '%'){
+    539e:	83 fa 25             	cmp    $0x25,%edx
+    53a1:	75 ea                	jne    538d <printf+0x4d>
+      if(c == 'd'){
+    53a3:	83 f8 25             	cmp    $0x25,%eax
+    53a6:	0f 84 24 01 00 00    	je     54d0 <printf+0x190>
+    53ac:	83 e8 63             	sub    $0x63,%eax
+    53af:	83 f8 15             	cmp    $0x15,%eax
+    53b2:	77 1c                	ja     53d0 <printf+0x90>
+    53b4:	ff 24 85 44 79 00 00 	jmp    *0x7944(,%eax,4)
+    53bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    53bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    53c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    53c3:	5b                   	pop    %ebx
+    53c4:	5e                   	pop    %esi
+    53c5:	5f                   	pop    %edi
+    53c6:	5d                   	pop    %ebp
+    53c7:	c3                   	ret
+    53c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    53cf:	90                   	nop
+  write(fd, &c, 1);
+    53d0:	83 ec 04             	sub    $0x4,%esp
+    53d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    53d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    53da:	6a 01                	push   $0x1
+    53dc:	52                   	push   %edx
+    53dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    53e0:	57                   	push   %edi
+    53e1:	e8 6d fd ff ff       	call   5153 <write>
+    53e6:	83 c4 0c             	add    $0xc,%esp
+    53e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    53ec:	6a 01                	push   $0x1
+    53ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    53f1:	52                   	push   %edx
+    53f2:	57                   	push   %edi
+    53f3:	e8 5b fd ff ff       	call   5153 <write>
+        putc(fd, c);
+    53f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    53fb:	31 d2                	xor    %edx,%edx
+    53fd:	eb 8e                	jmp    538d <printf+0x4d>
+    53ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    5400:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5403:	83 ec 0c             	sub    $0xc,%esp
+    5406:	b9 10 00 00 00       	mov    $0x10,%ecx
+    540b:	8b 13                	mov    (%ebx),%edx
+    540d:	6a 00                	push   $0x0
+    540f:	89 f8                	mov    %edi,%eax
+        ap++;
+    5411:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    5414:	e8 87 fe ff ff       	call   52a0 <printint>
+        ap++;
+    5419:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    541c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    541f:	31 d2                	xor    %edx,%edx
+    5421:	e9 67 ff ff ff       	jmp    538d <printf+0x4d>
+    5426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    542d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    5430:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5433:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    5435:	83 c0 04             	add    $0x4,%eax
+    5438:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    543b:	85 db                	test   %ebx,%ebx
+    543d:	0f 84 9d 00 00 00    	je     54e0 <printf+0x1a0>
+        while(*s != 0){
+    5443:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    5446:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    5448:	84 c0                	test   %al,%al
+    544a:	0f 84 3d ff ff ff    	je     538d <printf+0x4d>
+    5450:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    5453:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    5456:	89 de                	mov    %ebx,%esi
+    5458:	89 d3                	mov    %edx,%ebx
+    545a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    5460:	83 ec 04             	sub    $0x4,%esp
+    5463:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    5466:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    5469:	6a 01                	push   $0x1
+    546b:	53                   	push   %ebx
+    546c:	57                   	push   %edi
+    546d:	e8 e1 fc ff ff       	call   5153 <write>
+        while(*s != 0){
+    5472:	0f b6 06             	movzbl (%esi),%eax
+    5475:	83 c4 10             	add    $0x10,%esp
+    5478:	84 c0                	test   %al,%al
+    547a:	75 e4                	jne    5460 <printf+0x120>
+      state = 0;
+    547c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    547f:	31 d2                	xor    %edx,%edx
+    5481:	e9 07 ff ff ff       	jmp    538d <printf+0x4d>
+    5486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    548d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    5490:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5493:	83 ec 0c             	sub    $0xc,%esp
+    5496:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    549b:	8b 13                	mov    (%ebx),%edx
+    549d:	6a 01                	push   $0x1
+    549f:	e9 6b ff ff ff       	jmp    540f <printf+0xcf>
+    54a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    54a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    54ab:	83 ec 04             	sub    $0x4,%esp
+    54ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    54b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    54b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    54b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    54b9:	6a 01                	push   $0x1
+    54bb:	52                   	push   %edx
+    54bc:	57                   	push   %edi
+    54bd:	e8 91 fc ff ff       	call   5153 <write>
+        ap++;
+    54c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    54c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    54c8:	31 d2                	xor    %edx,%edx
+    54ca:	e9 be fe ff ff       	jmp    538d <printf+0x4d>
+    54cf:	90                   	nop
+  write(fd, &c, 1);
+    54d0:	83 ec 04             	sub    $0x4,%esp
+    54d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    54d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    54d9:	6a 01                	push   $0x1
+    54db:	e9 11 ff ff ff       	jmp    53f1 <printf+0xb1>
+    54e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    54e5:	bb 3a 79 00 00       	mov    $0x793a,%ebx
+    54ea:	e9 61 ff ff ff       	jmp    5450 <printf+0x110>
+    54ef:	90                   	nop
+
+000054f0 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+    54f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    54f1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    54f4:	89 e5                	mov    %esp,%ebp
+    54f6:	57                   	push   %edi
+    54f7:	56                   	push   %esi
+    54f8:	53                   	push   %ebx
+    54f9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    54fb:	a1 c4 b6 04 00       	mov    0x4b6c4,%eax
+    5500:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5502:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5504:	39 ca                	cmp    %ecx,%edx
+    5506:	73 30                	jae    5538 <ufree+0x48>
+    5508:	39 c1                	cmp    %eax,%ecx
+    550a:	72 04                	jb     5510 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    550c:	39 c2                	cmp    %eax,%edx
+    550e:	72 f0                	jb     5500 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    5510:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    5513:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    5516:	39 f8                	cmp    %edi,%eax
+    5518:	74 26                	je     5540 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    551a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    551d:	8b 42 04             	mov    0x4(%edx),%eax
+    5520:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    5523:	39 f1                	cmp    %esi,%ecx
+    5525:	74 30                	je     5557 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    5527:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    5529:	5b                   	pop    %ebx
+  freep = p;
+    552a:	89 15 c4 b6 04 00    	mov    %edx,0x4b6c4
+}
+    5530:	5e                   	pop    %esi
+    5531:	5f                   	pop    %edi
+    5532:	5d                   	pop    %ebp
+    5533:	c3                   	ret
+    5534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5538:	39 c1                	cmp    %eax,%ecx
+    553a:	72 d0                	jb     550c <ufree+0x1c>
+    553c:	eb c2                	jmp    5500 <ufree+0x10>
+    553e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    5540:	03 70 04             	add    0x4(%eax),%esi
+    5543:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5546:	8b 02                	mov    (%edx),%eax
+    5548:	8b 00                	mov    (%eax),%eax
+    554a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    554d:	8b 42 04             	mov    0x4(%edx),%eax
+    5550:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    5553:	39 f1                	cmp    %esi,%ecx
+    5555:	75 d0                	jne    5527 <ufree+0x37>
+    p->s.size += bp->s.size;
+    5557:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    555a:	89 15 c4 b6 04 00    	mov    %edx,0x4b6c4
+    p->s.size += bp->s.size;
+    5560:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    5563:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    5566:	89 0a                	mov    %ecx,(%edx)
+}
+    5568:	5b                   	pop    %ebx
+    5569:	5e                   	pop    %esi
+    556a:	5f                   	pop    %edi
+    556b:	5d                   	pop    %ebp
+    556c:	c3                   	ret
+    556d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005570 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+    5570:	55                   	push   %ebp
+    5571:	89 e5                	mov    %esp,%ebp
+    5573:	53                   	push   %ebx
+    5574:	83 ec 10             	sub    $0x10,%esp
+    5577:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+    557a:	68 c0 b6 04 00       	push   $0x4b6c0
+    557f:	e8 ec 01 00 00       	call   5770 <lock_acquire>
+  ufree(ap);
+    5584:	89 d8                	mov    %ebx,%eax
+    5586:	e8 65 ff ff ff       	call   54f0 <ufree>
+  lock_release(&mlock);
+    558b:	c7 45 08 c0 b6 04 00 	movl   $0x4b6c0,0x8(%ebp)
+}
+    5592:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+    5595:	83 c4 10             	add    $0x10,%esp
+}
+    5598:	c9                   	leave
+  lock_release(&mlock);
+    5599:	e9 f2 01 00 00       	jmp    5790 <lock_release>
+    559e:	66 90                	xchg   %ax,%ax
+
+000055a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    55a0:	55                   	push   %ebp
+    55a1:	89 e5                	mov    %esp,%ebp
+    55a3:	57                   	push   %edi
+    55a4:	56                   	push   %esi
+    55a5:	53                   	push   %ebx
+    55a6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    55a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+    55ac:	68 c0 b6 04 00       	push   $0x4b6c0
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    55b1:	8d 48 07             	lea    0x7(%eax),%ecx
+    55b4:	c1 e9 03             	shr    $0x3,%ecx
+    55b7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+    55ba:	e8 b1 01 00 00       	call   5770 <lock_acquire>
+  if((prevp = freep) == 0){
+    55bf:	8b 15 c4 b6 04 00    	mov    0x4b6c4,%edx
+    55c5:	83 c4 10             	add    $0x10,%esp
+    55c8:	85 d2                	test   %edx,%edx
+    55ca:	0f 84 b0 00 00 00    	je     5680 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    55d0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    55d2:	8b 47 04             	mov    0x4(%edi),%eax
+    55d5:	39 f0                	cmp    %esi,%eax
+    55d7:	73 6f                	jae    5648 <malloc+0xa8>
+  if(nu < 4096)
+    55d9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    55de:	39 de                	cmp    %ebx,%esi
+    55e0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    55e3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    55ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    55ed:	eb 0a                	jmp    55f9 <malloc+0x59>
+    55ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    55f0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    55f2:	8b 47 04             	mov    0x4(%edi),%eax
+    55f5:	39 f0                	cmp    %esi,%eax
+    55f7:	73 4f                	jae    5648 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    55f9:	89 fa                	mov    %edi,%edx
+    55fb:	39 3d c4 b6 04 00    	cmp    %edi,0x4b6c4
+    5601:	75 ed                	jne    55f0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    5603:	83 ec 0c             	sub    $0xc,%esp
+    5606:	ff 75 e4             	push   -0x1c(%ebp)
+    5609:	e8 ad fb ff ff       	call   51bb <sbrk>
+  if(p == (char*)-1)
+    560e:	83 c4 10             	add    $0x10,%esp
+    5611:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5614:	74 15                	je     562b <malloc+0x8b>
+  hp->s.size = nu;
+    5616:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+    5619:	83 c0 08             	add    $0x8,%eax
+    561c:	e8 cf fe ff ff       	call   54f0 <ufree>
+  return freep;
+    5621:	8b 15 c4 b6 04 00    	mov    0x4b6c4,%edx
+      if((p = morecore(nunits)) == 0){
+    5627:	85 d2                	test   %edx,%edx
+    5629:	75 c5                	jne    55f0 <malloc+0x50>
+        lock_release(&mlock);
+    562b:	83 ec 0c             	sub    $0xc,%esp
+    562e:	68 c0 b6 04 00       	push   $0x4b6c0
+    5633:	e8 58 01 00 00       	call   5790 <lock_release>
+        return 0;
+    5638:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    563b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    563e:	31 c0                	xor    %eax,%eax
+}
+    5640:	5b                   	pop    %ebx
+    5641:	5e                   	pop    %esi
+    5642:	5f                   	pop    %edi
+    5643:	5d                   	pop    %ebp
+    5644:	c3                   	ret
+    5645:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    5648:	39 c6                	cmp    %eax,%esi
+    564a:	74 64                	je     56b0 <malloc+0x110>
+        p->s.size -= nunits;
+    564c:	29 f0                	sub    %esi,%eax
+    564e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    5651:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    5654:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+    5657:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    565a:	89 15 c4 b6 04 00    	mov    %edx,0x4b6c4
+      lock_release(&mlock);
+    5660:	68 c0 b6 04 00       	push   $0x4b6c0
+    5665:	e8 26 01 00 00       	call   5790 <lock_release>
+      return (void*)(p + 1);
+    566a:	83 c4 10             	add    $0x10,%esp
+}
+    566d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    5670:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    5673:	5b                   	pop    %ebx
+    5674:	5e                   	pop    %esi
+    5675:	5f                   	pop    %edi
+    5676:	5d                   	pop    %ebp
+    5677:	c3                   	ret
+    5678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    567f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    5680:	c7 05 c4 b6 04 00 c8 	movl   $0x4b6c8,0x4b6c4
+    5687:	b6 04 00 
+    base.s.size = 0;
+    568a:	bf c8 b6 04 00       	mov    $0x4b6c8,%edi
+    base.s.ptr = freep = prevp = &base;
+    568f:	c7 05 c8 b6 04 00 c8 	movl   $0x4b6c8,0x4b6c8
+    5696:	b6 04 00 
+    base.s.size = 0;
+    5699:	c7 05 cc b6 04 00 00 	movl   $0x0,0x4b6cc
+    56a0:	00 00 00 
+    if(p->s.size >= nunits){
+    56a3:	e9 31 ff ff ff       	jmp    55d9 <malloc+0x39>
+    56a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    56af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    56b0:	8b 07                	mov    (%edi),%eax
+    56b2:	89 02                	mov    %eax,(%edx)
+    56b4:	eb a1                	jmp    5657 <malloc+0xb7>
+    56b6:	66 90                	xchg   %ax,%ax
+    56b8:	66 90                	xchg   %ax,%ax
+    56ba:	66 90                	xchg   %ax,%ax
+    56bc:	66 90                	xchg   %ax,%ax
+    56be:	66 90                	xchg   %ax,%ax
+
+000056c0 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    56c0:	55                   	push   %ebp
+    56c1:	89 e5                	mov    %esp,%ebp
+    56c3:	53                   	push   %ebx
+    56c4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+    56c7:	68 00 10 00 00       	push   $0x1000
+    56cc:	e8 cf fe ff ff       	call   55a0 <malloc>
+    56d1:	83 c4 10             	add    $0x10,%esp
+    56d4:	85 c0                	test   %eax,%eax
+    56d6:	74 37                	je     570f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+    56d8:	83 ec 04             	sub    $0x4,%esp
+    56db:	89 c3                	mov    %eax,%ebx
+    56dd:	50                   	push   %eax
+    56de:	ff 75 0c             	push   0xc(%ebp)
+    56e1:	ff 75 08             	push   0x8(%ebp)
+    56e4:	e8 0a fb ff ff       	call   51f3 <clone>
+    56e9:	83 c4 10             	add    $0x10,%esp
+    56ec:	85 c0                	test   %eax,%eax
+    56ee:	78 08                	js     56f8 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+    56f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    56f3:	c9                   	leave
+    56f4:	c3                   	ret
+    56f5:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+    56f8:	83 ec 0c             	sub    $0xc,%esp
+    56fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    56fe:	53                   	push   %ebx
+    56ff:	e8 6c fe ff ff       	call   5570 <free>
+    5704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    5707:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+    570a:	83 c4 10             	add    $0x10,%esp
+}
+    570d:	c9                   	leave
+    570e:	c3                   	ret
+    return -1;
+    570f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    5714:	eb da                	jmp    56f0 <thread_create+0x30>
+    5716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    571d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005720 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    5720:	55                   	push   %ebp
+    5721:	89 e5                	mov    %esp,%ebp
+    5723:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    5726:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    5729:	50                   	push   %eax
+    572a:	e8 cc fa ff ff       	call   51fb <join>
+    572f:	83 c4 10             	add    $0x10,%esp
+    5732:	85 c0                	test   %eax,%eax
+    5734:	79 0a                	jns    5740 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+    5736:	c9                   	leave
+    5737:	c3                   	ret
+    5738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    573f:	90                   	nop
+    5740:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+    5743:	83 ec 0c             	sub    $0xc,%esp
+    5746:	ff 75 f4             	push   -0xc(%ebp)
+    5749:	e8 22 fe ff ff       	call   5570 <free>
+    574e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5751:	83 c4 10             	add    $0x10,%esp
+}
+    5754:	c9                   	leave
+    5755:	c3                   	ret
+    5756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    575d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005760 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+    5760:	55                   	push   %ebp
+    5761:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    5763:	8b 45 08             	mov    0x8(%ebp),%eax
+    5766:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    576c:	5d                   	pop    %ebp
+    576d:	c3                   	ret
+    576e:	66 90                	xchg   %ax,%ax
+
+00005770 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+    5770:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    5771:	b9 01 00 00 00       	mov    $0x1,%ecx
+    5776:	89 e5                	mov    %esp,%ebp
+    5778:	8b 55 08             	mov    0x8(%ebp),%edx
+    577b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    577f:	90                   	nop
+    5780:	89 c8                	mov    %ecx,%eax
+    5782:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    5785:	85 c0                	test   %eax,%eax
+    5787:	75 f7                	jne    5780 <lock_acquire+0x10>
+    ;
+}
+    5789:	5d                   	pop    %ebp
+    578a:	c3                   	ret
+    578b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    578f:	90                   	nop
+
+00005790 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+    5790:	55                   	push   %ebp
+    5791:	31 c0                	xor    %eax,%eax
+    5793:	89 e5                	mov    %esp,%ebp
+    5795:	8b 55 08             	mov    0x8(%ebp),%edx
+    5798:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    579b:	5d                   	pop    %ebp
+    579c:	c3                   	ret
+    579d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000057a0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+    57a0:	55                   	push   %ebp
+    57a1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+    57a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    57a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    57ac:	5d                   	pop    %ebp
+    57ad:	c3                   	ret
+    57ae:	66 90                	xchg   %ax,%ax
+
+000057b0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    57b0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+    57b1:	31 c0                	xor    %eax,%eax
+    57b3:	ba 01 00 00 00       	mov    $0x1,%edx
+    57b8:	89 e5                	mov    %esp,%ebp
+    57ba:	56                   	push   %esi
+    57bb:	53                   	push   %ebx
+    57bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    57bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+    57c3:	85 c0                	test   %eax,%eax
+    57c5:	74 30                	je     57f7 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+    57c7:	83 f8 02             	cmp    $0x2,%eax
+    57ca:	74 0c                	je     57d8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+    57cc:	b8 02 00 00 00       	mov    $0x2,%eax
+    57d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+    57d4:	85 c0                	test   %eax,%eax
+    57d6:	74 1f                	je     57f7 <mutex_lock+0x47>
+    57d8:	be 02 00 00 00       	mov    $0x2,%esi
+    57dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+    57e0:	83 ec 08             	sub    $0x8,%esp
+    57e3:	6a 02                	push   $0x2
+    57e5:	53                   	push   %ebx
+    57e6:	e8 18 fa ff ff       	call   5203 <futex_wait>
+    57eb:	89 f0                	mov    %esi,%eax
+    57ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    57f0:	83 c4 10             	add    $0x10,%esp
+    57f3:	85 c0                	test   %eax,%eax
+    57f5:	75 e9                	jne    57e0 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+    57f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    57fa:	5b                   	pop    %ebx
+    57fb:	5e                   	pop    %esi
+    57fc:	5d                   	pop    %ebp
+    57fd:	c3                   	ret
+    57fe:	66 90                	xchg   %ax,%ax
+
+00005800 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    5800:	55                   	push   %ebp
+    5801:	31 c0                	xor    %eax,%eax
+    5803:	89 e5                	mov    %esp,%ebp
+    5805:	83 ec 08             	sub    $0x8,%esp
+    5808:	8b 55 08             	mov    0x8(%ebp),%edx
+    580b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+    580e:	83 f8 02             	cmp    $0x2,%eax
+    5811:	74 05                	je     5818 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+    5813:	c9                   	leave
+    5814:	c3                   	ret
+    5815:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+    5818:	83 ec 08             	sub    $0x8,%esp
+    581b:	6a 01                	push   $0x1
+    581d:	52                   	push   %edx
+    581e:	e8 e8 f9 ff ff       	call   520b <futex_wake>
+    5823:	83 c4 10             	add    $0x10,%esp
+}
+    5826:	c9                   	leave
+    5827:	c3                   	ret
+    5828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    582f:	90                   	nop
+
+00005830 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    5830:	55                   	push   %ebp
+    5831:	89 e5                	mov    %esp,%ebp
+    5833:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+    5836:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+    583c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    5843:	5d                   	pop    %ebp
+    5844:	c3                   	ret
+    5845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    584c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005850 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    5850:	55                   	push   %ebp
+    5851:	89 e5                	mov    %esp,%ebp
+    5853:	57                   	push   %edi
+    5854:	56                   	push   %esi
+    5855:	53                   	push   %ebx
+    5856:	83 ec 0c             	sub    $0xc,%esp
+    5859:	8b 75 08             	mov    0x8(%ebp),%esi
+    585c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+    585f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+    5864:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+    5866:	8b 3e                	mov    (%esi),%edi
+    5868:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+    586b:	83 f8 02             	cmp    $0x2,%eax
+    586e:	74 60                	je     58d0 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+    5870:	83 ec 08             	sub    $0x8,%esp
+    5873:	57                   	push   %edi
+    5874:	56                   	push   %esi
+    5875:	e8 89 f9 ff ff       	call   5203 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+    587a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+    587f:	31 c0                	xor    %eax,%eax
+    5881:	ba 01 00 00 00       	mov    $0x1,%edx
+    5886:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+    588a:	83 c4 10             	add    $0x10,%esp
+    588d:	85 c0                	test   %eax,%eax
+    588f:	74 36                	je     58c7 <cond_wait+0x77>
+  if(c != 2)
+    5891:	83 f8 02             	cmp    $0x2,%eax
+    5894:	74 0c                	je     58a2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+    5896:	b8 02 00 00 00       	mov    $0x2,%eax
+    589b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    589e:	85 c0                	test   %eax,%eax
+    58a0:	74 25                	je     58c7 <cond_wait+0x77>
+    58a2:	be 02 00 00 00       	mov    $0x2,%esi
+    58a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    58ae:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+    58b0:	83 ec 08             	sub    $0x8,%esp
+    58b3:	6a 02                	push   $0x2
+    58b5:	53                   	push   %ebx
+    58b6:	e8 48 f9 ff ff       	call   5203 <futex_wait>
+    58bb:	89 f0                	mov    %esi,%eax
+    58bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    58c0:	83 c4 10             	add    $0x10,%esp
+    58c3:	85 c0                	test   %eax,%eax
+    58c5:	75 e9                	jne    58b0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+    58c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    58ca:	5b                   	pop    %ebx
+    58cb:	5e                   	pop    %esi
+    58cc:	5f                   	pop    %edi
+    58cd:	5d                   	pop    %ebp
+    58ce:	c3                   	ret
+    58cf:	90                   	nop
+    futex_wake(&m->val, 1);
+    58d0:	83 ec 08             	sub    $0x8,%esp
+    58d3:	6a 01                	push   $0x1
+    58d5:	53                   	push   %ebx
+    58d6:	e8 30 f9 ff ff       	call   520b <futex_wake>
+    58db:	83 c4 10             	add    $0x10,%esp
+    58de:	eb 90                	jmp    5870 <cond_wait+0x20>
+
+000058e0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    58e0:	55                   	push   %ebp
+    58e1:	89 e5                	mov    %esp,%ebp
+    58e3:	83 ec 08             	sub    $0x8,%esp
+    58e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    58e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    58ed:	8b 50 04             	mov    0x4(%eax),%edx
+    58f0:	85 d2                	test   %edx,%edx
+    58f2:	75 0c                	jne    5900 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+    58f4:	c9                   	leave
+    58f5:	c3                   	ret
+    58f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    58fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+    5900:	83 ec 08             	sub    $0x8,%esp
+    5903:	6a 01                	push   $0x1
+    5905:	50                   	push   %eax
+    5906:	e8 00 f9 ff ff       	call   520b <futex_wake>
+    590b:	83 c4 10             	add    $0x10,%esp
+}
+    590e:	c9                   	leave
+    590f:	c3                   	ret
+
+00005910 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    5910:	55                   	push   %ebp
+    5911:	89 e5                	mov    %esp,%ebp
+    5913:	83 ec 08             	sub    $0x8,%esp
+    5916:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    5919:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+    591d:	8b 50 04             	mov    0x4(%eax),%edx
+    5920:	85 d2                	test   %edx,%edx
+    5922:	75 0c                	jne    5930 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+    5924:	c9                   	leave
+    5925:	c3                   	ret
+    5926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    592d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+    5930:	83 ec 08             	sub    $0x8,%esp
+    5933:	68 ff ff ff 7f       	push   $0x7fffffff
+    5938:	50                   	push   %eax
+    5939:	e8 cd f8 ff ff       	call   520b <futex_wake>
+    593e:	83 c4 10             	add    $0x10,%esp
+}
+    5941:	c9                   	leave
+    5942:	c3                   	ret
@@ -7,6 +7,12 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "time.h"
+#include "pstat.h"
+#include "wait.h"
+#include "trace.h"
+#include "irq.h"
+#include "lockstat.h"
 
 char buf[8192];
 char name[3];
@@ -424,6 +430,786 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// nanosleep should sleep at least as long as asked,
+// as measured by clock_gettime, but not a whole lot longer.
+void
+clocktest(void)
+{
+  struct timespec t0, t1, req;
+  uint ns;
+
+  printf(1, "clock test\n");
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0){
+    printf(1, "clock_gettime failed\n");
+    exit();
+  }
+  req.tv_sec = 0;
+  req.tv_nsec = 2000000;
+  if(nanosleep(&req) < 0){
+    printf(1, "nanosleep failed\n");
+    exit();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  ns = (t1.tv_sec - t0.tv_sec) * 1000000000 + t1.tv_nsec - t0.tv_nsec;
+  if(ns < req.tv_nsec){
+    printf(1, "nanosleep returned after %d ns\n", ns);
+    exit();
+  }
+  if(ns > 1000000000){
+    printf(1, "nanosleep took %d ns\n", ns);
+    exit();
+  }
+  printf(1, "clock test ok\n");
+}
+
+struct lock tlock;
+int tcount;
+
+void
+threadinc(void *arg)
+{
+  int i;
+
+  for(i = 0; i < (int)arg; i++){
+    lock_acquire(&tlock);
+    tcount++;
+    lock_release(&tlock);
+  }
+  exit();
+}
+
+int tfds[2];
+
+void
+threadpipe(void *arg)
+{
+  if(pipe(tfds) < 0)
+    tfds[0] = tfds[1] = -1;
+  exit();
+}
+
+// threads made by clone share memory and open files;
+// join collects them all
+void
+threadtest(void)
+{
+  int i;
+  char c;
+
+  printf(1, "thread test\n");
+  lock_init(&tlock);
+  tcount = 0;
+  for(i = 0; i < 4; i++){
+    if(thread_create(threadinc, (void*)1000) < 0){
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+      printf(1, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    printf(1, "thread_join got too many\n");
+    exit();
+  }
+  if(tcount != 4000){
+    printf(1, "thread test: count %d, expected 4000\n", tcount);
+    exit();
+  }
+  if(thread_create(threadpipe, 0) < 0 || thread_join() < 0){
+    printf(1, "thread_create failed\n");
+    exit();
+  }
+  if(tfds[0] < 0 || write(tfds[1], "x", 1) != 1 || read(tfds[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "thread test: thread's pipe not shared\n");
+    exit();
+  }
+  close(tfds[0]);
+  close(tfds[1]);
+  printf(1, "thread test ok\n");
+}
+
+struct mutex fmutex;
+struct cond fcond;
+int fturn;
+
+// each thread waits for its turn, counts, and passes it on
+void
+futexworker(void *arg)
+{
+  int i, me;
+
+  me = (int)arg;
+  for(i = 0; i < 100; i++){
+    mutex_lock(&fmutex);
+    while(fturn % 4 != me)
+      cond_wait(&fcond, &fmutex);
+    fturn++;
+    cond_broadcast(&fcond);
+    mutex_unlock(&fmutex);
+  }
+  exit();
+}
+
+// futex-based mutex and condition variable
+void
+futextest(void)
+{
+  int i;
+  uint word;
+
+  printf(1, "futex test\n");
+  word = 1;
+  if(futex_wait(&word, 0) != -1){
+    printf(1, "futex_wait slept on a changed value\n");
+    exit();
+  }
+  mutex_init(&fmutex);
+  cond_init(&fcond);
+  fturn = 0;
+  for(i = 0; i < 4; i++){
+    if(thread_create(futexworker, (void*)i) < 0){
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    thread_join();
+  if(fturn != 400){
+    printf(1, "futex test: %d turns, expected 400\n", fturn);
+    exit();
+  }
+  printf(1, "futex test ok\n");
+}
+
+// Pinning to CPU 0 sticks, is inherited across fork,
+// and an empty mask is refused.
+void
+affinitytest(void)
+{
+  int pid, fds[2];
+  uint old, m;
+  char c;
+
+  printf(1, "affinity test\n");
+  if(sched_getaffinity(0, &old) < 0 || old == 0){
+    printf(1, "getaffinity failed\n");
+    exit();
+  }
+  if(sched_setaffinity(0, 0) != -1){
+    printf(1, "setaffinity accepted an empty mask\n");
+    exit();
+  }
+  if(sched_setaffinity(0, 1) < 0 || sched_getaffinity(0, &m) < 0 || m != 1){
+    printf(1, "setaffinity to cpu 0 failed\n");
+    exit();
+  }
+  // The child waits on a pipe while we look at its mask.
+  if(pipe(fds) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[1]);
+    read(fds[0], &c, 1);
+    exit();
+  }
+  close(fds[0]);
+  if(sched_getaffinity(pid, &m) < 0 || m != 1){
+    printf(1, "child did not inherit affinity\n");
+    exit();
+  }
+  close(fds[1]);
+  wait();
+  if(sched_setaffinity(0, old) < 0 || sched_getaffinity(0, &m) < 0 || m != old){
+    printf(1, "restoring affinity failed\n");
+    exit();
+  }
+  printf(1, "affinity test ok\n");
+}
+
+struct procinfo pinfo[NPROC];
+
+// Find the caller in the getprocinfo() listing.
+struct procinfo*
+myinfo(void)
+{
+  int i, n, pid;
+
+  pid = getpid();
+  n = getprocinfo(pinfo, NPROC);
+  for(i = 0; i < n; i++)
+    if(pinfo[i].pid == pid)
+      return &pinfo[i];
+  printf(1, "getprocinfo did not list pid %d\n", pid);
+  exit();
+}
+
+// A busy loop is charged as CPU time and
+// system calls and sleeps are counted.
+void
+accttest(void)
+{
+  struct procinfo *pi;
+  uint nsyscall, nvcsw, t0;
+  volatile int i;
+
+  printf(1, "acct test\n");
+  pi = myinfo();
+  if(pi->state != PS_RUNNING || pi->ppid == 0){
+    printf(1, "getprocinfo: bad state %d ppid %d\n", pi->state, pi->ppid);
+    exit();
+  }
+  nsyscall = pi->nsyscall;
+  nvcsw = pi->nvcsw;
+  t0 = pi->utime + pi->stime;
+  for(i = 0; i < 20000000; i++)
+    ;
+  sleep(1);
+  pi = myinfo();
+  if(pi->utime + pi->stime <= t0){
+    printf(1, "acct: busy loop used no cpu time\n");
+    exit();
+  }
+  if(pi->nsyscall < nsyscall + 3 || pi->nvcsw <= nvcsw){
+    printf(1, "acct: syscalls %d -> %d, vcsw %d -> %d\n",
+           nsyscall, pi->nsyscall, nvcsw, pi->nvcsw);
+    exit();
+  }
+  printf(1, "acct test ok\n");
+}
+
+// waitpid collects the named child only, and
+// WNOHANG returns 0 while it is still running.
+void
+waitpidtest(void)
+{
+  int fast, slow, r;
+
+  printf(1, "waitpid test\n");
+  if(waitpid(-1, WNOHANG) != -1){
+    printf(1, "waitpid with no children did not fail\n");
+    exit();
+  }
+  slow = fork();
+  if(slow == 0){
+    sleep(20);
+    exit();
+  }
+  fast = fork();
+  if(fast == 0)
+    exit();
+  if(slow < 0 || fast < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(waitpid(slow, WNOHANG) != 0){
+    printf(1, "waitpid WNOHANG reaped a running child\n");
+    exit();
+  }
+  if((r = waitpid(fast, 0)) != fast){
+    printf(1, "waitpid(%d) returned %d\n", fast, r);
+    exit();
+  }
+  if(waitpid(fast, WNOHANG) != -1){
+    printf(1, "waitpid found a reaped child\n");
+    exit();
+  }
+  if((r = waitpid(-1, 0)) != slow){
+    printf(1, "waitpid(-1) returned %d\n", r);
+    exit();
+  }
+  printf(1, "waitpid test ok\n");
+}
+
+// Several processes fork, exit and wait at once.
+void
+parforktest(void)
+{
+  int i, j, pid, pids[4];
+
+  printf(1, "parallel fork test\n");
+  for(i = 0; i < 4; i++){
+    pids[i] = fork();
+    if(pids[i] < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0){
+      for(j = 0; j < 200; j++){
+        pid = fork();
+        if(pid < 0)
+          continue;
+        if(pid == 0)
+          exit();
+        if(wait() != pid){
+          printf(1, "parallel fork: wait got the wrong child\n");
+          exit();
+        }
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(wait() < 0){
+      printf(1, "parallel fork: wait failed\n");
+      exit();
+    }
+  }
+  printf(1, "parallel fork test ok\n");
+}
+
+// A child that sleeps must show up in the trace
+// going to sleep, being woken, and switching in.
+void
+tracetest(void)
+{
+  static struct traceevent ev[64];
+  int i, n, pid, was, seen;
+
+  printf(1, "trace test\n");
+  if((was = tracectl(1)) < 0){
+    printf(1, "tracectl failed\n");
+    exit();
+  }
+  while(traceread(ev, 64) > 0)
+    ;
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    sleep(2);
+    exit();
+  }
+  wait();
+  tracectl(was);
+  seen = 0;
+  while((n = traceread(ev, 64)) > 0){
+    for(i = 0; i < n; i++){
+      if(ev[i].pid != pid)
+        continue;
+      if(ev[i].type == TR_SLEEP)
+        seen |= 1;
+      if(ev[i].type == TR_WAKEUP)
+        seen |= 2;
+      if(ev[i].type == TR_SWITCHIN)
+        seen |= 4;
+      if(ev[i].nsec >= 1000000000){
+        printf(1, "trace: bad time\n");
+        exit();
+      }
+    }
+  }
+  if(seen != 7){
+    printf(1, "trace: missing events %x\n", seen);
+    exit();
+  }
+  printf(1, "trace test ok\n");
+}
+
+// Admission control must refuse reservations beyond the
+// machine, give them back when processes exit, and a
+// periodic process must get one job per period.
+void
+edftest(void)
+{
+  int i, n, refused, fd[2], pid;
+  struct dlstat ds;
+  struct timespec ts;
+  uint t0;
+
+  printf(1, "edf test\n");
+  if(sched_setdeadline(0, 2000, 1000, 5000) >= 0 ||
+     sched_setdeadline(0, 1000, 6000, 5000) >= 0){
+    printf(1, "edf: bad parameters accepted\n");
+    exit();
+  }
+
+  // 90% of a CPU each, for children that wait on a pipe:
+  // about one per CPU fits.
+  if(pipe(fd) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  refused = 0;
+  for(n = 0; n < 2*NCPU && !refused; n++){
+    if((pid = fork()) == 0){
+      close(fd[1]);
+      read(fd[0], &i, 1);
+      exit();
+    }
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    refused = sched_setdeadline(pid, 9000, 10000, 10000) < 0;
+  }
+  close(fd[0]);
+  close(fd[1]);
+  for(i = 0; i < n; i++)
+    wait();
+  if(!refused || n < 2){
+    printf(1, "edf: admitted %d of 90%% each\n", n - refused);
+    exit();
+  }
+
+  // Reservations pinned to one CPU count against it alone.
+  if(pipe(fd) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  for(n = 0; n < 2; n++){
+    if((pid = fork()) == 0){
+      close(fd[1]);
+      read(fd[0], &i, 1);
+      exit();
+    }
+    if(pid < 0 || sched_setaffinity(pid, 1) < 0){
+      printf(1, "edf: fork or setaffinity failed\n");
+      exit();
+    }
+    refused = sched_setdeadline(pid, 6000, 10000, 10000) < 0;
+    if(refused != (n == 1)){
+      printf(1, "edf: pinned reservation %d %s\n", n, refused ? "refused" : "admitted");
+      exit();
+    }
+  }
+  close(fd[0]);
+  close(fd[1]);
+  wait();
+  wait();
+
+  // The reservations are back: 3 jobs take at least 2 periods.
+  if(sched_setdeadline(0, 2000, 10000, 10000) < 0){
+    printf(1, "edf: reservation not given back\n");
+    exit();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  t0 = ts.tv_sec*1000 + ts.tv_nsec/1000000;
+  for(i = 0; i < 3; i++)
+    sched_dlyield();
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  if(ts.tv_sec*1000 + ts.tv_nsec/1000000 - t0 < 20){
+    printf(1, "edf: periods too short\n");
+    exit();
+  }
+  if(sched_dlstat(0, &ds) < 0 || ds.jobs != 3 || ds.period != 10000){
+    printf(1, "edf: bad stats\n");
+    exit();
+  }
+  sched_setdeadline(0, 0, 0, 0);
+  if(sched_dlyield() >= 0){
+    printf(1, "edf: dlyield as a normal process\n");
+    exit();
+  }
+  printf(1, "edf test ok\n");
+}
+
+// Disk interrupts must land on the CPU the IDE IRQ
+// is routed to, and be counted there.
+void
+irqtest(void)
+{
+  static struct irqinfo ii[NIRQ];
+  uint before;
+  int fd, i;
+
+  printf(1, "irq test\n");
+  if(irqstat(ii, NIRQ) != NIRQ){
+    printf(1, "irqstat failed\n");
+    exit();
+  }
+  if(irqroute(NIRQ, 0) >= 0 || irqroute(IRQ_IDE, NCPU) >= 0){
+    printf(1, "irq: bad route accepted\n");
+    exit();
+  }
+  if(ii[IRQ_IDE].cpu < 0){
+    // Uniprocessor: the PIC delivers everything to CPU 0.
+    printf(1, "irq test ok\n");
+    return;
+  }
+  if(irqroute(IRQ_IDE, 0) < 0){
+    printf(1, "irq: route failed\n");
+    exit();
+  }
+  irqstat(ii, NIRQ);
+  before = ii[IRQ_IDE].count[0];
+  fd = open("irqfile", O_CREATE|O_RDWR);
+  for(i = 0; i < 20; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+  unlink("irqfile");
+  irqstat(ii, NIRQ);
+  irqroute(IRQ_IDE, -1);
+  if(ii[IRQ_IDE].cpu != 0 || !ii[IRQ_IDE].pinned || ii[IRQ_IDE].count[0] == before){
+    printf(1, "irq: disk interrupts not on cpu 0\n");
+    exit();
+  }
+  printf(1, "irq test ok\n");
+}
+
+// Several processes contending for each kind of kernel
+// spin lock must all get it, without deadlock.
+void
+locktest(void)
+{
+  int kind, i, pid, n;
+
+  printf(1, "lock test\n");
+  if(lockbench(3, 10) >= 0 || lockbench(0, 0) >= 0){
+    printf(1, "lock: bad lockbench accepted\n");
+    exit();
+  }
+  for(kind = 0; kind < 3; kind++){
+    for(i = 0; i < 4; i++){
+      pid = fork();
+      if(pid < 0){
+        printf(1, "fork failed\n");
+        exit();
+      }
+      if(pid == 0){
+        if(lockbench(kind, 50) <= 0)
+          printf(1, "lock: kind %d starved\n", kind);
+        exit();
+      }
+    }
+    if((n = lockbench(kind, 50)) <= 0){
+      printf(1, "lock: kind %d got %d\n", kind, n);
+      exit();
+    }
+    for(i = 0; i < 4; i++)
+      wait();
+  }
+  printf(1, "lock test ok\n");
+}
+
+// Spin and sleep locks are both counted, by name.
+void
+lockstattest(void)
+{
+  static struct lockstat ls[NLOCKCLASS];
+  int i, n, ptable, bcache;
+
+  printf(1, "lockstat test\n");
+  if(lockstat(ls, -1) >= 0){
+    printf(1, "lockstat: bad count accepted\n");
+    exit();
+  }
+  n = lockstat(ls, NLOCKCLASS);
+  ptable = bcache = 0;
+  for(i = 0; i < n; i++){
+    if(strcmp(ls[i].name, "ptable") == 0 && ls[i].nacquire > 0 && !ls[i].sleep)
+      ptable = 1;
+    if(strcmp(ls[i].name, "buffer") == 0 && ls[i].nacquire > 0 && ls[i].sleep)
+      bcache = 1;
+    if(ls[i].nspinwon > ls[i].nspin || (ls[i].nspin && !ls[i].sleep)){
+      printf(1, "lockstat: %s: bad spin counts\n", ls[i].name);
+      exit();
+    }
+  }
+  if(!ptable || !bcache){
+    printf(1, "lockstat: ptable or buffer locks not counted\n");
+    exit();
+  }
+  printf(1, "lockstat test ok\n");
+}
+
+// Concurrent inode cache hits, which share the icache
+// lock, must all find the same inode.
+void
+icachetest(void)
+{
+  struct stat st0, st;
+  int i, j, fd, pid;
+
+  printf(1, "icache test\n");
+  if(stat(".", &st0) < 0){
+    printf(1, "icache: stat . failed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < 500; j++){
+        if((fd = open(".", 0)) < 0 || fstat(fd, &st) < 0 || st.ino != st0.ino){
+          printf(1, "icache: wrong inode\n");
+          exit();
+        }
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+  printf(1, "icache test ok\n");
+}
+
+// System calls are counted on the CPU that takes them.
+void
+cpustattest(void)
+{
+  static struct cpustat before[NCPU], after[NCPU];
+  uint nb, na;
+  int i, n;
+
+  printf(1, "cpustat test\n");
+  n = cpustat(before, NCPU);
+  if(n < 1 || n > NCPU){
+    printf(1, "cpustat: %d cpus\n", n);
+    exit();
+  }
+  for(i = 0; i < 100; i++)
+    getpid();
+  cpustat(after, NCPU);
+  nb = na = 0;
+  for(i = 0; i < n; i++){
+    nb += before[i].stat[CS_SYSCALL];
+    na += after[i].stat[CS_SYSCALL];
+  }
+  if(na - nb < 100){
+    printf(1, "cpustat: %d system calls counted, not 100\n", na - nb);
+    exit();
+  }
+  printf(1, "cpustat test ok\n");
+}
+
+// Processes reading and writing their own files at once
+// each see their own data, through the buffer cache's
+// separately locked buckets.
+void
+bcachetest(void)
+{
+  char name[3], data[512];
+  int i, j, k, fd, pid, old;
+
+  printf(1, "bcache test\n");
+  // As small a cache as the kernel allows, so blocks get
+  // evicted and buffers freed while we use them.
+  old = bcachesize(1);
+  if(bcachesize(0) != NBUF){
+    printf(1, "bcache: limit %d, not %d\n", bcachesize(0), NBUF);
+    exit();
+  }
+  name[0] = 'b';
+  name[2] = 0;
+  for(i = 0; i < 4; i++){
+    name[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      fd = open(name, O_CREATE|O_RDWR);
+      memset(data, 'a'+i, sizeof(data));
+      for(j = 0; j < 20; j++)
+        if(write(fd, data, sizeof(data)) != sizeof(data)){
+          printf(1, "bcache: write failed\n");
+          exit();
+        }
+      close(fd);
+      for(k = 0; k < 5; k++){
+        fd = open(name, O_RDONLY);
+        for(j = 0; j < 20; j++)
+          if(read(fd, data, sizeof(data)) != sizeof(data) ||
+             data[0] != 'a'+i || data[511] != 'a'+i){
+            printf(1, "bcache: wrong data in %s\n", name);
+            exit();
+          }
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+  for(i = 0; i < 4; i++){
+    name[1] = '0' + i;
+    unlink(name);
+  }
+  bcachesize(old);
+  printf(1, "bcache test ok\n");
+}
+
+// Read a file through two descriptors at once, and with
+// writes in between, so read-ahead windows open and close
+// under each other, and check every block is right.
+void
+readaheadtest(void)
+{
+  char data[512];
+  int i, fd, fd1, fd2;
+
+  printf(1, "readahead test\n");
+  unlink("ra");
+  fd = open("ra", O_CREATE|O_RDWR);
+  for(i = 0; i < 40; i++){
+    memset(data, 'a' + i%26, sizeof(data));
+    if(write(fd, data, sizeof(data)) != sizeof(data)){
+      printf(1, "readahead: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  fd1 = open("ra", O_RDONLY);
+  fd2 = open("ra", O_RDWR);
+  for(i = 0; i < 40; i++){
+    if(read(fd1, data, sizeof(data)) != sizeof(data) ||
+       data[0] != 'a' + i%26 || data[511] != 'a' + i%26){
+      printf(1, "readahead: wrong data in block %d\n", i);
+      exit();
+    }
+    if(i%2 == 0)
+      continue;
+    // Every other block through fd2, which also writes,
+    // so its reads are never sequential.
+    if(read(fd2, data, sizeof(data)) != sizeof(data) ||
+       data[0] != 'a' + (i-1)%26){
+      printf(1, "readahead: wrong data through fd2\n");
+      exit();
+    }
+    if(write(fd2, data, sizeof(data)) != sizeof(data)){
+      printf(1, "readahead: rewrite failed\n");
+      exit();
+    }
+  }
+  if(read(fd1, data, sizeof(data)) != 0){
+    printf(1, "readahead: read past end\n");
+    exit();
+  }
+  close(fd1);
+  close(fd2);
+
+  // The rewritten blocks, read ahead before they were
+  // written, must read back new.
+  fd = open("ra", O_RDONLY);
+  for(i = 0; i < 40; i++)
+    if(read(fd, data, sizeof(data)) != sizeof(data) ||
+       data[0] != 'a' + (i - i%2)%26){
+      printf(1, "readahead: stale block %d\n", i);
+      exit();
+    }
+  close(fd);
+  unlink("ra");
+  printf(1, "readahead test ok\n");
+}
+
 void
 mem(void)
 {
@@ -1383,7 +2169,7 @@ forktest(void)
 
   printf(1, "fork test\n");
 
-  for(n=0; n<1000; n++){
+  for(n=0; n<NPROC; n++){
     pid = fork();
     if(pid < 0)
       break;
@@ -1391,8 +2177,8 @@ forktest(void)
       exit();
   }
 
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
+  if(n == NPROC){
+    printf(1, "fork claimed to work NPROC times!\n");
     exit();
   }
 
@@ -1783,6 +2569,22 @@ main(int argc, char *argv[])
   pipe1();
   preempt();
   exitwait();
+  clocktest();
+  threadtest();
+  futextest();
+  affinitytest();
+  accttest();
+  waitpidtest();
+  parforktest();
+  tracetest();
+  edftest();
+  irqtest();
+  locktest();
+  lockstattest();
+  icachetest();
+  cpustattest();
+  bcachetest();
+  readaheadtest();
 
   rmdot();
   fourteen();
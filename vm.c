@@ -4,8 +4,10 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "traps.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -27,8 +29,9 @@ seginit(void)
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
 
-  // Map cpu and proc -- these are private per cpu.
-  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+  // Map this cpu's struct cpu, which starts with cpu and
+  // proc -- these are private per cpu.
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
 
   lgdt(c->gdt, sizeof(c->gdt));
   loadgs(SEG_KCPU << 3);
@@ -151,6 +154,32 @@ kvmalloc(void)
   switchkvm();
 }
 
+// Make the physical memory at [pa, pa+size) readable at P2V(pa)
+// in kpgdir, for reading firmware tables above PHYSTOP at boot.
+// Other page tables don't get the mapping.  Return P2V(pa),
+// or 0 if the range is out of reach.
+void*
+kmapphys(uint pa, uint size)
+{
+  char *a, *last;
+  pte_t *pte;
+
+  if(size == 0 || pa + size < pa || pa + size > DEVSPACE - KERNBASE)
+    return 0;
+  a = (char*)PGROUNDDOWN((uint)P2V(pa));
+  last = (char*)PGROUNDDOWN((uint)P2V(pa) + size - 1);
+  for(;;){
+    if((pte = walkpgdir(kpgdir, a, 1)) == 0)
+      return 0;
+    if(!(*pte & PTE_P))
+      *pte = V2P(a) | PTE_P;
+    if(a == last)
+      break;
+    a += PGSIZE;
+  }
+  return P2V(pa);
+}
+
 // Switch h/w page table register to the kernel-only page table,
 // for when no process is running.
 void
@@ -257,7 +286,8 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Also frees pages shrinkuvm has unmapped but left
+// the addresses of.  Returns the new process size.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -272,7 +302,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    else if(*pte != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -284,6 +314,34 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Shrink the current process's memory from oldsz to newsz,
+// like deallocuvm, while threads on other CPUs may be using
+// pgdir.  The pages are unmapped first, and freed only once
+// tlbshootdown has made sure no CPU can reach them through a
+// stale TLB entry; otherwise a thread could write a page that
+// kalloc has given to someone else.  Interrupts must be enabled.
+int
+shrinkuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  // Clear only PTE_P, leaving the addresses for deallocuvm.
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else
+      *pte &= ~PTE_P;
+  }
+  lcr3(V2P(pgdir));
+  tlbshootdown(pgdir);
+  return deallocuvm(pgdir, oldsz, newsz);
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -316,6 +374,31 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// shrinkuvm has unmapped pages from the user part of pgdir.
+// Make the other CPUs running threads on it drop stale TLB entries,
+// and wait until they have.  Interrupts must be enabled, so
+// that a shootdown from another CPU can finish meanwhile.
+// A CPU that switches to pgdir after the check flushes when
+// it loads %cr3 anyway.
+void
+tlbshootdown(pde_t *pgdir)
+{
+  struct cpu *c;
+
+  pushcli();
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c == cpu || c->proc == 0 || c->proc->pgdir != pgdir)
+      continue;
+    c->tlbflush = 1;
+    lapicipi(c->apicid, T_IRQ0 + IRQ_TLBFLUSH);
+  }
+  popcli();
+
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c->tlbflush)
+      ;
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
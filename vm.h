@@ -0,0 +1,11 @@
+// A user address space, shared by a process and the threads
+// it clones.  Its page table never changes: exec makes a new
+// one.  lock serializes changes to sz, which all sharers see
+// at once.
+struct vm {
+  struct sleeplock lock;  // Held while growing or shrinking
+  int ref;                // Procs using it; changed by xadd
+  pde_t *pgdir;           // Page table
+  uint sz;                // Size of user memory (bytes)
+  struct vm *nextfree;    // Next in vmtable free list
+};
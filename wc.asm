@@ -0,0 +1,1889 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 a2 03 00 00       	call   3eb <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 a6 03 00 00       	call   403 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 f7 0b 00 00       	push   $0xbf7
+  6e:	6a 01                	push   $0x1
+  70:	e8 5b 05 00 00       	call   5d0 <printf>
+      exit();
+  75:	e8 49 03 00 00       	call   3c3 <exit>
+  }
+  exit();
+  7a:	e8 44 03 00 00       	call   3c3 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 e9 0b 00 00       	push   $0xbe9
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 31 03 00 00       	call   3c3 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 40 11 00 00       	push   $0x1140
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 06 03 00 00       	call   3db <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 40 11 00 00 	movsbl 0x1140(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 d4 0b 00 00       	push   $0xbd4
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 ea 0b 00 00       	push   $0xbea
+ 155:	6a 01                	push   $0x1
+ 157:	e8 74 04 00 00       	call   5d0 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 da 0b 00 00       	push   $0xbda
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 5b 04 00 00       	call   5d0 <printf>
+    exit();
+ 175:	e8 49 02 00 00       	call   3c3 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 1e 01 00 00       	call   3db <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 f1 00 00 00       	call   403 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 f4 00 00 00       	call   41b <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 ba 00 00 00       	call   3eb <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+
+000003bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <exit>:
+SYSCALL(exit)
+ 3c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <wait>:
+SYSCALL(wait)
+ 3cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <pipe>:
+SYSCALL(pipe)
+ 3d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <read>:
+SYSCALL(read)
+ 3db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <write>:
+SYSCALL(write)
+ 3e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <close>:
+SYSCALL(close)
+ 3eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <kill>:
+SYSCALL(kill)
+ 3f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <exec>:
+SYSCALL(exec)
+ 3fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <open>:
+SYSCALL(open)
+ 403:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mknod>:
+SYSCALL(mknod)
+ 40b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <unlink>:
+SYSCALL(unlink)
+ 413:	b8 12 00 00 00       	mov    $0x12,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <fstat>:
+SYSCALL(fstat)
+ 41b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <link>:
+SYSCALL(link)
+ 423:	b8 13 00 00 00       	mov    $0x13,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mkdir>:
+SYSCALL(mkdir)
+ 42b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <chdir>:
+SYSCALL(chdir)
+ 433:	b8 09 00 00 00       	mov    $0x9,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dup>:
+SYSCALL(dup)
+ 43b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getpid>:
+SYSCALL(getpid)
+ 443:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sbrk>:
+SYSCALL(sbrk)
+ 44b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <sleep>:
+SYSCALL(sleep)
+ 453:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <uptime>:
+SYSCALL(uptime)
+ 45b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <add_dir>:
+SYSCALL(add_dir)
+ 463:	b8 16 00 00 00       	mov    $0x16,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <history>:
+SYSCALL(history)
+ 46b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 473:	b8 19 00 00 00       	mov    $0x19,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <nanosleep>:
+SYSCALL(nanosleep)
+ 47b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <clone>:
+SYSCALL(clone)
+ 483:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <join>:
+SYSCALL(join)
+ 48b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <futex_wait>:
+SYSCALL(futex_wait)
+ 493:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <futex_wake>:
+SYSCALL(futex_wake)
+ 49b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4ab:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 4b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getprocinfo>:
+SYSCALL(getprocinfo)
+ 4bb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <waitpid>:
+SYSCALL(waitpid)
+ 4c3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <tracectl>:
+SYSCALL(tracectl)
+ 4cb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <traceread>:
+SYSCALL(traceread)
+ 4d3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 4db:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 4e3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 4eb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <irqroute>:
+SYSCALL(irqroute)
+ 4f3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <irqstat>:
+SYSCALL(irqstat)
+ 4fb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <boottimes>:
+SYSCALL(boottimes)
+ 503:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <lockbench>:
+SYSCALL(lockbench)
+ 50b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <lockstat>:
+SYSCALL(lockstat)
+ 513:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <cpustat>:
+SYSCALL(cpustat)
+ 51b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <bcachesize>:
+SYSCALL(bcachesize)
+ 523:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 6c 0c 00 00 	movzbl 0xc6c(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 36 fe ff ff       	call   3e3 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 cc fd ff ff       	call   3e3 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 14 0c 00 00 	jmp    *0xc14(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 6d fd ff ff       	call   3e3 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 5b fd ff ff       	call   3e3 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 e1 fc ff ff       	call   3e3 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 91 fc ff ff       	call   3e3 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 0b 0c 00 00       	mov    $0xc0b,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 781:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 784:	89 e5                	mov    %esp,%ebp
+ 786:	57                   	push   %edi
+ 787:	56                   	push   %esi
+ 788:	53                   	push   %ebx
+ 789:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 78b:	a1 44 13 00 00       	mov    0x1344,%eax
+ 790:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 792:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 794:	39 ca                	cmp    %ecx,%edx
+ 796:	73 30                	jae    7c8 <ufree+0x48>
+ 798:	39 c1                	cmp    %eax,%ecx
+ 79a:	72 04                	jb     7a0 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79c:	39 c2                	cmp    %eax,%edx
+ 79e:	72 f0                	jb     790 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7a3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7a6:	39 f8                	cmp    %edi,%eax
+ 7a8:	74 26                	je     7d0 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7b3:	39 f1                	cmp    %esi,%ecx
+ 7b5:	74 30                	je     7e7 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7b7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7b9:	5b                   	pop    %ebx
+  freep = p;
+ 7ba:	89 15 44 13 00 00    	mov    %edx,0x1344
+}
+ 7c0:	5e                   	pop    %esi
+ 7c1:	5f                   	pop    %edi
+ 7c2:	5d                   	pop    %ebp
+ 7c3:	c3                   	ret
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c8:	39 c1                	cmp    %eax,%ecx
+ 7ca:	72 d0                	jb     79c <ufree+0x1c>
+ 7cc:	eb c2                	jmp    790 <ufree+0x10>
+ 7ce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7d0:	03 70 04             	add    0x4(%eax),%esi
+ 7d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d6:	8b 02                	mov    (%edx),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7e3:	39 f1                	cmp    %esi,%ecx
+ 7e5:	75 d0                	jne    7b7 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 7e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ea:	89 15 44 13 00 00    	mov    %edx,0x1344
+    p->s.size += bp->s.size;
+ 7f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7f8:	5b                   	pop    %ebx
+ 7f9:	5e                   	pop    %esi
+ 7fa:	5f                   	pop    %edi
+ 7fb:	5d                   	pop    %ebp
+ 7fc:	c3                   	ret
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000800 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	53                   	push   %ebx
+ 804:	83 ec 10             	sub    $0x10,%esp
+ 807:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 80a:	68 40 13 00 00       	push   $0x1340
+ 80f:	e8 ec 01 00 00       	call   a00 <lock_acquire>
+  ufree(ap);
+ 814:	89 d8                	mov    %ebx,%eax
+ 816:	e8 65 ff ff ff       	call   780 <ufree>
+  lock_release(&mlock);
+ 81b:	c7 45 08 40 13 00 00 	movl   $0x1340,0x8(%ebp)
+}
+ 822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 825:	83 c4 10             	add    $0x10,%esp
+}
+ 828:	c9                   	leave
+  lock_release(&mlock);
+ 829:	e9 f2 01 00 00       	jmp    a20 <lock_release>
+ 82e:	66 90                	xchg   %ax,%ax
+
+00000830 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 83c:	68 40 13 00 00       	push   $0x1340
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 841:	8d 48 07             	lea    0x7(%eax),%ecx
+ 844:	c1 e9 03             	shr    $0x3,%ecx
+ 847:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 84a:	e8 b1 01 00 00       	call   a00 <lock_acquire>
+  if((prevp = freep) == 0){
+ 84f:	8b 15 44 13 00 00    	mov    0x1344,%edx
+ 855:	83 c4 10             	add    $0x10,%esp
+ 858:	85 d2                	test   %edx,%edx
+ 85a:	0f 84 b0 00 00 00    	je     910 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 860:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 862:	8b 47 04             	mov    0x4(%edi),%eax
+ 865:	39 f0                	cmp    %esi,%eax
+ 867:	73 6f                	jae    8d8 <malloc+0xa8>
+  if(nu < 4096)
+ 869:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 86e:	39 de                	cmp    %ebx,%esi
+ 870:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 873:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 87a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 87d:	eb 0a                	jmp    889 <malloc+0x59>
+ 87f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 880:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 882:	8b 47 04             	mov    0x4(%edi),%eax
+ 885:	39 f0                	cmp    %esi,%eax
+ 887:	73 4f                	jae    8d8 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 889:	89 fa                	mov    %edi,%edx
+ 88b:	39 3d 44 13 00 00    	cmp    %edi,0x1344
+ 891:	75 ed                	jne    880 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	ff 75 e4             	push   -0x1c(%ebp)
+ 899:	e8 ad fb ff ff       	call   44b <sbrk>
+  if(p == (char*)-1)
+ 89e:	83 c4 10             	add    $0x10,%esp
+ 8a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8a4:	74 15                	je     8bb <malloc+0x8b>
+  hp->s.size = nu;
+ 8a6:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 8a9:	83 c0 08             	add    $0x8,%eax
+ 8ac:	e8 cf fe ff ff       	call   780 <ufree>
+  return freep;
+ 8b1:	8b 15 44 13 00 00    	mov    0x1344,%edx
+      if((p = morecore(nunits)) == 0){
+ 8b7:	85 d2                	test   %edx,%edx
+ 8b9:	75 c5                	jne    880 <malloc+0x50>
+        lock_release(&mlock);
+ 8bb:	83 ec 0c             	sub    $0xc,%esp
+ 8be:	68 40 13 00 00       	push   $0x1340
+ 8c3:	e8 58 01 00 00       	call   a20 <lock_release>
+        return 0;
+ 8c8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 8cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8ce:	31 c0                	xor    %eax,%eax
+}
+ 8d0:	5b                   	pop    %ebx
+ 8d1:	5e                   	pop    %esi
+ 8d2:	5f                   	pop    %edi
+ 8d3:	5d                   	pop    %ebp
+ 8d4:	c3                   	ret
+ 8d5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8d8:	39 c6                	cmp    %eax,%esi
+ 8da:	74 64                	je     940 <malloc+0x110>
+        p->s.size -= nunits;
+ 8dc:	29 f0                	sub    %esi,%eax
+ 8de:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 8e1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 8e4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 8ea:	89 15 44 13 00 00    	mov    %edx,0x1344
+      lock_release(&mlock);
+ 8f0:	68 40 13 00 00       	push   $0x1340
+ 8f5:	e8 26 01 00 00       	call   a20 <lock_release>
+      return (void*)(p + 1);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+}
+ 8fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 900:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 903:	5b                   	pop    %ebx
+ 904:	5e                   	pop    %esi
+ 905:	5f                   	pop    %edi
+ 906:	5d                   	pop    %ebp
+ 907:	c3                   	ret
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 44 13 00 00 48 	movl   $0x1348,0x1344
+ 917:	13 00 00 
+    base.s.size = 0;
+ 91a:	bf 48 13 00 00       	mov    $0x1348,%edi
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 48 13 00 00 48 	movl   $0x1348,0x1348
+ 926:	13 00 00 
+    base.s.size = 0;
+ 929:	c7 05 4c 13 00 00 00 	movl   $0x0,0x134c
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 31 ff ff ff       	jmp    869 <malloc+0x39>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 07                	mov    (%edi),%eax
+ 942:	89 02                	mov    %eax,(%edx)
+ 944:	eb a1                	jmp    8e7 <malloc+0xb7>
+ 946:	66 90                	xchg   %ax,%ax
+ 948:	66 90                	xchg   %ax,%ax
+ 94a:	66 90                	xchg   %ax,%ax
+ 94c:	66 90                	xchg   %ax,%ax
+ 94e:	66 90                	xchg   %ax,%ax
+
+00000950 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	53                   	push   %ebx
+ 954:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 957:	68 00 10 00 00       	push   $0x1000
+ 95c:	e8 cf fe ff ff       	call   830 <malloc>
+ 961:	83 c4 10             	add    $0x10,%esp
+ 964:	85 c0                	test   %eax,%eax
+ 966:	74 37                	je     99f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 968:	83 ec 04             	sub    $0x4,%esp
+ 96b:	89 c3                	mov    %eax,%ebx
+ 96d:	50                   	push   %eax
+ 96e:	ff 75 0c             	push   0xc(%ebp)
+ 971:	ff 75 08             	push   0x8(%ebp)
+ 974:	e8 0a fb ff ff       	call   483 <clone>
+ 979:	83 c4 10             	add    $0x10,%esp
+ 97c:	85 c0                	test   %eax,%eax
+ 97e:	78 08                	js     988 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 983:	c9                   	leave
+ 984:	c3                   	ret
+ 985:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 988:	83 ec 0c             	sub    $0xc,%esp
+ 98b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 98e:	53                   	push   %ebx
+ 98f:	e8 6c fe ff ff       	call   800 <free>
+ 994:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 997:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 99a:	83 c4 10             	add    $0x10,%esp
+}
+ 99d:	c9                   	leave
+ 99e:	c3                   	ret
+    return -1;
+ 99f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9a4:	eb da                	jmp    980 <thread_create+0x30>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 9b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 9b9:	50                   	push   %eax
+ 9ba:	e8 cc fa ff ff       	call   48b <join>
+ 9bf:	83 c4 10             	add    $0x10,%esp
+ 9c2:	85 c0                	test   %eax,%eax
+ 9c4:	79 0a                	jns    9d0 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 9c6:	c9                   	leave
+ 9c7:	c3                   	ret
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+ 9d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	ff 75 f4             	push   -0xc(%ebp)
+ 9d9:	e8 22 fe ff ff       	call   800 <free>
+ 9de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9e1:	83 c4 10             	add    $0x10,%esp
+}
+ 9e4:	c9                   	leave
+ 9e5:	c3                   	ret
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 9f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9fc:	5d                   	pop    %ebp
+ 9fd:	c3                   	ret
+ 9fe:	66 90                	xchg   %ax,%ax
+
+00000a00 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ a00:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ a01:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a06:	89 e5                	mov    %esp,%ebp
+ a08:	8b 55 08             	mov    0x8(%ebp),%edx
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+ a10:	89 c8                	mov    %ecx,%eax
+ a12:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ a15:	85 c0                	test   %eax,%eax
+ a17:	75 f7                	jne    a10 <lock_acquire+0x10>
+    ;
+}
+ a19:	5d                   	pop    %ebp
+ a1a:	c3                   	ret
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+
+00000a20 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ a20:	55                   	push   %ebp
+ a21:	31 c0                	xor    %eax,%eax
+ a23:	89 e5                	mov    %esp,%ebp
+ a25:	8b 55 08             	mov    0x8(%ebp),%edx
+ a28:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a30 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ a33:	8b 45 08             	mov    0x8(%ebp),%eax
+ a36:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a3c:	5d                   	pop    %ebp
+ a3d:	c3                   	ret
+ a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a40:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ a41:	31 c0                	xor    %eax,%eax
+ a43:	ba 01 00 00 00       	mov    $0x1,%edx
+ a48:	89 e5                	mov    %esp,%ebp
+ a4a:	56                   	push   %esi
+ a4b:	53                   	push   %ebx
+ a4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a4f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ a53:	85 c0                	test   %eax,%eax
+ a55:	74 30                	je     a87 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ a57:	83 f8 02             	cmp    $0x2,%eax
+ a5a:	74 0c                	je     a68 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ a5c:	b8 02 00 00 00       	mov    $0x2,%eax
+ a61:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ a64:	85 c0                	test   %eax,%eax
+ a66:	74 1f                	je     a87 <mutex_lock+0x47>
+ a68:	be 02 00 00 00       	mov    $0x2,%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ a70:	83 ec 08             	sub    $0x8,%esp
+ a73:	6a 02                	push   $0x2
+ a75:	53                   	push   %ebx
+ a76:	e8 18 fa ff ff       	call   493 <futex_wait>
+ a7b:	89 f0                	mov    %esi,%eax
+ a7d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a80:	83 c4 10             	add    $0x10,%esp
+ a83:	85 c0                	test   %eax,%eax
+ a85:	75 e9                	jne    a70 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a8a:	5b                   	pop    %ebx
+ a8b:	5e                   	pop    %esi
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+ a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a90:	55                   	push   %ebp
+ a91:	31 c0                	xor    %eax,%eax
+ a93:	89 e5                	mov    %esp,%ebp
+ a95:	83 ec 08             	sub    $0x8,%esp
+ a98:	8b 55 08             	mov    0x8(%ebp),%edx
+ a9b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ a9e:	83 f8 02             	cmp    $0x2,%eax
+ aa1:	74 05                	je     aa8 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ aa3:	c9                   	leave
+ aa4:	c3                   	ret
+ aa5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ aa8:	83 ec 08             	sub    $0x8,%esp
+ aab:	6a 01                	push   $0x1
+ aad:	52                   	push   %edx
+ aae:	e8 e8 f9 ff ff       	call   49b <futex_wake>
+ ab3:	83 c4 10             	add    $0x10,%esp
+}
+ ab6:	c9                   	leave
+ ab7:	c3                   	ret
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+
+00000ac0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ ac6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ acc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ ad3:	5d                   	pop    %ebp
+ ad4:	c3                   	ret
+ ad5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ae0 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 0c             	sub    $0xc,%esp
+ ae9:	8b 75 08             	mov    0x8(%ebp),%esi
+ aec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ aef:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ af4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ af6:	8b 3e                	mov    (%esi),%edi
+ af8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ afb:	83 f8 02             	cmp    $0x2,%eax
+ afe:	74 60                	je     b60 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ b00:	83 ec 08             	sub    $0x8,%esp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	e8 89 f9 ff ff       	call   493 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ b0a:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ b0f:	31 c0                	xor    %eax,%eax
+ b11:	ba 01 00 00 00       	mov    $0x1,%edx
+ b16:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ b1a:	83 c4 10             	add    $0x10,%esp
+ b1d:	85 c0                	test   %eax,%eax
+ b1f:	74 36                	je     b57 <cond_wait+0x77>
+  if(c != 2)
+ b21:	83 f8 02             	cmp    $0x2,%eax
+ b24:	74 0c                	je     b32 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ b26:	b8 02 00 00 00       	mov    $0x2,%eax
+ b2b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b2e:	85 c0                	test   %eax,%eax
+ b30:	74 25                	je     b57 <cond_wait+0x77>
+ b32:	be 02 00 00 00       	mov    $0x2,%esi
+ b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3e:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ b40:	83 ec 08             	sub    $0x8,%esp
+ b43:	6a 02                	push   $0x2
+ b45:	53                   	push   %ebx
+ b46:	e8 48 f9 ff ff       	call   493 <futex_wait>
+ b4b:	89 f0                	mov    %esi,%eax
+ b4d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ b50:	83 c4 10             	add    $0x10,%esp
+ b53:	85 c0                	test   %eax,%eax
+ b55:	75 e9                	jne    b40 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ b57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b5a:	5b                   	pop    %ebx
+ b5b:	5e                   	pop    %esi
+ b5c:	5f                   	pop    %edi
+ b5d:	5d                   	pop    %ebp
+ b5e:	c3                   	ret
+ b5f:	90                   	nop
+    futex_wake(&m->val, 1);
+ b60:	83 ec 08             	sub    $0x8,%esp
+ b63:	6a 01                	push   $0x1
+ b65:	53                   	push   %ebx
+ b66:	e8 30 f9 ff ff       	call   49b <futex_wake>
+ b6b:	83 c4 10             	add    $0x10,%esp
+ b6e:	eb 90                	jmp    b00 <cond_wait+0x20>
+
+00000b70 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	83 ec 08             	sub    $0x8,%esp
+ b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ b79:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ b7d:	8b 50 04             	mov    0x4(%eax),%edx
+ b80:	85 d2                	test   %edx,%edx
+ b82:	75 0c                	jne    b90 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ b84:	c9                   	leave
+ b85:	c3                   	ret
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ b90:	83 ec 08             	sub    $0x8,%esp
+ b93:	6a 01                	push   $0x1
+ b95:	50                   	push   %eax
+ b96:	e8 00 f9 ff ff       	call   49b <futex_wake>
+ b9b:	83 c4 10             	add    $0x10,%esp
+}
+ b9e:	c9                   	leave
+ b9f:	c3                   	ret
+
+00000ba0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	83 ec 08             	sub    $0x8,%esp
+ ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ ba9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ bad:	8b 50 04             	mov    0x4(%eax),%edx
+ bb0:	85 d2                	test   %edx,%edx
+ bb2:	75 0c                	jne    bc0 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ bb4:	c9                   	leave
+ bb5:	c3                   	ret
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ bc0:	83 ec 08             	sub    $0x8,%esp
+ bc3:	68 ff ff ff 7f       	push   $0x7fffffff
+ bc8:	50                   	push   %eax
+ bc9:	e8 cd f8 ff ff       	call   49b <futex_wake>
+ bce:	83 c4 10             	add    $0x10,%esp
+}
+ bd1:	c9                   	leave
+ bd2:	c3                   	ret
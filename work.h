@@ -0,0 +1,9 @@
+// Deferred work, run by a per-CPU kernel worker thread.
+// The caller fills in fn and arg and passes the work to
+// queuework(), and must keep it allocated until fn runs;
+// fn may free it.
+struct work {
+  void (*fn)(void*);
+  void *arg;
+  struct work *next;  // Next in the queue
+};
@@ -0,0 +1,83 @@
+// Per-CPU work queues.
+//
+// Work that need not be done where it arises, such as freeing
+// a dead process's memory while holding the process locks, is
+// queued on the current CPU and done later by that CPU's
+// worker, a kernel thread pinned there, in the order queued.
+// Queueing on the current CPU keeps the work near the data it
+// touches and keeps the queues' locks uncontended.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "work.h"
+
+struct workqueue {
+  struct spinlock lock;
+  struct work *head;
+  struct work **tail;   // &head, or &next of the last work
+  struct proc *worker;
+} CACHEALIGN;
+
+static struct workqueue workqueues[NCPU];
+
+// Do q's work, one item at a time, forever.
+static void
+worker(void *arg)
+{
+  struct workqueue *q;
+  struct work *w;
+
+  q = arg;
+  acquire(&q->lock);
+  for(;;){
+    while((w = q->head) == 0)
+      sleep(q, &q->lock);
+    q->head = w->next;
+    if(q->head == 0)
+      q->tail = &q->head;
+    release(&q->lock);
+    w->fn(w->arg);  // may free w
+    acquire(&q->lock);
+  }
+}
+
+// Start a worker on each CPU.
+void
+workinit(void)
+{
+  struct workqueue *q;
+  char name[16];
+
+  for(q = workqueues; q < workqueues+ncpu; q++){
+    initlock(&q->lock, "workq");
+    q->tail = &q->head;
+    safestrcpy(name, "kworker/", sizeof(name));
+    name[8] = '0' + (q - workqueues) / 10;
+    name[9] = '0' + (q - workqueues) % 10;
+    name[10] = 0;
+    if((q->worker = kthread(name, worker, q, 1U << (q - workqueues))) == 0)
+      panic("workinit");
+  }
+}
+
+// Queue w to be done by this CPU's worker.
+void
+queuework(struct work *w)
+{
+  struct workqueue *q;
+
+  pushcli();
+  q = &workqueues[cpu-cpus];
+  popcli();
+  w->next = 0;
+  acquire(&q->lock);
+  *q->tail = w;
+  q->tail = &w->next;
+  wakeup(q);
+  release(&q->lock);
+}
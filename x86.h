@@ -130,6 +130,95 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically: if *addr == old, set it to newval.
+// Returns the previous value of *addr.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (result), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "cc");
+  return result;
+}
+
+// Atomically add n to *addr; return the old value.
+static inline int
+xadd(volatile int *addr, int n)
+{
+  asm volatile("lock; xaddl %0, %1" :
+               "+r" (n), "+m" (*addr) :
+               :
+               "cc", "memory");
+  return n;
+}
+
+// Tell the CPU we are spinning, which saves power and
+// avoids a memory-order flush when the wait ends.  The
+// memory clobber makes the compiler reread what we wait on.
+static inline void
+pause(void)
+{
+  asm volatile("pause" : : : "memory");
+}
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+  return val;
+}
+
+static inline void
+cpuid(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+               "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+               "a" (info));
+  if(eaxp)
+    *eaxp = eax;
+  if(ebxp)
+    *ebxp = ebx;
+  if(ecxp)
+    *ecxp = ecx;
+  if(edxp)
+    *edxp = edx;
+}
+
+static inline uint64
+rdmsr(uint msr)
+{
+  uint64 val;
+  asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+  return val;
+}
+
+static inline void
+wrmsr(uint msr, uint64 val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
+// Divide a 64-bit value by a 32-bit one.  gcc would call
+// libgcc's __udivdi3 for this, which we don't link against.
+static inline uint64
+divu64(uint64 n, uint d)
+{
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "0" (lo), "1" (r), "rm" (d));
+  return ((uint64)qhi << 32) | qlo;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +233,14 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
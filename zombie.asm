@@ -0,0 +1,1721 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 55 02 00 00       	call   26b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 df 02 00 00       	call   303 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 47 02 00 00       	call   273 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 1e 01 00 00       	call   28b <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 f1 00 00 00       	call   2b3 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 f4 00 00 00       	call   2cb <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 ba 00 00 00       	call   29b <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <exit>:
+SYSCALL(exit)
+ 273:	b8 02 00 00 00       	mov    $0x2,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <wait>:
+SYSCALL(wait)
+ 27b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <pipe>:
+SYSCALL(pipe)
+ 283:	b8 04 00 00 00       	mov    $0x4,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <read>:
+SYSCALL(read)
+ 28b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <write>:
+SYSCALL(write)
+ 293:	b8 10 00 00 00       	mov    $0x10,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <close>:
+SYSCALL(close)
+ 29b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <kill>:
+SYSCALL(kill)
+ 2a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <exec>:
+SYSCALL(exec)
+ 2ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <open>:
+SYSCALL(open)
+ 2b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mknod>:
+SYSCALL(mknod)
+ 2bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <unlink>:
+SYSCALL(unlink)
+ 2c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <fstat>:
+SYSCALL(fstat)
+ 2cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <link>:
+SYSCALL(link)
+ 2d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mkdir>:
+SYSCALL(mkdir)
+ 2db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <chdir>:
+SYSCALL(chdir)
+ 2e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <dup>:
+SYSCALL(dup)
+ 2eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getpid>:
+SYSCALL(getpid)
+ 2f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <sbrk>:
+SYSCALL(sbrk)
+ 2fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <sleep>:
+SYSCALL(sleep)
+ 303:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <uptime>:
+SYSCALL(uptime)
+ 30b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <add_dir>:
+SYSCALL(add_dir)
+ 313:	b8 16 00 00 00       	mov    $0x16,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <history>:
+SYSCALL(history)
+ 31b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 323:	b8 19 00 00 00       	mov    $0x19,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <nanosleep>:
+SYSCALL(nanosleep)
+ 32b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <clone>:
+SYSCALL(clone)
+ 333:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <join>:
+SYSCALL(join)
+ 33b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <futex_wait>:
+SYSCALL(futex_wait)
+ 343:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <futex_wake>:
+SYSCALL(futex_wake)
+ 34b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 353:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 35b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <sched_isolate>:
+SYSCALL(sched_isolate)
+ 363:	b8 21 00 00 00       	mov    $0x21,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <getprocinfo>:
+SYSCALL(getprocinfo)
+ 36b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <waitpid>:
+SYSCALL(waitpid)
+ 373:	b8 23 00 00 00       	mov    $0x23,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <tracectl>:
+SYSCALL(tracectl)
+ 37b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <traceread>:
+SYSCALL(traceread)
+ 383:	b8 25 00 00 00       	mov    $0x25,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sched_setdeadline>:
+SYSCALL(sched_setdeadline)
+ 38b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sched_dlyield>:
+SYSCALL(sched_dlyield)
+ 393:	b8 27 00 00 00       	mov    $0x27,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <sched_dlstat>:
+SYSCALL(sched_dlstat)
+ 39b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <irqroute>:
+SYSCALL(irqroute)
+ 3a3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <irqstat>:
+SYSCALL(irqstat)
+ 3ab:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <boottimes>:
+SYSCALL(boottimes)
+ 3b3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <lockbench>:
+SYSCALL(lockbench)
+ 3bb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <lockstat>:
+SYSCALL(lockstat)
+ 3c3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <cpustat>:
+SYSCALL(cpustat)
+ 3cb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <bcachesize>:
+SYSCALL(bcachesize)
+ 3d3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+ 3db:	66 90                	xchg   %ax,%ax
+ 3dd:	66 90                	xchg   %ax,%ax
+ 3df:	90                   	nop
+
+000003e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3e8:	89 d1                	mov    %edx,%ecx
+{
+ 3ea:	83 ec 3c             	sub    $0x3c,%esp
+ 3ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3f0:	85 d2                	test   %edx,%edx
+ 3f2:	0f 89 80 00 00 00    	jns    478 <printint+0x98>
+ 3f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3fc:	74 7a                	je     478 <printint+0x98>
+    x = -xx;
+ 3fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 400:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 405:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 408:	31 f6                	xor    %esi,%esi
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 410:	89 c8                	mov    %ecx,%eax
+ 412:	31 d2                	xor    %edx,%edx
+ 414:	89 f7                	mov    %esi,%edi
+ 416:	f7 f3                	div    %ebx
+ 418:	8d 76 01             	lea    0x1(%esi),%esi
+ 41b:	0f b6 92 e4 0a 00 00 	movzbl 0xae4(%edx),%edx
+ 422:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 426:	89 ca                	mov    %ecx,%edx
+ 428:	89 c1                	mov    %eax,%ecx
+ 42a:	39 da                	cmp    %ebx,%edx
+ 42c:	73 e2                	jae    410 <printint+0x30>
+  if(neg)
+ 42e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 431:	85 c0                	test   %eax,%eax
+ 433:	74 07                	je     43c <printint+0x5c>
+    buf[i++] = '-';
+ 435:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 43a:	89 f7                	mov    %esi,%edi
+ 43c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 43f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 442:	01 df                	add    %ebx,%edi
+ 444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 448:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 44b:	83 ec 04             	sub    $0x4,%esp
+ 44e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 451:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 454:	6a 01                	push   $0x1
+ 456:	50                   	push   %eax
+ 457:	56                   	push   %esi
+ 458:	e8 36 fe ff ff       	call   293 <write>
+  while(--i >= 0)
+ 45d:	89 f8                	mov    %edi,%eax
+ 45f:	83 c4 10             	add    $0x10,%esp
+ 462:	83 ef 01             	sub    $0x1,%edi
+ 465:	39 d8                	cmp    %ebx,%eax
+ 467:	75 df                	jne    448 <printint+0x68>
+}
+ 469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46c:	5b                   	pop    %ebx
+ 46d:	5e                   	pop    %esi
+ 46e:	5f                   	pop    %edi
+ 46f:	5d                   	pop    %ebp
+ 470:	c3                   	ret
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 478:	31 c0                	xor    %eax,%eax
+ 47a:	eb 89                	jmp    405 <printint+0x25>
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 489:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 48c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 48f:	0f b6 1e             	movzbl (%esi),%ebx
+ 492:	83 c6 01             	add    $0x1,%esi
+ 495:	84 db                	test   %bl,%bl
+ 497:	74 67                	je     500 <printf+0x80>
+ 499:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 49c:	31 d2                	xor    %edx,%edx
+ 49e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4a1:	eb 34                	jmp    4d7 <printf+0x57>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4b0:	83 f8 25             	cmp    $0x25,%eax
+ 4b3:	74 18                	je     4cd <printf+0x4d>
+  write(fd, &c, 1);
+ 4b5:	83 ec 04             	sub    $0x4,%esp
+ 4b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4be:	6a 01                	push   $0x1
+ 4c0:	50                   	push   %eax
+ 4c1:	57                   	push   %edi
+ 4c2:	e8 cc fd ff ff       	call   293 <write>
+ 4c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4d0:	83 c6 01             	add    $0x1,%esi
+ 4d3:	84 db                	test   %bl,%bl
+ 4d5:	74 29                	je     500 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4da:	85 d2                	test   %edx,%edx
+ 4dc:	74 ca                	je     4a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4de:	83 fa 25             	cmp    $0x25,%edx
+ 4e1:	75 ea                	jne    4cd <printf+0x4d>
+      if(c == 'd'){
+ 4e3:	83 f8 25             	cmp    $0x25,%eax
+ 4e6:	0f 84 24 01 00 00    	je     610 <printf+0x190>
+ 4ec:	83 e8 63             	sub    $0x63,%eax
+ 4ef:	83 f8 15             	cmp    $0x15,%eax
+ 4f2:	77 1c                	ja     510 <printf+0x90>
+ 4f4:	ff 24 85 8c 0a 00 00 	jmp    *0xa8c(,%eax,4)
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 503:	5b                   	pop    %ebx
+ 504:	5e                   	pop    %esi
+ 505:	5f                   	pop    %edi
+ 506:	5d                   	pop    %ebp
+ 507:	c3                   	ret
+ 508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+  write(fd, &c, 1);
+ 510:	83 ec 04             	sub    $0x4,%esp
+ 513:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 516:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 51a:	6a 01                	push   $0x1
+ 51c:	52                   	push   %edx
+ 51d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 520:	57                   	push   %edi
+ 521:	e8 6d fd ff ff       	call   293 <write>
+ 526:	83 c4 0c             	add    $0xc,%esp
+ 529:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 52c:	6a 01                	push   $0x1
+ 52e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 531:	52                   	push   %edx
+ 532:	57                   	push   %edi
+ 533:	e8 5b fd ff ff       	call   293 <write>
+        putc(fd, c);
+ 538:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53b:	31 d2                	xor    %edx,%edx
+ 53d:	eb 8e                	jmp    4cd <printf+0x4d>
+ 53f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 540:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 543:	83 ec 0c             	sub    $0xc,%esp
+ 546:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 54b:	8b 13                	mov    (%ebx),%edx
+ 54d:	6a 00                	push   $0x0
+ 54f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 551:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 554:	e8 87 fe ff ff       	call   3e0 <printint>
+        ap++;
+ 559:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 55c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55f:	31 d2                	xor    %edx,%edx
+ 561:	e9 67 ff ff ff       	jmp    4cd <printf+0x4d>
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 570:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 573:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 575:	83 c0 04             	add    $0x4,%eax
+ 578:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 57b:	85 db                	test   %ebx,%ebx
+ 57d:	0f 84 9d 00 00 00    	je     620 <printf+0x1a0>
+        while(*s != 0){
+ 583:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 586:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 588:	84 c0                	test   %al,%al
+ 58a:	0f 84 3d ff ff ff    	je     4cd <printf+0x4d>
+ 590:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 593:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 596:	89 de                	mov    %ebx,%esi
+ 598:	89 d3                	mov    %edx,%ebx
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5a9:	6a 01                	push   $0x1
+ 5ab:	53                   	push   %ebx
+ 5ac:	57                   	push   %edi
+ 5ad:	e8 e1 fc ff ff       	call   293 <write>
+        while(*s != 0){
+ 5b2:	0f b6 06             	movzbl (%esi),%eax
+ 5b5:	83 c4 10             	add    $0x10,%esp
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	75 e4                	jne    5a0 <printf+0x120>
+      state = 0;
+ 5bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5bf:	31 d2                	xor    %edx,%edx
+ 5c1:	e9 07 ff ff ff       	jmp    4cd <printf+0x4d>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 01                	push   $0x1
+ 5df:	e9 6b ff ff ff       	jmp    54f <printf+0xcf>
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	52                   	push   %edx
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 91 fc ff ff       	call   293 <write>
+        ap++;
+ 602:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 605:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 608:	31 d2                	xor    %edx,%edx
+ 60a:	e9 be fe ff ff       	jmp    4cd <printf+0x4d>
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 616:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 619:	6a 01                	push   $0x1
+ 61b:	e9 11 ff ff ff       	jmp    531 <printf+0xb1>
+ 620:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 625:	bb 84 0a 00 00       	mov    $0xa84,%ebx
+ 62a:	e9 61 ff ff ff       	jmp    590 <printf+0x110>
+ 62f:	90                   	nop
+
+00000630 <ufree>:
+static Header *freep;
+static struct lock mlock;  // threads share the heap
+
+static void
+ufree(void *ap)
+{
+ 630:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 631:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ 634:	89 e5                	mov    %esp,%ebp
+ 636:	57                   	push   %edi
+ 637:	56                   	push   %esi
+ 638:	53                   	push   %ebx
+ 639:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 63b:	a1 70 0f 00 00       	mov    0xf70,%eax
+ 640:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 642:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 644:	39 ca                	cmp    %ecx,%edx
+ 646:	73 30                	jae    678 <ufree+0x48>
+ 648:	39 c1                	cmp    %eax,%ecx
+ 64a:	72 04                	jb     650 <ufree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 64c:	39 c2                	cmp    %eax,%edx
+ 64e:	72 f0                	jb     640 <ufree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 650:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 653:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 656:	39 f8                	cmp    %edi,%eax
+ 658:	74 26                	je     680 <ufree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 65a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 65d:	8b 42 04             	mov    0x4(%edx),%eax
+ 660:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 663:	39 f1                	cmp    %esi,%ecx
+ 665:	74 30                	je     697 <ufree+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 667:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 669:	5b                   	pop    %ebx
+  freep = p;
+ 66a:	89 15 70 0f 00 00    	mov    %edx,0xf70
+}
+ 670:	5e                   	pop    %esi
+ 671:	5f                   	pop    %edi
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 678:	39 c1                	cmp    %eax,%ecx
+ 67a:	72 d0                	jb     64c <ufree+0x1c>
+ 67c:	eb c2                	jmp    640 <ufree+0x10>
+ 67e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 680:	03 70 04             	add    0x4(%eax),%esi
+ 683:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 686:	8b 02                	mov    (%edx),%eax
+ 688:	8b 00                	mov    (%eax),%eax
+ 68a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 68d:	8b 42 04             	mov    0x4(%edx),%eax
+ 690:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 693:	39 f1                	cmp    %esi,%ecx
+ 695:	75 d0                	jne    667 <ufree+0x37>
+    p->s.size += bp->s.size;
+ 697:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 69a:	89 15 70 0f 00 00    	mov    %edx,0xf70
+    p->s.size += bp->s.size;
+ 6a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6a8:	5b                   	pop    %ebx
+ 6a9:	5e                   	pop    %esi
+ 6aa:	5f                   	pop    %edi
+ 6ab:	5d                   	pop    %ebp
+ 6ac:	c3                   	ret
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006b0 <free>:
+  return freep;
+}
+
+void
+free(void *ap)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	53                   	push   %ebx
+ 6b4:	83 ec 10             	sub    $0x10,%esp
+ 6b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&mlock);
+ 6ba:	68 6c 0f 00 00       	push   $0xf6c
+ 6bf:	e8 ec 01 00 00       	call   8b0 <lock_acquire>
+  ufree(ap);
+ 6c4:	89 d8                	mov    %ebx,%eax
+ 6c6:	e8 65 ff ff ff       	call   630 <ufree>
+  lock_release(&mlock);
+ 6cb:	c7 45 08 6c 0f 00 00 	movl   $0xf6c,0x8(%ebp)
+}
+ 6d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&mlock);
+ 6d5:	83 c4 10             	add    $0x10,%esp
+}
+ 6d8:	c9                   	leave
+  lock_release(&mlock);
+ 6d9:	e9 f2 01 00 00       	jmp    8d0 <lock_release>
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&mlock);
+ 6ec:	68 6c 0f 00 00       	push   $0xf6c
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f1:	8d 48 07             	lea    0x7(%eax),%ecx
+ 6f4:	c1 e9 03             	shr    $0x3,%ecx
+ 6f7:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&mlock);
+ 6fa:	e8 b1 01 00 00       	call   8b0 <lock_acquire>
+  if((prevp = freep) == 0){
+ 6ff:	8b 15 70 0f 00 00    	mov    0xf70,%edx
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	85 d2                	test   %edx,%edx
+ 70a:	0f 84 b0 00 00 00    	je     7c0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 710:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 712:	8b 47 04             	mov    0x4(%edi),%eax
+ 715:	39 f0                	cmp    %esi,%eax
+ 717:	73 6f                	jae    788 <malloc+0xa8>
+  if(nu < 4096)
+ 719:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 71e:	39 de                	cmp    %ebx,%esi
+ 720:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 723:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 72a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 72d:	eb 0a                	jmp    739 <malloc+0x59>
+ 72f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 730:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ 732:	8b 47 04             	mov    0x4(%edi),%eax
+ 735:	39 f0                	cmp    %esi,%eax
+ 737:	73 4f                	jae    788 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&mlock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 739:	89 fa                	mov    %edi,%edx
+ 73b:	39 3d 70 0f 00 00    	cmp    %edi,0xf70
+ 741:	75 ed                	jne    730 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	ff 75 e4             	push   -0x1c(%ebp)
+ 749:	e8 ad fb ff ff       	call   2fb <sbrk>
+  if(p == (char*)-1)
+ 74e:	83 c4 10             	add    $0x10,%esp
+ 751:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 754:	74 15                	je     76b <malloc+0x8b>
+  hp->s.size = nu;
+ 756:	89 58 04             	mov    %ebx,0x4(%eax)
+  ufree((void*)(hp + 1));
+ 759:	83 c0 08             	add    $0x8,%eax
+ 75c:	e8 cf fe ff ff       	call   630 <ufree>
+  return freep;
+ 761:	8b 15 70 0f 00 00    	mov    0xf70,%edx
+      if((p = morecore(nunits)) == 0){
+ 767:	85 d2                	test   %edx,%edx
+ 769:	75 c5                	jne    730 <malloc+0x50>
+        lock_release(&mlock);
+ 76b:	83 ec 0c             	sub    $0xc,%esp
+ 76e:	68 6c 0f 00 00       	push   $0xf6c
+ 773:	e8 58 01 00 00       	call   8d0 <lock_release>
+        return 0;
+ 778:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ 77b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 77e:	31 c0                	xor    %eax,%eax
+}
+ 780:	5b                   	pop    %ebx
+ 781:	5e                   	pop    %esi
+ 782:	5f                   	pop    %edi
+ 783:	5d                   	pop    %ebp
+ 784:	c3                   	ret
+ 785:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 788:	39 c6                	cmp    %eax,%esi
+ 78a:	74 64                	je     7f0 <malloc+0x110>
+        p->s.size -= nunits;
+ 78c:	29 f0                	sub    %esi,%eax
+ 78e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ 791:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ 794:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&mlock);
+ 797:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ 79a:	89 15 70 0f 00 00    	mov    %edx,0xf70
+      lock_release(&mlock);
+ 7a0:	68 6c 0f 00 00       	push   $0xf6c
+ 7a5:	e8 26 01 00 00       	call   8d0 <lock_release>
+      return (void*)(p + 1);
+ 7aa:	83 c4 10             	add    $0x10,%esp
+}
+ 7ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7b0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ 7b3:	5b                   	pop    %ebx
+ 7b4:	5e                   	pop    %esi
+ 7b5:	5f                   	pop    %edi
+ 7b6:	5d                   	pop    %ebp
+ 7b7:	c3                   	ret
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ 7c0:	c7 05 70 0f 00 00 74 	movl   $0xf74,0xf70
+ 7c7:	0f 00 00 
+    base.s.size = 0;
+ 7ca:	bf 74 0f 00 00       	mov    $0xf74,%edi
+    base.s.ptr = freep = prevp = &base;
+ 7cf:	c7 05 74 0f 00 00 74 	movl   $0xf74,0xf74
+ 7d6:	0f 00 00 
+    base.s.size = 0;
+ 7d9:	c7 05 78 0f 00 00 00 	movl   $0x0,0xf78
+ 7e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7e3:	e9 31 ff ff ff       	jmp    719 <malloc+0x39>
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7f0:	8b 07                	mov    (%edi),%eax
+ 7f2:	89 02                	mov    %eax,(%edx)
+ 7f4:	eb a1                	jmp    797 <malloc+0xb7>
+ 7f6:	66 90                	xchg   %ax,%ax
+ 7f8:	66 90                	xchg   %ax,%ax
+ 7fa:	66 90                	xchg   %ax,%ax
+ 7fc:	66 90                	xchg   %ax,%ax
+ 7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <thread_create>:
+#include "mmu.h"
+
+// Start a thread; return its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	53                   	push   %ebx
+ 804:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(PGSIZE)) == 0)
+ 807:	68 00 10 00 00       	push   $0x1000
+ 80c:	e8 cf fe ff ff       	call   6e0 <malloc>
+ 811:	83 c4 10             	add    $0x10,%esp
+ 814:	85 c0                	test   %eax,%eax
+ 816:	74 37                	je     84f <thread_create+0x4f>
+    return -1;
+  if((pid = clone(fn, arg, stack)) < 0)
+ 818:	83 ec 04             	sub    $0x4,%esp
+ 81b:	89 c3                	mov    %eax,%ebx
+ 81d:	50                   	push   %eax
+ 81e:	ff 75 0c             	push   0xc(%ebp)
+ 821:	ff 75 08             	push   0x8(%ebp)
+ 824:	e8 0a fb ff ff       	call   333 <clone>
+ 829:	83 c4 10             	add    $0x10,%esp
+ 82c:	85 c0                	test   %eax,%eax
+ 82e:	78 08                	js     838 <thread_create+0x38>
+    free(stack);
+  return pid;
+}
+ 830:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 833:	c9                   	leave
+ 834:	c3                   	ret
+ 835:	8d 76 00             	lea    0x0(%esi),%esi
+    free(stack);
+ 838:	83 ec 0c             	sub    $0xc,%esp
+ 83b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 83e:	53                   	push   %ebx
+ 83f:	e8 6c fe ff ff       	call   6b0 <free>
+ 844:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 847:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(stack);
+ 84a:	83 c4 10             	add    $0x10,%esp
+}
+ 84d:	c9                   	leave
+ 84e:	c3                   	ret
+    return -1;
+ 84f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 854:	eb da                	jmp    830 <thread_create+0x30>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <thread_join>:
+
+// Wait for one of our threads to exit and free its stack.
+// Return its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ 866:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 869:	50                   	push   %eax
+ 86a:	e8 cc fa ff ff       	call   33b <join>
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	85 c0                	test   %eax,%eax
+ 874:	79 0a                	jns    880 <thread_join+0x20>
+    free(stack);
+  return pid;
+}
+ 876:	c9                   	leave
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+ 880:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    free(stack);
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	ff 75 f4             	push   -0xc(%ebp)
+ 889:	e8 22 fe ff ff       	call   6b0 <free>
+ 88e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 891:	83 c4 10             	add    $0x10,%esp
+}
+ 894:	c9                   	leave
+ 895:	c3                   	ret
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <lock_init>:
+
+void
+lock_init(struct lock *lk)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8ac:	5d                   	pop    %ebp
+ 8ad:	c3                   	ret
+ 8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <lock_acquire>:
+
+void
+lock_acquire(struct lock *lk)
+{
+ 8b0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+ 8c0:	89 c8                	mov    %ecx,%eax
+ 8c2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 8c5:	85 c0                	test   %eax,%eax
+ 8c7:	75 f7                	jne    8c0 <lock_acquire+0x10>
+    ;
+}
+ 8c9:	5d                   	pop    %ebp
+ 8ca:	c3                   	ret
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+
+000008d0 <lock_release>:
+
+void
+lock_release(struct lock *lk)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	31 c0                	xor    %eax,%eax
+ 8d3:	89 e5                	mov    %esp,%ebp
+ 8d5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8d8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 8db:	5d                   	pop    %ebp
+ 8dc:	c3                   	ret
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <mutex_init>:
+// Mutexes and condition variables sleep in futex_wait when
+// they have to, but make no system call when uncontended.
+
+void
+mutex_init(struct mutex *m)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+  m->val = 0;
+ 8e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8ec:	5d                   	pop    %ebp
+ 8ed:	c3                   	ret
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 8f0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 8f1:	31 c0                	xor    %eax,%eax
+ 8f3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8f8:	89 e5                	mov    %esp,%ebp
+ 8fa:	56                   	push   %esi
+ 8fb:	53                   	push   %ebx
+ 8fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 8ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 903:	85 c0                	test   %eax,%eax
+ 905:	74 30                	je     937 <mutex_lock+0x47>
+    return;
+  // Contended: mark the mutex as having waiters, so the
+  // holder's unlock will wake us.
+  if(c != 2)
+ 907:	83 f8 02             	cmp    $0x2,%eax
+ 90a:	74 0c                	je     918 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 90c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 911:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->val, 2);
+  while(c != 0){
+ 914:	85 c0                	test   %eax,%eax
+ 916:	74 1f                	je     937 <mutex_lock+0x47>
+ 918:	be 02 00 00 00       	mov    $0x2,%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->val, 2);
+ 920:	83 ec 08             	sub    $0x8,%esp
+ 923:	6a 02                	push   $0x2
+ 925:	53                   	push   %ebx
+ 926:	e8 18 fa ff ff       	call   343 <futex_wait>
+ 92b:	89 f0                	mov    %esi,%eax
+ 92d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 930:	83 c4 10             	add    $0x10,%esp
+ 933:	85 c0                	test   %eax,%eax
+ 935:	75 e9                	jne    920 <mutex_lock+0x30>
+    c = xchg(&m->val, 2);
+  }
+}
+ 937:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 93a:	5b                   	pop    %ebx
+ 93b:	5e                   	pop    %esi
+ 93c:	5d                   	pop    %ebp
+ 93d:	c3                   	ret
+ 93e:	66 90                	xchg   %ax,%ax
+
+00000940 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 940:	55                   	push   %ebp
+ 941:	31 c0                	xor    %eax,%eax
+ 943:	89 e5                	mov    %esp,%ebp
+ 945:	83 ec 08             	sub    $0x8,%esp
+ 948:	8b 55 08             	mov    0x8(%ebp),%edx
+ 94b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->val, 0) == 2)
+ 94e:	83 f8 02             	cmp    $0x2,%eax
+ 951:	74 05                	je     958 <mutex_unlock+0x18>
+    futex_wake(&m->val, 1);
+}
+ 953:	c9                   	leave
+ 954:	c3                   	ret
+ 955:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->val, 1);
+ 958:	83 ec 08             	sub    $0x8,%esp
+ 95b:	6a 01                	push   $0x1
+ 95d:	52                   	push   %edx
+ 95e:	e8 e8 f9 ff ff       	call   34b <futex_wake>
+ 963:	83 c4 10             	add    $0x10,%esp
+}
+ 966:	c9                   	leave
+ 967:	c3                   	ret
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+
+00000970 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	8b 45 08             	mov    0x8(%ebp),%eax
+  c->seq = 0;
+ 976:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  c->nwait = 0;
+ 97c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ 983:	5d                   	pop    %ebp
+ 984:	c3                   	ret
+ 985:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <cond_wait>:
+
+// Atomically release m and wait for a signal; relock m.
+// Like pthread_cond_wait, may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 0c             	sub    $0xc,%esp
+ 999:	8b 75 08             	mov    0x8(%ebp),%esi
+ 99c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  __sync_fetch_and_add(&c->nwait, 1);
+ 99f:	f0 83 46 04 01       	lock addl $0x1,0x4(%esi)
+ 9a4:	31 c0                	xor    %eax,%eax
+  seq = c->seq;
+ 9a6:	8b 3e                	mov    (%esi),%edi
+ 9a8:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->val, 0) == 2)
+ 9ab:	83 f8 02             	cmp    $0x2,%eax
+ 9ae:	74 60                	je     a10 <cond_wait+0x80>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 9b0:	83 ec 08             	sub    $0x8,%esp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	e8 89 f9 ff ff       	call   343 <futex_wait>
+  __sync_fetch_and_sub(&c->nwait, 1);
+ 9ba:	f0 83 6e 04 01       	lock subl $0x1,0x4(%esi)
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 9bf:	31 c0                	xor    %eax,%eax
+ 9c1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9c6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->val, 0, 1)) == 0)
+ 9ca:	83 c4 10             	add    $0x10,%esp
+ 9cd:	85 c0                	test   %eax,%eax
+ 9cf:	74 36                	je     a07 <cond_wait+0x77>
+  if(c != 2)
+ 9d1:	83 f8 02             	cmp    $0x2,%eax
+ 9d4:	74 0c                	je     9e2 <cond_wait+0x52>
+  asm volatile("lock; xchgl %0, %1" :
+ 9d6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9db:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 9de:	85 c0                	test   %eax,%eax
+ 9e0:	74 25                	je     a07 <cond_wait+0x77>
+ 9e2:	be 02 00 00 00       	mov    $0x2,%esi
+ 9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ee:	66 90                	xchg   %ax,%ax
+    futex_wait(&m->val, 2);
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	6a 02                	push   $0x2
+ 9f5:	53                   	push   %ebx
+ 9f6:	e8 48 f9 ff ff       	call   343 <futex_wait>
+ 9fb:	89 f0                	mov    %esi,%eax
+ 9fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ a00:	83 c4 10             	add    $0x10,%esp
+ a03:	85 c0                	test   %eax,%eax
+ a05:	75 e9                	jne    9f0 <cond_wait+0x60>
+  mutex_lock(m);
+}
+ a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0a:	5b                   	pop    %ebx
+ a0b:	5e                   	pop    %esi
+ a0c:	5f                   	pop    %edi
+ a0d:	5d                   	pop    %ebp
+ a0e:	c3                   	ret
+ a0f:	90                   	nop
+    futex_wake(&m->val, 1);
+ a10:	83 ec 08             	sub    $0x8,%esp
+ a13:	6a 01                	push   $0x1
+ a15:	53                   	push   %ebx
+ a16:	e8 30 f9 ff ff       	call   34b <futex_wake>
+ a1b:	83 c4 10             	add    $0x10,%esp
+ a1e:	eb 90                	jmp    9b0 <cond_wait+0x20>
+
+00000a20 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	83 ec 08             	sub    $0x8,%esp
+ a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a29:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a2d:	8b 50 04             	mov    0x4(%eax),%edx
+ a30:	85 d2                	test   %edx,%edx
+ a32:	75 0c                	jne    a40 <cond_signal+0x20>
+    futex_wake(&c->seq, 1);
+}
+ a34:	c9                   	leave
+ a35:	c3                   	ret
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 1);
+ a40:	83 ec 08             	sub    $0x8,%esp
+ a43:	6a 01                	push   $0x1
+ a45:	50                   	push   %eax
+ a46:	e8 00 f9 ff ff       	call   34b <futex_wake>
+ a4b:	83 c4 10             	add    $0x10,%esp
+}
+ a4e:	c9                   	leave
+ a4f:	c3                   	ret
+
+00000a50 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	83 ec 08             	sub    $0x8,%esp
+ a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ a59:	f0 83 00 01          	lock addl $0x1,(%eax)
+  if(c->nwait)
+ a5d:	8b 50 04             	mov    0x4(%eax),%edx
+ a60:	85 d2                	test   %edx,%edx
+ a62:	75 0c                	jne    a70 <cond_broadcast+0x20>
+    futex_wake(&c->seq, 0x7fffffff);
+}
+ a64:	c9                   	leave
+ a65:	c3                   	ret
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&c->seq, 0x7fffffff);
+ a70:	83 ec 08             	sub    $0x8,%esp
+ a73:	68 ff ff ff 7f       	push   $0x7fffffff
+ a78:	50                   	push   %eax
+ a79:	e8 cd f8 ff ff       	call   34b <futex_wake>
+ a7e:	83 c4 10             	add    $0x10,%esp
+}
+ a81:	c9                   	leave
+ a82:	c3                   	ret